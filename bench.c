@@ -0,0 +1,84 @@
+// Benchmark harness built on the time-stamp counter.
+// bench() calls fn(arg) a few times untimed to warm caches
+// and TLBs, then times each of runs further calls and reports
+// the minimum, median and 99th percentile time per operation.
+
+#include "types.h"
+#include "user.h"
+
+#define WARMUP     2     // untimed calls before measuring
+#define MAXRUNS  256     // most timed calls per bench()
+
+static void
+sort(uint64 *a, int n)
+{
+  int i, j;
+  uint64 v;
+
+  for(i = 1; i < n; i++){
+    v = a[i];
+    for(j = i; j > 0 && a[j-1] > v; j--)
+      a[j] = a[j-1];
+    a[j] = v;
+  }
+}
+
+// Picoseconds per op for a run of ops operations taking c cycles.
+static uint64
+psperop(uint64 c, uint ops)
+{
+  return udiv64(cyc2ns(c) * 1000, ops);
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+  if(frac < 100)
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+}
+
+// Time runs calls of fn(arg), each performing ops operations.
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+  for(i = 0; i < runs; i++){
+    t0 = cycles();
+    fn(arg);
+    t[i] = cycles() - t0;
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+  st->median = psperop(t[runs/2], ops);
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+
+  if(name){
+    printf(1, "%s: min ", name);
+    printps(1, st->min);
+    printf(1, " median ");
+    printps(1, st->median);
+    printf(1, " p99 ");
+    printps(1, st->p99);
+    printf(1, " ns/op (%d runs)\n", runs);
+  }
+  return 0;
+}
@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -21,75 +21,207 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
-struct {
+// Buffers are found through a hash table on (dev, blockno).
+// Each bucket has its own lock, which guards its chain and the
+// refcnt of the buffers on it, so lookups of different blocks
+// do not contend.  Buffers no one holds wait on the free list,
+// least recently released first, under evictlock; a miss takes
+// the buffer at its head.
+#define NBUCKET 256
+#define BHASH(dev, blockno) (((dev) * 1009 + (blockno)) % NBUCKET)
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct spinlock evictlock;  // free list; one miss at a time
+  struct buf free;            // free list head, LRU order
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+// Add b to bucket bk's chain.  Caller holds bk's lock.
+static void
+hashadd(struct bucket *bk, struct buf *b)
+{
+  b->prev = 0;
+  b->next = bk->head;
+  if(bk->head)
+    bk->head->prev = b;
+  bk->head = b;
+}
+
+// Take b off bucket bk's chain.  Caller holds bk's lock.
+static void
+hashdel(struct bucket *bk, struct buf *b)
+{
+  if(b->prev)
+    b->prev->next = b->next;
+  else
+    bk->head = b->next;
+  if(b->next)
+    b->next->prev = b->prev;
+}
+
+// Put b at the tail of the free list, or take it off.
+// Caller holds evictlock.
+static void
+freeadd(struct buf *b)
+{
+  b->fnext = &bcache.free;
+  b->fprev = bcache.free.fprev;
+  bcache.free.fprev->fnext = b;
+  bcache.free.fprev = b;
+}
+
+static void
+freedel(struct buf *b)
+{
+  b->fprev->fnext = b->fnext;
+  b->fnext->fprev = b->fprev;
+  b->fnext = b->fprev = 0;
+}
+
+// Carve the buffer headers and data out of whole pages, since
+// kalloc hands out one page at a time.  Must come after kinit2.
 void
 binit(void)
 {
+  struct bucket *bk;
   struct buf *b;
+  char *p;
+  int i, n;
 
-  initlock(&bcache.lock, "bcache");
+  initlock(&bcache.evictlock, "bcache");
+  for(i = 0; i < NBUCKET; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
+  bcache.free.fnext = bcache.free.fprev = &bcache.free;
 
-//PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  // All buffers start free, hashed under a block number
+  // no one will ask for.
+  bk = &bcache.bucket[BHASH(0, ~0)];
+  p = 0;
+  for(n = 0; n < NBUF; n++){
+    if(n % (PGSIZE/sizeof(*b)) == 0 && (p = kalloc()) == 0)
+      panic("binit");
+    b = (struct buf*)p + n % (PGSIZE/sizeof(*b));
+    memset(b, 0, sizeof(*b));
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->blockno = ~0;
+    hashadd(bk, b);
+    freeadd(b);
+  }
+
+  // Data, PGSIZE/BSIZE blocks to a page.
+  n = 0;
+  for(b = bk->head; b; b = b->next, n++){
+    if(n % (PGSIZE/BSIZE) == 0 && (p = kalloc()) == 0)
+      panic("binit");
+    b->data = (uchar*)p + (n % (PGSIZE/BSIZE)) * BSIZE;
   }
 }
 
+// Find block blockno of dev in bucket bk, whose lock is held.
+static struct buf*
+lookup(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->next)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Give the least recently used free buffer to block blockno of
+// dev, which is not cached, and return it locked.  Returns 0 if
+// no buffer is free.  Caller holds evictlock.
+static struct buf*
+recycle(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  while((b = bcache.free.fnext) != &bcache.free){
+    freedel(b);
+    bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+    acquire(&bk->lock);
+    // A hit may have taken b since it was freed, and even if
+    // refcnt==0, B_DIRTY indicates a buffer is in use because
+    // log.c has modified it but not yet committed it.  Either
+    // way bput puts it back on the list when it is done.
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      hashdel(bk, b);
+      release(&bk->lock);
+      break;
+    }
+    release(&bk->lock);
+  }
+  if(b == &bcache.free)
+    return 0;
+
+  // No one holds b, so its lock is free; take it before anyone
+  // can find b in its new bucket.
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  acquiresleep(&b->lock);
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
+  hashadd(bk, b);
+  release(&bk->lock);
+  return b;
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
 static struct buf*
 bget(uint dev, uint blockno)
 {
+  struct bucket *bk;
   struct buf *b;
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BHASH(dev, blockno)];
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(&bk->lock);
+  if((b = lookup(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    acquiresleep(&b->lock);
+    return b;
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  // Not cached.  Look again once no other miss is in progress,
+  // since that one may have been for this block.
+  acquire(&bcache.evictlock);
+  acquire(&bk->lock);
+  if((b = lookup(bk, dev, blockno)) != 0){
+    b->refcnt++;
+    release(&bk->lock);
+    release(&bcache.evictlock);
+    acquiresleep(&b->lock);
+    return b;
   }
-  panic("bget: no buffers");
+  release(&bk->lock);
+
+  // Recycle the least recently used free buffer.
+  if((b = recycle(dev, blockno)) == 0)
+    panic("bget: no buffers");
+  release(&bcache.evictlock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -115,30 +247,105 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
-// Release a locked buffer.
-// Move to the head of the MRU list.
+// Write n locked bufs to disk together, so that adjacent
+// blocks go as one transfer.
 void
-brelse(struct buf *b)
+bwritev(struct buf **bv, int n)
 {
-  if(!holdingsleep(&b->lock))
-    panic("brelse");
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bv[i]->lock))
+      panic("bwritev");
+    bv[i]->flags |= B_DIRTY;
+  }
+  iderwv(bv, n);
+}
+
+// Start reading block blockno of dev into the cache, without
+// waiting for it, unless it is already there or on its way.
+// Read-ahead is only a hint, so give up rather than wait or
+// panic if no buffer is free.  The disk driver calls bdone
+// when the read completes.
+void
+breada(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
+  b = lookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return;
+
+  acquire(&bcache.evictlock);
+  acquire(&bk->lock);
+  if(lookup(bk, dev, blockno)){
+    release(&bk->lock);
+    release(&bcache.evictlock);
+    return;
+  }
+  release(&bk->lock);
+  b = recycle(dev, blockno);
+  release(&bcache.evictlock);
+  if(b == 0)
+    return;
+
+  b->flags |= B_ASYNC;
+  iderw(b);
+}
+
+// Unlock b and drop a reference.  Once no one holds it,
+// it goes to the tail of the free list.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  if(b->refcnt > 1){
+    b->refcnt--;
+    release(&bk->lock);
+    return;
+  }
+  release(&bk->lock);
+
+  // Probably the last reference.  Our reference keeps b in bk
+  // while the locks are retaken in order.
+  acquire(&bcache.evictlock);
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    if(b->fnext)
+      freedel(b);
+    freeadd(b);
   }
-  
-  release(&bcache.lock);
+  release(&bk->lock);
+  release(&bcache.evictlock);
+}
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("brelse");
+  bput(b);
+}
+
+// The read breada started on b is done.  Called by the disk
+// driver, perhaps from an interrupt, so b is released on behalf
+// of the process that started the read.
+void
+bdone(struct buf *b)
+{
+  bput(b);
 }
 //PAGEBREAK!
 // Blank page.
-
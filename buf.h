@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *prev;  // hash chain
   struct buf *next;
+  struct buf *fprev; // free list, or 0 if not on it
+  struct buf *fnext;
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint64 qtime;      // rdtsc() when queued, for diskstat
+  uchar *data;       // BSIZE bytes
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read-ahead: driver calls bdone when read
 
@@ -0,0 +1,1839 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 f9 03 00 00       	call   440 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 fd 03 00 00       	call   458 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 73 0c 00 00       	push   $0xc73
+  6c:	6a 01                	push   $0x1
+  6e:	e8 ad 05 00 00       	call   620 <printf>
+      exit();
+  73:	e8 a0 03 00 00       	call   418 <exit>
+  }
+  exit();
+  78:	e8 9b 03 00 00       	call   418 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 8c 03 00 00       	call   418 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 e0 10 00 00       	push   $0x10e0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 88 03 00 00       	call   438 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 e0 10 00 00       	push   $0x10e0
+  c4:	56                   	push   %esi
+  c5:	e8 66 03 00 00       	call   430 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 50 0c 00 00       	push   $0xc50
+  e4:	6a 01                	push   $0x1
+  e6:	e8 35 05 00 00       	call   620 <printf>
+      exit();
+  eb:	e8 28 03 00 00       	call   418 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 62 0c 00 00       	push   $0xc62
+  f7:	6a 01                	push   $0x1
+  f9:	e8 22 05 00 00       	call   620 <printf>
+    exit();
+  fe:	e8 15 03 00 00       	call   418 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 e3 01 00 00       	call   430 <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 b6 01 00 00       	call   458 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 b9 01 00 00       	call   470 <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 7f 01 00 00       	call   440 <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 350:	55                   	push   %ebp
+ 351:	31 d2                	xor    %edx,%edx
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	53                   	push   %ebx
+ 356:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 359:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 35c:	f7 f3                	div    %ebx
+ 35e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 360:	8b 45 08             	mov    0x8(%ebp),%eax
+ 363:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 368:	89 ca                	mov    %ecx,%edx
+}
+ 36a:	c9                   	leave
+ 36b:	c3                   	ret
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 370:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 372:	c3                   	ret
+ 373:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000380 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	53                   	push   %ebx
+ 386:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 389:	8b 35 e0 12 00 00    	mov    0x12e0,%esi
+{
+ 38f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 392:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 395:	85 f6                	test   %esi,%esi
+ 397:	74 2f                	je     3c8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 399:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 39e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 3a4:	f7 e3                	mul    %ebx
+ 3a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 3a9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 3ac:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 3af:	31 d2                	xor    %edx,%edx
+ 3b1:	f7 f6                	div    %esi
+ 3b3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 3b8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3bb:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 3bd:	89 da                	mov    %ebx,%edx
+}
+ 3bf:	5b                   	pop    %ebx
+ 3c0:	5e                   	pop    %esi
+ 3c1:	5f                   	pop    %edi
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+ 3c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 3c8:	e8 0b 01 00 00       	call   4d8 <tscfreq>
+ 3cd:	a3 e0 12 00 00       	mov    %eax,0x12e0
+ 3d2:	89 c6                	mov    %eax,%esi
+ 3d4:	eb c3                	jmp    399 <cyc2ns+0x19>
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	83 ec 10             	sub    $0x10,%esp
+ 3e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 3ea:	6a 00                	push   $0x0
+ 3ec:	e8 3f 01 00 00       	call   530 <getpriority>
+ 3f1:	5a                   	pop    %edx
+ 3f2:	59                   	pop    %ecx
+ 3f3:	01 d8                	add    %ebx,%eax
+ 3f5:	50                   	push   %eax
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 2b 01 00 00       	call   528 <setpriority>
+  return getpriority(0);
+ 3fd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 404:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 407:	83 c4 10             	add    $0x10,%esp
+}
+ 40a:	c9                   	leave
+  return getpriority(0);
+ 40b:	e9 20 01 00 00       	jmp    530 <getpriority>
+
+00000410 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 410:	b8 01 00 00 00       	mov    $0x1,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <exit>:
+SYSCALL(exit)
+ 418:	b8 02 00 00 00       	mov    $0x2,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <wait>:
+SYSCALL(wait)
+ 420:	b8 03 00 00 00       	mov    $0x3,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <pipe>:
+SYSCALL(pipe)
+ 428:	b8 04 00 00 00       	mov    $0x4,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <read>:
+SYSCALL(read)
+ 430:	b8 05 00 00 00       	mov    $0x5,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <write>:
+SYSCALL(write)
+ 438:	b8 10 00 00 00       	mov    $0x10,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <close>:
+SYSCALL(close)
+ 440:	b8 15 00 00 00       	mov    $0x15,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <kill>:
+SYSCALL(kill)
+ 448:	b8 06 00 00 00       	mov    $0x6,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <exec>:
+SYSCALL(exec)
+ 450:	b8 07 00 00 00       	mov    $0x7,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <open>:
+SYSCALL(open)
+ 458:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <mknod>:
+SYSCALL(mknod)
+ 460:	b8 11 00 00 00       	mov    $0x11,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <unlink>:
+SYSCALL(unlink)
+ 468:	b8 12 00 00 00       	mov    $0x12,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <fstat>:
+SYSCALL(fstat)
+ 470:	b8 08 00 00 00       	mov    $0x8,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <link>:
+SYSCALL(link)
+ 478:	b8 13 00 00 00       	mov    $0x13,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <mkdir>:
+SYSCALL(mkdir)
+ 480:	b8 14 00 00 00       	mov    $0x14,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <chdir>:
+SYSCALL(chdir)
+ 488:	b8 09 00 00 00       	mov    $0x9,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <dup>:
+SYSCALL(dup)
+ 490:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <getpid>:
+SYSCALL(getpid)
+ 498:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <sbrk>:
+SYSCALL(sbrk)
+ 4a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <sleep>:
+SYSCALL(sleep)
+ 4a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <uptime>:
+SYSCALL(uptime)
+ 4b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <promote>:
+
+SYSCALL(promote)
+ 4b8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <demote>:
+SYSCALL(demote)
+ 4c0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 4c8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 4d0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <tscfreq>:
+SYSCALL(tscfreq)
+ 4d8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <tracemask>:
+SYSCALL(tracemask)
+ 4e0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <traceread>:
+SYSCALL(traceread)
+ 4e8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <profile>:
+SYSCALL(profile)
+ 4f0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <profread>:
+SYSCALL(profread)
+ 4f8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <lockstat>:
+SYSCALL(lockstat)
+ 500:	b8 21 00 00 00       	mov    $0x21,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 508:	b8 22 00 00 00       	mov    $0x22,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <sysstat>:
+SYSCALL(sysstat)
+ 510:	b8 23 00 00 00       	mov    $0x23,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <kbench>:
+SYSCALL(kbench)
+ 518:	b8 24 00 00 00       	mov    $0x24,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <yield>:
+SYSCALL(yield)
+ 520:	b8 25 00 00 00       	mov    $0x25,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <setpriority>:
+SYSCALL(setpriority)
+ 528:	b8 26 00 00 00       	mov    $0x26,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <getpriority>:
+SYSCALL(getpriority)
+ 530:	b8 27 00 00 00       	mov    $0x27,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 538:	b8 28 00 00 00       	mov    $0x28,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 540:	b8 29 00 00 00       	mov    $0x29,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <clone>:
+SYSCALL(clone)
+ 548:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <join>:
+SYSCALL(join)
+ 550:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <futex_wait>:
+SYSCALL(futex_wait)
+ 558:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <futex_wake>:
+SYSCALL(futex_wake)
+ 560:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <spawn>:
+SYSCALL(spawn)
+ 568:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <diskstat>:
+SYSCALL(diskstat)
+ 570:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+ 578:	66 90                	xchg   %ax,%ax
+ 57a:	66 90                	xchg   %ax,%ax
+ 57c:	66 90                	xchg   %ax,%ax
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 e8 0c 00 00 	movzbl 0xce8(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 3b fe ff ff       	call   438 <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 d1 fd ff ff       	call   438 <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 90 0c 00 00 	jmp    *0xc90(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 72 fd ff ff       	call   438 <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 60 fd ff ff       	call   438 <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 e6 fc ff ff       	call   438 <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 96 fc ff ff       	call   438 <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb 88 0c 00 00       	mov    $0xc88,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	a1 e4 12 00 00       	mov    0x12e4,%eax
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ec:	39 ca                	cmp    %ecx,%edx
+ 7ee:	73 30                	jae    820 <free+0x50>
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 04                	jb     7f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f4:	39 c2                	cmp    %eax,%edx
+ 7f6:	72 f0                	jb     7e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7fe:	39 f8                	cmp    %edi,%eax
+ 800:	74 2e                	je     830 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 802:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 805:	8b 42 04             	mov    0x4(%edx),%eax
+ 808:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 80b:	39 f1                	cmp    %esi,%ecx
+ 80d:	74 38                	je     847 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 80f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 811:	5b                   	pop    %ebx
+  freep = p;
+ 812:	89 15 e4 12 00 00    	mov    %edx,0x12e4
+}
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 d0                	jb     7f4 <free+0x24>
+ 824:	eb c2                	jmp    7e8 <free+0x18>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 70 04             	add    0x4(%eax),%esi
+ 833:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	75 c8                	jne    80f <free+0x3f>
+    p->s.size += bp->s.size;
+ 847:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 84a:	89 15 e4 12 00 00    	mov    %edx,0x12e4
+    p->s.size += bp->s.size;
+ 850:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 853:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 856:	89 0a                	mov    %ecx,(%edx)
+}
+ 858:	5b                   	pop    %ebx
+ 859:	5e                   	pop    %esi
+ 85a:	5f                   	pop    %edi
+ 85b:	5d                   	pop    %ebp
+ 85c:	c3                   	ret
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 86c:	8b 15 e4 12 00 00    	mov    0x12e4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 872:	8d 78 07             	lea    0x7(%eax),%edi
+ 875:	c1 ef 03             	shr    $0x3,%edi
+ 878:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 87b:	85 d2                	test   %edx,%edx
+ 87d:	0f 84 8d 00 00 00    	je     910 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 883:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 885:	8b 48 04             	mov    0x4(%eax),%ecx
+ 888:	39 f9                	cmp    %edi,%ecx
+ 88a:	73 64                	jae    8f0 <malloc+0x90>
+  if(nu < 4096)
+ 88c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 891:	39 df                	cmp    %ebx,%edi
+ 893:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 89d:	eb 0a                	jmp    8a9 <malloc+0x49>
+ 89f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a5:	39 f9                	cmp    %edi,%ecx
+ 8a7:	73 47                	jae    8f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8a9:	89 c2                	mov    %eax,%edx
+ 8ab:	39 05 e4 12 00 00    	cmp    %eax,0x12e4
+ 8b1:	75 ed                	jne    8a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	56                   	push   %esi
+ 8b7:	e8 e4 fb ff ff       	call   4a0 <sbrk>
+  if(p == (char*)-1)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c2:	74 1c                	je     8e0 <malloc+0x80>
+  hp->s.size = nu;
+ 8c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c7:	83 ec 0c             	sub    $0xc,%esp
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 fd fe ff ff       	call   7d0 <free>
+  return freep;
+ 8d3:	8b 15 e4 12 00 00    	mov    0x12e4,%edx
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	85 d2                	test   %edx,%edx
+ 8de:	75 c0                	jne    8a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8e3:	31 c0                	xor    %eax,%eax
+}
+ 8e5:	5b                   	pop    %ebx
+ 8e6:	5e                   	pop    %esi
+ 8e7:	5f                   	pop    %edi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8f0:	39 cf                	cmp    %ecx,%edi
+ 8f2:	74 4c                	je     940 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8f4:	29 f9                	sub    %edi,%ecx
+ 8f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ff:	89 15 e4 12 00 00    	mov    %edx,0x12e4
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 908:	83 c0 08             	add    $0x8,%eax
+}
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5f                   	pop    %edi
+ 90e:	5d                   	pop    %ebp
+ 90f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 e4 12 00 00 e8 	movl   $0x12e8,0x12e4
+ 917:	12 00 00 
+    base.s.size = 0;
+ 91a:	b8 e8 12 00 00       	mov    $0x12e8,%eax
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 e8 12 00 00 e8 	movl   $0x12e8,0x12e8
+ 926:	12 00 00 
+    base.s.size = 0;
+ 929:	c7 05 ec 12 00 00 00 	movl   $0x0,0x12ec
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 54 ff ff ff       	jmp    88c <malloc+0x2c>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 08                	mov    (%eax),%ecx
+ 942:	89 0a                	mov    %ecx,(%edx)
+ 944:	eb b9                	jmp    8ff <malloc+0x9f>
+ 946:	66 90                	xchg   %ax,%ax
+ 948:	66 90                	xchg   %ax,%ax
+ 94a:	66 90                	xchg   %ax,%ax
+ 94c:	66 90                	xchg   %ax,%ax
+ 94e:	66 90                	xchg   %ax,%ax
+
+00000950 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 20             	sub    $0x20,%esp
+ 959:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 95c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 95f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 962:	68 e8 03 00 00       	push   $0x3e8
+ 967:	57                   	push   %edi
+ 968:	56                   	push   %esi
+ 969:	e8 e2 f9 ff ff       	call   350 <udiv64>
+ 96e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 970:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 973:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 979:	29 c1                	sub    %eax,%ecx
+ 97b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 97e:	68 e8 03 00 00       	push   $0x3e8
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	e8 c6 f9 ff ff       	call   350 <udiv64>
+ 98a:	83 c4 0c             	add    $0xc,%esp
+ 98d:	50                   	push   %eax
+ 98e:	68 f9 0c 00 00       	push   $0xcf9
+ 993:	53                   	push   %ebx
+ 994:	e8 87 fc ff ff       	call   620 <printf>
+  if(frac < 100)
+ 999:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 99c:	83 c4 10             	add    $0x10,%esp
+ 99f:	83 f9 63             	cmp    $0x63,%ecx
+ 9a2:	76 1c                	jbe    9c0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 9a4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 9a7:	c7 45 0c ff 0c 00 00 	movl   $0xcff,0xc(%ebp)
+ 9ae:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 9b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9b4:	5b                   	pop    %ebx
+ 9b5:	5e                   	pop    %esi
+ 9b6:	5f                   	pop    %edi
+ 9b7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 9b8:	e9 63 fc ff ff       	jmp    620 <printf>
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 9c0:	83 ec 08             	sub    $0x8,%esp
+ 9c3:	68 fd 0c 00 00       	push   $0xcfd
+ 9c8:	53                   	push   %ebx
+ 9c9:	e8 52 fc ff ff       	call   620 <printf>
+  if(frac < 10)
+ 9ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9d1:	83 c4 10             	add    $0x10,%esp
+ 9d4:	83 f9 09             	cmp    $0x9,%ecx
+ 9d7:	77 cb                	ja     9a4 <printps+0x54>
+    printf(fd, "0");
+ 9d9:	83 ec 08             	sub    $0x8,%esp
+ 9dc:	68 fd 0c 00 00       	push   $0xcfd
+ 9e1:	53                   	push   %ebx
+ 9e2:	e8 39 fc ff ff       	call   620 <printf>
+ 9e7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9ea:	83 c4 10             	add    $0x10,%esp
+ 9ed:	eb b5                	jmp    9a4 <printps+0x54>
+ 9ef:	90                   	nop
+
+000009f0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 9fc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 9ff:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a02:	83 e8 01             	sub    $0x1,%eax
+ a05:	3d ff 00 00 00       	cmp    $0xff,%eax
+ a0a:	0f 87 37 02 00 00    	ja     c47 <bench+0x257>
+ a10:	8b 7d 14             	mov    0x14(%ebp),%edi
+ a13:	85 ff                	test   %edi,%edi
+ a15:	0f 84 2c 02 00 00    	je     c47 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ a1b:	83 ec 0c             	sub    $0xc,%esp
+ a1e:	ff 75 10             	push   0x10(%ebp)
+ a21:	ff 55 0c             	call   *0xc(%ebp)
+ a24:	5b                   	pop    %ebx
+ a25:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ a28:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ a2a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ a2d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ a30:	83 c4 10             	add    $0x10,%esp
+ a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a37:	90                   	nop
+    t0 = cycles();
+ a38:	e8 33 f9 ff ff       	call   370 <cycles>
+    fn(arg);
+ a3d:	83 ec 0c             	sub    $0xc,%esp
+ a40:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ a43:	89 c6                	mov    %eax,%esi
+ a45:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ a47:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ a4a:	e8 21 f9 ff ff       	call   370 <cycles>
+ a4f:	29 f0                	sub    %esi,%eax
+ a51:	19 fa                	sbb    %edi,%edx
+ a53:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a5a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ a5d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a64:	83 c3 01             	add    $0x1,%ebx
+ a67:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ a6a:	7f cc                	jg     a38 <bench+0x48>
+  for(i = 1; i < n; i++){
+ a6c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ a70:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ a73:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ a79:	bf 01 00 00 00       	mov    $0x1,%edi
+ a7e:	74 77                	je     af7 <bench+0x107>
+ a80:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+    v = a[i];
+ a88:	8b 01                	mov    (%ecx),%eax
+ a8a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a8d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ a93:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ a99:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ a9f:	89 c8                	mov    %ecx,%eax
+ aa1:	eb 1b                	jmp    abe <bench+0xce>
+ aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa7:	90                   	nop
+      a[j] = a[j-1];
+ aa8:	89 08                	mov    %ecx,(%eax)
+ aaa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ aad:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ ab0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ ab6:	39 c3                	cmp    %eax,%ebx
+ ab8:	0f 84 72 01 00 00    	je     c30 <bench+0x240>
+ abe:	8b 50 fc             	mov    -0x4(%eax),%edx
+ ac1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ ac4:	89 f7                	mov    %esi,%edi
+ ac6:	89 c3                	mov    %eax,%ebx
+ ac8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ ace:	19 d7                	sbb    %edx,%edi
+ ad0:	72 d6                	jb     aa8 <bench+0xb8>
+ ad2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ad8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ ade:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ ae4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ ae7:	83 c7 01             	add    $0x1,%edi
+ aea:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ aed:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ aef:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ af2:	75 94                	jne    a88 <bench+0x98>
+ af4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ af7:	83 ec 08             	sub    $0x8,%esp
+ afa:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ b00:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ b05:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ b0b:	e8 70 f8 ff ff       	call   380 <cyc2ns>
+ b10:	83 c4 0c             	add    $0xc,%esp
+ b13:	ff 75 14             	push   0x14(%ebp)
+ b16:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b1c:	f7 e3                	mul    %ebx
+ b1e:	01 ca                	add    %ecx,%edx
+ b20:	52                   	push   %edx
+ b21:	50                   	push   %eax
+ b22:	e8 29 f8 ff ff       	call   350 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ b27:	89 06                	mov    %eax,(%esi)
+ b29:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b2c:	5f                   	pop    %edi
+ b2d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ b2e:	8b 45 18             	mov    0x18(%ebp),%eax
+ b31:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b33:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ b3a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ b41:	e8 3a f8 ff ff       	call   380 <cyc2ns>
+ b46:	83 c4 0c             	add    $0xc,%esp
+ b49:	ff 75 14             	push   0x14(%ebp)
+ b4c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b52:	f7 e3                	mul    %ebx
+ b54:	01 ca                	add    %ecx,%edx
+ b56:	52                   	push   %edx
+ b57:	50                   	push   %eax
+ b58:	e8 f3 f7 ff ff       	call   350 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ b5d:	89 46 08             	mov    %eax,0x8(%esi)
+ b60:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b63:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b64:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b67:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b68:	8d 50 01             	lea    0x1(%eax),%edx
+ b6b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ b70:	6b d2 63             	imul   $0x63,%edx,%edx
+ b73:	f7 e2                	mul    %edx
+ b75:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b78:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ b7f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ b86:	e8 f5 f7 ff ff       	call   380 <cyc2ns>
+ b8b:	83 c4 0c             	add    $0xc,%esp
+ b8e:	ff 75 14             	push   0x14(%ebp)
+ b91:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b97:	f7 e3                	mul    %ebx
+ b99:	01 ca                	add    %ecx,%edx
+ b9b:	52                   	push   %edx
+ b9c:	50                   	push   %eax
+ b9d:	e8 ae f7 ff ff       	call   350 <udiv64>
+
+  if(name){
+ ba2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ ba5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ba8:	89 46 10             	mov    %eax,0x10(%esi)
+ bab:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ bae:	85 c9                	test   %ecx,%ecx
+ bb0:	74 72                	je     c24 <bench+0x234>
+    printf(1, "%s: min ", name);
+ bb2:	83 ec 04             	sub    $0x4,%esp
+ bb5:	ff 75 08             	push   0x8(%ebp)
+ bb8:	68 02 0d 00 00       	push   $0xd02
+ bbd:	6a 01                	push   $0x1
+ bbf:	e8 5c fa ff ff       	call   620 <printf>
+    printps(1, st->min);
+ bc4:	83 c4 0c             	add    $0xc,%esp
+ bc7:	ff 76 04             	push   0x4(%esi)
+ bca:	ff 36                	push   (%esi)
+ bcc:	6a 01                	push   $0x1
+ bce:	e8 7d fd ff ff       	call   950 <printps>
+    printf(1, " median ");
+ bd3:	58                   	pop    %eax
+ bd4:	5a                   	pop    %edx
+ bd5:	68 0b 0d 00 00       	push   $0xd0b
+ bda:	6a 01                	push   $0x1
+ bdc:	e8 3f fa ff ff       	call   620 <printf>
+    printps(1, st->median);
+ be1:	83 c4 0c             	add    $0xc,%esp
+ be4:	ff 76 0c             	push   0xc(%esi)
+ be7:	ff 76 08             	push   0x8(%esi)
+ bea:	6a 01                	push   $0x1
+ bec:	e8 5f fd ff ff       	call   950 <printps>
+    printf(1, " p99 ");
+ bf1:	59                   	pop    %ecx
+ bf2:	5b                   	pop    %ebx
+ bf3:	68 14 0d 00 00       	push   $0xd14
+ bf8:	6a 01                	push   $0x1
+ bfa:	e8 21 fa ff ff       	call   620 <printf>
+    printps(1, st->p99);
+ bff:	83 c4 0c             	add    $0xc,%esp
+ c02:	ff 76 14             	push   0x14(%esi)
+ c05:	ff 76 10             	push   0x10(%esi)
+ c08:	6a 01                	push   $0x1
+ c0a:	e8 41 fd ff ff       	call   950 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ c0f:	83 c4 0c             	add    $0xc,%esp
+ c12:	ff 75 18             	push   0x18(%ebp)
+ c15:	68 1a 0d 00 00       	push   $0xd1a
+ c1a:	6a 01                	push   $0x1
+ c1c:	e8 ff f9 ff ff       	call   620 <printf>
+ c21:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ c24:	31 c0                	xor    %eax,%eax
+}
+ c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c29:	5b                   	pop    %ebx
+ c2a:	5e                   	pop    %esi
+ c2b:	5f                   	pop    %edi
+ c2c:	5d                   	pop    %ebp
+ c2d:	c3                   	ret
+ c2e:	66 90                	xchg   %ax,%ax
+ c30:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c36:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ c3c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c42:	e9 97 fe ff ff       	jmp    ade <bench+0xee>
+    return -1;
+ c47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c4c:	eb d8                	jmp    c26 <bench+0x236>
@@ -1,18 +1,30 @@
 struct buf;
 struct context;
 struct file;
+struct image;
 struct inode;
+struct kbresult;
+struct lockclass;
+struct lockstat;
+struct diskstat;
 struct pipe;
 struct proc;
+struct profsample;
 struct rtcdate;
+struct rwlock;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceev;
+struct trapframe;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breada(uint, uint);
+void            bdone(struct buf*);
+void            bwritev(struct buf**, int);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
 
@@ -24,6 +36,9 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+int             spawn(char*, char**, struct file**);
+int             pagefault(uint, int);
+int             pagein(uint, uint, int);
 
 // file.c
 struct file*    filealloc(void);
@@ -53,10 +68,17 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+int             idestatread(struct diskstat*, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -71,6 +93,11 @@ void            kinit2(void*, void*);
 char*           kalloc_huge(void);
 int             kfree_huge(char *va);
 int             kfreespace(void);
+char*           kzalloc(void);
+void            kzerod(void*);
+
+// kbench.c
+int             kbench(int, struct kbresult*, int);
 
 // kbd.c
 void            kbdintr(void);
@@ -81,6 +108,7 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -106,24 +134,42 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(uint, uint, uint);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+uint            getaffinity(int);
+int             getpriority(int);
 int             growproc(int);
+int             join(int);
 int             kill(int);
+int             kthread_create(void (*)(void*), void*, char*);
+void            lockvm(struct proc*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             setpriority(int, int);
 void            setproc(struct proc*);
+int             spawnproc(struct image*, char*, struct file**);
+pde_t*          swappgdir(pde_t*);
 void            sleep(void*, struct spinlock*);
+void            unlockvm(struct proc*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+int             wakeupn(void*, int);
 void            yield(void);
 
+// profile.c
+void            profinit(void);
+void            profsample(struct trapframe*);
+uint            setprofperiod(uint);
+int             profread(struct profsample*, int);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -132,9 +178,19 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            initlockkind(struct spinlock*, char*, int);
+void            initrwlock(struct rwlock*, char*);
+void            acquireread(struct rwlock*);
+void            releaseread(struct rwlock*);
+void            acquirewrite(struct rwlock*);
+void            releasewrite(struct rwlock*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+struct lockclass* findlockclass(char*, int);
+void            lockcount(struct lockclass*, int, int, uint64);
+int             lockstatread(struct lockstat*, int);
+void            lockstatreset(void);
 
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
@@ -150,15 +206,31 @@ char*           safestrcpy(char*, const char*, int);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
+void            sseinit(void);
+void            fpuinit(char*);
+void            fpusave(char*);
+void            fpurestore(char*);
+void            pgzero(void*, uint);
+void            pgzero_nt(void*, uint);
+void            pgcopy(void*, const void*, uint);
 
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argrdptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
 
+// text.c
+void            textinit(void);
+char*           textget(struct inode*, uint);
+int             textadd(struct inode*, uint, char*);
+void            textdup(char*);
+void            textput(char*);
+void            textforget(struct inode*);
+
 // timer.c
 void            timerinit(void);
 
@@ -168,6 +240,16 @@ extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
+// trace.c
+void            traceinit(void);
+void            trace(uint, uint);
+uint            settracemask(uint);
+int             traceread(struct traceev*, int);
+
+// tsc.c
+extern uint     tsckhz;
+void            tscinit(void);
+
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
@@ -178,6 +260,9 @@ void            seginit(void);
 void            kvmalloc(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
+int             mapuserpage(pde_t*, uint, char*, int);
+int             cowpage(pde_t*, uint);
+int             unshareuvm(pde_t*, uint);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
@@ -0,0 +1,1882 @@
+
+_diskstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return udiv64(sum * scale, (uint)n);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct diskstat ds[NDISK];
+  int i, n;
+
+  if((n = diskstat(ds, NDISK)) < 0){
+   f:	8d 75 90             	lea    -0x70(%ebp),%esi
+{
+  12:	53                   	push   %ebx
+  13:	51                   	push   %ecx
+  14:	83 c4 80             	add    $0xffffff80,%esp
+  if((n = diskstat(ds, NDISK)) < 0){
+  17:	6a 02                	push   $0x2
+  19:	56                   	push   %esi
+  1a:	e8 a1 05 00 00       	call   5c0 <diskstat>
+  1f:	83 c4 10             	add    $0x10,%esp
+  22:	85 c0                	test   %eax,%eax
+  24:	0f 88 15 01 00 00    	js     13f <main+0x13f>
+  2a:	89 c7                	mov    %eax,%edi
+    printf(2, "diskstat: failed\n");
+    exit();
+  }
+  printf(1, "disk\trequest\txfer\tblk/xfer\tqavg*100\tqmax\twait(us)\tmax(us)\n");
+  2c:	50                   	push   %eax
+  2d:	50                   	push   %eax
+  2e:	68 d0 0c 00 00       	push   $0xcd0
+  33:	6a 01                	push   $0x1
+  35:	e8 36 06 00 00       	call   670 <printf>
+  for(i = 0; i < n; i++){
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	85 ff                	test   %edi,%edi
+  3f:	0f 84 f5 00 00 00    	je     13a <main+0x13a>
+  return udiv64(sum * scale, (uint)n);
+  45:	89 bd 78 ff ff ff    	mov    %edi,-0x88(%ebp)
+  for(i = 0; i < n; i++){
+  4b:	31 db                	xor    %ebx,%ebx
+           (uint)ds[i].nreq, (uint)ds[i].nxfer,
+           avg(ds[i].nreq, ds[i].nxfer, 100),
+           avg(ds[i].qsum, ds[i].nreq, 100),
+           ds[i].qmax,
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+           (uint)udiv64(cyc2ns(ds[i].waitmax), 1000));
+  4d:	83 ec 08             	sub    $0x8,%esp
+  50:	ff 76 28             	push   0x28(%esi)
+  53:	ff 76 24             	push   0x24(%esi)
+  56:	e8 75 03 00 00       	call   3d0 <cyc2ns>
+  5b:	83 c4 0c             	add    $0xc,%esp
+  5e:	68 e8 03 00 00       	push   $0x3e8
+  63:	52                   	push   %edx
+  64:	50                   	push   %eax
+  65:	e8 36 03 00 00       	call   3a0 <udiv64>
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+  6a:	8b 0e                	mov    (%esi),%ecx
+  6c:	8b 56 04             	mov    0x4(%esi),%edx
+  if(n == 0)
+  6f:	83 c4 10             	add    $0x10,%esp
+           (uint)udiv64(cyc2ns(ds[i].waitmax), 1000));
+  72:	89 45 84             	mov    %eax,-0x7c(%ebp)
+    return 0;
+  75:	31 c0                	xor    %eax,%eax
+  if(n == 0)
+  77:	09 ca                	or     %ecx,%edx
+  79:	74 10                	je     8b <main+0x8b>
+  return udiv64(sum * scale, (uint)n);
+  7b:	57                   	push   %edi
+  7c:	51                   	push   %ecx
+  7d:	ff 76 20             	push   0x20(%esi)
+  80:	ff 76 1c             	push   0x1c(%esi)
+  83:	e8 18 03 00 00       	call   3a0 <udiv64>
+  88:	83 c4 10             	add    $0x10,%esp
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+  8b:	83 ec 08             	sub    $0x8,%esp
+  8e:	31 d2                	xor    %edx,%edx
+    return 0;
+  90:	31 ff                	xor    %edi,%edi
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+  92:	52                   	push   %edx
+  93:	50                   	push   %eax
+  94:	e8 37 03 00 00       	call   3d0 <cyc2ns>
+  99:	83 c4 0c             	add    $0xc,%esp
+  9c:	68 e8 03 00 00       	push   $0x3e8
+  a1:	52                   	push   %edx
+  a2:	50                   	push   %eax
+  a3:	e8 f8 02 00 00       	call   3a0 <udiv64>
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+  a8:	8b 16                	mov    (%esi),%edx
+  if(n == 0)
+  aa:	83 c4 10             	add    $0x10,%esp
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+  ad:	89 45 80             	mov    %eax,-0x80(%ebp)
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+  b0:	8b 46 18             	mov    0x18(%esi),%eax
+  b3:	89 85 7c ff ff ff    	mov    %eax,-0x84(%ebp)
+  b9:	8b 46 04             	mov    0x4(%esi),%eax
+  if(n == 0)
+  bc:	09 d0                	or     %edx,%eax
+  be:	74 1c                	je     dc <main+0xdc>
+  return udiv64(sum * scale, (uint)n);
+  c0:	b8 64 00 00 00       	mov    $0x64,%eax
+  c5:	51                   	push   %ecx
+  c6:	52                   	push   %edx
+  c7:	6b 4e 14 64          	imul   $0x64,0x14(%esi),%ecx
+  cb:	f7 66 10             	mull   0x10(%esi)
+  ce:	01 ca                	add    %ecx,%edx
+  d0:	52                   	push   %edx
+  d1:	50                   	push   %eax
+  d2:	e8 c9 02 00 00       	call   3a0 <udiv64>
+  d7:	83 c4 10             	add    $0x10,%esp
+  da:	89 c7                	mov    %eax,%edi
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+  dc:	8b 4e 08             	mov    0x8(%esi),%ecx
+  df:	8b 56 0c             	mov    0xc(%esi),%edx
+    return 0;
+  e2:	31 c0                	xor    %eax,%eax
+  if(n == 0)
+  e4:	09 ca                	or     %ecx,%edx
+  e6:	74 19                	je     101 <main+0x101>
+  return udiv64(sum * scale, (uint)n);
+  e8:	50                   	push   %eax
+  e9:	b8 64 00 00 00       	mov    $0x64,%eax
+  ee:	51                   	push   %ecx
+  ef:	6b 4e 04 64          	imul   $0x64,0x4(%esi),%ecx
+  f3:	f7 26                	mull   (%esi)
+  f5:	01 ca                	add    %ecx,%edx
+  f7:	52                   	push   %edx
+  f8:	50                   	push   %eax
+  f9:	e8 a2 02 00 00       	call   3a0 <udiv64>
+  fe:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+ 101:	83 ec 08             	sub    $0x8,%esp
+ 104:	ff 75 84             	push   -0x7c(%ebp)
+  for(i = 0; i < n; i++){
+ 107:	83 c6 2c             	add    $0x2c,%esi
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+ 10a:	ff 75 80             	push   -0x80(%ebp)
+ 10d:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+ 113:	57                   	push   %edi
+ 114:	50                   	push   %eax
+ 115:	ff 76 dc             	push   -0x24(%esi)
+ 118:	ff 76 d4             	push   -0x2c(%esi)
+ 11b:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 11c:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+ 11f:	68 b2 0c 00 00       	push   $0xcb2
+ 124:	6a 01                	push   $0x1
+ 126:	e8 45 05 00 00       	call   670 <printf>
+  for(i = 0; i < n; i++){
+ 12b:	83 c4 30             	add    $0x30,%esp
+ 12e:	39 9d 78 ff ff ff    	cmp    %ebx,-0x88(%ebp)
+ 134:	0f 85 13 ff ff ff    	jne    4d <main+0x4d>
+  }
+  exit();
+ 13a:	e8 29 03 00 00       	call   468 <exit>
+    printf(2, "diskstat: failed\n");
+ 13f:	50                   	push   %eax
+ 140:	50                   	push   %eax
+ 141:	68 a0 0c 00 00       	push   $0xca0
+ 146:	6a 02                	push   $0x2
+ 148:	e8 23 05 00 00       	call   670 <printf>
+    exit();
+ 14d:	e8 16 03 00 00       	call   468 <exit>
+ 152:	66 90                	xchg   %ax,%ax
+ 154:	66 90                	xchg   %ax,%ax
+ 156:	66 90                	xchg   %ax,%ax
+ 158:	66 90                	xchg   %ax,%ax
+ 15a:	66 90                	xchg   %ax,%ax
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 160:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 161:	31 c0                	xor    %eax,%eax
+{
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	53                   	push   %ebx
+ 166:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 169:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 170:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 174:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 177:	83 c0 01             	add    $0x1,%eax
+ 17a:	84 d2                	test   %dl,%dl
+ 17c:	75 f2                	jne    170 <strcpy+0x10>
+    ;
+  return os;
+}
+ 17e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 181:	89 c8                	mov    %ecx,%eax
+ 183:	c9                   	leave
+ 184:	c3                   	ret
+ 185:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	53                   	push   %ebx
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+ 197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 19a:	0f b6 02             	movzbl (%edx),%eax
+ 19d:	84 c0                	test   %al,%al
+ 19f:	75 17                	jne    1b8 <strcmp+0x28>
+ 1a1:	eb 3a                	jmp    1dd <strcmp+0x4d>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ac:	83 c2 01             	add    $0x1,%edx
+ 1af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1b2:	84 c0                	test   %al,%al
+ 1b4:	74 1a                	je     1d0 <strcmp+0x40>
+    p++, q++;
+ 1b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1bb:	38 c3                	cmp    %al,%bl
+ 1bd:	74 e9                	je     1a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1bf:	29 d8                	sub    %ebx,%eax
+}
+ 1c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c4:	c9                   	leave
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1d4:	31 c0                	xor    %eax,%eax
+ 1d6:	29 d8                	sub    %ebx,%eax
+}
+ 1d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1e0:	31 c0                	xor    %eax,%eax
+ 1e2:	eb db                	jmp    1bf <strcmp+0x2f>
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1f9:	74 15                	je     210 <strlen+0x20>
+ 1fb:	31 c0                	xor    %eax,%eax
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 200:	83 c0 01             	add    $0x1,%eax
+ 203:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 207:	89 c1                	mov    %eax,%ecx
+ 209:	75 f5                	jne    200 <strlen+0x10>
+    ;
+  return n;
+}
+ 20b:	89 c8                	mov    %ecx,%eax
+ 20d:	5d                   	pop    %ebp
+ 20e:	c3                   	ret
+ 20f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 210:	31 c9                	xor    %ecx,%ecx
+}
+ 212:	5d                   	pop    %ebp
+ 213:	89 c8                	mov    %ecx,%eax
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 227:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	89 d7                	mov    %edx,%edi
+ 22f:	fc                   	cld
+ 230:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 232:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 235:	89 d0                	mov    %edx,%eax
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 24a:	0f b6 10             	movzbl (%eax),%edx
+ 24d:	84 d2                	test   %dl,%dl
+ 24f:	75 12                	jne    263 <strchr+0x23>
+ 251:	eb 1d                	jmp    270 <strchr+0x30>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 25c:	83 c0 01             	add    $0x1,%eax
+ 25f:	84 d2                	test   %dl,%dl
+ 261:	74 0d                	je     270 <strchr+0x30>
+    if(*s == c)
+ 263:	38 d1                	cmp    %dl,%cl
+ 265:	75 f1                	jne    258 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 267:	5d                   	pop    %ebp
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 270:	31 c0                	xor    %eax,%eax
+}
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 285:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 288:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 289:	31 db                	xor    %ebx,%ebx
+{
+ 28b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 28e:	eb 27                	jmp    2b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	6a 01                	push   $0x1
+ 295:	56                   	push   %esi
+ 296:	6a 00                	push   $0x0
+ 298:	e8 e3 01 00 00       	call   480 <read>
+    if(cc < 1)
+ 29d:	83 c4 10             	add    $0x10,%esp
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	7e 1d                	jle    2c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2af:	3c 0a                	cmp    $0xa,%al
+ 2b1:	74 10                	je     2c3 <gets+0x43>
+ 2b3:	3c 0d                	cmp    $0xd,%al
+ 2b5:	74 0c                	je     2c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2b7:	89 df                	mov    %ebx,%edi
+ 2b9:	83 c3 01             	add    $0x1,%ebx
+ 2bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2bf:	7c cf                	jl     290 <gets+0x10>
+ 2c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2cd:	5b                   	pop    %ebx
+ 2ce:	5e                   	pop    %esi
+ 2cf:	5f                   	pop    %edi
+ 2d0:	5d                   	pop    %ebp
+ 2d1:	c3                   	ret
+ 2d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2e5:	83 ec 08             	sub    $0x8,%esp
+ 2e8:	6a 00                	push   $0x0
+ 2ea:	ff 75 08             	push   0x8(%ebp)
+ 2ed:	e8 b6 01 00 00       	call   4a8 <open>
+  if(fd < 0)
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	78 27                	js     320 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2f9:	83 ec 08             	sub    $0x8,%esp
+ 2fc:	ff 75 0c             	push   0xc(%ebp)
+ 2ff:	89 c3                	mov    %eax,%ebx
+ 301:	50                   	push   %eax
+ 302:	e8 b9 01 00 00       	call   4c0 <fstat>
+  close(fd);
+ 307:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 30a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 30c:	e8 7f 01 00 00       	call   490 <close>
+  return r;
+ 311:	83 c4 10             	add    $0x10,%esp
+}
+ 314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 317:	89 f0                	mov    %esi,%eax
+ 319:	5b                   	pop    %ebx
+ 31a:	5e                   	pop    %esi
+ 31b:	5d                   	pop    %ebp
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 325:	eb ed                	jmp    314 <stat+0x34>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 337:	0f be 02             	movsbl (%edx),%eax
+ 33a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 33d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 345:	77 1e                	ja     365 <atoi+0x35>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 350:	83 c2 01             	add    $0x1,%edx
+ 353:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 356:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 35a:	0f be 02             	movsbl (%edx),%eax
+ 35d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 360:	80 fb 09             	cmp    $0x9,%bl
+ 363:	76 eb                	jbe    350 <atoi+0x20>
+  return n;
+}
+ 365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 368:	89 c8                	mov    %ecx,%eax
+ 36a:	c9                   	leave
+ 36b:	c3                   	ret
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	8b 45 10             	mov    0x10(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 37e:	85 c0                	test   %eax,%eax
+ 380:	7e 13                	jle    395 <memmove+0x25>
+ 382:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 384:	89 d7                	mov    %edx,%edi
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 390:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 391:	39 f8                	cmp    %edi,%eax
+ 393:	75 fb                	jne    390 <memmove+0x20>
+  return vdst;
+}
+ 395:	5e                   	pop    %esi
+ 396:	89 d0                	mov    %edx,%eax
+ 398:	5f                   	pop    %edi
+ 399:	5d                   	pop    %ebp
+ 39a:	c3                   	ret
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	31 d2                	xor    %edx,%edx
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 3a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 3ac:	f7 f3                	div    %ebx
+ 3ae:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 3b8:	89 ca                	mov    %ecx,%edx
+}
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 3c0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 3c2:	c3                   	ret
+ 3c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003d0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 3d9:	8b 35 34 11 00 00    	mov    0x1134,%esi
+{
+ 3df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 3e5:	85 f6                	test   %esi,%esi
+ 3e7:	74 2f                	je     418 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 3e9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3ee:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 3f4:	f7 e3                	mul    %ebx
+ 3f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 3f9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 3fc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 3ff:	31 d2                	xor    %edx,%edx
+ 401:	f7 f6                	div    %esi
+ 403:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 405:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 408:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 40b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 40d:	89 da                	mov    %ebx,%edx
+}
+ 40f:	5b                   	pop    %ebx
+ 410:	5e                   	pop    %esi
+ 411:	5f                   	pop    %edi
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 418:	e8 0b 01 00 00       	call   528 <tscfreq>
+ 41d:	a3 34 11 00 00       	mov    %eax,0x1134
+ 422:	89 c6                	mov    %eax,%esi
+ 424:	eb c3                	jmp    3e9 <cyc2ns+0x19>
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	83 ec 10             	sub    $0x10,%esp
+ 437:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 43a:	6a 00                	push   $0x0
+ 43c:	e8 3f 01 00 00       	call   580 <getpriority>
+ 441:	5a                   	pop    %edx
+ 442:	59                   	pop    %ecx
+ 443:	01 d8                	add    %ebx,%eax
+ 445:	50                   	push   %eax
+ 446:	6a 00                	push   $0x0
+ 448:	e8 2b 01 00 00       	call   578 <setpriority>
+  return getpriority(0);
+ 44d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 454:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 457:	83 c4 10             	add    $0x10,%esp
+}
+ 45a:	c9                   	leave
+  return getpriority(0);
+ 45b:	e9 20 01 00 00       	jmp    580 <getpriority>
+
+00000460 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 460:	b8 01 00 00 00       	mov    $0x1,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <exit>:
+SYSCALL(exit)
+ 468:	b8 02 00 00 00       	mov    $0x2,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <wait>:
+SYSCALL(wait)
+ 470:	b8 03 00 00 00       	mov    $0x3,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <pipe>:
+SYSCALL(pipe)
+ 478:	b8 04 00 00 00       	mov    $0x4,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <read>:
+SYSCALL(read)
+ 480:	b8 05 00 00 00       	mov    $0x5,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <write>:
+SYSCALL(write)
+ 488:	b8 10 00 00 00       	mov    $0x10,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <close>:
+SYSCALL(close)
+ 490:	b8 15 00 00 00       	mov    $0x15,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <kill>:
+SYSCALL(kill)
+ 498:	b8 06 00 00 00       	mov    $0x6,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <exec>:
+SYSCALL(exec)
+ 4a0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <open>:
+SYSCALL(open)
+ 4a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <mknod>:
+SYSCALL(mknod)
+ 4b0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <unlink>:
+SYSCALL(unlink)
+ 4b8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <fstat>:
+SYSCALL(fstat)
+ 4c0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <link>:
+SYSCALL(link)
+ 4c8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <mkdir>:
+SYSCALL(mkdir)
+ 4d0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <chdir>:
+SYSCALL(chdir)
+ 4d8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <dup>:
+SYSCALL(dup)
+ 4e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <getpid>:
+SYSCALL(getpid)
+ 4e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <sbrk>:
+SYSCALL(sbrk)
+ 4f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <sleep>:
+SYSCALL(sleep)
+ 4f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <uptime>:
+SYSCALL(uptime)
+ 500:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <promote>:
+
+SYSCALL(promote)
+ 508:	b8 18 00 00 00       	mov    $0x18,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <demote>:
+SYSCALL(demote)
+ 510:	b8 19 00 00 00       	mov    $0x19,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 518:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 520:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <tscfreq>:
+SYSCALL(tscfreq)
+ 528:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <tracemask>:
+SYSCALL(tracemask)
+ 530:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <traceread>:
+SYSCALL(traceread)
+ 538:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <profile>:
+SYSCALL(profile)
+ 540:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <profread>:
+SYSCALL(profread)
+ 548:	b8 20 00 00 00       	mov    $0x20,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <lockstat>:
+SYSCALL(lockstat)
+ 550:	b8 21 00 00 00       	mov    $0x21,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 558:	b8 22 00 00 00       	mov    $0x22,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <sysstat>:
+SYSCALL(sysstat)
+ 560:	b8 23 00 00 00       	mov    $0x23,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <kbench>:
+SYSCALL(kbench)
+ 568:	b8 24 00 00 00       	mov    $0x24,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <yield>:
+SYSCALL(yield)
+ 570:	b8 25 00 00 00       	mov    $0x25,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <setpriority>:
+SYSCALL(setpriority)
+ 578:	b8 26 00 00 00       	mov    $0x26,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <getpriority>:
+SYSCALL(getpriority)
+ 580:	b8 27 00 00 00       	mov    $0x27,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 588:	b8 28 00 00 00       	mov    $0x28,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 590:	b8 29 00 00 00       	mov    $0x29,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <clone>:
+SYSCALL(clone)
+ 598:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <join>:
+SYSCALL(join)
+ 5a0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <futex_wait>:
+SYSCALL(futex_wait)
+ 5a8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <futex_wake>:
+SYSCALL(futex_wake)
+ 5b0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <spawn>:
+SYSCALL(spawn)
+ 5b8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <diskstat>:
+SYSCALL(diskstat)
+ 5c0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+ 5c8:	66 90                	xchg   %ax,%ax
+ 5ca:	66 90                	xchg   %ax,%ax
+ 5cc:	66 90                	xchg   %ax,%ax
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5d8:	89 d1                	mov    %edx,%ecx
+{
+ 5da:	83 ec 3c             	sub    $0x3c,%esp
+ 5dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	85 d2                	test   %edx,%edx
+ 5e2:	0f 89 80 00 00 00    	jns    668 <printint+0x98>
+ 5e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ec:	74 7a                	je     668 <printint+0x98>
+    x = -xx;
+ 5ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5f8:	31 f6                	xor    %esi,%esi
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+ 604:	89 f7                	mov    %esi,%edi
+ 606:	f7 f3                	div    %ebx
+ 608:	8d 76 01             	lea    0x1(%esi),%esi
+ 60b:	0f b6 92 6c 0d 00 00 	movzbl 0xd6c(%edx),%edx
+ 612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 616:	89 ca                	mov    %ecx,%edx
+ 618:	89 c1                	mov    %eax,%ecx
+ 61a:	39 da                	cmp    %ebx,%edx
+ 61c:	73 e2                	jae    600 <printint+0x30>
+  if(neg)
+ 61e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 621:	85 c0                	test   %eax,%eax
+ 623:	74 07                	je     62c <printint+0x5c>
+    buf[i++] = '-';
+ 625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 62a:	89 f7                	mov    %esi,%edi
+ 62c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 62f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 632:	01 df                	add    %ebx,%edi
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 644:	6a 01                	push   $0x1
+ 646:	50                   	push   %eax
+ 647:	56                   	push   %esi
+ 648:	e8 3b fe ff ff       	call   488 <write>
+  while(--i >= 0)
+ 64d:	89 f8                	mov    %edi,%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	83 ef 01             	sub    $0x1,%edi
+ 655:	39 d8                	cmp    %ebx,%eax
+ 657:	75 df                	jne    638 <printint+0x68>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 668:	31 c0                	xor    %eax,%eax
+ 66a:	eb 89                	jmp    5f5 <printint+0x25>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 67c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 67f:	0f b6 1e             	movzbl (%esi),%ebx
+ 682:	83 c6 01             	add    $0x1,%esi
+ 685:	84 db                	test   %bl,%bl
+ 687:	74 67                	je     6f0 <printf+0x80>
+ 689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 691:	eb 34                	jmp    6c7 <printf+0x57>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 69b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6a0:	83 f8 25             	cmp    $0x25,%eax
+ 6a3:	74 18                	je     6bd <printf+0x4d>
+  write(fd, &c, 1);
+ 6a5:	83 ec 04             	sub    $0x4,%esp
+ 6a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	50                   	push   %eax
+ 6b1:	57                   	push   %edi
+ 6b2:	e8 d1 fd ff ff       	call   488 <write>
+ 6b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c0:	83 c6 01             	add    $0x1,%esi
+ 6c3:	84 db                	test   %bl,%bl
+ 6c5:	74 29                	je     6f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ca:	85 d2                	test   %edx,%edx
+ 6cc:	74 ca                	je     698 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ce:	83 fa 25             	cmp    $0x25,%edx
+ 6d1:	75 ea                	jne    6bd <printf+0x4d>
+      if(c == 'd'){
+ 6d3:	83 f8 25             	cmp    $0x25,%eax
+ 6d6:	0f 84 24 01 00 00    	je     800 <printf+0x190>
+ 6dc:	83 e8 63             	sub    $0x63,%eax
+ 6df:	83 f8 15             	cmp    $0x15,%eax
+ 6e2:	77 1c                	ja     700 <printf+0x90>
+ 6e4:	ff 24 85 14 0d 00 00 	jmp    *0xd14(,%eax,4)
+ 6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 70a:	6a 01                	push   $0x1
+ 70c:	52                   	push   %edx
+ 70d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 710:	57                   	push   %edi
+ 711:	e8 72 fd ff ff       	call   488 <write>
+ 716:	83 c4 0c             	add    $0xc,%esp
+ 719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71c:	6a 01                	push   $0x1
+ 71e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 721:	52                   	push   %edx
+ 722:	57                   	push   %edi
+ 723:	e8 60 fd ff ff       	call   488 <write>
+        putc(fd, c);
+ 728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72b:	31 d2                	xor    %edx,%edx
+ 72d:	eb 8e                	jmp    6bd <printf+0x4d>
+ 72f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 00                	push   $0x0
+ 73f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 744:	e8 87 fe ff ff       	call   5d0 <printint>
+        ap++;
+ 749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 67 ff ff ff       	jmp    6bd <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 765:	83 c0 04             	add    $0x4,%eax
+ 768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 76b:	85 db                	test   %ebx,%ebx
+ 76d:	0f 84 9d 00 00 00    	je     810 <printf+0x1a0>
+        while(*s != 0){
+ 773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 778:	84 c0                	test   %al,%al
+ 77a:	0f 84 3d ff ff ff    	je     6bd <printf+0x4d>
+ 780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 786:	89 de                	mov    %ebx,%esi
+ 788:	89 d3                	mov    %edx,%ebx
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	53                   	push   %ebx
+ 79c:	57                   	push   %edi
+ 79d:	e8 e6 fc ff ff       	call   488 <write>
+        while(*s != 0){
+ 7a2:	0f b6 06             	movzbl (%esi),%eax
+ 7a5:	83 c4 10             	add    $0x10,%esp
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	75 e4                	jne    790 <printf+0x120>
+      state = 0;
+ 7ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 07 ff ff ff       	jmp    6bd <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 01                	push   $0x1
+ 7cf:	e9 6b ff ff ff       	jmp    73f <printf+0xcf>
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	52                   	push   %edx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 96 fc ff ff       	call   488 <write>
+        ap++;
+ 7f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f8:	31 d2                	xor    %edx,%edx
+ 7fa:	e9 be fe ff ff       	jmp    6bd <printf+0x4d>
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 809:	6a 01                	push   $0x1
+ 80b:	e9 11 ff ff ff       	jmp    721 <printf+0xb1>
+ 810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 815:	bb 0b 0d 00 00       	mov    $0xd0b,%ebx
+ 81a:	e9 61 ff ff ff       	jmp    780 <printf+0x110>
+ 81f:	90                   	nop
+
+00000820 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	a1 38 11 00 00       	mov    0x1138,%eax
+{
+ 826:	89 e5                	mov    %esp,%ebp
+ 828:	57                   	push   %edi
+ 829:	56                   	push   %esi
+ 82a:	53                   	push   %ebx
+ 82b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 82e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 838:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 83a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 83c:	39 ca                	cmp    %ecx,%edx
+ 83e:	73 30                	jae    870 <free+0x50>
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 04                	jb     848 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 844:	39 c2                	cmp    %eax,%edx
+ 846:	72 f0                	jb     838 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 848:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 84b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 84e:	39 f8                	cmp    %edi,%eax
+ 850:	74 2e                	je     880 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 852:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 855:	8b 42 04             	mov    0x4(%edx),%eax
+ 858:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 85b:	39 f1                	cmp    %esi,%ecx
+ 85d:	74 38                	je     897 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 85f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 861:	5b                   	pop    %ebx
+  freep = p;
+ 862:	89 15 38 11 00 00    	mov    %edx,0x1138
+}
+ 868:	5e                   	pop    %esi
+ 869:	5f                   	pop    %edi
+ 86a:	5d                   	pop    %ebp
+ 86b:	c3                   	ret
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 d0                	jb     844 <free+0x24>
+ 874:	eb c2                	jmp    838 <free+0x18>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 880:	03 70 04             	add    0x4(%eax),%esi
+ 883:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 886:	8b 02                	mov    (%edx),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 88d:	8b 42 04             	mov    0x4(%edx),%eax
+ 890:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 893:	39 f1                	cmp    %esi,%ecx
+ 895:	75 c8                	jne    85f <free+0x3f>
+    p->s.size += bp->s.size;
+ 897:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 89a:	89 15 38 11 00 00    	mov    %edx,0x1138
+    p->s.size += bp->s.size;
+ 8a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8a8:	5b                   	pop    %ebx
+ 8a9:	5e                   	pop    %esi
+ 8aa:	5f                   	pop    %edi
+ 8ab:	5d                   	pop    %ebp
+ 8ac:	c3                   	ret
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8bc:	8b 15 38 11 00 00    	mov    0x1138,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8c5:	c1 ef 03             	shr    $0x3,%edi
+ 8c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8cb:	85 d2                	test   %edx,%edx
+ 8cd:	0f 84 8d 00 00 00    	je     960 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d8:	39 f9                	cmp    %edi,%ecx
+ 8da:	73 64                	jae    940 <malloc+0x90>
+  if(nu < 4096)
+ 8dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8e1:	39 df                	cmp    %ebx,%edi
+ 8e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ed:	eb 0a                	jmp    8f9 <malloc+0x49>
+ 8ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f5:	39 f9                	cmp    %edi,%ecx
+ 8f7:	73 47                	jae    940 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8f9:	89 c2                	mov    %eax,%edx
+ 8fb:	39 05 38 11 00 00    	cmp    %eax,0x1138
+ 901:	75 ed                	jne    8f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	56                   	push   %esi
+ 907:	e8 e4 fb ff ff       	call   4f0 <sbrk>
+  if(p == (char*)-1)
+ 90c:	83 c4 10             	add    $0x10,%esp
+ 90f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 912:	74 1c                	je     930 <malloc+0x80>
+  hp->s.size = nu;
+ 914:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 917:	83 ec 0c             	sub    $0xc,%esp
+ 91a:	83 c0 08             	add    $0x8,%eax
+ 91d:	50                   	push   %eax
+ 91e:	e8 fd fe ff ff       	call   820 <free>
+  return freep;
+ 923:	8b 15 38 11 00 00    	mov    0x1138,%edx
+      if((p = morecore(nunits)) == 0)
+ 929:	83 c4 10             	add    $0x10,%esp
+ 92c:	85 d2                	test   %edx,%edx
+ 92e:	75 c0                	jne    8f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 933:	31 c0                	xor    %eax,%eax
+}
+ 935:	5b                   	pop    %ebx
+ 936:	5e                   	pop    %esi
+ 937:	5f                   	pop    %edi
+ 938:	5d                   	pop    %ebp
+ 939:	c3                   	ret
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 940:	39 cf                	cmp    %ecx,%edi
+ 942:	74 4c                	je     990 <malloc+0xe0>
+        p->s.size -= nunits;
+ 944:	29 f9                	sub    %edi,%ecx
+ 946:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 949:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 94c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 94f:	89 15 38 11 00 00    	mov    %edx,0x1138
+}
+ 955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 958:	83 c0 08             	add    $0x8,%eax
+}
+ 95b:	5b                   	pop    %ebx
+ 95c:	5e                   	pop    %esi
+ 95d:	5f                   	pop    %edi
+ 95e:	5d                   	pop    %ebp
+ 95f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 960:	c7 05 38 11 00 00 3c 	movl   $0x113c,0x1138
+ 967:	11 00 00 
+    base.s.size = 0;
+ 96a:	b8 3c 11 00 00       	mov    $0x113c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 96f:	c7 05 3c 11 00 00 3c 	movl   $0x113c,0x113c
+ 976:	11 00 00 
+    base.s.size = 0;
+ 979:	c7 05 40 11 00 00 00 	movl   $0x0,0x1140
+ 980:	00 00 00 
+    if(p->s.size >= nunits){
+ 983:	e9 54 ff ff ff       	jmp    8dc <malloc+0x2c>
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 990:	8b 08                	mov    (%eax),%ecx
+ 992:	89 0a                	mov    %ecx,(%edx)
+ 994:	eb b9                	jmp    94f <malloc+0x9f>
+ 996:	66 90                	xchg   %ax,%ax
+ 998:	66 90                	xchg   %ax,%ax
+ 99a:	66 90                	xchg   %ax,%ax
+ 99c:	66 90                	xchg   %ax,%ax
+ 99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 20             	sub    $0x20,%esp
+ 9a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 9ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 9af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 9b2:	68 e8 03 00 00       	push   $0x3e8
+ 9b7:	57                   	push   %edi
+ 9b8:	56                   	push   %esi
+ 9b9:	e8 e2 f9 ff ff       	call   3a0 <udiv64>
+ 9be:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9c0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 9c3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 9c9:	29 c1                	sub    %eax,%ecx
+ 9cb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9ce:	68 e8 03 00 00       	push   $0x3e8
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	e8 c6 f9 ff ff       	call   3a0 <udiv64>
+ 9da:	83 c4 0c             	add    $0xc,%esp
+ 9dd:	50                   	push   %eax
+ 9de:	68 7d 0d 00 00       	push   $0xd7d
+ 9e3:	53                   	push   %ebx
+ 9e4:	e8 87 fc ff ff       	call   670 <printf>
+  if(frac < 100)
+ 9e9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9ec:	83 c4 10             	add    $0x10,%esp
+ 9ef:	83 f9 63             	cmp    $0x63,%ecx
+ 9f2:	76 1c                	jbe    a10 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 9f4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 9f7:	c7 45 0c 83 0d 00 00 	movl   $0xd83,0xc(%ebp)
+ 9fe:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a04:	5b                   	pop    %ebx
+ a05:	5e                   	pop    %esi
+ a06:	5f                   	pop    %edi
+ a07:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ a08:	e9 63 fc ff ff       	jmp    670 <printf>
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ a10:	83 ec 08             	sub    $0x8,%esp
+ a13:	68 81 0d 00 00       	push   $0xd81
+ a18:	53                   	push   %ebx
+ a19:	e8 52 fc ff ff       	call   670 <printf>
+  if(frac < 10)
+ a1e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a21:	83 c4 10             	add    $0x10,%esp
+ a24:	83 f9 09             	cmp    $0x9,%ecx
+ a27:	77 cb                	ja     9f4 <printps+0x54>
+    printf(fd, "0");
+ a29:	83 ec 08             	sub    $0x8,%esp
+ a2c:	68 81 0d 00 00       	push   $0xd81
+ a31:	53                   	push   %ebx
+ a32:	e8 39 fc ff ff       	call   670 <printf>
+ a37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a3a:	83 c4 10             	add    $0x10,%esp
+ a3d:	eb b5                	jmp    9f4 <printps+0x54>
+ a3f:	90                   	nop
+
+00000a40 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a4c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ a4f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a52:	83 e8 01             	sub    $0x1,%eax
+ a55:	3d ff 00 00 00       	cmp    $0xff,%eax
+ a5a:	0f 87 37 02 00 00    	ja     c97 <bench+0x257>
+ a60:	8b 7d 14             	mov    0x14(%ebp),%edi
+ a63:	85 ff                	test   %edi,%edi
+ a65:	0f 84 2c 02 00 00    	je     c97 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ a6b:	83 ec 0c             	sub    $0xc,%esp
+ a6e:	ff 75 10             	push   0x10(%ebp)
+ a71:	ff 55 0c             	call   *0xc(%ebp)
+ a74:	5b                   	pop    %ebx
+ a75:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ a78:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ a7a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ a7d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ a80:	83 c4 10             	add    $0x10,%esp
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+    t0 = cycles();
+ a88:	e8 33 f9 ff ff       	call   3c0 <cycles>
+    fn(arg);
+ a8d:	83 ec 0c             	sub    $0xc,%esp
+ a90:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ a93:	89 c6                	mov    %eax,%esi
+ a95:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ a97:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ a9a:	e8 21 f9 ff ff       	call   3c0 <cycles>
+ a9f:	29 f0                	sub    %esi,%eax
+ aa1:	19 fa                	sbb    %edi,%edx
+ aa3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ aaa:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ aad:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ ab4:	83 c3 01             	add    $0x1,%ebx
+ ab7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ aba:	7f cc                	jg     a88 <bench+0x48>
+  for(i = 1; i < n; i++){
+ abc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ ac0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ ac3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ ac9:	bf 01 00 00 00       	mov    $0x1,%edi
+ ace:	74 77                	je     b47 <bench+0x107>
+ ad0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ ad3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ad7:	90                   	nop
+    v = a[i];
+ ad8:	8b 01                	mov    (%ecx),%eax
+ ada:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ add:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ ae3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ ae9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ aef:	89 c8                	mov    %ecx,%eax
+ af1:	eb 1b                	jmp    b0e <bench+0xce>
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+      a[j] = a[j-1];
+ af8:	89 08                	mov    %ecx,(%eax)
+ afa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ afd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ b00:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ b06:	39 c3                	cmp    %eax,%ebx
+ b08:	0f 84 72 01 00 00    	je     c80 <bench+0x240>
+ b0e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ b11:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ b14:	89 f7                	mov    %esi,%edi
+ b16:	89 c3                	mov    %eax,%ebx
+ b18:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ b1e:	19 d7                	sbb    %edx,%edi
+ b20:	72 d6                	jb     af8 <bench+0xb8>
+ b22:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b28:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ b2e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ b34:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ b37:	83 c7 01             	add    $0x1,%edi
+ b3a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ b3d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ b3f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ b42:	75 94                	jne    ad8 <bench+0x98>
+ b44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b47:	83 ec 08             	sub    $0x8,%esp
+ b4a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ b50:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ b55:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ b5b:	e8 70 f8 ff ff       	call   3d0 <cyc2ns>
+ b60:	83 c4 0c             	add    $0xc,%esp
+ b63:	ff 75 14             	push   0x14(%ebp)
+ b66:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b6c:	f7 e3                	mul    %ebx
+ b6e:	01 ca                	add    %ecx,%edx
+ b70:	52                   	push   %edx
+ b71:	50                   	push   %eax
+ b72:	e8 29 f8 ff ff       	call   3a0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ b77:	89 06                	mov    %eax,(%esi)
+ b79:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b7c:	5f                   	pop    %edi
+ b7d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ b7e:	8b 45 18             	mov    0x18(%ebp),%eax
+ b81:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b83:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ b8a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ b91:	e8 3a f8 ff ff       	call   3d0 <cyc2ns>
+ b96:	83 c4 0c             	add    $0xc,%esp
+ b99:	ff 75 14             	push   0x14(%ebp)
+ b9c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ba2:	f7 e3                	mul    %ebx
+ ba4:	01 ca                	add    %ecx,%edx
+ ba6:	52                   	push   %edx
+ ba7:	50                   	push   %eax
+ ba8:	e8 f3 f7 ff ff       	call   3a0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ bad:	89 46 08             	mov    %eax,0x8(%esi)
+ bb0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bb3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bb4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bb7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bb8:	8d 50 01             	lea    0x1(%eax),%edx
+ bbb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ bc0:	6b d2 63             	imul   $0x63,%edx,%edx
+ bc3:	f7 e2                	mul    %edx
+ bc5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bc8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ bcf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ bd6:	e8 f5 f7 ff ff       	call   3d0 <cyc2ns>
+ bdb:	83 c4 0c             	add    $0xc,%esp
+ bde:	ff 75 14             	push   0x14(%ebp)
+ be1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ be7:	f7 e3                	mul    %ebx
+ be9:	01 ca                	add    %ecx,%edx
+ beb:	52                   	push   %edx
+ bec:	50                   	push   %eax
+ bed:	e8 ae f7 ff ff       	call   3a0 <udiv64>
+
+  if(name){
+ bf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ bf5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bf8:	89 46 10             	mov    %eax,0x10(%esi)
+ bfb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ bfe:	85 c9                	test   %ecx,%ecx
+ c00:	74 72                	je     c74 <bench+0x234>
+    printf(1, "%s: min ", name);
+ c02:	83 ec 04             	sub    $0x4,%esp
+ c05:	ff 75 08             	push   0x8(%ebp)
+ c08:	68 86 0d 00 00       	push   $0xd86
+ c0d:	6a 01                	push   $0x1
+ c0f:	e8 5c fa ff ff       	call   670 <printf>
+    printps(1, st->min);
+ c14:	83 c4 0c             	add    $0xc,%esp
+ c17:	ff 76 04             	push   0x4(%esi)
+ c1a:	ff 36                	push   (%esi)
+ c1c:	6a 01                	push   $0x1
+ c1e:	e8 7d fd ff ff       	call   9a0 <printps>
+    printf(1, " median ");
+ c23:	58                   	pop    %eax
+ c24:	5a                   	pop    %edx
+ c25:	68 8f 0d 00 00       	push   $0xd8f
+ c2a:	6a 01                	push   $0x1
+ c2c:	e8 3f fa ff ff       	call   670 <printf>
+    printps(1, st->median);
+ c31:	83 c4 0c             	add    $0xc,%esp
+ c34:	ff 76 0c             	push   0xc(%esi)
+ c37:	ff 76 08             	push   0x8(%esi)
+ c3a:	6a 01                	push   $0x1
+ c3c:	e8 5f fd ff ff       	call   9a0 <printps>
+    printf(1, " p99 ");
+ c41:	59                   	pop    %ecx
+ c42:	5b                   	pop    %ebx
+ c43:	68 98 0d 00 00       	push   $0xd98
+ c48:	6a 01                	push   $0x1
+ c4a:	e8 21 fa ff ff       	call   670 <printf>
+    printps(1, st->p99);
+ c4f:	83 c4 0c             	add    $0xc,%esp
+ c52:	ff 76 14             	push   0x14(%esi)
+ c55:	ff 76 10             	push   0x10(%esi)
+ c58:	6a 01                	push   $0x1
+ c5a:	e8 41 fd ff ff       	call   9a0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ c5f:	83 c4 0c             	add    $0xc,%esp
+ c62:	ff 75 18             	push   0x18(%ebp)
+ c65:	68 9e 0d 00 00       	push   $0xd9e
+ c6a:	6a 01                	push   $0x1
+ c6c:	e8 ff f9 ff ff       	call   670 <printf>
+ c71:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ c74:	31 c0                	xor    %eax,%eax
+}
+ c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c79:	5b                   	pop    %ebx
+ c7a:	5e                   	pop    %esi
+ c7b:	5f                   	pop    %edi
+ c7c:	5d                   	pop    %ebp
+ c7d:	c3                   	ret
+ c7e:	66 90                	xchg   %ax,%ax
+ c80:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c86:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ c8c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c92:	e9 97 fe ff ff       	jmp    b2e <bench+0xee>
+    return -1;
+ c97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c9c:	eb d8                	jmp    c76 <bench+0x236>
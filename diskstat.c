@@ -0,0 +1,41 @@
+// Print disk queue statistics.
+//   diskstat          one line per disk since boot
+// blk/xfer is requests per transfer, times 100, so anything
+// over 100 means adjacent requests were merged.
+
+#include "types.h"
+#include "user.h"
+#include "diskstat.h"
+
+#define NDISK 2
+
+static uint
+avg(uint64 sum, uint64 n, uint scale)
+{
+  if(n == 0)
+    return 0;
+  return udiv64(sum * scale, (uint)n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct diskstat ds[NDISK];
+  int i, n;
+
+  if((n = diskstat(ds, NDISK)) < 0){
+    printf(2, "diskstat: failed\n");
+    exit();
+  }
+  printf(1, "disk\trequest\txfer\tblk/xfer\tqavg*100\tqmax\twait(us)\tmax(us)\n");
+  for(i = 0; i < n; i++){
+    printf(1, "%d\t%d\t%d\t%d\t\t%d\t\t%d\t%d\t\t%d\n", i,
+           (uint)ds[i].nreq, (uint)ds[i].nxfer,
+           avg(ds[i].nreq, ds[i].nxfer, 100),
+           avg(ds[i].qsum, ds[i].nreq, 100),
+           ds[i].qmax,
+           (uint)udiv64(cyc2ns(avg(ds[i].wait, ds[i].nreq, 1)), 1000),
+           (uint)udiv64(cyc2ns(ds[i].waitmax), 1000));
+  }
+  exit();
+}
@@ -0,0 +1,12 @@
+// Disk queue statistics, shared by the kernel and diskstat(1).
+// One per IDE disk; requests are buffers, transfers are disk
+// commands, each moving one or more adjacent requests.
+
+struct diskstat {
+  uint64 nreq;         // requests completed
+  uint64 nxfer;        // transfers started
+  uint64 qsum;         // queue depth seen by each new request, summed
+  uint qmax;           // deepest the queue has been
+  uint64 wait;         // TSC cycles from queueing to completion, summed
+  uint64 waitmax;      // the longest of those
+};
@@ -0,0 +1,1753 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 44 0c 00 00       	push   $0xc44
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 b0 0b 00 00       	push   $0xbb0
+  3e:	6a 01                	push   $0x1
+  40:	e8 3b 05 00 00       	call   580 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 56 0c 00 00       	push   $0xc56
+  55:	50                   	push   %eax
+  56:	68 b0 0b 00 00       	push   $0xbb0
+  5b:	6a 01                	push   $0x1
+  5d:	e8 1e 05 00 00       	call   580 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 0e 03 00 00       	call   378 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 e3 01 00 00       	call   390 <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 b6 01 00 00       	call   3b8 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 b9 01 00 00       	call   3d0 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 7f 01 00 00       	call   3a0 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	31 d2                	xor    %edx,%edx
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 2bc:	f7 f3                	div    %ebx
+ 2be:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 2c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 2c8:	89 ca                	mov    %ecx,%edx
+}
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 2d0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 2d2:	c3                   	ret
+ 2d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002e0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 2e9:	8b 35 d8 0f 00 00    	mov    0xfd8,%esi
+{
+ 2ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 2f5:	85 f6                	test   %esi,%esi
+ 2f7:	74 2f                	je     328 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 2f9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 2fe:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 304:	f7 e3                	mul    %ebx
+ 306:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 309:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 30c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 30f:	31 d2                	xor    %edx,%edx
+ 311:	f7 f6                	div    %esi
+ 313:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 315:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 318:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 31b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 31d:	89 da                	mov    %ebx,%edx
+}
+ 31f:	5b                   	pop    %ebx
+ 320:	5e                   	pop    %esi
+ 321:	5f                   	pop    %edi
+ 322:	5d                   	pop    %ebp
+ 323:	c3                   	ret
+ 324:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 328:	e8 0b 01 00 00       	call   438 <tscfreq>
+ 32d:	a3 d8 0f 00 00       	mov    %eax,0xfd8
+ 332:	89 c6                	mov    %eax,%esi
+ 334:	eb c3                	jmp    2f9 <cyc2ns+0x19>
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	83 ec 10             	sub    $0x10,%esp
+ 347:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 34a:	6a 00                	push   $0x0
+ 34c:	e8 3f 01 00 00       	call   490 <getpriority>
+ 351:	5a                   	pop    %edx
+ 352:	59                   	pop    %ecx
+ 353:	01 d8                	add    %ebx,%eax
+ 355:	50                   	push   %eax
+ 356:	6a 00                	push   $0x0
+ 358:	e8 2b 01 00 00       	call   488 <setpriority>
+  return getpriority(0);
+ 35d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 364:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 367:	83 c4 10             	add    $0x10,%esp
+}
+ 36a:	c9                   	leave
+  return getpriority(0);
+ 36b:	e9 20 01 00 00       	jmp    490 <getpriority>
+
+00000370 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 370:	b8 01 00 00 00       	mov    $0x1,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <exit>:
+SYSCALL(exit)
+ 378:	b8 02 00 00 00       	mov    $0x2,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <wait>:
+SYSCALL(wait)
+ 380:	b8 03 00 00 00       	mov    $0x3,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <pipe>:
+SYSCALL(pipe)
+ 388:	b8 04 00 00 00       	mov    $0x4,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <read>:
+SYSCALL(read)
+ 390:	b8 05 00 00 00       	mov    $0x5,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <write>:
+SYSCALL(write)
+ 398:	b8 10 00 00 00       	mov    $0x10,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <close>:
+SYSCALL(close)
+ 3a0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <kill>:
+SYSCALL(kill)
+ 3a8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <exec>:
+SYSCALL(exec)
+ 3b0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <open>:
+SYSCALL(open)
+ 3b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <mknod>:
+SYSCALL(mknod)
+ 3c0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <unlink>:
+SYSCALL(unlink)
+ 3c8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <fstat>:
+SYSCALL(fstat)
+ 3d0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <link>:
+SYSCALL(link)
+ 3d8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <mkdir>:
+SYSCALL(mkdir)
+ 3e0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <chdir>:
+SYSCALL(chdir)
+ 3e8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <dup>:
+SYSCALL(dup)
+ 3f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <getpid>:
+SYSCALL(getpid)
+ 3f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <sbrk>:
+SYSCALL(sbrk)
+ 400:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <sleep>:
+SYSCALL(sleep)
+ 408:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <uptime>:
+SYSCALL(uptime)
+ 410:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <promote>:
+
+SYSCALL(promote)
+ 418:	b8 18 00 00 00       	mov    $0x18,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <demote>:
+SYSCALL(demote)
+ 420:	b8 19 00 00 00       	mov    $0x19,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 428:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 430:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <tscfreq>:
+SYSCALL(tscfreq)
+ 438:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <tracemask>:
+SYSCALL(tracemask)
+ 440:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <traceread>:
+SYSCALL(traceread)
+ 448:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <profile>:
+SYSCALL(profile)
+ 450:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <profread>:
+SYSCALL(profread)
+ 458:	b8 20 00 00 00       	mov    $0x20,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <lockstat>:
+SYSCALL(lockstat)
+ 460:	b8 21 00 00 00       	mov    $0x21,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 468:	b8 22 00 00 00       	mov    $0x22,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <sysstat>:
+SYSCALL(sysstat)
+ 470:	b8 23 00 00 00       	mov    $0x23,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <kbench>:
+SYSCALL(kbench)
+ 478:	b8 24 00 00 00       	mov    $0x24,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <yield>:
+SYSCALL(yield)
+ 480:	b8 25 00 00 00       	mov    $0x25,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <setpriority>:
+SYSCALL(setpriority)
+ 488:	b8 26 00 00 00       	mov    $0x26,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <getpriority>:
+SYSCALL(getpriority)
+ 490:	b8 27 00 00 00       	mov    $0x27,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 498:	b8 28 00 00 00       	mov    $0x28,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4a0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <clone>:
+SYSCALL(clone)
+ 4a8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <join>:
+SYSCALL(join)
+ 4b0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <futex_wait>:
+SYSCALL(futex_wait)
+ 4b8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <futex_wake>:
+SYSCALL(futex_wake)
+ 4c0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <spawn>:
+SYSCALL(spawn)
+ 4c8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <diskstat>:
+SYSCALL(diskstat)
+ 4d0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+ 4d8:	66 90                	xchg   %ax,%ax
+ 4da:	66 90                	xchg   %ax,%ax
+ 4dc:	66 90                	xchg   %ax,%ax
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 3c             	sub    $0x3c,%esp
+ 4ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 80 00 00 00    	jns    578 <printint+0x98>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	74 7a                	je     578 <printint+0x98>
+    x = -xx;
+ 4fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 508:	31 f6                	xor    %esi,%esi
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 14 0c 00 00 	movzbl 0xc14(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+ 53c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 53f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 542:	01 df                	add    %ebx,%edi
+ 544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 554:	6a 01                	push   $0x1
+ 556:	50                   	push   %eax
+ 557:	56                   	push   %esi
+ 558:	e8 3b fe ff ff       	call   398 <write>
+  while(--i >= 0)
+ 55d:	89 f8                	mov    %edi,%eax
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	83 ef 01             	sub    $0x1,%edi
+ 565:	39 d8                	cmp    %ebx,%eax
+ 567:	75 df                	jne    548 <printint+0x68>
+}
+ 569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56c:	5b                   	pop    %ebx
+ 56d:	5e                   	pop    %esi
+ 56e:	5f                   	pop    %edi
+ 56f:	5d                   	pop    %ebp
+ 570:	c3                   	ret
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb 89                	jmp    505 <printint+0x25>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 58c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 58f:	0f b6 1e             	movzbl (%esi),%ebx
+ 592:	83 c6 01             	add    $0x1,%esi
+ 595:	84 db                	test   %bl,%bl
+ 597:	74 67                	je     600 <printf+0x80>
+ 599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5a1:	eb 34                	jmp    5d7 <printf+0x57>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	74 18                	je     5cd <printf+0x4d>
+  write(fd, &c, 1);
+ 5b5:	83 ec 04             	sub    $0x4,%esp
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5be:	6a 01                	push   $0x1
+ 5c0:	50                   	push   %eax
+ 5c1:	57                   	push   %edi
+ 5c2:	e8 d1 fd ff ff       	call   398 <write>
+ 5c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d0:	83 c6 01             	add    $0x1,%esi
+ 5d3:	84 db                	test   %bl,%bl
+ 5d5:	74 29                	je     600 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5da:	85 d2                	test   %edx,%edx
+ 5dc:	74 ca                	je     5a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5de:	83 fa 25             	cmp    $0x25,%edx
+ 5e1:	75 ea                	jne    5cd <printf+0x4d>
+      if(c == 'd'){
+ 5e3:	83 f8 25             	cmp    $0x25,%eax
+ 5e6:	0f 84 24 01 00 00    	je     710 <printf+0x190>
+ 5ec:	83 e8 63             	sub    $0x63,%eax
+ 5ef:	83 f8 15             	cmp    $0x15,%eax
+ 5f2:	77 1c                	ja     610 <printf+0x90>
+ 5f4:	ff 24 85 bc 0b 00 00 	jmp    *0xbbc(,%eax,4)
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 61a:	6a 01                	push   $0x1
+ 61c:	52                   	push   %edx
+ 61d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 620:	57                   	push   %edi
+ 621:	e8 72 fd ff ff       	call   398 <write>
+ 626:	83 c4 0c             	add    $0xc,%esp
+ 629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62c:	6a 01                	push   $0x1
+ 62e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 631:	52                   	push   %edx
+ 632:	57                   	push   %edi
+ 633:	e8 60 fd ff ff       	call   398 <write>
+        putc(fd, c);
+ 638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63b:	31 d2                	xor    %edx,%edx
+ 63d:	eb 8e                	jmp    5cd <printf+0x4d>
+ 63f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 00                	push   $0x0
+ 64f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 654:	e8 87 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 65c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 67 ff ff ff       	jmp    5cd <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 67b:	85 db                	test   %ebx,%ebx
+ 67d:	0f 84 9d 00 00 00    	je     720 <printf+0x1a0>
+        while(*s != 0){
+ 683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 688:	84 c0                	test   %al,%al
+ 68a:	0f 84 3d ff ff ff    	je     5cd <printf+0x4d>
+ 690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 696:	89 de                	mov    %ebx,%esi
+ 698:	89 d3                	mov    %edx,%ebx
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	53                   	push   %ebx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 e6 fc ff ff       	call   398 <write>
+        while(*s != 0){
+ 6b2:	0f b6 06             	movzbl (%esi),%eax
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	75 e4                	jne    6a0 <printf+0x120>
+      state = 0;
+ 6bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 07 ff ff ff       	jmp    5cd <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 01                	push   $0x1
+ 6df:	e9 6b ff ff ff       	jmp    64f <printf+0xcf>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	52                   	push   %edx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 96 fc ff ff       	call   398 <write>
+        ap++;
+ 702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 708:	31 d2                	xor    %edx,%edx
+ 70a:	e9 be fe ff ff       	jmp    5cd <printf+0x4d>
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 719:	6a 01                	push   $0x1
+ 71b:	e9 11 ff ff ff       	jmp    631 <printf+0xb1>
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 725:	bb b5 0b 00 00       	mov    $0xbb5,%ebx
+ 72a:	e9 61 ff ff ff       	jmp    690 <printf+0x110>
+ 72f:	90                   	nop
+
+00000730 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 730:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 731:	a1 dc 0f 00 00       	mov    0xfdc,%eax
+{
+ 736:	89 e5                	mov    %esp,%ebp
+ 738:	57                   	push   %edi
+ 739:	56                   	push   %esi
+ 73a:	53                   	push   %ebx
+ 73b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 73e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 748:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 74a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 74c:	39 ca                	cmp    %ecx,%edx
+ 74e:	73 30                	jae    780 <free+0x50>
+ 750:	39 c1                	cmp    %eax,%ecx
+ 752:	72 04                	jb     758 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 754:	39 c2                	cmp    %eax,%edx
+ 756:	72 f0                	jb     748 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 758:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 75b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 75e:	39 f8                	cmp    %edi,%eax
+ 760:	74 2e                	je     790 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 762:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 765:	8b 42 04             	mov    0x4(%edx),%eax
+ 768:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 76b:	39 f1                	cmp    %esi,%ecx
+ 76d:	74 38                	je     7a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 76f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 771:	5b                   	pop    %ebx
+  freep = p;
+ 772:	89 15 dc 0f 00 00    	mov    %edx,0xfdc
+}
+ 778:	5e                   	pop    %esi
+ 779:	5f                   	pop    %edi
+ 77a:	5d                   	pop    %ebp
+ 77b:	c3                   	ret
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 780:	39 c1                	cmp    %eax,%ecx
+ 782:	72 d0                	jb     754 <free+0x24>
+ 784:	eb c2                	jmp    748 <free+0x18>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 790:	03 70 04             	add    0x4(%eax),%esi
+ 793:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 796:	8b 02                	mov    (%edx),%eax
+ 798:	8b 00                	mov    (%eax),%eax
+ 79a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 79d:	8b 42 04             	mov    0x4(%edx),%eax
+ 7a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7a3:	39 f1                	cmp    %esi,%ecx
+ 7a5:	75 c8                	jne    76f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7aa:	89 15 dc 0f 00 00    	mov    %edx,0xfdc
+    p->s.size += bp->s.size;
+ 7b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7b8:	5b                   	pop    %ebx
+ 7b9:	5e                   	pop    %esi
+ 7ba:	5f                   	pop    %edi
+ 7bb:	5d                   	pop    %ebp
+ 7bc:	c3                   	ret
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7cc:	8b 15 dc 0f 00 00    	mov    0xfdc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7d5:	c1 ef 03             	shr    $0x3,%edi
+ 7d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7db:	85 d2                	test   %edx,%edx
+ 7dd:	0f 84 8d 00 00 00    	je     870 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e8:	39 f9                	cmp    %edi,%ecx
+ 7ea:	73 64                	jae    850 <malloc+0x90>
+  if(nu < 4096)
+ 7ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7f1:	39 df                	cmp    %ebx,%edi
+ 7f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7fd:	eb 0a                	jmp    809 <malloc+0x49>
+ 7ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 800:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 802:	8b 48 04             	mov    0x4(%eax),%ecx
+ 805:	39 f9                	cmp    %edi,%ecx
+ 807:	73 47                	jae    850 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 809:	89 c2                	mov    %eax,%edx
+ 80b:	39 05 dc 0f 00 00    	cmp    %eax,0xfdc
+ 811:	75 ed                	jne    800 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	56                   	push   %esi
+ 817:	e8 e4 fb ff ff       	call   400 <sbrk>
+  if(p == (char*)-1)
+ 81c:	83 c4 10             	add    $0x10,%esp
+ 81f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 822:	74 1c                	je     840 <malloc+0x80>
+  hp->s.size = nu;
+ 824:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 827:	83 ec 0c             	sub    $0xc,%esp
+ 82a:	83 c0 08             	add    $0x8,%eax
+ 82d:	50                   	push   %eax
+ 82e:	e8 fd fe ff ff       	call   730 <free>
+  return freep;
+ 833:	8b 15 dc 0f 00 00    	mov    0xfdc,%edx
+      if((p = morecore(nunits)) == 0)
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	85 d2                	test   %edx,%edx
+ 83e:	75 c0                	jne    800 <malloc+0x40>
+        return 0;
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 843:	31 c0                	xor    %eax,%eax
+}
+ 845:	5b                   	pop    %ebx
+ 846:	5e                   	pop    %esi
+ 847:	5f                   	pop    %edi
+ 848:	5d                   	pop    %ebp
+ 849:	c3                   	ret
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 850:	39 cf                	cmp    %ecx,%edi
+ 852:	74 4c                	je     8a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 854:	29 f9                	sub    %edi,%ecx
+ 856:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 859:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 85c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 85f:	89 15 dc 0f 00 00    	mov    %edx,0xfdc
+}
+ 865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 868:	83 c0 08             	add    $0x8,%eax
+}
+ 86b:	5b                   	pop    %ebx
+ 86c:	5e                   	pop    %esi
+ 86d:	5f                   	pop    %edi
+ 86e:	5d                   	pop    %ebp
+ 86f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 870:	c7 05 dc 0f 00 00 e0 	movl   $0xfe0,0xfdc
+ 877:	0f 00 00 
+    base.s.size = 0;
+ 87a:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 87f:	c7 05 e0 0f 00 00 e0 	movl   $0xfe0,0xfe0
+ 886:	0f 00 00 
+    base.s.size = 0;
+ 889:	c7 05 e4 0f 00 00 00 	movl   $0x0,0xfe4
+ 890:	00 00 00 
+    if(p->s.size >= nunits){
+ 893:	e9 54 ff ff ff       	jmp    7ec <malloc+0x2c>
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8a0:	8b 08                	mov    (%eax),%ecx
+ 8a2:	89 0a                	mov    %ecx,(%edx)
+ 8a4:	eb b9                	jmp    85f <malloc+0x9f>
+ 8a6:	66 90                	xchg   %ax,%ax
+ 8a8:	66 90                	xchg   %ax,%ax
+ 8aa:	66 90                	xchg   %ax,%ax
+ 8ac:	66 90                	xchg   %ax,%ax
+ 8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 20             	sub    $0x20,%esp
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 8bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 8c2:	68 e8 03 00 00       	push   $0x3e8
+ 8c7:	57                   	push   %edi
+ 8c8:	56                   	push   %esi
+ 8c9:	e8 e2 f9 ff ff       	call   2b0 <udiv64>
+ 8ce:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 8d0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 8d3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 8d9:	29 c1                	sub    %eax,%ecx
+ 8db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 8de:	68 e8 03 00 00       	push   $0x3e8
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	e8 c6 f9 ff ff       	call   2b0 <udiv64>
+ 8ea:	83 c4 0c             	add    $0xc,%esp
+ 8ed:	50                   	push   %eax
+ 8ee:	68 25 0c 00 00       	push   $0xc25
+ 8f3:	53                   	push   %ebx
+ 8f4:	e8 87 fc ff ff       	call   580 <printf>
+  if(frac < 100)
+ 8f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	83 f9 63             	cmp    $0x63,%ecx
+ 902:	76 1c                	jbe    920 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 904:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 907:	c7 45 0c 2b 0c 00 00 	movl   $0xc2b,0xc(%ebp)
+ 90e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 914:	5b                   	pop    %ebx
+ 915:	5e                   	pop    %esi
+ 916:	5f                   	pop    %edi
+ 917:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 918:	e9 63 fc ff ff       	jmp    580 <printf>
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 920:	83 ec 08             	sub    $0x8,%esp
+ 923:	68 29 0c 00 00       	push   $0xc29
+ 928:	53                   	push   %ebx
+ 929:	e8 52 fc ff ff       	call   580 <printf>
+  if(frac < 10)
+ 92e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 931:	83 c4 10             	add    $0x10,%esp
+ 934:	83 f9 09             	cmp    $0x9,%ecx
+ 937:	77 cb                	ja     904 <printps+0x54>
+    printf(fd, "0");
+ 939:	83 ec 08             	sub    $0x8,%esp
+ 93c:	68 29 0c 00 00       	push   $0xc29
+ 941:	53                   	push   %ebx
+ 942:	e8 39 fc ff ff       	call   580 <printf>
+ 947:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 94a:	83 c4 10             	add    $0x10,%esp
+ 94d:	eb b5                	jmp    904 <printps+0x54>
+ 94f:	90                   	nop
+
+00000950 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 95c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 95f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 962:	83 e8 01             	sub    $0x1,%eax
+ 965:	3d ff 00 00 00       	cmp    $0xff,%eax
+ 96a:	0f 87 37 02 00 00    	ja     ba7 <bench+0x257>
+ 970:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 973:	85 ff                	test   %edi,%edi
+ 975:	0f 84 2c 02 00 00    	je     ba7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ 97b:	83 ec 0c             	sub    $0xc,%esp
+ 97e:	ff 75 10             	push   0x10(%ebp)
+ 981:	ff 55 0c             	call   *0xc(%ebp)
+ 984:	5b                   	pop    %ebx
+ 985:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ 988:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ 98a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ 98d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ 990:	83 c4 10             	add    $0x10,%esp
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+    t0 = cycles();
+ 998:	e8 33 f9 ff ff       	call   2d0 <cycles>
+    fn(arg);
+ 99d:	83 ec 0c             	sub    $0xc,%esp
+ 9a0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ 9a3:	89 c6                	mov    %eax,%esi
+ 9a5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ 9a7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ 9aa:	e8 21 f9 ff ff       	call   2d0 <cycles>
+ 9af:	29 f0                	sub    %esi,%eax
+ 9b1:	19 fa                	sbb    %edi,%edx
+ 9b3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 9ba:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ 9bd:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 9c4:	83 c3 01             	add    $0x1,%ebx
+ 9c7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ 9ca:	7f cc                	jg     998 <bench+0x48>
+  for(i = 1; i < n; i++){
+ 9cc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ 9d0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ 9d3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ 9d9:	bf 01 00 00 00       	mov    $0x1,%edi
+ 9de:	74 77                	je     a57 <bench+0x107>
+ 9e0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ 9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9e7:	90                   	nop
+    v = a[i];
+ 9e8:	8b 01                	mov    (%ecx),%eax
+ 9ea:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ 9ed:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ 9f3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ 9f9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ 9ff:	89 c8                	mov    %ecx,%eax
+ a01:	eb 1b                	jmp    a1e <bench+0xce>
+ a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a07:	90                   	nop
+      a[j] = a[j-1];
+ a08:	89 08                	mov    %ecx,(%eax)
+ a0a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a0d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ a10:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ a16:	39 c3                	cmp    %eax,%ebx
+ a18:	0f 84 72 01 00 00    	je     b90 <bench+0x240>
+ a1e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ a21:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ a24:	89 f7                	mov    %esi,%edi
+ a26:	89 c3                	mov    %eax,%ebx
+ a28:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ a2e:	19 d7                	sbb    %edx,%edi
+ a30:	72 d6                	jb     a08 <bench+0xb8>
+ a32:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ a38:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ a3e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ a44:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ a47:	83 c7 01             	add    $0x1,%edi
+ a4a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ a4d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ a4f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ a52:	75 94                	jne    9e8 <bench+0x98>
+ a54:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a57:	83 ec 08             	sub    $0x8,%esp
+ a5a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ a60:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ a65:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ a6b:	e8 70 f8 ff ff       	call   2e0 <cyc2ns>
+ a70:	83 c4 0c             	add    $0xc,%esp
+ a73:	ff 75 14             	push   0x14(%ebp)
+ a76:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ a7c:	f7 e3                	mul    %ebx
+ a7e:	01 ca                	add    %ecx,%edx
+ a80:	52                   	push   %edx
+ a81:	50                   	push   %eax
+ a82:	e8 29 f8 ff ff       	call   2b0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ a87:	89 06                	mov    %eax,(%esi)
+ a89:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a8c:	5f                   	pop    %edi
+ a8d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ a8e:	8b 45 18             	mov    0x18(%ebp),%eax
+ a91:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a93:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ a9a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ aa1:	e8 3a f8 ff ff       	call   2e0 <cyc2ns>
+ aa6:	83 c4 0c             	add    $0xc,%esp
+ aa9:	ff 75 14             	push   0x14(%ebp)
+ aac:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ab2:	f7 e3                	mul    %ebx
+ ab4:	01 ca                	add    %ecx,%edx
+ ab6:	52                   	push   %edx
+ ab7:	50                   	push   %eax
+ ab8:	e8 f3 f7 ff ff       	call   2b0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ abd:	89 46 08             	mov    %eax,0x8(%esi)
+ ac0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ac3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ac4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ac7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ac8:	8d 50 01             	lea    0x1(%eax),%edx
+ acb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ ad0:	6b d2 63             	imul   $0x63,%edx,%edx
+ ad3:	f7 e2                	mul    %edx
+ ad5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ad8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ adf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ ae6:	e8 f5 f7 ff ff       	call   2e0 <cyc2ns>
+ aeb:	83 c4 0c             	add    $0xc,%esp
+ aee:	ff 75 14             	push   0x14(%ebp)
+ af1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ af7:	f7 e3                	mul    %ebx
+ af9:	01 ca                	add    %ecx,%edx
+ afb:	52                   	push   %edx
+ afc:	50                   	push   %eax
+ afd:	e8 ae f7 ff ff       	call   2b0 <udiv64>
+
+  if(name){
+ b02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b05:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b08:	89 46 10             	mov    %eax,0x10(%esi)
+ b0b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ b0e:	85 c9                	test   %ecx,%ecx
+ b10:	74 72                	je     b84 <bench+0x234>
+    printf(1, "%s: min ", name);
+ b12:	83 ec 04             	sub    $0x4,%esp
+ b15:	ff 75 08             	push   0x8(%ebp)
+ b18:	68 2e 0c 00 00       	push   $0xc2e
+ b1d:	6a 01                	push   $0x1
+ b1f:	e8 5c fa ff ff       	call   580 <printf>
+    printps(1, st->min);
+ b24:	83 c4 0c             	add    $0xc,%esp
+ b27:	ff 76 04             	push   0x4(%esi)
+ b2a:	ff 36                	push   (%esi)
+ b2c:	6a 01                	push   $0x1
+ b2e:	e8 7d fd ff ff       	call   8b0 <printps>
+    printf(1, " median ");
+ b33:	58                   	pop    %eax
+ b34:	5a                   	pop    %edx
+ b35:	68 37 0c 00 00       	push   $0xc37
+ b3a:	6a 01                	push   $0x1
+ b3c:	e8 3f fa ff ff       	call   580 <printf>
+    printps(1, st->median);
+ b41:	83 c4 0c             	add    $0xc,%esp
+ b44:	ff 76 0c             	push   0xc(%esi)
+ b47:	ff 76 08             	push   0x8(%esi)
+ b4a:	6a 01                	push   $0x1
+ b4c:	e8 5f fd ff ff       	call   8b0 <printps>
+    printf(1, " p99 ");
+ b51:	59                   	pop    %ecx
+ b52:	5b                   	pop    %ebx
+ b53:	68 40 0c 00 00       	push   $0xc40
+ b58:	6a 01                	push   $0x1
+ b5a:	e8 21 fa ff ff       	call   580 <printf>
+    printps(1, st->p99);
+ b5f:	83 c4 0c             	add    $0xc,%esp
+ b62:	ff 76 14             	push   0x14(%esi)
+ b65:	ff 76 10             	push   0x10(%esi)
+ b68:	6a 01                	push   $0x1
+ b6a:	e8 41 fd ff ff       	call   8b0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ b6f:	83 c4 0c             	add    $0xc,%esp
+ b72:	ff 75 18             	push   0x18(%ebp)
+ b75:	68 46 0c 00 00       	push   $0xc46
+ b7a:	6a 01                	push   $0x1
+ b7c:	e8 ff f9 ff ff       	call   580 <printf>
+ b81:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ b84:	31 c0                	xor    %eax,%eax
+}
+ b86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b89:	5b                   	pop    %ebx
+ b8a:	5e                   	pop    %esi
+ b8b:	5f                   	pop    %edi
+ b8c:	5d                   	pop    %ebp
+ b8d:	c3                   	ret
+ b8e:	66 90                	xchg   %ax,%ax
+ b90:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b96:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ b9c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ ba2:	e9 97 fe ff ff       	jmp    a3e <bench+0xee>
+    return -1;
+ ba7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ bac:	eb d8                	jmp    b86 <bench+0x236>
@@ -7,17 +7,23 @@
 #include "x86.h"
 #include "elf.h"
 
-int
-exec(char *path, char **argv)
+#define FAULTAROUND 4   // pages read in by one fault, if not yet present
+
+// Load the program at path into a new page table, with the
+// arguments argv on its stack.  Returns 0 and fills in img,
+// or -1.  The segments are not read now: their pages are left
+// unmapped for pagefault() to read in on first touch, and img
+// keeps a reference to the inode for that.
+static int
+load(char *path, char **argv, struct image *img)
 {
-  char *s, *last;
-  int i, off;
+  int i, off, nseg;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  struct seg *s;
+  pde_t *pgdir;
 
   begin_op();
 
@@ -38,8 +44,11 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Record the segments, in ascending order.  If there are
+  // more than NSEG, load the rest now.
   sz = 0;
+  nseg = 0;
+  memset(img->seg, 0, sizeof(img->seg));
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,16 +58,22 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr % PGSIZE != 0 || ph.vaddr < sz)
       goto bad;
-    if(ph.vaddr % PGSIZE != 0)
+    if(nseg < NSEG){
+      s = &img->seg[nseg++];
+      s->va = ph.vaddr;
+      s->memsz = ph.memsz;
+      s->off = ph.off;
+      s->filesz = ph.filesz;
+      sz = ph.vaddr + ph.memsz;
+      continue;
+    }
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
       goto bad;
     if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
       goto bad;
   }
-  iunlockput(ip);
-  end_op();
-  ip = 0;
 
   // Allocate two pages at the next page boundary.
   // Make the first inaccessible.  Use the second as the user stack.
@@ -87,28 +102,231 @@ exec(char *path, char **argv)
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
-  // Save program name for debugging.
+  img->pgdir = pgdir;
+  img->sz = sz;
+  img->entry = elf.entry;  // main
+  img->sp = sp;
+  img->exe = 0;
+  if(nseg){
+    img->exe = ip;
+    iunlock(ip);
+  } else
+    iunlockput(ip);
+  end_op();
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+  iunlockput(ip);
+  end_op();
+  return -1;
+}
+
+// Drop an image that no process took over.
+static void
+freeimage(struct image *img)
+{
+  freevm(img->pgdir);
+  if(img->exe){
+    begin_op();
+    iput(img->exe);
+    end_op();
+  }
+}
+
+// The segment of p's executable that holds user address va, or 0.
+static struct seg*
+findseg(struct proc *p, uint va)
+{
+  struct seg *s;
+
+  for(s = p->seg; s < &p->seg[NSEG] && s->memsz; s++)
+    if(va >= s->va && va < s->va + s->memsz)
+      return s;
+  return 0;
+}
+
+// Map page a of segment s from p's executable, which is locked.
+// A page with file data comes from the text cache if share is
+// set and the page table is not shared by threads; otherwise it
+// is read into a private page, zero past the file data.
+static int
+loadpage(struct proc *p, struct seg *s, uint a, int share)
+{
+  char *mem;
+  uint n, fa;
+  int perm;
+
+  fa = a - s->va;
+  share = share && !p->shared && fa < s->filesz;
+  perm = PTE_W|PTE_U;
+  if(share && (mem = textget(p->exe, s->off + fa)) != 0){
+    perm = PTE_U|PTE_SHARED;
+    goto map;
+  }
+  if((mem = kzalloc()) == 0)
+    return -1;
+  if(fa < s->filesz){
+    n = s->filesz - fa;
+    if(n > PGSIZE)
+      n = PGSIZE;
+    if(readi(p->exe, mem, s->off + fa, n) != n){
+      kfree(mem);
+      return -1;
+    }
+  }
+  if(share && textadd(p->exe, s->off + fa, mem))
+    perm = PTE_U|PTE_SHARED;
+
+map:
+  lockvm(p);
+  if(uva2ka(p->pgdir, (char*)a) != 0 ||
+     mapuserpage(p->pgdir, a, mem, perm) < 0){
+    // Out of memory, or a thread sharing the page table got
+    // here first.
+    unlockvm(p);
+    if(perm & PTE_SHARED)
+      textput(mem);
+    else
+      kfree(mem);
+    return uva2ka(p->pgdir, (char*)a) ? 0 : -1;
+  }
+  unlockvm(p);
+  return 0;
+}
+
+// Handle a page fault at user address va in the current process,
+// a write if write is set.  If va lies in a segment of the
+// executable that has not been read in, map its page, and the
+// next few in the segment that are also missing, so that
+// sequential execution takes one fault per FAULTAROUND pages.
+// A write to a shared page gets a private copy.  Returns 0 if
+// the access can now proceed, or -1 if it is the process's error.
+int
+pagefault(uint va, int write)
+{
+  struct proc *p = myproc();
+  struct seg *s;
+  uint a, end;
+  int i;
+
+  if(p->exe == 0 || va >= p->sz || (s = findseg(p, va)) == 0)
+    return -1;
+  a = PGROUNDDOWN(va);
+  if(uva2ka(p->pgdir, (char*)a) != 0){
+    // Mapped already: a write to a shared page, or another
+    // thread loaded it.  The TLB may hold the old entry even
+    // if the page is private now.
+    if(write){
+      if(cowpage(p->pgdir, a) < 0)
+        return -1;
+      lcr3(V2P(p->pgdir));
+    }
+    return 0;
+  }
+  end = s->va + s->memsz;
+  ilock(p->exe);
+  for(i = 0; i < FAULTAROUND && a < end; i++, a += PGSIZE){
+    if(i > 0 && uva2ka(p->pgdir, (char*)a) != 0)
+      break;
+    if(loadpage(p, s, a, i > 0 || !write) < 0)
+      break;
+  }
+  iunlock(p->exe);
+  return i > 0 ? 0 : -1;
+}
+
+// Before the kernel touches [va, va+n) directly, read in any
+// of its pages not yet loaded from the executable and, if the
+// kernel will write, copy any shared ones: the kernel does not
+// handle page faults on itself.  Returns 0, or -1.
+int
+pagein(uint va, uint n, int write)
+{
+  struct proc *p = myproc();
+  uint a;
+  int r;
+
+  if(p->exe == 0 || n == 0)
+    return 0;
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    if(findseg(p, a) == 0)
+      continue;
+    if(uva2ka(p->pgdir, (char*)a) == 0){
+      if(pagefault(a, write) < 0)
+        return -1;
+    } else if(write && (r = cowpage(p->pgdir, a)) != 0){
+      if(r < 0)
+        return -1;
+      lcr3(V2P(p->pgdir));
+    }
+  }
+  return 0;
+}
+
+// Last element of path, as a process name for debugging.
+static char*
+basename(char *path)
+{
+  char *s, *last;
+
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  return last;
+}
+
+int
+exec(char *path, char **argv)
+{
+  struct image img;
+  struct inode *oldexe;
+  pde_t *oldpgdir;
+  struct proc *curproc = myproc();
+
+  if(load(path, argv, &img) < 0)
+    return -1;
+
+  // Save program name for debugging.
+  safestrcpy(curproc->name, basename(path), sizeof(curproc->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  oldpgdir = swappgdir(img.pgdir);  // 0 if threads still use it
+  oldexe = curproc->exe;
+  curproc->exe = img.exe;
+  memmove(curproc->seg, img.seg, sizeof(img.seg));
+  curproc->sz = img.sz;
+  curproc->tf->eip = img.entry;
+  curproc->tf->esp = img.sp;
+  fpuinit(curproc->fx);
+  fpurestore(curproc->fx);
   switchuvm(curproc);
-  freevm(oldpgdir);
-  return 0;
-
- bad:
-  if(pgdir)
-    freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
+  if(oldpgdir)
+    freevm(oldpgdir);
+  if(oldexe){
+    begin_op();
+    iput(oldexe);
     end_op();
   }
-  return -1;
+  return 0;
+}
+
+// Run the program at path in a new child process, as fork()
+// followed by exec() in the child would, but without copying
+// this process's memory only to discard it.  The child's open
+// files are copies of ofile[], so that the caller can arrange
+// them without changing its own.
+// Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, struct file **ofile)
+{
+  struct image img;
+  int pid;
+
+  if(load(path, argv, &img) < 0)
+    return -1;
+  if((pid = spawnproc(&img, basename(path), ofile)) < 0)
+    freeimage(&img);
+  return pid;
 }
@@ -14,8 +14,12 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int ntext;          // Pages in the text cache (text.c); text.lock
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  uint ranext;        // readi: next block if reading sequentially
+  uint raend;         // readi: blocks before this are read ahead
+  uint rawin;         // readi: read-ahead window, in blocks
 
   short type;         // copy of disk inode
   short major;
@@ -14,6 +14,7 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -154,17 +155,19 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
+// The icache.lock reader-writer lock protects the allocation of
+// icache entries. Since ip->ref indicates whether an entry is free,
 // and ip->dev and ip->inum indicate which i-node an entry
 // holds, one must hold icache.lock while using any of those fields.
+// Only recycling an entry needs it for writing; lookups that hit,
+// idup and iput hold it for reading and change ip->ref atomically.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
 struct {
-  struct spinlock lock;
+  struct rwlock lock;
   struct inode inode[NINODE];
 } icache;
 
@@ -173,7 +176,7 @@ iinit(int dev)
 {
   int i = 0;
   
-  initlock(&icache.lock, "icache");
+  initrwlock(&icache.lock, "icache");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
@@ -243,14 +246,25 @@ iget(uint dev, uint inum)
 {
   struct inode *ip, *empty;
 
-  acquire(&icache.lock);
-
   // Is the inode already cached?
+  acquireread(&icache.lock);
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+      xadd((uint*)&ip->ref, 1);
+      releaseread(&icache.lock);
+      return ip;
+    }
+  }
+  releaseread(&icache.lock);
+
+  // Look again with the lock held for writing, since another
+  // cpu may have cached it meanwhile.
+  acquirewrite(&icache.lock);
   empty = 0;
   for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
       ip->ref++;
-      release(&icache.lock);
+      releasewrite(&icache.lock);
       return ip;
     }
     if(empty == 0 && ip->ref == 0)    // Remember empty slot.
@@ -262,11 +276,14 @@ iget(uint dev, uint inum)
     panic("iget: no inodes");
 
   ip = empty;
+  if(ip->ntext)
+    textforget(ip);
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  ip->ranext = ip->raend = ip->rawin = 0;
+  releasewrite(&icache.lock);
 
   return ip;
 }
@@ -276,9 +293,9 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  acquireread(&icache.lock);
+  xadd((uint*)&ip->ref, 1);
+  releaseread(&icache.lock);
   return ip;
 }
 
@@ -333,9 +350,9 @@ iput(struct inode *ip)
 {
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
+    acquireread(&icache.lock);
     int r = ip->ref;
-    release(&icache.lock);
+    releaseread(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
@@ -346,9 +363,9 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  acquireread(&icache.lock);
+  xadd((uint*)&ip->ref, -1);
+  releaseread(&icache.lock);
 }
 
 // Common idiom: unlock, then put.
@@ -411,6 +428,8 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(ip->ntext)
+    textforget(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -446,6 +465,41 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Read-ahead.  While readi moves through ip block by block, keep
+// the disk busy with the blocks after the one just read.  The
+// window starts at RAMIN blocks and doubles, up to RAMAX, each
+// time the reader gets halfway through what was read ahead.  A
+// seek turns it off until the reader is sequential again.
+// Caller holds ip->lock.
+#define RAMIN 4
+#define RAMAX 32
+
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint b, end, nblocks;
+
+  if(bn + 1 == ip->ranext)  // more of the same block
+    return;
+  if(bn != ip->ranext){
+    ip->ranext = bn + 1;
+    ip->rawin = 0;
+    ip->raend = bn + 1;
+    return;
+  }
+  ip->ranext = bn + 1;
+  if(ip->raend > bn + 1 + ip->rawin/2)
+    return;
+
+  ip->rawin = ip->rawin ? min(2*ip->rawin, RAMAX) : RAMIN;
+  nblocks = (ip->size + BSIZE - 1) / BSIZE;
+  end = min(bn + 1 + ip->rawin, nblocks);
+  for(b = ip->raend > bn ? ip->raend : bn + 1; b < end; b++)
+    breada(ip->dev, bmap(ip, b));
+  if(end > ip->raend)
+    ip->raend = end;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -471,6 +525,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
+    readahead(ip, off/BSIZE);
   }
   return n;
 }
@@ -494,6 +549,8 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->ntext)
+    textforget(ip);
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -0,0 +1,74 @@
+// Futexes: wait and wake on a word of user memory, so that
+// user-space locks enter the kernel only under contention.
+// A waiter sleeps on the kernel address of the word, which is
+// the same for every thread sharing the page table (see clone).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+// Held from checking the word to sleeping, and while waking,
+// so that a wake between the two cannot be lost.
+static struct spinlock futexlock;
+
+void
+futexinit(void)
+{
+  initlock(&futexlock, "futex");
+}
+
+// Kernel address of the user word at uva, or 0 if it is
+// misaligned or not mapped.
+static uint*
+futexword(uint uva)
+{
+  struct proc *curproc = myproc();
+  char *ka;
+
+  if(uva % 4 != 0 || uva >= curproc->sz)
+    return 0;
+  if(pagein(uva, 4, 1) < 0)  // keep futex words in private pages
+    return 0;
+  if((ka = uva2ka(curproc->pgdir, (char*)uva)) == 0)
+    return 0;
+  return (uint*)(ka + (uva & (PGSIZE-1)));
+}
+
+// If the word at uva still holds val, sleep until a futexwake
+// on it.  Returns 0 once woken, or -1 if the word had already
+// changed or the process was killed.
+int
+futexwait(uint uva, uint val)
+{
+  uint *w;
+
+  if((w = futexword(uva)) == 0)
+    return -1;
+  acquire(&futexlock);
+  if(*w != val || myproc()->killed){
+    release(&futexlock);
+    return -1;
+  }
+  sleep(w, &futexlock);
+  release(&futexlock);
+  return 0;
+}
+
+// Wake up to n waiters on the word at uva.
+// Returns how many were woken, or -1.
+int
+futexwake(uint uva, int n)
+{
+  uint *w;
+
+  if((w = futexword(uva)) == 0)
+    return -1;
+  acquire(&futexlock);
+  n = wakeupn(w, n);
+  release(&futexlock);
+  return n;
+}
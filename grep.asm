@@ -0,0 +1,2187 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 76 06 00 00       	call   6d0 <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 7a 06 00 00       	call   6e8 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 00 0f 00 00       	push   $0xf00
+  7f:	6a 01                	push   $0x1
+  81:	e8 2a 08 00 00       	call   8b0 <printf>
+      exit();
+  86:	e8 1d 06 00 00       	call   6a8 <exit>
+  }
+  exit();
+  8b:	e8 18 06 00 00       	call   6a8 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 e0 0e 00 00       	push   $0xee0
+  97:	6a 02                	push   $0x2
+  99:	e8 12 08 00 00       	call   8b0 <printf>
+    exit();
+  9e:	e8 05 06 00 00       	call   6a8 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 f6 05 00 00       	call   6a8 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 20 14 00 00    	lea    0x1420(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 93 04 00 00       	call   6c0 <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 20 14 00 00       	mov    $0x1420,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 20 14 00 00 00 	movb   $0x0,0x1420(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 11 04 00 00       	call   6c8 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 20 14 00 00    	cmp    $0x1420,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 20 14 00 00       	sub    $0x1420,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 20 14 00 00       	push   $0x1420
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 e3 01 00 00       	call   6c0 <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 b6 01 00 00       	call   6e8 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 b9 01 00 00       	call   700 <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 7f 01 00 00       	call   6d0 <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	31 d2                	xor    %edx,%edx
+ 5e3:	89 e5                	mov    %esp,%ebp
+ 5e5:	53                   	push   %ebx
+ 5e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 5e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 5ec:	f7 f3                	div    %ebx
+ 5ee:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 5f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 5f8:	89 ca                	mov    %ecx,%edx
+}
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 600:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 602:	c3                   	ret
+ 603:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000610 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 619:	8b 35 20 18 00 00    	mov    0x1820,%esi
+{
+ 61f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 622:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 625:	85 f6                	test   %esi,%esi
+ 627:	74 2f                	je     658 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 629:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 62e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 634:	f7 e3                	mul    %ebx
+ 636:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 639:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 63c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	f7 f6                	div    %esi
+ 643:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 645:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 648:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 64b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 64d:	89 da                	mov    %ebx,%edx
+}
+ 64f:	5b                   	pop    %ebx
+ 650:	5e                   	pop    %esi
+ 651:	5f                   	pop    %edi
+ 652:	5d                   	pop    %ebp
+ 653:	c3                   	ret
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 658:	e8 0b 01 00 00       	call   768 <tscfreq>
+ 65d:	a3 20 18 00 00       	mov    %eax,0x1820
+ 662:	89 c6                	mov    %eax,%esi
+ 664:	eb c3                	jmp    629 <cyc2ns+0x19>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000670 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	53                   	push   %ebx
+ 674:	83 ec 10             	sub    $0x10,%esp
+ 677:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 67a:	6a 00                	push   $0x0
+ 67c:	e8 3f 01 00 00       	call   7c0 <getpriority>
+ 681:	5a                   	pop    %edx
+ 682:	59                   	pop    %ecx
+ 683:	01 d8                	add    %ebx,%eax
+ 685:	50                   	push   %eax
+ 686:	6a 00                	push   $0x0
+ 688:	e8 2b 01 00 00       	call   7b8 <setpriority>
+  return getpriority(0);
+ 68d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 694:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 697:	83 c4 10             	add    $0x10,%esp
+}
+ 69a:	c9                   	leave
+  return getpriority(0);
+ 69b:	e9 20 01 00 00       	jmp    7c0 <getpriority>
+
+000006a0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6a0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <exit>:
+SYSCALL(exit)
+ 6a8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <wait>:
+SYSCALL(wait)
+ 6b0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <pipe>:
+SYSCALL(pipe)
+ 6b8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <read>:
+SYSCALL(read)
+ 6c0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <write>:
+SYSCALL(write)
+ 6c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <close>:
+SYSCALL(close)
+ 6d0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <kill>:
+SYSCALL(kill)
+ 6d8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <exec>:
+SYSCALL(exec)
+ 6e0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <open>:
+SYSCALL(open)
+ 6e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <mknod>:
+SYSCALL(mknod)
+ 6f0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <unlink>:
+SYSCALL(unlink)
+ 6f8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <fstat>:
+SYSCALL(fstat)
+ 700:	b8 08 00 00 00       	mov    $0x8,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <link>:
+SYSCALL(link)
+ 708:	b8 13 00 00 00       	mov    $0x13,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <mkdir>:
+SYSCALL(mkdir)
+ 710:	b8 14 00 00 00       	mov    $0x14,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <chdir>:
+SYSCALL(chdir)
+ 718:	b8 09 00 00 00       	mov    $0x9,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <dup>:
+SYSCALL(dup)
+ 720:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <getpid>:
+SYSCALL(getpid)
+ 728:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <sbrk>:
+SYSCALL(sbrk)
+ 730:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <sleep>:
+SYSCALL(sleep)
+ 738:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <uptime>:
+SYSCALL(uptime)
+ 740:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <promote>:
+
+SYSCALL(promote)
+ 748:	b8 18 00 00 00       	mov    $0x18,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <demote>:
+SYSCALL(demote)
+ 750:	b8 19 00 00 00       	mov    $0x19,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 758:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 760:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <tscfreq>:
+SYSCALL(tscfreq)
+ 768:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <tracemask>:
+SYSCALL(tracemask)
+ 770:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <traceread>:
+SYSCALL(traceread)
+ 778:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <profile>:
+SYSCALL(profile)
+ 780:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <profread>:
+SYSCALL(profread)
+ 788:	b8 20 00 00 00       	mov    $0x20,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <lockstat>:
+SYSCALL(lockstat)
+ 790:	b8 21 00 00 00       	mov    $0x21,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+
+00000798 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 798:	b8 22 00 00 00       	mov    $0x22,%eax
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <sysstat>:
+SYSCALL(sysstat)
+ 7a0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+
+000007a8 <kbench>:
+SYSCALL(kbench)
+ 7a8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7ad:	cd 40                	int    $0x40
+ 7af:	c3                   	ret
+
+000007b0 <yield>:
+SYSCALL(yield)
+ 7b0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7b5:	cd 40                	int    $0x40
+ 7b7:	c3                   	ret
+
+000007b8 <setpriority>:
+SYSCALL(setpriority)
+ 7b8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7bd:	cd 40                	int    $0x40
+ 7bf:	c3                   	ret
+
+000007c0 <getpriority>:
+SYSCALL(getpriority)
+ 7c0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7c5:	cd 40                	int    $0x40
+ 7c7:	c3                   	ret
+
+000007c8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 7c8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7cd:	cd 40                	int    $0x40
+ 7cf:	c3                   	ret
+
+000007d0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 7d0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7d5:	cd 40                	int    $0x40
+ 7d7:	c3                   	ret
+
+000007d8 <clone>:
+SYSCALL(clone)
+ 7d8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7dd:	cd 40                	int    $0x40
+ 7df:	c3                   	ret
+
+000007e0 <join>:
+SYSCALL(join)
+ 7e0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7e5:	cd 40                	int    $0x40
+ 7e7:	c3                   	ret
+
+000007e8 <futex_wait>:
+SYSCALL(futex_wait)
+ 7e8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7ed:	cd 40                	int    $0x40
+ 7ef:	c3                   	ret
+
+000007f0 <futex_wake>:
+SYSCALL(futex_wake)
+ 7f0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7f5:	cd 40                	int    $0x40
+ 7f7:	c3                   	ret
+
+000007f8 <spawn>:
+SYSCALL(spawn)
+ 7f8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7fd:	cd 40                	int    $0x40
+ 7ff:	c3                   	ret
+
+00000800 <diskstat>:
+SYSCALL(diskstat)
+ 800:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 805:	cd 40                	int    $0x40
+ 807:	c3                   	ret
+ 808:	66 90                	xchg   %ax,%ax
+ 80a:	66 90                	xchg   %ax,%ax
+ 80c:	66 90                	xchg   %ax,%ax
+ 80e:	66 90                	xchg   %ax,%ax
+
+00000810 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 818:	89 d1                	mov    %edx,%ecx
+{
+ 81a:	83 ec 3c             	sub    $0x3c,%esp
+ 81d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 820:	85 d2                	test   %edx,%edx
+ 822:	0f 89 80 00 00 00    	jns    8a8 <printint+0x98>
+ 828:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 82c:	74 7a                	je     8a8 <printint+0x98>
+    x = -xx;
+ 82e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 830:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 835:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 838:	31 f6                	xor    %esi,%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 840:	89 c8                	mov    %ecx,%eax
+ 842:	31 d2                	xor    %edx,%edx
+ 844:	89 f7                	mov    %esi,%edi
+ 846:	f7 f3                	div    %ebx
+ 848:	8d 76 01             	lea    0x1(%esi),%esi
+ 84b:	0f b6 92 78 0f 00 00 	movzbl 0xf78(%edx),%edx
+ 852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 856:	89 ca                	mov    %ecx,%edx
+ 858:	89 c1                	mov    %eax,%ecx
+ 85a:	39 da                	cmp    %ebx,%edx
+ 85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+ 85e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 861:	85 c0                	test   %eax,%eax
+ 863:	74 07                	je     86c <printint+0x5c>
+    buf[i++] = '-';
+ 865:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 86a:	89 f7                	mov    %esi,%edi
+ 86c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 86f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 872:	01 df                	add    %ebx,%edi
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 878:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 881:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 884:	6a 01                	push   $0x1
+ 886:	50                   	push   %eax
+ 887:	56                   	push   %esi
+ 888:	e8 3b fe ff ff       	call   6c8 <write>
+  while(--i >= 0)
+ 88d:	89 f8                	mov    %edi,%eax
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	83 ef 01             	sub    $0x1,%edi
+ 895:	39 d8                	cmp    %ebx,%eax
+ 897:	75 df                	jne    878 <printint+0x68>
+}
+ 899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89c:	5b                   	pop    %ebx
+ 89d:	5e                   	pop    %esi
+ 89e:	5f                   	pop    %edi
+ 89f:	5d                   	pop    %ebp
+ 8a0:	c3                   	ret
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8a8:	31 c0                	xor    %eax,%eax
+ 8aa:	eb 89                	jmp    835 <printint+0x25>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c2:	83 c6 01             	add    $0x1,%esi
+ 8c5:	84 db                	test   %bl,%bl
+ 8c7:	74 67                	je     930 <printf+0x80>
+ 8c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8cc:	31 d2                	xor    %edx,%edx
+ 8ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8d1:	eb 34                	jmp    907 <printf+0x57>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8e0:	83 f8 25             	cmp    $0x25,%eax
+ 8e3:	74 18                	je     8fd <printf+0x4d>
+  write(fd, &c, 1);
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ee:	6a 01                	push   $0x1
+ 8f0:	50                   	push   %eax
+ 8f1:	57                   	push   %edi
+ 8f2:	e8 d1 fd ff ff       	call   6c8 <write>
+ 8f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 900:	83 c6 01             	add    $0x1,%esi
+ 903:	84 db                	test   %bl,%bl
+ 905:	74 29                	je     930 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 907:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 90a:	85 d2                	test   %edx,%edx
+ 90c:	74 ca                	je     8d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 90e:	83 fa 25             	cmp    $0x25,%edx
+ 911:	75 ea                	jne    8fd <printf+0x4d>
+      if(c == 'd'){
+ 913:	83 f8 25             	cmp    $0x25,%eax
+ 916:	0f 84 24 01 00 00    	je     a40 <printf+0x190>
+ 91c:	83 e8 63             	sub    $0x63,%eax
+ 91f:	83 f8 15             	cmp    $0x15,%eax
+ 922:	77 1c                	ja     940 <printf+0x90>
+ 924:	ff 24 85 20 0f 00 00 	jmp    *0xf20(,%eax,4)
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 933:	5b                   	pop    %ebx
+ 934:	5e                   	pop    %esi
+ 935:	5f                   	pop    %edi
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 946:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 94a:	6a 01                	push   $0x1
+ 94c:	52                   	push   %edx
+ 94d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 950:	57                   	push   %edi
+ 951:	e8 72 fd ff ff       	call   6c8 <write>
+ 956:	83 c4 0c             	add    $0xc,%esp
+ 959:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95c:	6a 01                	push   $0x1
+ 95e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 961:	52                   	push   %edx
+ 962:	57                   	push   %edi
+ 963:	e8 60 fd ff ff       	call   6c8 <write>
+        putc(fd, c);
+ 968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96b:	31 d2                	xor    %edx,%edx
+ 96d:	eb 8e                	jmp    8fd <printf+0x4d>
+ 96f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 00                	push   $0x0
+ 97f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 981:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 984:	e8 87 fe ff ff       	call   810 <printint>
+        ap++;
+ 989:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 67 ff ff ff       	jmp    8fd <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9ab:	85 db                	test   %ebx,%ebx
+ 9ad:	0f 84 9d 00 00 00    	je     a50 <printf+0x1a0>
+        while(*s != 0){
+ 9b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	0f 84 3d ff ff ff    	je     8fd <printf+0x4d>
+ 9c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	89 d3                	mov    %edx,%ebx
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9d9:	6a 01                	push   $0x1
+ 9db:	53                   	push   %ebx
+ 9dc:	57                   	push   %edi
+ 9dd:	e8 e6 fc ff ff       	call   6c8 <write>
+        while(*s != 0){
+ 9e2:	0f b6 06             	movzbl (%esi),%eax
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	75 e4                	jne    9d0 <printf+0x120>
+      state = 0;
+ 9ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 07 ff ff ff       	jmp    8fd <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	e9 6b ff ff ff       	jmp    97f <printf+0xcf>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	52                   	push   %edx
+ a2c:	57                   	push   %edi
+ a2d:	e8 96 fc ff ff       	call   6c8 <write>
+        ap++;
+ a32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a38:	31 d2                	xor    %edx,%edx
+ a3a:	e9 be fe ff ff       	jmp    8fd <printf+0x4d>
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a49:	6a 01                	push   $0x1
+ a4b:	e9 11 ff ff ff       	jmp    961 <printf+0xb1>
+ a50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a55:	bb 16 0f 00 00       	mov    $0xf16,%ebx
+ a5a:	e9 61 ff ff ff       	jmp    9c0 <printf+0x110>
+ a5f:	90                   	nop
+
+00000a60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	a1 24 18 00 00       	mov    0x1824,%eax
+{
+ a66:	89 e5                	mov    %esp,%ebp
+ a68:	57                   	push   %edi
+ a69:	56                   	push   %esi
+ a6a:	53                   	push   %ebx
+ a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7c:	39 ca                	cmp    %ecx,%edx
+ a7e:	73 30                	jae    ab0 <free+0x50>
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 04                	jb     a88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a84:	39 c2                	cmp    %eax,%edx
+ a86:	72 f0                	jb     a78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a8e:	39 f8                	cmp    %edi,%eax
+ a90:	74 2e                	je     ac0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a95:	8b 42 04             	mov    0x4(%edx),%eax
+ a98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a9b:	39 f1                	cmp    %esi,%ecx
+ a9d:	74 38                	je     ad7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ aa1:	5b                   	pop    %ebx
+  freep = p;
+ aa2:	89 15 24 18 00 00    	mov    %edx,0x1824
+}
+ aa8:	5e                   	pop    %esi
+ aa9:	5f                   	pop    %edi
+ aaa:	5d                   	pop    %ebp
+ aab:	c3                   	ret
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab0:	39 c1                	cmp    %eax,%ecx
+ ab2:	72 d0                	jb     a84 <free+0x24>
+ ab4:	eb c2                	jmp    a78 <free+0x18>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ac0:	03 70 04             	add    0x4(%eax),%esi
+ ac3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ac6:	8b 02                	mov    (%edx),%eax
+ ac8:	8b 00                	mov    (%eax),%eax
+ aca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ acd:	8b 42 04             	mov    0x4(%edx),%eax
+ ad0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ad3:	39 f1                	cmp    %esi,%ecx
+ ad5:	75 c8                	jne    a9f <free+0x3f>
+    p->s.size += bp->s.size;
+ ad7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ ada:	89 15 24 18 00 00    	mov    %edx,0x1824
+    p->s.size += bp->s.size;
+ ae0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ae3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ae6:	89 0a                	mov    %ecx,(%edx)
+}
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ afc:	8b 15 24 18 00 00    	mov    0x1824,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b02:	8d 78 07             	lea    0x7(%eax),%edi
+ b05:	c1 ef 03             	shr    $0x3,%edi
+ b08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b0b:	85 d2                	test   %edx,%edx
+ b0d:	0f 84 8d 00 00 00    	je     ba0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b15:	8b 48 04             	mov    0x4(%eax),%ecx
+ b18:	39 f9                	cmp    %edi,%ecx
+ b1a:	73 64                	jae    b80 <malloc+0x90>
+  if(nu < 4096)
+ b1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b21:	39 df                	cmp    %ebx,%edi
+ b23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b2d:	eb 0a                	jmp    b39 <malloc+0x49>
+ b2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b32:	8b 48 04             	mov    0x4(%eax),%ecx
+ b35:	39 f9                	cmp    %edi,%ecx
+ b37:	73 47                	jae    b80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b39:	89 c2                	mov    %eax,%edx
+ b3b:	39 05 24 18 00 00    	cmp    %eax,0x1824
+ b41:	75 ed                	jne    b30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	56                   	push   %esi
+ b47:	e8 e4 fb ff ff       	call   730 <sbrk>
+  if(p == (char*)-1)
+ b4c:	83 c4 10             	add    $0x10,%esp
+ b4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b52:	74 1c                	je     b70 <malloc+0x80>
+  hp->s.size = nu;
+ b54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b57:	83 ec 0c             	sub    $0xc,%esp
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	50                   	push   %eax
+ b5e:	e8 fd fe ff ff       	call   a60 <free>
+  return freep;
+ b63:	8b 15 24 18 00 00    	mov    0x1824,%edx
+      if((p = morecore(nunits)) == 0)
+ b69:	83 c4 10             	add    $0x10,%esp
+ b6c:	85 d2                	test   %edx,%edx
+ b6e:	75 c0                	jne    b30 <malloc+0x40>
+        return 0;
+  }
+}
+ b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b73:	31 c0                	xor    %eax,%eax
+}
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5f                   	pop    %edi
+ b78:	5d                   	pop    %ebp
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b80:	39 cf                	cmp    %ecx,%edi
+ b82:	74 4c                	je     bd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b84:	29 f9                	sub    %edi,%ecx
+ b86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b8f:	89 15 24 18 00 00    	mov    %edx,0x1824
+}
+ b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b98:	83 c0 08             	add    $0x8,%eax
+}
+ b9b:	5b                   	pop    %ebx
+ b9c:	5e                   	pop    %esi
+ b9d:	5f                   	pop    %edi
+ b9e:	5d                   	pop    %ebp
+ b9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ba0:	c7 05 24 18 00 00 28 	movl   $0x1828,0x1824
+ ba7:	18 00 00 
+    base.s.size = 0;
+ baa:	b8 28 18 00 00       	mov    $0x1828,%eax
+    base.s.ptr = freep = prevp = &base;
+ baf:	c7 05 28 18 00 00 28 	movl   $0x1828,0x1828
+ bb6:	18 00 00 
+    base.s.size = 0;
+ bb9:	c7 05 2c 18 00 00 00 	movl   $0x0,0x182c
+ bc0:	00 00 00 
+    if(p->s.size >= nunits){
+ bc3:	e9 54 ff ff ff       	jmp    b1c <malloc+0x2c>
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bd0:	8b 08                	mov    (%eax),%ecx
+ bd2:	89 0a                	mov    %ecx,(%edx)
+ bd4:	eb b9                	jmp    b8f <malloc+0x9f>
+ bd6:	66 90                	xchg   %ax,%ax
+ bd8:	66 90                	xchg   %ax,%ax
+ bda:	66 90                	xchg   %ax,%ax
+ bdc:	66 90                	xchg   %ax,%ax
+ bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 20             	sub    $0x20,%esp
+ be9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ bec:	8b 7d 10             	mov    0x10(%ebp),%edi
+ bef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ bf2:	68 e8 03 00 00       	push   $0x3e8
+ bf7:	57                   	push   %edi
+ bf8:	56                   	push   %esi
+ bf9:	e8 e2 f9 ff ff       	call   5e0 <udiv64>
+ bfe:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ c00:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ c03:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ c09:	29 c1                	sub    %eax,%ecx
+ c0b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ c0e:	68 e8 03 00 00       	push   $0x3e8
+ c13:	57                   	push   %edi
+ c14:	56                   	push   %esi
+ c15:	e8 c6 f9 ff ff       	call   5e0 <udiv64>
+ c1a:	83 c4 0c             	add    $0xc,%esp
+ c1d:	50                   	push   %eax
+ c1e:	68 89 0f 00 00       	push   $0xf89
+ c23:	53                   	push   %ebx
+ c24:	e8 87 fc ff ff       	call   8b0 <printf>
+  if(frac < 100)
+ c29:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c2c:	83 c4 10             	add    $0x10,%esp
+ c2f:	83 f9 63             	cmp    $0x63,%ecx
+ c32:	76 1c                	jbe    c50 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ c34:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ c37:	c7 45 0c 8f 0f 00 00 	movl   $0xf8f,0xc(%ebp)
+ c3e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c44:	5b                   	pop    %ebx
+ c45:	5e                   	pop    %esi
+ c46:	5f                   	pop    %edi
+ c47:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ c48:	e9 63 fc ff ff       	jmp    8b0 <printf>
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ c50:	83 ec 08             	sub    $0x8,%esp
+ c53:	68 8d 0f 00 00       	push   $0xf8d
+ c58:	53                   	push   %ebx
+ c59:	e8 52 fc ff ff       	call   8b0 <printf>
+  if(frac < 10)
+ c5e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c61:	83 c4 10             	add    $0x10,%esp
+ c64:	83 f9 09             	cmp    $0x9,%ecx
+ c67:	77 cb                	ja     c34 <printps+0x54>
+    printf(fd, "0");
+ c69:	83 ec 08             	sub    $0x8,%esp
+ c6c:	68 8d 0f 00 00       	push   $0xf8d
+ c71:	53                   	push   %ebx
+ c72:	e8 39 fc ff ff       	call   8b0 <printf>
+ c77:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c7a:	83 c4 10             	add    $0x10,%esp
+ c7d:	eb b5                	jmp    c34 <printps+0x54>
+ c7f:	90                   	nop
+
+00000c80 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	57                   	push   %edi
+ c84:	56                   	push   %esi
+ c85:	53                   	push   %ebx
+ c86:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c8c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ c8f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c92:	83 e8 01             	sub    $0x1,%eax
+ c95:	3d ff 00 00 00       	cmp    $0xff,%eax
+ c9a:	0f 87 37 02 00 00    	ja     ed7 <bench+0x257>
+ ca0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ ca3:	85 ff                	test   %edi,%edi
+ ca5:	0f 84 2c 02 00 00    	je     ed7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ cab:	83 ec 0c             	sub    $0xc,%esp
+ cae:	ff 75 10             	push   0x10(%ebp)
+ cb1:	ff 55 0c             	call   *0xc(%ebp)
+ cb4:	5b                   	pop    %ebx
+ cb5:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ cb8:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ cba:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ cbd:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ cc0:	83 c4 10             	add    $0x10,%esp
+ cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cc7:	90                   	nop
+    t0 = cycles();
+ cc8:	e8 33 f9 ff ff       	call   600 <cycles>
+    fn(arg);
+ ccd:	83 ec 0c             	sub    $0xc,%esp
+ cd0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ cd3:	89 c6                	mov    %eax,%esi
+ cd5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ cd7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ cda:	e8 21 f9 ff ff       	call   600 <cycles>
+ cdf:	29 f0                	sub    %esi,%eax
+ ce1:	19 fa                	sbb    %edi,%edx
+ ce3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ cea:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ ced:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ cf4:	83 c3 01             	add    $0x1,%ebx
+ cf7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ cfa:	7f cc                	jg     cc8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ cfc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ d00:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ d03:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ d09:	bf 01 00 00 00       	mov    $0x1,%edi
+ d0e:	74 77                	je     d87 <bench+0x107>
+ d10:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d17:	90                   	nop
+    v = a[i];
+ d18:	8b 01                	mov    (%ecx),%eax
+ d1a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ d1d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ d23:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ d29:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ d2f:	89 c8                	mov    %ecx,%eax
+ d31:	eb 1b                	jmp    d4e <bench+0xce>
+ d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d37:	90                   	nop
+      a[j] = a[j-1];
+ d38:	89 08                	mov    %ecx,(%eax)
+ d3a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ d3d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ d40:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d46:	39 c3                	cmp    %eax,%ebx
+ d48:	0f 84 72 01 00 00    	je     ec0 <bench+0x240>
+ d4e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ d51:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ d54:	89 f7                	mov    %esi,%edi
+ d56:	89 c3                	mov    %eax,%ebx
+ d58:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ d5e:	19 d7                	sbb    %edx,%edi
+ d60:	72 d6                	jb     d38 <bench+0xb8>
+ d62:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d68:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ d6e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ d74:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ d77:	83 c7 01             	add    $0x1,%edi
+ d7a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ d7d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ d7f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ d82:	75 94                	jne    d18 <bench+0x98>
+ d84:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d87:	83 ec 08             	sub    $0x8,%esp
+ d8a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ d90:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ d95:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ d9b:	e8 70 f8 ff ff       	call   610 <cyc2ns>
+ da0:	83 c4 0c             	add    $0xc,%esp
+ da3:	ff 75 14             	push   0x14(%ebp)
+ da6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ dac:	f7 e3                	mul    %ebx
+ dae:	01 ca                	add    %ecx,%edx
+ db0:	52                   	push   %edx
+ db1:	50                   	push   %eax
+ db2:	e8 29 f8 ff ff       	call   5e0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ db7:	89 06                	mov    %eax,(%esi)
+ db9:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ dbc:	5f                   	pop    %edi
+ dbd:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ dbe:	8b 45 18             	mov    0x18(%ebp),%eax
+ dc1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ dc3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ dca:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ dd1:	e8 3a f8 ff ff       	call   610 <cyc2ns>
+ dd6:	83 c4 0c             	add    $0xc,%esp
+ dd9:	ff 75 14             	push   0x14(%ebp)
+ ddc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ de2:	f7 e3                	mul    %ebx
+ de4:	01 ca                	add    %ecx,%edx
+ de6:	52                   	push   %edx
+ de7:	50                   	push   %eax
+ de8:	e8 f3 f7 ff ff       	call   5e0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ ded:	89 46 08             	mov    %eax,0x8(%esi)
+ df0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ df3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ df4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ df7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ df8:	8d 50 01             	lea    0x1(%eax),%edx
+ dfb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ e00:	6b d2 63             	imul   $0x63,%edx,%edx
+ e03:	f7 e2                	mul    %edx
+ e05:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e08:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ e0f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ e16:	e8 f5 f7 ff ff       	call   610 <cyc2ns>
+ e1b:	83 c4 0c             	add    $0xc,%esp
+ e1e:	ff 75 14             	push   0x14(%ebp)
+ e21:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ e27:	f7 e3                	mul    %ebx
+ e29:	01 ca                	add    %ecx,%edx
+ e2b:	52                   	push   %edx
+ e2c:	50                   	push   %eax
+ e2d:	e8 ae f7 ff ff       	call   5e0 <udiv64>
+
+  if(name){
+ e32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ e35:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ e38:	89 46 10             	mov    %eax,0x10(%esi)
+ e3b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ e3e:	85 c9                	test   %ecx,%ecx
+ e40:	74 72                	je     eb4 <bench+0x234>
+    printf(1, "%s: min ", name);
+ e42:	83 ec 04             	sub    $0x4,%esp
+ e45:	ff 75 08             	push   0x8(%ebp)
+ e48:	68 92 0f 00 00       	push   $0xf92
+ e4d:	6a 01                	push   $0x1
+ e4f:	e8 5c fa ff ff       	call   8b0 <printf>
+    printps(1, st->min);
+ e54:	83 c4 0c             	add    $0xc,%esp
+ e57:	ff 76 04             	push   0x4(%esi)
+ e5a:	ff 36                	push   (%esi)
+ e5c:	6a 01                	push   $0x1
+ e5e:	e8 7d fd ff ff       	call   be0 <printps>
+    printf(1, " median ");
+ e63:	58                   	pop    %eax
+ e64:	5a                   	pop    %edx
+ e65:	68 9b 0f 00 00       	push   $0xf9b
+ e6a:	6a 01                	push   $0x1
+ e6c:	e8 3f fa ff ff       	call   8b0 <printf>
+    printps(1, st->median);
+ e71:	83 c4 0c             	add    $0xc,%esp
+ e74:	ff 76 0c             	push   0xc(%esi)
+ e77:	ff 76 08             	push   0x8(%esi)
+ e7a:	6a 01                	push   $0x1
+ e7c:	e8 5f fd ff ff       	call   be0 <printps>
+    printf(1, " p99 ");
+ e81:	59                   	pop    %ecx
+ e82:	5b                   	pop    %ebx
+ e83:	68 a4 0f 00 00       	push   $0xfa4
+ e88:	6a 01                	push   $0x1
+ e8a:	e8 21 fa ff ff       	call   8b0 <printf>
+    printps(1, st->p99);
+ e8f:	83 c4 0c             	add    $0xc,%esp
+ e92:	ff 76 14             	push   0x14(%esi)
+ e95:	ff 76 10             	push   0x10(%esi)
+ e98:	6a 01                	push   $0x1
+ e9a:	e8 41 fd ff ff       	call   be0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ e9f:	83 c4 0c             	add    $0xc,%esp
+ ea2:	ff 75 18             	push   0x18(%ebp)
+ ea5:	68 aa 0f 00 00       	push   $0xfaa
+ eaa:	6a 01                	push   $0x1
+ eac:	e8 ff f9 ff ff       	call   8b0 <printf>
+ eb1:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ eb4:	31 c0                	xor    %eax,%eax
+}
+ eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eb9:	5b                   	pop    %ebx
+ eba:	5e                   	pop    %esi
+ ebb:	5f                   	pop    %edi
+ ebc:	5d                   	pop    %ebp
+ ebd:	c3                   	ret
+ ebe:	66 90                	xchg   %ax,%ax
+ ec0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ec6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ ecc:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ ed2:	e9 97 fe ff ff       	jmp    d6e <bench+0xee>
+    return -1;
+ ed7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ edc:	eb d8                	jmp    eb6 <bench+0x236>
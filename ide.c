@@ -12,6 +12,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "diskstat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -21,18 +22,28 @@
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
-#define IDE_CMD_RDMUL 0xc4
-#define IDE_CMD_WRMUL 0xc5
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+#define IDEMAXSECT    128  // most sectors in one transfer
+#define NIDE          2
+
+// Requests wait on idequeue in C-SCAN order: ascending block
+// number from idepos, where the last transfer ended, then
+// wrapping around to the lowest.  idestart takes the first one,
+// and any after it that continue it on the same disk in the same
+// direction, as one multi-sector transfer.  Those bufs move to
+// ideactive, and the disk interrupts once per sector.
+// You must hold idelock while manipulating the queues.
 
 static struct spinlock idelock;
-static struct buf *idequeue;
+static struct buf *idequeue;   // waiting, linked by qnext
+static struct buf *ideactive;  // being transferred, in disk order
+static uint ideoff;            // bytes of ideactive done
+static uint idepos;            // block after the last transfer
+
+static struct diskstat idestats[NIDE];
+static uint ideqlen[NIDE];     // bufs queued or active
 
 static int havedisk1;
-static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
 static int
@@ -69,75 +80,134 @@ ideinit(void)
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the transfer at the head of idequeue.
+// Caller must hold idelock.
 static void
-idestart(struct buf *b)
+idestart(void)
 {
-  if(b == 0)
+  struct buf *b, *last;
+  int n, sector, sector_per_block;
+
+  if((b = idequeue) == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  sector_per_block = BSIZE/SECTOR_SIZE;
 
-  if (sector_per_block > 7) panic("idestart");
+  // Take the bufs that continue b on the disk.
+  last = b;
+  n = sector_per_block;
+  while(last->qnext && last->qnext->dev == b->dev &&
+        last->qnext->blockno == last->blockno + 1 &&
+        (last->qnext->flags & B_DIRTY) == (b->flags & B_DIRTY) &&
+        n + sector_per_block <= IDEMAXSECT){
+    last = last->qnext;
+    n += sector_per_block;
+  }
+  if(last->blockno >= FSSIZE)
+    panic("incorrect blockno");
+  idequeue = last->qnext;
+  last->qnext = 0;
+  ideactive = b;
+  ideoff = 0;
+  idepos = last->blockno + 1;
+  idestats[b->dev & 1].nxfer++;
 
+  sector = b->blockno * sector_per_block;
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, n & 0xff);  // number of sectors; 0 means 256
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    outb(0x1f7, IDE_CMD_WRITE);
+    outsl(0x1f0, b->data, SECTOR_SIZE/4);
   } else {
-    outb(0x1f7, read_cmd);
+    outb(0x1f7, IDE_CMD_READ);
   }
 }
 
+// The transfer of b is done: count it and hand it back.
+// Caller must hold idelock.
+static void
+idedone(struct buf *b)
+{
+  struct diskstat *s;
+  uint64 dt;
+
+  s = &idestats[b->dev & 1];
+  dt = rdtsc() - b->qtime;
+  s->nreq++;
+  s->wait += dt;
+  if(dt > s->waitmax)
+    s->waitmax = dt;
+  ideqlen[b->dev & 1]--;
+
+  // Wake process waiting for this buf, or release a read-ahead.
+  b->flags |= B_VALID;
+  b->flags &= ~B_DIRTY;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
+  } else
+    wakeup(b);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
   struct buf *b;
 
-  // First queued buffer is the active request.
+  // One sector of the first active buffer is done.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = ideactive) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
-
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    insl(0x1f0, b->data + ideoff, SECTOR_SIZE/4);
+  ideoff += SECTOR_SIZE;
+  if(ideoff == BSIZE){
+    ideactive = b->qnext;
+    ideoff = 0;
+    idedone(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Feed the disk the next sector of a write, or start
+  // the next transfer.
+  if(ideactive != 0){
+    if(ideactive->flags & B_DIRTY)
+      outsl(0x1f0, ideactive->data + ideoff, SECTOR_SIZE/4);
+  } else if(idequeue != 0)
+    idestart();
 
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Does a come before b in C-SCAN order?
+static int
+before(struct buf *a, struct buf *b)
+{
+  int aup, bup;
+
+  aup = a->blockno >= idepos;
+  bup = b->blockno >= idepos;
+  if(aup != bup)
+    return aup;
+  return a->blockno < b->blockno;
+}
+
+// Put b on idequeue.  Caller must hold idelock.
+static void
+ideenqueue(struct buf *b)
 {
+  struct diskstat *s;
   struct buf **pp;
+  uint q;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -146,23 +216,74 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
+  b->qtime = rdtsc();
+  s = &idestats[b->dev & 1];
+  q = ++ideqlen[b->dev & 1];
+  s->qsum += q;
+  if(q > s->qmax)
+    s->qmax = q;
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  for(pp=&idequeue; *pp && !before(b, *pp); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+}
+
+// Copy the statistics of up to n disks into buf, which may be
+// a user address in the current page table.
+// Returns the number copied.
+int
+idestatread(struct diskstat *buf, int n)
+{
+  struct diskstat s[NIDE];
+  int i;
+
+  acquire(&idelock);
+  memmove(s, idestats, sizeof(s));
+  release(&idelock);
+  for(i = 0; i < NIDE && i < n; i++)
+    buf[i] = s[i];
+  return i;
+}
+
+//PAGEBREAK!
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If B_ASYNC is set, return at once; ideintr calls bdone.
+void
+iderw(struct buf *b)
+{
+  iderwv(&b, 1);
+}
+
+// Sync n bufs, as iderw, queueing them all before waiting so
+// that adjacent ones can go to the disk as one transfer.
+// Only a lone buf may be B_ASYNC.
+void
+iderwv(struct buf **bv, int n)
+{
+  int i, async;
+
+  acquire(&idelock);  //DOC:acquire-lock
+
+  // Once queued, b may finish and be recycled at any moment.
+  async = bv[0]->flags & B_ASYNC;
+  if(async && n != 1)
+    panic("iderwv: async");
+  for(i = 0; i < n; i++)
+    ideenqueue(bv[i]);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(ideactive == 0)
+    idestart();
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+  // Wait for requests to finish.
+  for(i = 0; i < n && !async; i++){
+    while((bv[i]->flags & (B_VALID|B_DIRTY)) != B_VALID){
+      sleep(bv[i], &idelock);
+    }
   }
 
-
   release(&idelock);
 }
@@ -0,0 +1,1815 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 30 0c 00 00       	push   $0xc30
+  19:	e8 1a 04 00 00       	call   438 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 3d 04 00 00       	call   470 <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 31 04 00 00       	call   470 <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 38 0c 00 00       	push   $0xc38
+  50:	6a 01                	push   $0x1
+  52:	e8 a9 05 00 00       	call   600 <printf>
+    pid = fork();
+  57:	e8 94 03 00 00       	call   3f0 <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 8b 03 00 00       	call   400 <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 77 0c 00 00       	push   $0xc77
+  85:	6a 01                	push   $0x1
+  87:	e8 74 05 00 00       	call   600 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 4b 0c 00 00       	push   $0xc4b
+  98:	6a 01                	push   $0x1
+  9a:	e8 61 05 00 00       	call   600 <printf>
+      exit();
+  9f:	e8 54 03 00 00       	call   3f8 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 9c 10 00 00       	push   $0x109c
+  ab:	68 5e 0c 00 00       	push   $0xc5e
+  b0:	e8 7b 03 00 00       	call   430 <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 61 0c 00 00       	push   $0xc61
+  bc:	6a 01                	push   $0x1
+  be:	e8 3d 05 00 00       	call   600 <printf>
+      exit();
+  c3:	e8 30 03 00 00       	call   3f8 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 30 0c 00 00       	push   $0xc30
+  d2:	e8 69 03 00 00       	call   440 <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 30 0c 00 00       	push   $0xc30
+  e0:	e8 53 03 00 00       	call   438 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 e3 01 00 00       	call   410 <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 b6 01 00 00       	call   438 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 b9 01 00 00       	call   450 <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 7f 01 00 00       	call   420 <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 330:	55                   	push   %ebp
+ 331:	31 d2                	xor    %edx,%edx
+ 333:	89 e5                	mov    %esp,%ebp
+ 335:	53                   	push   %ebx
+ 336:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 339:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 33c:	f7 f3                	div    %ebx
+ 33e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 340:	8b 45 08             	mov    0x8(%ebp),%eax
+ 343:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 348:	89 ca                	mov    %ecx,%edx
+}
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 350:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 352:	c3                   	ret
+ 353:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	53                   	push   %ebx
+ 366:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 369:	8b 35 a4 10 00 00    	mov    0x10a4,%esi
+{
+ 36f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 372:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 375:	85 f6                	test   %esi,%esi
+ 377:	74 2f                	je     3a8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 379:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 37e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 384:	f7 e3                	mul    %ebx
+ 386:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 389:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 38c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 38f:	31 d2                	xor    %edx,%edx
+ 391:	f7 f6                	div    %esi
+ 393:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 395:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 398:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 39b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 39d:	89 da                	mov    %ebx,%edx
+}
+ 39f:	5b                   	pop    %ebx
+ 3a0:	5e                   	pop    %esi
+ 3a1:	5f                   	pop    %edi
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	c3                   	ret
+ 3a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 3a8:	e8 0b 01 00 00       	call   4b8 <tscfreq>
+ 3ad:	a3 a4 10 00 00       	mov    %eax,0x10a4
+ 3b2:	89 c6                	mov    %eax,%esi
+ 3b4:	eb c3                	jmp    379 <cyc2ns+0x19>
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	83 ec 10             	sub    $0x10,%esp
+ 3c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 3ca:	6a 00                	push   $0x0
+ 3cc:	e8 3f 01 00 00       	call   510 <getpriority>
+ 3d1:	5a                   	pop    %edx
+ 3d2:	59                   	pop    %ecx
+ 3d3:	01 d8                	add    %ebx,%eax
+ 3d5:	50                   	push   %eax
+ 3d6:	6a 00                	push   $0x0
+ 3d8:	e8 2b 01 00 00       	call   508 <setpriority>
+  return getpriority(0);
+ 3dd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 3e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 3e7:	83 c4 10             	add    $0x10,%esp
+}
+ 3ea:	c9                   	leave
+  return getpriority(0);
+ 3eb:	e9 20 01 00 00       	jmp    510 <getpriority>
+
+000003f0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3f0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <exit>:
+SYSCALL(exit)
+ 3f8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <wait>:
+SYSCALL(wait)
+ 400:	b8 03 00 00 00       	mov    $0x3,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <pipe>:
+SYSCALL(pipe)
+ 408:	b8 04 00 00 00       	mov    $0x4,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <read>:
+SYSCALL(read)
+ 410:	b8 05 00 00 00       	mov    $0x5,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <write>:
+SYSCALL(write)
+ 418:	b8 10 00 00 00       	mov    $0x10,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <close>:
+SYSCALL(close)
+ 420:	b8 15 00 00 00       	mov    $0x15,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <kill>:
+SYSCALL(kill)
+ 428:	b8 06 00 00 00       	mov    $0x6,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <exec>:
+SYSCALL(exec)
+ 430:	b8 07 00 00 00       	mov    $0x7,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <open>:
+SYSCALL(open)
+ 438:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <mknod>:
+SYSCALL(mknod)
+ 440:	b8 11 00 00 00       	mov    $0x11,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <unlink>:
+SYSCALL(unlink)
+ 448:	b8 12 00 00 00       	mov    $0x12,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <fstat>:
+SYSCALL(fstat)
+ 450:	b8 08 00 00 00       	mov    $0x8,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <link>:
+SYSCALL(link)
+ 458:	b8 13 00 00 00       	mov    $0x13,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <mkdir>:
+SYSCALL(mkdir)
+ 460:	b8 14 00 00 00       	mov    $0x14,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <chdir>:
+SYSCALL(chdir)
+ 468:	b8 09 00 00 00       	mov    $0x9,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <dup>:
+SYSCALL(dup)
+ 470:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <getpid>:
+SYSCALL(getpid)
+ 478:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <sbrk>:
+SYSCALL(sbrk)
+ 480:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <sleep>:
+SYSCALL(sleep)
+ 488:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <uptime>:
+SYSCALL(uptime)
+ 490:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <promote>:
+
+SYSCALL(promote)
+ 498:	b8 18 00 00 00       	mov    $0x18,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <demote>:
+SYSCALL(demote)
+ 4a0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 4a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 4b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <tscfreq>:
+SYSCALL(tscfreq)
+ 4b8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <tracemask>:
+SYSCALL(tracemask)
+ 4c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <traceread>:
+SYSCALL(traceread)
+ 4c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <profile>:
+SYSCALL(profile)
+ 4d0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <profread>:
+SYSCALL(profread)
+ 4d8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <lockstat>:
+SYSCALL(lockstat)
+ 4e0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 4e8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <sysstat>:
+SYSCALL(sysstat)
+ 4f0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <kbench>:
+SYSCALL(kbench)
+ 4f8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <yield>:
+SYSCALL(yield)
+ 500:	b8 25 00 00 00       	mov    $0x25,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <setpriority>:
+SYSCALL(setpriority)
+ 508:	b8 26 00 00 00       	mov    $0x26,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <getpriority>:
+SYSCALL(getpriority)
+ 510:	b8 27 00 00 00       	mov    $0x27,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 518:	b8 28 00 00 00       	mov    $0x28,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 520:	b8 29 00 00 00       	mov    $0x29,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <clone>:
+SYSCALL(clone)
+ 528:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <join>:
+SYSCALL(join)
+ 530:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <futex_wait>:
+SYSCALL(futex_wait)
+ 538:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <futex_wake>:
+SYSCALL(futex_wake)
+ 540:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <spawn>:
+SYSCALL(spawn)
+ 548:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <diskstat>:
+SYSCALL(diskstat)
+ 550:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+ 558:	66 90                	xchg   %ax,%ax
+ 55a:	66 90                	xchg   %ax,%ax
+ 55c:	66 90                	xchg   %ax,%ax
+ 55e:	66 90                	xchg   %ax,%ax
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 568:	89 d1                	mov    %edx,%ecx
+{
+ 56a:	83 ec 3c             	sub    $0x3c,%esp
+ 56d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 570:	85 d2                	test   %edx,%edx
+ 572:	0f 89 80 00 00 00    	jns    5f8 <printint+0x98>
+ 578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 57c:	74 7a                	je     5f8 <printint+0x98>
+    x = -xx;
+ 57e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 588:	31 f6                	xor    %esi,%esi
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 590:	89 c8                	mov    %ecx,%eax
+ 592:	31 d2                	xor    %edx,%edx
+ 594:	89 f7                	mov    %esi,%edi
+ 596:	f7 f3                	div    %ebx
+ 598:	8d 76 01             	lea    0x1(%esi),%esi
+ 59b:	0f b6 92 e0 0c 00 00 	movzbl 0xce0(%edx),%edx
+ 5a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5a6:	89 ca                	mov    %ecx,%edx
+ 5a8:	89 c1                	mov    %eax,%ecx
+ 5aa:	39 da                	cmp    %ebx,%edx
+ 5ac:	73 e2                	jae    590 <printint+0x30>
+  if(neg)
+ 5ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 07                	je     5bc <printint+0x5c>
+    buf[i++] = '-';
+ 5b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ba:	89 f7                	mov    %esi,%edi
+ 5bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5c2:	01 df                	add    %ebx,%edi
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	50                   	push   %eax
+ 5d7:	56                   	push   %esi
+ 5d8:	e8 3b fe ff ff       	call   418 <write>
+  while(--i >= 0)
+ 5dd:	89 f8                	mov    %edi,%eax
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	83 ef 01             	sub    $0x1,%edi
+ 5e5:	39 d8                	cmp    %ebx,%eax
+ 5e7:	75 df                	jne    5c8 <printint+0x68>
+}
+ 5e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5f8:	31 c0                	xor    %eax,%eax
+ 5fa:	eb 89                	jmp    585 <printint+0x25>
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 60c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 60f:	0f b6 1e             	movzbl (%esi),%ebx
+ 612:	83 c6 01             	add    $0x1,%esi
+ 615:	84 db                	test   %bl,%bl
+ 617:	74 67                	je     680 <printf+0x80>
+ 619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 61c:	31 d2                	xor    %edx,%edx
+ 61e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 621:	eb 34                	jmp    657 <printf+0x57>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 62b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 630:	83 f8 25             	cmp    $0x25,%eax
+ 633:	74 18                	je     64d <printf+0x4d>
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63e:	6a 01                	push   $0x1
+ 640:	50                   	push   %eax
+ 641:	57                   	push   %edi
+ 642:	e8 d1 fd ff ff       	call   418 <write>
+ 647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 64d:	0f b6 1e             	movzbl (%esi),%ebx
+ 650:	83 c6 01             	add    $0x1,%esi
+ 653:	84 db                	test   %bl,%bl
+ 655:	74 29                	je     680 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 65a:	85 d2                	test   %edx,%edx
+ 65c:	74 ca                	je     628 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 65e:	83 fa 25             	cmp    $0x25,%edx
+ 661:	75 ea                	jne    64d <printf+0x4d>
+      if(c == 'd'){
+ 663:	83 f8 25             	cmp    $0x25,%eax
+ 666:	0f 84 24 01 00 00    	je     790 <printf+0x190>
+ 66c:	83 e8 63             	sub    $0x63,%eax
+ 66f:	83 f8 15             	cmp    $0x15,%eax
+ 672:	77 1c                	ja     690 <printf+0x90>
+ 674:	ff 24 85 88 0c 00 00 	jmp    *0xc88(,%eax,4)
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 69a:	6a 01                	push   $0x1
+ 69c:	52                   	push   %edx
+ 69d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6a0:	57                   	push   %edi
+ 6a1:	e8 72 fd ff ff       	call   418 <write>
+ 6a6:	83 c4 0c             	add    $0xc,%esp
+ 6a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6b1:	52                   	push   %edx
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 60 fd ff ff       	call   418 <write>
+        putc(fd, c);
+ 6b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bb:	31 d2                	xor    %edx,%edx
+ 6bd:	eb 8e                	jmp    64d <printf+0x4d>
+ 6bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6d4:	e8 87 fe ff ff       	call   560 <printint>
+        ap++;
+ 6d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6df:	31 d2                	xor    %edx,%edx
+ 6e1:	e9 67 ff ff ff       	jmp    64d <printf+0x4d>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6f5:	83 c0 04             	add    $0x4,%eax
+ 6f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6fb:	85 db                	test   %ebx,%ebx
+ 6fd:	0f 84 9d 00 00 00    	je     7a0 <printf+0x1a0>
+        while(*s != 0){
+ 703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	0f 84 3d ff ff ff    	je     64d <printf+0x4d>
+ 710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 716:	89 de                	mov    %ebx,%esi
+ 718:	89 d3                	mov    %edx,%ebx
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	53                   	push   %ebx
+ 72c:	57                   	push   %edi
+ 72d:	e8 e6 fc ff ff       	call   418 <write>
+        while(*s != 0){
+ 732:	0f b6 06             	movzbl (%esi),%eax
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	84 c0                	test   %al,%al
+ 73a:	75 e4                	jne    720 <printf+0x120>
+      state = 0;
+ 73c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 07 ff ff ff       	jmp    64d <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 01                	push   $0x1
+ 75f:	e9 6b ff ff ff       	jmp    6cf <printf+0xcf>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	52                   	push   %edx
+ 77c:	57                   	push   %edi
+ 77d:	e8 96 fc ff ff       	call   418 <write>
+        ap++;
+ 782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 788:	31 d2                	xor    %edx,%edx
+ 78a:	e9 be fe ff ff       	jmp    64d <printf+0x4d>
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 799:	6a 01                	push   $0x1
+ 79b:	e9 11 ff ff ff       	jmp    6b1 <printf+0xb1>
+ 7a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7a5:	bb 80 0c 00 00       	mov    $0xc80,%ebx
+ 7aa:	e9 61 ff ff ff       	jmp    710 <printf+0x110>
+ 7af:	90                   	nop
+
+000007b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	a1 a8 10 00 00       	mov    0x10a8,%eax
+{
+ 7b6:	89 e5                	mov    %esp,%ebp
+ 7b8:	57                   	push   %edi
+ 7b9:	56                   	push   %esi
+ 7ba:	53                   	push   %ebx
+ 7bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7cc:	39 ca                	cmp    %ecx,%edx
+ 7ce:	73 30                	jae    800 <free+0x50>
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 04                	jb     7d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d4:	39 c2                	cmp    %eax,%edx
+ 7d6:	72 f0                	jb     7c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7de:	39 f8                	cmp    %edi,%eax
+ 7e0:	74 2e                	je     810 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7eb:	39 f1                	cmp    %esi,%ecx
+ 7ed:	74 38                	je     827 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7f1:	5b                   	pop    %ebx
+  freep = p;
+ 7f2:	89 15 a8 10 00 00    	mov    %edx,0x10a8
+}
+ 7f8:	5e                   	pop    %esi
+ 7f9:	5f                   	pop    %edi
+ 7fa:	5d                   	pop    %ebp
+ 7fb:	c3                   	ret
+ 7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 d0                	jb     7d4 <free+0x24>
+ 804:	eb c2                	jmp    7c8 <free+0x18>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 810:	03 70 04             	add    0x4(%eax),%esi
+ 813:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 816:	8b 02                	mov    (%edx),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 81d:	8b 42 04             	mov    0x4(%edx),%eax
+ 820:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 823:	39 f1                	cmp    %esi,%ecx
+ 825:	75 c8                	jne    7ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 827:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 82a:	89 15 a8 10 00 00    	mov    %edx,0x10a8
+    p->s.size += bp->s.size;
+ 830:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 833:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 836:	89 0a                	mov    %ecx,(%edx)
+}
+ 838:	5b                   	pop    %ebx
+ 839:	5e                   	pop    %esi
+ 83a:	5f                   	pop    %edi
+ 83b:	5d                   	pop    %ebp
+ 83c:	c3                   	ret
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 84c:	8b 15 a8 10 00 00    	mov    0x10a8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 852:	8d 78 07             	lea    0x7(%eax),%edi
+ 855:	c1 ef 03             	shr    $0x3,%edi
+ 858:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 85b:	85 d2                	test   %edx,%edx
+ 85d:	0f 84 8d 00 00 00    	je     8f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 863:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 865:	8b 48 04             	mov    0x4(%eax),%ecx
+ 868:	39 f9                	cmp    %edi,%ecx
+ 86a:	73 64                	jae    8d0 <malloc+0x90>
+  if(nu < 4096)
+ 86c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 871:	39 df                	cmp    %ebx,%edi
+ 873:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 876:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 87d:	eb 0a                	jmp    889 <malloc+0x49>
+ 87f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 880:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 882:	8b 48 04             	mov    0x4(%eax),%ecx
+ 885:	39 f9                	cmp    %edi,%ecx
+ 887:	73 47                	jae    8d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 889:	89 c2                	mov    %eax,%edx
+ 88b:	39 05 a8 10 00 00    	cmp    %eax,0x10a8
+ 891:	75 ed                	jne    880 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	56                   	push   %esi
+ 897:	e8 e4 fb ff ff       	call   480 <sbrk>
+  if(p == (char*)-1)
+ 89c:	83 c4 10             	add    $0x10,%esp
+ 89f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8a2:	74 1c                	je     8c0 <malloc+0x80>
+  hp->s.size = nu;
+ 8a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8a7:	83 ec 0c             	sub    $0xc,%esp
+ 8aa:	83 c0 08             	add    $0x8,%eax
+ 8ad:	50                   	push   %eax
+ 8ae:	e8 fd fe ff ff       	call   7b0 <free>
+  return freep;
+ 8b3:	8b 15 a8 10 00 00    	mov    0x10a8,%edx
+      if((p = morecore(nunits)) == 0)
+ 8b9:	83 c4 10             	add    $0x10,%esp
+ 8bc:	85 d2                	test   %edx,%edx
+ 8be:	75 c0                	jne    880 <malloc+0x40>
+        return 0;
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8c3:	31 c0                	xor    %eax,%eax
+}
+ 8c5:	5b                   	pop    %ebx
+ 8c6:	5e                   	pop    %esi
+ 8c7:	5f                   	pop    %edi
+ 8c8:	5d                   	pop    %ebp
+ 8c9:	c3                   	ret
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8d0:	39 cf                	cmp    %ecx,%edi
+ 8d2:	74 4c                	je     920 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8d4:	29 f9                	sub    %edi,%ecx
+ 8d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8df:	89 15 a8 10 00 00    	mov    %edx,0x10a8
+}
+ 8e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8e8:	83 c0 08             	add    $0x8,%eax
+}
+ 8eb:	5b                   	pop    %ebx
+ 8ec:	5e                   	pop    %esi
+ 8ed:	5f                   	pop    %edi
+ 8ee:	5d                   	pop    %ebp
+ 8ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8f0:	c7 05 a8 10 00 00 ac 	movl   $0x10ac,0x10a8
+ 8f7:	10 00 00 
+    base.s.size = 0;
+ 8fa:	b8 ac 10 00 00       	mov    $0x10ac,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ff:	c7 05 ac 10 00 00 ac 	movl   $0x10ac,0x10ac
+ 906:	10 00 00 
+    base.s.size = 0;
+ 909:	c7 05 b0 10 00 00 00 	movl   $0x0,0x10b0
+ 910:	00 00 00 
+    if(p->s.size >= nunits){
+ 913:	e9 54 ff ff ff       	jmp    86c <malloc+0x2c>
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 920:	8b 08                	mov    (%eax),%ecx
+ 922:	89 0a                	mov    %ecx,(%edx)
+ 924:	eb b9                	jmp    8df <malloc+0x9f>
+ 926:	66 90                	xchg   %ax,%ax
+ 928:	66 90                	xchg   %ax,%ax
+ 92a:	66 90                	xchg   %ax,%ax
+ 92c:	66 90                	xchg   %ax,%ax
+ 92e:	66 90                	xchg   %ax,%ax
+
+00000930 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 20             	sub    $0x20,%esp
+ 939:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 93c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 93f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 942:	68 e8 03 00 00       	push   $0x3e8
+ 947:	57                   	push   %edi
+ 948:	56                   	push   %esi
+ 949:	e8 e2 f9 ff ff       	call   330 <udiv64>
+ 94e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 950:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 953:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 959:	29 c1                	sub    %eax,%ecx
+ 95b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 95e:	68 e8 03 00 00       	push   $0x3e8
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	e8 c6 f9 ff ff       	call   330 <udiv64>
+ 96a:	83 c4 0c             	add    $0xc,%esp
+ 96d:	50                   	push   %eax
+ 96e:	68 f1 0c 00 00       	push   $0xcf1
+ 973:	53                   	push   %ebx
+ 974:	e8 87 fc ff ff       	call   600 <printf>
+  if(frac < 100)
+ 979:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 97c:	83 c4 10             	add    $0x10,%esp
+ 97f:	83 f9 63             	cmp    $0x63,%ecx
+ 982:	76 1c                	jbe    9a0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 984:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 987:	c7 45 0c f7 0c 00 00 	movl   $0xcf7,0xc(%ebp)
+ 98e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 994:	5b                   	pop    %ebx
+ 995:	5e                   	pop    %esi
+ 996:	5f                   	pop    %edi
+ 997:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 998:	e9 63 fc ff ff       	jmp    600 <printf>
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 9a0:	83 ec 08             	sub    $0x8,%esp
+ 9a3:	68 f5 0c 00 00       	push   $0xcf5
+ 9a8:	53                   	push   %ebx
+ 9a9:	e8 52 fc ff ff       	call   600 <printf>
+  if(frac < 10)
+ 9ae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9b1:	83 c4 10             	add    $0x10,%esp
+ 9b4:	83 f9 09             	cmp    $0x9,%ecx
+ 9b7:	77 cb                	ja     984 <printps+0x54>
+    printf(fd, "0");
+ 9b9:	83 ec 08             	sub    $0x8,%esp
+ 9bc:	68 f5 0c 00 00       	push   $0xcf5
+ 9c1:	53                   	push   %ebx
+ 9c2:	e8 39 fc ff ff       	call   600 <printf>
+ 9c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9ca:	83 c4 10             	add    $0x10,%esp
+ 9cd:	eb b5                	jmp    984 <printps+0x54>
+ 9cf:	90                   	nop
+
+000009d0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 9dc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 9df:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 9e2:	83 e8 01             	sub    $0x1,%eax
+ 9e5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ 9ea:	0f 87 37 02 00 00    	ja     c27 <bench+0x257>
+ 9f0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 9f3:	85 ff                	test   %edi,%edi
+ 9f5:	0f 84 2c 02 00 00    	je     c27 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ 9fb:	83 ec 0c             	sub    $0xc,%esp
+ 9fe:	ff 75 10             	push   0x10(%ebp)
+ a01:	ff 55 0c             	call   *0xc(%ebp)
+ a04:	5b                   	pop    %ebx
+ a05:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ a08:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ a0a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ a0d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ a10:	83 c4 10             	add    $0x10,%esp
+ a13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a17:	90                   	nop
+    t0 = cycles();
+ a18:	e8 33 f9 ff ff       	call   350 <cycles>
+    fn(arg);
+ a1d:	83 ec 0c             	sub    $0xc,%esp
+ a20:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ a23:	89 c6                	mov    %eax,%esi
+ a25:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ a27:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ a2a:	e8 21 f9 ff ff       	call   350 <cycles>
+ a2f:	29 f0                	sub    %esi,%eax
+ a31:	19 fa                	sbb    %edi,%edx
+ a33:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a3a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ a3d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a44:	83 c3 01             	add    $0x1,%ebx
+ a47:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ a4a:	7f cc                	jg     a18 <bench+0x48>
+  for(i = 1; i < n; i++){
+ a4c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ a50:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ a53:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ a59:	bf 01 00 00 00       	mov    $0x1,%edi
+ a5e:	74 77                	je     ad7 <bench+0x107>
+ a60:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a67:	90                   	nop
+    v = a[i];
+ a68:	8b 01                	mov    (%ecx),%eax
+ a6a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a6d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ a73:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ a79:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ a7f:	89 c8                	mov    %ecx,%eax
+ a81:	eb 1b                	jmp    a9e <bench+0xce>
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+      a[j] = a[j-1];
+ a88:	89 08                	mov    %ecx,(%eax)
+ a8a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a8d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ a90:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ a96:	39 c3                	cmp    %eax,%ebx
+ a98:	0f 84 72 01 00 00    	je     c10 <bench+0x240>
+ a9e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ aa1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ aa4:	89 f7                	mov    %esi,%edi
+ aa6:	89 c3                	mov    %eax,%ebx
+ aa8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ aae:	19 d7                	sbb    %edx,%edi
+ ab0:	72 d6                	jb     a88 <bench+0xb8>
+ ab2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ab8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ abe:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ ac4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ ac7:	83 c7 01             	add    $0x1,%edi
+ aca:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ acd:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ acf:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ ad2:	75 94                	jne    a68 <bench+0x98>
+ ad4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ad7:	83 ec 08             	sub    $0x8,%esp
+ ada:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ ae0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ ae5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ aeb:	e8 70 f8 ff ff       	call   360 <cyc2ns>
+ af0:	83 c4 0c             	add    $0xc,%esp
+ af3:	ff 75 14             	push   0x14(%ebp)
+ af6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ afc:	f7 e3                	mul    %ebx
+ afe:	01 ca                	add    %ecx,%edx
+ b00:	52                   	push   %edx
+ b01:	50                   	push   %eax
+ b02:	e8 29 f8 ff ff       	call   330 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ b07:	89 06                	mov    %eax,(%esi)
+ b09:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b0c:	5f                   	pop    %edi
+ b0d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ b0e:	8b 45 18             	mov    0x18(%ebp),%eax
+ b11:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b13:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ b1a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ b21:	e8 3a f8 ff ff       	call   360 <cyc2ns>
+ b26:	83 c4 0c             	add    $0xc,%esp
+ b29:	ff 75 14             	push   0x14(%ebp)
+ b2c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b32:	f7 e3                	mul    %ebx
+ b34:	01 ca                	add    %ecx,%edx
+ b36:	52                   	push   %edx
+ b37:	50                   	push   %eax
+ b38:	e8 f3 f7 ff ff       	call   330 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ b3d:	89 46 08             	mov    %eax,0x8(%esi)
+ b40:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b43:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b44:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b47:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b48:	8d 50 01             	lea    0x1(%eax),%edx
+ b4b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ b50:	6b d2 63             	imul   $0x63,%edx,%edx
+ b53:	f7 e2                	mul    %edx
+ b55:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b58:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ b5f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ b66:	e8 f5 f7 ff ff       	call   360 <cyc2ns>
+ b6b:	83 c4 0c             	add    $0xc,%esp
+ b6e:	ff 75 14             	push   0x14(%ebp)
+ b71:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b77:	f7 e3                	mul    %ebx
+ b79:	01 ca                	add    %ecx,%edx
+ b7b:	52                   	push   %edx
+ b7c:	50                   	push   %eax
+ b7d:	e8 ae f7 ff ff       	call   330 <udiv64>
+
+  if(name){
+ b82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b85:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b88:	89 46 10             	mov    %eax,0x10(%esi)
+ b8b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ b8e:	85 c9                	test   %ecx,%ecx
+ b90:	74 72                	je     c04 <bench+0x234>
+    printf(1, "%s: min ", name);
+ b92:	83 ec 04             	sub    $0x4,%esp
+ b95:	ff 75 08             	push   0x8(%ebp)
+ b98:	68 fa 0c 00 00       	push   $0xcfa
+ b9d:	6a 01                	push   $0x1
+ b9f:	e8 5c fa ff ff       	call   600 <printf>
+    printps(1, st->min);
+ ba4:	83 c4 0c             	add    $0xc,%esp
+ ba7:	ff 76 04             	push   0x4(%esi)
+ baa:	ff 36                	push   (%esi)
+ bac:	6a 01                	push   $0x1
+ bae:	e8 7d fd ff ff       	call   930 <printps>
+    printf(1, " median ");
+ bb3:	58                   	pop    %eax
+ bb4:	5a                   	pop    %edx
+ bb5:	68 03 0d 00 00       	push   $0xd03
+ bba:	6a 01                	push   $0x1
+ bbc:	e8 3f fa ff ff       	call   600 <printf>
+    printps(1, st->median);
+ bc1:	83 c4 0c             	add    $0xc,%esp
+ bc4:	ff 76 0c             	push   0xc(%esi)
+ bc7:	ff 76 08             	push   0x8(%esi)
+ bca:	6a 01                	push   $0x1
+ bcc:	e8 5f fd ff ff       	call   930 <printps>
+    printf(1, " p99 ");
+ bd1:	59                   	pop    %ecx
+ bd2:	5b                   	pop    %ebx
+ bd3:	68 0c 0d 00 00       	push   $0xd0c
+ bd8:	6a 01                	push   $0x1
+ bda:	e8 21 fa ff ff       	call   600 <printf>
+    printps(1, st->p99);
+ bdf:	83 c4 0c             	add    $0xc,%esp
+ be2:	ff 76 14             	push   0x14(%esi)
+ be5:	ff 76 10             	push   0x10(%esi)
+ be8:	6a 01                	push   $0x1
+ bea:	e8 41 fd ff ff       	call   930 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ bef:	83 c4 0c             	add    $0xc,%esp
+ bf2:	ff 75 18             	push   0x18(%ebp)
+ bf5:	68 12 0d 00 00       	push   $0xd12
+ bfa:	6a 01                	push   $0x1
+ bfc:	e8 ff f9 ff ff       	call   600 <printf>
+ c01:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ c04:	31 c0                	xor    %eax,%eax
+}
+ c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c09:	5b                   	pop    %ebx
+ c0a:	5e                   	pop    %esi
+ c0b:	5f                   	pop    %edi
+ c0c:	5d                   	pop    %ebp
+ c0d:	c3                   	ret
+ c0e:	66 90                	xchg   %ax,%ax
+ c10:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c16:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ c1c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c22:	e9 97 fe ff ff       	jmp    abe <bench+0xee>
+    return -1;
+ c27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c2c:	eb d8                	jmp    c06 <bench+0x236>
@@ -8,6 +8,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "trace.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -17,10 +19,26 @@ struct run {
   struct run *next;
 };
 
+#define NZEROPG     256   // pre-zeroed 4KB pages to keep ready
+#define NZEROHUGE     2   // pre-zeroed 4MB frames to keep ready
+#define ZEROCHUNK  (256*1024)  // bytes of a frame zeroed per step
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;                   // pages on freelist
+
+  // Pools of already-zeroed memory, refilled by kzerod().
+  // Zeroed pages are linked through their first word,
+  // which is cleared again when a page is handed out.
+  struct run *zerolist;
+  int nzero;
+  char *zerohuge[NZEROHUGE];
+  int nzerohuge;
+  char *hugewip;               // frame kzerod is zeroing
+  uint hugeoff;                // bytes of hugewip zeroed so far
+  int hugebusy;                // kzerod is zeroing the chunk at hugeoff
 } kmem;
 
 // Initialization happens in two phases.
@@ -31,7 +49,7 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  initlockkind(&kmem.lock, "kmem", LK_MCS);
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -72,10 +90,57 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
 
+// Put the pages from a to b on zerolist if zeroed is set,
+// else on freelist.  Caller holds kmem.lock.
+static void
+givepages(char *a, char *b, int zeroed)
+{
+  struct run *r;
+
+  for(; a < b; a += PGSIZE){
+    r = (struct run*)a;
+    if(zeroed){
+      r->next = kmem.zerolist;
+      kmem.zerolist = r;
+      kmem.nzero++;
+    } else {
+      r->next = kmem.freelist;
+      kmem.freelist = r;
+      kmem.nfree++;
+    }
+  }
+}
+
+// Out of 4KB pages: break up a pre-zeroed huge frame, or the one
+// kzerod is working on, rather than fail.  A chunk kzerod is in
+// the middle of clearing stays with it; kzerostep gives it back.
+// Caller holds kmem.lock.
+static void
+splithuge(void)
+{
+  char *f;
+  uint off;
+
+  if(kmem.nzerohuge > 0){
+    f = kmem.zerohuge[--kmem.nzerohuge];
+    givepages(f, f + HUGEPGSIZE, 1);
+    return;
+  }
+  if((f = kmem.hugewip) == 0)
+    return;
+  kmem.hugewip = 0;
+  off = kmem.hugeoff;
+  givepages(f, f + off, 1);
+  if(kmem.hugebusy)
+    off += ZEROCHUNK;
+  givepages(f + off, f + HUGEPGSIZE, 0);
+}
+
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
@@ -86,24 +151,65 @@ kalloc(void)
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
+  if(kmem.freelist == 0 && kmem.zerolist == 0)
+    splithuge();
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  } else if((r = kmem.zerolist) != 0){
+    // Out of ordinary pages; spend a zeroed one.
+    kmem.zerolist = r->next;
+    kmem.nzero--;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
+  if(r)
+    trace(TR_KALLOC, V2P(r));
+  else
+    trace(TR_KALLOC_FAIL, 0);
   return (char*)r;
 }
 
-int is_aligned(uint ptr, uint offset) {
-  return (ptr%offset == 0);
-}
-
+// Allocate one zero-filled 4096-byte page, from the
+// pre-zeroed pool when it has one.
+// Returns 0 if the memory cannot be allocated.
 char*
-kalloc_huge(void)
+kzalloc(void)
 {
+  struct run *r;
+
   if(kmem.use_lock)
     acquire(&kmem.lock);
+  if(kmem.freelist == 0 && kmem.zerolist == 0)
+    splithuge();
+  r = kmem.zerolist;
+  if(r){
+    kmem.zerolist = r->next;
+    kmem.nzero--;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
+  if(r){
+    r->next = 0;
+    trace(TR_KALLOC, V2P(r));
+    return (char*)r;
+  }
+  if((r = (struct run*)kalloc()) != 0)
+    pgzero(r, PGSIZE);
+  return (char*)r;
+}
+
+int is_aligned(uint ptr, uint offset) {
+  return (ptr%offset == 0);
+}
 
+// Unlink a HUGEPGSIZE-aligned run of free pages from the freelist.
+// Caller holds kmem.lock.  Returns 0 if there is none.
+static char*
+takehuge(void)
+{
   // search for consecutive pages
   struct run *curr = kmem.freelist, *prev = 0, *start = 0;
   while(curr)
@@ -136,25 +242,50 @@ kalloc_huge(void)
 
   // if not found, exit
   if(!curr || !start)
-  {
-    if(kmem.use_lock)
-      release(&kmem.lock);
     return 0;
-  }
 
   // allocate
   if(prev == 0)
     kmem.freelist = start->next;
   else
     prev->next = start->next;
+  kmem.nfree -= NPTENTRIES;
+  return (char*)start;
+}
 
-  // clean all pages
-  memset((void*)start, 0, HUGEPGSIZE);
+char*
+kalloc_huge(void)
+{
+  char *start;
 
-  // return starting address
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+
+  // prefer a frame the idle loop has already cleared
+  if(kmem.nzerohuge > 0)
+  {
+    start = kmem.zerohuge[--kmem.nzerohuge];
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    trace(TR_KALLOC_HUGE, V2P(start));
+    return start;
+  }
+
+  start = takehuge();
   if(kmem.use_lock)
     release(&kmem.lock);
-  return (char*)start;
+  if(start == 0)
+  {
+    trace(TR_KALLOC_HUGE_FAIL, 0);
+    return 0;
+  }
+
+  // clean all pages, outside the lock
+  pgzero(start, HUGEPGSIZE);
+
+  // return starting address
+  trace(TR_KALLOC_HUGE, V2P(start));
+  return start;
 }
 
 int kfree_huge(char *va) {
@@ -173,20 +304,99 @@ int kfree_huge(char *va) {
   return 0;
 }
 
+// Count free pages, pooled ones included.  Each counter is one
+// aligned word, so it is read without kmem.lock: the total may
+// be a moment stale, but readers never hold up the allocator.
 int kfreespace(void) {
-  if(kmem.use_lock)
+  int cnt = kmem.nfree + kmem.nzero + kmem.nzerohuge*NPTENTRIES;
+  if(kmem.hugewip)
+    cnt += NPTENTRIES;
+  return cnt;
+}
+
+// Do a small piece of work refilling the pre-zeroed pools.
+// Only takes a huge frame while plenty of ordinary pages are
+// free, and kalloc() breaks pooled frames up again if it runs
+// out.  Returns 0 if there was nothing to do.
+static int
+kzerostep(void)
+{
+  struct run *r;
+  char *frame;
+  uint off;
+
+  acquire(&kmem.lock);
+  if(kmem.nzero < NZEROPG && kmem.nfree > NZEROPG){
+    r = kmem.freelist;
+    kmem.freelist = r->next;
+    kmem.nfree--;
+    release(&kmem.lock);
+
+    pgzero_nt(r, PGSIZE);
+
     acquire(&kmem.lock);
-  
-  struct run *ptr = kmem.freelist;
-  int cnt = 0;
-  while(ptr)
-  {
-    cnt++;
-    ptr=ptr->next;
+    r->next = kmem.zerolist;
+    kmem.zerolist = r;
+    kmem.nzero++;
+    release(&kmem.lock);
+    return 1;
   }
 
-  if(kmem.use_lock)
+  // Clear huge frames a chunk at a time, yielding in between,
+  // so that other processes wait at most one chunk for a cpu.
+  if(kmem.nzerohuge == NZEROHUGE){
     release(&kmem.lock);
-  return cnt;
+    return 0;
+  }
+  if(kmem.hugewip == 0){
+    if(kmem.nfree < 4*NPTENTRIES || (kmem.hugewip = takehuge()) == 0){
+      release(&kmem.lock);
+      return 0;
+    }
+    kmem.hugeoff = 0;
+  }
+  frame = kmem.hugewip;
+  off = kmem.hugeoff;
+  kmem.hugebusy = 1;
+  release(&kmem.lock);
+
+  pgzero_nt(frame + off, ZEROCHUNK);
+
+  acquire(&kmem.lock);
+  kmem.hugebusy = 0;
+  if(kmem.hugewip != frame){
+    // kalloc broke the frame up meanwhile, leaving us this chunk.
+    givepages(frame + off, frame + off + ZEROCHUNK, 1);
+  } else {
+    kmem.hugeoff = off + ZEROCHUNK;
+    if(kmem.hugeoff == HUGEPGSIZE){
+      kmem.zerohuge[kmem.nzerohuge++] = frame;
+      kmem.hugewip = 0;
+    }
+  }
+  release(&kmem.lock);
+  return 1;
 }
 
+// Kernel thread that keeps the pre-zeroed pools filled, so that
+// clearing happens off the allocation path.  It runs at the
+// lowest priority and yields after each step, so it mostly uses
+// time no process wants.  With nothing to do it naps a few ticks.
+void
+kzerod(void *arg)
+{
+  uint t0;
+
+  setpriority(0, NICEMAX);
+  for(;;){
+    if(kzerostep()){
+      yield();
+      continue;
+    }
+    acquire(&tickslock);
+    t0 = ticks;
+    while(ticks - t0 < 10)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+  }
+}
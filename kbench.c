@@ -0,0 +1,207 @@
+// Kernel microbenchmarks.
+// These time kernel routines in place, where user programs
+// cannot reach them, and report the fastest of a few runs.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "kbench.h"
+
+#define RUNS 3
+#define NWAKE 10000
+
+// memmove before string.c learned to move words,
+// kept as the baseline to compare against.
+static void
+bytecopy(char *dst, char *src, uint n)
+{
+  while(n-- > 0)
+    *dst++ = *src++;
+}
+
+static void
+wordcopy(char *dst, char *src, uint n)
+{
+  memmove(dst, src, n);
+}
+
+static void
+pagecopy(char *dst, char *src, uint n)
+{
+  uint i;
+
+  for(i = 0; i < n; i += PGSIZE)
+    pgcopy(dst + i, src + i, PGSIZE);
+}
+
+// memset of a buffer that is not word-sized, as it was done
+// before string.c aligned the destination itself.
+static void
+byteclear(char *dst, char *src, uint n)
+{
+  stosb(dst, 0, n);
+}
+
+static void
+wordclear(char *dst, char *src, uint n)
+{
+  memset(dst, 0, n);
+}
+
+static void
+pageclear(char *dst, char *src, uint n)
+{
+  uint i;
+
+  for(i = 0; i < n; i += PGSIZE)
+    pgzero(dst + i, PGSIZE);
+}
+
+static void
+hugeclear(char *dst, char *src, uint n)
+{
+  pgzero(dst, n);
+}
+
+static struct {
+  char *name;
+  void (*fn)(char*, char*, uint);
+} memtests[] = {
+  { "copy, byte loop", bytecopy },
+  { "copy, memmove", wordcopy },
+  { "copy, pgcopy 4KB", pagecopy },
+  { "clear, stosb", byteclear },
+  { "clear, memset", wordclear },
+  { "clear, pgzero 4KB", pageclear },
+  { "clear, pgzero 4MB", hugeclear },
+};
+
+// Time each copy and clear routine on a huge page.
+static int
+membench(struct kbresult *res, int n)
+{
+  char *src, *dst;
+  uint64 t0, t;
+  int i, r;
+
+  if((src = kalloc_huge()) == 0)
+    return -1;
+  if((dst = kalloc_huge()) == 0){
+    kfree_huge(src);
+    return -1;
+  }
+
+  for(i = 0; i < NELEM(memtests) && i < n; i++){
+    safestrcpy(res[i].name, memtests[i].name, sizeof(res[i].name));
+    res[i].ops = HUGEPGSIZE;
+    res[i].cycles = ~(uint64)0;
+    for(r = 0; r < RUNS; r++){
+      t0 = rdtsc();
+      memtests[i].fn(dst, src, HUGEPGSIZE);
+      t = rdtsc() - t0;
+      if(t < res[i].cycles)
+        res[i].cycles = t;
+    }
+  }
+
+  kfree_huge(src);
+  kfree_huge(dst);
+  return i;
+}
+
+// Time wakeup() on a channel with no sleepers, and the locked
+// wakeup(&ticks) that cpu 0 does on every timer interrupt.
+// Both used to scan every process; compare them with few and
+// with many processes asleep elsewhere.
+static int
+wakebench(struct kbresult *res, int n)
+{
+  static char nobody;
+  uint64 t0, t;
+  int i, r;
+
+  if(n < 2)
+    return -1;
+  safestrcpy(res[0].name, "wakeup, no sleepers", sizeof(res[0].name));
+  safestrcpy(res[1].name, "timer tick wakeup", sizeof(res[1].name));
+  for(i = 0; i < 2; i++){
+    res[i].ops = NWAKE;
+    res[i].cycles = ~(uint64)0;
+  }
+  for(r = 0; r < RUNS; r++){
+    t0 = rdtsc();
+    for(i = 0; i < NWAKE; i++)
+      wakeup(&nobody);
+    t = rdtsc() - t0;
+    if(t < res[0].cycles)
+      res[0].cycles = t;
+
+    t0 = rdtsc();
+    for(i = 0; i < NWAKE; i++){
+      acquire(&tickslock);
+      wakeup(&ticks);
+      release(&tickslock);
+    }
+    t = rdtsc() - t0;
+    if(t < res[1].cycles)
+      res[1].cycles = t;
+  }
+  return 2;
+}
+
+static struct spinlock benchlocks[] = {
+  [LK_TAS]    { .kind = LK_TAS,    .name = "test-and-set" },
+  [LK_TICKET] { .kind = LK_TICKET, .name = "ticket" },
+  [LK_MCS]    { .kind = LK_MCS,    .name = "mcs" },
+};
+static volatile uint benchcount;
+
+// Acquire and release one shared lock of the given kind for
+// LOCKMS milliseconds, counting acquisitions.  lockbench runs
+// this on every cpu at once and compares the counts.
+static int
+spinbench(int kind, struct kbresult *res, int n)
+{
+  struct spinlock *lk;
+  uint64 t0, end;
+  uint ops;
+
+  if(n < 1)
+    return -1;
+  lk = &benchlocks[kind];
+  ops = 0;
+  t0 = rdtsc();
+  end = t0 + (uint64)tsckhz * LOCKMS;
+  while(rdtsc() < end){
+    acquire(lk);
+    benchcount++;
+    release(lk);
+    ops++;
+  }
+  safestrcpy(res[0].name, lk->name, sizeof(res[0].name));
+  res[0].ops = ops;
+  res[0].cycles = rdtsc() - t0;
+  return 1;
+}
+
+// Run benchmark which, storing up to n results in res.
+// Returns the number of results, or -1.
+int
+kbench(int which, struct kbresult *res, int n)
+{
+  switch(which){
+  case KB_MEM:
+    return membench(res, n);
+  case KB_WAKEUP:
+    return wakebench(res, n);
+  case KB_LOCKTAS:
+  case KB_LOCKTICKET:
+  case KB_LOCKMCS:
+    return spinbench(which - KB_LOCKTAS + LK_TAS, res, n);
+  }
+  return -1;
+}
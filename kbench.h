@@ -0,0 +1,15 @@
+// Kernel microbenchmarks run by kbench(), shared with user tools.
+
+#define KB_MEM   1   // page copy and clear routines in string.c
+#define KB_WAKEUP 2  // wakeup() as done on every timer interrupt
+#define KB_LOCKTAS    3  // spin on a test-and-set lock for LOCKMS,
+#define KB_LOCKTICKET 4  // a ticket lock,
+#define KB_LOCKMCS    5  // or an MCS lock; run on several cpus at once
+
+#define LOCKMS      100
+
+struct kbresult {
+  char name[24];
+  uint ops;       // bytes (KB_MEM) or operations done per run
+  uint64 cycles;  // fastest of the runs
+};
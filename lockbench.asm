@@ -0,0 +1,2108 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+  int ncpu, kind;
+
+  // Find the cpus by trying to move onto each in turn.
+  for(ncpu = 0; ncpu < MAXCPU; ncpu++)
+    if(sched_setaffinity(0, 1 << ncpu) < 0)
+   e:	be 01 00 00 00       	mov    $0x1,%esi
+{
+  13:	53                   	push   %ebx
+  for(ncpu = 0; ncpu < MAXCPU; ncpu++)
+  14:	31 db                	xor    %ebx,%ebx
+{
+  16:	51                   	push   %ecx
+  17:	83 ec 0c             	sub    $0xc,%esp
+  1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(sched_setaffinity(0, 1 << ncpu) < 0)
+  20:	89 d9                	mov    %ebx,%ecx
+  22:	89 f0                	mov    %esi,%eax
+  24:	83 ec 08             	sub    $0x8,%esp
+  27:	d3 e0                	shl    %cl,%eax
+  29:	50                   	push   %eax
+  2a:	6a 00                	push   $0x0
+  2c:	e8 57 08 00 00       	call   888 <sched_setaffinity>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	85 c0                	test   %eax,%eax
+  36:	78 08                	js     40 <main+0x40>
+  for(ncpu = 0; ncpu < MAXCPU; ncpu++)
+  38:	83 c3 01             	add    $0x1,%ebx
+  3b:	83 fb 08             	cmp    $0x8,%ebx
+  3e:	75 e0                	jne    20 <main+0x20>
+      break;
+  sched_setaffinity(0, ~0);
+  40:	83 ec 08             	sub    $0x8,%esp
+  43:	6a ff                	push   $0xffffffff
+  45:	6a 00                	push   $0x0
+  47:	e8 3c 08 00 00       	call   888 <sched_setaffinity>
+
+  printf(1, "%d cpus, %d ms per run\n", ncpu, LOCKMS);
+  4c:	6a 64                	push   $0x64
+  4e:	53                   	push   %ebx
+  4f:	68 c8 0f 00 00       	push   $0xfc8
+  54:	6a 01                	push   $0x1
+  56:	e8 15 09 00 00       	call   970 <printf>
+  printf(1, "lock\t\tacquires/sec\tmin/max %%\tper cpu\n");
+  5b:	83 c4 18             	add    $0x18,%esp
+  5e:	68 f8 0f 00 00       	push   $0xff8
+  63:	6a 01                	push   $0x1
+  65:	e8 06 09 00 00       	call   970 <printf>
+  for(kind = 0; kind < 3; kind++)
+    run(kind, ncpu);
+  6a:	89 da                	mov    %ebx,%edx
+  6c:	31 c0                	xor    %eax,%eax
+  6e:	e8 1d 00 00 00       	call   90 <run>
+  73:	89 da                	mov    %ebx,%edx
+  75:	b8 01 00 00 00       	mov    $0x1,%eax
+  7a:	e8 11 00 00 00       	call   90 <run>
+  7f:	89 da                	mov    %ebx,%edx
+  81:	b8 02 00 00 00       	mov    $0x2,%eax
+  86:	e8 05 00 00 00       	call   90 <run>
+  exit();
+  8b:	e8 d8 06 00 00       	call   768 <exit>
+
+00000090 <run>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	56                   	push   %esi
+  95:	53                   	push   %ebx
+  96:	89 d3                	mov    %edx,%ebx
+  98:	81 ec 78 01 00 00    	sub    $0x178,%esp
+  9e:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%ebp)
+  if(pipe(start) < 0 || pipe(done) < 0){
+  a4:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  aa:	50                   	push   %eax
+  ab:	e8 c8 06 00 00       	call   778 <pipe>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	85 c0                	test   %eax,%eax
+  b5:	0f 88 86 03 00 00    	js     441 <run+0x3b1>
+  bb:	83 ec 0c             	sub    $0xc,%esp
+  be:	8d 85 c0 fe ff ff    	lea    -0x140(%ebp),%eax
+  c4:	50                   	push   %eax
+  c5:	e8 ae 06 00 00       	call   778 <pipe>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	85 c0                	test   %eax,%eax
+  cf:	0f 88 6c 03 00 00    	js     441 <run+0x3b1>
+  for(i = 0; i < ncpu; i++){
+  d5:	31 f6                	xor    %esi,%esi
+  d7:	85 db                	test   %ebx,%ebx
+  d9:	75 07                	jne    e2 <run+0x52>
+  db:	e9 92 02 00 00       	jmp    372 <run+0x2e2>
+  e0:	89 fe                	mov    %edi,%esi
+    if(fork() == 0){
+  e2:	e8 79 06 00 00       	call   760 <fork>
+  e7:	85 c0                	test   %eax,%eax
+  e9:	0f 84 b9 02 00 00    	je     3a8 <run+0x318>
+  for(i = 0; i < ncpu; i++){
+  ef:	8d 7e 01             	lea    0x1(%esi),%edi
+  f2:	39 fb                	cmp    %edi,%ebx
+  f4:	75 ea                	jne    e0 <run+0x50>
+  close(start[0]);
+  f6:	83 ec 0c             	sub    $0xc,%esp
+  f9:	ff b5 b8 fe ff ff    	push   -0x148(%ebp)
+  for(n = 0; n < ncpu; n++)
+  ff:	31 db                	xor    %ebx,%ebx
+  close(start[0]);
+ 101:	e8 8a 06 00 00       	call   790 <close>
+  close(start[1]);   // go
+ 106:	5a                   	pop    %edx
+ 107:	ff b5 bc fe ff ff    	push   -0x144(%ebp)
+ 10d:	e8 7e 06 00 00       	call   790 <close>
+  for(n = 0; n < ncpu; n++)
+ 112:	8d 95 c8 fe ff ff    	lea    -0x138(%ebp),%edx
+ 118:	89 bd a4 fe ff ff    	mov    %edi,-0x15c(%ebp)
+ 11e:	83 c4 10             	add    $0x10,%esp
+ 121:	89 f7                	mov    %esi,%edi
+ 123:	89 d6                	mov    %edx,%esi
+ 125:	eb 19                	jmp    140 <run+0xb0>
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+ 130:	8d 43 01             	lea    0x1(%ebx),%eax
+ 133:	83 c6 24             	add    $0x24,%esi
+ 136:	39 df                	cmp    %ebx,%edi
+ 138:	0f 84 ba 01 00 00    	je     2f8 <run+0x268>
+ 13e:	89 c3                	mov    %eax,%ebx
+    if(read(done[0], &r[n], sizeof(r[n])) != sizeof(r[n]))
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	6a 24                	push   $0x24
+ 145:	56                   	push   %esi
+ 146:	ff b5 c0 fe ff ff    	push   -0x140(%ebp)
+ 14c:	e8 2f 06 00 00       	call   780 <read>
+ 151:	83 c4 10             	add    $0x10,%esp
+ 154:	83 f8 24             	cmp    $0x24,%eax
+ 157:	74 d7                	je     130 <run+0xa0>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(wait() >= 0)
+ 160:	e8 0b 06 00 00       	call   770 <wait>
+ 165:	85 c0                	test   %eax,%eax
+ 167:	79 f7                	jns    160 <run+0xd0>
+  close(done[0]);
+ 169:	83 ec 0c             	sub    $0xc,%esp
+ 16c:	ff b5 c0 fe ff ff    	push   -0x140(%ebp)
+ 172:	e8 19 06 00 00       	call   790 <close>
+  close(done[1]);
+ 177:	58                   	pop    %eax
+ 178:	ff b5 c4 fe ff ff    	push   -0x13c(%ebp)
+ 17e:	e8 0d 06 00 00       	call   790 <close>
+  for(i = 0; i < n; i++){
+ 183:	83 c4 10             	add    $0x10,%esp
+ 186:	85 db                	test   %ebx,%ebx
+ 188:	0f 84 9f 01 00 00    	je     32d <run+0x29d>
+ 18e:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+ 195:	8d 95 c8 fe ff ff    	lea    -0x138(%ebp),%edx
+  lo = ~0;
+ 19b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  hi = 0;
+ 1a0:	31 ff                	xor    %edi,%edi
+ 1a2:	89 85 90 fe ff ff    	mov    %eax,-0x170(%ebp)
+ 1a8:	01 d8                	add    %ebx,%eax
+ 1aa:	89 d6                	mov    %edx,%esi
+ 1ac:	8d 04 82             	lea    (%edx,%eax,4),%eax
+      total += udiv64((uint64)r[i].ops * 1000000000,
+ 1af:	89 9d 8c fe ff ff    	mov    %ebx,-0x174(%ebp)
+ 1b5:	89 cb                	mov    %ecx,%ebx
+ 1b7:	89 95 94 fe ff ff    	mov    %edx,-0x16c(%ebp)
+ 1bd:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+  total = 0;
+ 1c3:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%ebp)
+ 1ca:	00 00 00 
+ 1cd:	c7 85 9c fe ff ff 00 	movl   $0x0,-0x164(%ebp)
+ 1d4:	00 00 00 
+ 1d7:	eb 21                	jmp    1fa <run+0x16a>
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(r[i].ops < lo)
+ 1e0:	8b 46 18             	mov    0x18(%esi),%eax
+ 1e3:	39 c3                	cmp    %eax,%ebx
+ 1e5:	0f 47 d8             	cmova  %eax,%ebx
+    if(r[i].ops > hi)
+ 1e8:	39 c7                	cmp    %eax,%edi
+ 1ea:	0f 42 f8             	cmovb  %eax,%edi
+  for(i = 0; i < n; i++){
+ 1ed:	8b 85 a4 fe ff ff    	mov    -0x15c(%ebp),%eax
+ 1f3:	83 c6 24             	add    $0x24,%esi
+ 1f6:	39 c6                	cmp    %eax,%esi
+ 1f8:	74 3e                	je     238 <run+0x1a8>
+    if(r[i].cycles)
+ 1fa:	8b 56 20             	mov    0x20(%esi),%edx
+ 1fd:	8b 46 1c             	mov    0x1c(%esi),%eax
+ 200:	89 d1                	mov    %edx,%ecx
+ 202:	09 c1                	or     %eax,%ecx
+ 204:	74 da                	je     1e0 <run+0x150>
+                      (uint)cyc2ns(r[i].cycles));
+ 206:	83 ec 08             	sub    $0x8,%esp
+ 209:	52                   	push   %edx
+ 20a:	50                   	push   %eax
+ 20b:	e8 c0 04 00 00       	call   6d0 <cyc2ns>
+      total += udiv64((uint64)r[i].ops * 1000000000,
+ 210:	83 c4 0c             	add    $0xc,%esp
+ 213:	50                   	push   %eax
+ 214:	b8 00 ca 9a 3b       	mov    $0x3b9aca00,%eax
+ 219:	f7 66 18             	mull   0x18(%esi)
+ 21c:	52                   	push   %edx
+ 21d:	50                   	push   %eax
+ 21e:	e8 7d 04 00 00       	call   6a0 <udiv64>
+ 223:	01 85 98 fe ff ff    	add    %eax,-0x168(%ebp)
+ 229:	11 95 9c fe ff ff    	adc    %edx,-0x164(%ebp)
+ 22f:	83 c4 10             	add    $0x10,%esp
+ 232:	eb ac                	jmp    1e0 <run+0x150>
+ 234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "%s\t", kinds[kind]);
+ 238:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+ 23e:	83 ec 04             	sub    $0x4,%esp
+ 241:	89 9d a4 fe ff ff    	mov    %ebx,-0x15c(%ebp)
+ 247:	8b 9d 8c fe ff ff    	mov    -0x174(%ebp),%ebx
+ 24d:	8b 34 85 20 10 00 00 	mov    0x1020(,%eax,4),%esi
+ 254:	56                   	push   %esi
+ 255:	68 b8 0f 00 00       	push   $0xfb8
+ 25a:	6a 01                	push   $0x1
+ 25c:	e8 0f 07 00 00       	call   970 <printf>
+  if(strlen(kinds[kind]) < 8)
+ 261:	89 34 24             	mov    %esi,(%esp)
+ 264:	e8 87 02 00 00       	call   4f0 <strlen>
+ 269:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d\t\t%d\t", (uint)total, hi ? (uint)udiv64((uint64)lo * 100, hi) : 0);
+ 26c:	8b b5 98 fe ff ff    	mov    -0x168(%ebp),%esi
+  if(strlen(kinds[kind]) < 8)
+ 272:	8b 8d a4 fe ff ff    	mov    -0x15c(%ebp),%ecx
+ 278:	83 f8 07             	cmp    $0x7,%eax
+ 27b:	0f 86 8f 00 00 00    	jbe    310 <run+0x280>
+  printf(1, "%d\t\t%d\t", (uint)total, hi ? (uint)udiv64((uint64)lo * 100, hi) : 0);
+ 281:	85 ff                	test   %edi,%edi
+ 283:	74 17                	je     29c <run+0x20c>
+ 285:	b8 64 00 00 00       	mov    $0x64,%eax
+ 28a:	83 ec 04             	sub    $0x4,%esp
+ 28d:	f7 e1                	mul    %ecx
+ 28f:	57                   	push   %edi
+ 290:	52                   	push   %edx
+ 291:	50                   	push   %eax
+ 292:	e8 09 04 00 00       	call   6a0 <udiv64>
+ 297:	83 c4 10             	add    $0x10,%esp
+ 29a:	89 c7                	mov    %eax,%edi
+ 29c:	57                   	push   %edi
+ 29d:	56                   	push   %esi
+ 29e:	68 c0 0f 00 00       	push   $0xfc0
+ 2a3:	6a 01                	push   $0x1
+ 2a5:	e8 c6 06 00 00       	call   970 <printf>
+  for(i = 0; i < n; i++)
+ 2aa:	8b 85 90 fe ff ff    	mov    -0x170(%ebp),%eax
+ 2b0:	8b b5 94 fe ff ff    	mov    -0x16c(%ebp),%esi
+ 2b6:	83 c4 10             	add    $0x10,%esp
+ 2b9:	01 d8                	add    %ebx,%eax
+ 2bb:	8d 1c 86             	lea    (%esi,%eax,4),%ebx
+ 2be:	66 90                	xchg   %ax,%ax
+    printf(1, " %d", r[i].ops);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	ff 76 18             	push   0x18(%esi)
+  for(i = 0; i < n; i++)
+ 2c6:	83 c6 24             	add    $0x24,%esi
+    printf(1, " %d", r[i].ops);
+ 2c9:	68 bc 0f 00 00       	push   $0xfbc
+ 2ce:	6a 01                	push   $0x1
+ 2d0:	e8 9b 06 00 00       	call   970 <printf>
+  for(i = 0; i < n; i++)
+ 2d5:	83 c4 10             	add    $0x10,%esp
+ 2d8:	39 de                	cmp    %ebx,%esi
+ 2da:	75 e4                	jne    2c0 <run+0x230>
+  printf(1, "\n");
+ 2dc:	83 ec 08             	sub    $0x8,%esp
+ 2df:	68 cb 10 00 00       	push   $0x10cb
+ 2e4:	6a 01                	push   $0x1
+ 2e6:	e8 85 06 00 00       	call   970 <printf>
+}
+ 2eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ee:	5b                   	pop    %ebx
+ 2ef:	5e                   	pop    %esi
+ 2f0:	5f                   	pop    %edi
+ 2f1:	5d                   	pop    %ebp
+ 2f2:	c3                   	ret
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+  for(i = 0; i < ncpu; i++){
+ 2f8:	8b 9d a4 fe ff ff    	mov    -0x15c(%ebp),%ebx
+  while(wait() >= 0)
+ 2fe:	e8 6d 04 00 00       	call   770 <wait>
+ 303:	85 c0                	test   %eax,%eax
+ 305:	0f 89 55 fe ff ff    	jns    160 <run+0xd0>
+ 30b:	e9 59 fe ff ff       	jmp    169 <run+0xd9>
+    printf(1, "\t");
+ 310:	83 ec 08             	sub    $0x8,%esp
+ 313:	68 c6 0f 00 00       	push   $0xfc6
+ 318:	6a 01                	push   $0x1
+ 31a:	e8 51 06 00 00       	call   970 <printf>
+ 31f:	8b 8d a4 fe ff ff    	mov    -0x15c(%ebp),%ecx
+ 325:	83 c4 10             	add    $0x10,%esp
+ 328:	e9 54 ff ff ff       	jmp    281 <run+0x1f1>
+  printf(1, "%s\t", kinds[kind]);
+ 32d:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+ 333:	83 ec 04             	sub    $0x4,%esp
+ 336:	8b 1c 85 20 10 00 00 	mov    0x1020(,%eax,4),%ebx
+ 33d:	53                   	push   %ebx
+ 33e:	68 b8 0f 00 00       	push   $0xfb8
+ 343:	6a 01                	push   $0x1
+ 345:	e8 26 06 00 00       	call   970 <printf>
+  if(strlen(kinds[kind]) < 8)
+ 34a:	89 1c 24             	mov    %ebx,(%esp)
+ 34d:	e8 9e 01 00 00       	call   4f0 <strlen>
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	83 f8 07             	cmp    $0x7,%eax
+ 358:	76 3a                	jbe    394 <run+0x304>
+  printf(1, "%d\t\t%d\t", (uint)total, hi ? (uint)udiv64((uint64)lo * 100, hi) : 0);
+ 35a:	6a 00                	push   $0x0
+ 35c:	6a 00                	push   $0x0
+ 35e:	68 c0 0f 00 00       	push   $0xfc0
+ 363:	6a 01                	push   $0x1
+ 365:	e8 06 06 00 00       	call   970 <printf>
+ 36a:	83 c4 10             	add    $0x10,%esp
+ 36d:	e9 6a ff ff ff       	jmp    2dc <run+0x24c>
+  close(start[0]);
+ 372:	83 ec 0c             	sub    $0xc,%esp
+ 375:	ff b5 b8 fe ff ff    	push   -0x148(%ebp)
+ 37b:	e8 10 04 00 00       	call   790 <close>
+  close(start[1]);   // go
+ 380:	59                   	pop    %ecx
+ 381:	ff b5 bc fe ff ff    	push   -0x144(%ebp)
+ 387:	e8 04 04 00 00       	call   790 <close>
+ 38c:	83 c4 10             	add    $0x10,%esp
+ 38f:	e9 cc fd ff ff       	jmp    160 <run+0xd0>
+    printf(1, "\t");
+ 394:	83 ec 08             	sub    $0x8,%esp
+ 397:	68 c6 0f 00 00       	push   $0xfc6
+ 39c:	6a 01                	push   $0x1
+ 39e:	e8 cd 05 00 00       	call   970 <printf>
+ 3a3:	83 c4 10             	add    $0x10,%esp
+ 3a6:	eb b2                	jmp    35a <run+0x2ca>
+      sched_setaffinity(0, 1 << i);
+ 3a8:	89 f1                	mov    %esi,%ecx
+ 3aa:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3af:	83 ec 08             	sub    $0x8,%esp
+ 3b2:	d3 e0                	shl    %cl,%eax
+ 3b4:	50                   	push   %eax
+ 3b5:	6a 00                	push   $0x0
+ 3b7:	e8 cc 04 00 00       	call   888 <sched_setaffinity>
+      close(start[1]);
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	ff b5 bc fe ff ff    	push   -0x144(%ebp)
+ 3c3:	e8 c8 03 00 00       	call   790 <close>
+      read(start[0], &c, 1);
+ 3c8:	83 c4 0c             	add    $0xc,%esp
+ 3cb:	8d 85 b7 fe ff ff    	lea    -0x149(%ebp),%eax
+ 3d1:	6a 01                	push   $0x1
+ 3d3:	50                   	push   %eax
+ 3d4:	ff b5 b8 fe ff ff    	push   -0x148(%ebp)
+ 3da:	e8 a1 03 00 00       	call   780 <read>
+      if(kbench(KB_LOCKTAS + kind, &r[0], 1) != 1)
+ 3df:	83 c4 0c             	add    $0xc,%esp
+ 3e2:	8d 85 c8 fe ff ff    	lea    -0x138(%ebp),%eax
+ 3e8:	6a 01                	push   $0x1
+ 3ea:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+ 3f0:	50                   	push   %eax
+ 3f1:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+ 3f7:	83 c0 03             	add    $0x3,%eax
+ 3fa:	50                   	push   %eax
+ 3fb:	e8 68 04 00 00       	call   868 <kbench>
+ 400:	83 c4 10             	add    $0x10,%esp
+ 403:	83 f8 01             	cmp    $0x1,%eax
+ 406:	74 1e                	je     426 <run+0x396>
+        r[0].ops = r[0].cycles = 0;
+ 408:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%ebp)
+ 40f:	00 00 00 
+ 412:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%ebp)
+ 419:	00 00 00 
+ 41c:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%ebp)
+ 423:	00 00 00 
+      write(done[1], &r[0], sizeof(r[0]));
+ 426:	83 ec 04             	sub    $0x4,%esp
+ 429:	6a 24                	push   $0x24
+ 42b:	ff b5 94 fe ff ff    	push   -0x16c(%ebp)
+ 431:	ff b5 c4 fe ff ff    	push   -0x13c(%ebp)
+ 437:	e8 4c 03 00 00       	call   788 <write>
+      exit();
+ 43c:	e8 27 03 00 00       	call   768 <exit>
+    printf(2, "lockbench: pipe failed\n");
+ 441:	56                   	push   %esi
+ 442:	56                   	push   %esi
+ 443:	68 a0 0f 00 00       	push   $0xfa0
+ 448:	6a 02                	push   $0x2
+ 44a:	e8 21 05 00 00       	call   970 <printf>
+    exit();
+ 44f:	e8 14 03 00 00       	call   768 <exit>
+ 454:	66 90                	xchg   %ax,%ax
+ 456:	66 90                	xchg   %ax,%ax
+ 458:	66 90                	xchg   %ax,%ax
+ 45a:	66 90                	xchg   %ax,%ax
+ 45c:	66 90                	xchg   %ax,%ax
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 460:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 461:	31 c0                	xor    %eax,%eax
+{
+ 463:	89 e5                	mov    %esp,%ebp
+ 465:	53                   	push   %ebx
+ 466:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 469:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 470:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 474:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 477:	83 c0 01             	add    $0x1,%eax
+ 47a:	84 d2                	test   %dl,%dl
+ 47c:	75 f2                	jne    470 <strcpy+0x10>
+    ;
+  return os;
+}
+ 47e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 481:	89 c8                	mov    %ecx,%eax
+ 483:	c9                   	leave
+ 484:	c3                   	ret
+ 485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+ 497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 49a:	0f b6 02             	movzbl (%edx),%eax
+ 49d:	84 c0                	test   %al,%al
+ 49f:	75 17                	jne    4b8 <strcmp+0x28>
+ 4a1:	eb 3a                	jmp    4dd <strcmp+0x4d>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4ac:	83 c2 01             	add    $0x1,%edx
+ 4af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4b2:	84 c0                	test   %al,%al
+ 4b4:	74 1a                	je     4d0 <strcmp+0x40>
+    p++, q++;
+ 4b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4bb:	38 c3                	cmp    %al,%bl
+ 4bd:	74 e9                	je     4a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4bf:	29 d8                	sub    %ebx,%eax
+}
+ 4c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c4:	c9                   	leave
+ 4c5:	c3                   	ret
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4d4:	31 c0                	xor    %eax,%eax
+ 4d6:	29 d8                	sub    %ebx,%eax
+}
+ 4d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4db:	c9                   	leave
+ 4dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4e0:	31 c0                	xor    %eax,%eax
+ 4e2:	eb db                	jmp    4bf <strcmp+0x2f>
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4f9:	74 15                	je     510 <strlen+0x20>
+ 4fb:	31 c0                	xor    %eax,%eax
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 500:	83 c0 01             	add    $0x1,%eax
+ 503:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 507:	89 c1                	mov    %eax,%ecx
+ 509:	75 f5                	jne    500 <strlen+0x10>
+    ;
+  return n;
+}
+ 50b:	89 c8                	mov    %ecx,%eax
+ 50d:	5d                   	pop    %ebp
+ 50e:	c3                   	ret
+ 50f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 510:	31 c9                	xor    %ecx,%ecx
+}
+ 512:	5d                   	pop    %ebp
+ 513:	89 c8                	mov    %ecx,%eax
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 527:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 52a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 52d:	89 d7                	mov    %edx,%edi
+ 52f:	fc                   	cld
+ 530:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 532:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	c9                   	leave
+ 538:	c3                   	ret
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 54a:	0f b6 10             	movzbl (%eax),%edx
+ 54d:	84 d2                	test   %dl,%dl
+ 54f:	75 12                	jne    563 <strchr+0x23>
+ 551:	eb 1d                	jmp    570 <strchr+0x30>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 55c:	83 c0 01             	add    $0x1,%eax
+ 55f:	84 d2                	test   %dl,%dl
+ 561:	74 0d                	je     570 <strchr+0x30>
+    if(*s == c)
+ 563:	38 d1                	cmp    %dl,%cl
+ 565:	75 f1                	jne    558 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 567:	5d                   	pop    %ebp
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 570:	31 c0                	xor    %eax,%eax
+}
+ 572:	5d                   	pop    %ebp
+ 573:	c3                   	ret
+ 574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 585:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 588:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 589:	31 db                	xor    %ebx,%ebx
+{
+ 58b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 58e:	eb 27                	jmp    5b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	6a 01                	push   $0x1
+ 595:	56                   	push   %esi
+ 596:	6a 00                	push   $0x0
+ 598:	e8 e3 01 00 00       	call   780 <read>
+    if(cc < 1)
+ 59d:	83 c4 10             	add    $0x10,%esp
+ 5a0:	85 c0                	test   %eax,%eax
+ 5a2:	7e 1d                	jle    5c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5af:	3c 0a                	cmp    $0xa,%al
+ 5b1:	74 10                	je     5c3 <gets+0x43>
+ 5b3:	3c 0d                	cmp    $0xd,%al
+ 5b5:	74 0c                	je     5c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5b7:	89 df                	mov    %ebx,%edi
+ 5b9:	83 c3 01             	add    $0x1,%ebx
+ 5bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5bf:	7c cf                	jl     590 <gets+0x10>
+ 5c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5cd:	5b                   	pop    %ebx
+ 5ce:	5e                   	pop    %esi
+ 5cf:	5f                   	pop    %edi
+ 5d0:	5d                   	pop    %ebp
+ 5d1:	c3                   	ret
+ 5d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	56                   	push   %esi
+ 5e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5e5:	83 ec 08             	sub    $0x8,%esp
+ 5e8:	6a 00                	push   $0x0
+ 5ea:	ff 75 08             	push   0x8(%ebp)
+ 5ed:	e8 b6 01 00 00       	call   7a8 <open>
+  if(fd < 0)
+ 5f2:	83 c4 10             	add    $0x10,%esp
+ 5f5:	85 c0                	test   %eax,%eax
+ 5f7:	78 27                	js     620 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5f9:	83 ec 08             	sub    $0x8,%esp
+ 5fc:	ff 75 0c             	push   0xc(%ebp)
+ 5ff:	89 c3                	mov    %eax,%ebx
+ 601:	50                   	push   %eax
+ 602:	e8 b9 01 00 00       	call   7c0 <fstat>
+  close(fd);
+ 607:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 60a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 60c:	e8 7f 01 00 00       	call   790 <close>
+  return r;
+ 611:	83 c4 10             	add    $0x10,%esp
+}
+ 614:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 617:	89 f0                	mov    %esi,%eax
+ 619:	5b                   	pop    %ebx
+ 61a:	5e                   	pop    %esi
+ 61b:	5d                   	pop    %ebp
+ 61c:	c3                   	ret
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 620:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 625:	eb ed                	jmp    614 <stat+0x34>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+
+00000630 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 637:	0f be 02             	movsbl (%edx),%eax
+ 63a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 63d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 645:	77 1e                	ja     665 <atoi+0x35>
+ 647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 650:	83 c2 01             	add    $0x1,%edx
+ 653:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 656:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 65a:	0f be 02             	movsbl (%edx),%eax
+ 65d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 660:	80 fb 09             	cmp    $0x9,%bl
+ 663:	76 eb                	jbe    650 <atoi+0x20>
+  return n;
+}
+ 665:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 668:	89 c8                	mov    %ecx,%eax
+ 66a:	c9                   	leave
+ 66b:	c3                   	ret
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	8b 45 10             	mov    0x10(%ebp),%eax
+ 678:	8b 55 08             	mov    0x8(%ebp),%edx
+ 67b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 67e:	85 c0                	test   %eax,%eax
+ 680:	7e 13                	jle    695 <memmove+0x25>
+ 682:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 684:	89 d7                	mov    %edx,%edi
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 690:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 691:	39 f8                	cmp    %edi,%eax
+ 693:	75 fb                	jne    690 <memmove+0x20>
+  return vdst;
+}
+ 695:	5e                   	pop    %esi
+ 696:	89 d0                	mov    %edx,%eax
+ 698:	5f                   	pop    %edi
+ 699:	5d                   	pop    %ebp
+ 69a:	c3                   	ret
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+
+000006a0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	31 d2                	xor    %edx,%edx
+ 6a3:	89 e5                	mov    %esp,%ebp
+ 6a5:	53                   	push   %ebx
+ 6a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 6a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 6ac:	f7 f3                	div    %ebx
+ 6ae:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 6b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 6b8:	89 ca                	mov    %ecx,%edx
+}
+ 6ba:	c9                   	leave
+ 6bb:	c3                   	ret
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 6c0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 6c2:	c3                   	ret
+ 6c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006d0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 6d9:	8b 35 80 14 00 00    	mov    0x1480,%esi
+{
+ 6df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 6e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 6e5:	85 f6                	test   %esi,%esi
+ 6e7:	74 2f                	je     718 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 6e9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 6ee:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 6f4:	f7 e3                	mul    %ebx
+ 6f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 6f9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 6fc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	f7 f6                	div    %esi
+ 703:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 705:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 708:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 70b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 70d:	89 da                	mov    %ebx,%edx
+}
+ 70f:	5b                   	pop    %ebx
+ 710:	5e                   	pop    %esi
+ 711:	5f                   	pop    %edi
+ 712:	5d                   	pop    %ebp
+ 713:	c3                   	ret
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 718:	e8 0b 01 00 00       	call   828 <tscfreq>
+ 71d:	a3 80 14 00 00       	mov    %eax,0x1480
+ 722:	89 c6                	mov    %eax,%esi
+ 724:	eb c3                	jmp    6e9 <cyc2ns+0x19>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	53                   	push   %ebx
+ 734:	83 ec 10             	sub    $0x10,%esp
+ 737:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 73a:	6a 00                	push   $0x0
+ 73c:	e8 3f 01 00 00       	call   880 <getpriority>
+ 741:	5a                   	pop    %edx
+ 742:	59                   	pop    %ecx
+ 743:	01 d8                	add    %ebx,%eax
+ 745:	50                   	push   %eax
+ 746:	6a 00                	push   $0x0
+ 748:	e8 2b 01 00 00       	call   878 <setpriority>
+  return getpriority(0);
+ 74d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 754:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 757:	83 c4 10             	add    $0x10,%esp
+}
+ 75a:	c9                   	leave
+  return getpriority(0);
+ 75b:	e9 20 01 00 00       	jmp    880 <getpriority>
+
+00000760 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 760:	b8 01 00 00 00       	mov    $0x1,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <exit>:
+SYSCALL(exit)
+ 768:	b8 02 00 00 00       	mov    $0x2,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <wait>:
+SYSCALL(wait)
+ 770:	b8 03 00 00 00       	mov    $0x3,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <pipe>:
+SYSCALL(pipe)
+ 778:	b8 04 00 00 00       	mov    $0x4,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <read>:
+SYSCALL(read)
+ 780:	b8 05 00 00 00       	mov    $0x5,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <write>:
+SYSCALL(write)
+ 788:	b8 10 00 00 00       	mov    $0x10,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <close>:
+SYSCALL(close)
+ 790:	b8 15 00 00 00       	mov    $0x15,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+
+00000798 <kill>:
+SYSCALL(kill)
+ 798:	b8 06 00 00 00       	mov    $0x6,%eax
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <exec>:
+SYSCALL(exec)
+ 7a0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+
+000007a8 <open>:
+SYSCALL(open)
+ 7a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7ad:	cd 40                	int    $0x40
+ 7af:	c3                   	ret
+
+000007b0 <mknod>:
+SYSCALL(mknod)
+ 7b0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7b5:	cd 40                	int    $0x40
+ 7b7:	c3                   	ret
+
+000007b8 <unlink>:
+SYSCALL(unlink)
+ 7b8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7bd:	cd 40                	int    $0x40
+ 7bf:	c3                   	ret
+
+000007c0 <fstat>:
+SYSCALL(fstat)
+ 7c0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7c5:	cd 40                	int    $0x40
+ 7c7:	c3                   	ret
+
+000007c8 <link>:
+SYSCALL(link)
+ 7c8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7cd:	cd 40                	int    $0x40
+ 7cf:	c3                   	ret
+
+000007d0 <mkdir>:
+SYSCALL(mkdir)
+ 7d0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7d5:	cd 40                	int    $0x40
+ 7d7:	c3                   	ret
+
+000007d8 <chdir>:
+SYSCALL(chdir)
+ 7d8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7dd:	cd 40                	int    $0x40
+ 7df:	c3                   	ret
+
+000007e0 <dup>:
+SYSCALL(dup)
+ 7e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7e5:	cd 40                	int    $0x40
+ 7e7:	c3                   	ret
+
+000007e8 <getpid>:
+SYSCALL(getpid)
+ 7e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7ed:	cd 40                	int    $0x40
+ 7ef:	c3                   	ret
+
+000007f0 <sbrk>:
+SYSCALL(sbrk)
+ 7f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7f5:	cd 40                	int    $0x40
+ 7f7:	c3                   	ret
+
+000007f8 <sleep>:
+SYSCALL(sleep)
+ 7f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7fd:	cd 40                	int    $0x40
+ 7ff:	c3                   	ret
+
+00000800 <uptime>:
+SYSCALL(uptime)
+ 800:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 805:	cd 40                	int    $0x40
+ 807:	c3                   	ret
+
+00000808 <promote>:
+
+SYSCALL(promote)
+ 808:	b8 18 00 00 00       	mov    $0x18,%eax
+ 80d:	cd 40                	int    $0x40
+ 80f:	c3                   	ret
+
+00000810 <demote>:
+SYSCALL(demote)
+ 810:	b8 19 00 00 00       	mov    $0x19,%eax
+ 815:	cd 40                	int    $0x40
+ 817:	c3                   	ret
+
+00000818 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 818:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 81d:	cd 40                	int    $0x40
+ 81f:	c3                   	ret
+
+00000820 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 820:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 825:	cd 40                	int    $0x40
+ 827:	c3                   	ret
+
+00000828 <tscfreq>:
+SYSCALL(tscfreq)
+ 828:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 82d:	cd 40                	int    $0x40
+ 82f:	c3                   	ret
+
+00000830 <tracemask>:
+SYSCALL(tracemask)
+ 830:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 835:	cd 40                	int    $0x40
+ 837:	c3                   	ret
+
+00000838 <traceread>:
+SYSCALL(traceread)
+ 838:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 83d:	cd 40                	int    $0x40
+ 83f:	c3                   	ret
+
+00000840 <profile>:
+SYSCALL(profile)
+ 840:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 845:	cd 40                	int    $0x40
+ 847:	c3                   	ret
+
+00000848 <profread>:
+SYSCALL(profread)
+ 848:	b8 20 00 00 00       	mov    $0x20,%eax
+ 84d:	cd 40                	int    $0x40
+ 84f:	c3                   	ret
+
+00000850 <lockstat>:
+SYSCALL(lockstat)
+ 850:	b8 21 00 00 00       	mov    $0x21,%eax
+ 855:	cd 40                	int    $0x40
+ 857:	c3                   	ret
+
+00000858 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 858:	b8 22 00 00 00       	mov    $0x22,%eax
+ 85d:	cd 40                	int    $0x40
+ 85f:	c3                   	ret
+
+00000860 <sysstat>:
+SYSCALL(sysstat)
+ 860:	b8 23 00 00 00       	mov    $0x23,%eax
+ 865:	cd 40                	int    $0x40
+ 867:	c3                   	ret
+
+00000868 <kbench>:
+SYSCALL(kbench)
+ 868:	b8 24 00 00 00       	mov    $0x24,%eax
+ 86d:	cd 40                	int    $0x40
+ 86f:	c3                   	ret
+
+00000870 <yield>:
+SYSCALL(yield)
+ 870:	b8 25 00 00 00       	mov    $0x25,%eax
+ 875:	cd 40                	int    $0x40
+ 877:	c3                   	ret
+
+00000878 <setpriority>:
+SYSCALL(setpriority)
+ 878:	b8 26 00 00 00       	mov    $0x26,%eax
+ 87d:	cd 40                	int    $0x40
+ 87f:	c3                   	ret
+
+00000880 <getpriority>:
+SYSCALL(getpriority)
+ 880:	b8 27 00 00 00       	mov    $0x27,%eax
+ 885:	cd 40                	int    $0x40
+ 887:	c3                   	ret
+
+00000888 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 888:	b8 28 00 00 00       	mov    $0x28,%eax
+ 88d:	cd 40                	int    $0x40
+ 88f:	c3                   	ret
+
+00000890 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 890:	b8 29 00 00 00       	mov    $0x29,%eax
+ 895:	cd 40                	int    $0x40
+ 897:	c3                   	ret
+
+00000898 <clone>:
+SYSCALL(clone)
+ 898:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 89d:	cd 40                	int    $0x40
+ 89f:	c3                   	ret
+
+000008a0 <join>:
+SYSCALL(join)
+ 8a0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8a5:	cd 40                	int    $0x40
+ 8a7:	c3                   	ret
+
+000008a8 <futex_wait>:
+SYSCALL(futex_wait)
+ 8a8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8ad:	cd 40                	int    $0x40
+ 8af:	c3                   	ret
+
+000008b0 <futex_wake>:
+SYSCALL(futex_wake)
+ 8b0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8b5:	cd 40                	int    $0x40
+ 8b7:	c3                   	ret
+
+000008b8 <spawn>:
+SYSCALL(spawn)
+ 8b8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 8bd:	cd 40                	int    $0x40
+ 8bf:	c3                   	ret
+
+000008c0 <diskstat>:
+SYSCALL(diskstat)
+ 8c0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 8c5:	cd 40                	int    $0x40
+ 8c7:	c3                   	ret
+ 8c8:	66 90                	xchg   %ax,%ax
+ 8ca:	66 90                	xchg   %ax,%ax
+ 8cc:	66 90                	xchg   %ax,%ax
+ 8ce:	66 90                	xchg   %ax,%ax
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 8c 10 00 00 	movzbl 0x108c(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 3b fe ff ff       	call   788 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 d1 fd ff ff       	call   788 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 34 10 00 00 	jmp    *0x1034(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 72 fd ff ff       	call   788 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 60 fd ff ff       	call   788 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 e6 fc ff ff       	call   788 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 96 fc ff ff       	call   788 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 2c 10 00 00       	mov    $0x102c,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b21:	a1 84 14 00 00       	mov    0x1484,%eax
+{
+ b26:	89 e5                	mov    %esp,%ebp
+ b28:	57                   	push   %edi
+ b29:	56                   	push   %esi
+ b2a:	53                   	push   %ebx
+ b2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b3c:	39 ca                	cmp    %ecx,%edx
+ b3e:	73 30                	jae    b70 <free+0x50>
+ b40:	39 c1                	cmp    %eax,%ecx
+ b42:	72 04                	jb     b48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b44:	39 c2                	cmp    %eax,%edx
+ b46:	72 f0                	jb     b38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b4e:	39 f8                	cmp    %edi,%eax
+ b50:	74 2e                	je     b80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b55:	8b 42 04             	mov    0x4(%edx),%eax
+ b58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b5b:	39 f1                	cmp    %esi,%ecx
+ b5d:	74 38                	je     b97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b61:	5b                   	pop    %ebx
+  freep = p;
+ b62:	89 15 84 14 00 00    	mov    %edx,0x1484
+}
+ b68:	5e                   	pop    %esi
+ b69:	5f                   	pop    %edi
+ b6a:	5d                   	pop    %ebp
+ b6b:	c3                   	ret
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 d0                	jb     b44 <free+0x24>
+ b74:	eb c2                	jmp    b38 <free+0x18>
+ b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b80:	03 70 04             	add    0x4(%eax),%esi
+ b83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b86:	8b 02                	mov    (%edx),%eax
+ b88:	8b 00                	mov    (%eax),%eax
+ b8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b8d:	8b 42 04             	mov    0x4(%edx),%eax
+ b90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b93:	39 f1                	cmp    %esi,%ecx
+ b95:	75 c8                	jne    b5f <free+0x3f>
+    p->s.size += bp->s.size;
+ b97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b9a:	89 15 84 14 00 00    	mov    %edx,0x1484
+    p->s.size += bp->s.size;
+ ba0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ba3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ba6:	89 0a                	mov    %ecx,(%edx)
+}
+ ba8:	5b                   	pop    %ebx
+ ba9:	5e                   	pop    %esi
+ baa:	5f                   	pop    %edi
+ bab:	5d                   	pop    %ebp
+ bac:	c3                   	ret
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	57                   	push   %edi
+ bb4:	56                   	push   %esi
+ bb5:	53                   	push   %ebx
+ bb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bbc:	8b 15 84 14 00 00    	mov    0x1484,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc2:	8d 78 07             	lea    0x7(%eax),%edi
+ bc5:	c1 ef 03             	shr    $0x3,%edi
+ bc8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bcb:	85 d2                	test   %edx,%edx
+ bcd:	0f 84 8d 00 00 00    	je     c60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bd5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bd8:	39 f9                	cmp    %edi,%ecx
+ bda:	73 64                	jae    c40 <malloc+0x90>
+  if(nu < 4096)
+ bdc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ be1:	39 df                	cmp    %ebx,%edi
+ be3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ be6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bed:	eb 0a                	jmp    bf9 <malloc+0x49>
+ bef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bf2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bf5:	39 f9                	cmp    %edi,%ecx
+ bf7:	73 47                	jae    c40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bf9:	89 c2                	mov    %eax,%edx
+ bfb:	39 05 84 14 00 00    	cmp    %eax,0x1484
+ c01:	75 ed                	jne    bf0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c03:	83 ec 0c             	sub    $0xc,%esp
+ c06:	56                   	push   %esi
+ c07:	e8 e4 fb ff ff       	call   7f0 <sbrk>
+  if(p == (char*)-1)
+ c0c:	83 c4 10             	add    $0x10,%esp
+ c0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c12:	74 1c                	je     c30 <malloc+0x80>
+  hp->s.size = nu;
+ c14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c17:	83 ec 0c             	sub    $0xc,%esp
+ c1a:	83 c0 08             	add    $0x8,%eax
+ c1d:	50                   	push   %eax
+ c1e:	e8 fd fe ff ff       	call   b20 <free>
+  return freep;
+ c23:	8b 15 84 14 00 00    	mov    0x1484,%edx
+      if((p = morecore(nunits)) == 0)
+ c29:	83 c4 10             	add    $0x10,%esp
+ c2c:	85 d2                	test   %edx,%edx
+ c2e:	75 c0                	jne    bf0 <malloc+0x40>
+        return 0;
+  }
+}
+ c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c33:	31 c0                	xor    %eax,%eax
+}
+ c35:	5b                   	pop    %ebx
+ c36:	5e                   	pop    %esi
+ c37:	5f                   	pop    %edi
+ c38:	5d                   	pop    %ebp
+ c39:	c3                   	ret
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c40:	39 cf                	cmp    %ecx,%edi
+ c42:	74 4c                	je     c90 <malloc+0xe0>
+        p->s.size -= nunits;
+ c44:	29 f9                	sub    %edi,%ecx
+ c46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c4f:	89 15 84 14 00 00    	mov    %edx,0x1484
+}
+ c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c58:	83 c0 08             	add    $0x8,%eax
+}
+ c5b:	5b                   	pop    %ebx
+ c5c:	5e                   	pop    %esi
+ c5d:	5f                   	pop    %edi
+ c5e:	5d                   	pop    %ebp
+ c5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c60:	c7 05 84 14 00 00 88 	movl   $0x1488,0x1484
+ c67:	14 00 00 
+    base.s.size = 0;
+ c6a:	b8 88 14 00 00       	mov    $0x1488,%eax
+    base.s.ptr = freep = prevp = &base;
+ c6f:	c7 05 88 14 00 00 88 	movl   $0x1488,0x1488
+ c76:	14 00 00 
+    base.s.size = 0;
+ c79:	c7 05 8c 14 00 00 00 	movl   $0x0,0x148c
+ c80:	00 00 00 
+    if(p->s.size >= nunits){
+ c83:	e9 54 ff ff ff       	jmp    bdc <malloc+0x2c>
+ c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c90:	8b 08                	mov    (%eax),%ecx
+ c92:	89 0a                	mov    %ecx,(%edx)
+ c94:	eb b9                	jmp    c4f <malloc+0x9f>
+ c96:	66 90                	xchg   %ax,%ax
+ c98:	66 90                	xchg   %ax,%ax
+ c9a:	66 90                	xchg   %ax,%ax
+ c9c:	66 90                	xchg   %ax,%ax
+ c9e:	66 90                	xchg   %ax,%ax
+
+00000ca0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	57                   	push   %edi
+ ca4:	56                   	push   %esi
+ ca5:	53                   	push   %ebx
+ ca6:	83 ec 20             	sub    $0x20,%esp
+ ca9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ cac:	8b 7d 10             	mov    0x10(%ebp),%edi
+ caf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ cb2:	68 e8 03 00 00       	push   $0x3e8
+ cb7:	57                   	push   %edi
+ cb8:	56                   	push   %esi
+ cb9:	e8 e2 f9 ff ff       	call   6a0 <udiv64>
+ cbe:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ cc0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ cc3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ cc9:	29 c1                	sub    %eax,%ecx
+ ccb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ cce:	68 e8 03 00 00       	push   $0x3e8
+ cd3:	57                   	push   %edi
+ cd4:	56                   	push   %esi
+ cd5:	e8 c6 f9 ff ff       	call   6a0 <udiv64>
+ cda:	83 c4 0c             	add    $0xc,%esp
+ cdd:	50                   	push   %eax
+ cde:	68 9d 10 00 00       	push   $0x109d
+ ce3:	53                   	push   %ebx
+ ce4:	e8 87 fc ff ff       	call   970 <printf>
+  if(frac < 100)
+ ce9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	83 f9 63             	cmp    $0x63,%ecx
+ cf2:	76 1c                	jbe    d10 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ cf4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ cf7:	c7 45 0c bd 0f 00 00 	movl   $0xfbd,0xc(%ebp)
+ cfe:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ d01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d04:	5b                   	pop    %ebx
+ d05:	5e                   	pop    %esi
+ d06:	5f                   	pop    %edi
+ d07:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ d08:	e9 63 fc ff ff       	jmp    970 <printf>
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ d10:	83 ec 08             	sub    $0x8,%esp
+ d13:	68 a1 10 00 00       	push   $0x10a1
+ d18:	53                   	push   %ebx
+ d19:	e8 52 fc ff ff       	call   970 <printf>
+  if(frac < 10)
+ d1e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ d21:	83 c4 10             	add    $0x10,%esp
+ d24:	83 f9 09             	cmp    $0x9,%ecx
+ d27:	77 cb                	ja     cf4 <printps+0x54>
+    printf(fd, "0");
+ d29:	83 ec 08             	sub    $0x8,%esp
+ d2c:	68 a1 10 00 00       	push   $0x10a1
+ d31:	53                   	push   %ebx
+ d32:	e8 39 fc ff ff       	call   970 <printf>
+ d37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ d3a:	83 c4 10             	add    $0x10,%esp
+ d3d:	eb b5                	jmp    cf4 <printps+0x54>
+ d3f:	90                   	nop
+
+00000d40 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+ d46:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ d4c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ d4f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ d52:	83 e8 01             	sub    $0x1,%eax
+ d55:	3d ff 00 00 00       	cmp    $0xff,%eax
+ d5a:	0f 87 37 02 00 00    	ja     f97 <bench+0x257>
+ d60:	8b 7d 14             	mov    0x14(%ebp),%edi
+ d63:	85 ff                	test   %edi,%edi
+ d65:	0f 84 2c 02 00 00    	je     f97 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ d6b:	83 ec 0c             	sub    $0xc,%esp
+ d6e:	ff 75 10             	push   0x10(%ebp)
+ d71:	ff 55 0c             	call   *0xc(%ebp)
+ d74:	5b                   	pop    %ebx
+ d75:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ d78:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ d7a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ d7d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ d80:	83 c4 10             	add    $0x10,%esp
+ d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d87:	90                   	nop
+    t0 = cycles();
+ d88:	e8 33 f9 ff ff       	call   6c0 <cycles>
+    fn(arg);
+ d8d:	83 ec 0c             	sub    $0xc,%esp
+ d90:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ d93:	89 c6                	mov    %eax,%esi
+ d95:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ d97:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ d9a:	e8 21 f9 ff ff       	call   6c0 <cycles>
+ d9f:	29 f0                	sub    %esi,%eax
+ da1:	19 fa                	sbb    %edi,%edx
+ da3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ daa:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ dad:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ db4:	83 c3 01             	add    $0x1,%ebx
+ db7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ dba:	7f cc                	jg     d88 <bench+0x48>
+  for(i = 1; i < n; i++){
+ dbc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ dc0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ dc3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ dc9:	bf 01 00 00 00       	mov    $0x1,%edi
+ dce:	74 77                	je     e47 <bench+0x107>
+ dd0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dd7:	90                   	nop
+    v = a[i];
+ dd8:	8b 01                	mov    (%ecx),%eax
+ dda:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ ddd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ de3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ de9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ def:	89 c8                	mov    %ecx,%eax
+ df1:	eb 1b                	jmp    e0e <bench+0xce>
+ df3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ df7:	90                   	nop
+      a[j] = a[j-1];
+ df8:	89 08                	mov    %ecx,(%eax)
+ dfa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ dfd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ e00:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ e06:	39 c3                	cmp    %eax,%ebx
+ e08:	0f 84 72 01 00 00    	je     f80 <bench+0x240>
+ e0e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ e11:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ e14:	89 f7                	mov    %esi,%edi
+ e16:	89 c3                	mov    %eax,%ebx
+ e18:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ e1e:	19 d7                	sbb    %edx,%edi
+ e20:	72 d6                	jb     df8 <bench+0xb8>
+ e22:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ e28:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ e2e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ e34:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ e37:	83 c7 01             	add    $0x1,%edi
+ e3a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ e3d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ e3f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ e42:	75 94                	jne    dd8 <bench+0x98>
+ e44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e47:	83 ec 08             	sub    $0x8,%esp
+ e4a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ e50:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ e55:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ e5b:	e8 70 f8 ff ff       	call   6d0 <cyc2ns>
+ e60:	83 c4 0c             	add    $0xc,%esp
+ e63:	ff 75 14             	push   0x14(%ebp)
+ e66:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ e6c:	f7 e3                	mul    %ebx
+ e6e:	01 ca                	add    %ecx,%edx
+ e70:	52                   	push   %edx
+ e71:	50                   	push   %eax
+ e72:	e8 29 f8 ff ff       	call   6a0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ e77:	89 06                	mov    %eax,(%esi)
+ e79:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e7c:	5f                   	pop    %edi
+ e7d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ e7e:	8b 45 18             	mov    0x18(%ebp),%eax
+ e81:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e83:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ e8a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ e91:	e8 3a f8 ff ff       	call   6d0 <cyc2ns>
+ e96:	83 c4 0c             	add    $0xc,%esp
+ e99:	ff 75 14             	push   0x14(%ebp)
+ e9c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ea2:	f7 e3                	mul    %ebx
+ ea4:	01 ca                	add    %ecx,%edx
+ ea6:	52                   	push   %edx
+ ea7:	50                   	push   %eax
+ ea8:	e8 f3 f7 ff ff       	call   6a0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ ead:	89 46 08             	mov    %eax,0x8(%esi)
+ eb0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ eb3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ eb4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ eb7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ eb8:	8d 50 01             	lea    0x1(%eax),%edx
+ ebb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ ec0:	6b d2 63             	imul   $0x63,%edx,%edx
+ ec3:	f7 e2                	mul    %edx
+ ec5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ec8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ ecf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ ed6:	e8 f5 f7 ff ff       	call   6d0 <cyc2ns>
+ edb:	83 c4 0c             	add    $0xc,%esp
+ ede:	ff 75 14             	push   0x14(%ebp)
+ ee1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ee7:	f7 e3                	mul    %ebx
+ ee9:	01 ca                	add    %ecx,%edx
+ eeb:	52                   	push   %edx
+ eec:	50                   	push   %eax
+ eed:	e8 ae f7 ff ff       	call   6a0 <udiv64>
+
+  if(name){
+ ef2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ ef5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ef8:	89 46 10             	mov    %eax,0x10(%esi)
+ efb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ efe:	85 c9                	test   %ecx,%ecx
+ f00:	74 72                	je     f74 <bench+0x234>
+    printf(1, "%s: min ", name);
+ f02:	83 ec 04             	sub    $0x4,%esp
+ f05:	ff 75 08             	push   0x8(%ebp)
+ f08:	68 a3 10 00 00       	push   $0x10a3
+ f0d:	6a 01                	push   $0x1
+ f0f:	e8 5c fa ff ff       	call   970 <printf>
+    printps(1, st->min);
+ f14:	83 c4 0c             	add    $0xc,%esp
+ f17:	ff 76 04             	push   0x4(%esi)
+ f1a:	ff 36                	push   (%esi)
+ f1c:	6a 01                	push   $0x1
+ f1e:	e8 7d fd ff ff       	call   ca0 <printps>
+    printf(1, " median ");
+ f23:	58                   	pop    %eax
+ f24:	5a                   	pop    %edx
+ f25:	68 ac 10 00 00       	push   $0x10ac
+ f2a:	6a 01                	push   $0x1
+ f2c:	e8 3f fa ff ff       	call   970 <printf>
+    printps(1, st->median);
+ f31:	83 c4 0c             	add    $0xc,%esp
+ f34:	ff 76 0c             	push   0xc(%esi)
+ f37:	ff 76 08             	push   0x8(%esi)
+ f3a:	6a 01                	push   $0x1
+ f3c:	e8 5f fd ff ff       	call   ca0 <printps>
+    printf(1, " p99 ");
+ f41:	59                   	pop    %ecx
+ f42:	5b                   	pop    %ebx
+ f43:	68 b5 10 00 00       	push   $0x10b5
+ f48:	6a 01                	push   $0x1
+ f4a:	e8 21 fa ff ff       	call   970 <printf>
+    printps(1, st->p99);
+ f4f:	83 c4 0c             	add    $0xc,%esp
+ f52:	ff 76 14             	push   0x14(%esi)
+ f55:	ff 76 10             	push   0x10(%esi)
+ f58:	6a 01                	push   $0x1
+ f5a:	e8 41 fd ff ff       	call   ca0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ f5f:	83 c4 0c             	add    $0xc,%esp
+ f62:	ff 75 18             	push   0x18(%ebp)
+ f65:	68 bb 10 00 00       	push   $0x10bb
+ f6a:	6a 01                	push   $0x1
+ f6c:	e8 ff f9 ff ff       	call   970 <printf>
+ f71:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ f74:	31 c0                	xor    %eax,%eax
+}
+ f76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f79:	5b                   	pop    %ebx
+ f7a:	5e                   	pop    %esi
+ f7b:	5f                   	pop    %edi
+ f7c:	5d                   	pop    %ebp
+ f7d:	c3                   	ret
+ f7e:	66 90                	xchg   %ax,%ax
+ f80:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ f86:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ f8c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ f92:	e9 97 fe ff ff       	jmp    e2e <bench+0xee>
+    return -1;
+ f97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f9c:	eb d8                	jmp    f76 <bench+0x236>
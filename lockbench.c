@@ -0,0 +1,86 @@
+// Spinlock throughput and fairness.
+//   lockbench
+// For each kind of kernel spinlock, run one process pinned to
+// each cpu, all hammering the same lock for LOCKMS, and report
+// acquisitions per second and how evenly the cpus shared it.
+
+#include "types.h"
+#include "user.h"
+#include "kbench.h"
+
+#define MAXCPU 8
+
+static char *kinds[] = { "test-and-set", "ticket", "mcs" };
+
+static void
+run(int kind, int ncpu)
+{
+  struct kbresult r[MAXCPU];
+  int start[2], done[2], i, n;
+  uint64 total;
+  uint lo, hi;
+  char c;
+
+  if(pipe(start) < 0 || pipe(done) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < ncpu; i++){
+    if(fork() == 0){
+      sched_setaffinity(0, 1 << i);
+      close(start[1]);
+      read(start[0], &c, 1);
+      if(kbench(KB_LOCKTAS + kind, &r[0], 1) != 1)
+        r[0].ops = r[0].cycles = 0;
+      write(done[1], &r[0], sizeof(r[0]));
+      exit();
+    }
+  }
+  close(start[0]);
+  close(start[1]);   // go
+  for(n = 0; n < ncpu; n++)
+    if(read(done[0], &r[n], sizeof(r[n])) != sizeof(r[n]))
+      break;
+  while(wait() >= 0)
+    ;
+  close(done[0]);
+  close(done[1]);
+
+  total = 0;
+  lo = ~0;
+  hi = 0;
+  for(i = 0; i < n; i++){
+    if(r[i].cycles)
+      total += udiv64((uint64)r[i].ops * 1000000000,
+                      (uint)cyc2ns(r[i].cycles));
+    if(r[i].ops < lo)
+      lo = r[i].ops;
+    if(r[i].ops > hi)
+      hi = r[i].ops;
+  }
+  printf(1, "%s\t", kinds[kind]);
+  if(strlen(kinds[kind]) < 8)
+    printf(1, "\t");
+  printf(1, "%d\t\t%d\t", (uint)total, hi ? (uint)udiv64((uint64)lo * 100, hi) : 0);
+  for(i = 0; i < n; i++)
+    printf(1, " %d", r[i].ops);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int ncpu, kind;
+
+  // Find the cpus by trying to move onto each in turn.
+  for(ncpu = 0; ncpu < MAXCPU; ncpu++)
+    if(sched_setaffinity(0, 1 << ncpu) < 0)
+      break;
+  sched_setaffinity(0, ~0);
+
+  printf(1, "%d cpus, %d ms per run\n", ncpu, LOCKMS);
+  printf(1, "lock\t\tacquires/sec\tmin/max %%\tper cpu\n");
+  for(kind = 0; kind < 3; kind++)
+    run(kind, ncpu);
+  exit();
+}
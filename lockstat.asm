@@ -0,0 +1,1996 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static struct lockstat ls[NCLASS];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 58             	sub    $0x58,%esp
+  struct lockstat v;
+  int i, j, n;
+  uint pct;
+
+  if(argc > 1){
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1){
+  1a:	7e 33                	jle    4f <main+0x4f>
+    if(strcmp(argv[1], "reset") == 0)
+  1c:	52                   	push   %edx
+  1d:	52                   	push   %edx
+  1e:	68 2d 0e 00 00       	push   $0xe2d
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 e5 02 00 00       	call   310 <strcmp>
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	85 c0                	test   %eax,%eax
+  30:	74 16                	je     48 <main+0x48>
+      lockstatreset();
+    else
+      printf(2, "usage: lockstat [reset]\n");
+  32:	57                   	push   %edi
+  33:	57                   	push   %edi
+  34:	68 33 0e 00 00       	push   $0xe33
+  39:	6a 02                	push   $0x2
+  3b:	e8 b0 07 00 00       	call   7f0 <printf>
+  40:	83 c4 10             	add    $0x10,%esp
+    exit();
+  43:	e8 a0 05 00 00       	call   5e8 <exit>
+      lockstatreset();
+  48:	e8 8b 06 00 00       	call   6d8 <lockstatreset>
+  4d:	eb f4                	jmp    43 <main+0x43>
+  }
+
+  if((n = lockstat(ls, NCLASS)) < 0){
+  4f:	56                   	push   %esi
+  50:	56                   	push   %esi
+  51:	6a 40                	push   $0x40
+  53:	68 c0 12 00 00       	push   $0x12c0
+  58:	e8 73 06 00 00       	call   6d0 <lockstat>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  63:	85 c0                	test   %eax,%eax
+  65:	0f 88 3f 02 00 00    	js     2aa <main+0x2aa>
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  for(i = 1; i < n; i++){
+  6b:	83 e8 01             	sub    $0x1,%eax
+  6e:	bf ec 12 00 00       	mov    $0x12ec,%edi
+  73:	b9 01 00 00 00       	mov    $0x1,%ecx
+  78:	0f 8e 3f 02 00 00    	jle    2bd <main+0x2bd>
+  7e:	89 7d ac             	mov    %edi,-0x54(%ebp)
+  81:	89 ce                	mov    %ecx,%esi
+  83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  87:	90                   	nop
+    v = ls[i];
+  88:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  8b:	89 75 a8             	mov    %esi,-0x58(%ebp)
+  8e:	89 f2                	mov    %esi,%edx
+  90:	8b 01                	mov    (%ecx),%eax
+  92:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  95:	8b 41 04             	mov    0x4(%ecx),%eax
+  98:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  9b:	8b 41 08             	mov    0x8(%ecx),%eax
+  9e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  a1:	8b 41 0c             	mov    0xc(%ecx),%eax
+  a4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  a7:	8b 41 10             	mov    0x10(%ecx),%eax
+  aa:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  ad:	8b 41 14             	mov    0x14(%ecx),%eax
+  b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  b3:	8b 41 18             	mov    0x18(%ecx),%eax
+  b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  b9:	8b 41 1c             	mov    0x1c(%ecx),%eax
+  bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  bf:	8b 41 20             	mov    0x20(%ecx),%eax
+  c2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  c5:	89 c8                	mov    %ecx,%eax
+  c7:	8b 49 24             	mov    0x24(%ecx),%ecx
+  ca:	8b 78 28             	mov    0x28(%eax),%edi
+  cd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  d0:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    for(j = i; j > 0 && ls[j-1].wait < v.wait; j--)
+  d6:	eb 52                	jmp    12a <main+0x12a>
+  d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  df:	90                   	nop
+      ls[j] = ls[j-1];
+  e0:	8b 58 d4             	mov    -0x2c(%eax),%ebx
+  e3:	89 70 28             	mov    %esi,0x28(%eax)
+    for(j = i; j > 0 && ls[j-1].wait < v.wait; j--)
+  e6:	83 e8 2c             	sub    $0x2c,%eax
+      ls[j] = ls[j-1];
+  e9:	89 58 2c             	mov    %ebx,0x2c(%eax)
+  ec:	8b 58 04             	mov    0x4(%eax),%ebx
+  ef:	89 58 30             	mov    %ebx,0x30(%eax)
+  f2:	8b 58 08             	mov    0x8(%eax),%ebx
+  f5:	89 58 34             	mov    %ebx,0x34(%eax)
+  f8:	8b 58 0c             	mov    0xc(%eax),%ebx
+  fb:	89 58 38             	mov    %ebx,0x38(%eax)
+  fe:	8b 58 10             	mov    0x10(%eax),%ebx
+ 101:	89 58 3c             	mov    %ebx,0x3c(%eax)
+ 104:	8b 58 14             	mov    0x14(%eax),%ebx
+ 107:	89 58 40             	mov    %ebx,0x40(%eax)
+ 10a:	8b 58 18             	mov    0x18(%eax),%ebx
+ 10d:	89 58 44             	mov    %ebx,0x44(%eax)
+ 110:	8b 58 1c             	mov    0x1c(%eax),%ebx
+ 113:	89 58 48             	mov    %ebx,0x48(%eax)
+ 116:	8b 58 20             	mov    0x20(%eax),%ebx
+ 119:	89 58 4c             	mov    %ebx,0x4c(%eax)
+ 11c:	8b 58 24             	mov    0x24(%eax),%ebx
+ 11f:	89 58 50             	mov    %ebx,0x50(%eax)
+    for(j = i; j > 0 && ls[j-1].wait < v.wait; j--)
+ 122:	85 d2                	test   %edx,%edx
+ 124:	0f 84 76 01 00 00    	je     2a0 <main+0x2a0>
+ 12a:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 12d:	39 48 f8             	cmp    %ecx,-0x8(%eax)
+ 130:	89 d3                	mov    %edx,%ebx
+ 132:	8d 52 ff             	lea    -0x1(%edx),%edx
+ 135:	89 f7                	mov    %esi,%edi
+ 137:	1b 7d b4             	sbb    -0x4c(%ebp),%edi
+ 13a:	72 a4                	jb     e0 <main+0xe0>
+ 13c:	8b 75 a8             	mov    -0x58(%ebp),%esi
+    ls[j] = v;
+ 13f:	6b db 2c             	imul   $0x2c,%ebx,%ebx
+ 142:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  for(i = 1; i < n; i++){
+ 145:	83 45 ac 2c          	addl   $0x2c,-0x54(%ebp)
+ 149:	83 c6 01             	add    $0x1,%esi
+    ls[j] = v;
+ 14c:	89 93 c0 12 00 00    	mov    %edx,0x12c0(%ebx)
+ 152:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ 155:	89 93 c4 12 00 00    	mov    %edx,0x12c4(%ebx)
+ 15b:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 15e:	89 93 c8 12 00 00    	mov    %edx,0x12c8(%ebx)
+ 164:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 167:	89 93 cc 12 00 00    	mov    %edx,0x12cc(%ebx)
+ 16d:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 170:	89 93 d0 12 00 00    	mov    %edx,0x12d0(%ebx)
+ 176:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 179:	89 93 d4 12 00 00    	mov    %edx,0x12d4(%ebx)
+ 17f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 182:	89 93 d8 12 00 00    	mov    %edx,0x12d8(%ebx)
+ 188:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 18b:	89 93 dc 12 00 00    	mov    %edx,0x12dc(%ebx)
+ 191:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 194:	89 93 e0 12 00 00    	mov    %edx,0x12e0(%ebx)
+ 19a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 19d:	89 93 e4 12 00 00    	mov    %edx,0x12e4(%ebx)
+ 1a3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1a6:	89 93 e8 12 00 00    	mov    %edx,0x12e8(%ebx)
+  for(i = 1; i < n; i++){
+ 1ac:	39 75 b0             	cmp    %esi,-0x50(%ebp)
+ 1af:	0f 85 d3 fe ff ff    	jne    88 <main+0x88>
+  }
+
+  printf(1, "lock\t\ttype\tacquire\tcontend\t%%\twait(us)\n");
+ 1b5:	51                   	push   %ecx
+ 1b6:	51                   	push   %ecx
+ 1b7:	68 74 0e 00 00       	push   $0xe74
+ 1bc:	6a 01                	push   $0x1
+ 1be:	e8 2d 06 00 00       	call   7f0 <printf>
+ 1c3:	83 c4 10             	add    $0x10,%esp
+ 1c6:	bf c0 12 00 00       	mov    $0x12c0,%edi
+  for(i = 0; i < n; i++){
+ 1cb:	31 f6                	xor    %esi,%esi
+ 1cd:	e9 8c 00 00 00       	jmp    25e <main+0x25e>
+ 1d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      pct = udiv64(ls[i].ncontended * 100, (uint)ls[i].nacquire);
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+           strlen(ls[i].name) < 8 ? "\t" : "",
+           ls[i].sleep ? "sleep" : "spin",
+           (uint)ls[i].nacquire, (uint)ls[i].ncontended, pct,
+           (uint)udiv64(cyc2ns(ls[i].wait), 1000));
+ 1d8:	83 ec 08             	sub    $0x8,%esp
+ 1db:	ff 77 28             	push   0x28(%edi)
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 1de:	bb 26 0e 00 00       	mov    $0xe26,%ebx
+           (uint)udiv64(cyc2ns(ls[i].wait), 1000));
+ 1e3:	ff 77 24             	push   0x24(%edi)
+ 1e6:	e8 65 03 00 00       	call   550 <cyc2ns>
+ 1eb:	83 c4 0c             	add    $0xc,%esp
+ 1ee:	68 e8 03 00 00       	push   $0x3e8
+ 1f3:	52                   	push   %edx
+ 1f4:	50                   	push   %eax
+ 1f5:	e8 26 03 00 00       	call   520 <udiv64>
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 1fa:	8b 57 14             	mov    0x14(%edi),%edx
+           (uint)udiv64(cyc2ns(ls[i].wait), 1000));
+ 1fd:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 200:	8b 47 1c             	mov    0x1c(%edi),%eax
+ 203:	89 55 a8             	mov    %edx,-0x58(%ebp)
+ 206:	89 45 ac             	mov    %eax,-0x54(%ebp)
+ 209:	8b 47 10             	mov    0x10(%edi),%eax
+           strlen(ls[i].name) < 8 ? "\t" : "",
+ 20c:	89 3c 24             	mov    %edi,(%esp)
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 20f:	85 c0                	test   %eax,%eax
+ 211:	b8 20 0e 00 00       	mov    $0xe20,%eax
+ 216:	0f 45 d8             	cmovne %eax,%ebx
+           strlen(ls[i].name) < 8 ? "\t" : "",
+ 219:	e8 52 01 00 00       	call   370 <strlen>
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 21e:	b9 2b 0e 00 00       	mov    $0xe2b,%ecx
+ 223:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 226:	83 f8 07             	cmp    $0x7,%eax
+ 229:	b8 2c 0e 00 00       	mov    $0xe2c,%eax
+ 22e:	0f 46 c1             	cmovbe %ecx,%eax
+ 231:	89 14 24             	mov    %edx,(%esp)
+  for(i = 0; i < n; i++){
+ 234:	83 c6 01             	add    $0x1,%esi
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 237:	ff 75 b4             	push   -0x4c(%ebp)
+ 23a:	ff 75 ac             	push   -0x54(%ebp)
+ 23d:	ff 75 a8             	push   -0x58(%ebp)
+ 240:	53                   	push   %ebx
+ 241:	50                   	push   %eax
+ 242:	57                   	push   %edi
+  for(i = 0; i < n; i++){
+ 243:	83 c7 2c             	add    $0x2c,%edi
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+ 246:	68 5e 0e 00 00       	push   $0xe5e
+ 24b:	6a 01                	push   $0x1
+ 24d:	e8 9e 05 00 00       	call   7f0 <printf>
+  for(i = 0; i < n; i++){
+ 252:	83 c4 30             	add    $0x30,%esp
+ 255:	39 75 b0             	cmp    %esi,-0x50(%ebp)
+ 258:	0f 84 e5 fd ff ff    	je     43 <main+0x43>
+    if(ls[i].nacquire)
+ 25e:	8b 57 14             	mov    0x14(%edi),%edx
+ 261:	8b 47 18             	mov    0x18(%edi),%eax
+    pct = 0;
+ 264:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+    if(ls[i].nacquire)
+ 26b:	09 d0                	or     %edx,%eax
+ 26d:	0f 84 65 ff ff ff    	je     1d8 <main+0x1d8>
+      pct = udiv64(ls[i].ncontended * 100, (uint)ls[i].nacquire);
+ 273:	83 ec 04             	sub    $0x4,%esp
+ 276:	b8 64 00 00 00       	mov    $0x64,%eax
+ 27b:	52                   	push   %edx
+ 27c:	6b 4f 20 64          	imul   $0x64,0x20(%edi),%ecx
+ 280:	f7 67 1c             	mull   0x1c(%edi)
+ 283:	01 ca                	add    %ecx,%edx
+ 285:	52                   	push   %edx
+ 286:	50                   	push   %eax
+ 287:	e8 94 02 00 00       	call   520 <udiv64>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 292:	e9 41 ff ff ff       	jmp    1d8 <main+0x1d8>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+ 2a0:	8b 75 a8             	mov    -0x58(%ebp),%esi
+ 2a3:	31 db                	xor    %ebx,%ebx
+ 2a5:	e9 95 fe ff ff       	jmp    13f <main+0x13f>
+    printf(2, "lockstat: failed\n");
+ 2aa:	53                   	push   %ebx
+ 2ab:	53                   	push   %ebx
+ 2ac:	68 4c 0e 00 00       	push   $0xe4c
+ 2b1:	6a 02                	push   $0x2
+ 2b3:	e8 38 05 00 00       	call   7f0 <printf>
+    exit();
+ 2b8:	e8 2b 03 00 00       	call   5e8 <exit>
+  printf(1, "lock\t\ttype\tacquire\tcontend\t%%\twait(us)\n");
+ 2bd:	52                   	push   %edx
+ 2be:	52                   	push   %edx
+ 2bf:	68 74 0e 00 00       	push   $0xe74
+ 2c4:	6a 01                	push   $0x1
+ 2c6:	e8 25 05 00 00       	call   7f0 <printf>
+  for(i = 0; i < n; i++){
+ 2cb:	83 c4 10             	add    $0x10,%esp
+ 2ce:	83 7d b0 01          	cmpl   $0x1,-0x50(%ebp)
+ 2d2:	0f 84 ee fe ff ff    	je     1c6 <main+0x1c6>
+ 2d8:	e9 66 fd ff ff       	jmp    43 <main+0x43>
+ 2dd:	66 90                	xchg   %ax,%ax
+ 2df:	90                   	nop
+
+000002e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2e1:	31 c0                	xor    %eax,%eax
+{
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	53                   	push   %ebx
+ 2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2f7:	83 c0 01             	add    $0x1,%eax
+ 2fa:	84 d2                	test   %dl,%dl
+ 2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 301:	89 c8                	mov    %ecx,%eax
+ 303:	c9                   	leave
+ 304:	c3                   	ret
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+ 317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 31a:	0f b6 02             	movzbl (%edx),%eax
+ 31d:	84 c0                	test   %al,%al
+ 31f:	75 17                	jne    338 <strcmp+0x28>
+ 321:	eb 3a                	jmp    35d <strcmp+0x4d>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 32c:	83 c2 01             	add    $0x1,%edx
+ 32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 332:	84 c0                	test   %al,%al
+ 334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+ 336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 338:	0f b6 19             	movzbl (%ecx),%ebx
+ 33b:	38 c3                	cmp    %al,%bl
+ 33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 33f:	29 d8                	sub    %ebx,%eax
+}
+ 341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 354:	31 c0                	xor    %eax,%eax
+ 356:	29 d8                	sub    %ebx,%eax
+}
+ 358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 35d:	0f b6 19             	movzbl (%ecx),%ebx
+ 360:	31 c0                	xor    %eax,%eax
+ 362:	eb db                	jmp    33f <strcmp+0x2f>
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 e3 01 00 00       	call   600 <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 b6 01 00 00       	call   628 <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 b9 01 00 00       	call   640 <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 7f 01 00 00       	call   610 <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4b7:	0f be 02             	movsbl (%edx),%eax
+ 4ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4c5:	77 1e                	ja     4e5 <atoi+0x35>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4d0:	83 c2 01             	add    $0x1,%edx
+ 4d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4da:	0f be 02             	movsbl (%edx),%eax
+ 4dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4e0:	80 fb 09             	cmp    $0x9,%bl
+ 4e3:	76 eb                	jbe    4d0 <atoi+0x20>
+  return n;
+}
+ 4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e8:	89 c8                	mov    %ecx,%eax
+ 4ea:	c9                   	leave
+ 4eb:	c3                   	ret
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4fe:	85 c0                	test   %eax,%eax
+ 500:	7e 13                	jle    515 <memmove+0x25>
+ 502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 504:	89 d7                	mov    %edx,%edi
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 511:	39 f8                	cmp    %edi,%eax
+ 513:	75 fb                	jne    510 <memmove+0x20>
+  return vdst;
+}
+ 515:	5e                   	pop    %esi
+ 516:	89 d0                	mov    %edx,%eax
+ 518:	5f                   	pop    %edi
+ 519:	5d                   	pop    %ebp
+ 51a:	c3                   	ret
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 520:	55                   	push   %ebp
+ 521:	31 d2                	xor    %edx,%edx
+ 523:	89 e5                	mov    %esp,%ebp
+ 525:	53                   	push   %ebx
+ 526:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 529:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 52c:	f7 f3                	div    %ebx
+ 52e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 530:	8b 45 08             	mov    0x8(%ebp),%eax
+ 533:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 538:	89 ca                	mov    %ecx,%edx
+}
+ 53a:	c9                   	leave
+ 53b:	c3                   	ret
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 540:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 542:	c3                   	ret
+ 543:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000550 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 559:	8b 35 c0 1d 00 00    	mov    0x1dc0,%esi
+{
+ 55f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 562:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 565:	85 f6                	test   %esi,%esi
+ 567:	74 2f                	je     598 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 569:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 56e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 574:	f7 e3                	mul    %ebx
+ 576:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 579:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 57c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	f7 f6                	div    %esi
+ 583:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 585:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 588:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 58b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 58d:	89 da                	mov    %ebx,%edx
+}
+ 58f:	5b                   	pop    %ebx
+ 590:	5e                   	pop    %esi
+ 591:	5f                   	pop    %edi
+ 592:	5d                   	pop    %ebp
+ 593:	c3                   	ret
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 598:	e8 0b 01 00 00       	call   6a8 <tscfreq>
+ 59d:	a3 c0 1d 00 00       	mov    %eax,0x1dc0
+ 5a2:	89 c6                	mov    %eax,%esi
+ 5a4:	eb c3                	jmp    569 <cyc2ns+0x19>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	53                   	push   %ebx
+ 5b4:	83 ec 10             	sub    $0x10,%esp
+ 5b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 5ba:	6a 00                	push   $0x0
+ 5bc:	e8 3f 01 00 00       	call   700 <getpriority>
+ 5c1:	5a                   	pop    %edx
+ 5c2:	59                   	pop    %ecx
+ 5c3:	01 d8                	add    %ebx,%eax
+ 5c5:	50                   	push   %eax
+ 5c6:	6a 00                	push   $0x0
+ 5c8:	e8 2b 01 00 00       	call   6f8 <setpriority>
+  return getpriority(0);
+ 5cd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 5d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 5d7:	83 c4 10             	add    $0x10,%esp
+}
+ 5da:	c9                   	leave
+  return getpriority(0);
+ 5db:	e9 20 01 00 00       	jmp    700 <getpriority>
+
+000005e0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <exit>:
+SYSCALL(exit)
+ 5e8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <wait>:
+SYSCALL(wait)
+ 5f0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <pipe>:
+SYSCALL(pipe)
+ 5f8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <read>:
+SYSCALL(read)
+ 600:	b8 05 00 00 00       	mov    $0x5,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <write>:
+SYSCALL(write)
+ 608:	b8 10 00 00 00       	mov    $0x10,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <close>:
+SYSCALL(close)
+ 610:	b8 15 00 00 00       	mov    $0x15,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <kill>:
+SYSCALL(kill)
+ 618:	b8 06 00 00 00       	mov    $0x6,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <exec>:
+SYSCALL(exec)
+ 620:	b8 07 00 00 00       	mov    $0x7,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <open>:
+SYSCALL(open)
+ 628:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <mknod>:
+SYSCALL(mknod)
+ 630:	b8 11 00 00 00       	mov    $0x11,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <unlink>:
+SYSCALL(unlink)
+ 638:	b8 12 00 00 00       	mov    $0x12,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <fstat>:
+SYSCALL(fstat)
+ 640:	b8 08 00 00 00       	mov    $0x8,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <link>:
+SYSCALL(link)
+ 648:	b8 13 00 00 00       	mov    $0x13,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <mkdir>:
+SYSCALL(mkdir)
+ 650:	b8 14 00 00 00       	mov    $0x14,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <chdir>:
+SYSCALL(chdir)
+ 658:	b8 09 00 00 00       	mov    $0x9,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <dup>:
+SYSCALL(dup)
+ 660:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <getpid>:
+SYSCALL(getpid)
+ 668:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <sbrk>:
+SYSCALL(sbrk)
+ 670:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <sleep>:
+SYSCALL(sleep)
+ 678:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <uptime>:
+SYSCALL(uptime)
+ 680:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <promote>:
+
+SYSCALL(promote)
+ 688:	b8 18 00 00 00       	mov    $0x18,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <demote>:
+SYSCALL(demote)
+ 690:	b8 19 00 00 00       	mov    $0x19,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 698:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 6a0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <tscfreq>:
+SYSCALL(tscfreq)
+ 6a8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <tracemask>:
+SYSCALL(tracemask)
+ 6b0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <traceread>:
+SYSCALL(traceread)
+ 6b8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <profile>:
+SYSCALL(profile)
+ 6c0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <profread>:
+SYSCALL(profread)
+ 6c8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <lockstat>:
+SYSCALL(lockstat)
+ 6d0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 6d8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <sysstat>:
+SYSCALL(sysstat)
+ 6e0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <kbench>:
+SYSCALL(kbench)
+ 6e8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <yield>:
+SYSCALL(yield)
+ 6f0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <setpriority>:
+SYSCALL(setpriority)
+ 6f8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <getpriority>:
+SYSCALL(getpriority)
+ 700:	b8 27 00 00 00       	mov    $0x27,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 708:	b8 28 00 00 00       	mov    $0x28,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 710:	b8 29 00 00 00       	mov    $0x29,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <clone>:
+SYSCALL(clone)
+ 718:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <join>:
+SYSCALL(join)
+ 720:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <futex_wait>:
+SYSCALL(futex_wait)
+ 728:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <futex_wake>:
+SYSCALL(futex_wake)
+ 730:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <spawn>:
+SYSCALL(spawn)
+ 738:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <diskstat>:
+SYSCALL(diskstat)
+ 740:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+ 748:	66 90                	xchg   %ax,%ax
+ 74a:	66 90                	xchg   %ax,%ax
+ 74c:	66 90                	xchg   %ax,%ax
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 758:	89 d1                	mov    %edx,%ecx
+{
+ 75a:	83 ec 3c             	sub    $0x3c,%esp
+ 75d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 760:	85 d2                	test   %edx,%edx
+ 762:	0f 89 80 00 00 00    	jns    7e8 <printint+0x98>
+ 768:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 76c:	74 7a                	je     7e8 <printint+0x98>
+    x = -xx;
+ 76e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 770:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 775:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 778:	31 f6                	xor    %esi,%esi
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 780:	89 c8                	mov    %ecx,%eax
+ 782:	31 d2                	xor    %edx,%edx
+ 784:	89 f7                	mov    %esi,%edi
+ 786:	f7 f3                	div    %ebx
+ 788:	8d 76 01             	lea    0x1(%esi),%esi
+ 78b:	0f b6 92 fc 0e 00 00 	movzbl 0xefc(%edx),%edx
+ 792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 796:	89 ca                	mov    %ecx,%edx
+ 798:	89 c1                	mov    %eax,%ecx
+ 79a:	39 da                	cmp    %ebx,%edx
+ 79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+ 79e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+ 7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7aa:	89 f7                	mov    %esi,%edi
+ 7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7b2:	01 df                	add    %ebx,%edi
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7c4:	6a 01                	push   $0x1
+ 7c6:	50                   	push   %eax
+ 7c7:	56                   	push   %esi
+ 7c8:	e8 3b fe ff ff       	call   608 <write>
+  while(--i >= 0)
+ 7cd:	89 f8                	mov    %edi,%eax
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	83 ef 01             	sub    $0x1,%edi
+ 7d5:	39 d8                	cmp    %ebx,%eax
+ 7d7:	75 df                	jne    7b8 <printint+0x68>
+}
+ 7d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7e8:	31 c0                	xor    %eax,%eax
+ 7ea:	eb 89                	jmp    775 <printint+0x25>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 802:	83 c6 01             	add    $0x1,%esi
+ 805:	84 db                	test   %bl,%bl
+ 807:	74 67                	je     870 <printf+0x80>
+ 809:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 80c:	31 d2                	xor    %edx,%edx
+ 80e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 811:	eb 34                	jmp    847 <printf+0x57>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+ 818:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 81b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 820:	83 f8 25             	cmp    $0x25,%eax
+ 823:	74 18                	je     83d <printf+0x4d>
+  write(fd, &c, 1);
+ 825:	83 ec 04             	sub    $0x4,%esp
+ 828:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82e:	6a 01                	push   $0x1
+ 830:	50                   	push   %eax
+ 831:	57                   	push   %edi
+ 832:	e8 d1 fd ff ff       	call   608 <write>
+ 837:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 83a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 83d:	0f b6 1e             	movzbl (%esi),%ebx
+ 840:	83 c6 01             	add    $0x1,%esi
+ 843:	84 db                	test   %bl,%bl
+ 845:	74 29                	je     870 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 847:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84a:	85 d2                	test   %edx,%edx
+ 84c:	74 ca                	je     818 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 84e:	83 fa 25             	cmp    $0x25,%edx
+ 851:	75 ea                	jne    83d <printf+0x4d>
+      if(c == 'd'){
+ 853:	83 f8 25             	cmp    $0x25,%eax
+ 856:	0f 84 24 01 00 00    	je     980 <printf+0x190>
+ 85c:	83 e8 63             	sub    $0x63,%eax
+ 85f:	83 f8 15             	cmp    $0x15,%eax
+ 862:	77 1c                	ja     880 <printf+0x90>
+ 864:	ff 24 85 a4 0e 00 00 	jmp    *0xea4(,%eax,4)
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 873:	5b                   	pop    %ebx
+ 874:	5e                   	pop    %esi
+ 875:	5f                   	pop    %edi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 886:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 88a:	6a 01                	push   $0x1
+ 88c:	52                   	push   %edx
+ 88d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 890:	57                   	push   %edi
+ 891:	e8 72 fd ff ff       	call   608 <write>
+ 896:	83 c4 0c             	add    $0xc,%esp
+ 899:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 89c:	6a 01                	push   $0x1
+ 89e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8a1:	52                   	push   %edx
+ 8a2:	57                   	push   %edi
+ 8a3:	e8 60 fd ff ff       	call   608 <write>
+        putc(fd, c);
+ 8a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ab:	31 d2                	xor    %edx,%edx
+ 8ad:	eb 8e                	jmp    83d <printf+0x4d>
+ 8af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 00                	push   $0x0
+ 8bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8c4:	e8 87 fe ff ff       	call   750 <printint>
+        ap++;
+ 8c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 67 ff ff ff       	jmp    83d <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8e5:	83 c0 04             	add    $0x4,%eax
+ 8e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	0f 84 9d 00 00 00    	je     990 <printf+0x1a0>
+        while(*s != 0){
+ 8f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	0f 84 3d ff ff ff    	je     83d <printf+0x4d>
+ 900:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 903:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 906:	89 de                	mov    %ebx,%esi
+ 908:	89 d3                	mov    %edx,%ebx
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 916:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	53                   	push   %ebx
+ 91c:	57                   	push   %edi
+ 91d:	e8 e6 fc ff ff       	call   608 <write>
+        while(*s != 0){
+ 922:	0f b6 06             	movzbl (%esi),%eax
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	84 c0                	test   %al,%al
+ 92a:	75 e4                	jne    910 <printf+0x120>
+      state = 0;
+ 92c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 07 ff ff ff       	jmp    83d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 01                	push   $0x1
+ 94f:	e9 6b ff ff ff       	jmp    8bf <printf+0xcf>
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 958:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 961:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 963:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 966:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	52                   	push   %edx
+ 96c:	57                   	push   %edi
+ 96d:	e8 96 fc ff ff       	call   608 <write>
+        ap++;
+ 972:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 975:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	e9 be fe ff ff       	jmp    83d <printf+0x4d>
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 986:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 989:	6a 01                	push   $0x1
+ 98b:	e9 11 ff ff ff       	jmp    8a1 <printf+0xb1>
+ 990:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 995:	bb 9c 0e 00 00       	mov    $0xe9c,%ebx
+ 99a:	e9 61 ff ff ff       	jmp    900 <printf+0x110>
+ 99f:	90                   	nop
+
+000009a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a1:	a1 c4 1d 00 00       	mov    0x1dc4,%eax
+{
+ 9a6:	89 e5                	mov    %esp,%ebp
+ 9a8:	57                   	push   %edi
+ 9a9:	56                   	push   %esi
+ 9aa:	53                   	push   %ebx
+ 9ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9bc:	39 ca                	cmp    %ecx,%edx
+ 9be:	73 30                	jae    9f0 <free+0x50>
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 04                	jb     9c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c4:	39 c2                	cmp    %eax,%edx
+ 9c6:	72 f0                	jb     9b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ce:	39 f8                	cmp    %edi,%eax
+ 9d0:	74 2e                	je     a00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9db:	39 f1                	cmp    %esi,%ecx
+ 9dd:	74 38                	je     a17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9e1:	5b                   	pop    %ebx
+  freep = p;
+ 9e2:	89 15 c4 1d 00 00    	mov    %edx,0x1dc4
+}
+ 9e8:	5e                   	pop    %esi
+ 9e9:	5f                   	pop    %edi
+ 9ea:	5d                   	pop    %ebp
+ 9eb:	c3                   	ret
+ 9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 d0                	jb     9c4 <free+0x24>
+ 9f4:	eb c2                	jmp    9b8 <free+0x18>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a00:	03 70 04             	add    0x4(%eax),%esi
+ a03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a06:	8b 02                	mov    (%edx),%eax
+ a08:	8b 00                	mov    (%eax),%eax
+ a0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a0d:	8b 42 04             	mov    0x4(%edx),%eax
+ a10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a13:	39 f1                	cmp    %esi,%ecx
+ a15:	75 c8                	jne    9df <free+0x3f>
+    p->s.size += bp->s.size;
+ a17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a1a:	89 15 c4 1d 00 00    	mov    %edx,0x1dc4
+    p->s.size += bp->s.size;
+ a20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a26:	89 0a                	mov    %ecx,(%edx)
+}
+ a28:	5b                   	pop    %ebx
+ a29:	5e                   	pop    %esi
+ a2a:	5f                   	pop    %edi
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a3c:	8b 15 c4 1d 00 00    	mov    0x1dc4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a42:	8d 78 07             	lea    0x7(%eax),%edi
+ a45:	c1 ef 03             	shr    $0x3,%edi
+ a48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a4b:	85 d2                	test   %edx,%edx
+ a4d:	0f 84 8d 00 00 00    	je     ae0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a55:	8b 48 04             	mov    0x4(%eax),%ecx
+ a58:	39 f9                	cmp    %edi,%ecx
+ a5a:	73 64                	jae    ac0 <malloc+0x90>
+  if(nu < 4096)
+ a5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a61:	39 df                	cmp    %ebx,%edi
+ a63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a6d:	eb 0a                	jmp    a79 <malloc+0x49>
+ a6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a72:	8b 48 04             	mov    0x4(%eax),%ecx
+ a75:	39 f9                	cmp    %edi,%ecx
+ a77:	73 47                	jae    ac0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a79:	89 c2                	mov    %eax,%edx
+ a7b:	39 05 c4 1d 00 00    	cmp    %eax,0x1dc4
+ a81:	75 ed                	jne    a70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	56                   	push   %esi
+ a87:	e8 e4 fb ff ff       	call   670 <sbrk>
+  if(p == (char*)-1)
+ a8c:	83 c4 10             	add    $0x10,%esp
+ a8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a92:	74 1c                	je     ab0 <malloc+0x80>
+  hp->s.size = nu;
+ a94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a97:	83 ec 0c             	sub    $0xc,%esp
+ a9a:	83 c0 08             	add    $0x8,%eax
+ a9d:	50                   	push   %eax
+ a9e:	e8 fd fe ff ff       	call   9a0 <free>
+  return freep;
+ aa3:	8b 15 c4 1d 00 00    	mov    0x1dc4,%edx
+      if((p = morecore(nunits)) == 0)
+ aa9:	83 c4 10             	add    $0x10,%esp
+ aac:	85 d2                	test   %edx,%edx
+ aae:	75 c0                	jne    a70 <malloc+0x40>
+        return 0;
+  }
+}
+ ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ab3:	31 c0                	xor    %eax,%eax
+}
+ ab5:	5b                   	pop    %ebx
+ ab6:	5e                   	pop    %esi
+ ab7:	5f                   	pop    %edi
+ ab8:	5d                   	pop    %ebp
+ ab9:	c3                   	ret
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ac0:	39 cf                	cmp    %ecx,%edi
+ ac2:	74 4c                	je     b10 <malloc+0xe0>
+        p->s.size -= nunits;
+ ac4:	29 f9                	sub    %edi,%ecx
+ ac6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ac9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ acc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ acf:	89 15 c4 1d 00 00    	mov    %edx,0x1dc4
+}
+ ad5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ad8:	83 c0 08             	add    $0x8,%eax
+}
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5f                   	pop    %edi
+ ade:	5d                   	pop    %ebp
+ adf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ae0:	c7 05 c4 1d 00 00 c8 	movl   $0x1dc8,0x1dc4
+ ae7:	1d 00 00 
+    base.s.size = 0;
+ aea:	b8 c8 1d 00 00       	mov    $0x1dc8,%eax
+    base.s.ptr = freep = prevp = &base;
+ aef:	c7 05 c8 1d 00 00 c8 	movl   $0x1dc8,0x1dc8
+ af6:	1d 00 00 
+    base.s.size = 0;
+ af9:	c7 05 cc 1d 00 00 00 	movl   $0x0,0x1dcc
+ b00:	00 00 00 
+    if(p->s.size >= nunits){
+ b03:	e9 54 ff ff ff       	jmp    a5c <malloc+0x2c>
+ b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b10:	8b 08                	mov    (%eax),%ecx
+ b12:	89 0a                	mov    %ecx,(%edx)
+ b14:	eb b9                	jmp    acf <malloc+0x9f>
+ b16:	66 90                	xchg   %ax,%ax
+ b18:	66 90                	xchg   %ax,%ax
+ b1a:	66 90                	xchg   %ax,%ax
+ b1c:	66 90                	xchg   %ax,%ax
+ b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	57                   	push   %edi
+ b24:	56                   	push   %esi
+ b25:	53                   	push   %ebx
+ b26:	83 ec 20             	sub    $0x20,%esp
+ b29:	8b 75 0c             	mov    0xc(%ebp),%esi
+ b2c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ b2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ b32:	68 e8 03 00 00       	push   $0x3e8
+ b37:	57                   	push   %edi
+ b38:	56                   	push   %esi
+ b39:	e8 e2 f9 ff ff       	call   520 <udiv64>
+ b3e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ b40:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ b43:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ b49:	29 c1                	sub    %eax,%ecx
+ b4b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ b4e:	68 e8 03 00 00       	push   $0x3e8
+ b53:	57                   	push   %edi
+ b54:	56                   	push   %esi
+ b55:	e8 c6 f9 ff ff       	call   520 <udiv64>
+ b5a:	83 c4 0c             	add    $0xc,%esp
+ b5d:	50                   	push   %eax
+ b5e:	68 0d 0f 00 00       	push   $0xf0d
+ b63:	53                   	push   %ebx
+ b64:	e8 87 fc ff ff       	call   7f0 <printf>
+  if(frac < 100)
+ b69:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	83 f9 63             	cmp    $0x63,%ecx
+ b72:	76 1c                	jbe    b90 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ b74:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ b77:	c7 45 0c 13 0f 00 00 	movl   $0xf13,0xc(%ebp)
+ b7e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b84:	5b                   	pop    %ebx
+ b85:	5e                   	pop    %esi
+ b86:	5f                   	pop    %edi
+ b87:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ b88:	e9 63 fc ff ff       	jmp    7f0 <printf>
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ b90:	83 ec 08             	sub    $0x8,%esp
+ b93:	68 11 0f 00 00       	push   $0xf11
+ b98:	53                   	push   %ebx
+ b99:	e8 52 fc ff ff       	call   7f0 <printf>
+  if(frac < 10)
+ b9e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ba1:	83 c4 10             	add    $0x10,%esp
+ ba4:	83 f9 09             	cmp    $0x9,%ecx
+ ba7:	77 cb                	ja     b74 <printps+0x54>
+    printf(fd, "0");
+ ba9:	83 ec 08             	sub    $0x8,%esp
+ bac:	68 11 0f 00 00       	push   $0xf11
+ bb1:	53                   	push   %ebx
+ bb2:	e8 39 fc ff ff       	call   7f0 <printf>
+ bb7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bba:	83 c4 10             	add    $0x10,%esp
+ bbd:	eb b5                	jmp    b74 <printps+0x54>
+ bbf:	90                   	nop
+
+00000bc0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+ bc6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ bcc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ bcf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ bd2:	83 e8 01             	sub    $0x1,%eax
+ bd5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ bda:	0f 87 37 02 00 00    	ja     e17 <bench+0x257>
+ be0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ be3:	85 ff                	test   %edi,%edi
+ be5:	0f 84 2c 02 00 00    	je     e17 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ beb:	83 ec 0c             	sub    $0xc,%esp
+ bee:	ff 75 10             	push   0x10(%ebp)
+ bf1:	ff 55 0c             	call   *0xc(%ebp)
+ bf4:	5b                   	pop    %ebx
+ bf5:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ bf8:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ bfa:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ bfd:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ c00:	83 c4 10             	add    $0x10,%esp
+ c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c07:	90                   	nop
+    t0 = cycles();
+ c08:	e8 33 f9 ff ff       	call   540 <cycles>
+    fn(arg);
+ c0d:	83 ec 0c             	sub    $0xc,%esp
+ c10:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ c13:	89 c6                	mov    %eax,%esi
+ c15:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ c17:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ c1a:	e8 21 f9 ff ff       	call   540 <cycles>
+ c1f:	29 f0                	sub    %esi,%eax
+ c21:	19 fa                	sbb    %edi,%edx
+ c23:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c2a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ c2d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c34:	83 c3 01             	add    $0x1,%ebx
+ c37:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ c3a:	7f cc                	jg     c08 <bench+0x48>
+  for(i = 1; i < n; i++){
+ c3c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ c40:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ c43:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ c49:	bf 01 00 00 00       	mov    $0x1,%edi
+ c4e:	74 77                	je     cc7 <bench+0x107>
+ c50:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c57:	90                   	nop
+    v = a[i];
+ c58:	8b 01                	mov    (%ecx),%eax
+ c5a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ c5d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ c63:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ c69:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ c6f:	89 c8                	mov    %ecx,%eax
+ c71:	eb 1b                	jmp    c8e <bench+0xce>
+ c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c77:	90                   	nop
+      a[j] = a[j-1];
+ c78:	89 08                	mov    %ecx,(%eax)
+ c7a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ c7d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ c80:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c86:	39 c3                	cmp    %eax,%ebx
+ c88:	0f 84 72 01 00 00    	je     e00 <bench+0x240>
+ c8e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ c91:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ c94:	89 f7                	mov    %esi,%edi
+ c96:	89 c3                	mov    %eax,%ebx
+ c98:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ c9e:	19 d7                	sbb    %edx,%edi
+ ca0:	72 d6                	jb     c78 <bench+0xb8>
+ ca2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ca8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ cae:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ cb4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ cb7:	83 c7 01             	add    $0x1,%edi
+ cba:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ cbd:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ cbf:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ cc2:	75 94                	jne    c58 <bench+0x98>
+ cc4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cc7:	83 ec 08             	sub    $0x8,%esp
+ cca:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ cd0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ cd5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ cdb:	e8 70 f8 ff ff       	call   550 <cyc2ns>
+ ce0:	83 c4 0c             	add    $0xc,%esp
+ ce3:	ff 75 14             	push   0x14(%ebp)
+ ce6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ cec:	f7 e3                	mul    %ebx
+ cee:	01 ca                	add    %ecx,%edx
+ cf0:	52                   	push   %edx
+ cf1:	50                   	push   %eax
+ cf2:	e8 29 f8 ff ff       	call   520 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ cf7:	89 06                	mov    %eax,(%esi)
+ cf9:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cfc:	5f                   	pop    %edi
+ cfd:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ cfe:	8b 45 18             	mov    0x18(%ebp),%eax
+ d01:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d03:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ d0a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ d11:	e8 3a f8 ff ff       	call   550 <cyc2ns>
+ d16:	83 c4 0c             	add    $0xc,%esp
+ d19:	ff 75 14             	push   0x14(%ebp)
+ d1c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d22:	f7 e3                	mul    %ebx
+ d24:	01 ca                	add    %ecx,%edx
+ d26:	52                   	push   %edx
+ d27:	50                   	push   %eax
+ d28:	e8 f3 f7 ff ff       	call   520 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ d2d:	89 46 08             	mov    %eax,0x8(%esi)
+ d30:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d33:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d34:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d37:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d38:	8d 50 01             	lea    0x1(%eax),%edx
+ d3b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ d40:	6b d2 63             	imul   $0x63,%edx,%edx
+ d43:	f7 e2                	mul    %edx
+ d45:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d48:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ d4f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ d56:	e8 f5 f7 ff ff       	call   550 <cyc2ns>
+ d5b:	83 c4 0c             	add    $0xc,%esp
+ d5e:	ff 75 14             	push   0x14(%ebp)
+ d61:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d67:	f7 e3                	mul    %ebx
+ d69:	01 ca                	add    %ecx,%edx
+ d6b:	52                   	push   %edx
+ d6c:	50                   	push   %eax
+ d6d:	e8 ae f7 ff ff       	call   520 <udiv64>
+
+  if(name){
+ d72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ d75:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d78:	89 46 10             	mov    %eax,0x10(%esi)
+ d7b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ d7e:	85 c9                	test   %ecx,%ecx
+ d80:	74 72                	je     df4 <bench+0x234>
+    printf(1, "%s: min ", name);
+ d82:	83 ec 04             	sub    $0x4,%esp
+ d85:	ff 75 08             	push   0x8(%ebp)
+ d88:	68 16 0f 00 00       	push   $0xf16
+ d8d:	6a 01                	push   $0x1
+ d8f:	e8 5c fa ff ff       	call   7f0 <printf>
+    printps(1, st->min);
+ d94:	83 c4 0c             	add    $0xc,%esp
+ d97:	ff 76 04             	push   0x4(%esi)
+ d9a:	ff 36                	push   (%esi)
+ d9c:	6a 01                	push   $0x1
+ d9e:	e8 7d fd ff ff       	call   b20 <printps>
+    printf(1, " median ");
+ da3:	58                   	pop    %eax
+ da4:	5a                   	pop    %edx
+ da5:	68 1f 0f 00 00       	push   $0xf1f
+ daa:	6a 01                	push   $0x1
+ dac:	e8 3f fa ff ff       	call   7f0 <printf>
+    printps(1, st->median);
+ db1:	83 c4 0c             	add    $0xc,%esp
+ db4:	ff 76 0c             	push   0xc(%esi)
+ db7:	ff 76 08             	push   0x8(%esi)
+ dba:	6a 01                	push   $0x1
+ dbc:	e8 5f fd ff ff       	call   b20 <printps>
+    printf(1, " p99 ");
+ dc1:	59                   	pop    %ecx
+ dc2:	5b                   	pop    %ebx
+ dc3:	68 28 0f 00 00       	push   $0xf28
+ dc8:	6a 01                	push   $0x1
+ dca:	e8 21 fa ff ff       	call   7f0 <printf>
+    printps(1, st->p99);
+ dcf:	83 c4 0c             	add    $0xc,%esp
+ dd2:	ff 76 14             	push   0x14(%esi)
+ dd5:	ff 76 10             	push   0x10(%esi)
+ dd8:	6a 01                	push   $0x1
+ dda:	e8 41 fd ff ff       	call   b20 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ ddf:	83 c4 0c             	add    $0xc,%esp
+ de2:	ff 75 18             	push   0x18(%ebp)
+ de5:	68 2e 0f 00 00       	push   $0xf2e
+ dea:	6a 01                	push   $0x1
+ dec:	e8 ff f9 ff ff       	call   7f0 <printf>
+ df1:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ df4:	31 c0                	xor    %eax,%eax
+}
+ df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ df9:	5b                   	pop    %ebx
+ dfa:	5e                   	pop    %esi
+ dfb:	5f                   	pop    %edi
+ dfc:	5d                   	pop    %ebp
+ dfd:	c3                   	ret
+ dfe:	66 90                	xchg   %ax,%ax
+ e00:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ e06:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ e0c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ e12:	e9 97 fe ff ff       	jmp    cae <bench+0xee>
+    return -1;
+ e17:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e1c:	eb d8                	jmp    df6 <bench+0x236>
@@ -0,0 +1,51 @@
+// Print lock contention statistics, busiest first.
+//   lockstat          rank lock classes by total wait time
+//   lockstat reset    zero the counters
+
+#include "types.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NCLASS 64
+
+static struct lockstat ls[NCLASS];
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat v;
+  int i, j, n;
+  uint pct;
+
+  if(argc > 1){
+    if(strcmp(argv[1], "reset") == 0)
+      lockstatreset();
+    else
+      printf(2, "usage: lockstat [reset]\n");
+    exit();
+  }
+
+  if((n = lockstat(ls, NCLASS)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  for(i = 1; i < n; i++){
+    v = ls[i];
+    for(j = i; j > 0 && ls[j-1].wait < v.wait; j--)
+      ls[j] = ls[j-1];
+    ls[j] = v;
+  }
+
+  printf(1, "lock\t\ttype\tacquire\tcontend\t%%\twait(us)\n");
+  for(i = 0; i < n; i++){
+    pct = 0;
+    if(ls[i].nacquire)
+      pct = udiv64(ls[i].ncontended * 100, (uint)ls[i].nacquire);
+    printf(1, "%s\t%s%s\t%d\t%d\t%d\t%d\n", ls[i].name,
+           strlen(ls[i].name) < 8 ? "\t" : "",
+           ls[i].sleep ? "sleep" : "spin",
+           (uint)ls[i].nacquire, (uint)ls[i].ncontended, pct,
+           (uint)udiv64(cyc2ns(ls[i].wait), 1000));
+  }
+  exit();
+}
@@ -0,0 +1,11 @@
+// Lock contention statistics, shared by the kernel and lockstat(1).
+// Locks are counted per class: every lock initialized with the
+// same name (all "buffer" sleeplocks, all "pipe" locks) shares one.
+
+struct lockstat {
+  char name[16];
+  uint sleep;          // 1 for a sleeplock class
+  uint64 nacquire;     // acquisitions
+  uint64 ncontended;   // acquisitions that found the lock held
+  uint64 wait;         // TSC cycles spent spinning or sleeping for it
+};
@@ -0,0 +1,2038 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 06 06 00 00       	call   648 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 3b 0f 00 00       	push   $0xf3b
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 f4 05 00 00       	call   648 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 68 13 00 00       	push   $0x1368
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 68 13 00 00       	mov    $0x1368,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 68 13 00 00       	add    $0x1368,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 71 05 00 00       	call   688 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 6c 05 00 00       	call   6a0 <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 15 05 00 00       	call   670 <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 a8 0e 00 00       	push   $0xea8
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 ac 06 00 00       	call   850 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 4e 04 00 00       	call   660 <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 a8 0e 00 00       	push   $0xea8
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 a2 05 00 00       	call   850 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 80 0e 00 00       	push   $0xe80
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 80 05 00 00       	call   850 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 b5 0e 00 00       	push   $0xeb5
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 61 05 00 00       	call   850 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 94 0e 00 00       	push   $0xe94
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 40 05 00 00       	call   850 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 58 03 00 00       	call   670 <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 94 0e 00 00       	push   $0xe94
+ 331:	6a 01                	push   $0x1
+ 333:	e8 18 05 00 00       	call   850 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 e3 01 00 00       	call   660 <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 b6 01 00 00       	call   688 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 b9 01 00 00       	call   6a0 <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 7f 01 00 00       	call   670 <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 580:	55                   	push   %ebp
+ 581:	31 d2                	xor    %edx,%edx
+ 583:	89 e5                	mov    %esp,%ebp
+ 585:	53                   	push   %ebx
+ 586:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 589:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 58c:	f7 f3                	div    %ebx
+ 58e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 590:	8b 45 08             	mov    0x8(%ebp),%eax
+ 593:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 595:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 598:	89 ca                	mov    %ecx,%edx
+}
+ 59a:	c9                   	leave
+ 59b:	c3                   	ret
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 5a0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 5a2:	c3                   	ret
+ 5a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005b0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 5b9:	8b 35 78 13 00 00    	mov    0x1378,%esi
+{
+ 5bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 5c5:	85 f6                	test   %esi,%esi
+ 5c7:	74 2f                	je     5f8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 5c9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 5ce:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 5d4:	f7 e3                	mul    %ebx
+ 5d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5d9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 5dc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	f7 f6                	div    %esi
+ 5e3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 5e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 5e8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 5eb:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 5ed:	89 da                	mov    %ebx,%edx
+}
+ 5ef:	5b                   	pop    %ebx
+ 5f0:	5e                   	pop    %esi
+ 5f1:	5f                   	pop    %edi
+ 5f2:	5d                   	pop    %ebp
+ 5f3:	c3                   	ret
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 5f8:	e8 0b 01 00 00       	call   708 <tscfreq>
+ 5fd:	a3 78 13 00 00       	mov    %eax,0x1378
+ 602:	89 c6                	mov    %eax,%esi
+ 604:	eb c3                	jmp    5c9 <cyc2ns+0x19>
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	53                   	push   %ebx
+ 614:	83 ec 10             	sub    $0x10,%esp
+ 617:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 61a:	6a 00                	push   $0x0
+ 61c:	e8 3f 01 00 00       	call   760 <getpriority>
+ 621:	5a                   	pop    %edx
+ 622:	59                   	pop    %ecx
+ 623:	01 d8                	add    %ebx,%eax
+ 625:	50                   	push   %eax
+ 626:	6a 00                	push   $0x0
+ 628:	e8 2b 01 00 00       	call   758 <setpriority>
+  return getpriority(0);
+ 62d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 634:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 637:	83 c4 10             	add    $0x10,%esp
+}
+ 63a:	c9                   	leave
+  return getpriority(0);
+ 63b:	e9 20 01 00 00       	jmp    760 <getpriority>
+
+00000640 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <exit>:
+SYSCALL(exit)
+ 648:	b8 02 00 00 00       	mov    $0x2,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <wait>:
+SYSCALL(wait)
+ 650:	b8 03 00 00 00       	mov    $0x3,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <pipe>:
+SYSCALL(pipe)
+ 658:	b8 04 00 00 00       	mov    $0x4,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <read>:
+SYSCALL(read)
+ 660:	b8 05 00 00 00       	mov    $0x5,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <write>:
+SYSCALL(write)
+ 668:	b8 10 00 00 00       	mov    $0x10,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <close>:
+SYSCALL(close)
+ 670:	b8 15 00 00 00       	mov    $0x15,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <kill>:
+SYSCALL(kill)
+ 678:	b8 06 00 00 00       	mov    $0x6,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <exec>:
+SYSCALL(exec)
+ 680:	b8 07 00 00 00       	mov    $0x7,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <open>:
+SYSCALL(open)
+ 688:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <mknod>:
+SYSCALL(mknod)
+ 690:	b8 11 00 00 00       	mov    $0x11,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <unlink>:
+SYSCALL(unlink)
+ 698:	b8 12 00 00 00       	mov    $0x12,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <fstat>:
+SYSCALL(fstat)
+ 6a0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <link>:
+SYSCALL(link)
+ 6a8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <mkdir>:
+SYSCALL(mkdir)
+ 6b0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <chdir>:
+SYSCALL(chdir)
+ 6b8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <dup>:
+SYSCALL(dup)
+ 6c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <getpid>:
+SYSCALL(getpid)
+ 6c8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <sbrk>:
+SYSCALL(sbrk)
+ 6d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <sleep>:
+SYSCALL(sleep)
+ 6d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <uptime>:
+SYSCALL(uptime)
+ 6e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <promote>:
+
+SYSCALL(promote)
+ 6e8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <demote>:
+SYSCALL(demote)
+ 6f0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 6f8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 700:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <tscfreq>:
+SYSCALL(tscfreq)
+ 708:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <tracemask>:
+SYSCALL(tracemask)
+ 710:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <traceread>:
+SYSCALL(traceread)
+ 718:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <profile>:
+SYSCALL(profile)
+ 720:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <profread>:
+SYSCALL(profread)
+ 728:	b8 20 00 00 00       	mov    $0x20,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <lockstat>:
+SYSCALL(lockstat)
+ 730:	b8 21 00 00 00       	mov    $0x21,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 738:	b8 22 00 00 00       	mov    $0x22,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <sysstat>:
+SYSCALL(sysstat)
+ 740:	b8 23 00 00 00       	mov    $0x23,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <kbench>:
+SYSCALL(kbench)
+ 748:	b8 24 00 00 00       	mov    $0x24,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <yield>:
+SYSCALL(yield)
+ 750:	b8 25 00 00 00       	mov    $0x25,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <setpriority>:
+SYSCALL(setpriority)
+ 758:	b8 26 00 00 00       	mov    $0x26,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <getpriority>:
+SYSCALL(getpriority)
+ 760:	b8 27 00 00 00       	mov    $0x27,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 768:	b8 28 00 00 00       	mov    $0x28,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 770:	b8 29 00 00 00       	mov    $0x29,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <clone>:
+SYSCALL(clone)
+ 778:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <join>:
+SYSCALL(join)
+ 780:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <futex_wait>:
+SYSCALL(futex_wait)
+ 788:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <futex_wake>:
+SYSCALL(futex_wake)
+ 790:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+
+00000798 <spawn>:
+SYSCALL(spawn)
+ 798:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <diskstat>:
+SYSCALL(diskstat)
+ 7a0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+ 7a8:	66 90                	xchg   %ax,%ax
+ 7aa:	66 90                	xchg   %ax,%ax
+ 7ac:	66 90                	xchg   %ax,%ax
+ 7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7b8:	89 d1                	mov    %edx,%ecx
+{
+ 7ba:	83 ec 3c             	sub    $0x3c,%esp
+ 7bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7c0:	85 d2                	test   %edx,%edx
+ 7c2:	0f 89 80 00 00 00    	jns    848 <printint+0x98>
+ 7c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7cc:	74 7a                	je     848 <printint+0x98>
+    x = -xx;
+ 7ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7d8:	31 f6                	xor    %esi,%esi
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7e0:	89 c8                	mov    %ecx,%eax
+ 7e2:	31 d2                	xor    %edx,%edx
+ 7e4:	89 f7                	mov    %esi,%edi
+ 7e6:	f7 f3                	div    %ebx
+ 7e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7eb:	0f b6 92 28 0f 00 00 	movzbl 0xf28(%edx),%edx
+ 7f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7f6:	89 ca                	mov    %ecx,%edx
+ 7f8:	89 c1                	mov    %eax,%ecx
+ 7fa:	39 da                	cmp    %ebx,%edx
+ 7fc:	73 e2                	jae    7e0 <printint+0x30>
+  if(neg)
+ 7fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 801:	85 c0                	test   %eax,%eax
+ 803:	74 07                	je     80c <printint+0x5c>
+    buf[i++] = '-';
+ 805:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 80a:	89 f7                	mov    %esi,%edi
+ 80c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 80f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 812:	01 df                	add    %ebx,%edi
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 818:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 821:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 824:	6a 01                	push   $0x1
+ 826:	50                   	push   %eax
+ 827:	56                   	push   %esi
+ 828:	e8 3b fe ff ff       	call   668 <write>
+  while(--i >= 0)
+ 82d:	89 f8                	mov    %edi,%eax
+ 82f:	83 c4 10             	add    $0x10,%esp
+ 832:	83 ef 01             	sub    $0x1,%edi
+ 835:	39 d8                	cmp    %ebx,%eax
+ 837:	75 df                	jne    818 <printint+0x68>
+}
+ 839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83c:	5b                   	pop    %ebx
+ 83d:	5e                   	pop    %esi
+ 83e:	5f                   	pop    %edi
+ 83f:	5d                   	pop    %ebp
+ 840:	c3                   	ret
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 848:	31 c0                	xor    %eax,%eax
+ 84a:	eb 89                	jmp    7d5 <printint+0x25>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 859:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 85c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 85f:	0f b6 1e             	movzbl (%esi),%ebx
+ 862:	83 c6 01             	add    $0x1,%esi
+ 865:	84 db                	test   %bl,%bl
+ 867:	74 67                	je     8d0 <printf+0x80>
+ 869:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 86c:	31 d2                	xor    %edx,%edx
+ 86e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 871:	eb 34                	jmp    8a7 <printf+0x57>
+ 873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 877:	90                   	nop
+ 878:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 87b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 880:	83 f8 25             	cmp    $0x25,%eax
+ 883:	74 18                	je     89d <printf+0x4d>
+  write(fd, &c, 1);
+ 885:	83 ec 04             	sub    $0x4,%esp
+ 888:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 88b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 88e:	6a 01                	push   $0x1
+ 890:	50                   	push   %eax
+ 891:	57                   	push   %edi
+ 892:	e8 d1 fd ff ff       	call   668 <write>
+ 897:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 89a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 89d:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a0:	83 c6 01             	add    $0x1,%esi
+ 8a3:	84 db                	test   %bl,%bl
+ 8a5:	74 29                	je     8d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8aa:	85 d2                	test   %edx,%edx
+ 8ac:	74 ca                	je     878 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ae:	83 fa 25             	cmp    $0x25,%edx
+ 8b1:	75 ea                	jne    89d <printf+0x4d>
+      if(c == 'd'){
+ 8b3:	83 f8 25             	cmp    $0x25,%eax
+ 8b6:	0f 84 24 01 00 00    	je     9e0 <printf+0x190>
+ 8bc:	83 e8 63             	sub    $0x63,%eax
+ 8bf:	83 f8 15             	cmp    $0x15,%eax
+ 8c2:	77 1c                	ja     8e0 <printf+0x90>
+ 8c4:	ff 24 85 d0 0e 00 00 	jmp    *0xed0(,%eax,4)
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8d3:	5b                   	pop    %ebx
+ 8d4:	5e                   	pop    %esi
+ 8d5:	5f                   	pop    %edi
+ 8d6:	5d                   	pop    %ebp
+ 8d7:	c3                   	ret
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ea:	6a 01                	push   $0x1
+ 8ec:	52                   	push   %edx
+ 8ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8f0:	57                   	push   %edi
+ 8f1:	e8 72 fd ff ff       	call   668 <write>
+ 8f6:	83 c4 0c             	add    $0xc,%esp
+ 8f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fc:	6a 01                	push   $0x1
+ 8fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 901:	52                   	push   %edx
+ 902:	57                   	push   %edi
+ 903:	e8 60 fd ff ff       	call   668 <write>
+        putc(fd, c);
+ 908:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90b:	31 d2                	xor    %edx,%edx
+ 90d:	eb 8e                	jmp    89d <printf+0x4d>
+ 90f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 00                	push   $0x0
+ 91f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 921:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 924:	e8 87 fe ff ff       	call   7b0 <printint>
+        ap++;
+ 929:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 92c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 67 ff ff ff       	jmp    89d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 940:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 943:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 94b:	85 db                	test   %ebx,%ebx
+ 94d:	0f 84 9d 00 00 00    	je     9f0 <printf+0x1a0>
+        while(*s != 0){
+ 953:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 956:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 958:	84 c0                	test   %al,%al
+ 95a:	0f 84 3d ff ff ff    	je     89d <printf+0x4d>
+ 960:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 963:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 966:	89 de                	mov    %ebx,%esi
+ 968:	89 d3                	mov    %edx,%ebx
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 976:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 979:	6a 01                	push   $0x1
+ 97b:	53                   	push   %ebx
+ 97c:	57                   	push   %edi
+ 97d:	e8 e6 fc ff ff       	call   668 <write>
+        while(*s != 0){
+ 982:	0f b6 06             	movzbl (%esi),%eax
+ 985:	83 c4 10             	add    $0x10,%esp
+ 988:	84 c0                	test   %al,%al
+ 98a:	75 e4                	jne    970 <printf+0x120>
+      state = 0;
+ 98c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 07 ff ff ff       	jmp    89d <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9ab:	8b 13                	mov    (%ebx),%edx
+ 9ad:	6a 01                	push   $0x1
+ 9af:	e9 6b ff ff ff       	jmp    91f <printf+0xcf>
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9bb:	83 ec 04             	sub    $0x4,%esp
+ 9be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	52                   	push   %edx
+ 9cc:	57                   	push   %edi
+ 9cd:	e8 96 fc ff ff       	call   668 <write>
+        ap++;
+ 9d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9d8:	31 d2                	xor    %edx,%edx
+ 9da:	e9 be fe ff ff       	jmp    89d <printf+0x4d>
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	e9 11 ff ff ff       	jmp    901 <printf+0xb1>
+ 9f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9f5:	bb c8 0e 00 00       	mov    $0xec8,%ebx
+ 9fa:	e9 61 ff ff ff       	jmp    960 <printf+0x110>
+ 9ff:	90                   	nop
+
+00000a00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	a1 7c 13 00 00       	mov    0x137c,%eax
+{
+ a06:	89 e5                	mov    %esp,%ebp
+ a08:	57                   	push   %edi
+ a09:	56                   	push   %esi
+ a0a:	53                   	push   %ebx
+ a0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1c:	39 ca                	cmp    %ecx,%edx
+ a1e:	73 30                	jae    a50 <free+0x50>
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 04                	jb     a28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a24:	39 c2                	cmp    %eax,%edx
+ a26:	72 f0                	jb     a18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a2e:	39 f8                	cmp    %edi,%eax
+ a30:	74 2e                	je     a60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a35:	8b 42 04             	mov    0x4(%edx),%eax
+ a38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a3b:	39 f1                	cmp    %esi,%ecx
+ a3d:	74 38                	je     a77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a41:	5b                   	pop    %ebx
+  freep = p;
+ a42:	89 15 7c 13 00 00    	mov    %edx,0x137c
+}
+ a48:	5e                   	pop    %esi
+ a49:	5f                   	pop    %edi
+ a4a:	5d                   	pop    %ebp
+ a4b:	c3                   	ret
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a50:	39 c1                	cmp    %eax,%ecx
+ a52:	72 d0                	jb     a24 <free+0x24>
+ a54:	eb c2                	jmp    a18 <free+0x18>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a60:	03 70 04             	add    0x4(%eax),%esi
+ a63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a66:	8b 02                	mov    (%edx),%eax
+ a68:	8b 00                	mov    (%eax),%eax
+ a6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a6d:	8b 42 04             	mov    0x4(%edx),%eax
+ a70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a73:	39 f1                	cmp    %esi,%ecx
+ a75:	75 c8                	jne    a3f <free+0x3f>
+    p->s.size += bp->s.size;
+ a77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a7a:	89 15 7c 13 00 00    	mov    %edx,0x137c
+    p->s.size += bp->s.size;
+ a80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a86:	89 0a                	mov    %ecx,(%edx)
+}
+ a88:	5b                   	pop    %ebx
+ a89:	5e                   	pop    %esi
+ a8a:	5f                   	pop    %edi
+ a8b:	5d                   	pop    %ebp
+ a8c:	c3                   	ret
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a9c:	8b 15 7c 13 00 00    	mov    0x137c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aa2:	8d 78 07             	lea    0x7(%eax),%edi
+ aa5:	c1 ef 03             	shr    $0x3,%edi
+ aa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ aab:	85 d2                	test   %edx,%edx
+ aad:	0f 84 8d 00 00 00    	je     b40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab8:	39 f9                	cmp    %edi,%ecx
+ aba:	73 64                	jae    b20 <malloc+0x90>
+  if(nu < 4096)
+ abc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ac1:	39 df                	cmp    %ebx,%edi
+ ac3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ac6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ acd:	eb 0a                	jmp    ad9 <malloc+0x49>
+ acf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad5:	39 f9                	cmp    %edi,%ecx
+ ad7:	73 47                	jae    b20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ad9:	89 c2                	mov    %eax,%edx
+ adb:	39 05 7c 13 00 00    	cmp    %eax,0x137c
+ ae1:	75 ed                	jne    ad0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	56                   	push   %esi
+ ae7:	e8 e4 fb ff ff       	call   6d0 <sbrk>
+  if(p == (char*)-1)
+ aec:	83 c4 10             	add    $0x10,%esp
+ aef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ af2:	74 1c                	je     b10 <malloc+0x80>
+  hp->s.size = nu;
+ af4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ af7:	83 ec 0c             	sub    $0xc,%esp
+ afa:	83 c0 08             	add    $0x8,%eax
+ afd:	50                   	push   %eax
+ afe:	e8 fd fe ff ff       	call   a00 <free>
+  return freep;
+ b03:	8b 15 7c 13 00 00    	mov    0x137c,%edx
+      if((p = morecore(nunits)) == 0)
+ b09:	83 c4 10             	add    $0x10,%esp
+ b0c:	85 d2                	test   %edx,%edx
+ b0e:	75 c0                	jne    ad0 <malloc+0x40>
+        return 0;
+  }
+}
+ b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b13:	31 c0                	xor    %eax,%eax
+}
+ b15:	5b                   	pop    %ebx
+ b16:	5e                   	pop    %esi
+ b17:	5f                   	pop    %edi
+ b18:	5d                   	pop    %ebp
+ b19:	c3                   	ret
+ b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b20:	39 cf                	cmp    %ecx,%edi
+ b22:	74 4c                	je     b70 <malloc+0xe0>
+        p->s.size -= nunits;
+ b24:	29 f9                	sub    %edi,%ecx
+ b26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b2f:	89 15 7c 13 00 00    	mov    %edx,0x137c
+}
+ b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b38:	83 c0 08             	add    $0x8,%eax
+}
+ b3b:	5b                   	pop    %ebx
+ b3c:	5e                   	pop    %esi
+ b3d:	5f                   	pop    %edi
+ b3e:	5d                   	pop    %ebp
+ b3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b40:	c7 05 7c 13 00 00 80 	movl   $0x1380,0x137c
+ b47:	13 00 00 
+    base.s.size = 0;
+ b4a:	b8 80 13 00 00       	mov    $0x1380,%eax
+    base.s.ptr = freep = prevp = &base;
+ b4f:	c7 05 80 13 00 00 80 	movl   $0x1380,0x1380
+ b56:	13 00 00 
+    base.s.size = 0;
+ b59:	c7 05 84 13 00 00 00 	movl   $0x0,0x1384
+ b60:	00 00 00 
+    if(p->s.size >= nunits){
+ b63:	e9 54 ff ff ff       	jmp    abc <malloc+0x2c>
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b70:	8b 08                	mov    (%eax),%ecx
+ b72:	89 0a                	mov    %ecx,(%edx)
+ b74:	eb b9                	jmp    b2f <malloc+0x9f>
+ b76:	66 90                	xchg   %ax,%ax
+ b78:	66 90                	xchg   %ax,%ax
+ b7a:	66 90                	xchg   %ax,%ax
+ b7c:	66 90                	xchg   %ax,%ax
+ b7e:	66 90                	xchg   %ax,%ax
+
+00000b80 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 20             	sub    $0x20,%esp
+ b89:	8b 75 0c             	mov    0xc(%ebp),%esi
+ b8c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ b8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ b92:	68 e8 03 00 00       	push   $0x3e8
+ b97:	57                   	push   %edi
+ b98:	56                   	push   %esi
+ b99:	e8 e2 f9 ff ff       	call   580 <udiv64>
+ b9e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ ba0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ ba3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ ba9:	29 c1                	sub    %eax,%ecx
+ bab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ bae:	68 e8 03 00 00       	push   $0x3e8
+ bb3:	57                   	push   %edi
+ bb4:	56                   	push   %esi
+ bb5:	e8 c6 f9 ff ff       	call   580 <udiv64>
+ bba:	83 c4 0c             	add    $0xc,%esp
+ bbd:	50                   	push   %eax
+ bbe:	68 39 0f 00 00       	push   $0xf39
+ bc3:	53                   	push   %ebx
+ bc4:	e8 87 fc ff ff       	call   850 <printf>
+  if(frac < 100)
+ bc9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bcc:	83 c4 10             	add    $0x10,%esp
+ bcf:	83 f9 63             	cmp    $0x63,%ecx
+ bd2:	76 1c                	jbe    bf0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ bd4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ bd7:	c7 45 0c 3f 0f 00 00 	movl   $0xf3f,0xc(%ebp)
+ bde:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ be1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ be4:	5b                   	pop    %ebx
+ be5:	5e                   	pop    %esi
+ be6:	5f                   	pop    %edi
+ be7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ be8:	e9 63 fc ff ff       	jmp    850 <printf>
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	68 3d 0f 00 00       	push   $0xf3d
+ bf8:	53                   	push   %ebx
+ bf9:	e8 52 fc ff ff       	call   850 <printf>
+  if(frac < 10)
+ bfe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c01:	83 c4 10             	add    $0x10,%esp
+ c04:	83 f9 09             	cmp    $0x9,%ecx
+ c07:	77 cb                	ja     bd4 <printps+0x54>
+    printf(fd, "0");
+ c09:	83 ec 08             	sub    $0x8,%esp
+ c0c:	68 3d 0f 00 00       	push   $0xf3d
+ c11:	53                   	push   %ebx
+ c12:	e8 39 fc ff ff       	call   850 <printf>
+ c17:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c1a:	83 c4 10             	add    $0x10,%esp
+ c1d:	eb b5                	jmp    bd4 <printps+0x54>
+ c1f:	90                   	nop
+
+00000c20 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+ c26:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c2c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ c2f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c32:	83 e8 01             	sub    $0x1,%eax
+ c35:	3d ff 00 00 00       	cmp    $0xff,%eax
+ c3a:	0f 87 37 02 00 00    	ja     e77 <bench+0x257>
+ c40:	8b 7d 14             	mov    0x14(%ebp),%edi
+ c43:	85 ff                	test   %edi,%edi
+ c45:	0f 84 2c 02 00 00    	je     e77 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ c4b:	83 ec 0c             	sub    $0xc,%esp
+ c4e:	ff 75 10             	push   0x10(%ebp)
+ c51:	ff 55 0c             	call   *0xc(%ebp)
+ c54:	5b                   	pop    %ebx
+ c55:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ c58:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ c5a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ c5d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ c60:	83 c4 10             	add    $0x10,%esp
+ c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c67:	90                   	nop
+    t0 = cycles();
+ c68:	e8 33 f9 ff ff       	call   5a0 <cycles>
+    fn(arg);
+ c6d:	83 ec 0c             	sub    $0xc,%esp
+ c70:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ c73:	89 c6                	mov    %eax,%esi
+ c75:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ c77:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ c7a:	e8 21 f9 ff ff       	call   5a0 <cycles>
+ c7f:	29 f0                	sub    %esi,%eax
+ c81:	19 fa                	sbb    %edi,%edx
+ c83:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c8a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ c8d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c94:	83 c3 01             	add    $0x1,%ebx
+ c97:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ c9a:	7f cc                	jg     c68 <bench+0x48>
+  for(i = 1; i < n; i++){
+ c9c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ ca0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ ca3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ ca9:	bf 01 00 00 00       	mov    $0x1,%edi
+ cae:	74 77                	je     d27 <bench+0x107>
+ cb0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cb7:	90                   	nop
+    v = a[i];
+ cb8:	8b 01                	mov    (%ecx),%eax
+ cba:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ cbd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ cc3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ cc9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ ccf:	89 c8                	mov    %ecx,%eax
+ cd1:	eb 1b                	jmp    cee <bench+0xce>
+ cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cd7:	90                   	nop
+      a[j] = a[j-1];
+ cd8:	89 08                	mov    %ecx,(%eax)
+ cda:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ cdd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ ce0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ ce6:	39 c3                	cmp    %eax,%ebx
+ ce8:	0f 84 72 01 00 00    	je     e60 <bench+0x240>
+ cee:	8b 50 fc             	mov    -0x4(%eax),%edx
+ cf1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ cf4:	89 f7                	mov    %esi,%edi
+ cf6:	89 c3                	mov    %eax,%ebx
+ cf8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ cfe:	19 d7                	sbb    %edx,%edi
+ d00:	72 d6                	jb     cd8 <bench+0xb8>
+ d02:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d08:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ d0e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ d14:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ d17:	83 c7 01             	add    $0x1,%edi
+ d1a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ d1d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ d1f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ d22:	75 94                	jne    cb8 <bench+0x98>
+ d24:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d27:	83 ec 08             	sub    $0x8,%esp
+ d2a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ d30:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ d35:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ d3b:	e8 70 f8 ff ff       	call   5b0 <cyc2ns>
+ d40:	83 c4 0c             	add    $0xc,%esp
+ d43:	ff 75 14             	push   0x14(%ebp)
+ d46:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d4c:	f7 e3                	mul    %ebx
+ d4e:	01 ca                	add    %ecx,%edx
+ d50:	52                   	push   %edx
+ d51:	50                   	push   %eax
+ d52:	e8 29 f8 ff ff       	call   580 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ d57:	89 06                	mov    %eax,(%esi)
+ d59:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d5c:	5f                   	pop    %edi
+ d5d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ d5e:	8b 45 18             	mov    0x18(%ebp),%eax
+ d61:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d63:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ d6a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ d71:	e8 3a f8 ff ff       	call   5b0 <cyc2ns>
+ d76:	83 c4 0c             	add    $0xc,%esp
+ d79:	ff 75 14             	push   0x14(%ebp)
+ d7c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d82:	f7 e3                	mul    %ebx
+ d84:	01 ca                	add    %ecx,%edx
+ d86:	52                   	push   %edx
+ d87:	50                   	push   %eax
+ d88:	e8 f3 f7 ff ff       	call   580 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ d8d:	89 46 08             	mov    %eax,0x8(%esi)
+ d90:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d93:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d94:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d97:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d98:	8d 50 01             	lea    0x1(%eax),%edx
+ d9b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ da0:	6b d2 63             	imul   $0x63,%edx,%edx
+ da3:	f7 e2                	mul    %edx
+ da5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ da8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ daf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ db6:	e8 f5 f7 ff ff       	call   5b0 <cyc2ns>
+ dbb:	83 c4 0c             	add    $0xc,%esp
+ dbe:	ff 75 14             	push   0x14(%ebp)
+ dc1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ dc7:	f7 e3                	mul    %ebx
+ dc9:	01 ca                	add    %ecx,%edx
+ dcb:	52                   	push   %edx
+ dcc:	50                   	push   %eax
+ dcd:	e8 ae f7 ff ff       	call   580 <udiv64>
+
+  if(name){
+ dd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ dd5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ dd8:	89 46 10             	mov    %eax,0x10(%esi)
+ ddb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ dde:	85 c9                	test   %ecx,%ecx
+ de0:	74 72                	je     e54 <bench+0x234>
+    printf(1, "%s: min ", name);
+ de2:	83 ec 04             	sub    $0x4,%esp
+ de5:	ff 75 08             	push   0x8(%ebp)
+ de8:	68 42 0f 00 00       	push   $0xf42
+ ded:	6a 01                	push   $0x1
+ def:	e8 5c fa ff ff       	call   850 <printf>
+    printps(1, st->min);
+ df4:	83 c4 0c             	add    $0xc,%esp
+ df7:	ff 76 04             	push   0x4(%esi)
+ dfa:	ff 36                	push   (%esi)
+ dfc:	6a 01                	push   $0x1
+ dfe:	e8 7d fd ff ff       	call   b80 <printps>
+    printf(1, " median ");
+ e03:	58                   	pop    %eax
+ e04:	5a                   	pop    %edx
+ e05:	68 4b 0f 00 00       	push   $0xf4b
+ e0a:	6a 01                	push   $0x1
+ e0c:	e8 3f fa ff ff       	call   850 <printf>
+    printps(1, st->median);
+ e11:	83 c4 0c             	add    $0xc,%esp
+ e14:	ff 76 0c             	push   0xc(%esi)
+ e17:	ff 76 08             	push   0x8(%esi)
+ e1a:	6a 01                	push   $0x1
+ e1c:	e8 5f fd ff ff       	call   b80 <printps>
+    printf(1, " p99 ");
+ e21:	59                   	pop    %ecx
+ e22:	5b                   	pop    %ebx
+ e23:	68 54 0f 00 00       	push   $0xf54
+ e28:	6a 01                	push   $0x1
+ e2a:	e8 21 fa ff ff       	call   850 <printf>
+    printps(1, st->p99);
+ e2f:	83 c4 0c             	add    $0xc,%esp
+ e32:	ff 76 14             	push   0x14(%esi)
+ e35:	ff 76 10             	push   0x10(%esi)
+ e38:	6a 01                	push   $0x1
+ e3a:	e8 41 fd ff ff       	call   b80 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ e3f:	83 c4 0c             	add    $0xc,%esp
+ e42:	ff 75 18             	push   0x18(%ebp)
+ e45:	68 5a 0f 00 00       	push   $0xf5a
+ e4a:	6a 01                	push   $0x1
+ e4c:	e8 ff f9 ff ff       	call   850 <printf>
+ e51:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ e54:	31 c0                	xor    %eax,%eax
+}
+ e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e59:	5b                   	pop    %ebx
+ e5a:	5e                   	pop    %esi
+ e5b:	5f                   	pop    %edi
+ e5c:	5d                   	pop    %ebp
+ e5d:	c3                   	ret
+ e5e:	66 90                	xchg   %ax,%ax
+ e60:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ e66:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ e6c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ e72:	e9 97 fe ff ff       	jmp    d0e <bench+0xee>
+    return -1;
+ e77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e7c:	eb d8                	jmp    e56 <bench+0x236>
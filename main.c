@@ -22,18 +22,25 @@ main(void)
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
+  sseinit();       // sse for non-temporal page clears
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  futexinit();     // futex wait channels
+  textinit();      // shared executable pages
   tvinit();        // trap vectors
-  binit();         // buffer cache
+  tscinit();       // time-stamp counter frequency
+  traceinit();     // vm event tracing
+  profinit();      // sampling profiler
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache, allocated from all of memory
   userinit();      // first user process
+  kthread_create(kzerod, 0, "kzerod");  // page pre-zeroing
   mpmain();        // finish this processor's setup
 }
 
@@ -43,6 +50,7 @@ mpenter(void)
 {
   switchkvm();
   seginit();
+  sseinit();
   lapicinit();
   mpmain();
 }
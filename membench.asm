@@ -0,0 +1,1845 @@
+
+_membench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static struct kbresult res[NRES];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 20             	sub    $0x20,%esp
+  int i, n;
+  uint x;
+
+  sched_setaffinity(0, 1);   // pin for repeatable numbers
+  14:	6a 01                	push   $0x1
+  16:	6a 00                	push   $0x0
+  18:	e8 4b 05 00 00       	call   568 <sched_setaffinity>
+  if((n = kbench(KB_MEM, res, NRES)) < 0){
+  1d:	83 c4 0c             	add    $0xc,%esp
+  20:	6a 10                	push   $0x10
+  22:	68 20 11 00 00       	push   $0x1120
+  27:	6a 01                	push   $0x1
+  29:	e8 1a 05 00 00       	call   548 <kbench>
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  34:	85 c0                	test   %eax,%eax
+  36:	0f 88 ec 00 00 00    	js     128 <main+0x128>
+    printf(2, "membench: cannot allocate two huge pages\n");
+    exit();
+  }
+  printf(1, "routine\t\t\tbytes/cycle\tus per 4MB\n");
+  3c:	50                   	push   %eax
+  3d:	50                   	push   %eax
+  3e:	68 c0 0c 00 00       	push   $0xcc0
+  43:	6a 01                	push   $0x1
+  45:	e8 06 06 00 00       	call   650 <printf>
+  for(i = 0; i < n; i++){
+  4a:	83 c4 10             	add    $0x10,%esp
+  4d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  51:	0f 84 cc 00 00 00    	je     123 <main+0x123>
+  57:	31 c0                	xor    %eax,%eax
+  59:	bb 20 11 00 00       	mov    $0x1120,%ebx
+  5e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  61:	eb 6e                	jmp    d1 <main+0xd1>
+  63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  67:	90                   	nop
+    x = udiv64((uint64)res[i].ops * 100, (uint)res[i].cycles);
+    printf(1, "%s\t", res[i].name);
+    if(strlen(res[i].name) < 16)
+      printf(1, "\t");
+    printf(1, "%d.%s%d\t\t%d\n", x / 100, x % 100 < 10 ? "0" : "", x % 100,
+           (uint)udiv64(cyc2ns(res[i].cycles), 1000));
+  68:	83 ec 08             	sub    $0x8,%esp
+  6b:	ff 73 20             	push   0x20(%ebx)
+  6e:	ff 73 1c             	push   0x1c(%ebx)
+  71:	e8 3a 03 00 00       	call   3b0 <cyc2ns>
+  76:	83 c4 0c             	add    $0xc,%esp
+  79:	68 e8 03 00 00       	push   $0x3e8
+  7e:	52                   	push   %edx
+  7f:	50                   	push   %eax
+  80:	e8 fb 02 00 00       	call   380 <udiv64>
+  85:	89 c1                	mov    %eax,%ecx
+    printf(1, "%d.%s%d\t\t%d\n", x / 100, x % 100 < 10 ? "0" : "", x % 100,
+  87:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  8c:	f7 e6                	mul    %esi
+  8e:	89 d0                	mov    %edx,%eax
+  90:	c1 e8 05             	shr    $0x5,%eax
+  93:	6b f8 64             	imul   $0x64,%eax,%edi
+  96:	89 f0                	mov    %esi,%eax
+  98:	5e                   	pop    %esi
+  99:	be 80 0c 00 00       	mov    $0xc80,%esi
+  9e:	29 f8                	sub    %edi,%eax
+  a0:	5f                   	pop    %edi
+  a1:	bf 85 0c 00 00       	mov    $0xc85,%edi
+  a6:	51                   	push   %ecx
+  a7:	83 f8 0a             	cmp    $0xa,%eax
+  aa:	50                   	push   %eax
+  ab:	0f 43 f7             	cmovae %edi,%esi
+  ae:	c1 ea 05             	shr    $0x5,%edx
+  for(i = 0; i < n; i++){
+  b1:	83 c3 24             	add    $0x24,%ebx
+    printf(1, "%d.%s%d\t\t%d\n", x / 100, x % 100 < 10 ? "0" : "", x % 100,
+  b4:	56                   	push   %esi
+  b5:	52                   	push   %edx
+  b6:	68 86 0c 00 00       	push   $0xc86
+  bb:	6a 01                	push   $0x1
+  bd:	e8 8e 05 00 00       	call   650 <printf>
+  for(i = 0; i < n; i++){
+  c2:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  c6:	83 c4 20             	add    $0x20,%esp
+  c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  cc:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+  cf:	74 52                	je     123 <main+0x123>
+    x = udiv64((uint64)res[i].ops * 100, (uint)res[i].cycles);
+  d1:	b8 64 00 00 00       	mov    $0x64,%eax
+  d6:	f7 63 18             	mull   0x18(%ebx)
+  d9:	83 ec 04             	sub    $0x4,%esp
+  dc:	ff 73 1c             	push   0x1c(%ebx)
+  df:	52                   	push   %edx
+  e0:	50                   	push   %eax
+  e1:	e8 9a 02 00 00       	call   380 <udiv64>
+    printf(1, "%s\t", res[i].name);
+  e6:	83 c4 0c             	add    $0xc,%esp
+  e9:	53                   	push   %ebx
+    x = udiv64((uint64)res[i].ops * 100, (uint)res[i].cycles);
+  ea:	89 c6                	mov    %eax,%esi
+    printf(1, "%s\t", res[i].name);
+  ec:	68 82 0c 00 00       	push   $0xc82
+  f1:	6a 01                	push   $0x1
+  f3:	e8 58 05 00 00       	call   650 <printf>
+    if(strlen(res[i].name) < 16)
+  f8:	89 1c 24             	mov    %ebx,(%esp)
+  fb:	e8 d0 00 00 00       	call   1d0 <strlen>
+ 100:	83 c4 10             	add    $0x10,%esp
+ 103:	83 f8 0f             	cmp    $0xf,%eax
+ 106:	0f 87 5c ff ff ff    	ja     68 <main+0x68>
+      printf(1, "\t");
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	68 84 0c 00 00       	push   $0xc84
+ 114:	6a 01                	push   $0x1
+ 116:	e8 35 05 00 00       	call   650 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+ 11e:	e9 45 ff ff ff       	jmp    68 <main+0x68>
+  }
+  exit();
+ 123:	e8 20 03 00 00       	call   448 <exit>
+    printf(2, "membench: cannot allocate two huge pages\n");
+ 128:	50                   	push   %eax
+ 129:	50                   	push   %eax
+ 12a:	68 94 0c 00 00       	push   $0xc94
+ 12f:	6a 02                	push   $0x2
+ 131:	e8 1a 05 00 00       	call   650 <printf>
+    exit();
+ 136:	e8 0d 03 00 00       	call   448 <exit>
+ 13b:	66 90                	xchg   %ax,%ax
+ 13d:	66 90                	xchg   %ax,%ax
+ 13f:	90                   	nop
+
+00000140 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 141:	31 c0                	xor    %eax,%eax
+{
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	53                   	push   %ebx
+ 146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 157:	83 c0 01             	add    $0x1,%eax
+ 15a:	84 d2                	test   %dl,%dl
+ 15c:	75 f2                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+ 15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 161:	89 c8                	mov    %ecx,%eax
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+ 165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+ 177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 17a:	0f b6 02             	movzbl (%edx),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 17                	jne    198 <strcmp+0x28>
+ 181:	eb 3a                	jmp    1bd <strcmp+0x4d>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 18c:	83 c2 01             	add    $0x1,%edx
+ 18f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 192:	84 c0                	test   %al,%al
+ 194:	74 1a                	je     1b0 <strcmp+0x40>
+    p++, q++;
+ 196:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 198:	0f b6 19             	movzbl (%ecx),%ebx
+ 19b:	38 c3                	cmp    %al,%bl
+ 19d:	74 e9                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 19f:	29 d8                	sub    %ebx,%eax
+}
+ 1a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a4:	c9                   	leave
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1b4:	31 c0                	xor    %eax,%eax
+ 1b6:	29 d8                	sub    %ebx,%eax
+}
+ 1b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1c0:	31 c0                	xor    %eax,%eax
+ 1c2:	eb db                	jmp    19f <strcmp+0x2f>
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1d9:	74 15                	je     1f0 <strlen+0x20>
+ 1db:	31 c0                	xor    %eax,%eax
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e7:	89 c1                	mov    %eax,%ecx
+ 1e9:	75 f5                	jne    1e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1eb:	89 c8                	mov    %ecx,%eax
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+ 1ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1f0:	31 c9                	xor    %ecx,%ecx
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	89 c8                	mov    %ecx,%eax
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 207:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	89 d7                	mov    %edx,%edi
+ 20f:	fc                   	cld
+ 210:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 212:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 215:	89 d0                	mov    %edx,%eax
+ 217:	c9                   	leave
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 22a:	0f b6 10             	movzbl (%eax),%edx
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	75 12                	jne    243 <strchr+0x23>
+ 231:	eb 1d                	jmp    250 <strchr+0x30>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	84 d2                	test   %dl,%dl
+ 241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+ 243:	38 d1                	cmp    %dl,%cl
+ 245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 250:	31 c0                	xor    %eax,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 265:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 268:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 269:	31 db                	xor    %ebx,%ebx
+{
+ 26b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 26e:	eb 27                	jmp    297 <gets+0x37>
+    cc = read(0, &c, 1);
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	6a 01                	push   $0x1
+ 275:	56                   	push   %esi
+ 276:	6a 00                	push   $0x0
+ 278:	e8 e3 01 00 00       	call   460 <read>
+    if(cc < 1)
+ 27d:	83 c4 10             	add    $0x10,%esp
+ 280:	85 c0                	test   %eax,%eax
+ 282:	7e 1d                	jle    2a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 284:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 28f:	3c 0a                	cmp    $0xa,%al
+ 291:	74 10                	je     2a3 <gets+0x43>
+ 293:	3c 0d                	cmp    $0xd,%al
+ 295:	74 0c                	je     2a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 297:	89 df                	mov    %ebx,%edi
+ 299:	83 c3 01             	add    $0x1,%ebx
+ 29c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 29f:	7c cf                	jl     270 <gets+0x10>
+ 2a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5f                   	pop    %edi
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+ 2b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	6a 00                	push   $0x0
+ 2ca:	ff 75 08             	push   0x8(%ebp)
+ 2cd:	e8 b6 01 00 00       	call   488 <open>
+  if(fd < 0)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	78 27                	js     300 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 0c             	push   0xc(%ebp)
+ 2df:	89 c3                	mov    %eax,%ebx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 b9 01 00 00       	call   4a0 <fstat>
+  close(fd);
+ 2e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ec:	e8 7f 01 00 00       	call   470 <close>
+  return r;
+ 2f1:	83 c4 10             	add    $0x10,%esp
+}
+ 2f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb ed                	jmp    2f4 <stat+0x34>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 380:	55                   	push   %ebp
+ 381:	31 d2                	xor    %edx,%edx
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	53                   	push   %ebx
+ 386:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 389:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 38c:	f7 f3                	div    %ebx
+ 38e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 398:	89 ca                	mov    %ecx,%edx
+}
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 3a0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 3a2:	c3                   	ret
+ 3a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003b0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 3b9:	8b 35 60 13 00 00    	mov    0x1360,%esi
+{
+ 3bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 3c5:	85 f6                	test   %esi,%esi
+ 3c7:	74 2f                	je     3f8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 3c9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3ce:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 3d4:	f7 e3                	mul    %ebx
+ 3d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 3d9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 3dc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 3df:	31 d2                	xor    %edx,%edx
+ 3e1:	f7 f6                	div    %esi
+ 3e3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 3e8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3eb:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 3ed:	89 da                	mov    %ebx,%edx
+}
+ 3ef:	5b                   	pop    %ebx
+ 3f0:	5e                   	pop    %esi
+ 3f1:	5f                   	pop    %edi
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 3f8:	e8 0b 01 00 00       	call   508 <tscfreq>
+ 3fd:	a3 60 13 00 00       	mov    %eax,0x1360
+ 402:	89 c6                	mov    %eax,%esi
+ 404:	eb c3                	jmp    3c9 <cyc2ns+0x19>
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	83 ec 10             	sub    $0x10,%esp
+ 417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 41a:	6a 00                	push   $0x0
+ 41c:	e8 3f 01 00 00       	call   560 <getpriority>
+ 421:	5a                   	pop    %edx
+ 422:	59                   	pop    %ecx
+ 423:	01 d8                	add    %ebx,%eax
+ 425:	50                   	push   %eax
+ 426:	6a 00                	push   $0x0
+ 428:	e8 2b 01 00 00       	call   558 <setpriority>
+  return getpriority(0);
+ 42d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 434:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 437:	83 c4 10             	add    $0x10,%esp
+}
+ 43a:	c9                   	leave
+  return getpriority(0);
+ 43b:	e9 20 01 00 00       	jmp    560 <getpriority>
+
+00000440 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 440:	b8 01 00 00 00       	mov    $0x1,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <exit>:
+SYSCALL(exit)
+ 448:	b8 02 00 00 00       	mov    $0x2,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <wait>:
+SYSCALL(wait)
+ 450:	b8 03 00 00 00       	mov    $0x3,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <pipe>:
+SYSCALL(pipe)
+ 458:	b8 04 00 00 00       	mov    $0x4,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <read>:
+SYSCALL(read)
+ 460:	b8 05 00 00 00       	mov    $0x5,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <write>:
+SYSCALL(write)
+ 468:	b8 10 00 00 00       	mov    $0x10,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <close>:
+SYSCALL(close)
+ 470:	b8 15 00 00 00       	mov    $0x15,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <kill>:
+SYSCALL(kill)
+ 478:	b8 06 00 00 00       	mov    $0x6,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <exec>:
+SYSCALL(exec)
+ 480:	b8 07 00 00 00       	mov    $0x7,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <open>:
+SYSCALL(open)
+ 488:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <mknod>:
+SYSCALL(mknod)
+ 490:	b8 11 00 00 00       	mov    $0x11,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <unlink>:
+SYSCALL(unlink)
+ 498:	b8 12 00 00 00       	mov    $0x12,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <fstat>:
+SYSCALL(fstat)
+ 4a0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <link>:
+SYSCALL(link)
+ 4a8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <mkdir>:
+SYSCALL(mkdir)
+ 4b0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <chdir>:
+SYSCALL(chdir)
+ 4b8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <dup>:
+SYSCALL(dup)
+ 4c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <getpid>:
+SYSCALL(getpid)
+ 4c8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <sbrk>:
+SYSCALL(sbrk)
+ 4d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <sleep>:
+SYSCALL(sleep)
+ 4d8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <uptime>:
+SYSCALL(uptime)
+ 4e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <promote>:
+
+SYSCALL(promote)
+ 4e8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <demote>:
+SYSCALL(demote)
+ 4f0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 4f8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 500:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <tscfreq>:
+SYSCALL(tscfreq)
+ 508:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <tracemask>:
+SYSCALL(tracemask)
+ 510:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <traceread>:
+SYSCALL(traceread)
+ 518:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <profile>:
+SYSCALL(profile)
+ 520:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <profread>:
+SYSCALL(profread)
+ 528:	b8 20 00 00 00       	mov    $0x20,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <lockstat>:
+SYSCALL(lockstat)
+ 530:	b8 21 00 00 00       	mov    $0x21,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 538:	b8 22 00 00 00       	mov    $0x22,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <sysstat>:
+SYSCALL(sysstat)
+ 540:	b8 23 00 00 00       	mov    $0x23,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <kbench>:
+SYSCALL(kbench)
+ 548:	b8 24 00 00 00       	mov    $0x24,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <yield>:
+SYSCALL(yield)
+ 550:	b8 25 00 00 00       	mov    $0x25,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <setpriority>:
+SYSCALL(setpriority)
+ 558:	b8 26 00 00 00       	mov    $0x26,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <getpriority>:
+SYSCALL(getpriority)
+ 560:	b8 27 00 00 00       	mov    $0x27,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 568:	b8 28 00 00 00       	mov    $0x28,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 570:	b8 29 00 00 00       	mov    $0x29,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <clone>:
+SYSCALL(clone)
+ 578:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <join>:
+SYSCALL(join)
+ 580:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <futex_wait>:
+SYSCALL(futex_wait)
+ 588:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <futex_wake>:
+SYSCALL(futex_wake)
+ 590:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <spawn>:
+SYSCALL(spawn)
+ 598:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <diskstat>:
+SYSCALL(diskstat)
+ 5a0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+ 5a8:	66 90                	xchg   %ax,%ax
+ 5aa:	66 90                	xchg   %ax,%ax
+ 5ac:	66 90                	xchg   %ax,%ax
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 44 0d 00 00 	movzbl 0xd44(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 3b fe ff ff       	call   468 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 d1 fd ff ff       	call   468 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 ec 0c 00 00 	jmp    *0xcec(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 72 fd ff ff       	call   468 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 60 fd ff ff       	call   468 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 e6 fc ff ff       	call   468 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 96 fc ff ff       	call   468 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb e2 0c 00 00       	mov    $0xce2,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 800:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	a1 64 13 00 00       	mov    0x1364,%eax
+{
+ 806:	89 e5                	mov    %esp,%ebp
+ 808:	57                   	push   %edi
+ 809:	56                   	push   %esi
+ 80a:	53                   	push   %ebx
+ 80b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 80e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 818:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81c:	39 ca                	cmp    %ecx,%edx
+ 81e:	73 30                	jae    850 <free+0x50>
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 04                	jb     828 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 824:	39 c2                	cmp    %eax,%edx
+ 826:	72 f0                	jb     818 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 828:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 82b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 82e:	39 f8                	cmp    %edi,%eax
+ 830:	74 2e                	je     860 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 832:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 835:	8b 42 04             	mov    0x4(%edx),%eax
+ 838:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 83b:	39 f1                	cmp    %esi,%ecx
+ 83d:	74 38                	je     877 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 83f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 841:	5b                   	pop    %ebx
+  freep = p;
+ 842:	89 15 64 13 00 00    	mov    %edx,0x1364
+}
+ 848:	5e                   	pop    %esi
+ 849:	5f                   	pop    %edi
+ 84a:	5d                   	pop    %ebp
+ 84b:	c3                   	ret
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 d0                	jb     824 <free+0x24>
+ 854:	eb c2                	jmp    818 <free+0x18>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 860:	03 70 04             	add    0x4(%eax),%esi
+ 863:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 866:	8b 02                	mov    (%edx),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 86d:	8b 42 04             	mov    0x4(%edx),%eax
+ 870:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 873:	39 f1                	cmp    %esi,%ecx
+ 875:	75 c8                	jne    83f <free+0x3f>
+    p->s.size += bp->s.size;
+ 877:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 87a:	89 15 64 13 00 00    	mov    %edx,0x1364
+    p->s.size += bp->s.size;
+ 880:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 883:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 886:	89 0a                	mov    %ecx,(%edx)
+}
+ 888:	5b                   	pop    %ebx
+ 889:	5e                   	pop    %esi
+ 88a:	5f                   	pop    %edi
+ 88b:	5d                   	pop    %ebp
+ 88c:	c3                   	ret
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 89c:	8b 15 64 13 00 00    	mov    0x1364,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8a5:	c1 ef 03             	shr    $0x3,%edi
+ 8a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8ab:	85 d2                	test   %edx,%edx
+ 8ad:	0f 84 8d 00 00 00    	je     940 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b8:	39 f9                	cmp    %edi,%ecx
+ 8ba:	73 64                	jae    920 <malloc+0x90>
+  if(nu < 4096)
+ 8bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8c1:	39 df                	cmp    %ebx,%edi
+ 8c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8cd:	eb 0a                	jmp    8d9 <malloc+0x49>
+ 8cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d5:	39 f9                	cmp    %edi,%ecx
+ 8d7:	73 47                	jae    920 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8d9:	89 c2                	mov    %eax,%edx
+ 8db:	39 05 64 13 00 00    	cmp    %eax,0x1364
+ 8e1:	75 ed                	jne    8d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	56                   	push   %esi
+ 8e7:	e8 e4 fb ff ff       	call   4d0 <sbrk>
+  if(p == (char*)-1)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+ 8ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8f2:	74 1c                	je     910 <malloc+0x80>
+  hp->s.size = nu;
+ 8f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8f7:	83 ec 0c             	sub    $0xc,%esp
+ 8fa:	83 c0 08             	add    $0x8,%eax
+ 8fd:	50                   	push   %eax
+ 8fe:	e8 fd fe ff ff       	call   800 <free>
+  return freep;
+ 903:	8b 15 64 13 00 00    	mov    0x1364,%edx
+      if((p = morecore(nunits)) == 0)
+ 909:	83 c4 10             	add    $0x10,%esp
+ 90c:	85 d2                	test   %edx,%edx
+ 90e:	75 c0                	jne    8d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 913:	31 c0                	xor    %eax,%eax
+}
+ 915:	5b                   	pop    %ebx
+ 916:	5e                   	pop    %esi
+ 917:	5f                   	pop    %edi
+ 918:	5d                   	pop    %ebp
+ 919:	c3                   	ret
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 920:	39 cf                	cmp    %ecx,%edi
+ 922:	74 4c                	je     970 <malloc+0xe0>
+        p->s.size -= nunits;
+ 924:	29 f9                	sub    %edi,%ecx
+ 926:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 929:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 92c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 92f:	89 15 64 13 00 00    	mov    %edx,0x1364
+}
+ 935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 938:	83 c0 08             	add    $0x8,%eax
+}
+ 93b:	5b                   	pop    %ebx
+ 93c:	5e                   	pop    %esi
+ 93d:	5f                   	pop    %edi
+ 93e:	5d                   	pop    %ebp
+ 93f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 940:	c7 05 64 13 00 00 68 	movl   $0x1368,0x1364
+ 947:	13 00 00 
+    base.s.size = 0;
+ 94a:	b8 68 13 00 00       	mov    $0x1368,%eax
+    base.s.ptr = freep = prevp = &base;
+ 94f:	c7 05 68 13 00 00 68 	movl   $0x1368,0x1368
+ 956:	13 00 00 
+    base.s.size = 0;
+ 959:	c7 05 6c 13 00 00 00 	movl   $0x0,0x136c
+ 960:	00 00 00 
+    if(p->s.size >= nunits){
+ 963:	e9 54 ff ff ff       	jmp    8bc <malloc+0x2c>
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 970:	8b 08                	mov    (%eax),%ecx
+ 972:	89 0a                	mov    %ecx,(%edx)
+ 974:	eb b9                	jmp    92f <malloc+0x9f>
+ 976:	66 90                	xchg   %ax,%ax
+ 978:	66 90                	xchg   %ax,%ax
+ 97a:	66 90                	xchg   %ax,%ax
+ 97c:	66 90                	xchg   %ax,%ax
+ 97e:	66 90                	xchg   %ax,%ax
+
+00000980 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 20             	sub    $0x20,%esp
+ 989:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 98c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 98f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 992:	68 e8 03 00 00       	push   $0x3e8
+ 997:	57                   	push   %edi
+ 998:	56                   	push   %esi
+ 999:	e8 e2 f9 ff ff       	call   380 <udiv64>
+ 99e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9a0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 9a3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 9a9:	29 c1                	sub    %eax,%ecx
+ 9ab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9ae:	68 e8 03 00 00       	push   $0x3e8
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	e8 c6 f9 ff ff       	call   380 <udiv64>
+ 9ba:	83 c4 0c             	add    $0xc,%esp
+ 9bd:	50                   	push   %eax
+ 9be:	68 55 0d 00 00       	push   $0xd55
+ 9c3:	53                   	push   %ebx
+ 9c4:	e8 87 fc ff ff       	call   650 <printf>
+  if(frac < 100)
+ 9c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 9cc:	83 c4 10             	add    $0x10,%esp
+ 9cf:	83 f9 63             	cmp    $0x63,%ecx
+ 9d2:	76 1c                	jbe    9f0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 9d4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 9d7:	c7 45 0c 59 0d 00 00 	movl   $0xd59,0xc(%ebp)
+ 9de:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 9e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e4:	5b                   	pop    %ebx
+ 9e5:	5e                   	pop    %esi
+ 9e6:	5f                   	pop    %edi
+ 9e7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 9e8:	e9 63 fc ff ff       	jmp    650 <printf>
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 9f0:	83 ec 08             	sub    $0x8,%esp
+ 9f3:	68 80 0c 00 00       	push   $0xc80
+ 9f8:	53                   	push   %ebx
+ 9f9:	e8 52 fc ff ff       	call   650 <printf>
+  if(frac < 10)
+ 9fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a01:	83 c4 10             	add    $0x10,%esp
+ a04:	83 f9 09             	cmp    $0x9,%ecx
+ a07:	77 cb                	ja     9d4 <printps+0x54>
+    printf(fd, "0");
+ a09:	83 ec 08             	sub    $0x8,%esp
+ a0c:	68 80 0c 00 00       	push   $0xc80
+ a11:	53                   	push   %ebx
+ a12:	e8 39 fc ff ff       	call   650 <printf>
+ a17:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a1a:	83 c4 10             	add    $0x10,%esp
+ a1d:	eb b5                	jmp    9d4 <printps+0x54>
+ a1f:	90                   	nop
+
+00000a20 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a2c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ a2f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a32:	83 e8 01             	sub    $0x1,%eax
+ a35:	3d ff 00 00 00       	cmp    $0xff,%eax
+ a3a:	0f 87 37 02 00 00    	ja     c77 <bench+0x257>
+ a40:	8b 7d 14             	mov    0x14(%ebp),%edi
+ a43:	85 ff                	test   %edi,%edi
+ a45:	0f 84 2c 02 00 00    	je     c77 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ a4b:	83 ec 0c             	sub    $0xc,%esp
+ a4e:	ff 75 10             	push   0x10(%ebp)
+ a51:	ff 55 0c             	call   *0xc(%ebp)
+ a54:	5b                   	pop    %ebx
+ a55:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ a58:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ a5a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ a5d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ a60:	83 c4 10             	add    $0x10,%esp
+ a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a67:	90                   	nop
+    t0 = cycles();
+ a68:	e8 33 f9 ff ff       	call   3a0 <cycles>
+    fn(arg);
+ a6d:	83 ec 0c             	sub    $0xc,%esp
+ a70:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ a73:	89 c6                	mov    %eax,%esi
+ a75:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ a77:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ a7a:	e8 21 f9 ff ff       	call   3a0 <cycles>
+ a7f:	29 f0                	sub    %esi,%eax
+ a81:	19 fa                	sbb    %edi,%edx
+ a83:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a8a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ a8d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a94:	83 c3 01             	add    $0x1,%ebx
+ a97:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ a9a:	7f cc                	jg     a68 <bench+0x48>
+  for(i = 1; i < n; i++){
+ a9c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ aa0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ aa3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ aa9:	bf 01 00 00 00       	mov    $0x1,%edi
+ aae:	74 77                	je     b27 <bench+0x107>
+ ab0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ab7:	90                   	nop
+    v = a[i];
+ ab8:	8b 01                	mov    (%ecx),%eax
+ aba:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ abd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ ac3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ ac9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ acf:	89 c8                	mov    %ecx,%eax
+ ad1:	eb 1b                	jmp    aee <bench+0xce>
+ ad3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ad7:	90                   	nop
+      a[j] = a[j-1];
+ ad8:	89 08                	mov    %ecx,(%eax)
+ ada:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ add:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ ae0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ ae6:	39 c3                	cmp    %eax,%ebx
+ ae8:	0f 84 72 01 00 00    	je     c60 <bench+0x240>
+ aee:	8b 50 fc             	mov    -0x4(%eax),%edx
+ af1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ af4:	89 f7                	mov    %esi,%edi
+ af6:	89 c3                	mov    %eax,%ebx
+ af8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ afe:	19 d7                	sbb    %edx,%edi
+ b00:	72 d6                	jb     ad8 <bench+0xb8>
+ b02:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b08:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ b0e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ b14:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ b17:	83 c7 01             	add    $0x1,%edi
+ b1a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ b1d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ b1f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ b22:	75 94                	jne    ab8 <bench+0x98>
+ b24:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b27:	83 ec 08             	sub    $0x8,%esp
+ b2a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ b30:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ b35:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ b3b:	e8 70 f8 ff ff       	call   3b0 <cyc2ns>
+ b40:	83 c4 0c             	add    $0xc,%esp
+ b43:	ff 75 14             	push   0x14(%ebp)
+ b46:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b4c:	f7 e3                	mul    %ebx
+ b4e:	01 ca                	add    %ecx,%edx
+ b50:	52                   	push   %edx
+ b51:	50                   	push   %eax
+ b52:	e8 29 f8 ff ff       	call   380 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ b57:	89 06                	mov    %eax,(%esi)
+ b59:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b5c:	5f                   	pop    %edi
+ b5d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ b5e:	8b 45 18             	mov    0x18(%ebp),%eax
+ b61:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b63:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ b6a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ b71:	e8 3a f8 ff ff       	call   3b0 <cyc2ns>
+ b76:	83 c4 0c             	add    $0xc,%esp
+ b79:	ff 75 14             	push   0x14(%ebp)
+ b7c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b82:	f7 e3                	mul    %ebx
+ b84:	01 ca                	add    %ecx,%edx
+ b86:	52                   	push   %edx
+ b87:	50                   	push   %eax
+ b88:	e8 f3 f7 ff ff       	call   380 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ b8d:	89 46 08             	mov    %eax,0x8(%esi)
+ b90:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b93:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b94:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b97:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b98:	8d 50 01             	lea    0x1(%eax),%edx
+ b9b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ ba0:	6b d2 63             	imul   $0x63,%edx,%edx
+ ba3:	f7 e2                	mul    %edx
+ ba5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ba8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ baf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ bb6:	e8 f5 f7 ff ff       	call   3b0 <cyc2ns>
+ bbb:	83 c4 0c             	add    $0xc,%esp
+ bbe:	ff 75 14             	push   0x14(%ebp)
+ bc1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ bc7:	f7 e3                	mul    %ebx
+ bc9:	01 ca                	add    %ecx,%edx
+ bcb:	52                   	push   %edx
+ bcc:	50                   	push   %eax
+ bcd:	e8 ae f7 ff ff       	call   380 <udiv64>
+
+  if(name){
+ bd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ bd5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bd8:	89 46 10             	mov    %eax,0x10(%esi)
+ bdb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ bde:	85 c9                	test   %ecx,%ecx
+ be0:	74 72                	je     c54 <bench+0x234>
+    printf(1, "%s: min ", name);
+ be2:	83 ec 04             	sub    $0x4,%esp
+ be5:	ff 75 08             	push   0x8(%ebp)
+ be8:	68 5c 0d 00 00       	push   $0xd5c
+ bed:	6a 01                	push   $0x1
+ bef:	e8 5c fa ff ff       	call   650 <printf>
+    printps(1, st->min);
+ bf4:	83 c4 0c             	add    $0xc,%esp
+ bf7:	ff 76 04             	push   0x4(%esi)
+ bfa:	ff 36                	push   (%esi)
+ bfc:	6a 01                	push   $0x1
+ bfe:	e8 7d fd ff ff       	call   980 <printps>
+    printf(1, " median ");
+ c03:	58                   	pop    %eax
+ c04:	5a                   	pop    %edx
+ c05:	68 65 0d 00 00       	push   $0xd65
+ c0a:	6a 01                	push   $0x1
+ c0c:	e8 3f fa ff ff       	call   650 <printf>
+    printps(1, st->median);
+ c11:	83 c4 0c             	add    $0xc,%esp
+ c14:	ff 76 0c             	push   0xc(%esi)
+ c17:	ff 76 08             	push   0x8(%esi)
+ c1a:	6a 01                	push   $0x1
+ c1c:	e8 5f fd ff ff       	call   980 <printps>
+    printf(1, " p99 ");
+ c21:	59                   	pop    %ecx
+ c22:	5b                   	pop    %ebx
+ c23:	68 6e 0d 00 00       	push   $0xd6e
+ c28:	6a 01                	push   $0x1
+ c2a:	e8 21 fa ff ff       	call   650 <printf>
+    printps(1, st->p99);
+ c2f:	83 c4 0c             	add    $0xc,%esp
+ c32:	ff 76 14             	push   0x14(%esi)
+ c35:	ff 76 10             	push   0x10(%esi)
+ c38:	6a 01                	push   $0x1
+ c3a:	e8 41 fd ff ff       	call   980 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ c3f:	83 c4 0c             	add    $0xc,%esp
+ c42:	ff 75 18             	push   0x18(%ebp)
+ c45:	68 74 0d 00 00       	push   $0xd74
+ c4a:	6a 01                	push   $0x1
+ c4c:	e8 ff f9 ff ff       	call   650 <printf>
+ c51:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ c54:	31 c0                	xor    %eax,%eax
+}
+ c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c59:	5b                   	pop    %ebx
+ c5a:	5e                   	pop    %esi
+ c5b:	5f                   	pop    %edi
+ c5c:	5d                   	pop    %ebp
+ c5d:	c3                   	ret
+ c5e:	66 90                	xchg   %ax,%ax
+ c60:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c66:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ c6c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c72:	e9 97 fe ff ff       	jmp    b0e <bench+0xee>
+    return -1;
+ c77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c7c:	eb d8                	jmp    c56 <bench+0x236>
@@ -0,0 +1,32 @@
+// Report bytes per cycle for the kernel's copy and clear routines.
+
+#include "types.h"
+#include "user.h"
+#include "kbench.h"
+
+#define NRES 16
+
+static struct kbresult res[NRES];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  uint x;
+
+  sched_setaffinity(0, 1);   // pin for repeatable numbers
+  if((n = kbench(KB_MEM, res, NRES)) < 0){
+    printf(2, "membench: cannot allocate two huge pages\n");
+    exit();
+  }
+  printf(1, "routine\t\t\tbytes/cycle\tus per 4MB\n");
+  for(i = 0; i < n; i++){
+    x = udiv64((uint64)res[i].ops * 100, (uint)res[i].cycles);
+    printf(1, "%s\t", res[i].name);
+    if(strlen(res[i].name) < 16)
+      printf(1, "\t");
+    printf(1, "%d.%s%d\t\t%d\n", x / 100, x % 100 < 10 ? "0" : "", x % 100,
+           (uint)udiv64(cyc2ns(res[i].cycles), 1000));
+  }
+  exit();
+}
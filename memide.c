@@ -35,6 +35,7 @@ ideintr(void)
 // Sync buf with disk.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Reads are done at once, so B_ASYNC only means calling bdone.
 void
 iderw(struct buf *b)
 {
@@ -57,4 +58,24 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC){
+    b->flags &= ~B_ASYNC;
+    bdone(b);
+  }
+}
+
+void
+iderwv(struct buf **bv, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bv[i]);
+}
+
+// No queue to report on.
+int
+idestatread(struct diskstat *buf, int n)
+{
+  return 0;
 }
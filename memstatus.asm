@@ -0,0 +1,1726 @@
+
+_memstatus:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+
+int main(int argc, char **argv) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+    printf(1, "Available Physical memory = %d pages\n", get_free_pa_space());
+  11:	e8 da 03 00 00       	call   3f0 <get_free_pa_space>
+  16:	83 ec 04             	sub    $0x4,%esp
+  19:	50                   	push   %eax
+  1a:	68 70 0b 00 00       	push   $0xb70
+  1f:	6a 01                	push   $0x1
+  21:	e8 1a 05 00 00       	call   540 <printf>
+    exit();
+  26:	e8 0d 03 00 00       	call   338 <exit>
+  2b:	66 90                	xchg   %ax,%ax
+  2d:	66 90                	xchg   %ax,%ax
+  2f:	90                   	nop
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 e3 01 00 00       	call   350 <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 b6 01 00 00       	call   378 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 b9 01 00 00       	call   390 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 7f 01 00 00       	call   360 <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 270:	55                   	push   %ebp
+ 271:	31 d2                	xor    %edx,%edx
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	53                   	push   %ebx
+ 276:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 279:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 27c:	f7 f3                	div    %ebx
+ 27e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 280:	8b 45 08             	mov    0x8(%ebp),%eax
+ 283:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 288:	89 ca                	mov    %ecx,%edx
+}
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 290:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 292:	c3                   	ret
+ 293:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002a0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	53                   	push   %ebx
+ 2a6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 2a9:	8b 35 b0 0f 00 00    	mov    0xfb0,%esi
+{
+ 2af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 2b5:	85 f6                	test   %esi,%esi
+ 2b7:	74 2f                	je     2e8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 2b9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 2be:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 2c4:	f7 e3                	mul    %ebx
+ 2c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 2c9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 2cc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2cf:	31 d2                	xor    %edx,%edx
+ 2d1:	f7 f6                	div    %esi
+ 2d3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 2d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 2d8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 2db:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 2dd:	89 da                	mov    %ebx,%edx
+}
+ 2df:	5b                   	pop    %ebx
+ 2e0:	5e                   	pop    %esi
+ 2e1:	5f                   	pop    %edi
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 2e8:	e8 0b 01 00 00       	call   3f8 <tscfreq>
+ 2ed:	a3 b0 0f 00 00       	mov    %eax,0xfb0
+ 2f2:	89 c6                	mov    %eax,%esi
+ 2f4:	eb c3                	jmp    2b9 <cyc2ns+0x19>
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	83 ec 10             	sub    $0x10,%esp
+ 307:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 30a:	6a 00                	push   $0x0
+ 30c:	e8 3f 01 00 00       	call   450 <getpriority>
+ 311:	5a                   	pop    %edx
+ 312:	59                   	pop    %ecx
+ 313:	01 d8                	add    %ebx,%eax
+ 315:	50                   	push   %eax
+ 316:	6a 00                	push   $0x0
+ 318:	e8 2b 01 00 00       	call   448 <setpriority>
+  return getpriority(0);
+ 31d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 324:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 327:	83 c4 10             	add    $0x10,%esp
+}
+ 32a:	c9                   	leave
+  return getpriority(0);
+ 32b:	e9 20 01 00 00       	jmp    450 <getpriority>
+
+00000330 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 330:	b8 01 00 00 00       	mov    $0x1,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <exit>:
+SYSCALL(exit)
+ 338:	b8 02 00 00 00       	mov    $0x2,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <wait>:
+SYSCALL(wait)
+ 340:	b8 03 00 00 00       	mov    $0x3,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <pipe>:
+SYSCALL(pipe)
+ 348:	b8 04 00 00 00       	mov    $0x4,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <read>:
+SYSCALL(read)
+ 350:	b8 05 00 00 00       	mov    $0x5,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <write>:
+SYSCALL(write)
+ 358:	b8 10 00 00 00       	mov    $0x10,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <close>:
+SYSCALL(close)
+ 360:	b8 15 00 00 00       	mov    $0x15,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <kill>:
+SYSCALL(kill)
+ 368:	b8 06 00 00 00       	mov    $0x6,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <exec>:
+SYSCALL(exec)
+ 370:	b8 07 00 00 00       	mov    $0x7,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <open>:
+SYSCALL(open)
+ 378:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <mknod>:
+SYSCALL(mknod)
+ 380:	b8 11 00 00 00       	mov    $0x11,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <unlink>:
+SYSCALL(unlink)
+ 388:	b8 12 00 00 00       	mov    $0x12,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <fstat>:
+SYSCALL(fstat)
+ 390:	b8 08 00 00 00       	mov    $0x8,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <link>:
+SYSCALL(link)
+ 398:	b8 13 00 00 00       	mov    $0x13,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <mkdir>:
+SYSCALL(mkdir)
+ 3a0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <chdir>:
+SYSCALL(chdir)
+ 3a8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <dup>:
+SYSCALL(dup)
+ 3b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <getpid>:
+SYSCALL(getpid)
+ 3b8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <sbrk>:
+SYSCALL(sbrk)
+ 3c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <sleep>:
+SYSCALL(sleep)
+ 3c8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <uptime>:
+SYSCALL(uptime)
+ 3d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <promote>:
+
+SYSCALL(promote)
+ 3d8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <demote>:
+SYSCALL(demote)
+ 3e0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 3e8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 3f0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <tscfreq>:
+SYSCALL(tscfreq)
+ 3f8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <tracemask>:
+SYSCALL(tracemask)
+ 400:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <traceread>:
+SYSCALL(traceread)
+ 408:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <profile>:
+SYSCALL(profile)
+ 410:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <profread>:
+SYSCALL(profread)
+ 418:	b8 20 00 00 00       	mov    $0x20,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <lockstat>:
+SYSCALL(lockstat)
+ 420:	b8 21 00 00 00       	mov    $0x21,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 428:	b8 22 00 00 00       	mov    $0x22,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <sysstat>:
+SYSCALL(sysstat)
+ 430:	b8 23 00 00 00       	mov    $0x23,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <kbench>:
+SYSCALL(kbench)
+ 438:	b8 24 00 00 00       	mov    $0x24,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <yield>:
+SYSCALL(yield)
+ 440:	b8 25 00 00 00       	mov    $0x25,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <setpriority>:
+SYSCALL(setpriority)
+ 448:	b8 26 00 00 00       	mov    $0x26,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <getpriority>:
+SYSCALL(getpriority)
+ 450:	b8 27 00 00 00       	mov    $0x27,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 458:	b8 28 00 00 00       	mov    $0x28,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 460:	b8 29 00 00 00       	mov    $0x29,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <clone>:
+SYSCALL(clone)
+ 468:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <join>:
+SYSCALL(join)
+ 470:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <futex_wait>:
+SYSCALL(futex_wait)
+ 478:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <futex_wake>:
+SYSCALL(futex_wake)
+ 480:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <spawn>:
+SYSCALL(spawn)
+ 488:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <diskstat>:
+SYSCALL(diskstat)
+ 490:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+ 498:	66 90                	xchg   %ax,%ax
+ 49a:	66 90                	xchg   %ax,%ax
+ 49c:	66 90                	xchg   %ax,%ax
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4a8:	89 d1                	mov    %edx,%ecx
+{
+ 4aa:	83 ec 3c             	sub    $0x3c,%esp
+ 4ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4b0:	85 d2                	test   %edx,%edx
+ 4b2:	0f 89 80 00 00 00    	jns    538 <printint+0x98>
+ 4b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4bc:	74 7a                	je     538 <printint+0x98>
+    x = -xx;
+ 4be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4c8:	31 f6                	xor    %esi,%esi
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	31 d2                	xor    %edx,%edx
+ 4d4:	89 f7                	mov    %esi,%edi
+ 4d6:	f7 f3                	div    %ebx
+ 4d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4db:	0f b6 92 f8 0b 00 00 	movzbl 0xbf8(%edx),%edx
+ 4e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4e6:	89 ca                	mov    %ecx,%edx
+ 4e8:	89 c1                	mov    %eax,%ecx
+ 4ea:	39 da                	cmp    %ebx,%edx
+ 4ec:	73 e2                	jae    4d0 <printint+0x30>
+  if(neg)
+ 4ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4f1:	85 c0                	test   %eax,%eax
+ 4f3:	74 07                	je     4fc <printint+0x5c>
+    buf[i++] = '-';
+ 4f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4fa:	89 f7                	mov    %esi,%edi
+ 4fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 502:	01 df                	add    %ebx,%edi
+ 504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 50b:	83 ec 04             	sub    $0x4,%esp
+ 50e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 514:	6a 01                	push   $0x1
+ 516:	50                   	push   %eax
+ 517:	56                   	push   %esi
+ 518:	e8 3b fe ff ff       	call   358 <write>
+  while(--i >= 0)
+ 51d:	89 f8                	mov    %edi,%eax
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	83 ef 01             	sub    $0x1,%edi
+ 525:	39 d8                	cmp    %ebx,%eax
+ 527:	75 df                	jne    508 <printint+0x68>
+}
+ 529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52c:	5b                   	pop    %ebx
+ 52d:	5e                   	pop    %esi
+ 52e:	5f                   	pop    %edi
+ 52f:	5d                   	pop    %ebp
+ 530:	c3                   	ret
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 538:	31 c0                	xor    %eax,%eax
+ 53a:	eb 89                	jmp    4c5 <printint+0x25>
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 54c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 54f:	0f b6 1e             	movzbl (%esi),%ebx
+ 552:	83 c6 01             	add    $0x1,%esi
+ 555:	84 db                	test   %bl,%bl
+ 557:	74 67                	je     5c0 <printf+0x80>
+ 559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 55c:	31 d2                	xor    %edx,%edx
+ 55e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 561:	eb 34                	jmp    597 <printf+0x57>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 56b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 570:	83 f8 25             	cmp    $0x25,%eax
+ 573:	74 18                	je     58d <printf+0x4d>
+  write(fd, &c, 1);
+ 575:	83 ec 04             	sub    $0x4,%esp
+ 578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57e:	6a 01                	push   $0x1
+ 580:	50                   	push   %eax
+ 581:	57                   	push   %edi
+ 582:	e8 d1 fd ff ff       	call   358 <write>
+ 587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 58a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 58d:	0f b6 1e             	movzbl (%esi),%ebx
+ 590:	83 c6 01             	add    $0x1,%esi
+ 593:	84 db                	test   %bl,%bl
+ 595:	74 29                	je     5c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 59a:	85 d2                	test   %edx,%edx
+ 59c:	74 ca                	je     568 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 59e:	83 fa 25             	cmp    $0x25,%edx
+ 5a1:	75 ea                	jne    58d <printf+0x4d>
+      if(c == 'd'){
+ 5a3:	83 f8 25             	cmp    $0x25,%eax
+ 5a6:	0f 84 24 01 00 00    	je     6d0 <printf+0x190>
+ 5ac:	83 e8 63             	sub    $0x63,%eax
+ 5af:	83 f8 15             	cmp    $0x15,%eax
+ 5b2:	77 1c                	ja     5d0 <printf+0x90>
+ 5b4:	ff 24 85 a0 0b 00 00 	jmp    *0xba0(,%eax,4)
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c3:	5b                   	pop    %ebx
+ 5c4:	5e                   	pop    %esi
+ 5c5:	5f                   	pop    %edi
+ 5c6:	5d                   	pop    %ebp
+ 5c7:	c3                   	ret
+ 5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5da:	6a 01                	push   $0x1
+ 5dc:	52                   	push   %edx
+ 5dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5e0:	57                   	push   %edi
+ 5e1:	e8 72 fd ff ff       	call   358 <write>
+ 5e6:	83 c4 0c             	add    $0xc,%esp
+ 5e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ec:	6a 01                	push   $0x1
+ 5ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5f1:	52                   	push   %edx
+ 5f2:	57                   	push   %edi
+ 5f3:	e8 60 fd ff ff       	call   358 <write>
+        putc(fd, c);
+ 5f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fb:	31 d2                	xor    %edx,%edx
+ 5fd:	eb 8e                	jmp    58d <printf+0x4d>
+ 5ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 00                	push   $0x0
+ 60f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 614:	e8 87 fe ff ff       	call   4a0 <printint>
+        ap++;
+ 619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 61c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 67 ff ff ff       	jmp    58d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 635:	83 c0 04             	add    $0x4,%eax
+ 638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 63b:	85 db                	test   %ebx,%ebx
+ 63d:	0f 84 9d 00 00 00    	je     6e0 <printf+0x1a0>
+        while(*s != 0){
+ 643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 648:	84 c0                	test   %al,%al
+ 64a:	0f 84 3d ff ff ff    	je     58d <printf+0x4d>
+ 650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 656:	89 de                	mov    %ebx,%esi
+ 658:	89 d3                	mov    %edx,%ebx
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	53                   	push   %ebx
+ 66c:	57                   	push   %edi
+ 66d:	e8 e6 fc ff ff       	call   358 <write>
+        while(*s != 0){
+ 672:	0f b6 06             	movzbl (%esi),%eax
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	84 c0                	test   %al,%al
+ 67a:	75 e4                	jne    660 <printf+0x120>
+      state = 0;
+ 67c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 67f:	31 d2                	xor    %edx,%edx
+ 681:	e9 07 ff ff ff       	jmp    58d <printf+0x4d>
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 01                	push   $0x1
+ 69f:	e9 6b ff ff ff       	jmp    60f <printf+0xcf>
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	52                   	push   %edx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 96 fc ff ff       	call   358 <write>
+        ap++;
+ 6c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c8:	31 d2                	xor    %edx,%edx
+ 6ca:	e9 be fe ff ff       	jmp    58d <printf+0x4d>
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d9:	6a 01                	push   $0x1
+ 6db:	e9 11 ff ff ff       	jmp    5f1 <printf+0xb1>
+ 6e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6e5:	bb 96 0b 00 00       	mov    $0xb96,%ebx
+ 6ea:	e9 61 ff ff ff       	jmp    650 <printf+0x110>
+ 6ef:	90                   	nop
+
+000006f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f1:	a1 b4 0f 00 00       	mov    0xfb4,%eax
+{
+ 6f6:	89 e5                	mov    %esp,%ebp
+ 6f8:	57                   	push   %edi
+ 6f9:	56                   	push   %esi
+ 6fa:	53                   	push   %ebx
+ 6fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 708:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 70a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 70c:	39 ca                	cmp    %ecx,%edx
+ 70e:	73 30                	jae    740 <free+0x50>
+ 710:	39 c1                	cmp    %eax,%ecx
+ 712:	72 04                	jb     718 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 714:	39 c2                	cmp    %eax,%edx
+ 716:	72 f0                	jb     708 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 71b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 71e:	39 f8                	cmp    %edi,%eax
+ 720:	74 2e                	je     750 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 722:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 725:	8b 42 04             	mov    0x4(%edx),%eax
+ 728:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 72b:	39 f1                	cmp    %esi,%ecx
+ 72d:	74 38                	je     767 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 72f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 731:	5b                   	pop    %ebx
+  freep = p;
+ 732:	89 15 b4 0f 00 00    	mov    %edx,0xfb4
+}
+ 738:	5e                   	pop    %esi
+ 739:	5f                   	pop    %edi
+ 73a:	5d                   	pop    %ebp
+ 73b:	c3                   	ret
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 740:	39 c1                	cmp    %eax,%ecx
+ 742:	72 d0                	jb     714 <free+0x24>
+ 744:	eb c2                	jmp    708 <free+0x18>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 750:	03 70 04             	add    0x4(%eax),%esi
+ 753:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 756:	8b 02                	mov    (%edx),%eax
+ 758:	8b 00                	mov    (%eax),%eax
+ 75a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 75d:	8b 42 04             	mov    0x4(%edx),%eax
+ 760:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 763:	39 f1                	cmp    %esi,%ecx
+ 765:	75 c8                	jne    72f <free+0x3f>
+    p->s.size += bp->s.size;
+ 767:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 76a:	89 15 b4 0f 00 00    	mov    %edx,0xfb4
+    p->s.size += bp->s.size;
+ 770:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 773:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 776:	89 0a                	mov    %ecx,(%edx)
+}
+ 778:	5b                   	pop    %ebx
+ 779:	5e                   	pop    %esi
+ 77a:	5f                   	pop    %edi
+ 77b:	5d                   	pop    %ebp
+ 77c:	c3                   	ret
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000780 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 78c:	8b 15 b4 0f 00 00    	mov    0xfb4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 792:	8d 78 07             	lea    0x7(%eax),%edi
+ 795:	c1 ef 03             	shr    $0x3,%edi
+ 798:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 79b:	85 d2                	test   %edx,%edx
+ 79d:	0f 84 8d 00 00 00    	je     830 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7a8:	39 f9                	cmp    %edi,%ecx
+ 7aa:	73 64                	jae    810 <malloc+0x90>
+  if(nu < 4096)
+ 7ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7b1:	39 df                	cmp    %ebx,%edi
+ 7b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7bd:	eb 0a                	jmp    7c9 <malloc+0x49>
+ 7bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7c5:	39 f9                	cmp    %edi,%ecx
+ 7c7:	73 47                	jae    810 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7c9:	89 c2                	mov    %eax,%edx
+ 7cb:	39 05 b4 0f 00 00    	cmp    %eax,0xfb4
+ 7d1:	75 ed                	jne    7c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	56                   	push   %esi
+ 7d7:	e8 e4 fb ff ff       	call   3c0 <sbrk>
+  if(p == (char*)-1)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+ 7df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7e2:	74 1c                	je     800 <malloc+0x80>
+  hp->s.size = nu;
+ 7e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7e7:	83 ec 0c             	sub    $0xc,%esp
+ 7ea:	83 c0 08             	add    $0x8,%eax
+ 7ed:	50                   	push   %eax
+ 7ee:	e8 fd fe ff ff       	call   6f0 <free>
+  return freep;
+ 7f3:	8b 15 b4 0f 00 00    	mov    0xfb4,%edx
+      if((p = morecore(nunits)) == 0)
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	85 d2                	test   %edx,%edx
+ 7fe:	75 c0                	jne    7c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 803:	31 c0                	xor    %eax,%eax
+}
+ 805:	5b                   	pop    %ebx
+ 806:	5e                   	pop    %esi
+ 807:	5f                   	pop    %edi
+ 808:	5d                   	pop    %ebp
+ 809:	c3                   	ret
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 810:	39 cf                	cmp    %ecx,%edi
+ 812:	74 4c                	je     860 <malloc+0xe0>
+        p->s.size -= nunits;
+ 814:	29 f9                	sub    %edi,%ecx
+ 816:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 819:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 81c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 81f:	89 15 b4 0f 00 00    	mov    %edx,0xfb4
+}
+ 825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 828:	83 c0 08             	add    $0x8,%eax
+}
+ 82b:	5b                   	pop    %ebx
+ 82c:	5e                   	pop    %esi
+ 82d:	5f                   	pop    %edi
+ 82e:	5d                   	pop    %ebp
+ 82f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 830:	c7 05 b4 0f 00 00 b8 	movl   $0xfb8,0xfb4
+ 837:	0f 00 00 
+    base.s.size = 0;
+ 83a:	b8 b8 0f 00 00       	mov    $0xfb8,%eax
+    base.s.ptr = freep = prevp = &base;
+ 83f:	c7 05 b8 0f 00 00 b8 	movl   $0xfb8,0xfb8
+ 846:	0f 00 00 
+    base.s.size = 0;
+ 849:	c7 05 bc 0f 00 00 00 	movl   $0x0,0xfbc
+ 850:	00 00 00 
+    if(p->s.size >= nunits){
+ 853:	e9 54 ff ff ff       	jmp    7ac <malloc+0x2c>
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 860:	8b 08                	mov    (%eax),%ecx
+ 862:	89 0a                	mov    %ecx,(%edx)
+ 864:	eb b9                	jmp    81f <malloc+0x9f>
+ 866:	66 90                	xchg   %ax,%ax
+ 868:	66 90                	xchg   %ax,%ax
+ 86a:	66 90                	xchg   %ax,%ax
+ 86c:	66 90                	xchg   %ax,%ax
+ 86e:	66 90                	xchg   %ax,%ax
+
+00000870 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 20             	sub    $0x20,%esp
+ 879:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 87c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 87f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 882:	68 e8 03 00 00       	push   $0x3e8
+ 887:	57                   	push   %edi
+ 888:	56                   	push   %esi
+ 889:	e8 e2 f9 ff ff       	call   270 <udiv64>
+ 88e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 890:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 893:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 899:	29 c1                	sub    %eax,%ecx
+ 89b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 89e:	68 e8 03 00 00       	push   $0x3e8
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	e8 c6 f9 ff ff       	call   270 <udiv64>
+ 8aa:	83 c4 0c             	add    $0xc,%esp
+ 8ad:	50                   	push   %eax
+ 8ae:	68 09 0c 00 00       	push   $0xc09
+ 8b3:	53                   	push   %ebx
+ 8b4:	e8 87 fc ff ff       	call   540 <printf>
+  if(frac < 100)
+ 8b9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f9 63             	cmp    $0x63,%ecx
+ 8c2:	76 1c                	jbe    8e0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 8c4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 8c7:	c7 45 0c 0f 0c 00 00 	movl   $0xc0f,0xc(%ebp)
+ 8ce:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 8d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8d4:	5b                   	pop    %ebx
+ 8d5:	5e                   	pop    %esi
+ 8d6:	5f                   	pop    %edi
+ 8d7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 8d8:	e9 63 fc ff ff       	jmp    540 <printf>
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 8e0:	83 ec 08             	sub    $0x8,%esp
+ 8e3:	68 0d 0c 00 00       	push   $0xc0d
+ 8e8:	53                   	push   %ebx
+ 8e9:	e8 52 fc ff ff       	call   540 <printf>
+  if(frac < 10)
+ 8ee:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 8f1:	83 c4 10             	add    $0x10,%esp
+ 8f4:	83 f9 09             	cmp    $0x9,%ecx
+ 8f7:	77 cb                	ja     8c4 <printps+0x54>
+    printf(fd, "0");
+ 8f9:	83 ec 08             	sub    $0x8,%esp
+ 8fc:	68 0d 0c 00 00       	push   $0xc0d
+ 901:	53                   	push   %ebx
+ 902:	e8 39 fc ff ff       	call   540 <printf>
+ 907:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 90a:	83 c4 10             	add    $0x10,%esp
+ 90d:	eb b5                	jmp    8c4 <printps+0x54>
+ 90f:	90                   	nop
+
+00000910 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 91c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 91f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 922:	83 e8 01             	sub    $0x1,%eax
+ 925:	3d ff 00 00 00       	cmp    $0xff,%eax
+ 92a:	0f 87 37 02 00 00    	ja     b67 <bench+0x257>
+ 930:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 933:	85 ff                	test   %edi,%edi
+ 935:	0f 84 2c 02 00 00    	je     b67 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ 93b:	83 ec 0c             	sub    $0xc,%esp
+ 93e:	ff 75 10             	push   0x10(%ebp)
+ 941:	ff 55 0c             	call   *0xc(%ebp)
+ 944:	5b                   	pop    %ebx
+ 945:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ 948:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ 94a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ 94d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ 950:	83 c4 10             	add    $0x10,%esp
+ 953:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 957:	90                   	nop
+    t0 = cycles();
+ 958:	e8 33 f9 ff ff       	call   290 <cycles>
+    fn(arg);
+ 95d:	83 ec 0c             	sub    $0xc,%esp
+ 960:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ 963:	89 c6                	mov    %eax,%esi
+ 965:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ 967:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ 96a:	e8 21 f9 ff ff       	call   290 <cycles>
+ 96f:	29 f0                	sub    %esi,%eax
+ 971:	19 fa                	sbb    %edi,%edx
+ 973:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 97a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ 97d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 984:	83 c3 01             	add    $0x1,%ebx
+ 987:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ 98a:	7f cc                	jg     958 <bench+0x48>
+  for(i = 1; i < n; i++){
+ 98c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ 990:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ 993:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ 999:	bf 01 00 00 00       	mov    $0x1,%edi
+ 99e:	74 77                	je     a17 <bench+0x107>
+ 9a0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+    v = a[i];
+ 9a8:	8b 01                	mov    (%ecx),%eax
+ 9aa:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ 9ad:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ 9b3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ 9b9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ 9bf:	89 c8                	mov    %ecx,%eax
+ 9c1:	eb 1b                	jmp    9de <bench+0xce>
+ 9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c7:	90                   	nop
+      a[j] = a[j-1];
+ 9c8:	89 08                	mov    %ecx,(%eax)
+ 9ca:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ 9cd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ 9d0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ 9d6:	39 c3                	cmp    %eax,%ebx
+ 9d8:	0f 84 72 01 00 00    	je     b50 <bench+0x240>
+ 9de:	8b 50 fc             	mov    -0x4(%eax),%edx
+ 9e1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ 9e4:	89 f7                	mov    %esi,%edi
+ 9e6:	89 c3                	mov    %eax,%ebx
+ 9e8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ 9ee:	19 d7                	sbb    %edx,%edi
+ 9f0:	72 d6                	jb     9c8 <bench+0xb8>
+ 9f2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ 9f8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ 9fe:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ a04:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ a07:	83 c7 01             	add    $0x1,%edi
+ a0a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ a0d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ a0f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ a12:	75 94                	jne    9a8 <bench+0x98>
+ a14:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a17:	83 ec 08             	sub    $0x8,%esp
+ a1a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ a20:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ a25:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ a2b:	e8 70 f8 ff ff       	call   2a0 <cyc2ns>
+ a30:	83 c4 0c             	add    $0xc,%esp
+ a33:	ff 75 14             	push   0x14(%ebp)
+ a36:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ a3c:	f7 e3                	mul    %ebx
+ a3e:	01 ca                	add    %ecx,%edx
+ a40:	52                   	push   %edx
+ a41:	50                   	push   %eax
+ a42:	e8 29 f8 ff ff       	call   270 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ a47:	89 06                	mov    %eax,(%esi)
+ a49:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a4c:	5f                   	pop    %edi
+ a4d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ a4e:	8b 45 18             	mov    0x18(%ebp),%eax
+ a51:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a53:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ a5a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ a61:	e8 3a f8 ff ff       	call   2a0 <cyc2ns>
+ a66:	83 c4 0c             	add    $0xc,%esp
+ a69:	ff 75 14             	push   0x14(%ebp)
+ a6c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ a72:	f7 e3                	mul    %ebx
+ a74:	01 ca                	add    %ecx,%edx
+ a76:	52                   	push   %edx
+ a77:	50                   	push   %eax
+ a78:	e8 f3 f7 ff ff       	call   270 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ a7d:	89 46 08             	mov    %eax,0x8(%esi)
+ a80:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a83:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ a84:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a87:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ a88:	8d 50 01             	lea    0x1(%eax),%edx
+ a8b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ a90:	6b d2 63             	imul   $0x63,%edx,%edx
+ a93:	f7 e2                	mul    %edx
+ a95:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a98:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ a9f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ aa6:	e8 f5 f7 ff ff       	call   2a0 <cyc2ns>
+ aab:	83 c4 0c             	add    $0xc,%esp
+ aae:	ff 75 14             	push   0x14(%ebp)
+ ab1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ab7:	f7 e3                	mul    %ebx
+ ab9:	01 ca                	add    %ecx,%edx
+ abb:	52                   	push   %edx
+ abc:	50                   	push   %eax
+ abd:	e8 ae f7 ff ff       	call   270 <udiv64>
+
+  if(name){
+ ac2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ ac5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ac8:	89 46 10             	mov    %eax,0x10(%esi)
+ acb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ ace:	85 c9                	test   %ecx,%ecx
+ ad0:	74 72                	je     b44 <bench+0x234>
+    printf(1, "%s: min ", name);
+ ad2:	83 ec 04             	sub    $0x4,%esp
+ ad5:	ff 75 08             	push   0x8(%ebp)
+ ad8:	68 12 0c 00 00       	push   $0xc12
+ add:	6a 01                	push   $0x1
+ adf:	e8 5c fa ff ff       	call   540 <printf>
+    printps(1, st->min);
+ ae4:	83 c4 0c             	add    $0xc,%esp
+ ae7:	ff 76 04             	push   0x4(%esi)
+ aea:	ff 36                	push   (%esi)
+ aec:	6a 01                	push   $0x1
+ aee:	e8 7d fd ff ff       	call   870 <printps>
+    printf(1, " median ");
+ af3:	58                   	pop    %eax
+ af4:	5a                   	pop    %edx
+ af5:	68 1b 0c 00 00       	push   $0xc1b
+ afa:	6a 01                	push   $0x1
+ afc:	e8 3f fa ff ff       	call   540 <printf>
+    printps(1, st->median);
+ b01:	83 c4 0c             	add    $0xc,%esp
+ b04:	ff 76 0c             	push   0xc(%esi)
+ b07:	ff 76 08             	push   0x8(%esi)
+ b0a:	6a 01                	push   $0x1
+ b0c:	e8 5f fd ff ff       	call   870 <printps>
+    printf(1, " p99 ");
+ b11:	59                   	pop    %ecx
+ b12:	5b                   	pop    %ebx
+ b13:	68 24 0c 00 00       	push   $0xc24
+ b18:	6a 01                	push   $0x1
+ b1a:	e8 21 fa ff ff       	call   540 <printf>
+    printps(1, st->p99);
+ b1f:	83 c4 0c             	add    $0xc,%esp
+ b22:	ff 76 14             	push   0x14(%esi)
+ b25:	ff 76 10             	push   0x10(%esi)
+ b28:	6a 01                	push   $0x1
+ b2a:	e8 41 fd ff ff       	call   870 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ b2f:	83 c4 0c             	add    $0xc,%esp
+ b32:	ff 75 18             	push   0x18(%ebp)
+ b35:	68 2a 0c 00 00       	push   $0xc2a
+ b3a:	6a 01                	push   $0x1
+ b3c:	e8 ff f9 ff ff       	call   540 <printf>
+ b41:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ b44:	31 c0                	xor    %eax,%eax
+}
+ b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b49:	5b                   	pop    %ebx
+ b4a:	5e                   	pop    %esi
+ b4b:	5f                   	pop    %edi
+ b4c:	5d                   	pop    %ebp
+ b4d:	c3                   	ret
+ b4e:	66 90                	xchg   %ax,%ax
+ b50:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b56:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ b5c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ b62:	e9 97 fe ff ff       	jmp    9fe <bench+0xee>
+    return -1;
+ b67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b6c:	eb d8                	jmp    b46 <bench+0x236>
@@ -0,0 +1,1773 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 ac 03 00 00       	call   3f0 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 d7 0b 00 00       	push   $0xbd7
+  53:	6a 02                	push   $0x2
+  55:	e8 36 05 00 00       	call   590 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 26 03 00 00       	call   388 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 c0 0b 00 00       	push   $0xbc0
+  69:	6a 02                	push   $0x2
+  6b:	e8 20 05 00 00       	call   590 <printf>
+    exit();
+  70:	e8 13 03 00 00       	call   388 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 e3 01 00 00       	call   3a0 <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 b6 01 00 00       	call   3c8 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 b9 01 00 00       	call   3e0 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 7f 01 00 00       	call   3b0 <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	31 d2                	xor    %edx,%edx
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 2cc:	f7 f3                	div    %ebx
+ 2ce:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 2d8:	89 ca                	mov    %ecx,%edx
+}
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 2e0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 2e2:	c3                   	ret
+ 2e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002f0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	53                   	push   %ebx
+ 2f6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 2f9:	8b 35 1c 10 00 00    	mov    0x101c,%esi
+{
+ 2ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 302:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 305:	85 f6                	test   %esi,%esi
+ 307:	74 2f                	je     338 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 309:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 30e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 314:	f7 e3                	mul    %ebx
+ 316:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 319:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 31c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 31f:	31 d2                	xor    %edx,%edx
+ 321:	f7 f6                	div    %esi
+ 323:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 325:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 328:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 32b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 32d:	89 da                	mov    %ebx,%edx
+}
+ 32f:	5b                   	pop    %ebx
+ 330:	5e                   	pop    %esi
+ 331:	5f                   	pop    %edi
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 338:	e8 0b 01 00 00       	call   448 <tscfreq>
+ 33d:	a3 1c 10 00 00       	mov    %eax,0x101c
+ 342:	89 c6                	mov    %eax,%esi
+ 344:	eb c3                	jmp    309 <cyc2ns+0x19>
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	83 ec 10             	sub    $0x10,%esp
+ 357:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 35a:	6a 00                	push   $0x0
+ 35c:	e8 3f 01 00 00       	call   4a0 <getpriority>
+ 361:	5a                   	pop    %edx
+ 362:	59                   	pop    %ecx
+ 363:	01 d8                	add    %ebx,%eax
+ 365:	50                   	push   %eax
+ 366:	6a 00                	push   $0x0
+ 368:	e8 2b 01 00 00       	call   498 <setpriority>
+  return getpriority(0);
+ 36d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 374:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 377:	83 c4 10             	add    $0x10,%esp
+}
+ 37a:	c9                   	leave
+  return getpriority(0);
+ 37b:	e9 20 01 00 00       	jmp    4a0 <getpriority>
+
+00000380 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 380:	b8 01 00 00 00       	mov    $0x1,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <exit>:
+SYSCALL(exit)
+ 388:	b8 02 00 00 00       	mov    $0x2,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <wait>:
+SYSCALL(wait)
+ 390:	b8 03 00 00 00       	mov    $0x3,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <pipe>:
+SYSCALL(pipe)
+ 398:	b8 04 00 00 00       	mov    $0x4,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <read>:
+SYSCALL(read)
+ 3a0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <write>:
+SYSCALL(write)
+ 3a8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <close>:
+SYSCALL(close)
+ 3b0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <kill>:
+SYSCALL(kill)
+ 3b8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <exec>:
+SYSCALL(exec)
+ 3c0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <open>:
+SYSCALL(open)
+ 3c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <mknod>:
+SYSCALL(mknod)
+ 3d0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <unlink>:
+SYSCALL(unlink)
+ 3d8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <fstat>:
+SYSCALL(fstat)
+ 3e0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <link>:
+SYSCALL(link)
+ 3e8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <mkdir>:
+SYSCALL(mkdir)
+ 3f0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <chdir>:
+SYSCALL(chdir)
+ 3f8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <dup>:
+SYSCALL(dup)
+ 400:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <getpid>:
+SYSCALL(getpid)
+ 408:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <sbrk>:
+SYSCALL(sbrk)
+ 410:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <sleep>:
+SYSCALL(sleep)
+ 418:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <uptime>:
+SYSCALL(uptime)
+ 420:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <promote>:
+
+SYSCALL(promote)
+ 428:	b8 18 00 00 00       	mov    $0x18,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <demote>:
+SYSCALL(demote)
+ 430:	b8 19 00 00 00       	mov    $0x19,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 438:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 440:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <tscfreq>:
+SYSCALL(tscfreq)
+ 448:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <tracemask>:
+SYSCALL(tracemask)
+ 450:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <traceread>:
+SYSCALL(traceread)
+ 458:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <profile>:
+SYSCALL(profile)
+ 460:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <profread>:
+SYSCALL(profread)
+ 468:	b8 20 00 00 00       	mov    $0x20,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <lockstat>:
+SYSCALL(lockstat)
+ 470:	b8 21 00 00 00       	mov    $0x21,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 478:	b8 22 00 00 00       	mov    $0x22,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <sysstat>:
+SYSCALL(sysstat)
+ 480:	b8 23 00 00 00       	mov    $0x23,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <kbench>:
+SYSCALL(kbench)
+ 488:	b8 24 00 00 00       	mov    $0x24,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <yield>:
+SYSCALL(yield)
+ 490:	b8 25 00 00 00       	mov    $0x25,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <setpriority>:
+SYSCALL(setpriority)
+ 498:	b8 26 00 00 00       	mov    $0x26,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <getpriority>:
+SYSCALL(getpriority)
+ 4a0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4a8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4b0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <clone>:
+SYSCALL(clone)
+ 4b8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <join>:
+SYSCALL(join)
+ 4c0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <futex_wait>:
+SYSCALL(futex_wait)
+ 4c8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <futex_wake>:
+SYSCALL(futex_wake)
+ 4d0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <spawn>:
+SYSCALL(spawn)
+ 4d8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <diskstat>:
+SYSCALL(diskstat)
+ 4e0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+ 4e8:	66 90                	xchg   %ax,%ax
+ 4ea:	66 90                	xchg   %ax,%ax
+ 4ec:	66 90                	xchg   %ax,%ax
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4f8:	89 d1                	mov    %edx,%ecx
+{
+ 4fa:	83 ec 3c             	sub    $0x3c,%esp
+ 4fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 500:	85 d2                	test   %edx,%edx
+ 502:	0f 89 80 00 00 00    	jns    588 <printint+0x98>
+ 508:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 50c:	74 7a                	je     588 <printint+0x98>
+    x = -xx;
+ 50e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 510:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 515:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 518:	31 f6                	xor    %esi,%esi
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 520:	89 c8                	mov    %ecx,%eax
+ 522:	31 d2                	xor    %edx,%edx
+ 524:	89 f7                	mov    %esi,%edi
+ 526:	f7 f3                	div    %ebx
+ 528:	8d 76 01             	lea    0x1(%esi),%esi
+ 52b:	0f b6 92 54 0c 00 00 	movzbl 0xc54(%edx),%edx
+ 532:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 536:	89 ca                	mov    %ecx,%edx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	39 da                	cmp    %ebx,%edx
+ 53c:	73 e2                	jae    520 <printint+0x30>
+  if(neg)
+ 53e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	74 07                	je     54c <printint+0x5c>
+    buf[i++] = '-';
+ 545:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 54a:	89 f7                	mov    %esi,%edi
+ 54c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 54f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 552:	01 df                	add    %ebx,%edi
+ 554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 558:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 55b:	83 ec 04             	sub    $0x4,%esp
+ 55e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 561:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 564:	6a 01                	push   $0x1
+ 566:	50                   	push   %eax
+ 567:	56                   	push   %esi
+ 568:	e8 3b fe ff ff       	call   3a8 <write>
+  while(--i >= 0)
+ 56d:	89 f8                	mov    %edi,%eax
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	83 ef 01             	sub    $0x1,%edi
+ 575:	39 d8                	cmp    %ebx,%eax
+ 577:	75 df                	jne    558 <printint+0x68>
+}
+ 579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57c:	5b                   	pop    %ebx
+ 57d:	5e                   	pop    %esi
+ 57e:	5f                   	pop    %edi
+ 57f:	5d                   	pop    %ebp
+ 580:	c3                   	ret
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 588:	31 c0                	xor    %eax,%eax
+ 58a:	eb 89                	jmp    515 <printint+0x25>
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 599:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 59c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 59f:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a2:	83 c6 01             	add    $0x1,%esi
+ 5a5:	84 db                	test   %bl,%bl
+ 5a7:	74 67                	je     610 <printf+0x80>
+ 5a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ac:	31 d2                	xor    %edx,%edx
+ 5ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5b1:	eb 34                	jmp    5e7 <printf+0x57>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5c0:	83 f8 25             	cmp    $0x25,%eax
+ 5c3:	74 18                	je     5dd <printf+0x4d>
+  write(fd, &c, 1);
+ 5c5:	83 ec 04             	sub    $0x4,%esp
+ 5c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ce:	6a 01                	push   $0x1
+ 5d0:	50                   	push   %eax
+ 5d1:	57                   	push   %edi
+ 5d2:	e8 d1 fd ff ff       	call   3a8 <write>
+ 5d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e0:	83 c6 01             	add    $0x1,%esi
+ 5e3:	84 db                	test   %bl,%bl
+ 5e5:	74 29                	je     610 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ea:	85 d2                	test   %edx,%edx
+ 5ec:	74 ca                	je     5b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ee:	83 fa 25             	cmp    $0x25,%edx
+ 5f1:	75 ea                	jne    5dd <printf+0x4d>
+      if(c == 'd'){
+ 5f3:	83 f8 25             	cmp    $0x25,%eax
+ 5f6:	0f 84 24 01 00 00    	je     720 <printf+0x190>
+ 5fc:	83 e8 63             	sub    $0x63,%eax
+ 5ff:	83 f8 15             	cmp    $0x15,%eax
+ 602:	77 1c                	ja     620 <printf+0x90>
+ 604:	ff 24 85 fc 0b 00 00 	jmp    *0xbfc(,%eax,4)
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 626:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 62a:	6a 01                	push   $0x1
+ 62c:	52                   	push   %edx
+ 62d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 630:	57                   	push   %edi
+ 631:	e8 72 fd ff ff       	call   3a8 <write>
+ 636:	83 c4 0c             	add    $0xc,%esp
+ 639:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63c:	6a 01                	push   $0x1
+ 63e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 641:	52                   	push   %edx
+ 642:	57                   	push   %edi
+ 643:	e8 60 fd ff ff       	call   3a8 <write>
+        putc(fd, c);
+ 648:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64b:	31 d2                	xor    %edx,%edx
+ 64d:	eb 8e                	jmp    5dd <printf+0x4d>
+ 64f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 00                	push   $0x0
+ 65f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 661:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 664:	e8 87 fe ff ff       	call   4f0 <printint>
+        ap++;
+ 669:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 66c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 67 ff ff ff       	jmp    5dd <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 680:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 683:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 68b:	85 db                	test   %ebx,%ebx
+ 68d:	0f 84 9d 00 00 00    	je     730 <printf+0x1a0>
+        while(*s != 0){
+ 693:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 696:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 698:	84 c0                	test   %al,%al
+ 69a:	0f 84 3d ff ff ff    	je     5dd <printf+0x4d>
+ 6a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6a6:	89 de                	mov    %ebx,%esi
+ 6a8:	89 d3                	mov    %edx,%ebx
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	53                   	push   %ebx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 e6 fc ff ff       	call   3a8 <write>
+        while(*s != 0){
+ 6c2:	0f b6 06             	movzbl (%esi),%eax
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	75 e4                	jne    6b0 <printf+0x120>
+      state = 0;
+ 6cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 07 ff ff ff       	jmp    5dd <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 01                	push   $0x1
+ 6ef:	e9 6b ff ff ff       	jmp    65f <printf+0xcf>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 701:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 703:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 706:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	52                   	push   %edx
+ 70c:	57                   	push   %edi
+ 70d:	e8 96 fc ff ff       	call   3a8 <write>
+        ap++;
+ 712:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 715:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 718:	31 d2                	xor    %edx,%edx
+ 71a:	e9 be fe ff ff       	jmp    5dd <printf+0x4d>
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 726:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 729:	6a 01                	push   $0x1
+ 72b:	e9 11 ff ff ff       	jmp    641 <printf+0xb1>
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 735:	bb f3 0b 00 00       	mov    $0xbf3,%ebx
+ 73a:	e9 61 ff ff ff       	jmp    6a0 <printf+0x110>
+ 73f:	90                   	nop
+
+00000740 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 740:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	a1 20 10 00 00       	mov    0x1020,%eax
+{
+ 746:	89 e5                	mov    %esp,%ebp
+ 748:	57                   	push   %edi
+ 749:	56                   	push   %esi
+ 74a:	53                   	push   %ebx
+ 74b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 74e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 758:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 75a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 75c:	39 ca                	cmp    %ecx,%edx
+ 75e:	73 30                	jae    790 <free+0x50>
+ 760:	39 c1                	cmp    %eax,%ecx
+ 762:	72 04                	jb     768 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 764:	39 c2                	cmp    %eax,%edx
+ 766:	72 f0                	jb     758 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 768:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 76b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 76e:	39 f8                	cmp    %edi,%eax
+ 770:	74 2e                	je     7a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 772:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 775:	8b 42 04             	mov    0x4(%edx),%eax
+ 778:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 77b:	39 f1                	cmp    %esi,%ecx
+ 77d:	74 38                	je     7b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 77f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 781:	5b                   	pop    %ebx
+  freep = p;
+ 782:	89 15 20 10 00 00    	mov    %edx,0x1020
+}
+ 788:	5e                   	pop    %esi
+ 789:	5f                   	pop    %edi
+ 78a:	5d                   	pop    %ebp
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 d0                	jb     764 <free+0x24>
+ 794:	eb c2                	jmp    758 <free+0x18>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7a0:	03 70 04             	add    0x4(%eax),%esi
+ 7a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a6:	8b 02                	mov    (%edx),%eax
+ 7a8:	8b 00                	mov    (%eax),%eax
+ 7aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7b3:	39 f1                	cmp    %esi,%ecx
+ 7b5:	75 c8                	jne    77f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ba:	89 15 20 10 00 00    	mov    %edx,0x1020
+    p->s.size += bp->s.size;
+ 7c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7c8:	5b                   	pop    %ebx
+ 7c9:	5e                   	pop    %esi
+ 7ca:	5f                   	pop    %edi
+ 7cb:	5d                   	pop    %ebp
+ 7cc:	c3                   	ret
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7dc:	8b 15 20 10 00 00    	mov    0x1020,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7e5:	c1 ef 03             	shr    $0x3,%edi
+ 7e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7eb:	85 d2                	test   %edx,%edx
+ 7ed:	0f 84 8d 00 00 00    	je     880 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f8:	39 f9                	cmp    %edi,%ecx
+ 7fa:	73 64                	jae    860 <malloc+0x90>
+  if(nu < 4096)
+ 7fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 801:	39 df                	cmp    %ebx,%edi
+ 803:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 806:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 80d:	eb 0a                	jmp    819 <malloc+0x49>
+ 80f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 812:	8b 48 04             	mov    0x4(%eax),%ecx
+ 815:	39 f9                	cmp    %edi,%ecx
+ 817:	73 47                	jae    860 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 819:	89 c2                	mov    %eax,%edx
+ 81b:	39 05 20 10 00 00    	cmp    %eax,0x1020
+ 821:	75 ed                	jne    810 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	56                   	push   %esi
+ 827:	e8 e4 fb ff ff       	call   410 <sbrk>
+  if(p == (char*)-1)
+ 82c:	83 c4 10             	add    $0x10,%esp
+ 82f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 832:	74 1c                	je     850 <malloc+0x80>
+  hp->s.size = nu;
+ 834:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 837:	83 ec 0c             	sub    $0xc,%esp
+ 83a:	83 c0 08             	add    $0x8,%eax
+ 83d:	50                   	push   %eax
+ 83e:	e8 fd fe ff ff       	call   740 <free>
+  return freep;
+ 843:	8b 15 20 10 00 00    	mov    0x1020,%edx
+      if((p = morecore(nunits)) == 0)
+ 849:	83 c4 10             	add    $0x10,%esp
+ 84c:	85 d2                	test   %edx,%edx
+ 84e:	75 c0                	jne    810 <malloc+0x40>
+        return 0;
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 853:	31 c0                	xor    %eax,%eax
+}
+ 855:	5b                   	pop    %ebx
+ 856:	5e                   	pop    %esi
+ 857:	5f                   	pop    %edi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 869:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 86c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 86f:	89 15 20 10 00 00    	mov    %edx,0x1020
+}
+ 875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 878:	83 c0 08             	add    $0x8,%eax
+}
+ 87b:	5b                   	pop    %ebx
+ 87c:	5e                   	pop    %esi
+ 87d:	5f                   	pop    %edi
+ 87e:	5d                   	pop    %ebp
+ 87f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 880:	c7 05 20 10 00 00 24 	movl   $0x1024,0x1020
+ 887:	10 00 00 
+    base.s.size = 0;
+ 88a:	b8 24 10 00 00       	mov    $0x1024,%eax
+    base.s.ptr = freep = prevp = &base;
+ 88f:	c7 05 24 10 00 00 24 	movl   $0x1024,0x1024
+ 896:	10 00 00 
+    base.s.size = 0;
+ 899:	c7 05 28 10 00 00 00 	movl   $0x0,0x1028
+ 8a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8a3:	e9 54 ff ff ff       	jmp    7fc <malloc+0x2c>
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 08                	mov    (%eax),%ecx
+ 8b2:	89 0a                	mov    %ecx,(%edx)
+ 8b4:	eb b9                	jmp    86f <malloc+0x9f>
+ 8b6:	66 90                	xchg   %ax,%ax
+ 8b8:	66 90                	xchg   %ax,%ax
+ 8ba:	66 90                	xchg   %ax,%ax
+ 8bc:	66 90                	xchg   %ax,%ax
+ 8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 20             	sub    $0x20,%esp
+ 8c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 8cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 8cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 8d2:	68 e8 03 00 00       	push   $0x3e8
+ 8d7:	57                   	push   %edi
+ 8d8:	56                   	push   %esi
+ 8d9:	e8 e2 f9 ff ff       	call   2c0 <udiv64>
+ 8de:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 8e0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 8e3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 8e9:	29 c1                	sub    %eax,%ecx
+ 8eb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 8ee:	68 e8 03 00 00       	push   $0x3e8
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	e8 c6 f9 ff ff       	call   2c0 <udiv64>
+ 8fa:	83 c4 0c             	add    $0xc,%esp
+ 8fd:	50                   	push   %eax
+ 8fe:	68 65 0c 00 00       	push   $0xc65
+ 903:	53                   	push   %ebx
+ 904:	e8 87 fc ff ff       	call   590 <printf>
+  if(frac < 100)
+ 909:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 90c:	83 c4 10             	add    $0x10,%esp
+ 90f:	83 f9 63             	cmp    $0x63,%ecx
+ 912:	76 1c                	jbe    930 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 914:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 917:	c7 45 0c 6b 0c 00 00 	movl   $0xc6b,0xc(%ebp)
+ 91e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 921:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 924:	5b                   	pop    %ebx
+ 925:	5e                   	pop    %esi
+ 926:	5f                   	pop    %edi
+ 927:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 928:	e9 63 fc ff ff       	jmp    590 <printf>
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 930:	83 ec 08             	sub    $0x8,%esp
+ 933:	68 69 0c 00 00       	push   $0xc69
+ 938:	53                   	push   %ebx
+ 939:	e8 52 fc ff ff       	call   590 <printf>
+  if(frac < 10)
+ 93e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 941:	83 c4 10             	add    $0x10,%esp
+ 944:	83 f9 09             	cmp    $0x9,%ecx
+ 947:	77 cb                	ja     914 <printps+0x54>
+    printf(fd, "0");
+ 949:	83 ec 08             	sub    $0x8,%esp
+ 94c:	68 69 0c 00 00       	push   $0xc69
+ 951:	53                   	push   %ebx
+ 952:	e8 39 fc ff ff       	call   590 <printf>
+ 957:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 95a:	83 c4 10             	add    $0x10,%esp
+ 95d:	eb b5                	jmp    914 <printps+0x54>
+ 95f:	90                   	nop
+
+00000960 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 96c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 96f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 972:	83 e8 01             	sub    $0x1,%eax
+ 975:	3d ff 00 00 00       	cmp    $0xff,%eax
+ 97a:	0f 87 37 02 00 00    	ja     bb7 <bench+0x257>
+ 980:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 983:	85 ff                	test   %edi,%edi
+ 985:	0f 84 2c 02 00 00    	je     bb7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ 98b:	83 ec 0c             	sub    $0xc,%esp
+ 98e:	ff 75 10             	push   0x10(%ebp)
+ 991:	ff 55 0c             	call   *0xc(%ebp)
+ 994:	5b                   	pop    %ebx
+ 995:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ 998:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ 99a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ 99d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ 9a0:	83 c4 10             	add    $0x10,%esp
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+    t0 = cycles();
+ 9a8:	e8 33 f9 ff ff       	call   2e0 <cycles>
+    fn(arg);
+ 9ad:	83 ec 0c             	sub    $0xc,%esp
+ 9b0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ 9b3:	89 c6                	mov    %eax,%esi
+ 9b5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ 9b7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ 9ba:	e8 21 f9 ff ff       	call   2e0 <cycles>
+ 9bf:	29 f0                	sub    %esi,%eax
+ 9c1:	19 fa                	sbb    %edi,%edx
+ 9c3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 9ca:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ 9cd:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ 9d4:	83 c3 01             	add    $0x1,%ebx
+ 9d7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ 9da:	7f cc                	jg     9a8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ 9dc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ 9e0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ 9e3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ 9e9:	bf 01 00 00 00       	mov    $0x1,%edi
+ 9ee:	74 77                	je     a67 <bench+0x107>
+ 9f0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ 9f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9f7:	90                   	nop
+    v = a[i];
+ 9f8:	8b 01                	mov    (%ecx),%eax
+ 9fa:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ 9fd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ a03:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ a09:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ a0f:	89 c8                	mov    %ecx,%eax
+ a11:	eb 1b                	jmp    a2e <bench+0xce>
+ a13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a17:	90                   	nop
+      a[j] = a[j-1];
+ a18:	89 08                	mov    %ecx,(%eax)
+ a1a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a1d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ a20:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ a26:	39 c3                	cmp    %eax,%ebx
+ a28:	0f 84 72 01 00 00    	je     ba0 <bench+0x240>
+ a2e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ a31:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ a34:	89 f7                	mov    %esi,%edi
+ a36:	89 c3                	mov    %eax,%ebx
+ a38:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ a3e:	19 d7                	sbb    %edx,%edi
+ a40:	72 d6                	jb     a18 <bench+0xb8>
+ a42:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ a48:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ a4e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ a54:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ a57:	83 c7 01             	add    $0x1,%edi
+ a5a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ a5d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ a5f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ a62:	75 94                	jne    9f8 <bench+0x98>
+ a64:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a67:	83 ec 08             	sub    $0x8,%esp
+ a6a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ a70:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ a75:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ a7b:	e8 70 f8 ff ff       	call   2f0 <cyc2ns>
+ a80:	83 c4 0c             	add    $0xc,%esp
+ a83:	ff 75 14             	push   0x14(%ebp)
+ a86:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ a8c:	f7 e3                	mul    %ebx
+ a8e:	01 ca                	add    %ecx,%edx
+ a90:	52                   	push   %edx
+ a91:	50                   	push   %eax
+ a92:	e8 29 f8 ff ff       	call   2c0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ a97:	89 06                	mov    %eax,(%esi)
+ a99:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ a9c:	5f                   	pop    %edi
+ a9d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ a9e:	8b 45 18             	mov    0x18(%ebp),%eax
+ aa1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ aa3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ aaa:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ ab1:	e8 3a f8 ff ff       	call   2f0 <cyc2ns>
+ ab6:	83 c4 0c             	add    $0xc,%esp
+ ab9:	ff 75 14             	push   0x14(%ebp)
+ abc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ac2:	f7 e3                	mul    %ebx
+ ac4:	01 ca                	add    %ecx,%edx
+ ac6:	52                   	push   %edx
+ ac7:	50                   	push   %eax
+ ac8:	e8 f3 f7 ff ff       	call   2c0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ acd:	89 46 08             	mov    %eax,0x8(%esi)
+ ad0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ad3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ad4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ad7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ ad8:	8d 50 01             	lea    0x1(%eax),%edx
+ adb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ ae0:	6b d2 63             	imul   $0x63,%edx,%edx
+ ae3:	f7 e2                	mul    %edx
+ ae5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ae8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ aef:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ af6:	e8 f5 f7 ff ff       	call   2f0 <cyc2ns>
+ afb:	83 c4 0c             	add    $0xc,%esp
+ afe:	ff 75 14             	push   0x14(%ebp)
+ b01:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b07:	f7 e3                	mul    %ebx
+ b09:	01 ca                	add    %ecx,%edx
+ b0b:	52                   	push   %edx
+ b0c:	50                   	push   %eax
+ b0d:	e8 ae f7 ff ff       	call   2c0 <udiv64>
+
+  if(name){
+ b12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b15:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b18:	89 46 10             	mov    %eax,0x10(%esi)
+ b1b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ b1e:	85 c9                	test   %ecx,%ecx
+ b20:	74 72                	je     b94 <bench+0x234>
+    printf(1, "%s: min ", name);
+ b22:	83 ec 04             	sub    $0x4,%esp
+ b25:	ff 75 08             	push   0x8(%ebp)
+ b28:	68 6e 0c 00 00       	push   $0xc6e
+ b2d:	6a 01                	push   $0x1
+ b2f:	e8 5c fa ff ff       	call   590 <printf>
+    printps(1, st->min);
+ b34:	83 c4 0c             	add    $0xc,%esp
+ b37:	ff 76 04             	push   0x4(%esi)
+ b3a:	ff 36                	push   (%esi)
+ b3c:	6a 01                	push   $0x1
+ b3e:	e8 7d fd ff ff       	call   8c0 <printps>
+    printf(1, " median ");
+ b43:	58                   	pop    %eax
+ b44:	5a                   	pop    %edx
+ b45:	68 77 0c 00 00       	push   $0xc77
+ b4a:	6a 01                	push   $0x1
+ b4c:	e8 3f fa ff ff       	call   590 <printf>
+    printps(1, st->median);
+ b51:	83 c4 0c             	add    $0xc,%esp
+ b54:	ff 76 0c             	push   0xc(%esi)
+ b57:	ff 76 08             	push   0x8(%esi)
+ b5a:	6a 01                	push   $0x1
+ b5c:	e8 5f fd ff ff       	call   8c0 <printps>
+    printf(1, " p99 ");
+ b61:	59                   	pop    %ecx
+ b62:	5b                   	pop    %ebx
+ b63:	68 80 0c 00 00       	push   $0xc80
+ b68:	6a 01                	push   $0x1
+ b6a:	e8 21 fa ff ff       	call   590 <printf>
+    printps(1, st->p99);
+ b6f:	83 c4 0c             	add    $0xc,%esp
+ b72:	ff 76 14             	push   0x14(%esi)
+ b75:	ff 76 10             	push   0x10(%esi)
+ b78:	6a 01                	push   $0x1
+ b7a:	e8 41 fd ff ff       	call   8c0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ b7f:	83 c4 0c             	add    $0xc,%esp
+ b82:	ff 75 18             	push   0x18(%ebp)
+ b85:	68 86 0c 00 00       	push   $0xc86
+ b8a:	6a 01                	push   $0x1
+ b8c:	e8 ff f9 ff ff       	call   590 <printf>
+ b91:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ b94:	31 c0                	xor    %eax,%eax
+}
+ b96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b99:	5b                   	pop    %ebx
+ b9a:	5e                   	pop    %esi
+ b9b:	5f                   	pop    %edi
+ b9c:	5d                   	pop    %ebp
+ b9d:	c3                   	ret
+ b9e:	66 90                	xchg   %ax,%ax
+ ba0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ba6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ bac:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ bb2:	e9 97 fe ff ff       	jmp    a4e <bench+0xee>
+    return -1;
+ bb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ bbc:	eb d8                	jmp    b96 <bench+0x236>
@@ -10,6 +10,14 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_OSFXSR      0x00000200      // OS supports FXSAVE and SSE
+#define CR4_OSXMMEXCPT  0x00000400      // OS handles SIMD exceptions
+
+// CPUID leaf 1 feature flags (%edx)
+#define CPUID_FXSR      0x01000000      // FXSAVE/FXRSTOR
+#define CPUID_SSE2      0x04000000      // SSE2 instructions
+
+#define FXSIZE          512             // bytes saved by fxsave
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -97,6 +105,10 @@ struct segdesc {
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
 #define PTE_PS          0x080   // Page Size
+#define PTE_SHARED      0x200   // Shared executable page (text.c); software bit
+
+// Page fault error code bits
+#define FEC_WR          0x002   // Fault was a write
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -0,0 +1,1808 @@
+
+_nice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int incr, i;
+  char *s;
+
+  incr = 10;
+   7:	ba 0a 00 00 00       	mov    $0xa,%edx
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  i = 1;
+  14:	be 01 00 00 00       	mov    $0x1,%esi
+{
+  19:	53                   	push   %ebx
+  1a:	51                   	push   %ecx
+  1b:	83 ec 18             	sub    $0x18,%esp
+  1e:	8b 19                	mov    (%ecx),%ebx
+  20:	8b 79 04             	mov    0x4(%ecx),%edi
+  if(argc > 2 && strcmp(argv[1], "-n") == 0){
+  23:	83 fb 02             	cmp    $0x2,%ebx
+  26:	7f 17                	jg     3f <main+0x3f>
+    incr = atoi(*s == '-' ? s + 1 : s);
+    if(*s == '-')
+      incr = -incr;
+    i = 3;
+  }
+  if(i >= argc){
+  28:	39 de                	cmp    %ebx,%esi
+  2a:	7c 2f                	jl     5b <main+0x5b>
+    printf(2, "usage: nice [-n incr] cmd [args...]\n");
+  2c:	51                   	push   %ecx
+  2d:	51                   	push   %ecx
+  2e:	68 1c 0c 00 00       	push   $0xc1c
+  33:	6a 02                	push   $0x2
+  35:	e8 96 05 00 00       	call   5d0 <printf>
+    exit();
+  3a:	e8 89 03 00 00       	call   3c8 <exit>
+  3f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if(argc > 2 && strcmp(argv[1], "-n") == 0){
+  42:	50                   	push   %eax
+  43:	50                   	push   %eax
+  44:	68 00 0c 00 00       	push   $0xc00
+  49:	ff 77 04             	push   0x4(%edi)
+  4c:	e8 9f 00 00 00       	call   f0 <strcmp>
+  51:	83 c4 10             	add    $0x10,%esp
+  54:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  57:	85 c0                	test   %eax,%eax
+  59:	74 2c                	je     87 <main+0x87>
+  }
+  nice(incr);
+  5b:	83 ec 0c             	sub    $0xc,%esp
+  exec(argv[i], argv + i);
+  5e:	8d 1c b7             	lea    (%edi,%esi,4),%ebx
+  nice(incr);
+  61:	52                   	push   %edx
+  62:	e8 29 03 00 00       	call   390 <nice>
+  exec(argv[i], argv + i);
+  67:	58                   	pop    %eax
+  68:	5a                   	pop    %edx
+  69:	53                   	push   %ebx
+  6a:	ff 33                	push   (%ebx)
+  6c:	e8 8f 03 00 00       	call   400 <exec>
+  printf(2, "nice: exec %s failed\n", argv[i]);
+  71:	83 c4 0c             	add    $0xc,%esp
+  74:	ff 33                	push   (%ebx)
+  76:	68 03 0c 00 00       	push   $0xc03
+  7b:	6a 02                	push   $0x2
+  7d:	e8 4e 05 00 00       	call   5d0 <printf>
+  exit();
+  82:	e8 41 03 00 00       	call   3c8 <exit>
+    s = argv[2];
+  87:	8b 4f 08             	mov    0x8(%edi),%ecx
+    incr = atoi(*s == '-' ? s + 1 : s);
+  8a:	80 39 2d             	cmpb   $0x2d,(%ecx)
+  8d:	89 c8                	mov    %ecx,%eax
+  8f:	75 03                	jne    94 <main+0x94>
+  91:	8d 41 01             	lea    0x1(%ecx),%eax
+  94:	83 ec 0c             	sub    $0xc,%esp
+  97:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    i = 3;
+  9a:	be 03 00 00 00       	mov    $0x3,%esi
+    incr = atoi(*s == '-' ? s + 1 : s);
+  9f:	50                   	push   %eax
+  a0:	e8 eb 01 00 00       	call   290 <atoi>
+    if(*s == '-')
+  a5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  a8:	83 c4 10             	add    $0x10,%esp
+    incr = atoi(*s == '-' ? s + 1 : s);
+  ab:	89 c2                	mov    %eax,%edx
+    if(*s == '-')
+  ad:	80 39 2d             	cmpb   $0x2d,(%ecx)
+  b0:	0f 85 72 ff ff ff    	jne    28 <main+0x28>
+      incr = -incr;
+  b6:	f7 da                	neg    %edx
+  b8:	e9 6b ff ff ff       	jmp    28 <main+0x28>
+  bd:	66 90                	xchg   %ax,%ax
+  bf:	90                   	nop
+
+000000c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c1:	31 c0                	xor    %eax,%eax
+{
+  c3:	89 e5                	mov    %esp,%ebp
+  c5:	53                   	push   %ebx
+  c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  d7:	83 c0 01             	add    $0x1,%eax
+  da:	84 d2                	test   %dl,%dl
+  dc:	75 f2                	jne    d0 <strcpy+0x10>
+    ;
+  return os;
+}
+  de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e1:	89 c8                	mov    %ecx,%eax
+  e3:	c9                   	leave
+  e4:	c3                   	ret
+  e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	53                   	push   %ebx
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  fa:	0f b6 02             	movzbl (%edx),%eax
+  fd:	84 c0                	test   %al,%al
+  ff:	75 17                	jne    118 <strcmp+0x28>
+ 101:	eb 3a                	jmp    13d <strcmp+0x4d>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 10c:	83 c2 01             	add    $0x1,%edx
+ 10f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 112:	84 c0                	test   %al,%al
+ 114:	74 1a                	je     130 <strcmp+0x40>
+    p++, q++;
+ 116:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 118:	0f b6 19             	movzbl (%ecx),%ebx
+ 11b:	38 c3                	cmp    %al,%bl
+ 11d:	74 e9                	je     108 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 11f:	29 d8                	sub    %ebx,%eax
+}
+ 121:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 124:	c9                   	leave
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 130:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 134:	31 c0                	xor    %eax,%eax
+ 136:	29 d8                	sub    %ebx,%eax
+}
+ 138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 13b:	c9                   	leave
+ 13c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 13d:	0f b6 19             	movzbl (%ecx),%ebx
+ 140:	31 c0                	xor    %eax,%eax
+ 142:	eb db                	jmp    11f <strcmp+0x2f>
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 e3 01 00 00       	call   3e0 <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 b6 01 00 00       	call   408 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 b9 01 00 00       	call   420 <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 7f 01 00 00       	call   3f0 <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 297:	0f be 02             	movsbl (%edx),%eax
+ 29a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 29d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2a5:	77 1e                	ja     2c5 <atoi+0x35>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 02             	movsbl (%edx),%eax
+ 2bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x20>
+  return n;
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	89 c8                	mov    %ecx,%eax
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	7e 13                	jle    2f5 <memmove+0x25>
+ 2e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2e4:	89 d7                	mov    %edx,%edi
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2f1:	39 f8                	cmp    %edi,%eax
+ 2f3:	75 fb                	jne    2f0 <memmove+0x20>
+  return vdst;
+}
+ 2f5:	5e                   	pop    %esi
+ 2f6:	89 d0                	mov    %edx,%eax
+ 2f8:	5f                   	pop    %edi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 300:	55                   	push   %ebp
+ 301:	31 d2                	xor    %edx,%edx
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 309:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 30c:	f7 f3                	div    %ebx
+ 30e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+ 313:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 318:	89 ca                	mov    %ecx,%edx
+}
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 320:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 322:	c3                   	ret
+ 323:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000330 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	53                   	push   %ebx
+ 336:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 339:	8b 35 68 10 00 00    	mov    0x1068,%esi
+{
+ 33f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 342:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 345:	85 f6                	test   %esi,%esi
+ 347:	74 2f                	je     378 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 349:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 34e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 354:	f7 e3                	mul    %ebx
+ 356:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 359:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 35c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 35f:	31 d2                	xor    %edx,%edx
+ 361:	f7 f6                	div    %esi
+ 363:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 365:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 368:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 36b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 36d:	89 da                	mov    %ebx,%edx
+}
+ 36f:	5b                   	pop    %ebx
+ 370:	5e                   	pop    %esi
+ 371:	5f                   	pop    %edi
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 378:	e8 0b 01 00 00       	call   488 <tscfreq>
+ 37d:	a3 68 10 00 00       	mov    %eax,0x1068
+ 382:	89 c6                	mov    %eax,%esi
+ 384:	eb c3                	jmp    349 <cyc2ns+0x19>
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	83 ec 10             	sub    $0x10,%esp
+ 397:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 39a:	6a 00                	push   $0x0
+ 39c:	e8 3f 01 00 00       	call   4e0 <getpriority>
+ 3a1:	5a                   	pop    %edx
+ 3a2:	59                   	pop    %ecx
+ 3a3:	01 d8                	add    %ebx,%eax
+ 3a5:	50                   	push   %eax
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	e8 2b 01 00 00       	call   4d8 <setpriority>
+  return getpriority(0);
+ 3ad:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 3b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 3b7:	83 c4 10             	add    $0x10,%esp
+}
+ 3ba:	c9                   	leave
+  return getpriority(0);
+ 3bb:	e9 20 01 00 00       	jmp    4e0 <getpriority>
+
+000003c0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <exit>:
+SYSCALL(exit)
+ 3c8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <wait>:
+SYSCALL(wait)
+ 3d0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <pipe>:
+SYSCALL(pipe)
+ 3d8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <read>:
+SYSCALL(read)
+ 3e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <write>:
+SYSCALL(write)
+ 3e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <close>:
+SYSCALL(close)
+ 3f0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <kill>:
+SYSCALL(kill)
+ 3f8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <exec>:
+SYSCALL(exec)
+ 400:	b8 07 00 00 00       	mov    $0x7,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <open>:
+SYSCALL(open)
+ 408:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <mknod>:
+SYSCALL(mknod)
+ 410:	b8 11 00 00 00       	mov    $0x11,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <unlink>:
+SYSCALL(unlink)
+ 418:	b8 12 00 00 00       	mov    $0x12,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <fstat>:
+SYSCALL(fstat)
+ 420:	b8 08 00 00 00       	mov    $0x8,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <link>:
+SYSCALL(link)
+ 428:	b8 13 00 00 00       	mov    $0x13,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <mkdir>:
+SYSCALL(mkdir)
+ 430:	b8 14 00 00 00       	mov    $0x14,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <chdir>:
+SYSCALL(chdir)
+ 438:	b8 09 00 00 00       	mov    $0x9,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <dup>:
+SYSCALL(dup)
+ 440:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <getpid>:
+SYSCALL(getpid)
+ 448:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <sbrk>:
+SYSCALL(sbrk)
+ 450:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <sleep>:
+SYSCALL(sleep)
+ 458:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <uptime>:
+SYSCALL(uptime)
+ 460:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <promote>:
+
+SYSCALL(promote)
+ 468:	b8 18 00 00 00       	mov    $0x18,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <demote>:
+SYSCALL(demote)
+ 470:	b8 19 00 00 00       	mov    $0x19,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 478:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 480:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <tscfreq>:
+SYSCALL(tscfreq)
+ 488:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <tracemask>:
+SYSCALL(tracemask)
+ 490:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <traceread>:
+SYSCALL(traceread)
+ 498:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <profile>:
+SYSCALL(profile)
+ 4a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <profread>:
+SYSCALL(profread)
+ 4a8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <lockstat>:
+SYSCALL(lockstat)
+ 4b0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 4b8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <sysstat>:
+SYSCALL(sysstat)
+ 4c0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <kbench>:
+SYSCALL(kbench)
+ 4c8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <yield>:
+SYSCALL(yield)
+ 4d0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <setpriority>:
+SYSCALL(setpriority)
+ 4d8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <getpriority>:
+SYSCALL(getpriority)
+ 4e0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4e8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4f0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <clone>:
+SYSCALL(clone)
+ 4f8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <join>:
+SYSCALL(join)
+ 500:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <futex_wait>:
+SYSCALL(futex_wait)
+ 508:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <futex_wake>:
+SYSCALL(futex_wake)
+ 510:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <spawn>:
+SYSCALL(spawn)
+ 518:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <diskstat>:
+SYSCALL(diskstat)
+ 520:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+ 528:	66 90                	xchg   %ax,%ax
+ 52a:	66 90                	xchg   %ax,%ax
+ 52c:	66 90                	xchg   %ax,%ax
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 a0 0c 00 00 	movzbl 0xca0(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 3b fe ff ff       	call   3e8 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 d1 fd ff ff       	call   3e8 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 48 0c 00 00 	jmp    *0xc48(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 72 fd ff ff       	call   3e8 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 60 fd ff ff       	call   3e8 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 e6 fc ff ff       	call   3e8 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 96 fc ff ff       	call   3e8 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 41 0c 00 00       	mov    $0xc41,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	a1 6c 10 00 00       	mov    0x106c,%eax
+{
+ 786:	89 e5                	mov    %esp,%ebp
+ 788:	57                   	push   %edi
+ 789:	56                   	push   %esi
+ 78a:	53                   	push   %ebx
+ 78b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 78e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 79c:	39 ca                	cmp    %ecx,%edx
+ 79e:	73 30                	jae    7d0 <free+0x50>
+ 7a0:	39 c1                	cmp    %eax,%ecx
+ 7a2:	72 04                	jb     7a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a4:	39 c2                	cmp    %eax,%edx
+ 7a6:	72 f0                	jb     798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ae:	39 f8                	cmp    %edi,%eax
+ 7b0:	74 2e                	je     7e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7bb:	39 f1                	cmp    %esi,%ecx
+ 7bd:	74 38                	je     7f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7c1:	5b                   	pop    %ebx
+  freep = p;
+ 7c2:	89 15 6c 10 00 00    	mov    %edx,0x106c
+}
+ 7c8:	5e                   	pop    %esi
+ 7c9:	5f                   	pop    %edi
+ 7ca:	5d                   	pop    %ebp
+ 7cb:	c3                   	ret
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 d0                	jb     7a4 <free+0x24>
+ 7d4:	eb c2                	jmp    798 <free+0x18>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7e0:	03 70 04             	add    0x4(%eax),%esi
+ 7e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e6:	8b 02                	mov    (%edx),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7f3:	39 f1                	cmp    %esi,%ecx
+ 7f5:	75 c8                	jne    7bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 7f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7fa:	89 15 6c 10 00 00    	mov    %edx,0x106c
+    p->s.size += bp->s.size;
+ 800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 806:	89 0a                	mov    %ecx,(%edx)
+}
+ 808:	5b                   	pop    %ebx
+ 809:	5e                   	pop    %esi
+ 80a:	5f                   	pop    %edi
+ 80b:	5d                   	pop    %ebp
+ 80c:	c3                   	ret
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 81c:	8b 15 6c 10 00 00    	mov    0x106c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 822:	8d 78 07             	lea    0x7(%eax),%edi
+ 825:	c1 ef 03             	shr    $0x3,%edi
+ 828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 82b:	85 d2                	test   %edx,%edx
+ 82d:	0f 84 8d 00 00 00    	je     8c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 835:	8b 48 04             	mov    0x4(%eax),%ecx
+ 838:	39 f9                	cmp    %edi,%ecx
+ 83a:	73 64                	jae    8a0 <malloc+0x90>
+  if(nu < 4096)
+ 83c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 841:	39 df                	cmp    %ebx,%edi
+ 843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 84d:	eb 0a                	jmp    859 <malloc+0x49>
+ 84f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 852:	8b 48 04             	mov    0x4(%eax),%ecx
+ 855:	39 f9                	cmp    %edi,%ecx
+ 857:	73 47                	jae    8a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 859:	89 c2                	mov    %eax,%edx
+ 85b:	39 05 6c 10 00 00    	cmp    %eax,0x106c
+ 861:	75 ed                	jne    850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	56                   	push   %esi
+ 867:	e8 e4 fb ff ff       	call   450 <sbrk>
+  if(p == (char*)-1)
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 1c                	je     890 <malloc+0x80>
+  hp->s.size = nu;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	50                   	push   %eax
+ 87e:	e8 fd fe ff ff       	call   780 <free>
+  return freep;
+ 883:	8b 15 6c 10 00 00    	mov    0x106c,%edx
+      if((p = morecore(nunits)) == 0)
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	85 d2                	test   %edx,%edx
+ 88e:	75 c0                	jne    850 <malloc+0x40>
+        return 0;
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 893:	31 c0                	xor    %eax,%eax
+}
+ 895:	5b                   	pop    %ebx
+ 896:	5e                   	pop    %esi
+ 897:	5f                   	pop    %edi
+ 898:	5d                   	pop    %ebp
+ 899:	c3                   	ret
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8af:	89 15 6c 10 00 00    	mov    %edx,0x106c
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8b8:	83 c0 08             	add    $0x8,%eax
+}
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 6c 10 00 00 70 	movl   $0x1070,0x106c
+ 8c7:	10 00 00 
+    base.s.size = 0;
+ 8ca:	b8 70 10 00 00       	mov    $0x1070,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 70 10 00 00 70 	movl   $0x1070,0x1070
+ 8d6:	10 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 74 10 00 00 00 	movl   $0x0,0x1074
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 54 ff ff ff       	jmp    83c <malloc+0x2c>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 08                	mov    (%eax),%ecx
+ 8f2:	89 0a                	mov    %ecx,(%edx)
+ 8f4:	eb b9                	jmp    8af <malloc+0x9f>
+ 8f6:	66 90                	xchg   %ax,%ax
+ 8f8:	66 90                	xchg   %ax,%ax
+ 8fa:	66 90                	xchg   %ax,%ax
+ 8fc:	66 90                	xchg   %ax,%ax
+ 8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 20             	sub    $0x20,%esp
+ 909:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 90c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 90f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 912:	68 e8 03 00 00       	push   $0x3e8
+ 917:	57                   	push   %edi
+ 918:	56                   	push   %esi
+ 919:	e8 e2 f9 ff ff       	call   300 <udiv64>
+ 91e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 920:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 923:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 929:	29 c1                	sub    %eax,%ecx
+ 92b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 92e:	68 e8 03 00 00       	push   $0x3e8
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	e8 c6 f9 ff ff       	call   300 <udiv64>
+ 93a:	83 c4 0c             	add    $0xc,%esp
+ 93d:	50                   	push   %eax
+ 93e:	68 b1 0c 00 00       	push   $0xcb1
+ 943:	53                   	push   %ebx
+ 944:	e8 87 fc ff ff       	call   5d0 <printf>
+  if(frac < 100)
+ 949:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 94c:	83 c4 10             	add    $0x10,%esp
+ 94f:	83 f9 63             	cmp    $0x63,%ecx
+ 952:	76 1c                	jbe    970 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ 954:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ 957:	c7 45 0c b7 0c 00 00 	movl   $0xcb7,0xc(%ebp)
+ 95e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 961:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 964:	5b                   	pop    %ebx
+ 965:	5e                   	pop    %esi
+ 966:	5f                   	pop    %edi
+ 967:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ 968:	e9 63 fc ff ff       	jmp    5d0 <printf>
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ 970:	83 ec 08             	sub    $0x8,%esp
+ 973:	68 b5 0c 00 00       	push   $0xcb5
+ 978:	53                   	push   %ebx
+ 979:	e8 52 fc ff ff       	call   5d0 <printf>
+  if(frac < 10)
+ 97e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 981:	83 c4 10             	add    $0x10,%esp
+ 984:	83 f9 09             	cmp    $0x9,%ecx
+ 987:	77 cb                	ja     954 <printps+0x54>
+    printf(fd, "0");
+ 989:	83 ec 08             	sub    $0x8,%esp
+ 98c:	68 b5 0c 00 00       	push   $0xcb5
+ 991:	53                   	push   %ebx
+ 992:	e8 39 fc ff ff       	call   5d0 <printf>
+ 997:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 99a:	83 c4 10             	add    $0x10,%esp
+ 99d:	eb b5                	jmp    954 <printps+0x54>
+ 99f:	90                   	nop
+
+000009a0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 9ac:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ 9af:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ 9b2:	83 e8 01             	sub    $0x1,%eax
+ 9b5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ 9ba:	0f 87 37 02 00 00    	ja     bf7 <bench+0x257>
+ 9c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 9c3:	85 ff                	test   %edi,%edi
+ 9c5:	0f 84 2c 02 00 00    	je     bf7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ 9cb:	83 ec 0c             	sub    $0xc,%esp
+ 9ce:	ff 75 10             	push   0x10(%ebp)
+ 9d1:	ff 55 0c             	call   *0xc(%ebp)
+ 9d4:	5b                   	pop    %ebx
+ 9d5:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ 9d8:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ 9da:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ 9dd:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ 9e0:	83 c4 10             	add    $0x10,%esp
+ 9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9e7:	90                   	nop
+    t0 = cycles();
+ 9e8:	e8 33 f9 ff ff       	call   320 <cycles>
+    fn(arg);
+ 9ed:	83 ec 0c             	sub    $0xc,%esp
+ 9f0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ 9f3:	89 c6                	mov    %eax,%esi
+ 9f5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ 9f7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ 9fa:	e8 21 f9 ff ff       	call   320 <cycles>
+ 9ff:	29 f0                	sub    %esi,%eax
+ a01:	19 fa                	sbb    %edi,%edx
+ a03:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a0a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ a0d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ a14:	83 c3 01             	add    $0x1,%ebx
+ a17:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ a1a:	7f cc                	jg     9e8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ a1c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ a20:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ a23:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ a29:	bf 01 00 00 00       	mov    $0x1,%edi
+ a2e:	74 77                	je     aa7 <bench+0x107>
+ a30:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a37:	90                   	nop
+    v = a[i];
+ a38:	8b 01                	mov    (%ecx),%eax
+ a3a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a3d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ a43:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ a49:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ a4f:	89 c8                	mov    %ecx,%eax
+ a51:	eb 1b                	jmp    a6e <bench+0xce>
+ a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a57:	90                   	nop
+      a[j] = a[j-1];
+ a58:	89 08                	mov    %ecx,(%eax)
+ a5a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ a5d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ a60:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ a66:	39 c3                	cmp    %eax,%ebx
+ a68:	0f 84 72 01 00 00    	je     be0 <bench+0x240>
+ a6e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ a71:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ a74:	89 f7                	mov    %esi,%edi
+ a76:	89 c3                	mov    %eax,%ebx
+ a78:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ a7e:	19 d7                	sbb    %edx,%edi
+ a80:	72 d6                	jb     a58 <bench+0xb8>
+ a82:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ a88:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ a8e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ a94:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ a97:	83 c7 01             	add    $0x1,%edi
+ a9a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ a9d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ a9f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ aa2:	75 94                	jne    a38 <bench+0x98>
+ aa4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ aa7:	83 ec 08             	sub    $0x8,%esp
+ aaa:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ ab0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ ab5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ abb:	e8 70 f8 ff ff       	call   330 <cyc2ns>
+ ac0:	83 c4 0c             	add    $0xc,%esp
+ ac3:	ff 75 14             	push   0x14(%ebp)
+ ac6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ acc:	f7 e3                	mul    %ebx
+ ace:	01 ca                	add    %ecx,%edx
+ ad0:	52                   	push   %edx
+ ad1:	50                   	push   %eax
+ ad2:	e8 29 f8 ff ff       	call   300 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ ad7:	89 06                	mov    %eax,(%esi)
+ ad9:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ adc:	5f                   	pop    %edi
+ add:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ ade:	8b 45 18             	mov    0x18(%ebp),%eax
+ ae1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ae3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ aea:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ af1:	e8 3a f8 ff ff       	call   330 <cyc2ns>
+ af6:	83 c4 0c             	add    $0xc,%esp
+ af9:	ff 75 14             	push   0x14(%ebp)
+ afc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b02:	f7 e3                	mul    %ebx
+ b04:	01 ca                	add    %ecx,%edx
+ b06:	52                   	push   %edx
+ b07:	50                   	push   %eax
+ b08:	e8 f3 f7 ff ff       	call   300 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ b0d:	89 46 08             	mov    %eax,0x8(%esi)
+ b10:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b13:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b14:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b17:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b18:	8d 50 01             	lea    0x1(%eax),%edx
+ b1b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ b20:	6b d2 63             	imul   $0x63,%edx,%edx
+ b23:	f7 e2                	mul    %edx
+ b25:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b28:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ b2f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ b36:	e8 f5 f7 ff ff       	call   330 <cyc2ns>
+ b3b:	83 c4 0c             	add    $0xc,%esp
+ b3e:	ff 75 14             	push   0x14(%ebp)
+ b41:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b47:	f7 e3                	mul    %ebx
+ b49:	01 ca                	add    %ecx,%edx
+ b4b:	52                   	push   %edx
+ b4c:	50                   	push   %eax
+ b4d:	e8 ae f7 ff ff       	call   300 <udiv64>
+
+  if(name){
+ b52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ b55:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ b58:	89 46 10             	mov    %eax,0x10(%esi)
+ b5b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ b5e:	85 c9                	test   %ecx,%ecx
+ b60:	74 72                	je     bd4 <bench+0x234>
+    printf(1, "%s: min ", name);
+ b62:	83 ec 04             	sub    $0x4,%esp
+ b65:	ff 75 08             	push   0x8(%ebp)
+ b68:	68 ba 0c 00 00       	push   $0xcba
+ b6d:	6a 01                	push   $0x1
+ b6f:	e8 5c fa ff ff       	call   5d0 <printf>
+    printps(1, st->min);
+ b74:	83 c4 0c             	add    $0xc,%esp
+ b77:	ff 76 04             	push   0x4(%esi)
+ b7a:	ff 36                	push   (%esi)
+ b7c:	6a 01                	push   $0x1
+ b7e:	e8 7d fd ff ff       	call   900 <printps>
+    printf(1, " median ");
+ b83:	58                   	pop    %eax
+ b84:	5a                   	pop    %edx
+ b85:	68 c3 0c 00 00       	push   $0xcc3
+ b8a:	6a 01                	push   $0x1
+ b8c:	e8 3f fa ff ff       	call   5d0 <printf>
+    printps(1, st->median);
+ b91:	83 c4 0c             	add    $0xc,%esp
+ b94:	ff 76 0c             	push   0xc(%esi)
+ b97:	ff 76 08             	push   0x8(%esi)
+ b9a:	6a 01                	push   $0x1
+ b9c:	e8 5f fd ff ff       	call   900 <printps>
+    printf(1, " p99 ");
+ ba1:	59                   	pop    %ecx
+ ba2:	5b                   	pop    %ebx
+ ba3:	68 cc 0c 00 00       	push   $0xccc
+ ba8:	6a 01                	push   $0x1
+ baa:	e8 21 fa ff ff       	call   5d0 <printf>
+    printps(1, st->p99);
+ baf:	83 c4 0c             	add    $0xc,%esp
+ bb2:	ff 76 14             	push   0x14(%esi)
+ bb5:	ff 76 10             	push   0x10(%esi)
+ bb8:	6a 01                	push   $0x1
+ bba:	e8 41 fd ff ff       	call   900 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ bbf:	83 c4 0c             	add    $0xc,%esp
+ bc2:	ff 75 18             	push   0x18(%ebp)
+ bc5:	68 d2 0c 00 00       	push   $0xcd2
+ bca:	6a 01                	push   $0x1
+ bcc:	e8 ff f9 ff ff       	call   5d0 <printf>
+ bd1:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ bd4:	31 c0                	xor    %eax,%eax
+}
+ bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bd9:	5b                   	pop    %ebx
+ bda:	5e                   	pop    %esi
+ bdb:	5f                   	pop    %edi
+ bdc:	5d                   	pop    %ebp
+ bdd:	c3                   	ret
+ bde:	66 90                	xchg   %ax,%ax
+ be0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ be6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ bec:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ bf2:	e9 97 fe ff ff       	jmp    a8e <bench+0xee>
+    return -1;
+ bf7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ bfc:	eb d8                	jmp    bd6 <bench+0x236>
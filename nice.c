@@ -0,0 +1,31 @@
+// Run a command at a different priority.
+//   nice [-n incr] cmd [args...]
+// incr defaults to 10; negative values raise the priority.
+
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  int incr, i;
+  char *s;
+
+  incr = 10;
+  i = 1;
+  if(argc > 2 && strcmp(argv[1], "-n") == 0){
+    s = argv[2];
+    incr = atoi(*s == '-' ? s + 1 : s);
+    if(*s == '-')
+      incr = -incr;
+    i = 3;
+  }
+  if(i >= argc){
+    printf(2, "usage: nice [-n incr] cmd [args...]\n");
+    exit();
+  }
+  nice(incr);
+  exec(argv[i], argv + i);
+  printf(2, "nice: exec %s failed\n", argv[i]);
+  exit();
+}
@@ -6,24 +6,58 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "traps.h"
+
+#define NPIDHASH 64
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
+
+// Wait channels are addresses, often of array elements with
+// equal low bits, so hash with a multiply and keep the top bits.
+#define NCHANHASH 64
+#define CHANHASH(chan) (((uint)(chan) * 2654435761U) >> (32 - 6))
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct rwlock pidlock;           // lookups in pidhash without lock
+  struct proc *pidhash[NPIDHASH];  // live processes by pid
+  struct proc *sleepq[NCHANHASH];  // sleeping processes by chan
 } ptable;
 
+// Per-cpu queues of RUNNABLE processes.  A process is on exactly
+// one queue while it is RUNNABLE.  Each queue has its own lock,
+// so a cpu picks its next process without touching ptable.lock,
+// and an idle cpu steals from the busiest other queue.
+// Within a queue there is a FIFO per priority level.
+// Lock order: ptable.lock before any runq lock.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  int n;
+} runqs[NCPU];
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static int wakeup1(void *chan, int n);
+
+// Serializes changes to page tables shared by threads.
+static struct spinlock vmlock;
 
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  int i;
+
+  initlockkind(&ptable.lock, "ptable", LK_TICKET);
+  initrwlock(&ptable.pidlock, "pidhash");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runqs[i].lock, "runq");
+  initlock(&vmlock, "vm");
 }
 
 // Must be called with interrupts disabled
@@ -65,6 +99,197 @@ myproc(void) {
   return p;
 }
 
+// Mark p RUNNABLE and append it to a run queue: that of the cpu
+// it last ran on, whose caches and TLB may still hold its state,
+// else this cpu's, else the first cpu its affinity mask allows.
+// If that cpu is halted, interrupt it so it runs p at once.
+// Caller must hold ptable.lock.
+static void
+makerunnable(struct proc *p)
+{
+  struct runq *rq;
+  int i, cpu;
+
+  cpu = p->cpu;
+  if(cpu < 0 || cpu >= ncpu || !(p->cpumask & (1 << cpu)))
+    cpu = cpuid();
+  for(i = 0; !(p->cpumask & (1 << cpu)) && i < ncpu; i++)
+    cpu = i;
+
+  p->state = RUNNABLE;
+  p->rqnext = 0;
+  p->queued = ticks;
+  i = PRIO(p);
+  rq = &runqs[cpu];
+  acquire(&rq->lock);
+  if(rq->tail[i])
+    rq->tail[i]->rqnext = p;
+  else
+    rq->head[i] = p;
+  rq->tail[i] = p;
+  rq->n++;
+  release(&rq->lock);
+
+  // release() is a full barrier, so either the idle cpu sees
+  // rq->n > 0 before it halts, or we see its idle flag.
+  if(cpus[cpu].idle && cpu != cpuid())
+    lapicipi(cpus[cpu].apicid, T_IRQ0 + IRQ_WAKEUP);
+}
+
+// Take the next process from rq for cpu to run, or 0 if there is
+// none.  Normally that is the first process on the highest
+// non-empty level, but a process that has waited STARVE ticks
+// goes first so that busy high-priority processes cannot starve
+// the rest.  When stealing, skip processes whose affinity mask
+// excludes cpu, and processes queued this tick: they are
+// cache-hot and their own cpu will soon run them.
+static struct proc*
+runqget(struct runq *rq, int cpu, int steal)
+{
+  struct proc *p, *prev, *pick, *pickprev;
+  int i, level;
+
+  acquire(&rq->lock);
+  pick = pickprev = 0;
+  level = 0;
+  for(i = 0; i < NPRIO; i++){
+    for(prev = 0, p = rq->head[i]; p; prev = p, p = p->rqnext)
+      if(!steal || ((p->cpumask & (1 << cpu)) && p->queued != ticks))
+        break;
+    if(p == 0)
+      continue;
+    if(pick == 0 || ticks - p->queued >= STARVE){
+      pick = p;
+      pickprev = prev;
+      level = i;
+      if(ticks - p->queued >= STARVE)
+        break;
+    }
+  }
+  if(pick){
+    if(pickprev)
+      pickprev->rqnext = pick->rqnext;
+    else
+      rq->head[level] = pick->rqnext;
+    if(rq->tail[level] == pick)
+      rq->tail[level] = pickprev;
+    rq->n--;
+    pick->rqnext = 0;
+  }
+  release(&rq->lock);
+  return pick;
+}
+
+// Pick the next process for cpu c: from its own queue, else
+// one stolen from the longest other queue, else from any other.
+static struct proc*
+pickproc(struct cpu *c)
+{
+  struct runq *rq, *busiest;
+  struct proc *p;
+  int me;
+
+  me = c - cpus;
+  if((p = runqget(&runqs[me], me, 0)) != 0)
+    return p;
+  busiest = 0;
+  for(rq = runqs; rq < &runqs[ncpu]; rq++)
+    if(rq != &runqs[me] && rq->n > 0 && (busiest == 0 || rq->n > busiest->n))
+      busiest = rq;
+  if(busiest == 0)
+    return 0;
+  if((p = runqget(busiest, me, 1)) != 0)
+    return p;
+  for(rq = runqs; rq < &runqs[ncpu]; rq++)
+    if(rq != &runqs[me] && rq != busiest && rq->n > 0 &&
+       (p = runqget(rq, me, 1)) != 0)
+      return p;
+  return 0;
+}
+
+// The pid hash changes only with both ptable.lock and pidlock
+// held, so either is enough to search it.  Readers that only
+// look at a process can take pidlock for reading and run in
+// parallel.  Lock order: ptable.lock before pidlock.
+
+// Add p to the pid hash.  The ptable lock must be held.
+static void
+pidinsert(struct proc *p)
+{
+  struct proc **b;
+
+  acquirewrite(&ptable.pidlock);
+  b = &ptable.pidhash[PIDHASH(p->pid)];
+  p->hnext = *b;
+  *b = p;
+  releasewrite(&ptable.pidlock);
+}
+
+// Remove p from the pid hash.  The ptable lock must be held.
+static void
+pidremove(struct proc *p)
+{
+  struct proc **pp;
+
+  acquirewrite(&ptable.pidlock);
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->hnext)
+    if(*pp == p){
+      *pp = p->hnext;
+      break;
+    }
+  releasewrite(&ptable.pidlock);
+}
+
+// Find the process with the given pid, or 0.
+// The ptable lock or pidlock must be held.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->hnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Put p on the wait queue for p->chan.
+// The ptable lock must be held.
+static void
+chaninsert(struct proc *p)
+{
+  struct proc **b;
+
+  b = &ptable.sleepq[CHANHASH(p->chan)];
+  p->snext = *b;
+  if(*b)
+    (*b)->sprev = &p->snext;
+  p->sprev = b;
+  *b = p;
+}
+
+// Take sleeping p off its wait queue and make it runnable.
+// The ptable lock must be held.
+static void
+wake(struct proc *p)
+{
+  *p->sprev = p->snext;
+  if(p->snext)
+    p->snext->sprev = p->sprev;
+  p->snext = 0;
+  p->sprev = 0;
+  makerunnable(p);
+}
+
+// Wake p if it is sleeping in wait().
+// The ptable lock must be held.
+static void
+wakewaiter(struct proc *p)
+{
+  if(p->state == SLEEPING && p->chan == p)
+    wake(p);
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -88,6 +313,15 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->nice = 0;
+  p->slice = 0;
+  p->cputicks = 0;
+  p->cpumask = ALLCPUS;
+  p->cpu = -1;
+  p->pgdir = 0;
+  p->shared = 0;
+  p->exe = 0;
+  fpuinit(p->fx);
 
   release(&ptable.lock);
 
@@ -148,39 +382,146 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  pidinsert(p);
+  makerunnable(p);
 
   release(&ptable.lock);
 }
 
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
+// Threads sharing the page table all see the new size.  A
+// shared address space cannot shrink: other cpus may still
+// hold TLB entries for the pages that would be freed.
 int
 growproc(int n)
 {
   uint sz;
   struct proc *curproc = myproc();
+  struct proc *p;
 
+  if(curproc->shared && n < 0)
+    return -1;
+  lockvm(curproc);
   sz = curproc->sz;
   if(n > 0){
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
+      goto bad;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
-      return -1;
+      goto bad;
   }
   curproc->sz = sz;
+  if(curproc->shared){
+    acquire(&ptable.lock);
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+      if(p->state != UNUSED && p->pgdir == curproc->pgdir)
+        p->sz = sz;
+    release(&ptable.lock);
+  }
+  unlockvm(curproc);
   switchuvm(curproc);
   return 0;
+
+bad:
+  unlockvm(curproc);
+  return -1;
+}
+
+// Serialize changes to p's user page table with those made by
+// threads sharing it.  Nothing to do if it is not shared; only
+// p itself sets or clears p->shared.
+void
+lockvm(struct proc *p)
+{
+  if(p->shared)
+    acquire(&vmlock);
+}
+
+void
+unlockvm(struct proc *p)
+{
+  if(p->shared)
+    release(&vmlock);
+}
+
+// Is p's page table also used by another live process?
+// Caller must hold ptable.lock.
+static int
+vmshared(struct proc *p)
+{
+  struct proc *q;
+
+  if(!p->shared)
+    return 0;
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+    if(q != p && q->state != UNUSED && q->pgdir == p->pgdir)
+      return 1;
+  return 0;
+}
+
+// Install pgdir as the current process's page table, for exec.
+// Returns the old page table for the caller to free, or 0 if
+// other threads still use it.
+pde_t*
+swappgdir(pde_t *pgdir)
+{
+  struct proc *curproc = myproc();
+  pde_t *old;
+
+  acquire(&ptable.lock);
+  old = curproc->pgdir;
+  if(vmshared(curproc))
+    old = 0;
+  curproc->pgdir = pgdir;
+  curproc->shared = 0;
+  release(&ptable.lock);
+  return old;
+}
+
+// Give new process np, whose memory and trap frame the caller
+// has set up, the rest of the current process's state, and
+// start it as a child.  Its open files are copies of ofile[],
+// which is the current process's own table except for spawn.
+// Shared by fork, clone and spawnproc.  Returns its pid.
+static int
+startchild(struct proc *np, struct file **ofile)
+{
+  int i, pid;
+  struct proc *curproc = myproc();
+
+  np->nice = curproc->nice;
+  np->cpumask = curproc->cpumask;
+
+  // Clear %eax so that the call returns 0 in the child.
+  np->tf->eax = 0;
+
+  for(i = 0; i < NOFILE; i++)
+    if(ofile[i])
+      np->ofile[i] = filedup(ofile[i]);
+  np->cwd = idup(curproc->cwd);
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  pidinsert(np);
+  np->parent = curproc;
+  np->children = 0;
+  np->sibling = curproc->children;
+  curproc->children = np;
+  makerunnable(np);
+
+  release(&ptable.lock);
+
+  return pid;
 }
 
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
-// Caller must set state of returned proc to RUNNABLE.
 int
 fork(void)
 {
-  int i, pid;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -197,24 +538,144 @@ fork(void)
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  if(curproc->exe)  // the copy faults in the same unloaded pages
+    np->exe = idup(curproc->exe);
+  memmove(np->seg, curproc->seg, sizeof(np->seg));
+  fpusave(np->fx);  // this cpu's registers are still curproc's
 
-  // Clear %eax so that fork returns 0 in the child.
-  np->tf->eax = 0;
+  return startchild(np, curproc->ofile);
+}
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
+// Create a child process that runs a new program image rather
+// than a copy of this one.  Used by spawn, which builds img with
+// exec's loader.  On success the child owns img's page table and
+// inode reference; on failure (-1) the caller still does.
+// The child's open files are copies of ofile[].
+// Returns the child's pid.
+int
+spawnproc(struct image *img, char *name, struct file **ofile)
+{
+  struct proc *np;
 
+  if((np = allocproc()) == 0)
+    return -1;
+  np->pgdir = img->pgdir;
+  np->sz = img->sz;
+  np->exe = img->exe;
+  memmove(np->seg, img->seg, sizeof(np->seg));
+  *np->tf = *myproc()->tf;
+  np->tf->eip = img->entry;
+  np->tf->esp = img->sp;
+  safestrcpy(np->name, name, sizeof(np->name));
+
+  return startchild(np, ofile);
+}
+
+// Create a thread: a process that shares the caller's page
+// table and starts in user space running fn(arg) on the stack
+// whose top is at stack.  fn must end with exit(); its return
+// address is invalid.  Open files and cwd are duplicated as by
+// fork.  The thread is a child of the caller, which reaps it
+// with join().  Returns the thread's pid, or -1.
+int
+clone(uint fn, uint arg, uint stack)
+{
+  uint sp, ustack[2];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  sp = stack - sizeof ustack;
+  if(fn >= curproc->sz || stack % 4 != 0 || stack > curproc->sz || sp > stack)
+    return -1;
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = arg;
+  if(!curproc->shared){
+    if(unshareuvm(curproc->pgdir, curproc->sz) < 0)
+      return -1;
+    lcr3(V2P(curproc->pgdir));
+  }
+  if(pagein(sp, sizeof ustack, 1) < 0 ||
+     copyout(curproc->pgdir, sp, ustack, sizeof ustack) < 0)
+    return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  np->pgdir = curproc->pgdir;
+  np->sz = curproc->sz;
+  *np->tf = *curproc->tf;
+  np->tf->eip = fn;
+  np->tf->esp = sp;
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  if(curproc->exe)
+    np->exe = idup(curproc->exe);
+  memmove(np->seg, curproc->seg, sizeof(np->seg));
 
-  pid = np->pid;
+  // Only each process itself writes its shared flag, and np
+  // is not yet running.
+  curproc->shared = 1;
+  np->shared = 1;
+
+  return startchild(np, curproc->ofile);
+}
+
+// A kernel thread's first scheduling by scheduler() will
+// swtch here, with fn and arg on the stack as if passed by
+// a call.  Returning from fn exits the thread.
+static void
+kthreadstart(void (*fn)(void*), void *arg)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+  fpurestore(myproc()->fx);
+  fn(arg);
+  exit();
+}
+
+// Create a kernel thread running fn(arg).  It is a process with
+// no user address space (pgdir is 0) and no files or cwd, which
+// runs only in the kernel on the kernel page table.  It is a
+// child of init, which reaps it if it exits.  Must be called
+// after userinit().  Returns its pid, or -1.
+int
+kthread_create(void (*fn)(void*), void *arg, char *name)
+{
+  struct proc *p;
+  char *sp;
+  int pid;
+
+  if((p = allocproc()) == 0)
+    return -1;
+
+  // Replace the stack allocproc built to return to user space.
+  sp = p->kstack + KSTACKSIZE;
+  sp -= 4;
+  *(uint*)sp = (uint)arg;
+  sp -= 4;
+  *(uint*)sp = (uint)fn;
+  sp -= 4;
+  *(uint*)sp = 0;  // kthreadstart's return address; never used
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+  p->context->eip = (uint)kthreadstart;
+  p->tf = 0;
+  p->pgdir = 0;
+  p->sz = 0;
+  p->cwd = 0;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  pid = p->pid;
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  pidinsert(p);
+  p->parent = initproc;
+  p->children = 0;
+  p->sibling = initproc->children;
+  initproc->children = p;
+  makerunnable(p);
 
   release(&ptable.lock);
 
@@ -242,23 +703,29 @@ exit(void)
     }
   }
 
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  if(curproc->cwd){  // kernel threads have none
+    begin_op();
+    iput(curproc->cwd);
+    if(curproc->exe)
+      iput(curproc->exe);
+    end_op();
+    curproc->cwd = 0;
+    curproc->exe = 0;
+  }
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakewaiter(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  while((p = curproc->children) != 0){
+    curproc->children = p->sibling;
+    p->parent = initproc;
+    p->sibling = initproc->children;
+    initproc->children = p;
+    if(p->state == ZOMBIE)
+      wakewaiter(initproc);
   }
 
   // Jump into the scheduler, never to return.
@@ -267,34 +734,54 @@ exit(void)
   panic("zombie exit");
 }
 
+// Free the resources of zombie p, which the caller has already
+// unlinked from its parent's children.  The address space goes
+// with the last process using it.
+// The ptable lock must be held.
+static void
+freeproc(struct proc *p)
+{
+  pidremove(p);
+  kfree(p->kstack);
+  p->kstack = 0;
+  if(p->pgdir && !vmshared(p))  // kernel threads have none
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  p->shared = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+}
+
+// Is child p one of curproc's threads, for join() rather
+// than wait()?
+#define ISTHREAD(p, curproc) ((p)->shared && (p)->pgdir == (curproc)->pgdir)
+
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
+// Threads created by clone() are left for join().
 int
 wait(void)
 {
-  struct proc *p;
+  struct proc *p, **pp;
   int havekids, pid;
   struct proc *curproc = myproc();
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
+      if(ISTHREAD(p, curproc))
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
+        *pp = p->sibling;
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -311,6 +798,36 @@ wait(void)
   }
 }
 
+// Wait for thread tid, created by this process with clone(),
+// to exit, and reap it.  Returns 0, or -1 if there is no such
+// thread.
+int
+join(int tid)
+{
+  struct proc *p, **pp;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling)
+      if(p->pid == tid && ISTHREAD(p, curproc))
+        break;
+    if(p == 0 || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    if(p->state == ZOMBIE){
+      *pp = p->sibling;
+      freeproc(p);
+      if(!vmshared(curproc))  // the last thread is gone
+        curproc->shared = 0;
+      release(&ptable.lock);
+      return 0;
+    }
+    sleep(curproc, &ptable.lock);
+  }
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -330,28 +847,47 @@ scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
+    // Take a process from the run queues.  Once dequeued it
+    // belongs to this cpu: it stays RUNNABLE, and no other
+    // cpu can find it.
+    if((p = pickproc(c)) == 0){
+      // Nothing to run: halt until an interrupt.
+      // Announce the halt before the last look at the queue,
+      // with interrupts off so that a wakeup from an interrupt
+      // on this cpu cannot slip in between.
+      cli();
+      xchg(&c->idle, 1);
+      if(runqs[c - cpus].n == 0)
+        stihlt();
+      c->idle = 0;
+      continue;
+    }
 
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
+    // Switch to chosen process.  It is the process's job
+    // to release ptable.lock and then reacquire it
+    // before jumping back to us.  Acquiring it here also
+    // waits out a cpu that queued p and is still switching
+    // away from it.
+    acquire(&ptable.lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler: not runnable");
+    c->proc = p;
+    if(p->pgdir)  // kernel threads stay on the kernel page table
       switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
-    }
+    p->state = RUNNING;
+    p->cpu = c - cpus;
+    // Higher priority gets a longer slice: from 1 tick at
+    // NICEMAX up to NPRIO ticks at NICEMIN.
+    if(p->slice <= 0)
+      p->slice = NPRIO - PRIO(p);
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
     release(&ptable.lock);
-
   }
 }
 
@@ -377,7 +913,9 @@ sched(void)
   if(readeflags()&FL_IF)
     panic("sched interruptible");
   intena = mycpu()->intena;
+  fpusave(p->fx);
   swtch(&p->context, mycpu()->scheduler);
+  fpurestore(p->fx);
   mycpu()->intena = intena;
 }
 
@@ -386,7 +924,7 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  makerunnable(myproc());
   sched();
   release(&ptable.lock);
 }
@@ -399,6 +937,7 @@ forkret(void)
   static int first = 1;
   // Still holding ptable.lock from scheduler.
   release(&ptable.lock);
+  fpurestore(myproc()->fx);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -438,6 +977,7 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  chaninsert(p);
 
   sched();
 
@@ -452,16 +992,24 @@ sleep(void *chan, struct spinlock *lk)
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
+// Wake up to n processes sleeping on chan, and return how many
+// were woken.  Only the wait queue chan hashes to is searched.
 // The ptable lock must be held.
-static void
-wakeup1(void *chan)
+static int
+wakeup1(void *chan, int n)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct proc *p, *next;
+  int woken;
+
+  woken = 0;
+  for(p = ptable.sleepq[CHANHASH(chan)]; p && woken < n; p = next){
+    next = p->snext;
+    if(p->chan == chan){
+      wake(p);
+      woken++;
+    }
+  }
+  return woken;
 }
 
 // Wake up all processes sleeping on chan.
@@ -469,10 +1017,22 @@ void
 wakeup(void *chan)
 {
   acquire(&ptable.lock);
-  wakeup1(chan);
+  wakeup1(chan, NPROC);
   release(&ptable.lock);
 }
 
+// Wake up to n processes sleeping on chan; return how many.
+int
+wakeupn(void *chan, int n)
+{
+  int woken;
+
+  acquire(&ptable.lock);
+  woken = wakeup1(chan, n);
+  release(&ptable.lock);
+  return woken;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -482,20 +1042,106 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      wake(p);
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
   return -1;
 }
 
+// Set the nice value of process pid, or of the caller if pid
+// is 0, clamped to [NICEMIN, NICEMAX].  It takes effect the
+// next time the process is queued.  Return -1 if no such pid.
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+
+  if(nice < NICEMIN)
+    nice = NICEMIN;
+  if(nice > NICEMAX)
+    nice = NICEMAX;
+  if(pid == 0)
+    pid = myproc()->pid;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) != 0){
+    p->nice = nice;
+    release(&ptable.lock);
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Return the nice value of process pid, or of the caller if
+// pid is 0.  Return NICEMAX+1 if no such pid, since any value
+// in range is a valid answer.
+int
+getpriority(int pid)
+{
+  struct proc *p;
+  int nice;
+
+  if(pid == 0)
+    return myproc()->nice;
+  nice = NICEMAX + 1;
+  acquireread(&ptable.pidlock);
+  if((p = findproc(pid)) != 0)
+    nice = p->nice;
+  releaseread(&ptable.pidlock);
+  return nice;
+}
+
+// Restrict process pid, or the caller if pid is 0, to the cpus
+// in mask.  It takes effect the next time the process is queued;
+// one already queued may run once more where it is.  A caller
+// changing its own mask yields, so that it moves at once.
+// Return -1 if no such pid or if mask names no existing cpu.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+
+  mask &= ALLCPUS;
+  if((mask & ((1 << ncpu) - 1)) == 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) != 0){
+    p->cpumask = mask;
+    release(&ptable.lock);
+    if(p == myproc())
+      yield();
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Return the affinity mask of process pid, or of the caller if
+// pid is 0.  Return 0 if no such pid.
+uint
+getaffinity(int pid)
+{
+  struct proc *p;
+  uint mask;
+
+  if(pid == 0)
+    return myproc()->cpumask;
+  mask = 0;
+  acquireread(&ptable.pidlock);
+  if((p = findproc(pid)) != 0)
+    mask = p->cpumask;
+  releaseread(&ptable.pidlock);
+  return mask;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -523,7 +1169,10 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s nice %d cpu %d", p->pid, state, p->name,
+            p->nice, p->cputicks);
+    if(p->pgdir == 0)
+      cprintf(" kthread");
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
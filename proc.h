@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in scheduler(), waiting for work
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,8 +33,37 @@ struct context {
   uint eip;
 };
 
+// Scheduling priorities.  Each run queue has NPRIO levels, served
+// highest first; a process's level and time slice follow its nice.
+#define NICEMIN   -20
+#define NICEMAX    19
+#define NPRIO       8
+#define PRIO(p)   (((p)->nice - NICEMIN) * NPRIO / (NICEMAX - NICEMIN + 1))
+#define STARVE     20   // ticks queued before a process runs regardless
+#define ALLCPUS   ((1 << NCPU) - 1)   // default affinity mask
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A loadable segment of the executable whose pages are read
+// from the file on first touch (see pagefault in exec.c).
+#define NSEG 4
+struct seg {
+  uint va;                     // Page-aligned start
+  uint memsz;                  // Bytes of memory, 0 if slot unused
+  uint off;                    // File offset of va
+  uint filesz;                 // Bytes backed by the file, the rest zero
+};
+
+// A program image built by exec's loader, not yet given to a process.
+struct image {
+  pde_t *pgdir;
+  uint sz;
+  uint entry;                  // Initial %eip
+  uint sp;                     // Initial %esp, with argc and argv pushed
+  struct inode *exe;           // Referenced executable, or 0
+  struct seg seg[NSEG];        // Segments left to pagefault
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -45,10 +75,26 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *snext;          // Next in wait queue for chan
+  struct proc **sprev;         // Link pointing at this one
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct proc *rqnext;         // Next on the run queue
+  struct proc *hnext;          // Next in pid hash chain
+  struct proc *children;       // First child
+  struct proc *sibling;        // Next child of the same parent
+  int nice;                    // Priority, NICEMIN (high) to NICEMAX (low)
+  int slice;                   // Timer ticks left in this time slice
+  uint queued;                 // Value of ticks when put on a run queue
+  uint cputicks;               // Timer ticks spent running
+  uint cpumask;                // Cpus this process may run on
+  int cpu;                     // Cpu it last ran on, or -1
+  int shared;                  // pgdir may be shared with threads (clone)
+  struct inode *exe;           // Executable for demand paging, or 0
+  struct seg seg[NSEG];        // Its segments not loaded up front
+  char fx[FXSIZE] __attribute__((aligned(16)));  // x87/SSE registers while switched out
 };
 
 // Process memory is laid out contiguously, low addresses first:
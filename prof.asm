@@ -0,0 +1,2567 @@
+
+_prof:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 38             	sub    $0x38,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  char path[32], *cmd;
+  int period, pid, i;
+
+  period = 1;
+  i = 1;
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+      19:	83 fb 02             	cmp    $0x2,%ebx
+      1c:	0f 8f d8 02 00 00    	jg     2fa <main+0x2fa>
+      22:	31 d2                	xor    %edx,%edx
+  i = 1;
+      24:	b8 01 00 00 00       	mov    $0x1,%eax
+  period = 1;
+      29:	bf 01 00 00 00       	mov    $0x1,%edi
+    period = atoi(argv[2]);
+    i = 3;
+  }
+  if(i >= argc || period <= 0){
+      2e:	39 d8                	cmp    %ebx,%eax
+      30:	0f 8d 9c 02 00 00    	jge    2d2 <main+0x2d2>
+      36:	84 d2                	test   %dl,%dl
+      38:	0f 85 94 02 00 00    	jne    2d2 <main+0x2d2>
+    printf(2, "usage: prof [-p period] cmd [args...]\n");
+    exit();
+  }
+
+  cmd = argv[i];
+      3e:	8d 34 86             	lea    (%esi,%eax,4),%esi
+      41:	8b 1e                	mov    (%esi),%ebx
+  while(*cmd == '/')
+      43:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      46:	75 10                	jne    58 <main+0x58>
+      48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      4f:	90                   	nop
+    cmd++;
+      50:	83 c3 01             	add    $0x1,%ebx
+  while(*cmd == '/')
+      53:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      56:	74 f8                	je     50 <main+0x50>
+  if(strlen(cmd) + 6 > sizeof(path)){
+      58:	83 ec 0c             	sub    $0xc,%esp
+      5b:	53                   	push   %ebx
+      5c:	e8 af 07 00 00       	call   810 <strlen>
+      61:	83 c4 10             	add    $0x10,%esp
+      64:	83 c0 06             	add    $0x6,%eax
+      67:	83 f8 20             	cmp    $0x20,%eax
+      6a:	0f 87 4f 02 00 00    	ja     2bf <main+0x2bf>
+    printf(2, "prof: %s: name too long\n", cmd);
+    exit();
+  }
+  loadsyms("kernel.sym", &ktab);
+      70:	b8 e4 12 00 00       	mov    $0x12e4,%eax
+      75:	ba dc 38 00 00       	mov    $0x38dc,%edx
+      7a:	e8 91 03 00 00       	call   410 <loadsyms>
+  strcpy(path, cmd);
+      7f:	50                   	push   %eax
+      80:	50                   	push   %eax
+      81:	53                   	push   %ebx
+      82:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+      85:	53                   	push   %ebx
+      86:	e8 f5 06 00 00       	call   780 <strcpy>
+  strcpy(path + strlen(path), ".sym");
+      8b:	89 1c 24             	mov    %ebx,(%esp)
+      8e:	e8 7d 07 00 00       	call   810 <strlen>
+      93:	5a                   	pop    %edx
+      94:	59                   	pop    %ecx
+      95:	68 ea 12 00 00       	push   $0x12ea
+      9a:	01 d8                	add    %ebx,%eax
+      9c:	50                   	push   %eax
+      9d:	e8 de 06 00 00       	call   780 <strcpy>
+  loadsyms(path, &utab);
+      a2:	ba d4 38 00 00       	mov    $0x38d4,%edx
+      a7:	89 d8                	mov    %ebx,%eax
+      a9:	e8 62 03 00 00       	call   410 <loadsyms>
+  if(ktab.n == 0)
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	83 3d e0 38 00 00 00 	cmpl   $0x0,0x38e0
+      b8:	0f 84 d5 02 00 00    	je     393 <main+0x393>
+    printf(2, "prof: no kernel.sym, kernel samples unresolved\n");
+
+  // Discard samples left over from earlier runs.
+  drain(-1);
+      be:	83 c8 ff             	or     $0xffffffff,%eax
+  nsamples = nlost = nidle = nother = nunknown = 0;
+      c1:	31 db                	xor    %ebx,%ebx
+  drain(-1);
+      c3:	e8 c8 05 00 00       	call   690 <drain>
+
+  profile(period);
+      c8:	83 ec 0c             	sub    $0xc,%esp
+  nsamples = nlost = nidle = nother = nunknown = 0;
+      cb:	89 1d c0 38 00 00    	mov    %ebx,0x38c0
+  profile(period);
+      d1:	57                   	push   %edi
+  nsamples = nlost = nidle = nother = nunknown = 0;
+      d2:	89 1d c4 38 00 00    	mov    %ebx,0x38c4
+      d8:	89 1d c8 38 00 00    	mov    %ebx,0x38c8
+      de:	89 1d cc 38 00 00    	mov    %ebx,0x38cc
+      e4:	89 1d d0 38 00 00    	mov    %ebx,0x38d0
+  profile(period);
+      ea:	e8 71 0a 00 00       	call   b60 <profile>
+  pid = fork();
+      ef:	e8 8c 09 00 00       	call   a80 <fork>
+  if(pid == 0){
+      f4:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+      f7:	89 c3                	mov    %eax,%ebx
+  if(pid == 0){
+      f9:	85 c0                	test   %eax,%eax
+      fb:	0f 84 72 02 00 00    	je     373 <main+0x373>
+    exec(argv[i], argv + i);
+    printf(2, "prof: exec %s failed\n", argv[i]);
+    exit();
+  }
+  if(pid > 0)
+     101:	0f 8f 2d 02 00 00    	jg     334 <main+0x334>
+    wait();
+  profile(0);
+     107:	83 ec 0c             	sub    $0xc,%esp
+     10a:	6a 00                	push   $0x0
+     10c:	e8 4f 0a 00 00       	call   b60 <profile>
+  drain(pid);
+     111:	89 d8                	mov    %ebx,%eax
+     113:	e8 78 05 00 00       	call   690 <drain>
+  printf(1, "%d samples", nsamples);
+     118:	83 c4 0c             	add    $0xc,%esp
+     11b:	ff 35 d0 38 00 00    	push   0x38d0
+     121:	68 05 13 00 00       	push   $0x1305
+     126:	6a 01                	push   $0x1
+     128:	e8 63 0b 00 00       	call   c90 <printf>
+  if(nlost)
+     12d:	a1 cc 38 00 00       	mov    0x38cc,%eax
+     132:	83 c4 10             	add    $0x10,%esp
+     135:	85 c0                	test   %eax,%eax
+     137:	0f 85 01 02 00 00    	jne    33e <main+0x33e>
+  printf(1, "; idle ");
+     13d:	50                   	push   %eax
+     13e:	50                   	push   %eax
+     13f:	68 1a 13 00 00       	push   $0x131a
+     144:	6a 01                	push   $0x1
+     146:	e8 45 0b 00 00       	call   c90 <printf>
+  pct(nidle);
+     14b:	a1 c8 38 00 00       	mov    0x38c8,%eax
+     150:	e8 5b 02 00 00       	call   3b0 <pct>
+  printf(1, ", other processes ");
+     155:	5a                   	pop    %edx
+     156:	59                   	pop    %ecx
+     157:	68 22 13 00 00       	push   $0x1322
+     15c:	6a 01                	push   $0x1
+     15e:	e8 2d 0b 00 00       	call   c90 <printf>
+  pct(nother);
+     163:	a1 c4 38 00 00       	mov    0x38c4,%eax
+     168:	e8 43 02 00 00       	call   3b0 <pct>
+  printf(1, ", unresolved ");
+     16d:	5b                   	pop    %ebx
+     16e:	5e                   	pop    %esi
+     16f:	68 35 13 00 00       	push   $0x1335
+     174:	6a 01                	push   $0x1
+     176:	e8 15 0b 00 00       	call   c90 <printf>
+  pct(nunknown);
+     17b:	a1 c0 38 00 00       	mov    0x38c0,%eax
+     180:	e8 2b 02 00 00       	call   3b0 <pct>
+  printf(1, "\n\nsamples\t%%\t\tsymbol\n");
+     185:	5f                   	pop    %edi
+     186:	58                   	pop    %eax
+     187:	68 43 13 00 00       	push   $0x1343
+     18c:	6a 01                	push   $0x1
+     18e:	e8 fd 0a 00 00       	call   c90 <printf>
+     193:	c7 45 c4 28 00 00 00 	movl   $0x28,-0x3c(%ebp)
+     19a:	83 c4 10             	add    $0x10,%esp
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i = 0; i < ktab.n; i++)
+     1a0:	8b 15 e0 38 00 00    	mov    0x38e0,%edx
+    for(i = 0; i < utab.n; i++)
+     1a6:	8b 3d d8 38 00 00    	mov    0x38d8,%edi
+    for(i = 0; i < ktab.n; i++)
+     1ac:	85 d2                	test   %edx,%edx
+     1ae:	0f 8e 6b 01 00 00    	jle    31f <main+0x31f>
+     1b4:	a1 dc 38 00 00       	mov    0x38dc,%eax
+     1b9:	8d 14 52             	lea    (%edx,%edx,2),%edx
+    best = 0;
+     1bc:	31 f6                	xor    %esi,%esi
+     1be:	8d 0c 90             	lea    (%eax,%edx,4),%ecx
+     1c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(ktab.s[i].hits && (best == 0 || ktab.s[i].hits > best->hits))
+     1c8:	8b 50 08             	mov    0x8(%eax),%edx
+     1cb:	85 d2                	test   %edx,%edx
+     1cd:	74 21                	je     1f0 <main+0x1f0>
+     1cf:	85 f6                	test   %esi,%esi
+     1d1:	0f 84 11 01 00 00    	je     2e8 <main+0x2e8>
+     1d7:	39 56 08             	cmp    %edx,0x8(%esi)
+     1da:	0f 8c 08 01 00 00    	jl     2e8 <main+0x2e8>
+    for(i = 0; i < ktab.n; i++)
+     1e0:	83 c0 0c             	add    $0xc,%eax
+     1e3:	39 c1                	cmp    %eax,%ecx
+     1e5:	74 10                	je     1f7 <main+0x1f7>
+      if(ktab.s[i].hits && (best == 0 || ktab.s[i].hits > best->hits))
+     1e7:	8b 50 08             	mov    0x8(%eax),%edx
+     1ea:	85 d2                	test   %edx,%edx
+     1ec:	75 e9                	jne    1d7 <main+0x1d7>
+     1ee:	66 90                	xchg   %ax,%ax
+    for(i = 0; i < ktab.n; i++)
+     1f0:	83 c0 0c             	add    $0xc,%eax
+     1f3:	39 c1                	cmp    %eax,%ecx
+     1f5:	75 d1                	jne    1c8 <main+0x1c8>
+    for(i = 0; i < utab.n; i++)
+     1f7:	85 ff                	test   %edi,%edi
+     1f9:	0f 8e 2b 01 00 00    	jle    32a <main+0x32a>
+     1ff:	a1 d4 38 00 00       	mov    0x38d4,%eax
+    tag = 'k';
+     204:	bb 6b 00 00 00       	mov    $0x6b,%ebx
+    for(i = 0; i < utab.n; i++)
+     209:	31 d2                	xor    %edx,%edx
+     20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     20f:	90                   	nop
+      if(utab.s[i].hits && (best == 0 || utab.s[i].hits > best->hits)){
+     210:	8b 48 08             	mov    0x8(%eax),%ecx
+     213:	85 c9                	test   %ecx,%ecx
+     215:	74 10                	je     227 <main+0x227>
+     217:	85 f6                	test   %esi,%esi
+     219:	74 05                	je     220 <main+0x220>
+     21b:	3b 4e 08             	cmp    0x8(%esi),%ecx
+     21e:	7e 07                	jle    227 <main+0x227>
+     220:	89 c6                	mov    %eax,%esi
+        tag = 'u';
+     222:	bb 75 00 00 00       	mov    $0x75,%ebx
+    for(i = 0; i < utab.n; i++)
+     227:	83 c2 01             	add    $0x1,%edx
+     22a:	83 c0 0c             	add    $0xc,%eax
+     22d:	39 d7                	cmp    %edx,%edi
+     22f:	7f df                	jg     210 <main+0x210>
+    if(best == 0)
+     231:	85 f6                	test   %esi,%esi
+     233:	0f 84 81 00 00 00    	je     2ba <main+0x2ba>
+    printf(1, "%d\t", best->hits);
+     239:	83 ec 04             	sub    $0x4,%esp
+     23c:	ff 76 08             	push   0x8(%esi)
+     23f:	68 59 13 00 00       	push   $0x1359
+     244:	6a 01                	push   $0x1
+     246:	e8 45 0a 00 00       	call   c90 <printf>
+    pct(best->hits);
+     24b:	8b 7e 08             	mov    0x8(%esi),%edi
+  x = nsamples ? n * 1000 / nsamples : 0;
+     24e:	83 c4 10             	add    $0x10,%esp
+     251:	31 c0                	xor    %eax,%eax
+     253:	8b 0d d0 38 00 00    	mov    0x38d0,%ecx
+     259:	85 c9                	test   %ecx,%ecx
+     25b:	74 2b                	je     288 <main+0x288>
+     25d:	69 ff e8 03 00 00    	imul   $0x3e8,%edi,%edi
+     263:	89 f8                	mov    %edi,%eax
+     265:	99                   	cltd
+     266:	f7 f9                	idiv   %ecx
+  printf(1, "%d.%d%%", x / 10, x % 10);
+     268:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  x = nsamples ? n * 1000 / nsamples : 0;
+     26d:	89 c7                	mov    %eax,%edi
+  printf(1, "%d.%d%%", x / 10, x % 10);
+     26f:	f7 ea                	imul   %edx
+     271:	89 f8                	mov    %edi,%eax
+     273:	c1 f8 1f             	sar    $0x1f,%eax
+     276:	89 d1                	mov    %edx,%ecx
+     278:	c1 f9 02             	sar    $0x2,%ecx
+     27b:	29 c1                	sub    %eax,%ecx
+     27d:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+     280:	89 c8                	mov    %ecx,%eax
+     282:	01 d2                	add    %edx,%edx
+     284:	29 d7                	sub    %edx,%edi
+     286:	89 f9                	mov    %edi,%ecx
+     288:	51                   	push   %ecx
+     289:	50                   	push   %eax
+     28a:	68 c0 12 00 00       	push   $0x12c0
+     28f:	6a 01                	push   $0x1
+     291:	e8 fa 09 00 00       	call   c90 <printf>
+    printf(1, "\t\t[%c] %s\n", tag, best->name);
+     296:	ff 76 04             	push   0x4(%esi)
+     299:	53                   	push   %ebx
+     29a:	68 5d 13 00 00       	push   $0x135d
+     29f:	6a 01                	push   $0x1
+     2a1:	e8 ea 09 00 00       	call   c90 <printf>
+  for(k = 0; k < NTOP; k++){
+     2a6:	83 c4 20             	add    $0x20,%esp
+     2a9:	83 6d c4 01          	subl   $0x1,-0x3c(%ebp)
+    best->hits = 0;
+     2ad:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  for(k = 0; k < NTOP; k++){
+     2b4:	0f 85 e6 fe ff ff    	jne    1a0 <main+0x1a0>
+  report();
+  exit();
+     2ba:	e8 c9 07 00 00       	call   a88 <exit>
+    printf(2, "prof: %s: name too long\n", cmd);
+     2bf:	56                   	push   %esi
+     2c0:	53                   	push   %ebx
+     2c1:	68 cb 12 00 00       	push   $0x12cb
+     2c6:	6a 02                	push   $0x2
+     2c8:	e8 c3 09 00 00       	call   c90 <printf>
+    exit();
+     2cd:	e8 b6 07 00 00       	call   a88 <exit>
+    printf(2, "usage: prof [-p period] cmd [args...]\n");
+     2d2:	57                   	push   %edi
+     2d3:	57                   	push   %edi
+     2d4:	68 68 13 00 00       	push   $0x1368
+     2d9:	6a 02                	push   $0x2
+     2db:	e8 b0 09 00 00       	call   c90 <printf>
+    exit();
+     2e0:	e8 a3 07 00 00       	call   a88 <exit>
+     2e5:	8d 76 00             	lea    0x0(%esi),%esi
+     2e8:	89 c6                	mov    %eax,%esi
+    for(i = 0; i < ktab.n; i++)
+     2ea:	83 c0 0c             	add    $0xc,%eax
+     2ed:	39 c1                	cmp    %eax,%ecx
+     2ef:	0f 85 d3 fe ff ff    	jne    1c8 <main+0x1c8>
+     2f5:	e9 fd fe ff ff       	jmp    1f7 <main+0x1f7>
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+     2fa:	50                   	push   %eax
+     2fb:	50                   	push   %eax
+     2fc:	68 c8 12 00 00       	push   $0x12c8
+     301:	ff 76 04             	push   0x4(%esi)
+     304:	e8 a7 04 00 00       	call   7b0 <strcmp>
+     309:	83 c4 10             	add    $0x10,%esp
+     30c:	85 c0                	test   %eax,%eax
+     30e:	74 44                	je     354 <main+0x354>
+  i = 1;
+     310:	b8 01 00 00 00       	mov    $0x1,%eax
+  period = 1;
+     315:	bf 01 00 00 00       	mov    $0x1,%edi
+     31a:	e9 1f fd ff ff       	jmp    3e <main+0x3e>
+    for(i = 0; i < utab.n; i++)
+     31f:	85 ff                	test   %edi,%edi
+     321:	7e 97                	jle    2ba <main+0x2ba>
+    best = 0;
+     323:	31 f6                	xor    %esi,%esi
+     325:	e9 d5 fe ff ff       	jmp    1ff <main+0x1ff>
+    tag = 'k';
+     32a:	bb 6b 00 00 00       	mov    $0x6b,%ebx
+     32f:	e9 fd fe ff ff       	jmp    231 <main+0x231>
+    wait();
+     334:	e8 57 07 00 00       	call   a90 <wait>
+     339:	e9 c9 fd ff ff       	jmp    107 <main+0x107>
+    printf(1, ", %d lost", nlost);
+     33e:	52                   	push   %edx
+     33f:	50                   	push   %eax
+     340:	68 10 13 00 00       	push   $0x1310
+     345:	6a 01                	push   $0x1
+     347:	e8 44 09 00 00       	call   c90 <printf>
+     34c:	83 c4 10             	add    $0x10,%esp
+     34f:	e9 e9 fd ff ff       	jmp    13d <main+0x13d>
+    period = atoi(argv[2]);
+     354:	83 ec 0c             	sub    $0xc,%esp
+     357:	ff 76 08             	push   0x8(%esi)
+     35a:	e8 f1 05 00 00       	call   950 <atoi>
+  if(i >= argc || period <= 0){
+     35f:	83 c4 10             	add    $0x10,%esp
+     362:	85 c0                	test   %eax,%eax
+    period = atoi(argv[2]);
+     364:	89 c7                	mov    %eax,%edi
+    i = 3;
+     366:	b8 03 00 00 00       	mov    $0x3,%eax
+  if(i >= argc || period <= 0){
+     36b:	0f 9e c2             	setle  %dl
+     36e:	e9 bb fc ff ff       	jmp    2e <main+0x2e>
+    exec(argv[i], argv + i);
+     373:	51                   	push   %ecx
+     374:	51                   	push   %ecx
+     375:	56                   	push   %esi
+     376:	ff 36                	push   (%esi)
+     378:	e8 43 07 00 00       	call   ac0 <exec>
+    printf(2, "prof: exec %s failed\n", argv[i]);
+     37d:	83 c4 0c             	add    $0xc,%esp
+     380:	ff 36                	push   (%esi)
+     382:	68 ef 12 00 00       	push   $0x12ef
+     387:	6a 02                	push   $0x2
+     389:	e8 02 09 00 00       	call   c90 <printf>
+    exit();
+     38e:	e8 f5 06 00 00       	call   a88 <exit>
+    printf(2, "prof: no kernel.sym, kernel samples unresolved\n");
+     393:	50                   	push   %eax
+     394:	50                   	push   %eax
+     395:	68 90 13 00 00       	push   $0x1390
+     39a:	6a 02                	push   $0x2
+     39c:	e8 ef 08 00 00       	call   c90 <printf>
+     3a1:	83 c4 10             	add    $0x10,%esp
+     3a4:	e9 15 fd ff ff       	jmp    be <main+0xbe>
+     3a9:	66 90                	xchg   %ax,%ax
+     3ab:	66 90                	xchg   %ax,%ax
+     3ad:	66 90                	xchg   %ax,%ax
+     3af:	90                   	nop
+
+000003b0 <pct>:
+{
+     3b0:	55                   	push   %ebp
+     3b1:	31 d2                	xor    %edx,%edx
+     3b3:	89 e5                	mov    %esp,%ebp
+     3b5:	53                   	push   %ebx
+     3b6:	83 ec 04             	sub    $0x4,%esp
+  x = nsamples ? n * 1000 / nsamples : 0;
+     3b9:	8b 0d d0 38 00 00    	mov    0x38d0,%ecx
+     3bf:	85 c9                	test   %ecx,%ecx
+     3c1:	74 29                	je     3ec <pct+0x3c>
+     3c3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+     3c9:	99                   	cltd
+     3ca:	f7 f9                	idiv   %ecx
+  printf(1, "%d.%d%%", x / 10, x % 10);
+     3cc:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  x = nsamples ? n * 1000 / nsamples : 0;
+     3d1:	89 c3                	mov    %eax,%ebx
+  printf(1, "%d.%d%%", x / 10, x % 10);
+     3d3:	f7 ea                	imul   %edx
+     3d5:	89 d8                	mov    %ebx,%eax
+     3d7:	c1 f8 1f             	sar    $0x1f,%eax
+     3da:	c1 fa 02             	sar    $0x2,%edx
+     3dd:	89 d1                	mov    %edx,%ecx
+     3df:	29 c1                	sub    %eax,%ecx
+     3e1:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+     3e4:	89 ca                	mov    %ecx,%edx
+     3e6:	01 c0                	add    %eax,%eax
+     3e8:	29 c3                	sub    %eax,%ebx
+     3ea:	89 d9                	mov    %ebx,%ecx
+     3ec:	51                   	push   %ecx
+     3ed:	52                   	push   %edx
+     3ee:	68 c0 12 00 00       	push   $0x12c0
+     3f3:	6a 01                	push   $0x1
+     3f5:	e8 96 08 00 00       	call   c90 <printf>
+}
+     3fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3fd:	83 c4 10             	add    $0x10,%esp
+     400:	c9                   	leave
+     401:	c3                   	ret
+     402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <loadsyms>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	57                   	push   %edi
+     414:	56                   	push   %esi
+     415:	53                   	push   %ebx
+     416:	83 ec 44             	sub    $0x44,%esp
+     419:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  t->n = 0;
+     41c:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  if((fd = open(path, O_RDONLY)) < 0)
+     423:	6a 00                	push   $0x0
+     425:	50                   	push   %eax
+     426:	e8 9d 06 00 00       	call   ac8 <open>
+     42b:	83 c4 10             	add    $0x10,%esp
+     42e:	85 c0                	test   %eax,%eax
+     430:	0f 88 ed 00 00 00    	js     523 <loadsyms+0x113>
+     436:	89 c3                	mov    %eax,%ebx
+  if(fstat(fd, &st) < 0 || (buf = malloc(st.size + 1)) == 0){
+     438:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     43b:	52                   	push   %edx
+     43c:	52                   	push   %edx
+     43d:	50                   	push   %eax
+     43e:	53                   	push   %ebx
+     43f:	e8 9c 06 00 00       	call   ae0 <fstat>
+     444:	83 c4 10             	add    $0x10,%esp
+     447:	85 c0                	test   %eax,%eax
+     449:	0f 88 c8 00 00 00    	js     517 <loadsyms+0x107>
+     44f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     452:	83 ec 0c             	sub    $0xc,%esp
+     455:	83 c0 01             	add    $0x1,%eax
+     458:	50                   	push   %eax
+     459:	e8 72 0a 00 00       	call   ed0 <malloc>
+     45e:	83 c4 10             	add    $0x10,%esp
+     461:	89 c1                	mov    %eax,%ecx
+     463:	85 c0                	test   %eax,%eax
+     465:	0f 84 ac 00 00 00    	je     517 <loadsyms+0x107>
+  n = read(fd, buf, st.size);
+     46b:	50                   	push   %eax
+     46c:	ff 75 e4             	push   -0x1c(%ebp)
+     46f:	51                   	push   %ecx
+     470:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     473:	53                   	push   %ebx
+     474:	e8 27 06 00 00       	call   aa0 <read>
+  close(fd);
+     479:	89 1c 24             	mov    %ebx,(%esp)
+  n = read(fd, buf, st.size);
+     47c:	89 c6                	mov    %eax,%esi
+  close(fd);
+     47e:	e8 2d 06 00 00       	call   ab0 <close>
+  if(n < 0)
+     483:	31 c0                	xor    %eax,%eax
+     485:	85 f6                	test   %esi,%esi
+  buf[n] = 0;
+     487:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  if(n < 0)
+     48a:	0f 48 f0             	cmovs  %eax,%esi
+  for(p = buf; *p; p++)
+     48d:	83 c4 10             	add    $0x10,%esp
+  buf[n] = 0;
+     490:	c6 04 31 00          	movb   $0x0,(%ecx,%esi,1)
+  for(p = buf; *p; p++)
+     494:	0f b6 01             	movzbl (%ecx),%eax
+     497:	84 c0                	test   %al,%al
+     499:	0f 84 87 01 00 00    	je     626 <loadsyms+0x216>
+     49f:	89 ca                	mov    %ecx,%edx
+  n = 0;
+     4a1:	31 db                	xor    %ebx,%ebx
+     4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4a7:	90                   	nop
+      n++;
+     4a8:	3c 0a                	cmp    $0xa,%al
+     4aa:	0f 94 c0             	sete   %al
+  for(p = buf; *p; p++)
+     4ad:	83 c2 01             	add    $0x1,%edx
+      n++;
+     4b0:	0f b6 c0             	movzbl %al,%eax
+     4b3:	01 c3                	add    %eax,%ebx
+  for(p = buf; *p; p++)
+     4b5:	0f b6 02             	movzbl (%edx),%eax
+     4b8:	84 c0                	test   %al,%al
+     4ba:	75 ec                	jne    4a8 <loadsyms+0x98>
+  t->s = malloc((n + 1) * sizeof(struct sym));
+     4bc:	8d 43 01             	lea    0x1(%ebx),%eax
+     4bf:	83 ec 0c             	sub    $0xc,%esp
+     4c2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     4c5:	6b c0 0c             	imul   $0xc,%eax,%eax
+     4c8:	50                   	push   %eax
+     4c9:	e8 02 0a 00 00       	call   ed0 <malloc>
+     4ce:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  for(p = buf; *p; ){
+     4d1:	83 c4 10             	add    $0x10,%esp
+  t->s = malloc((n + 1) * sizeof(struct sym));
+     4d4:	89 01                	mov    %eax,(%ecx)
+  for(p = buf; *p; ){
+     4d6:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     4d9:	0f be 01             	movsbl (%ecx),%eax
+     4dc:	89 cf                	mov    %ecx,%edi
+     4de:	84 c0                	test   %al,%al
+     4e0:	74 41                	je     523 <loadsyms+0x113>
+     4e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  n = 0;
+     4e8:	89 fe                	mov    %edi,%esi
+  v = 0;
+     4ea:	31 db                	xor    %ebx,%ebx
+     4ec:	eb 10                	jmp    4fe <loadsyms+0xee>
+     4ee:	66 90                	xchg   %ax,%ax
+      v = v*16 + c - '0';
+     4f0:	c1 e3 04             	shl    $0x4,%ebx
+     4f3:	8d 5c 03 d0          	lea    -0x30(%ebx,%eax,1),%ebx
+    while(*p && *p != '\n')
+     4f7:	0f be 46 01          	movsbl 0x1(%esi),%eax
+  for(;; (*p)++){
+     4fb:	83 c6 01             	add    $0x1,%esi
+    if(c >= '0' && c <= '9')
+     4fe:	8d 50 d0             	lea    -0x30(%eax),%edx
+     501:	80 fa 09             	cmp    $0x9,%dl
+     504:	76 ea                	jbe    4f0 <loadsyms+0xe0>
+    else if(c >= 'a' && c <= 'f')
+     506:	8d 50 9f             	lea    -0x61(%eax),%edx
+     509:	80 fa 05             	cmp    $0x5,%dl
+     50c:	77 22                	ja     530 <loadsyms+0x120>
+      v = v*16 + c - 'a' + 10;
+     50e:	c1 e3 04             	shl    $0x4,%ebx
+     511:	8d 5c 03 a9          	lea    -0x57(%ebx,%eax,1),%ebx
+     515:	eb e0                	jmp    4f7 <loadsyms+0xe7>
+    close(fd);
+     517:	83 ec 0c             	sub    $0xc,%esp
+     51a:	53                   	push   %ebx
+     51b:	e8 90 05 00 00       	call   ab0 <close>
+    return;
+     520:	83 c4 10             	add    $0x10,%esp
+}
+     523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     526:	5b                   	pop    %ebx
+     527:	5e                   	pop    %esi
+     528:	5f                   	pop    %edi
+     529:	5d                   	pop    %ebp
+     52a:	c3                   	ret
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+    if(*p == ' ')
+     530:	3c 20                	cmp    $0x20,%al
+     532:	75 07                	jne    53b <loadsyms+0x12b>
+    while(*p && *p != '\n')
+     534:	0f b6 46 01          	movzbl 0x1(%esi),%eax
+      p++;
+     538:	83 c6 01             	add    $0x1,%esi
+    while(*p && *p != '\n')
+     53b:	89 f7                	mov    %esi,%edi
+     53d:	84 c0                	test   %al,%al
+     53f:	75 12                	jne    553 <loadsyms+0x143>
+     541:	eb 14                	jmp    557 <loadsyms+0x147>
+     543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     547:	90                   	nop
+     548:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      p++;
+     54c:	83 c7 01             	add    $0x1,%edi
+    while(*p && *p != '\n')
+     54f:	84 c0                	test   %al,%al
+     551:	74 0e                	je     561 <loadsyms+0x151>
+     553:	3c 0a                	cmp    $0xa,%al
+     555:	75 f1                	jne    548 <loadsyms+0x138>
+    if(*p)
+     557:	84 c0                	test   %al,%al
+     559:	74 06                	je     561 <loadsyms+0x151>
+      *p++ = 0;
+     55b:	c6 07 00             	movb   $0x0,(%edi)
+     55e:	83 c7 01             	add    $0x1,%edi
+  n = strlen(name);
+     561:	83 ec 0c             	sub    $0xc,%esp
+     564:	56                   	push   %esi
+     565:	e8 a6 02 00 00       	call   810 <strlen>
+  if(name[0] == '.' || name[0] == 0)
+     56a:	0f b6 16             	movzbl (%esi),%edx
+     56d:	83 c4 10             	add    $0x10,%esp
+     570:	80 fa 2e             	cmp    $0x2e,%dl
+     573:	74 7a                	je     5ef <loadsyms+0x1df>
+     575:	84 d2                	test   %dl,%dl
+     577:	74 76                	je     5ef <loadsyms+0x1df>
+  return n > 2 && name[n-2] == '.' && (name[n-1] == 'c' || name[n-1] == 'S');
+     579:	83 f8 02             	cmp    $0x2,%eax
+     57c:	7e 0b                	jle    589 <loadsyms+0x179>
+     57e:	80 7c 06 fe 2e       	cmpb   $0x2e,-0x2(%esi,%eax,1)
+     583:	0f 84 85 00 00 00    	je     60e <loadsyms+0x1fe>
+    for(j = t->n; j > 0 && t->s[j-1].addr > v.addr; j--)
+     589:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     58c:	8b 48 04             	mov    0x4(%eax),%ecx
+     58f:	85 c9                	test   %ecx,%ecx
+     591:	0f 8e 88 00 00 00    	jle    61f <loadsyms+0x20f>
+     597:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     59a:	89 75 bc             	mov    %esi,-0x44(%ebp)
+     59d:	eb 16                	jmp    5b5 <loadsyms+0x1a5>
+     59f:	90                   	nop
+      t->s[j] = t->s[j-1];
+     5a0:	8b 32                	mov    (%edx),%esi
+     5a2:	89 30                	mov    %esi,(%eax)
+     5a4:	8b 72 04             	mov    0x4(%edx),%esi
+     5a7:	89 70 04             	mov    %esi,0x4(%eax)
+     5aa:	8b 52 08             	mov    0x8(%edx),%edx
+     5ad:	89 50 08             	mov    %edx,0x8(%eax)
+    for(j = t->n; j > 0 && t->s[j-1].addr > v.addr; j--)
+     5b0:	83 e9 01             	sub    $0x1,%ecx
+     5b3:	74 4a                	je     5ff <loadsyms+0x1ef>
+     5b5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     5b8:	8d 3c 09             	lea    (%ecx,%ecx,1),%edi
+     5bb:	8b 30                	mov    (%eax),%esi
+     5bd:	8d 04 0f             	lea    (%edi,%ecx,1),%eax
+     5c0:	c1 e0 02             	shl    $0x2,%eax
+     5c3:	8d 54 06 f4          	lea    -0xc(%esi,%eax,1),%edx
+      t->s[j] = t->s[j-1];
+     5c7:	01 f0                	add    %esi,%eax
+    for(j = t->n; j > 0 && t->s[j-1].addr > v.addr; j--)
+     5c9:	3b 1a                	cmp    (%edx),%ebx
+     5cb:	72 d3                	jb     5a0 <loadsyms+0x190>
+     5cd:	89 f8                	mov    %edi,%eax
+     5cf:	89 f2                	mov    %esi,%edx
+     5d1:	8b 7d c0             	mov    -0x40(%ebp),%edi
+     5d4:	8b 75 bc             	mov    -0x44(%ebp),%esi
+    t->s[j] = v;
+     5d7:	01 c8                	add    %ecx,%eax
+     5d9:	8d 04 82             	lea    (%edx,%eax,4),%eax
+     5dc:	89 70 04             	mov    %esi,0x4(%eax)
+     5df:	89 18                	mov    %ebx,(%eax)
+     5e1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    t->n++;
+     5e8:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     5eb:	83 40 04 01          	addl   $0x1,0x4(%eax)
+  for(p = buf; *p; ){
+     5ef:	0f be 07             	movsbl (%edi),%eax
+     5f2:	84 c0                	test   %al,%al
+     5f4:	0f 85 ee fe ff ff    	jne    4e8 <loadsyms+0xd8>
+     5fa:	e9 24 ff ff ff       	jmp    523 <loadsyms+0x113>
+     5ff:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     602:	8b 7d c0             	mov    -0x40(%ebp),%edi
+     605:	8b 75 bc             	mov    -0x44(%ebp),%esi
+     608:	8b 10                	mov    (%eax),%edx
+     60a:	31 c0                	xor    %eax,%eax
+     60c:	eb c9                	jmp    5d7 <loadsyms+0x1c7>
+  return n > 2 && name[n-2] == '.' && (name[n-1] == 'c' || name[n-1] == 'S');
+     60e:	0f b6 44 06 ff       	movzbl -0x1(%esi,%eax,1),%eax
+     613:	83 e8 53             	sub    $0x53,%eax
+     616:	a8 ef                	test   $0xef,%al
+     618:	74 d5                	je     5ef <loadsyms+0x1df>
+     61a:	e9 6a ff ff ff       	jmp    589 <loadsyms+0x179>
+     61f:	8b 10                	mov    (%eax),%edx
+     621:	8d 04 09             	lea    (%ecx,%ecx,1),%eax
+     624:	eb b1                	jmp    5d7 <loadsyms+0x1c7>
+  n = 0;
+     626:	31 db                	xor    %ebx,%ebx
+     628:	e9 8f fe ff ff       	jmp    4bc <loadsyms+0xac>
+     62d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000630 <lookup.isra.0>:
+  if(t->n == 0 || pc < t->s[0].addr)
+     630:	85 d2                	test   %edx,%edx
+     632:	74 4c                	je     680 <lookup.isra.0+0x50>
+lookup(struct symtab *t, uint pc)
+     634:	55                   	push   %ebp
+     635:	89 e5                	mov    %esp,%ebp
+     637:	57                   	push   %edi
+     638:	89 cf                	mov    %ecx,%edi
+     63a:	56                   	push   %esi
+     63b:	53                   	push   %ebx
+     63c:	89 c3                	mov    %eax,%ebx
+  if(t->n == 0 || pc < t->s[0].addr)
+     63e:	3b 08                	cmp    (%eax),%ecx
+     640:	72 46                	jb     688 <lookup.isra.0+0x58>
+  hi = t->n - 1;
+     642:	8d 72 ff             	lea    -0x1(%edx),%esi
+  lo = 0;
+     645:	31 d2                	xor    %edx,%edx
+     647:	eb 1b                	jmp    664 <lookup.isra.0+0x34>
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mid = (lo + hi + 1) / 2;
+     650:	8d 44 16 01          	lea    0x1(%esi,%edx,1),%eax
+     654:	89 c1                	mov    %eax,%ecx
+    if(t->s[mid].addr <= pc)
+     656:	83 e0 fe             	and    $0xfffffffe,%eax
+    mid = (lo + hi + 1) / 2;
+     659:	d1 f9                	sar    %ecx
+    if(t->s[mid].addr <= pc)
+     65b:	01 c8                	add    %ecx,%eax
+     65d:	3b 3c 83             	cmp    (%ebx,%eax,4),%edi
+     660:	72 16                	jb     678 <lookup.isra.0+0x48>
+    mid = (lo + hi + 1) / 2;
+     662:	89 ca                	mov    %ecx,%edx
+  while(lo < hi){
+     664:	39 f2                	cmp    %esi,%edx
+     666:	7c e8                	jl     650 <lookup.isra.0+0x20>
+  return &t->s[lo];
+     668:	8d 04 52             	lea    (%edx,%edx,2),%eax
+     66b:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+}
+     66e:	5b                   	pop    %ebx
+     66f:	5e                   	pop    %esi
+     670:	5f                   	pop    %edi
+     671:	5d                   	pop    %ebp
+     672:	c3                   	ret
+     673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     677:	90                   	nop
+      hi = mid - 1;
+     678:	8d 71 ff             	lea    -0x1(%ecx),%esi
+     67b:	eb e7                	jmp    664 <lookup.isra.0+0x34>
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+     680:	31 c0                	xor    %eax,%eax
+}
+     682:	c3                   	ret
+     683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     687:	90                   	nop
+     688:	5b                   	pop    %ebx
+    return 0;
+     689:	31 c0                	xor    %eax,%eax
+}
+     68b:	5e                   	pop    %esi
+     68c:	5f                   	pop    %edi
+     68d:	5d                   	pop    %ebp
+     68e:	c3                   	ret
+     68f:	90                   	nop
+
+00000690 <drain>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	83 ec 1c             	sub    $0x1c,%esp
+     699:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while((n = profread(buf, CHUNK)) > 0)
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6a0:	83 ec 08             	sub    $0x8,%esp
+     6a3:	68 00 02 00 00       	push   $0x200
+     6a8:	68 c0 18 00 00       	push   $0x18c0
+     6ad:	e8 b6 04 00 00       	call   b68 <profread>
+     6b2:	83 c4 10             	add    $0x10,%esp
+     6b5:	89 c7                	mov    %eax,%edi
+     6b7:	85 c0                	test   %eax,%eax
+     6b9:	0f 8e b1 00 00 00    	jle    770 <drain+0xe0>
+     6bf:	a1 dc 38 00 00       	mov    0x38dc,%eax
+     6c4:	bb c0 18 00 00       	mov    $0x18c0,%ebx
+    for(i = 0; i < n; i++)
+     6c9:	31 f6                	xor    %esi,%esi
+     6cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     6ce:	a1 e0 38 00 00       	mov    0x38e0,%eax
+     6d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     6d6:	eb 32                	jmp    70a <drain+0x7a>
+     6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+    if(s->pid == 0)
+     6e0:	85 d2                	test   %edx,%edx
+     6e2:	75 07                	jne    6eb <drain+0x5b>
+      nidle++;
+     6e4:	83 05 c8 38 00 00 01 	addl   $0x1,0x38c8
+    if((sym = lookup(&ktab, s->eip)) != 0)
+     6eb:	8b 0b                	mov    (%ebx),%ecx
+     6ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     6f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6f3:	e8 38 ff ff ff       	call   630 <lookup.isra.0>
+     6f8:	85 c0                	test   %eax,%eax
+     6fa:	74 64                	je     760 <drain+0xd0>
+      sym->hits++;
+     6fc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+    for(i = 0; i < n; i++)
+     700:	83 c6 01             	add    $0x1,%esi
+     703:	83 c3 10             	add    $0x10,%ebx
+     706:	39 f7                	cmp    %esi,%edi
+     708:	74 96                	je     6a0 <drain+0x10>
+  if(s->mode == PS_LOST){
+     70a:	8b 43 08             	mov    0x8(%ebx),%eax
+     70d:	83 f8 02             	cmp    $0x2,%eax
+     710:	74 1e                	je     730 <drain+0xa0>
+  nsamples++;
+     712:	83 05 d0 38 00 00 01 	addl   $0x1,0x38d0
+    if(s->pid == 0)
+     719:	8b 53 04             	mov    0x4(%ebx),%edx
+  if(s->mode == PS_KERNEL){
+     71c:	85 c0                	test   %eax,%eax
+     71e:	74 c0                	je     6e0 <drain+0x50>
+  } else if(s->pid == cpid){
+     720:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     723:	39 c2                	cmp    %eax,%edx
+     725:	74 19                	je     740 <drain+0xb0>
+    nother++;
+     727:	83 05 c4 38 00 00 01 	addl   $0x1,0x38c4
+     72e:	eb d0                	jmp    700 <drain+0x70>
+    nlost += s->eip;
+     730:	8b 03                	mov    (%ebx),%eax
+     732:	01 05 cc 38 00 00    	add    %eax,0x38cc
+    return;
+     738:	eb c6                	jmp    700 <drain+0x70>
+     73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((sym = lookup(&utab, s->eip)) != 0)
+     740:	8b 0b                	mov    (%ebx),%ecx
+     742:	8b 15 d8 38 00 00    	mov    0x38d8,%edx
+     748:	a1 d4 38 00 00       	mov    0x38d4,%eax
+     74d:	e8 de fe ff ff       	call   630 <lookup.isra.0>
+     752:	85 c0                	test   %eax,%eax
+     754:	75 a6                	jne    6fc <drain+0x6c>
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+      nunknown++;
+     760:	83 05 c0 38 00 00 01 	addl   $0x1,0x38c0
+     767:	eb 97                	jmp    700 <drain+0x70>
+     769:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+     770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     773:	5b                   	pop    %ebx
+     774:	5e                   	pop    %esi
+     775:	5f                   	pop    %edi
+     776:	5d                   	pop    %ebp
+     777:	c3                   	ret
+     778:	66 90                	xchg   %ax,%ax
+     77a:	66 90                	xchg   %ax,%ax
+     77c:	66 90                	xchg   %ax,%ax
+     77e:	66 90                	xchg   %ax,%ax
+
+00000780 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     780:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     781:	31 c0                	xor    %eax,%eax
+{
+     783:	89 e5                	mov    %esp,%ebp
+     785:	53                   	push   %ebx
+     786:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     789:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     790:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     794:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     797:	83 c0 01             	add    $0x1,%eax
+     79a:	84 d2                	test   %dl,%dl
+     79c:	75 f2                	jne    790 <strcpy+0x10>
+    ;
+  return os;
+}
+     79e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a1:	89 c8                	mov    %ecx,%eax
+     7a3:	c9                   	leave
+     7a4:	c3                   	ret
+     7a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	53                   	push   %ebx
+     7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+     7b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     7ba:	0f b6 02             	movzbl (%edx),%eax
+     7bd:	84 c0                	test   %al,%al
+     7bf:	75 17                	jne    7d8 <strcmp+0x28>
+     7c1:	eb 3a                	jmp    7fd <strcmp+0x4d>
+     7c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7c7:	90                   	nop
+     7c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     7cc:	83 c2 01             	add    $0x1,%edx
+     7cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     7d2:	84 c0                	test   %al,%al
+     7d4:	74 1a                	je     7f0 <strcmp+0x40>
+    p++, q++;
+     7d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     7d8:	0f b6 19             	movzbl (%ecx),%ebx
+     7db:	38 c3                	cmp    %al,%bl
+     7dd:	74 e9                	je     7c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     7df:	29 d8                	sub    %ebx,%eax
+}
+     7e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7e4:	c9                   	leave
+     7e5:	c3                   	ret
+     7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     7f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     7f4:	31 c0                	xor    %eax,%eax
+     7f6:	29 d8                	sub    %ebx,%eax
+}
+     7f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7fb:	c9                   	leave
+     7fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     7fd:	0f b6 19             	movzbl (%ecx),%ebx
+     800:	31 c0                	xor    %eax,%eax
+     802:	eb db                	jmp    7df <strcmp+0x2f>
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     816:	80 3a 00             	cmpb   $0x0,(%edx)
+     819:	74 15                	je     830 <strlen+0x20>
+     81b:	31 c0                	xor    %eax,%eax
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+     820:	83 c0 01             	add    $0x1,%eax
+     823:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     827:	89 c1                	mov    %eax,%ecx
+     829:	75 f5                	jne    820 <strlen+0x10>
+    ;
+  return n;
+}
+     82b:	89 c8                	mov    %ecx,%eax
+     82d:	5d                   	pop    %ebp
+     82e:	c3                   	ret
+     82f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     830:	31 c9                	xor    %ecx,%ecx
+}
+     832:	5d                   	pop    %ebp
+     833:	89 c8                	mov    %ecx,%eax
+     835:	c3                   	ret
+     836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	57                   	push   %edi
+     844:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     847:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     84a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     84d:	89 d7                	mov    %edx,%edi
+     84f:	fc                   	cld
+     850:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     852:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     855:	89 d0                	mov    %edx,%eax
+     857:	c9                   	leave
+     858:	c3                   	ret
+     859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	8b 45 08             	mov    0x8(%ebp),%eax
+     866:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     86a:	0f b6 10             	movzbl (%eax),%edx
+     86d:	84 d2                	test   %dl,%dl
+     86f:	75 12                	jne    883 <strchr+0x23>
+     871:	eb 1d                	jmp    890 <strchr+0x30>
+     873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     877:	90                   	nop
+     878:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     87c:	83 c0 01             	add    $0x1,%eax
+     87f:	84 d2                	test   %dl,%dl
+     881:	74 0d                	je     890 <strchr+0x30>
+    if(*s == c)
+     883:	38 d1                	cmp    %dl,%cl
+     885:	75 f1                	jne    878 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     887:	5d                   	pop    %ebp
+     888:	c3                   	ret
+     889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     890:	31 c0                	xor    %eax,%eax
+}
+     892:	5d                   	pop    %ebp
+     893:	c3                   	ret
+     894:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     89f:	90                   	nop
+
+000008a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     8a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     8a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     8a9:	31 db                	xor    %ebx,%ebx
+{
+     8ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     8ae:	eb 27                	jmp    8d7 <gets+0x37>
+    cc = read(0, &c, 1);
+     8b0:	83 ec 04             	sub    $0x4,%esp
+     8b3:	6a 01                	push   $0x1
+     8b5:	56                   	push   %esi
+     8b6:	6a 00                	push   $0x0
+     8b8:	e8 e3 01 00 00       	call   aa0 <read>
+    if(cc < 1)
+     8bd:	83 c4 10             	add    $0x10,%esp
+     8c0:	85 c0                	test   %eax,%eax
+     8c2:	7e 1d                	jle    8e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     8c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     8c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     8cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     8cf:	3c 0a                	cmp    $0xa,%al
+     8d1:	74 10                	je     8e3 <gets+0x43>
+     8d3:	3c 0d                	cmp    $0xd,%al
+     8d5:	74 0c                	je     8e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     8d7:	89 df                	mov    %ebx,%edi
+     8d9:	83 c3 01             	add    $0x1,%ebx
+     8dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     8df:	7c cf                	jl     8b0 <gets+0x10>
+     8e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     8e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     8ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8ed:	5b                   	pop    %ebx
+     8ee:	5e                   	pop    %esi
+     8ef:	5f                   	pop    %edi
+     8f0:	5d                   	pop    %ebp
+     8f1:	c3                   	ret
+     8f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	56                   	push   %esi
+     904:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     905:	83 ec 08             	sub    $0x8,%esp
+     908:	6a 00                	push   $0x0
+     90a:	ff 75 08             	push   0x8(%ebp)
+     90d:	e8 b6 01 00 00       	call   ac8 <open>
+  if(fd < 0)
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	78 27                	js     940 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     919:	83 ec 08             	sub    $0x8,%esp
+     91c:	ff 75 0c             	push   0xc(%ebp)
+     91f:	89 c3                	mov    %eax,%ebx
+     921:	50                   	push   %eax
+     922:	e8 b9 01 00 00       	call   ae0 <fstat>
+  close(fd);
+     927:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     92a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     92c:	e8 7f 01 00 00       	call   ab0 <close>
+  return r;
+     931:	83 c4 10             	add    $0x10,%esp
+}
+     934:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     937:	89 f0                	mov    %esi,%eax
+     939:	5b                   	pop    %ebx
+     93a:	5e                   	pop    %esi
+     93b:	5d                   	pop    %ebp
+     93c:	c3                   	ret
+     93d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     940:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     945:	eb ed                	jmp    934 <stat+0x34>
+     947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94e:	66 90                	xchg   %ax,%ax
+
+00000950 <atoi>:
+
+int
+atoi(const char *s)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	53                   	push   %ebx
+     954:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     957:	0f be 02             	movsbl (%edx),%eax
+     95a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     95d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     960:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     965:	77 1e                	ja     985 <atoi+0x35>
+     967:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     970:	83 c2 01             	add    $0x1,%edx
+     973:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     976:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     97a:	0f be 02             	movsbl (%edx),%eax
+     97d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     980:	80 fb 09             	cmp    $0x9,%bl
+     983:	76 eb                	jbe    970 <atoi+0x20>
+  return n;
+}
+     985:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     988:	89 c8                	mov    %ecx,%eax
+     98a:	c9                   	leave
+     98b:	c3                   	ret
+     98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	8b 45 10             	mov    0x10(%ebp),%eax
+     998:	8b 55 08             	mov    0x8(%ebp),%edx
+     99b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     99e:	85 c0                	test   %eax,%eax
+     9a0:	7e 13                	jle    9b5 <memmove+0x25>
+     9a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9a4:	89 d7                	mov    %edx,%edi
+     9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9b1:	39 f8                	cmp    %edi,%eax
+     9b3:	75 fb                	jne    9b0 <memmove+0x20>
+  return vdst;
+}
+     9b5:	5e                   	pop    %esi
+     9b6:	89 d0                	mov    %edx,%eax
+     9b8:	5f                   	pop    %edi
+     9b9:	5d                   	pop    %ebp
+     9ba:	c3                   	ret
+     9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+
+000009c0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	31 d2                	xor    %edx,%edx
+     9c3:	89 e5                	mov    %esp,%ebp
+     9c5:	53                   	push   %ebx
+     9c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     9c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+     9cc:	f7 f3                	div    %ebx
+     9ce:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     9d0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+     9d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+     9d8:	89 ca                	mov    %ecx,%edx
+}
+     9da:	c9                   	leave
+     9db:	c3                   	ret
+     9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+     9e0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+     9e2:	c3                   	ret
+     9e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009f0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	57                   	push   %edi
+     9f4:	56                   	push   %esi
+     9f5:	53                   	push   %ebx
+     9f6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+     9f9:	8b 35 e4 38 00 00    	mov    0x38e4,%esi
+{
+     9ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a02:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+     a05:	85 f6                	test   %esi,%esi
+     a07:	74 2f                	je     a38 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+     a09:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+     a0e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+     a14:	f7 e3                	mul    %ebx
+     a16:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     a19:	8d 04 17             	lea    (%edi,%edx,1),%eax
+     a1c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     a1f:	31 d2                	xor    %edx,%edx
+     a21:	f7 f6                	div    %esi
+     a23:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     a25:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+     a28:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     a2b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+     a2d:	89 da                	mov    %ebx,%edx
+}
+     a2f:	5b                   	pop    %ebx
+     a30:	5e                   	pop    %esi
+     a31:	5f                   	pop    %edi
+     a32:	5d                   	pop    %ebp
+     a33:	c3                   	ret
+     a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+     a38:	e8 0b 01 00 00       	call   b48 <tscfreq>
+     a3d:	a3 e4 38 00 00       	mov    %eax,0x38e4
+     a42:	89 c6                	mov    %eax,%esi
+     a44:	eb c3                	jmp    a09 <cyc2ns+0x19>
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	53                   	push   %ebx
+     a54:	83 ec 10             	sub    $0x10,%esp
+     a57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+     a5a:	6a 00                	push   $0x0
+     a5c:	e8 3f 01 00 00       	call   ba0 <getpriority>
+     a61:	5a                   	pop    %edx
+     a62:	59                   	pop    %ecx
+     a63:	01 d8                	add    %ebx,%eax
+     a65:	50                   	push   %eax
+     a66:	6a 00                	push   $0x0
+     a68:	e8 2b 01 00 00       	call   b98 <setpriority>
+  return getpriority(0);
+     a6d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+     a74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+     a77:	83 c4 10             	add    $0x10,%esp
+}
+     a7a:	c9                   	leave
+  return getpriority(0);
+     a7b:	e9 20 01 00 00       	jmp    ba0 <getpriority>
+
+00000a80 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     a80:	b8 01 00 00 00       	mov    $0x1,%eax
+     a85:	cd 40                	int    $0x40
+     a87:	c3                   	ret
+
+00000a88 <exit>:
+SYSCALL(exit)
+     a88:	b8 02 00 00 00       	mov    $0x2,%eax
+     a8d:	cd 40                	int    $0x40
+     a8f:	c3                   	ret
+
+00000a90 <wait>:
+SYSCALL(wait)
+     a90:	b8 03 00 00 00       	mov    $0x3,%eax
+     a95:	cd 40                	int    $0x40
+     a97:	c3                   	ret
+
+00000a98 <pipe>:
+SYSCALL(pipe)
+     a98:	b8 04 00 00 00       	mov    $0x4,%eax
+     a9d:	cd 40                	int    $0x40
+     a9f:	c3                   	ret
+
+00000aa0 <read>:
+SYSCALL(read)
+     aa0:	b8 05 00 00 00       	mov    $0x5,%eax
+     aa5:	cd 40                	int    $0x40
+     aa7:	c3                   	ret
+
+00000aa8 <write>:
+SYSCALL(write)
+     aa8:	b8 10 00 00 00       	mov    $0x10,%eax
+     aad:	cd 40                	int    $0x40
+     aaf:	c3                   	ret
+
+00000ab0 <close>:
+SYSCALL(close)
+     ab0:	b8 15 00 00 00       	mov    $0x15,%eax
+     ab5:	cd 40                	int    $0x40
+     ab7:	c3                   	ret
+
+00000ab8 <kill>:
+SYSCALL(kill)
+     ab8:	b8 06 00 00 00       	mov    $0x6,%eax
+     abd:	cd 40                	int    $0x40
+     abf:	c3                   	ret
+
+00000ac0 <exec>:
+SYSCALL(exec)
+     ac0:	b8 07 00 00 00       	mov    $0x7,%eax
+     ac5:	cd 40                	int    $0x40
+     ac7:	c3                   	ret
+
+00000ac8 <open>:
+SYSCALL(open)
+     ac8:	b8 0f 00 00 00       	mov    $0xf,%eax
+     acd:	cd 40                	int    $0x40
+     acf:	c3                   	ret
+
+00000ad0 <mknod>:
+SYSCALL(mknod)
+     ad0:	b8 11 00 00 00       	mov    $0x11,%eax
+     ad5:	cd 40                	int    $0x40
+     ad7:	c3                   	ret
+
+00000ad8 <unlink>:
+SYSCALL(unlink)
+     ad8:	b8 12 00 00 00       	mov    $0x12,%eax
+     add:	cd 40                	int    $0x40
+     adf:	c3                   	ret
+
+00000ae0 <fstat>:
+SYSCALL(fstat)
+     ae0:	b8 08 00 00 00       	mov    $0x8,%eax
+     ae5:	cd 40                	int    $0x40
+     ae7:	c3                   	ret
+
+00000ae8 <link>:
+SYSCALL(link)
+     ae8:	b8 13 00 00 00       	mov    $0x13,%eax
+     aed:	cd 40                	int    $0x40
+     aef:	c3                   	ret
+
+00000af0 <mkdir>:
+SYSCALL(mkdir)
+     af0:	b8 14 00 00 00       	mov    $0x14,%eax
+     af5:	cd 40                	int    $0x40
+     af7:	c3                   	ret
+
+00000af8 <chdir>:
+SYSCALL(chdir)
+     af8:	b8 09 00 00 00       	mov    $0x9,%eax
+     afd:	cd 40                	int    $0x40
+     aff:	c3                   	ret
+
+00000b00 <dup>:
+SYSCALL(dup)
+     b00:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b05:	cd 40                	int    $0x40
+     b07:	c3                   	ret
+
+00000b08 <getpid>:
+SYSCALL(getpid)
+     b08:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b0d:	cd 40                	int    $0x40
+     b0f:	c3                   	ret
+
+00000b10 <sbrk>:
+SYSCALL(sbrk)
+     b10:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b15:	cd 40                	int    $0x40
+     b17:	c3                   	ret
+
+00000b18 <sleep>:
+SYSCALL(sleep)
+     b18:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b1d:	cd 40                	int    $0x40
+     b1f:	c3                   	ret
+
+00000b20 <uptime>:
+SYSCALL(uptime)
+     b20:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b25:	cd 40                	int    $0x40
+     b27:	c3                   	ret
+
+00000b28 <promote>:
+
+SYSCALL(promote)
+     b28:	b8 18 00 00 00       	mov    $0x18,%eax
+     b2d:	cd 40                	int    $0x40
+     b2f:	c3                   	ret
+
+00000b30 <demote>:
+SYSCALL(demote)
+     b30:	b8 19 00 00 00       	mov    $0x19,%eax
+     b35:	cd 40                	int    $0x40
+     b37:	c3                   	ret
+
+00000b38 <huge_page_count>:
+SYSCALL(huge_page_count)
+     b38:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b3d:	cd 40                	int    $0x40
+     b3f:	c3                   	ret
+
+00000b40 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+     b40:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b45:	cd 40                	int    $0x40
+     b47:	c3                   	ret
+
+00000b48 <tscfreq>:
+SYSCALL(tscfreq)
+     b48:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b4d:	cd 40                	int    $0x40
+     b4f:	c3                   	ret
+
+00000b50 <tracemask>:
+SYSCALL(tracemask)
+     b50:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b55:	cd 40                	int    $0x40
+     b57:	c3                   	ret
+
+00000b58 <traceread>:
+SYSCALL(traceread)
+     b58:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b5d:	cd 40                	int    $0x40
+     b5f:	c3                   	ret
+
+00000b60 <profile>:
+SYSCALL(profile)
+     b60:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b65:	cd 40                	int    $0x40
+     b67:	c3                   	ret
+
+00000b68 <profread>:
+SYSCALL(profread)
+     b68:	b8 20 00 00 00       	mov    $0x20,%eax
+     b6d:	cd 40                	int    $0x40
+     b6f:	c3                   	ret
+
+00000b70 <lockstat>:
+SYSCALL(lockstat)
+     b70:	b8 21 00 00 00       	mov    $0x21,%eax
+     b75:	cd 40                	int    $0x40
+     b77:	c3                   	ret
+
+00000b78 <lockstatreset>:
+SYSCALL(lockstatreset)
+     b78:	b8 22 00 00 00       	mov    $0x22,%eax
+     b7d:	cd 40                	int    $0x40
+     b7f:	c3                   	ret
+
+00000b80 <sysstat>:
+SYSCALL(sysstat)
+     b80:	b8 23 00 00 00       	mov    $0x23,%eax
+     b85:	cd 40                	int    $0x40
+     b87:	c3                   	ret
+
+00000b88 <kbench>:
+SYSCALL(kbench)
+     b88:	b8 24 00 00 00       	mov    $0x24,%eax
+     b8d:	cd 40                	int    $0x40
+     b8f:	c3                   	ret
+
+00000b90 <yield>:
+SYSCALL(yield)
+     b90:	b8 25 00 00 00       	mov    $0x25,%eax
+     b95:	cd 40                	int    $0x40
+     b97:	c3                   	ret
+
+00000b98 <setpriority>:
+SYSCALL(setpriority)
+     b98:	b8 26 00 00 00       	mov    $0x26,%eax
+     b9d:	cd 40                	int    $0x40
+     b9f:	c3                   	ret
+
+00000ba0 <getpriority>:
+SYSCALL(getpriority)
+     ba0:	b8 27 00 00 00       	mov    $0x27,%eax
+     ba5:	cd 40                	int    $0x40
+     ba7:	c3                   	ret
+
+00000ba8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     ba8:	b8 28 00 00 00       	mov    $0x28,%eax
+     bad:	cd 40                	int    $0x40
+     baf:	c3                   	ret
+
+00000bb0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     bb0:	b8 29 00 00 00       	mov    $0x29,%eax
+     bb5:	cd 40                	int    $0x40
+     bb7:	c3                   	ret
+
+00000bb8 <clone>:
+SYSCALL(clone)
+     bb8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     bbd:	cd 40                	int    $0x40
+     bbf:	c3                   	ret
+
+00000bc0 <join>:
+SYSCALL(join)
+     bc0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     bc5:	cd 40                	int    $0x40
+     bc7:	c3                   	ret
+
+00000bc8 <futex_wait>:
+SYSCALL(futex_wait)
+     bc8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bcd:	cd 40                	int    $0x40
+     bcf:	c3                   	ret
+
+00000bd0 <futex_wake>:
+SYSCALL(futex_wake)
+     bd0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bd5:	cd 40                	int    $0x40
+     bd7:	c3                   	ret
+
+00000bd8 <spawn>:
+SYSCALL(spawn)
+     bd8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bdd:	cd 40                	int    $0x40
+     bdf:	c3                   	ret
+
+00000be0 <diskstat>:
+SYSCALL(diskstat)
+     be0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     be5:	cd 40                	int    $0x40
+     be7:	c3                   	ret
+     be8:	66 90                	xchg   %ax,%ax
+     bea:	66 90                	xchg   %ax,%ax
+     bec:	66 90                	xchg   %ax,%ax
+     bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     bf8:	89 d1                	mov    %edx,%ecx
+{
+     bfa:	83 ec 3c             	sub    $0x3c,%esp
+     bfd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c00:	85 d2                	test   %edx,%edx
+     c02:	0f 89 80 00 00 00    	jns    c88 <printint+0x98>
+     c08:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c0c:	74 7a                	je     c88 <printint+0x98>
+    x = -xx;
+     c0e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c10:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c15:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c18:	31 f6                	xor    %esi,%esi
+     c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c20:	89 c8                	mov    %ecx,%eax
+     c22:	31 d2                	xor    %edx,%edx
+     c24:	89 f7                	mov    %esi,%edi
+     c26:	f7 f3                	div    %ebx
+     c28:	8d 76 01             	lea    0x1(%esi),%esi
+     c2b:	0f b6 92 20 14 00 00 	movzbl 0x1420(%edx),%edx
+     c32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c36:	89 ca                	mov    %ecx,%edx
+     c38:	89 c1                	mov    %eax,%ecx
+     c3a:	39 da                	cmp    %ebx,%edx
+     c3c:	73 e2                	jae    c20 <printint+0x30>
+  if(neg)
+     c3e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c41:	85 c0                	test   %eax,%eax
+     c43:	74 07                	je     c4c <printint+0x5c>
+    buf[i++] = '-';
+     c45:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c4a:	89 f7                	mov    %esi,%edi
+     c4c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c4f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c52:	01 df                	add    %ebx,%edi
+     c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     c58:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     c5b:	83 ec 04             	sub    $0x4,%esp
+     c5e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     c61:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     c64:	6a 01                	push   $0x1
+     c66:	50                   	push   %eax
+     c67:	56                   	push   %esi
+     c68:	e8 3b fe ff ff       	call   aa8 <write>
+  while(--i >= 0)
+     c6d:	89 f8                	mov    %edi,%eax
+     c6f:	83 c4 10             	add    $0x10,%esp
+     c72:	83 ef 01             	sub    $0x1,%edi
+     c75:	39 d8                	cmp    %ebx,%eax
+     c77:	75 df                	jne    c58 <printint+0x68>
+}
+     c79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c7c:	5b                   	pop    %ebx
+     c7d:	5e                   	pop    %esi
+     c7e:	5f                   	pop    %edi
+     c7f:	5d                   	pop    %ebp
+     c80:	c3                   	ret
+     c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     c88:	31 c0                	xor    %eax,%eax
+     c8a:	eb 89                	jmp    c15 <printint+0x25>
+     c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	56                   	push   %esi
+     c95:	53                   	push   %ebx
+     c96:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     c99:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     c9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     c9f:	0f b6 1e             	movzbl (%esi),%ebx
+     ca2:	83 c6 01             	add    $0x1,%esi
+     ca5:	84 db                	test   %bl,%bl
+     ca7:	74 67                	je     d10 <printf+0x80>
+     ca9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cac:	31 d2                	xor    %edx,%edx
+     cae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     cb1:	eb 34                	jmp    ce7 <printf+0x57>
+     cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cb7:	90                   	nop
+     cb8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     cbb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     cc0:	83 f8 25             	cmp    $0x25,%eax
+     cc3:	74 18                	je     cdd <printf+0x4d>
+  write(fd, &c, 1);
+     cc5:	83 ec 04             	sub    $0x4,%esp
+     cc8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     ccb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     cce:	6a 01                	push   $0x1
+     cd0:	50                   	push   %eax
+     cd1:	57                   	push   %edi
+     cd2:	e8 d1 fd ff ff       	call   aa8 <write>
+     cd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     cda:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     cdd:	0f b6 1e             	movzbl (%esi),%ebx
+     ce0:	83 c6 01             	add    $0x1,%esi
+     ce3:	84 db                	test   %bl,%bl
+     ce5:	74 29                	je     d10 <printf+0x80>
+    c = fmt[i] & 0xff;
+     ce7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     cea:	85 d2                	test   %edx,%edx
+     cec:	74 ca                	je     cb8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     cee:	83 fa 25             	cmp    $0x25,%edx
+     cf1:	75 ea                	jne    cdd <printf+0x4d>
+      if(c == 'd'){
+     cf3:	83 f8 25             	cmp    $0x25,%eax
+     cf6:	0f 84 24 01 00 00    	je     e20 <printf+0x190>
+     cfc:	83 e8 63             	sub    $0x63,%eax
+     cff:	83 f8 15             	cmp    $0x15,%eax
+     d02:	77 1c                	ja     d20 <printf+0x90>
+     d04:	ff 24 85 c8 13 00 00 	jmp    *0x13c8(,%eax,4)
+     d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d13:	5b                   	pop    %ebx
+     d14:	5e                   	pop    %esi
+     d15:	5f                   	pop    %edi
+     d16:	5d                   	pop    %ebp
+     d17:	c3                   	ret
+     d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+  write(fd, &c, 1);
+     d20:	83 ec 04             	sub    $0x4,%esp
+     d23:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d26:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d2a:	6a 01                	push   $0x1
+     d2c:	52                   	push   %edx
+     d2d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d30:	57                   	push   %edi
+     d31:	e8 72 fd ff ff       	call   aa8 <write>
+     d36:	83 c4 0c             	add    $0xc,%esp
+     d39:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d3c:	6a 01                	push   $0x1
+     d3e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     d41:	52                   	push   %edx
+     d42:	57                   	push   %edi
+     d43:	e8 60 fd ff ff       	call   aa8 <write>
+        putc(fd, c);
+     d48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d4b:	31 d2                	xor    %edx,%edx
+     d4d:	eb 8e                	jmp    cdd <printf+0x4d>
+     d4f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     d50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     d53:	83 ec 0c             	sub    $0xc,%esp
+     d56:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d5b:	8b 13                	mov    (%ebx),%edx
+     d5d:	6a 00                	push   $0x0
+     d5f:	89 f8                	mov    %edi,%eax
+        ap++;
+     d61:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     d64:	e8 87 fe ff ff       	call   bf0 <printint>
+        ap++;
+     d69:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     d6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d6f:	31 d2                	xor    %edx,%edx
+     d71:	e9 67 ff ff ff       	jmp    cdd <printf+0x4d>
+     d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     d80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     d83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     d85:	83 c0 04             	add    $0x4,%eax
+     d88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     d8b:	85 db                	test   %ebx,%ebx
+     d8d:	0f 84 9d 00 00 00    	je     e30 <printf+0x1a0>
+        while(*s != 0){
+     d93:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     d96:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     d98:	84 c0                	test   %al,%al
+     d9a:	0f 84 3d ff ff ff    	je     cdd <printf+0x4d>
+     da0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     da3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     da6:	89 de                	mov    %ebx,%esi
+     da8:	89 d3                	mov    %edx,%ebx
+     daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     db0:	83 ec 04             	sub    $0x4,%esp
+     db3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     db6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     db9:	6a 01                	push   $0x1
+     dbb:	53                   	push   %ebx
+     dbc:	57                   	push   %edi
+     dbd:	e8 e6 fc ff ff       	call   aa8 <write>
+        while(*s != 0){
+     dc2:	0f b6 06             	movzbl (%esi),%eax
+     dc5:	83 c4 10             	add    $0x10,%esp
+     dc8:	84 c0                	test   %al,%al
+     dca:	75 e4                	jne    db0 <printf+0x120>
+      state = 0;
+     dcc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     dcf:	31 d2                	xor    %edx,%edx
+     dd1:	e9 07 ff ff ff       	jmp    cdd <printf+0x4d>
+     dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     de0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     de3:	83 ec 0c             	sub    $0xc,%esp
+     de6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     deb:	8b 13                	mov    (%ebx),%edx
+     ded:	6a 01                	push   $0x1
+     def:	e9 6b ff ff ff       	jmp    d5f <printf+0xcf>
+     df4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     df8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     dfb:	83 ec 04             	sub    $0x4,%esp
+     dfe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     e01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     e03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     e06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e09:	6a 01                	push   $0x1
+     e0b:	52                   	push   %edx
+     e0c:	57                   	push   %edi
+     e0d:	e8 96 fc ff ff       	call   aa8 <write>
+        ap++;
+     e12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e18:	31 d2                	xor    %edx,%edx
+     e1a:	e9 be fe ff ff       	jmp    cdd <printf+0x4d>
+     e1f:	90                   	nop
+  write(fd, &c, 1);
+     e20:	83 ec 04             	sub    $0x4,%esp
+     e23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e29:	6a 01                	push   $0x1
+     e2b:	e9 11 ff ff ff       	jmp    d41 <printf+0xb1>
+     e30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e35:	bb c0 13 00 00       	mov    $0x13c0,%ebx
+     e3a:	e9 61 ff ff ff       	jmp    da0 <printf+0x110>
+     e3f:	90                   	nop
+
+00000e40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e41:	a1 e8 38 00 00       	mov    0x38e8,%eax
+{
+     e46:	89 e5                	mov    %esp,%ebp
+     e48:	57                   	push   %edi
+     e49:	56                   	push   %esi
+     e4a:	53                   	push   %ebx
+     e4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     e4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e5c:	39 ca                	cmp    %ecx,%edx
+     e5e:	73 30                	jae    e90 <free+0x50>
+     e60:	39 c1                	cmp    %eax,%ecx
+     e62:	72 04                	jb     e68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e64:	39 c2                	cmp    %eax,%edx
+     e66:	72 f0                	jb     e58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     e6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     e6e:	39 f8                	cmp    %edi,%eax
+     e70:	74 2e                	je     ea0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     e75:	8b 42 04             	mov    0x4(%edx),%eax
+     e78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     e7b:	39 f1                	cmp    %esi,%ecx
+     e7d:	74 38                	je     eb7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     e7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     e81:	5b                   	pop    %ebx
+  freep = p;
+     e82:	89 15 e8 38 00 00    	mov    %edx,0x38e8
+}
+     e88:	5e                   	pop    %esi
+     e89:	5f                   	pop    %edi
+     e8a:	5d                   	pop    %ebp
+     e8b:	c3                   	ret
+     e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e90:	39 c1                	cmp    %eax,%ecx
+     e92:	72 d0                	jb     e64 <free+0x24>
+     e94:	eb c2                	jmp    e58 <free+0x18>
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     ea0:	03 70 04             	add    0x4(%eax),%esi
+     ea3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ea6:	8b 02                	mov    (%edx),%eax
+     ea8:	8b 00                	mov    (%eax),%eax
+     eaa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     ead:	8b 42 04             	mov    0x4(%edx),%eax
+     eb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     eb3:	39 f1                	cmp    %esi,%ecx
+     eb5:	75 c8                	jne    e7f <free+0x3f>
+    p->s.size += bp->s.size;
+     eb7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     eba:	89 15 e8 38 00 00    	mov    %edx,0x38e8
+    p->s.size += bp->s.size;
+     ec0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ec3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ec6:	89 0a                	mov    %ecx,(%edx)
+}
+     ec8:	5b                   	pop    %ebx
+     ec9:	5e                   	pop    %esi
+     eca:	5f                   	pop    %edi
+     ecb:	5d                   	pop    %ebp
+     ecc:	c3                   	ret
+     ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ed0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     edc:	8b 15 e8 38 00 00    	mov    0x38e8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ee2:	8d 78 07             	lea    0x7(%eax),%edi
+     ee5:	c1 ef 03             	shr    $0x3,%edi
+     ee8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     eeb:	85 d2                	test   %edx,%edx
+     eed:	0f 84 8d 00 00 00    	je     f80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ef3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ef5:	8b 48 04             	mov    0x4(%eax),%ecx
+     ef8:	39 f9                	cmp    %edi,%ecx
+     efa:	73 64                	jae    f60 <malloc+0x90>
+  if(nu < 4096)
+     efc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f01:	39 df                	cmp    %ebx,%edi
+     f03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f0d:	eb 0a                	jmp    f19 <malloc+0x49>
+     f0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f12:	8b 48 04             	mov    0x4(%eax),%ecx
+     f15:	39 f9                	cmp    %edi,%ecx
+     f17:	73 47                	jae    f60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f19:	89 c2                	mov    %eax,%edx
+     f1b:	39 05 e8 38 00 00    	cmp    %eax,0x38e8
+     f21:	75 ed                	jne    f10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f23:	83 ec 0c             	sub    $0xc,%esp
+     f26:	56                   	push   %esi
+     f27:	e8 e4 fb ff ff       	call   b10 <sbrk>
+  if(p == (char*)-1)
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f32:	74 1c                	je     f50 <malloc+0x80>
+  hp->s.size = nu;
+     f34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f37:	83 ec 0c             	sub    $0xc,%esp
+     f3a:	83 c0 08             	add    $0x8,%eax
+     f3d:	50                   	push   %eax
+     f3e:	e8 fd fe ff ff       	call   e40 <free>
+  return freep;
+     f43:	8b 15 e8 38 00 00    	mov    0x38e8,%edx
+      if((p = morecore(nunits)) == 0)
+     f49:	83 c4 10             	add    $0x10,%esp
+     f4c:	85 d2                	test   %edx,%edx
+     f4e:	75 c0                	jne    f10 <malloc+0x40>
+        return 0;
+  }
+}
+     f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     f53:	31 c0                	xor    %eax,%eax
+}
+     f55:	5b                   	pop    %ebx
+     f56:	5e                   	pop    %esi
+     f57:	5f                   	pop    %edi
+     f58:	5d                   	pop    %ebp
+     f59:	c3                   	ret
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     f60:	39 cf                	cmp    %ecx,%edi
+     f62:	74 4c                	je     fb0 <malloc+0xe0>
+        p->s.size -= nunits;
+     f64:	29 f9                	sub    %edi,%ecx
+     f66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     f69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     f6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     f6f:	89 15 e8 38 00 00    	mov    %edx,0x38e8
+}
+     f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     f78:	83 c0 08             	add    $0x8,%eax
+}
+     f7b:	5b                   	pop    %ebx
+     f7c:	5e                   	pop    %esi
+     f7d:	5f                   	pop    %edi
+     f7e:	5d                   	pop    %ebp
+     f7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     f80:	c7 05 e8 38 00 00 ec 	movl   $0x38ec,0x38e8
+     f87:	38 00 00 
+    base.s.size = 0;
+     f8a:	b8 ec 38 00 00       	mov    $0x38ec,%eax
+    base.s.ptr = freep = prevp = &base;
+     f8f:	c7 05 ec 38 00 00 ec 	movl   $0x38ec,0x38ec
+     f96:	38 00 00 
+    base.s.size = 0;
+     f99:	c7 05 f0 38 00 00 00 	movl   $0x0,0x38f0
+     fa0:	00 00 00 
+    if(p->s.size >= nunits){
+     fa3:	e9 54 ff ff ff       	jmp    efc <malloc+0x2c>
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     fb0:	8b 08                	mov    (%eax),%ecx
+     fb2:	89 0a                	mov    %ecx,(%edx)
+     fb4:	eb b9                	jmp    f6f <malloc+0x9f>
+     fb6:	66 90                	xchg   %ax,%ax
+     fb8:	66 90                	xchg   %ax,%ax
+     fba:	66 90                	xchg   %ax,%ax
+     fbc:	66 90                	xchg   %ax,%ax
+     fbe:	66 90                	xchg   %ax,%ax
+
+00000fc0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	57                   	push   %edi
+     fc4:	56                   	push   %esi
+     fc5:	53                   	push   %ebx
+     fc6:	83 ec 20             	sub    $0x20,%esp
+     fc9:	8b 75 0c             	mov    0xc(%ebp),%esi
+     fcc:	8b 7d 10             	mov    0x10(%ebp),%edi
+     fcf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+     fd2:	68 e8 03 00 00       	push   $0x3e8
+     fd7:	57                   	push   %edi
+     fd8:	56                   	push   %esi
+     fd9:	e8 e2 f9 ff ff       	call   9c0 <udiv64>
+     fde:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+     fe0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+     fe3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+     fe9:	29 c1                	sub    %eax,%ecx
+     feb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+     fee:	68 e8 03 00 00       	push   $0x3e8
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	e8 c6 f9 ff ff       	call   9c0 <udiv64>
+     ffa:	83 c4 0c             	add    $0xc,%esp
+     ffd:	50                   	push   %eax
+     ffe:	68 31 14 00 00       	push   $0x1431
+    1003:	53                   	push   %ebx
+    1004:	e8 87 fc ff ff       	call   c90 <printf>
+  if(frac < 100)
+    1009:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    100c:	83 c4 10             	add    $0x10,%esp
+    100f:	83 f9 63             	cmp    $0x63,%ecx
+    1012:	76 1c                	jbe    1030 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+    1014:	89 4d 10             	mov    %ecx,0x10(%ebp)
+    1017:	c7 45 0c 37 14 00 00 	movl   $0x1437,0xc(%ebp)
+    101e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1024:	5b                   	pop    %ebx
+    1025:	5e                   	pop    %esi
+    1026:	5f                   	pop    %edi
+    1027:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+    1028:	e9 63 fc ff ff       	jmp    c90 <printf>
+    102d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	68 35 14 00 00       	push   $0x1435
+    1038:	53                   	push   %ebx
+    1039:	e8 52 fc ff ff       	call   c90 <printf>
+  if(frac < 10)
+    103e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1041:	83 c4 10             	add    $0x10,%esp
+    1044:	83 f9 09             	cmp    $0x9,%ecx
+    1047:	77 cb                	ja     1014 <printps+0x54>
+    printf(fd, "0");
+    1049:	83 ec 08             	sub    $0x8,%esp
+    104c:	68 35 14 00 00       	push   $0x1435
+    1051:	53                   	push   %ebx
+    1052:	e8 39 fc ff ff       	call   c90 <printf>
+    1057:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    105a:	83 c4 10             	add    $0x10,%esp
+    105d:	eb b5                	jmp    1014 <printps+0x54>
+    105f:	90                   	nop
+
+00001060 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+    1066:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+    106c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+    106f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+    1072:	83 e8 01             	sub    $0x1,%eax
+    1075:	3d ff 00 00 00       	cmp    $0xff,%eax
+    107a:	0f 87 37 02 00 00    	ja     12b7 <bench+0x257>
+    1080:	8b 7d 14             	mov    0x14(%ebp),%edi
+    1083:	85 ff                	test   %edi,%edi
+    1085:	0f 84 2c 02 00 00    	je     12b7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+    108b:	83 ec 0c             	sub    $0xc,%esp
+    108e:	ff 75 10             	push   0x10(%ebp)
+    1091:	ff 55 0c             	call   *0xc(%ebp)
+    1094:	5b                   	pop    %ebx
+    1095:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+    1098:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+    109a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+    109d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+    10a0:	83 c4 10             	add    $0x10,%esp
+    10a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10a7:	90                   	nop
+    t0 = cycles();
+    10a8:	e8 33 f9 ff ff       	call   9e0 <cycles>
+    fn(arg);
+    10ad:	83 ec 0c             	sub    $0xc,%esp
+    10b0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+    10b3:	89 c6                	mov    %eax,%esi
+    10b5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+    10b7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+    10ba:	e8 21 f9 ff ff       	call   9e0 <cycles>
+    10bf:	29 f0                	sub    %esi,%eax
+    10c1:	19 fa                	sbb    %edi,%edx
+    10c3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+    10ca:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+    10cd:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+    10d4:	83 c3 01             	add    $0x1,%ebx
+    10d7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+    10da:	7f cc                	jg     10a8 <bench+0x48>
+  for(i = 1; i < n; i++){
+    10dc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+    10e0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+    10e3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+    10e9:	bf 01 00 00 00       	mov    $0x1,%edi
+    10ee:	74 77                	je     1167 <bench+0x107>
+    10f0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    10f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10f7:	90                   	nop
+    v = a[i];
+    10f8:	8b 01                	mov    (%ecx),%eax
+    10fa:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+    10fd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+    1103:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+    1109:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+    110f:	89 c8                	mov    %ecx,%eax
+    1111:	eb 1b                	jmp    112e <bench+0xce>
+    1113:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1117:	90                   	nop
+      a[j] = a[j-1];
+    1118:	89 08                	mov    %ecx,(%eax)
+    111a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+    111d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+    1120:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+    1126:	39 c3                	cmp    %eax,%ebx
+    1128:	0f 84 72 01 00 00    	je     12a0 <bench+0x240>
+    112e:	8b 50 fc             	mov    -0x4(%eax),%edx
+    1131:	8b 48 f8             	mov    -0x8(%eax),%ecx
+    1134:	89 f7                	mov    %esi,%edi
+    1136:	89 c3                	mov    %eax,%ebx
+    1138:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+    113e:	19 d7                	sbb    %edx,%edi
+    1140:	72 d6                	jb     1118 <bench+0xb8>
+    1142:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+    1148:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+    114e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+    1154:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+    1157:	83 c7 01             	add    $0x1,%edi
+    115a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+    115d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+    115f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+    1162:	75 94                	jne    10f8 <bench+0x98>
+    1164:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+    1167:	83 ec 08             	sub    $0x8,%esp
+    116a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+    1170:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    1175:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+    117b:	e8 70 f8 ff ff       	call   9f0 <cyc2ns>
+    1180:	83 c4 0c             	add    $0xc,%esp
+    1183:	ff 75 14             	push   0x14(%ebp)
+    1186:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    118c:	f7 e3                	mul    %ebx
+    118e:	01 ca                	add    %ecx,%edx
+    1190:	52                   	push   %edx
+    1191:	50                   	push   %eax
+    1192:	e8 29 f8 ff ff       	call   9c0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+    1197:	89 06                	mov    %eax,(%esi)
+    1199:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+    119c:	5f                   	pop    %edi
+    119d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+    119e:	8b 45 18             	mov    0x18(%ebp),%eax
+    11a1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+    11a3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+    11aa:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+    11b1:	e8 3a f8 ff ff       	call   9f0 <cyc2ns>
+    11b6:	83 c4 0c             	add    $0xc,%esp
+    11b9:	ff 75 14             	push   0x14(%ebp)
+    11bc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    11c2:	f7 e3                	mul    %ebx
+    11c4:	01 ca                	add    %ecx,%edx
+    11c6:	52                   	push   %edx
+    11c7:	50                   	push   %eax
+    11c8:	e8 f3 f7 ff ff       	call   9c0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+    11cd:	89 46 08             	mov    %eax,0x8(%esi)
+    11d0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+    11d3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    11d4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+    11d7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    11d8:	8d 50 01             	lea    0x1(%eax),%edx
+    11db:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    11e0:	6b d2 63             	imul   $0x63,%edx,%edx
+    11e3:	f7 e2                	mul    %edx
+    11e5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+    11e8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+    11ef:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+    11f6:	e8 f5 f7 ff ff       	call   9f0 <cyc2ns>
+    11fb:	83 c4 0c             	add    $0xc,%esp
+    11fe:	ff 75 14             	push   0x14(%ebp)
+    1201:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    1207:	f7 e3                	mul    %ebx
+    1209:	01 ca                	add    %ecx,%edx
+    120b:	52                   	push   %edx
+    120c:	50                   	push   %eax
+    120d:	e8 ae f7 ff ff       	call   9c0 <udiv64>
+
+  if(name){
+    1212:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1215:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    1218:	89 46 10             	mov    %eax,0x10(%esi)
+    121b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+    121e:	85 c9                	test   %ecx,%ecx
+    1220:	74 72                	je     1294 <bench+0x234>
+    printf(1, "%s: min ", name);
+    1222:	83 ec 04             	sub    $0x4,%esp
+    1225:	ff 75 08             	push   0x8(%ebp)
+    1228:	68 3a 14 00 00       	push   $0x143a
+    122d:	6a 01                	push   $0x1
+    122f:	e8 5c fa ff ff       	call   c90 <printf>
+    printps(1, st->min);
+    1234:	83 c4 0c             	add    $0xc,%esp
+    1237:	ff 76 04             	push   0x4(%esi)
+    123a:	ff 36                	push   (%esi)
+    123c:	6a 01                	push   $0x1
+    123e:	e8 7d fd ff ff       	call   fc0 <printps>
+    printf(1, " median ");
+    1243:	58                   	pop    %eax
+    1244:	5a                   	pop    %edx
+    1245:	68 43 14 00 00       	push   $0x1443
+    124a:	6a 01                	push   $0x1
+    124c:	e8 3f fa ff ff       	call   c90 <printf>
+    printps(1, st->median);
+    1251:	83 c4 0c             	add    $0xc,%esp
+    1254:	ff 76 0c             	push   0xc(%esi)
+    1257:	ff 76 08             	push   0x8(%esi)
+    125a:	6a 01                	push   $0x1
+    125c:	e8 5f fd ff ff       	call   fc0 <printps>
+    printf(1, " p99 ");
+    1261:	59                   	pop    %ecx
+    1262:	5b                   	pop    %ebx
+    1263:	68 4c 14 00 00       	push   $0x144c
+    1268:	6a 01                	push   $0x1
+    126a:	e8 21 fa ff ff       	call   c90 <printf>
+    printps(1, st->p99);
+    126f:	83 c4 0c             	add    $0xc,%esp
+    1272:	ff 76 14             	push   0x14(%esi)
+    1275:	ff 76 10             	push   0x10(%esi)
+    1278:	6a 01                	push   $0x1
+    127a:	e8 41 fd ff ff       	call   fc0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+    127f:	83 c4 0c             	add    $0xc,%esp
+    1282:	ff 75 18             	push   0x18(%ebp)
+    1285:	68 52 14 00 00       	push   $0x1452
+    128a:	6a 01                	push   $0x1
+    128c:	e8 ff f9 ff ff       	call   c90 <printf>
+    1291:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+    1294:	31 c0                	xor    %eax,%eax
+}
+    1296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1299:	5b                   	pop    %ebx
+    129a:	5e                   	pop    %esi
+    129b:	5f                   	pop    %edi
+    129c:	5d                   	pop    %ebp
+    129d:	c3                   	ret
+    129e:	66 90                	xchg   %ax,%ax
+    12a0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+    12a6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    12ac:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+    12b2:	e9 97 fe ff ff       	jmp    114e <bench+0xee>
+    return -1;
+    12b7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12bc:	eb d8                	jmp    1296 <bench+0x236>
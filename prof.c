@@ -0,0 +1,263 @@
+// Sampling profiler front end.
+//   prof [-p period] cmd [args...]
+// Runs cmd with the kernel sampling every period timer
+// interrupts, then prints a flat profile.  Kernel addresses
+// are resolved with /kernel.sym and addresses in cmd itself
+// with /cmd.sym; see SYMS in the Makefile.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "prof.h"
+
+#define CHUNK  512     // samples per profread() call
+#define NTOP    40     // lines of profile to print
+
+struct sym {
+  uint addr;
+  char *name;
+  int hits;
+};
+
+struct symtab {
+  struct sym *s;
+  int n;
+};
+
+static struct symtab ktab, utab;
+static int nsamples, nlost, nidle, nother, nunknown;
+
+static uint
+hex(char **p)
+{
+  uint v;
+  char c;
+
+  v = 0;
+  for(;; (*p)++){
+    c = **p;
+    if(c >= '0' && c <= '9')
+      v = v*16 + c - '0';
+    else if(c >= 'a' && c <= 'f')
+      v = v*16 + c - 'a' + 10;
+    else
+      return v;
+  }
+}
+
+// File and section names are not functions.
+static int
+skipsym(char *name)
+{
+  int n;
+
+  n = strlen(name);
+  if(name[0] == '.' || name[0] == 0)
+    return 1;
+  return n > 2 && name[n-2] == '.' && (name[n-1] == 'c' || name[n-1] == 'S');
+}
+
+// Load a symbol table written by "objdump -t | sed" in the
+// Makefile: one "address name" pair per line.
+static void
+loadsyms(char *path, struct symtab *t)
+{
+  struct stat st;
+  struct sym v;
+  char *buf, *p, *name;
+  int fd, j, n;
+
+  t->n = 0;
+  if((fd = open(path, O_RDONLY)) < 0)
+    return;
+  if(fstat(fd, &st) < 0 || (buf = malloc(st.size + 1)) == 0){
+    close(fd);
+    return;
+  }
+  n = read(fd, buf, st.size);
+  close(fd);
+  if(n < 0)
+    n = 0;
+  buf[n] = 0;
+
+  n = 0;
+  for(p = buf; *p; p++)
+    if(*p == '\n')
+      n++;
+  t->s = malloc((n + 1) * sizeof(struct sym));
+
+  for(p = buf; *p; ){
+    v.addr = hex(&p);
+    if(*p == ' ')
+      p++;
+    name = p;
+    while(*p && *p != '\n')
+      p++;
+    if(*p)
+      *p++ = 0;
+    if(skipsym(name))
+      continue;
+    v.name = name;
+    v.hits = 0;
+    for(j = t->n; j > 0 && t->s[j-1].addr > v.addr; j--)
+      t->s[j] = t->s[j-1];
+    t->s[j] = v;
+    t->n++;
+  }
+}
+
+// Find the symbol with the greatest address not above pc.
+static struct sym*
+lookup(struct symtab *t, uint pc)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = t->n - 1;
+  if(t->n == 0 || pc < t->s[0].addr)
+    return 0;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(t->s[mid].addr <= pc)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return &t->s[lo];
+}
+
+static void
+account(struct profsample *s, int cpid)
+{
+  struct sym *sym;
+
+  if(s->mode == PS_LOST){
+    nlost += s->eip;
+    return;
+  }
+  nsamples++;
+  if(s->mode == PS_KERNEL){
+    if(s->pid == 0)
+      nidle++;
+    if((sym = lookup(&ktab, s->eip)) != 0)
+      sym->hits++;
+    else
+      nunknown++;
+  } else if(s->pid == cpid){
+    if((sym = lookup(&utab, s->eip)) != 0)
+      sym->hits++;
+    else
+      nunknown++;
+  } else
+    nother++;
+}
+
+static void
+drain(int cpid)
+{
+  static struct profsample buf[CHUNK];
+  int i, n;
+
+  while((n = profread(buf, CHUNK)) > 0)
+    for(i = 0; i < n; i++)
+      account(&buf[i], cpid);
+}
+
+static void
+pct(int n)
+{
+  int x;
+
+  x = nsamples ? n * 1000 / nsamples : 0;
+  printf(1, "%d.%d%%", x / 10, x % 10);
+}
+
+// Print the NTOP busiest symbols of both tables.
+static void
+report(void)
+{
+  struct sym *best;
+  char tag;
+  int i, k;
+
+  printf(1, "%d samples", nsamples);
+  if(nlost)
+    printf(1, ", %d lost", nlost);
+  printf(1, "; idle ");
+  pct(nidle);
+  printf(1, ", other processes ");
+  pct(nother);
+  printf(1, ", unresolved ");
+  pct(nunknown);
+  printf(1, "\n\nsamples\t%%\t\tsymbol\n");
+
+  for(k = 0; k < NTOP; k++){
+    best = 0;
+    tag = 'k';
+    for(i = 0; i < ktab.n; i++)
+      if(ktab.s[i].hits && (best == 0 || ktab.s[i].hits > best->hits))
+        best = &ktab.s[i];
+    for(i = 0; i < utab.n; i++)
+      if(utab.s[i].hits && (best == 0 || utab.s[i].hits > best->hits)){
+        best = &utab.s[i];
+        tag = 'u';
+      }
+    if(best == 0)
+      break;
+    printf(1, "%d\t", best->hits);
+    pct(best->hits);
+    printf(1, "\t\t[%c] %s\n", tag, best->name);
+    best->hits = 0;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[32], *cmd;
+  int period, pid, i;
+
+  period = 1;
+  i = 1;
+  if(argc > 2 && strcmp(argv[1], "-p") == 0){
+    period = atoi(argv[2]);
+    i = 3;
+  }
+  if(i >= argc || period <= 0){
+    printf(2, "usage: prof [-p period] cmd [args...]\n");
+    exit();
+  }
+
+  cmd = argv[i];
+  while(*cmd == '/')
+    cmd++;
+  if(strlen(cmd) + 6 > sizeof(path)){
+    printf(2, "prof: %s: name too long\n", cmd);
+    exit();
+  }
+  loadsyms("kernel.sym", &ktab);
+  strcpy(path, cmd);
+  strcpy(path + strlen(path), ".sym");
+  loadsyms(path, &utab);
+  if(ktab.n == 0)
+    printf(2, "prof: no kernel.sym, kernel samples unresolved\n");
+
+  // Discard samples left over from earlier runs.
+  drain(-1);
+  nsamples = nlost = nidle = nother = nunknown = 0;
+
+  profile(period);
+  pid = fork();
+  if(pid == 0){
+    exec(argv[i], argv + i);
+    printf(2, "prof: exec %s failed\n", argv[i]);
+    exit();
+  }
+  if(pid > 0)
+    wait();
+  profile(0);
+  drain(pid);
+  report();
+  exit();
+}
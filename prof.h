@@ -0,0 +1,12 @@
+// Timer-interrupt profiler samples, shared by the kernel and prof(1).
+
+#define PS_KERNEL  0   // interrupted in kernel mode
+#define PS_USER    1   // interrupted in user mode
+#define PS_LOST    2   // eip holds the number of samples dropped
+
+struct profsample {
+  uint eip;     // interrupted instruction
+  int pid;      // current process, or 0 if the cpu was idle
+  uint mode;    // PS_*
+  uint cpu;
+};
@@ -0,0 +1,107 @@
+// Sampling profiler.
+// Every profperiod timer interrupts, each CPU records the
+// interrupted %eip in its own ring.  As with the vm trace rings,
+// only the owning CPU writes a ring (from the timer interrupt),
+// readers drain them under proflock, and a full ring counts
+// the samples it had to drop.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "prof.h"
+
+#define NPROF 1024   // samples per cpu ring
+
+struct profring {
+  volatile uint head;       // next slot to write; only its cpu advances it
+  volatile uint tail;       // next slot to read; only readers advance it
+  volatile uint dropped;    // samples lost since the last drain
+  uint ticks;               // timer interrupts since the last sample
+  struct profsample s[NPROF];
+};
+
+static struct profring rings[NCPU];
+static struct spinlock proflock;
+static uint profperiod;     // timer interrupts per sample, 0 if off
+
+void
+profinit(void)
+{
+  initlock(&proflock, "prof");
+}
+
+// Called from the timer interrupt, with interrupts off.
+void
+profsample(struct trapframe *tf)
+{
+  struct profring *r;
+  struct profsample *s;
+  struct cpu *c;
+
+  if(profperiod == 0)
+    return;
+  c = mycpu();
+  r = &rings[c - cpus];
+  if(++r->ticks < profperiod)
+    return;
+  r->ticks = 0;
+  if(r->head - r->tail >= NPROF){
+    __sync_fetch_and_add(&r->dropped, 1);
+    return;
+  }
+  s = &r->s[r->head % NPROF];
+  s->eip = tf->eip;
+  s->pid = c->proc ? c->proc->pid : 0;
+  s->mode = (tf->cs&3) == DPL_USER ? PS_USER : PS_KERNEL;
+  s->cpu = c - cpus;
+  __sync_synchronize();
+  r->head++;
+}
+
+// Sample every period timer interrupts (0 stops sampling).
+// Returns the old period.
+uint
+setprofperiod(uint period)
+{
+  uint old;
+
+  old = profperiod;
+  profperiod = period;
+  return old;
+}
+
+// Move up to n samples from the cpu rings into buf,
+// which may be a user address in the current page table.
+// Returns the number of samples copied.
+int
+profread(struct profsample *buf, int n)
+{
+  struct profring *r;
+  int i, cnt;
+
+  cnt = 0;
+  acquire(&proflock);
+  for(i = 0; i < ncpu && cnt < n; i++){
+    r = &rings[i];
+    if(r->dropped){
+      buf[cnt].eip = xchg(&r->dropped, 0);
+      buf[cnt].pid = 0;
+      buf[cnt].mode = PS_LOST;
+      buf[cnt].cpu = i;
+      cnt++;
+    }
+    while(cnt < n && r->tail != r->head){
+      __sync_synchronize();
+      buf[cnt++] = r->s[r->tail % NPROF];
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  release(&proflock);
+  return cnt;
+}
@@ -0,0 +1,1949 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\t\t%d\n", us ? (uint)udiv64((uint64)ops * 1000000, us) : 0);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  int n, max;
+
+  max = 16;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8e 8a 01 00 00    	jle    1aa <main+0x1aa>
+    max = atoi(argv[1]);
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 d5 03 00 00       	call   400 <atoi>
+  if(max < 1){
+  2b:	83 c4 10             	add    $0x10,%esp
+    max = atoi(argv[1]);
+  2e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  if(max < 1){
+  31:	85 c0                	test   %eax,%eax
+  33:	0f 8e 8e 01 00 00    	jle    1c7 <main+0x1c7>
+    printf(2, "usage: schedbench [maxprocs]\n");
+    exit();
+  }
+
+  printf(1, "procs\tns/yield\tyields/sec\n");
+  39:	56                   	push   %esi
+  3a:	56                   	push   %esi
+  3b:	68 8e 0d 00 00       	push   $0xd8e
+  40:	6a 01                	push   $0x1
+  42:	e8 f9 06 00 00       	call   740 <printf>
+  47:	83 c4 10             	add    $0x10,%esp
+  for(n = 1; n <= max; n *= 2)
+  4a:	be 01 00 00 00       	mov    $0x1,%esi
+  4f:	90                   	nop
+  if(pipe(fd) < 0){
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  56:	50                   	push   %eax
+  57:	e8 ec 04 00 00       	call   548 <pipe>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	85 c0                	test   %eax,%eax
+  61:	0f 88 a8 01 00 00    	js     20f <main+0x20f>
+  for(n = 0; n < nproc; n++){
+  67:	31 db                	xor    %ebx,%ebx
+  69:	eb 16                	jmp    81 <main+0x81>
+  6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(i == 0){
+  70:	0f 84 64 01 00 00    	je     1da <main+0x1da>
+  for(n = 0; n < nproc; n++){
+  76:	83 c3 01             	add    $0x1,%ebx
+  79:	39 f3                	cmp    %esi,%ebx
+  7b:	0f 84 df 00 00 00    	je     160 <main+0x160>
+    i = fork();
+  81:	e8 aa 04 00 00       	call   530 <fork>
+    if(i < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <main+0x70>
+  close(fd[0]);
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 e0             	push   -0x20(%ebp)
+  90:	e8 cb 04 00 00       	call   560 <close>
+  t0 = cycles();
+  95:	e8 f6 03 00 00       	call   490 <cycles>
+  9a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  close(fd[1]);
+  a0:	5a                   	pop    %edx
+  a1:	ff 75 e4             	push   -0x1c(%ebp)
+  a4:	e8 b7 04 00 00       	call   560 <close>
+  for(i = 0; i < n; i++)
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	85 db                	test   %ebx,%ebx
+  ae:	74 14                	je     c4 <main+0xc4>
+  for(n = 0; n < nproc; n++){
+  b0:	31 ff                	xor    %edi,%edi
+  b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+  b8:	e8 83 04 00 00       	call   540 <wait>
+  for(i = 0; i < n; i++)
+  bd:	83 c7 01             	add    $0x1,%edi
+  c0:	39 fb                	cmp    %edi,%ebx
+  c2:	75 f4                	jne    b8 <main+0xb8>
+  ns = cyc2ns(cycles() - t0);
+  c4:	e8 c7 03 00 00       	call   490 <cycles>
+  c9:	83 ec 08             	sub    $0x8,%esp
+  cc:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  cf:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+  d2:	52                   	push   %edx
+  d3:	50                   	push   %eax
+  d4:	e8 c7 03 00 00       	call   4a0 <cyc2ns>
+  ops = n * NYIELD;
+  d9:	69 cb 10 27 00 00    	imul   $0x2710,%ebx,%ecx
+  us = udiv64(ns, 1000);
+  df:	83 c4 0c             	add    $0xc,%esp
+  ops = n * NYIELD;
+  e2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  us = udiv64(ns, 1000);
+  e5:	68 e8 03 00 00       	push   $0x3e8
+  ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  f0:	52                   	push   %edx
+  f1:	50                   	push   %eax
+  f2:	e8 79 03 00 00       	call   470 <udiv64>
+  printf(1, "%d\t", n);
+  f7:	83 c4 0c             	add    $0xc,%esp
+  fa:	53                   	push   %ebx
+  us = udiv64(ns, 1000);
+  fb:	89 c7                	mov    %eax,%edi
+  printf(1, "%d\t", n);
+  fd:	68 c2 0d 00 00       	push   $0xdc2
+ 102:	6a 01                	push   $0x1
+ 104:	e8 37 06 00 00       	call   740 <printf>
+  printps(1, udiv64(ns * 1000, ops));
+ 109:	83 c4 0c             	add    $0xc,%esp
+ 10c:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+ 111:	ff 75 cc             	push   -0x34(%ebp)
+ 114:	69 4d d4 e8 03 00 00 	imul   $0x3e8,-0x2c(%ebp),%ecx
+ 11b:	f7 65 d0             	mull   -0x30(%ebp)
+ 11e:	01 ca                	add    %ecx,%edx
+ 120:	52                   	push   %edx
+ 121:	50                   	push   %eax
+ 122:	e8 49 03 00 00       	call   470 <udiv64>
+ 127:	83 c4 0c             	add    $0xc,%esp
+ 12a:	52                   	push   %edx
+ 12b:	50                   	push   %eax
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 3d 09 00 00       	call   a70 <printps>
+  printf(1, "\t\t%d\n", us ? (uint)udiv64((uint64)ops * 1000000, us) : 0);
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	85 ff                	test   %edi,%edi
+ 138:	75 56                	jne    190 <main+0x190>
+ 13a:	83 ec 04             	sub    $0x4,%esp
+  for(n = 1; n <= max; n *= 2)
+ 13d:	01 f6                	add    %esi,%esi
+  printf(1, "\t\t%d\n", us ? (uint)udiv64((uint64)ops * 1000000, us) : 0);
+ 13f:	57                   	push   %edi
+ 140:	68 c6 0d 00 00       	push   $0xdc6
+ 145:	6a 01                	push   $0x1
+ 147:	e8 f4 05 00 00       	call   740 <printf>
+  for(n = 1; n <= max; n *= 2)
+ 14c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 14f:	83 c4 10             	add    $0x10,%esp
+ 152:	39 c6                	cmp    %eax,%esi
+ 154:	0f 8e f6 fe ff ff    	jle    50 <main+0x50>
+  exit();
+ 15a:	e8 d9 03 00 00       	call   538 <exit>
+ 15f:	90                   	nop
+  close(fd[0]);
+ 160:	83 ec 0c             	sub    $0xc,%esp
+ 163:	ff 75 e0             	push   -0x20(%ebp)
+ 166:	e8 f5 03 00 00       	call   560 <close>
+  t0 = cycles();
+ 16b:	e8 20 03 00 00       	call   490 <cycles>
+ 170:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 173:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  close(fd[1]);
+ 176:	58                   	pop    %eax
+ 177:	ff 75 e4             	push   -0x1c(%ebp)
+ 17a:	e8 e1 03 00 00       	call   560 <close>
+ 17f:	83 c4 10             	add    $0x10,%esp
+ 182:	e9 29 ff ff ff       	jmp    b0 <main+0xb0>
+ 187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18e:	66 90                	xchg   %ax,%ax
+  printf(1, "\t\t%d\n", us ? (uint)udiv64((uint64)ops * 1000000, us) : 0);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 198:	57                   	push   %edi
+ 199:	f7 6d cc             	imull  -0x34(%ebp)
+ 19c:	52                   	push   %edx
+ 19d:	50                   	push   %eax
+ 19e:	e8 cd 02 00 00       	call   470 <udiv64>
+ 1a3:	83 c4 10             	add    $0x10,%esp
+ 1a6:	89 c7                	mov    %eax,%edi
+ 1a8:	eb 90                	jmp    13a <main+0x13a>
+  printf(1, "procs\tns/yield\tyields/sec\n");
+ 1aa:	53                   	push   %ebx
+ 1ab:	53                   	push   %ebx
+ 1ac:	68 8e 0d 00 00       	push   $0xd8e
+ 1b1:	6a 01                	push   $0x1
+ 1b3:	e8 88 05 00 00       	call   740 <printf>
+  max = 16;
+ 1b8:	c7 45 c8 10 00 00 00 	movl   $0x10,-0x38(%ebp)
+  printf(1, "procs\tns/yield\tyields/sec\n");
+ 1bf:	83 c4 10             	add    $0x10,%esp
+ 1c2:	e9 83 fe ff ff       	jmp    4a <main+0x4a>
+    printf(2, "usage: schedbench [maxprocs]\n");
+ 1c7:	57                   	push   %edi
+ 1c8:	57                   	push   %edi
+ 1c9:	68 70 0d 00 00       	push   $0xd70
+ 1ce:	6a 02                	push   $0x2
+ 1d0:	e8 6b 05 00 00       	call   740 <printf>
+    exit();
+ 1d5:	e8 5e 03 00 00       	call   538 <exit>
+      close(fd[1]);
+ 1da:	83 ec 0c             	sub    $0xc,%esp
+ 1dd:	ff 75 e4             	push   -0x1c(%ebp)
+  read(fd, &c, 1);
+ 1e0:	bb 10 27 00 00       	mov    $0x2710,%ebx
+      close(fd[1]);
+ 1e5:	e8 76 03 00 00       	call   560 <close>
+  read(fd, &c, 1);
+ 1ea:	83 c4 0c             	add    $0xc,%esp
+ 1ed:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 1f0:	6a 01                	push   $0x1
+ 1f2:	50                   	push   %eax
+ 1f3:	ff 75 e0             	push   -0x20(%ebp)
+ 1f6:	e8 55 03 00 00       	call   550 <read>
+ 1fb:	83 c4 10             	add    $0x10,%esp
+ 1fe:	66 90                	xchg   %ax,%ax
+    yield();
+ 200:	e8 3b 04 00 00       	call   640 <yield>
+  for(i = 0; i < NYIELD; i++)
+ 205:	83 eb 01             	sub    $0x1,%ebx
+ 208:	75 f6                	jne    200 <main+0x200>
+ 20a:	e9 4b ff ff ff       	jmp    15a <main+0x15a>
+    printf(2, "schedbench: pipe failed\n");
+ 20f:	51                   	push   %ecx
+ 210:	51                   	push   %ecx
+ 211:	68 a9 0d 00 00       	push   $0xda9
+ 216:	6a 02                	push   $0x2
+ 218:	e8 23 05 00 00       	call   740 <printf>
+    exit();
+ 21d:	e8 16 03 00 00       	call   538 <exit>
+ 222:	66 90                	xchg   %ax,%ax
+ 224:	66 90                	xchg   %ax,%ax
+ 226:	66 90                	xchg   %ax,%ax
+ 228:	66 90                	xchg   %ax,%ax
+ 22a:	66 90                	xchg   %ax,%ax
+ 22c:	66 90                	xchg   %ax,%ax
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 e3 01 00 00       	call   550 <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 b6 01 00 00       	call   578 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 b9 01 00 00       	call   590 <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 7f 01 00 00       	call   560 <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 407:	0f be 02             	movsbl (%edx),%eax
+ 40a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 40d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 415:	77 1e                	ja     435 <atoi+0x35>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 42a:	0f be 02             	movsbl (%edx),%eax
+ 42d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 430:	80 fb 09             	cmp    $0x9,%bl
+ 433:	76 eb                	jbe    420 <atoi+0x20>
+  return n;
+}
+ 435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 438:	89 c8                	mov    %ecx,%eax
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	8b 45 10             	mov    0x10(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	7e 13                	jle    465 <memmove+0x25>
+ 452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 461:	39 f8                	cmp    %edi,%eax
+ 463:	75 fb                	jne    460 <memmove+0x20>
+  return vdst;
+}
+ 465:	5e                   	pop    %esi
+ 466:	89 d0                	mov    %edx,%eax
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 470:	55                   	push   %ebp
+ 471:	31 d2                	xor    %edx,%edx
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	53                   	push   %ebx
+ 476:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 479:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 47c:	f7 f3                	div    %ebx
+ 47e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 480:	8b 45 08             	mov    0x8(%ebp),%eax
+ 483:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 488:	89 ca                	mov    %ecx,%edx
+}
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 490:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 492:	c3                   	ret
+ 493:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004a0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 4a9:	8b 35 f0 11 00 00    	mov    0x11f0,%esi
+{
+ 4af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 4b5:	85 f6                	test   %esi,%esi
+ 4b7:	74 2f                	je     4e8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 4b9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 4be:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 4c4:	f7 e3                	mul    %ebx
+ 4c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4c9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 4cc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 4cf:	31 d2                	xor    %edx,%edx
+ 4d1:	f7 f6                	div    %esi
+ 4d3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 4d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 4d8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 4db:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 4dd:	89 da                	mov    %ebx,%edx
+}
+ 4df:	5b                   	pop    %ebx
+ 4e0:	5e                   	pop    %esi
+ 4e1:	5f                   	pop    %edi
+ 4e2:	5d                   	pop    %ebp
+ 4e3:	c3                   	ret
+ 4e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 4e8:	e8 0b 01 00 00       	call   5f8 <tscfreq>
+ 4ed:	a3 f0 11 00 00       	mov    %eax,0x11f0
+ 4f2:	89 c6                	mov    %eax,%esi
+ 4f4:	eb c3                	jmp    4b9 <cyc2ns+0x19>
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	83 ec 10             	sub    $0x10,%esp
+ 507:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 50a:	6a 00                	push   $0x0
+ 50c:	e8 3f 01 00 00       	call   650 <getpriority>
+ 511:	5a                   	pop    %edx
+ 512:	59                   	pop    %ecx
+ 513:	01 d8                	add    %ebx,%eax
+ 515:	50                   	push   %eax
+ 516:	6a 00                	push   $0x0
+ 518:	e8 2b 01 00 00       	call   648 <setpriority>
+  return getpriority(0);
+ 51d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 524:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 527:	83 c4 10             	add    $0x10,%esp
+}
+ 52a:	c9                   	leave
+  return getpriority(0);
+ 52b:	e9 20 01 00 00       	jmp    650 <getpriority>
+
+00000530 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 530:	b8 01 00 00 00       	mov    $0x1,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <exit>:
+SYSCALL(exit)
+ 538:	b8 02 00 00 00       	mov    $0x2,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <wait>:
+SYSCALL(wait)
+ 540:	b8 03 00 00 00       	mov    $0x3,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <pipe>:
+SYSCALL(pipe)
+ 548:	b8 04 00 00 00       	mov    $0x4,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <read>:
+SYSCALL(read)
+ 550:	b8 05 00 00 00       	mov    $0x5,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <write>:
+SYSCALL(write)
+ 558:	b8 10 00 00 00       	mov    $0x10,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <close>:
+SYSCALL(close)
+ 560:	b8 15 00 00 00       	mov    $0x15,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <kill>:
+SYSCALL(kill)
+ 568:	b8 06 00 00 00       	mov    $0x6,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <exec>:
+SYSCALL(exec)
+ 570:	b8 07 00 00 00       	mov    $0x7,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <open>:
+SYSCALL(open)
+ 578:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <mknod>:
+SYSCALL(mknod)
+ 580:	b8 11 00 00 00       	mov    $0x11,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <unlink>:
+SYSCALL(unlink)
+ 588:	b8 12 00 00 00       	mov    $0x12,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <fstat>:
+SYSCALL(fstat)
+ 590:	b8 08 00 00 00       	mov    $0x8,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <link>:
+SYSCALL(link)
+ 598:	b8 13 00 00 00       	mov    $0x13,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <mkdir>:
+SYSCALL(mkdir)
+ 5a0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <chdir>:
+SYSCALL(chdir)
+ 5a8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <dup>:
+SYSCALL(dup)
+ 5b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <getpid>:
+SYSCALL(getpid)
+ 5b8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <sbrk>:
+SYSCALL(sbrk)
+ 5c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <sleep>:
+SYSCALL(sleep)
+ 5c8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <uptime>:
+SYSCALL(uptime)
+ 5d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <promote>:
+
+SYSCALL(promote)
+ 5d8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <demote>:
+SYSCALL(demote)
+ 5e0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 5e8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 5f0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <tscfreq>:
+SYSCALL(tscfreq)
+ 5f8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <tracemask>:
+SYSCALL(tracemask)
+ 600:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <traceread>:
+SYSCALL(traceread)
+ 608:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <profile>:
+SYSCALL(profile)
+ 610:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <profread>:
+SYSCALL(profread)
+ 618:	b8 20 00 00 00       	mov    $0x20,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <lockstat>:
+SYSCALL(lockstat)
+ 620:	b8 21 00 00 00       	mov    $0x21,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 628:	b8 22 00 00 00       	mov    $0x22,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <sysstat>:
+SYSCALL(sysstat)
+ 630:	b8 23 00 00 00       	mov    $0x23,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <kbench>:
+SYSCALL(kbench)
+ 638:	b8 24 00 00 00       	mov    $0x24,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <yield>:
+SYSCALL(yield)
+ 640:	b8 25 00 00 00       	mov    $0x25,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <setpriority>:
+SYSCALL(setpriority)
+ 648:	b8 26 00 00 00       	mov    $0x26,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <getpriority>:
+SYSCALL(getpriority)
+ 650:	b8 27 00 00 00       	mov    $0x27,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 658:	b8 28 00 00 00       	mov    $0x28,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 660:	b8 29 00 00 00       	mov    $0x29,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <clone>:
+SYSCALL(clone)
+ 668:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <join>:
+SYSCALL(join)
+ 670:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <futex_wait>:
+SYSCALL(futex_wait)
+ 678:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <futex_wake>:
+SYSCALL(futex_wake)
+ 680:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <spawn>:
+SYSCALL(spawn)
+ 688:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <diskstat>:
+SYSCALL(diskstat)
+ 690:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+ 698:	66 90                	xchg   %ax,%ax
+ 69a:	66 90                	xchg   %ax,%ax
+ 69c:	66 90                	xchg   %ax,%ax
+ 69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6a8:	89 d1                	mov    %edx,%ecx
+{
+ 6aa:	83 ec 3c             	sub    $0x3c,%esp
+ 6ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6b0:	85 d2                	test   %edx,%edx
+ 6b2:	0f 89 80 00 00 00    	jns    738 <printint+0x98>
+ 6b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6bc:	74 7a                	je     738 <printint+0x98>
+    x = -xx;
+ 6be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6c8:	31 f6                	xor    %esi,%esi
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6d0:	89 c8                	mov    %ecx,%eax
+ 6d2:	31 d2                	xor    %edx,%edx
+ 6d4:	89 f7                	mov    %esi,%edi
+ 6d6:	f7 f3                	div    %ebx
+ 6d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6db:	0f b6 92 2c 0e 00 00 	movzbl 0xe2c(%edx),%edx
+ 6e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6e6:	89 ca                	mov    %ecx,%edx
+ 6e8:	89 c1                	mov    %eax,%ecx
+ 6ea:	39 da                	cmp    %ebx,%edx
+ 6ec:	73 e2                	jae    6d0 <printint+0x30>
+  if(neg)
+ 6ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6f1:	85 c0                	test   %eax,%eax
+ 6f3:	74 07                	je     6fc <printint+0x5c>
+    buf[i++] = '-';
+ 6f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6fa:	89 f7                	mov    %esi,%edi
+ 6fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 702:	01 df                	add    %ebx,%edi
+ 704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 708:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 70b:	83 ec 04             	sub    $0x4,%esp
+ 70e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 711:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 714:	6a 01                	push   $0x1
+ 716:	50                   	push   %eax
+ 717:	56                   	push   %esi
+ 718:	e8 3b fe ff ff       	call   558 <write>
+  while(--i >= 0)
+ 71d:	89 f8                	mov    %edi,%eax
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	83 ef 01             	sub    $0x1,%edi
+ 725:	39 d8                	cmp    %ebx,%eax
+ 727:	75 df                	jne    708 <printint+0x68>
+}
+ 729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72c:	5b                   	pop    %ebx
+ 72d:	5e                   	pop    %esi
+ 72e:	5f                   	pop    %edi
+ 72f:	5d                   	pop    %ebp
+ 730:	c3                   	ret
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 738:	31 c0                	xor    %eax,%eax
+ 73a:	eb 89                	jmp    6c5 <printint+0x25>
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	57                   	push   %edi
+ 744:	56                   	push   %esi
+ 745:	53                   	push   %ebx
+ 746:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 749:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 74c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 74f:	0f b6 1e             	movzbl (%esi),%ebx
+ 752:	83 c6 01             	add    $0x1,%esi
+ 755:	84 db                	test   %bl,%bl
+ 757:	74 67                	je     7c0 <printf+0x80>
+ 759:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 75c:	31 d2                	xor    %edx,%edx
+ 75e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 761:	eb 34                	jmp    797 <printf+0x57>
+ 763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 767:	90                   	nop
+ 768:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 76b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 770:	83 f8 25             	cmp    $0x25,%eax
+ 773:	74 18                	je     78d <printf+0x4d>
+  write(fd, &c, 1);
+ 775:	83 ec 04             	sub    $0x4,%esp
+ 778:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 77b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77e:	6a 01                	push   $0x1
+ 780:	50                   	push   %eax
+ 781:	57                   	push   %edi
+ 782:	e8 d1 fd ff ff       	call   558 <write>
+ 787:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 78a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 78d:	0f b6 1e             	movzbl (%esi),%ebx
+ 790:	83 c6 01             	add    $0x1,%esi
+ 793:	84 db                	test   %bl,%bl
+ 795:	74 29                	je     7c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 797:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 79a:	85 d2                	test   %edx,%edx
+ 79c:	74 ca                	je     768 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 79e:	83 fa 25             	cmp    $0x25,%edx
+ 7a1:	75 ea                	jne    78d <printf+0x4d>
+      if(c == 'd'){
+ 7a3:	83 f8 25             	cmp    $0x25,%eax
+ 7a6:	0f 84 24 01 00 00    	je     8d0 <printf+0x190>
+ 7ac:	83 e8 63             	sub    $0x63,%eax
+ 7af:	83 f8 15             	cmp    $0x15,%eax
+ 7b2:	77 1c                	ja     7d0 <printf+0x90>
+ 7b4:	ff 24 85 d4 0d 00 00 	jmp    *0xdd4(,%eax,4)
+ 7bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7c3:	5b                   	pop    %ebx
+ 7c4:	5e                   	pop    %esi
+ 7c5:	5f                   	pop    %edi
+ 7c6:	5d                   	pop    %ebp
+ 7c7:	c3                   	ret
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7da:	6a 01                	push   $0x1
+ 7dc:	52                   	push   %edx
+ 7dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7e0:	57                   	push   %edi
+ 7e1:	e8 72 fd ff ff       	call   558 <write>
+ 7e6:	83 c4 0c             	add    $0xc,%esp
+ 7e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ec:	6a 01                	push   $0x1
+ 7ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7f1:	52                   	push   %edx
+ 7f2:	57                   	push   %edi
+ 7f3:	e8 60 fd ff ff       	call   558 <write>
+        putc(fd, c);
+ 7f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7fb:	31 d2                	xor    %edx,%edx
+ 7fd:	eb 8e                	jmp    78d <printf+0x4d>
+ 7ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 00                	push   $0x0
+ 80f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 811:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 814:	e8 87 fe ff ff       	call   6a0 <printint>
+        ap++;
+ 819:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 81c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 67 ff ff ff       	jmp    78d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 830:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 833:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 835:	83 c0 04             	add    $0x4,%eax
+ 838:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 83b:	85 db                	test   %ebx,%ebx
+ 83d:	0f 84 9d 00 00 00    	je     8e0 <printf+0x1a0>
+        while(*s != 0){
+ 843:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 846:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 848:	84 c0                	test   %al,%al
+ 84a:	0f 84 3d ff ff ff    	je     78d <printf+0x4d>
+ 850:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 853:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 856:	89 de                	mov    %ebx,%esi
+ 858:	89 d3                	mov    %edx,%ebx
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 866:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 869:	6a 01                	push   $0x1
+ 86b:	53                   	push   %ebx
+ 86c:	57                   	push   %edi
+ 86d:	e8 e6 fc ff ff       	call   558 <write>
+        while(*s != 0){
+ 872:	0f b6 06             	movzbl (%esi),%eax
+ 875:	83 c4 10             	add    $0x10,%esp
+ 878:	84 c0                	test   %al,%al
+ 87a:	75 e4                	jne    860 <printf+0x120>
+      state = 0;
+ 87c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 07 ff ff ff       	jmp    78d <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 01                	push   $0x1
+ 89f:	e9 6b ff ff ff       	jmp    80f <printf+0xcf>
+ 8a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8ab:	83 ec 04             	sub    $0x4,%esp
+ 8ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	52                   	push   %edx
+ 8bc:	57                   	push   %edi
+ 8bd:	e8 96 fc ff ff       	call   558 <write>
+        ap++;
+ 8c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8c8:	31 d2                	xor    %edx,%edx
+ 8ca:	e9 be fe ff ff       	jmp    78d <printf+0x4d>
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d9:	6a 01                	push   $0x1
+ 8db:	e9 11 ff ff ff       	jmp    7f1 <printf+0xb1>
+ 8e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8e5:	bb cc 0d 00 00       	mov    $0xdcc,%ebx
+ 8ea:	e9 61 ff ff ff       	jmp    850 <printf+0x110>
+ 8ef:	90                   	nop
+
+000008f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f1:	a1 f4 11 00 00       	mov    0x11f4,%eax
+{
+ 8f6:	89 e5                	mov    %esp,%ebp
+ 8f8:	57                   	push   %edi
+ 8f9:	56                   	push   %esi
+ 8fa:	53                   	push   %ebx
+ 8fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 908:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 90a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 90c:	39 ca                	cmp    %ecx,%edx
+ 90e:	73 30                	jae    940 <free+0x50>
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 04                	jb     918 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 914:	39 c2                	cmp    %eax,%edx
+ 916:	72 f0                	jb     908 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 918:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 91b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 91e:	39 f8                	cmp    %edi,%eax
+ 920:	74 2e                	je     950 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 922:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 925:	8b 42 04             	mov    0x4(%edx),%eax
+ 928:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 92b:	39 f1                	cmp    %esi,%ecx
+ 92d:	74 38                	je     967 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 92f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 931:	5b                   	pop    %ebx
+  freep = p;
+ 932:	89 15 f4 11 00 00    	mov    %edx,0x11f4
+}
+ 938:	5e                   	pop    %esi
+ 939:	5f                   	pop    %edi
+ 93a:	5d                   	pop    %ebp
+ 93b:	c3                   	ret
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 d0                	jb     914 <free+0x24>
+ 944:	eb c2                	jmp    908 <free+0x18>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 950:	03 70 04             	add    0x4(%eax),%esi
+ 953:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 956:	8b 02                	mov    (%edx),%eax
+ 958:	8b 00                	mov    (%eax),%eax
+ 95a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 95d:	8b 42 04             	mov    0x4(%edx),%eax
+ 960:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 963:	39 f1                	cmp    %esi,%ecx
+ 965:	75 c8                	jne    92f <free+0x3f>
+    p->s.size += bp->s.size;
+ 967:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 96a:	89 15 f4 11 00 00    	mov    %edx,0x11f4
+    p->s.size += bp->s.size;
+ 970:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 973:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 976:	89 0a                	mov    %ecx,(%edx)
+}
+ 978:	5b                   	pop    %ebx
+ 979:	5e                   	pop    %esi
+ 97a:	5f                   	pop    %edi
+ 97b:	5d                   	pop    %ebp
+ 97c:	c3                   	ret
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 989:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 98c:	8b 15 f4 11 00 00    	mov    0x11f4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 992:	8d 78 07             	lea    0x7(%eax),%edi
+ 995:	c1 ef 03             	shr    $0x3,%edi
+ 998:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 99b:	85 d2                	test   %edx,%edx
+ 99d:	0f 84 8d 00 00 00    	je     a30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9a8:	39 f9                	cmp    %edi,%ecx
+ 9aa:	73 64                	jae    a10 <malloc+0x90>
+  if(nu < 4096)
+ 9ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9b1:	39 df                	cmp    %ebx,%edi
+ 9b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9bd:	eb 0a                	jmp    9c9 <malloc+0x49>
+ 9bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9c5:	39 f9                	cmp    %edi,%ecx
+ 9c7:	73 47                	jae    a10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9c9:	89 c2                	mov    %eax,%edx
+ 9cb:	39 05 f4 11 00 00    	cmp    %eax,0x11f4
+ 9d1:	75 ed                	jne    9c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	56                   	push   %esi
+ 9d7:	e8 e4 fb ff ff       	call   5c0 <sbrk>
+  if(p == (char*)-1)
+ 9dc:	83 c4 10             	add    $0x10,%esp
+ 9df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9e2:	74 1c                	je     a00 <malloc+0x80>
+  hp->s.size = nu;
+ 9e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9e7:	83 ec 0c             	sub    $0xc,%esp
+ 9ea:	83 c0 08             	add    $0x8,%eax
+ 9ed:	50                   	push   %eax
+ 9ee:	e8 fd fe ff ff       	call   8f0 <free>
+  return freep;
+ 9f3:	8b 15 f4 11 00 00    	mov    0x11f4,%edx
+      if((p = morecore(nunits)) == 0)
+ 9f9:	83 c4 10             	add    $0x10,%esp
+ 9fc:	85 d2                	test   %edx,%edx
+ 9fe:	75 c0                	jne    9c0 <malloc+0x40>
+        return 0;
+  }
+}
+ a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a03:	31 c0                	xor    %eax,%eax
+}
+ a05:	5b                   	pop    %ebx
+ a06:	5e                   	pop    %esi
+ a07:	5f                   	pop    %edi
+ a08:	5d                   	pop    %ebp
+ a09:	c3                   	ret
+ a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a10:	39 cf                	cmp    %ecx,%edi
+ a12:	74 4c                	je     a60 <malloc+0xe0>
+        p->s.size -= nunits;
+ a14:	29 f9                	sub    %edi,%ecx
+ a16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a1f:	89 15 f4 11 00 00    	mov    %edx,0x11f4
+}
+ a25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a28:	83 c0 08             	add    $0x8,%eax
+}
+ a2b:	5b                   	pop    %ebx
+ a2c:	5e                   	pop    %esi
+ a2d:	5f                   	pop    %edi
+ a2e:	5d                   	pop    %ebp
+ a2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a30:	c7 05 f4 11 00 00 f8 	movl   $0x11f8,0x11f4
+ a37:	11 00 00 
+    base.s.size = 0;
+ a3a:	b8 f8 11 00 00       	mov    $0x11f8,%eax
+    base.s.ptr = freep = prevp = &base;
+ a3f:	c7 05 f8 11 00 00 f8 	movl   $0x11f8,0x11f8
+ a46:	11 00 00 
+    base.s.size = 0;
+ a49:	c7 05 fc 11 00 00 00 	movl   $0x0,0x11fc
+ a50:	00 00 00 
+    if(p->s.size >= nunits){
+ a53:	e9 54 ff ff ff       	jmp    9ac <malloc+0x2c>
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a60:	8b 08                	mov    (%eax),%ecx
+ a62:	89 0a                	mov    %ecx,(%edx)
+ a64:	eb b9                	jmp    a1f <malloc+0x9f>
+ a66:	66 90                	xchg   %ax,%ax
+ a68:	66 90                	xchg   %ax,%ax
+ a6a:	66 90                	xchg   %ax,%ax
+ a6c:	66 90                	xchg   %ax,%ax
+ a6e:	66 90                	xchg   %ax,%ax
+
+00000a70 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 20             	sub    $0x20,%esp
+ a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+ a7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ a7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a82:	68 e8 03 00 00       	push   $0x3e8
+ a87:	57                   	push   %edi
+ a88:	56                   	push   %esi
+ a89:	e8 e2 f9 ff ff       	call   470 <udiv64>
+ a8e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a90:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a93:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ a99:	29 c1                	sub    %eax,%ecx
+ a9b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a9e:	68 e8 03 00 00       	push   $0x3e8
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	e8 c6 f9 ff ff       	call   470 <udiv64>
+ aaa:	83 c4 0c             	add    $0xc,%esp
+ aad:	50                   	push   %eax
+ aae:	68 3d 0e 00 00       	push   $0xe3d
+ ab3:	53                   	push   %ebx
+ ab4:	e8 87 fc ff ff       	call   740 <printf>
+  if(frac < 100)
+ ab9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	83 f9 63             	cmp    $0x63,%ecx
+ ac2:	76 1c                	jbe    ae0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ ac4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ ac7:	c7 45 0c 43 0e 00 00 	movl   $0xe43,0xc(%ebp)
+ ace:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad4:	5b                   	pop    %ebx
+ ad5:	5e                   	pop    %esi
+ ad6:	5f                   	pop    %edi
+ ad7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ ad8:	e9 63 fc ff ff       	jmp    740 <printf>
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ ae0:	83 ec 08             	sub    $0x8,%esp
+ ae3:	68 41 0e 00 00       	push   $0xe41
+ ae8:	53                   	push   %ebx
+ ae9:	e8 52 fc ff ff       	call   740 <printf>
+  if(frac < 10)
+ aee:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ af1:	83 c4 10             	add    $0x10,%esp
+ af4:	83 f9 09             	cmp    $0x9,%ecx
+ af7:	77 cb                	ja     ac4 <printps+0x54>
+    printf(fd, "0");
+ af9:	83 ec 08             	sub    $0x8,%esp
+ afc:	68 41 0e 00 00       	push   $0xe41
+ b01:	53                   	push   %ebx
+ b02:	e8 39 fc ff ff       	call   740 <printf>
+ b07:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b0a:	83 c4 10             	add    $0x10,%esp
+ b0d:	eb b5                	jmp    ac4 <printps+0x54>
+ b0f:	90                   	nop
+
+00000b10 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ b1c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ b1f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ b22:	83 e8 01             	sub    $0x1,%eax
+ b25:	3d ff 00 00 00       	cmp    $0xff,%eax
+ b2a:	0f 87 37 02 00 00    	ja     d67 <bench+0x257>
+ b30:	8b 7d 14             	mov    0x14(%ebp),%edi
+ b33:	85 ff                	test   %edi,%edi
+ b35:	0f 84 2c 02 00 00    	je     d67 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ b3b:	83 ec 0c             	sub    $0xc,%esp
+ b3e:	ff 75 10             	push   0x10(%ebp)
+ b41:	ff 55 0c             	call   *0xc(%ebp)
+ b44:	5b                   	pop    %ebx
+ b45:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ b48:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ b4a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ b4d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ b50:	83 c4 10             	add    $0x10,%esp
+ b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b57:	90                   	nop
+    t0 = cycles();
+ b58:	e8 33 f9 ff ff       	call   490 <cycles>
+    fn(arg);
+ b5d:	83 ec 0c             	sub    $0xc,%esp
+ b60:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ b63:	89 c6                	mov    %eax,%esi
+ b65:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ b67:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ b6a:	e8 21 f9 ff ff       	call   490 <cycles>
+ b6f:	29 f0                	sub    %esi,%eax
+ b71:	19 fa                	sbb    %edi,%edx
+ b73:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b7a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ b7d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b84:	83 c3 01             	add    $0x1,%ebx
+ b87:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ b8a:	7f cc                	jg     b58 <bench+0x48>
+  for(i = 1; i < n; i++){
+ b8c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ b90:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ b93:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ b99:	bf 01 00 00 00       	mov    $0x1,%edi
+ b9e:	74 77                	je     c17 <bench+0x107>
+ ba0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ba7:	90                   	nop
+    v = a[i];
+ ba8:	8b 01                	mov    (%ecx),%eax
+ baa:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ bad:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ bb3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ bb9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ bbf:	89 c8                	mov    %ecx,%eax
+ bc1:	eb 1b                	jmp    bde <bench+0xce>
+ bc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bc7:	90                   	nop
+      a[j] = a[j-1];
+ bc8:	89 08                	mov    %ecx,(%eax)
+ bca:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ bcd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ bd0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ bd6:	39 c3                	cmp    %eax,%ebx
+ bd8:	0f 84 72 01 00 00    	je     d50 <bench+0x240>
+ bde:	8b 50 fc             	mov    -0x4(%eax),%edx
+ be1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ be4:	89 f7                	mov    %esi,%edi
+ be6:	89 c3                	mov    %eax,%ebx
+ be8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ bee:	19 d7                	sbb    %edx,%edi
+ bf0:	72 d6                	jb     bc8 <bench+0xb8>
+ bf2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ bf8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ bfe:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ c04:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ c07:	83 c7 01             	add    $0x1,%edi
+ c0a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ c0d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ c0f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ c12:	75 94                	jne    ba8 <bench+0x98>
+ c14:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c17:	83 ec 08             	sub    $0x8,%esp
+ c1a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ c20:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ c25:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ c2b:	e8 70 f8 ff ff       	call   4a0 <cyc2ns>
+ c30:	83 c4 0c             	add    $0xc,%esp
+ c33:	ff 75 14             	push   0x14(%ebp)
+ c36:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c3c:	f7 e3                	mul    %ebx
+ c3e:	01 ca                	add    %ecx,%edx
+ c40:	52                   	push   %edx
+ c41:	50                   	push   %eax
+ c42:	e8 29 f8 ff ff       	call   470 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ c47:	89 06                	mov    %eax,(%esi)
+ c49:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c4c:	5f                   	pop    %edi
+ c4d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ c4e:	8b 45 18             	mov    0x18(%ebp),%eax
+ c51:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c53:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ c5a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ c61:	e8 3a f8 ff ff       	call   4a0 <cyc2ns>
+ c66:	83 c4 0c             	add    $0xc,%esp
+ c69:	ff 75 14             	push   0x14(%ebp)
+ c6c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c72:	f7 e3                	mul    %ebx
+ c74:	01 ca                	add    %ecx,%edx
+ c76:	52                   	push   %edx
+ c77:	50                   	push   %eax
+ c78:	e8 f3 f7 ff ff       	call   470 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ c7d:	89 46 08             	mov    %eax,0x8(%esi)
+ c80:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c83:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c84:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c87:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c88:	8d 50 01             	lea    0x1(%eax),%edx
+ c8b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ c90:	6b d2 63             	imul   $0x63,%edx,%edx
+ c93:	f7 e2                	mul    %edx
+ c95:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c98:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ c9f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ ca6:	e8 f5 f7 ff ff       	call   4a0 <cyc2ns>
+ cab:	83 c4 0c             	add    $0xc,%esp
+ cae:	ff 75 14             	push   0x14(%ebp)
+ cb1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ cb7:	f7 e3                	mul    %ebx
+ cb9:	01 ca                	add    %ecx,%edx
+ cbb:	52                   	push   %edx
+ cbc:	50                   	push   %eax
+ cbd:	e8 ae f7 ff ff       	call   470 <udiv64>
+
+  if(name){
+ cc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ cc5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ cc8:	89 46 10             	mov    %eax,0x10(%esi)
+ ccb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ cce:	85 c9                	test   %ecx,%ecx
+ cd0:	74 72                	je     d44 <bench+0x234>
+    printf(1, "%s: min ", name);
+ cd2:	83 ec 04             	sub    $0x4,%esp
+ cd5:	ff 75 08             	push   0x8(%ebp)
+ cd8:	68 46 0e 00 00       	push   $0xe46
+ cdd:	6a 01                	push   $0x1
+ cdf:	e8 5c fa ff ff       	call   740 <printf>
+    printps(1, st->min);
+ ce4:	83 c4 0c             	add    $0xc,%esp
+ ce7:	ff 76 04             	push   0x4(%esi)
+ cea:	ff 36                	push   (%esi)
+ cec:	6a 01                	push   $0x1
+ cee:	e8 7d fd ff ff       	call   a70 <printps>
+    printf(1, " median ");
+ cf3:	58                   	pop    %eax
+ cf4:	5a                   	pop    %edx
+ cf5:	68 4f 0e 00 00       	push   $0xe4f
+ cfa:	6a 01                	push   $0x1
+ cfc:	e8 3f fa ff ff       	call   740 <printf>
+    printps(1, st->median);
+ d01:	83 c4 0c             	add    $0xc,%esp
+ d04:	ff 76 0c             	push   0xc(%esi)
+ d07:	ff 76 08             	push   0x8(%esi)
+ d0a:	6a 01                	push   $0x1
+ d0c:	e8 5f fd ff ff       	call   a70 <printps>
+    printf(1, " p99 ");
+ d11:	59                   	pop    %ecx
+ d12:	5b                   	pop    %ebx
+ d13:	68 58 0e 00 00       	push   $0xe58
+ d18:	6a 01                	push   $0x1
+ d1a:	e8 21 fa ff ff       	call   740 <printf>
+    printps(1, st->p99);
+ d1f:	83 c4 0c             	add    $0xc,%esp
+ d22:	ff 76 14             	push   0x14(%esi)
+ d25:	ff 76 10             	push   0x10(%esi)
+ d28:	6a 01                	push   $0x1
+ d2a:	e8 41 fd ff ff       	call   a70 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ d2f:	83 c4 0c             	add    $0xc,%esp
+ d32:	ff 75 18             	push   0x18(%ebp)
+ d35:	68 5e 0e 00 00       	push   $0xe5e
+ d3a:	6a 01                	push   $0x1
+ d3c:	e8 ff f9 ff ff       	call   740 <printf>
+ d41:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ d44:	31 c0                	xor    %eax,%eax
+}
+ d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d49:	5b                   	pop    %ebx
+ d4a:	5e                   	pop    %esi
+ d4b:	5f                   	pop    %edi
+ d4c:	5d                   	pop    %ebp
+ d4d:	c3                   	ret
+ d4e:	66 90                	xchg   %ax,%ax
+ d50:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d56:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ d5c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d62:	e9 97 fe ff ff       	jmp    bfe <bench+0xee>
+    return -1;
+ d67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d6c:	eb d8                	jmp    d46 <bench+0x236>
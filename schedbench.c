@@ -0,0 +1,133 @@
+// Measure scheduler overhead, and what the switch path spends
+// waiting for ptable.lock as cpus are added.
+//   schedbench [procs-per-cpu]
+// For 1, 2, 4, ... cpus, starts procs-per-cpu (default 2)
+// processes per cpu, all confined to those cpus, that each call
+// yield() in a loop.  Reports the elapsed time per yield, the
+// total switch rate, and from the lock statistics (which it
+// resets) the time per yield spent waiting for ptable.lock and
+// the run queue locks, and how often ptable.lock was contended.
+// Every switch still takes ptable.lock, so its wait per yield
+// growing with cpus is the cost of that global lock.
+
+#include "types.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NYIELD  10000   // yields per process
+#define MAXCPU  8
+#define NCLASS  64
+
+static struct lockstat ls[NCLASS];
+
+static void
+worker(int fd)
+{
+  char c;
+  int i;
+
+  // Wait for the parent to close the pipe, so that every
+  // worker starts at once.
+  read(fd, &c, 1);
+  for(i = 0; i < NYIELD; i++)
+    yield();
+  exit();
+}
+
+// The counters of lock class name, or 0.
+static struct lockstat*
+lockclass(char *name, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(strcmp(ls[i].name, name) == 0)
+      return &ls[i];
+  return 0;
+}
+
+// Print the wait for lock class name per op, in ns.
+static void
+printwait(char *name, int n, uint ops)
+{
+  struct lockstat *l;
+
+  if((l = lockclass(name, n)) == 0 || ops == 0){
+    printf(1, "-");
+    return;
+  }
+  printps(1, udiv64(cyc2ns(l->wait) * 1000, ops));
+}
+
+static void
+run(int ncpu, int nproc)
+{
+  int fd[2], i, n, nls;
+  struct lockstat *l;
+  uint64 t0, ns;
+  uint ops, us;
+
+  if(pipe(fd) < 0){
+    printf(2, "schedbench: pipe failed\n");
+    exit();
+  }
+  // Children inherit the mask.
+  sched_setaffinity(0, (1 << ncpu) - 1);
+  for(n = 0; n < nproc; n++){
+    i = fork();
+    if(i < 0)
+      break;
+    if(i == 0){
+      close(fd[1]);
+      worker(fd[0]);
+    }
+  }
+  sched_setaffinity(0, ~0);
+  close(fd[0]);
+  lockstatreset();
+  t0 = cycles();
+  close(fd[1]);
+  for(i = 0; i < n; i++)
+    wait();
+  ns = cyc2ns(cycles() - t0);
+  nls = lockstat(ls, NCLASS);
+
+  ops = n * NYIELD;
+  us = udiv64(ns, 1000);
+  printf(1, "%d\t%d\t", ncpu, n);
+  printps(1, udiv64(ns * 1000, ops));
+  printf(1, "\t\t%d\t\t", us ? (uint)udiv64((uint64)ops * 1000000, us) : 0);
+  printwait("ptable", nls, ops);
+  printf(1, "\t\t");
+  l = lockclass("ptable", nls);
+  printf(1, "%d\t\t", l && l->nacquire ?
+         (uint)udiv64(l->ncontended * 100, (uint)l->nacquire) : 0);
+  printwait("runq", nls, ops);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int ncpu, n, per;
+
+  per = 2;
+  if(argc > 1)
+    per = atoi(argv[1]);
+  if(per < 1){
+    printf(2, "usage: schedbench [procs-per-cpu]\n");
+    exit();
+  }
+
+  // Find the cpus by trying to move onto each in turn.
+  for(ncpu = 0; ncpu < MAXCPU; ncpu++)
+    if(sched_setaffinity(0, 1 << ncpu) < 0)
+      break;
+  sched_setaffinity(0, ~0);
+
+  printf(1, "cpus\tprocs\tns/yield\tyields/sec\tptable ns/yield\tptable contended %%\trunq ns/yield\n");
+  for(n = 1; n < ncpu; n *= 2)
+    run(n, n * per);
+  run(ncpu, ncpu * per);
+  exit();
+}
@@ -0,0 +1,3591 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  struct cmd *cmd;
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 56 01 00 00    	jg     177 <main+0x177>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 51 1a 00 00       	push   $0x1a51
+      2b:	e8 88 11 00 00       	call   11b8 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 d0 19 00 00       	push   $0x19d0
+      48:	6a 02                	push   $0x2
+      4a:	e8 31 13 00 00       	call   1380 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 60 22 00 00       	push   $0x2260
+      5b:	e8 d0 0e 00 00       	call   f30 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 60 22 00 00       	push   $0x2260
+      69:	e8 22 0f 00 00       	call   f90 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 60 22 00 00 	movzbl 0x2260,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 f2 00 00 00    	je     172 <main+0x172>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	75 0d                	jne    91 <main+0x91>
+      84:	80 3d 61 22 00 00 64 	cmpb   $0x64,0x2261
+      8b:	0f 84 8f 00 00 00    	je     120 <main+0x120>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      if(chdir(buf+3) < 0)
+        printf(2, "cannot cd %s\n", buf+3);
+      continue;
+    }
+    if(simplecmd(buf)){
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	68 60 22 00 00       	push   $0x2260
+      99:	e8 22 07 00 00       	call   7c0 <simplecmd>
+      9e:	83 c4 10             	add    $0x10,%esp
+      a1:	85 c0                	test   %eax,%eax
+      a3:	75 23                	jne    c8 <main+0xc8>
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      a5:	e8 c6 10 00 00       	call   1170 <fork>
+  if(pid == -1)
+      aa:	83 f8 ff             	cmp    $0xffffffff,%eax
+      ad:	0f 84 ea 00 00 00    	je     19d <main+0x19d>
+    if(fork1() == 0)
+      b3:	85 c0                	test   %eax,%eax
+      b5:	0f 84 cd 00 00 00    	je     188 <main+0x188>
+    wait();
+      bb:	e8 c0 10 00 00       	call   1180 <wait>
+      c0:	e9 7b ff ff ff       	jmp    40 <main+0x40>
+      c5:	8d 76 00             	lea    0x0(%esi),%esi
+      cmd = parsecmd(buf);
+      c8:	83 ec 0c             	sub    $0xc,%esp
+      cb:	68 60 22 00 00       	push   $0x2260
+      d0:	e8 2b 0d 00 00       	call   e00 <parsecmd>
+      if(spawncmd(cmd) >= 0)
+      d5:	89 04 24             	mov    %eax,(%esp)
+      cmd = parsecmd(buf);
+      d8:	89 c3                	mov    %eax,%ebx
+      if(spawncmd(cmd) >= 0)
+      da:	e8 d1 00 00 00       	call   1b0 <spawncmd>
+      df:	83 c4 10             	add    $0x10,%esp
+      e2:	85 c0                	test   %eax,%eax
+      e4:	78 1b                	js     101 <main+0x101>
+        wait();
+      e6:	e8 95 10 00 00       	call   1180 <wait>
+  while(cmd->type == REDIR){
+      eb:	eb 14                	jmp    101 <main+0x101>
+      ed:	8d 76 00             	lea    0x0(%esi),%esi
+    sub = ((struct redircmd*)cmd)->cmd;
+      f0:	89 d8                	mov    %ebx,%eax
+    free(cmd);
+      f2:	83 ec 0c             	sub    $0xc,%esp
+    sub = ((struct redircmd*)cmd)->cmd;
+      f5:	8b 5b 04             	mov    0x4(%ebx),%ebx
+    free(cmd);
+      f8:	50                   	push   %eax
+      f9:	e8 32 14 00 00       	call   1530 <free>
+  while(cmd->type == REDIR){
+      fe:	83 c4 10             	add    $0x10,%esp
+     101:	83 3b 02             	cmpl   $0x2,(%ebx)
+     104:	74 ea                	je     f0 <main+0xf0>
+  free(cmd);
+     106:	83 ec 0c             	sub    $0xc,%esp
+     109:	53                   	push   %ebx
+     10a:	e8 21 14 00 00       	call   1530 <free>
+      continue;
+     10f:	83 c4 10             	add    $0x10,%esp
+     112:	e9 29 ff ff ff       	jmp    40 <main+0x40>
+     117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11e:	66 90                	xchg   %ax,%ax
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     120:	80 3d 62 22 00 00 20 	cmpb   $0x20,0x2262
+     127:	0f 85 64 ff ff ff    	jne    91 <main+0x91>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 60 22 00 00       	push   $0x2260
+     135:	e8 c6 0d 00 00       	call   f00 <strlen>
+      if(chdir(buf+3) < 0)
+     13a:	c7 04 24 63 22 00 00 	movl   $0x2263,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     141:	c6 80 5f 22 00 00 00 	movb   $0x0,0x225f(%eax)
+      if(chdir(buf+3) < 0)
+     148:	e8 9b 10 00 00       	call   11e8 <chdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	0f 89 e8 fe ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     158:	51                   	push   %ecx
+     159:	68 63 22 00 00       	push   $0x2263
+     15e:	68 59 1a 00 00       	push   $0x1a59
+     163:	6a 02                	push   $0x2
+     165:	e8 16 12 00 00       	call   1380 <printf>
+     16a:	83 c4 10             	add    $0x10,%esp
+     16d:	e9 ce fe ff ff       	jmp    40 <main+0x40>
+  exit();
+     172:	e8 01 10 00 00       	call   1178 <exit>
+      close(fd);
+     177:	83 ec 0c             	sub    $0xc,%esp
+     17a:	50                   	push   %eax
+     17b:	e8 20 10 00 00       	call   11a0 <close>
+      break;
+     180:	83 c4 10             	add    $0x10,%esp
+     183:	e9 b8 fe ff ff       	jmp    40 <main+0x40>
+      runcmd(parsecmd(buf));
+     188:	83 ec 0c             	sub    $0xc,%esp
+     18b:	68 60 22 00 00       	push   $0x2260
+     190:	e8 6b 0c 00 00       	call   e00 <parsecmd>
+     195:	89 04 24             	mov    %eax,(%esp)
+     198:	e8 f3 01 00 00       	call   390 <runcmd>
+    panic("fork");
+     19d:	83 ec 0c             	sub    $0xc,%esp
+     1a0:	68 d3 19 00 00       	push   $0x19d3
+     1a5:	e8 a6 01 00 00       	call   350 <panic>
+     1aa:	66 90                	xchg   %ax,%ax
+     1ac:	66 90                	xchg   %ax,%ax
+     1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <spawncmd>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	57                   	push   %edi
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	83 ec 5c             	sub    $0x5c,%esp
+     1b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(n = 0; cmd->type == REDIR; n++){
+     1bc:	83 3b 02             	cmpl   $0x2,(%ebx)
+     1bf:	0f 85 da 00 00 00    	jne    29f <spawncmd+0xef>
+     1c5:	31 ff                	xor    %edi,%edi
+     1c7:	eb 13                	jmp    1dc <spawncmd+0x2c>
+     1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cmd = rcmd[n]->cmd;
+     1d0:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  for(n = 0; cmd->type == REDIR; n++){
+     1d3:	83 3b 02             	cmpl   $0x2,(%ebx)
+     1d6:	0f 85 94 00 00 00    	jne    270 <spawncmd+0xc0>
+    save[n] = dup(rcmd[n]->fd);
+     1dc:	83 ec 0c             	sub    $0xc,%esp
+    rcmd[n] = (struct redircmd*)cmd;
+     1df:	89 5c bd 98          	mov    %ebx,-0x68(%ebp,%edi,4)
+    save[n] = dup(rcmd[n]->fd);
+     1e3:	89 fe                	mov    %edi,%esi
+     1e5:	ff 73 14             	push   0x14(%ebx)
+     1e8:	e8 03 10 00 00       	call   11f0 <dup>
+     1ed:	89 44 bd c0          	mov    %eax,-0x40(%ebp,%edi,4)
+    close(rcmd[n]->fd);
+     1f1:	58                   	pop    %eax
+      n++;
+     1f2:	8d 7f 01             	lea    0x1(%edi),%edi
+    close(rcmd[n]->fd);
+     1f5:	ff 73 14             	push   0x14(%ebx)
+     1f8:	e8 a3 0f 00 00       	call   11a0 <close>
+    if(open(rcmd[n]->file, rcmd[n]->mode) < 0){
+     1fd:	5a                   	pop    %edx
+     1fe:	59                   	pop    %ecx
+     1ff:	ff 73 10             	push   0x10(%ebx)
+     202:	ff 73 08             	push   0x8(%ebx)
+     205:	e8 ae 0f 00 00       	call   11b8 <open>
+     20a:	83 c4 10             	add    $0x10,%esp
+     20d:	85 c0                	test   %eax,%eax
+     20f:	79 bf                	jns    1d0 <spawncmd+0x20>
+      printf(2, "open %s failed\n", rcmd[n]->file);
+     211:	83 ec 04             	sub    $0x4,%esp
+     214:	ff 73 08             	push   0x8(%ebx)
+  pid = -1;
+     217:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+      printf(2, "open %s failed\n", rcmd[n]->file);
+     21c:	68 b0 19 00 00       	push   $0x19b0
+     221:	6a 02                	push   $0x2
+     223:	e8 58 11 00 00       	call   1380 <printf>
+     228:	83 c4 10             	add    $0x10,%esp
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+    close(rcmd[i]->fd);
+     230:	8b 44 b5 98          	mov    -0x68(%ebp,%esi,4),%eax
+     234:	83 ec 0c             	sub    $0xc,%esp
+     237:	ff 70 14             	push   0x14(%eax)
+     23a:	e8 61 0f 00 00       	call   11a0 <close>
+    if(save[i] >= 0){
+     23f:	8b 5c b5 c0          	mov    -0x40(%ebp,%esi,4),%ebx
+     243:	83 c4 10             	add    $0x10,%esp
+     246:	85 db                	test   %ebx,%ebx
+     248:	78 14                	js     25e <spawncmd+0xae>
+      dup(save[i]);
+     24a:	83 ec 0c             	sub    $0xc,%esp
+     24d:	53                   	push   %ebx
+     24e:	e8 9d 0f 00 00       	call   11f0 <dup>
+      close(save[i]);
+     253:	89 1c 24             	mov    %ebx,(%esp)
+     256:	e8 45 0f 00 00       	call   11a0 <close>
+     25b:	83 c4 10             	add    $0x10,%esp
+  for(i = n - 1; i >= 0; i--){
+     25e:	83 ee 01             	sub    $0x1,%esi
+     261:	73 cd                	jae    230 <spawncmd+0x80>
+}
+     263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     266:	89 f8                	mov    %edi,%eax
+     268:	5b                   	pop    %ebx
+     269:	5e                   	pop    %esi
+     26a:	5f                   	pop    %edi
+     26b:	5d                   	pop    %ebp
+     26c:	c3                   	ret
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+  if((pid = spawn(ecmd->argv[0], ecmd->argv)) < 0)
+     270:	83 ec 08             	sub    $0x8,%esp
+     273:	8d 43 04             	lea    0x4(%ebx),%eax
+     276:	50                   	push   %eax
+     277:	ff 73 04             	push   0x4(%ebx)
+     27a:	e8 49 10 00 00       	call   12c8 <spawn>
+     27f:	83 c4 10             	add    $0x10,%esp
+     282:	89 c7                	mov    %eax,%edi
+     284:	85 c0                	test   %eax,%eax
+     286:	79 a8                	jns    230 <spawncmd+0x80>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     288:	83 ec 04             	sub    $0x4,%esp
+     28b:	ff 73 04             	push   0x4(%ebx)
+     28e:	68 c0 19 00 00       	push   $0x19c0
+     293:	6a 02                	push   $0x2
+     295:	e8 e6 10 00 00       	call   1380 <printf>
+     29a:	83 c4 10             	add    $0x10,%esp
+  for(i = n - 1; i >= 0; i--){
+     29d:	eb 91                	jmp    230 <spawncmd+0x80>
+  if((pid = spawn(ecmd->argv[0], ecmd->argv)) < 0)
+     29f:	83 ec 08             	sub    $0x8,%esp
+     2a2:	8d 43 04             	lea    0x4(%ebx),%eax
+     2a5:	50                   	push   %eax
+     2a6:	ff 73 04             	push   0x4(%ebx)
+     2a9:	e8 1a 10 00 00       	call   12c8 <spawn>
+     2ae:	83 c4 10             	add    $0x10,%esp
+     2b1:	89 c7                	mov    %eax,%edi
+     2b3:	85 c0                	test   %eax,%eax
+     2b5:	79 ac                	jns    263 <spawncmd+0xb3>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     2b7:	83 ec 04             	sub    $0x4,%esp
+     2ba:	ff 73 04             	push   0x4(%ebx)
+     2bd:	68 c0 19 00 00       	push   $0x19c0
+     2c2:	6a 02                	push   $0x2
+     2c4:	e8 b7 10 00 00       	call   1380 <printf>
+     2c9:	83 c4 10             	add    $0x10,%esp
+     2cc:	eb 95                	jmp    263 <spawncmd+0xb3>
+     2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <freecmd>:
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	53                   	push   %ebx
+     2d4:	83 ec 04             	sub    $0x4,%esp
+     2d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while(cmd->type == REDIR){
+     2da:	83 3b 02             	cmpl   $0x2,(%ebx)
+     2dd:	75 17                	jne    2f6 <freecmd+0x26>
+     2df:	90                   	nop
+    free(cmd);
+     2e0:	83 ec 0c             	sub    $0xc,%esp
+     2e3:	89 d8                	mov    %ebx,%eax
+    sub = ((struct redircmd*)cmd)->cmd;
+     2e5:	8b 5b 04             	mov    0x4(%ebx),%ebx
+    free(cmd);
+     2e8:	50                   	push   %eax
+     2e9:	e8 42 12 00 00       	call   1530 <free>
+  while(cmd->type == REDIR){
+     2ee:	83 c4 10             	add    $0x10,%esp
+     2f1:	83 3b 02             	cmpl   $0x2,(%ebx)
+     2f4:	74 ea                	je     2e0 <freecmd+0x10>
+  free(cmd);
+     2f6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     2f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2fc:	c9                   	leave
+  free(cmd);
+     2fd:	e9 2e 12 00 00       	jmp    1530 <free>
+     302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <getcmd>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	56                   	push   %esi
+     314:	53                   	push   %ebx
+     315:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     318:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	68 d0 19 00 00       	push   $0x19d0
+     323:	6a 02                	push   $0x2
+     325:	e8 56 10 00 00       	call   1380 <printf>
+  memset(buf, 0, nbuf);
+     32a:	83 c4 0c             	add    $0xc,%esp
+     32d:	56                   	push   %esi
+     32e:	6a 00                	push   $0x0
+     330:	53                   	push   %ebx
+     331:	e8 fa 0b 00 00       	call   f30 <memset>
+  gets(buf, nbuf);
+     336:	58                   	pop    %eax
+     337:	5a                   	pop    %edx
+     338:	56                   	push   %esi
+     339:	53                   	push   %ebx
+     33a:	e8 51 0c 00 00       	call   f90 <gets>
+  if(buf[0] == 0) // EOF
+     33f:	83 c4 10             	add    $0x10,%esp
+     342:	80 3b 01             	cmpb   $0x1,(%ebx)
+     345:	19 c0                	sbb    %eax,%eax
+}
+     347:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     34a:	5b                   	pop    %ebx
+     34b:	5e                   	pop    %esi
+     34c:	5d                   	pop    %ebp
+     34d:	c3                   	ret
+     34e:	66 90                	xchg   %ax,%ax
+
+00000350 <panic>:
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     356:	ff 75 08             	push   0x8(%ebp)
+     359:	68 4d 1a 00 00       	push   $0x1a4d
+     35e:	6a 02                	push   $0x2
+     360:	e8 1b 10 00 00       	call   1380 <printf>
+  exit();
+     365:	e8 0e 0e 00 00       	call   1178 <exit>
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <fork1>:
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     376:	e8 f5 0d 00 00       	call   1170 <fork>
+  if(pid == -1)
+     37b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     37e:	74 02                	je     382 <fork1+0x12>
+  return pid;
+}
+     380:	c9                   	leave
+     381:	c3                   	ret
+    panic("fork");
+     382:	83 ec 0c             	sub    $0xc,%esp
+     385:	68 d3 19 00 00       	push   $0x19d3
+     38a:	e8 c1 ff ff ff       	call   350 <panic>
+     38f:	90                   	nop
+
+00000390 <runcmd>:
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	53                   	push   %ebx
+     394:	83 ec 14             	sub    $0x14,%esp
+     397:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     39a:	85 db                	test   %ebx,%ebx
+     39c:	74 42                	je     3e0 <runcmd+0x50>
+  switch(cmd->type){
+     39e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     3a1:	0f 87 e3 00 00 00    	ja     48a <runcmd+0xfa>
+     3a7:	8b 03                	mov    (%ebx),%eax
+     3a9:	ff 24 85 68 1a 00 00 	jmp    *0x1a68(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     3b0:	8b 43 04             	mov    0x4(%ebx),%eax
+     3b3:	85 c0                	test   %eax,%eax
+     3b5:	74 29                	je     3e0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     3b7:	8d 53 04             	lea    0x4(%ebx),%edx
+     3ba:	51                   	push   %ecx
+     3bb:	51                   	push   %ecx
+     3bc:	52                   	push   %edx
+     3bd:	50                   	push   %eax
+     3be:	e8 ed 0d 00 00       	call   11b0 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     3c3:	83 c4 0c             	add    $0xc,%esp
+     3c6:	ff 73 04             	push   0x4(%ebx)
+     3c9:	68 c0 19 00 00       	push   $0x19c0
+     3ce:	6a 02                	push   $0x2
+     3d0:	e8 ab 0f 00 00       	call   1380 <printf>
+    break;
+     3d5:	83 c4 10             	add    $0x10,%esp
+     3d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3df:	90                   	nop
+    exit();
+     3e0:	e8 93 0d 00 00       	call   1178 <exit>
+    if(fork1() == 0)
+     3e5:	e8 86 ff ff ff       	call   370 <fork1>
+     3ea:	85 c0                	test   %eax,%eax
+     3ec:	75 f2                	jne    3e0 <runcmd+0x50>
+     3ee:	e9 8c 00 00 00       	jmp    47f <runcmd+0xef>
+    if(pipe(p) < 0)
+     3f3:	83 ec 0c             	sub    $0xc,%esp
+     3f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     3f9:	50                   	push   %eax
+     3fa:	e8 89 0d 00 00       	call   1188 <pipe>
+     3ff:	83 c4 10             	add    $0x10,%esp
+     402:	85 c0                	test   %eax,%eax
+     404:	0f 88 a2 00 00 00    	js     4ac <runcmd+0x11c>
+    if(fork1() == 0){
+     40a:	e8 61 ff ff ff       	call   370 <fork1>
+     40f:	85 c0                	test   %eax,%eax
+     411:	0f 84 a2 00 00 00    	je     4b9 <runcmd+0x129>
+    if(fork1() == 0){
+     417:	e8 54 ff ff ff       	call   370 <fork1>
+     41c:	85 c0                	test   %eax,%eax
+     41e:	0f 84 c3 00 00 00    	je     4e7 <runcmd+0x157>
+    close(p[0]);
+     424:	83 ec 0c             	sub    $0xc,%esp
+     427:	ff 75 f0             	push   -0x10(%ebp)
+     42a:	e8 71 0d 00 00       	call   11a0 <close>
+    close(p[1]);
+     42f:	58                   	pop    %eax
+     430:	ff 75 f4             	push   -0xc(%ebp)
+     433:	e8 68 0d 00 00       	call   11a0 <close>
+    wait();
+     438:	e8 43 0d 00 00       	call   1180 <wait>
+    wait();
+     43d:	e8 3e 0d 00 00       	call   1180 <wait>
+    break;
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	eb 99                	jmp    3e0 <runcmd+0x50>
+    if(fork1() == 0)
+     447:	e8 24 ff ff ff       	call   370 <fork1>
+     44c:	85 c0                	test   %eax,%eax
+     44e:	74 2f                	je     47f <runcmd+0xef>
+    wait();
+     450:	e8 2b 0d 00 00       	call   1180 <wait>
+    runcmd(lcmd->right);
+     455:	83 ec 0c             	sub    $0xc,%esp
+     458:	ff 73 08             	push   0x8(%ebx)
+     45b:	e8 30 ff ff ff       	call   390 <runcmd>
+    close(rcmd->fd);
+     460:	83 ec 0c             	sub    $0xc,%esp
+     463:	ff 73 14             	push   0x14(%ebx)
+     466:	e8 35 0d 00 00       	call   11a0 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     46b:	58                   	pop    %eax
+     46c:	5a                   	pop    %edx
+     46d:	ff 73 10             	push   0x10(%ebx)
+     470:	ff 73 08             	push   0x8(%ebx)
+     473:	e8 40 0d 00 00       	call   11b8 <open>
+     478:	83 c4 10             	add    $0x10,%esp
+     47b:	85 c0                	test   %eax,%eax
+     47d:	78 18                	js     497 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     47f:	83 ec 0c             	sub    $0xc,%esp
+     482:	ff 73 04             	push   0x4(%ebx)
+     485:	e8 06 ff ff ff       	call   390 <runcmd>
+    panic("runcmd");
+     48a:	83 ec 0c             	sub    $0xc,%esp
+     48d:	68 d8 19 00 00       	push   $0x19d8
+     492:	e8 b9 fe ff ff       	call   350 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     497:	51                   	push   %ecx
+     498:	ff 73 08             	push   0x8(%ebx)
+     49b:	68 b0 19 00 00       	push   $0x19b0
+     4a0:	6a 02                	push   $0x2
+     4a2:	e8 d9 0e 00 00       	call   1380 <printf>
+      exit();
+     4a7:	e8 cc 0c 00 00       	call   1178 <exit>
+      panic("pipe");
+     4ac:	83 ec 0c             	sub    $0xc,%esp
+     4af:	68 df 19 00 00       	push   $0x19df
+     4b4:	e8 97 fe ff ff       	call   350 <panic>
+      close(1);
+     4b9:	83 ec 0c             	sub    $0xc,%esp
+     4bc:	6a 01                	push   $0x1
+     4be:	e8 dd 0c 00 00       	call   11a0 <close>
+      dup(p[1]);
+     4c3:	58                   	pop    %eax
+     4c4:	ff 75 f4             	push   -0xc(%ebp)
+     4c7:	e8 24 0d 00 00       	call   11f0 <dup>
+      close(p[0]);
+     4cc:	58                   	pop    %eax
+     4cd:	ff 75 f0             	push   -0x10(%ebp)
+     4d0:	e8 cb 0c 00 00       	call   11a0 <close>
+      close(p[1]);
+     4d5:	58                   	pop    %eax
+     4d6:	ff 75 f4             	push   -0xc(%ebp)
+     4d9:	e8 c2 0c 00 00       	call   11a0 <close>
+      runcmd(pcmd->left);
+     4de:	5a                   	pop    %edx
+     4df:	ff 73 04             	push   0x4(%ebx)
+     4e2:	e8 a9 fe ff ff       	call   390 <runcmd>
+      close(0);
+     4e7:	83 ec 0c             	sub    $0xc,%esp
+     4ea:	6a 00                	push   $0x0
+     4ec:	e8 af 0c 00 00       	call   11a0 <close>
+      dup(p[0]);
+     4f1:	5a                   	pop    %edx
+     4f2:	ff 75 f0             	push   -0x10(%ebp)
+     4f5:	e8 f6 0c 00 00       	call   11f0 <dup>
+      close(p[0]);
+     4fa:	59                   	pop    %ecx
+     4fb:	ff 75 f0             	push   -0x10(%ebp)
+     4fe:	e8 9d 0c 00 00       	call   11a0 <close>
+      close(p[1]);
+     503:	58                   	pop    %eax
+     504:	ff 75 f4             	push   -0xc(%ebp)
+     507:	e8 94 0c 00 00       	call   11a0 <close>
+      runcmd(pcmd->right);
+     50c:	58                   	pop    %eax
+     50d:	ff 73 08             	push   0x8(%ebx)
+     510:	e8 7b fe ff ff       	call   390 <runcmd>
+     515:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	53                   	push   %ebx
+     524:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     527:	6a 54                	push   $0x54
+     529:	e8 92 10 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     52e:	83 c4 0c             	add    $0xc,%esp
+     531:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     533:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     535:	6a 00                	push   $0x0
+     537:	50                   	push   %eax
+     538:	e8 f3 09 00 00       	call   f30 <memset>
+  cmd->type = EXEC;
+     53d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     543:	89 d8                	mov    %ebx,%eax
+     545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     548:	c9                   	leave
+     549:	c3                   	ret
+     54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000550 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	53                   	push   %ebx
+     554:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     557:	6a 18                	push   $0x18
+     559:	e8 62 10 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     55e:	83 c4 0c             	add    $0xc,%esp
+     561:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     563:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     565:	6a 00                	push   $0x0
+     567:	50                   	push   %eax
+     568:	e8 c3 09 00 00       	call   f30 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     56d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     570:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     576:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     579:	8b 45 0c             	mov    0xc(%ebp),%eax
+     57c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     57f:	8b 45 10             	mov    0x10(%ebp),%eax
+     582:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     585:	8b 45 14             	mov    0x14(%ebp),%eax
+     588:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     58b:	8b 45 18             	mov    0x18(%ebp),%eax
+     58e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     591:	89 d8                	mov    %ebx,%eax
+     593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     596:	c9                   	leave
+     597:	c3                   	ret
+     598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+
+000005a0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	53                   	push   %ebx
+     5a4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5a7:	6a 0c                	push   $0xc
+     5a9:	e8 12 10 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5ae:	83 c4 0c             	add    $0xc,%esp
+     5b1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     5b3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5b5:	6a 00                	push   $0x0
+     5b7:	50                   	push   %eax
+     5b8:	e8 73 09 00 00       	call   f30 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     5bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     5c0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     5c6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5cc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     5cf:	89 d8                	mov    %ebx,%eax
+     5d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5d4:	c9                   	leave
+     5d5:	c3                   	ret
+     5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	53                   	push   %ebx
+     5e4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5e7:	6a 0c                	push   $0xc
+     5e9:	e8 d2 0f 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5ee:	83 c4 0c             	add    $0xc,%esp
+     5f1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     5f3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5f5:	6a 00                	push   $0x0
+     5f7:	50                   	push   %eax
+     5f8:	e8 33 09 00 00       	call   f30 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     5fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     600:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     606:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     609:	8b 45 0c             	mov    0xc(%ebp),%eax
+     60c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     60f:	89 d8                	mov    %ebx,%eax
+     611:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     614:	c9                   	leave
+     615:	c3                   	ret
+     616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	53                   	push   %ebx
+     624:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     627:	6a 08                	push   $0x8
+     629:	e8 92 0f 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     62e:	83 c4 0c             	add    $0xc,%esp
+     631:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     633:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     635:	6a 00                	push   $0x0
+     637:	50                   	push   %eax
+     638:	e8 f3 08 00 00       	call   f30 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     63d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     640:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     646:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     649:	89 d8                	mov    %ebx,%eax
+     64b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     64e:	c9                   	leave
+     64f:	c3                   	ret
+
+00000650 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     659:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     65c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     65f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     662:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     664:	39 df                	cmp    %ebx,%edi
+     666:	72 0f                	jb     677 <gettoken+0x27>
+     668:	eb 25                	jmp    68f <gettoken+0x3f>
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     670:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     673:	39 fb                	cmp    %edi,%ebx
+     675:	74 18                	je     68f <gettoken+0x3f>
+     677:	0f be 07             	movsbl (%edi),%eax
+     67a:	83 ec 08             	sub    $0x8,%esp
+     67d:	50                   	push   %eax
+     67e:	68 58 22 00 00       	push   $0x2258
+     683:	e8 c8 08 00 00       	call   f50 <strchr>
+     688:	83 c4 10             	add    $0x10,%esp
+     68b:	85 c0                	test   %eax,%eax
+     68d:	75 e1                	jne    670 <gettoken+0x20>
+  if(q)
+     68f:	85 f6                	test   %esi,%esi
+     691:	74 02                	je     695 <gettoken+0x45>
+    *q = s;
+     693:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     695:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     698:	3c 3c                	cmp    $0x3c,%al
+     69a:	0f 8f d0 00 00 00    	jg     770 <gettoken+0x120>
+     6a0:	3c 3a                	cmp    $0x3a,%al
+     6a2:	0f 8f bc 00 00 00    	jg     764 <gettoken+0x114>
+     6a8:	84 c0                	test   %al,%al
+     6aa:	75 44                	jne    6f0 <gettoken+0xa0>
+     6ac:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     6ae:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     6b1:	85 c9                	test   %ecx,%ecx
+     6b3:	74 05                	je     6ba <gettoken+0x6a>
+    *eq = s;
+     6b5:	8b 45 14             	mov    0x14(%ebp),%eax
+     6b8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     6ba:	39 df                	cmp    %ebx,%edi
+     6bc:	72 09                	jb     6c7 <gettoken+0x77>
+     6be:	eb 1f                	jmp    6df <gettoken+0x8f>
+    s++;
+     6c0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     6c3:	39 fb                	cmp    %edi,%ebx
+     6c5:	74 18                	je     6df <gettoken+0x8f>
+     6c7:	0f be 07             	movsbl (%edi),%eax
+     6ca:	83 ec 08             	sub    $0x8,%esp
+     6cd:	50                   	push   %eax
+     6ce:	68 58 22 00 00       	push   $0x2258
+     6d3:	e8 78 08 00 00       	call   f50 <strchr>
+     6d8:	83 c4 10             	add    $0x10,%esp
+     6db:	85 c0                	test   %eax,%eax
+     6dd:	75 e1                	jne    6c0 <gettoken+0x70>
+  *ps = s;
+     6df:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     6e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6e7:	89 f0                	mov    %esi,%eax
+     6e9:	5b                   	pop    %ebx
+     6ea:	5e                   	pop    %esi
+     6eb:	5f                   	pop    %edi
+     6ec:	5d                   	pop    %ebp
+     6ed:	c3                   	ret
+     6ee:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     6f0:	79 66                	jns    758 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6f2:	39 df                	cmp    %ebx,%edi
+     6f4:	72 39                	jb     72f <gettoken+0xdf>
+  if(eq)
+     6f6:	8b 55 14             	mov    0x14(%ebp),%edx
+     6f9:	85 d2                	test   %edx,%edx
+     6fb:	0f 84 b3 00 00 00    	je     7b4 <gettoken+0x164>
+    *eq = s;
+     701:	8b 45 14             	mov    0x14(%ebp),%eax
+     704:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     706:	e9 a9 00 00 00       	jmp    7b4 <gettoken+0x164>
+     70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     710:	0f be 07             	movsbl (%edi),%eax
+     713:	83 ec 08             	sub    $0x8,%esp
+     716:	50                   	push   %eax
+     717:	68 50 22 00 00       	push   $0x2250
+     71c:	e8 2f 08 00 00       	call   f50 <strchr>
+     721:	83 c4 10             	add    $0x10,%esp
+     724:	85 c0                	test   %eax,%eax
+     726:	75 1f                	jne    747 <gettoken+0xf7>
+      s++;
+     728:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     72b:	39 fb                	cmp    %edi,%ebx
+     72d:	74 77                	je     7a6 <gettoken+0x156>
+     72f:	0f be 07             	movsbl (%edi),%eax
+     732:	83 ec 08             	sub    $0x8,%esp
+     735:	50                   	push   %eax
+     736:	68 58 22 00 00       	push   $0x2258
+     73b:	e8 10 08 00 00       	call   f50 <strchr>
+     740:	83 c4 10             	add    $0x10,%esp
+     743:	85 c0                	test   %eax,%eax
+     745:	74 c9                	je     710 <gettoken+0xc0>
+    ret = 'a';
+     747:	be 61 00 00 00       	mov    $0x61,%esi
+     74c:	e9 5d ff ff ff       	jmp    6ae <gettoken+0x5e>
+     751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     758:	3c 26                	cmp    $0x26,%al
+     75a:	74 08                	je     764 <gettoken+0x114>
+     75c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     75f:	80 f9 01             	cmp    $0x1,%cl
+     762:	77 8e                	ja     6f2 <gettoken+0xa2>
+  ret = *s;
+     764:	0f be f0             	movsbl %al,%esi
+    s++;
+     767:	83 c7 01             	add    $0x1,%edi
+    break;
+     76a:	e9 3f ff ff ff       	jmp    6ae <gettoken+0x5e>
+     76f:	90                   	nop
+  switch(*s){
+     770:	3c 3e                	cmp    $0x3e,%al
+     772:	75 1c                	jne    790 <gettoken+0x140>
+    if(*s == '>'){
+     774:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     778:	74 1f                	je     799 <gettoken+0x149>
+    s++;
+     77a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     77d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     782:	e9 27 ff ff ff       	jmp    6ae <gettoken+0x5e>
+     787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     790:	3c 7c                	cmp    $0x7c,%al
+     792:	74 d0                	je     764 <gettoken+0x114>
+     794:	e9 59 ff ff ff       	jmp    6f2 <gettoken+0xa2>
+      s++;
+     799:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     79c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     7a1:	e9 08 ff ff ff       	jmp    6ae <gettoken+0x5e>
+  if(eq)
+     7a6:	8b 45 14             	mov    0x14(%ebp),%eax
+     7a9:	85 c0                	test   %eax,%eax
+     7ab:	74 05                	je     7b2 <gettoken+0x162>
+    *eq = s;
+     7ad:	8b 45 14             	mov    0x14(%ebp),%eax
+     7b0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     7b2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     7b4:	be 61 00 00 00       	mov    $0x61,%esi
+     7b9:	e9 21 ff ff ff       	jmp    6df <gettoken+0x8f>
+     7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <simplecmd>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	57                   	push   %edi
+    switch(tok){
+     7c4:	bf 01 00 0a 00       	mov    $0xa0001,%edi
+{
+     7c9:	56                   	push   %esi
+     7ca:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+     7cd:	53                   	push   %ebx
+     7ce:	83 ec 38             	sub    $0x38,%esp
+     7d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  s = buf;
+     7d4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  es = s + strlen(s);
+     7d7:	53                   	push   %ebx
+     7d8:	e8 23 07 00 00       	call   f00 <strlen>
+  argc = nredir = 0;
+     7dd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  while((tok = gettoken(&s, es, 0, 0)) != 0){
+     7e4:	83 c4 10             	add    $0x10,%esp
+  argc = nredir = 0;
+     7e7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  es = s + strlen(s);
+     7ee:	01 c3                	add    %eax,%ebx
+  while((tok = gettoken(&s, es, 0, 0)) != 0){
+     7f0:	6a 00                	push   $0x0
+     7f2:	6a 00                	push   $0x0
+     7f4:	53                   	push   %ebx
+     7f5:	56                   	push   %esi
+     7f6:	e8 55 fe ff ff       	call   650 <gettoken>
+     7fb:	83 c4 10             	add    $0x10,%esp
+     7fe:	85 c0                	test   %eax,%eax
+     800:	74 66                	je     868 <simplecmd+0xa8>
+    switch(tok){
+     802:	83 f8 3e             	cmp    $0x3e,%eax
+     805:	7f 49                	jg     850 <simplecmd+0x90>
+     807:	83 f8 2a             	cmp    $0x2a,%eax
+     80a:	7f 14                	jg     820 <simplecmd+0x60>
+        return 0;
+     80c:	31 c0                	xor    %eax,%eax
+}
+     80e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     811:	5b                   	pop    %ebx
+     812:	5e                   	pop    %esi
+     813:	5f                   	pop    %edi
+     814:	5d                   	pop    %ebp
+     815:	c3                   	ret
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(tok){
+     820:	83 e8 2b             	sub    $0x2b,%eax
+     823:	0f a3 c7             	bt     %eax,%edi
+     826:	73 e4                	jae    80c <simplecmd+0x4c>
+      if(++nredir >= MAXARGS || gettoken(&s, es, 0, 0) != 'a')
+     828:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+     82c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     82f:	83 f8 09             	cmp    $0x9,%eax
+     832:	7f d8                	jg     80c <simplecmd+0x4c>
+     834:	6a 00                	push   $0x0
+     836:	6a 00                	push   $0x0
+     838:	53                   	push   %ebx
+     839:	56                   	push   %esi
+     83a:	e8 11 fe ff ff       	call   650 <gettoken>
+     83f:	83 c4 10             	add    $0x10,%esp
+     842:	83 f8 61             	cmp    $0x61,%eax
+     845:	74 a9                	je     7f0 <simplecmd+0x30>
+     847:	eb c3                	jmp    80c <simplecmd+0x4c>
+     849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(tok){
+     850:	83 f8 61             	cmp    $0x61,%eax
+     853:	75 b7                	jne    80c <simplecmd+0x4c>
+      if(++argc >= MAXARGS)
+     855:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+     859:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     85c:	83 f8 09             	cmp    $0x9,%eax
+     85f:	7e 8f                	jle    7f0 <simplecmd+0x30>
+     861:	eb a9                	jmp    80c <simplecmd+0x4c>
+     863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     867:	90                   	nop
+  return argc > 0;
+     868:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     86b:	31 c0                	xor    %eax,%eax
+     86d:	85 d2                	test   %edx,%edx
+     86f:	0f 9f c0             	setg   %al
+     872:	eb 9a                	jmp    80e <simplecmd+0x4e>
+     874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+
+00000880 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	57                   	push   %edi
+     884:	56                   	push   %esi
+     885:	53                   	push   %ebx
+     886:	83 ec 0c             	sub    $0xc,%esp
+     889:	8b 7d 08             	mov    0x8(%ebp),%edi
+     88c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     88f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     891:	39 f3                	cmp    %esi,%ebx
+     893:	72 12                	jb     8a7 <peek+0x27>
+     895:	eb 28                	jmp    8bf <peek+0x3f>
+     897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89e:	66 90                	xchg   %ax,%ax
+    s++;
+     8a0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     8a3:	39 de                	cmp    %ebx,%esi
+     8a5:	74 18                	je     8bf <peek+0x3f>
+     8a7:	0f be 03             	movsbl (%ebx),%eax
+     8aa:	83 ec 08             	sub    $0x8,%esp
+     8ad:	50                   	push   %eax
+     8ae:	68 58 22 00 00       	push   $0x2258
+     8b3:	e8 98 06 00 00       	call   f50 <strchr>
+     8b8:	83 c4 10             	add    $0x10,%esp
+     8bb:	85 c0                	test   %eax,%eax
+     8bd:	75 e1                	jne    8a0 <peek+0x20>
+  *ps = s;
+     8bf:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     8c1:	0f be 03             	movsbl (%ebx),%eax
+     8c4:	31 d2                	xor    %edx,%edx
+     8c6:	84 c0                	test   %al,%al
+     8c8:	75 0e                	jne    8d8 <peek+0x58>
+}
+     8ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8cd:	89 d0                	mov    %edx,%eax
+     8cf:	5b                   	pop    %ebx
+     8d0:	5e                   	pop    %esi
+     8d1:	5f                   	pop    %edi
+     8d2:	5d                   	pop    %ebp
+     8d3:	c3                   	ret
+     8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     8d8:	83 ec 08             	sub    $0x8,%esp
+     8db:	50                   	push   %eax
+     8dc:	ff 75 10             	push   0x10(%ebp)
+     8df:	e8 6c 06 00 00       	call   f50 <strchr>
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	31 d2                	xor    %edx,%edx
+     8e9:	85 c0                	test   %eax,%eax
+     8eb:	0f 95 c2             	setne  %dl
+}
+     8ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f1:	5b                   	pop    %ebx
+     8f2:	89 d0                	mov    %edx,%eax
+     8f4:	5e                   	pop    %esi
+     8f5:	5f                   	pop    %edi
+     8f6:	5d                   	pop    %ebp
+     8f7:	c3                   	ret
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+
+00000900 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	83 ec 2c             	sub    $0x2c,%esp
+     909:	8b 75 0c             	mov    0xc(%ebp),%esi
+     90c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     90f:	90                   	nop
+     910:	83 ec 04             	sub    $0x4,%esp
+     913:	68 01 1a 00 00       	push   $0x1a01
+     918:	53                   	push   %ebx
+     919:	56                   	push   %esi
+     91a:	e8 61 ff ff ff       	call   880 <peek>
+     91f:	83 c4 10             	add    $0x10,%esp
+     922:	85 c0                	test   %eax,%eax
+     924:	0f 84 f6 00 00 00    	je     a20 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     92a:	6a 00                	push   $0x0
+     92c:	6a 00                	push   $0x0
+     92e:	53                   	push   %ebx
+     92f:	56                   	push   %esi
+     930:	e8 1b fd ff ff       	call   650 <gettoken>
+     935:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     937:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     93a:	50                   	push   %eax
+     93b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     93e:	50                   	push   %eax
+     93f:	53                   	push   %ebx
+     940:	56                   	push   %esi
+     941:	e8 0a fd ff ff       	call   650 <gettoken>
+     946:	83 c4 20             	add    $0x20,%esp
+     949:	83 f8 61             	cmp    $0x61,%eax
+     94c:	0f 85 d9 00 00 00    	jne    a2b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     952:	83 ff 3c             	cmp    $0x3c,%edi
+     955:	74 69                	je     9c0 <parseredirs+0xc0>
+     957:	83 ff 3e             	cmp    $0x3e,%edi
+     95a:	74 05                	je     961 <parseredirs+0x61>
+     95c:	83 ff 2b             	cmp    $0x2b,%edi
+     95f:	75 af                	jne    910 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     961:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     964:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     967:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     96a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     96d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     970:	6a 18                	push   $0x18
+     972:	e8 49 0c 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     977:	83 c4 0c             	add    $0xc,%esp
+     97a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     97c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     97e:	6a 00                	push   $0x0
+     980:	50                   	push   %eax
+     981:	e8 aa 05 00 00       	call   f30 <memset>
+  cmd->type = REDIR;
+     986:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     98c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     98f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     992:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     995:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     998:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     99b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     99e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     9a5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     9a8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     9af:	89 7d 08             	mov    %edi,0x8(%ebp)
+     9b2:	e9 59 ff ff ff       	jmp    910 <parseredirs+0x10>
+     9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9be:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     9c0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     9c3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     9c6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     9c9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     9cc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     9cf:	6a 18                	push   $0x18
+     9d1:	e8 ea 0b 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9d6:	83 c4 0c             	add    $0xc,%esp
+     9d9:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     9db:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     9dd:	6a 00                	push   $0x0
+     9df:	50                   	push   %eax
+     9e0:	e8 4b 05 00 00       	call   f30 <memset>
+  cmd->cmd = subcmd;
+     9e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     9e8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     9eb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     9ee:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     9f1:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     9f7:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     9fa:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     9fd:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     a00:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     a03:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     a0a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     a11:	e9 fa fe ff ff       	jmp    910 <parseredirs+0x10>
+     a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     a20:	8b 45 08             	mov    0x8(%ebp),%eax
+     a23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a26:	5b                   	pop    %ebx
+     a27:	5e                   	pop    %esi
+     a28:	5f                   	pop    %edi
+     a29:	5d                   	pop    %ebp
+     a2a:	c3                   	ret
+      panic("missing file for redirection");
+     a2b:	83 ec 0c             	sub    $0xc,%esp
+     a2e:	68 e4 19 00 00       	push   $0x19e4
+     a33:	e8 18 f9 ff ff       	call   350 <panic>
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+
+00000a40 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	83 ec 30             	sub    $0x30,%esp
+     a49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     a4f:	68 04 1a 00 00       	push   $0x1a04
+     a54:	56                   	push   %esi
+     a55:	53                   	push   %ebx
+     a56:	e8 25 fe ff ff       	call   880 <peek>
+     a5b:	83 c4 10             	add    $0x10,%esp
+     a5e:	85 c0                	test   %eax,%eax
+     a60:	0f 85 aa 00 00 00    	jne    b10 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     a66:	83 ec 0c             	sub    $0xc,%esp
+     a69:	89 c7                	mov    %eax,%edi
+     a6b:	6a 54                	push   $0x54
+     a6d:	e8 4e 0b 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a72:	83 c4 0c             	add    $0xc,%esp
+     a75:	6a 54                	push   $0x54
+     a77:	6a 00                	push   $0x0
+     a79:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     a7c:	50                   	push   %eax
+     a7d:	e8 ae 04 00 00       	call   f30 <memset>
+  cmd->type = EXEC;
+     a82:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     a85:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     a88:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     a8e:	56                   	push   %esi
+     a8f:	53                   	push   %ebx
+     a90:	50                   	push   %eax
+     a91:	e8 6a fe ff ff       	call   900 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     a96:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     a99:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     a9c:	eb 15                	jmp    ab3 <parseexec+0x73>
+     a9e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	56                   	push   %esi
+     aa4:	53                   	push   %ebx
+     aa5:	ff 75 d4             	push   -0x2c(%ebp)
+     aa8:	e8 53 fe ff ff       	call   900 <parseredirs>
+     aad:	83 c4 10             	add    $0x10,%esp
+     ab0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     ab3:	83 ec 04             	sub    $0x4,%esp
+     ab6:	68 1b 1a 00 00       	push   $0x1a1b
+     abb:	56                   	push   %esi
+     abc:	53                   	push   %ebx
+     abd:	e8 be fd ff ff       	call   880 <peek>
+     ac2:	83 c4 10             	add    $0x10,%esp
+     ac5:	85 c0                	test   %eax,%eax
+     ac7:	75 5f                	jne    b28 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     ac9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     acc:	50                   	push   %eax
+     acd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ad0:	50                   	push   %eax
+     ad1:	56                   	push   %esi
+     ad2:	53                   	push   %ebx
+     ad3:	e8 78 fb ff ff       	call   650 <gettoken>
+     ad8:	83 c4 10             	add    $0x10,%esp
+     adb:	85 c0                	test   %eax,%eax
+     add:	74 49                	je     b28 <parseexec+0xe8>
+    if(tok != 'a')
+     adf:	83 f8 61             	cmp    $0x61,%eax
+     ae2:	75 62                	jne    b46 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     ae4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ae7:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     aea:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     aee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     af1:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     af5:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     af8:	83 ff 0a             	cmp    $0xa,%edi
+     afb:	75 a3                	jne    aa0 <parseexec+0x60>
+      panic("too many args");
+     afd:	83 ec 0c             	sub    $0xc,%esp
+     b00:	68 0d 1a 00 00       	push   $0x1a0d
+     b05:	e8 46 f8 ff ff       	call   350 <panic>
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     b10:	89 75 0c             	mov    %esi,0xc(%ebp)
+     b13:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     b16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b19:	5b                   	pop    %ebx
+     b1a:	5e                   	pop    %esi
+     b1b:	5f                   	pop    %edi
+     b1c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     b1d:	e9 ae 01 00 00       	jmp    cd0 <parseblock>
+     b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     b28:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     b2b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     b32:	00 
+  cmd->eargv[argc] = 0;
+     b33:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     b3a:	00 
+}
+     b3b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     b3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b41:	5b                   	pop    %ebx
+     b42:	5e                   	pop    %esi
+     b43:	5f                   	pop    %edi
+     b44:	5d                   	pop    %ebp
+     b45:	c3                   	ret
+      panic("syntax");
+     b46:	83 ec 0c             	sub    $0xc,%esp
+     b49:	68 06 1a 00 00       	push   $0x1a06
+     b4e:	e8 fd f7 ff ff       	call   350 <panic>
+     b53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b60 <parsepipe>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 14             	sub    $0x14,%esp
+     b69:	8b 75 08             	mov    0x8(%ebp),%esi
+     b6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     b6f:	57                   	push   %edi
+     b70:	56                   	push   %esi
+     b71:	e8 ca fe ff ff       	call   a40 <parseexec>
+  if(peek(ps, es, "|")){
+     b76:	83 c4 0c             	add    $0xc,%esp
+     b79:	68 20 1a 00 00       	push   $0x1a20
+  cmd = parseexec(ps, es);
+     b7e:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     b80:	57                   	push   %edi
+     b81:	56                   	push   %esi
+     b82:	e8 f9 fc ff ff       	call   880 <peek>
+     b87:	83 c4 10             	add    $0x10,%esp
+     b8a:	85 c0                	test   %eax,%eax
+     b8c:	75 12                	jne    ba0 <parsepipe+0x40>
+}
+     b8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b91:	89 d8                	mov    %ebx,%eax
+     b93:	5b                   	pop    %ebx
+     b94:	5e                   	pop    %esi
+     b95:	5f                   	pop    %edi
+     b96:	5d                   	pop    %ebp
+     b97:	c3                   	ret
+     b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     ba0:	6a 00                	push   $0x0
+     ba2:	6a 00                	push   $0x0
+     ba4:	57                   	push   %edi
+     ba5:	56                   	push   %esi
+     ba6:	e8 a5 fa ff ff       	call   650 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     bab:	58                   	pop    %eax
+     bac:	5a                   	pop    %edx
+     bad:	57                   	push   %edi
+     bae:	56                   	push   %esi
+     baf:	e8 ac ff ff ff       	call   b60 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     bb4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     bbb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     bbd:	e8 fe 09 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     bc2:	83 c4 0c             	add    $0xc,%esp
+     bc5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     bc7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     bc9:	6a 00                	push   $0x0
+     bcb:	50                   	push   %eax
+     bcc:	e8 5f 03 00 00       	call   f30 <memset>
+  cmd->left = left;
+     bd1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     bd4:	83 c4 10             	add    $0x10,%esp
+     bd7:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     bd9:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     bdf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     be1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be7:	5b                   	pop    %ebx
+     be8:	5e                   	pop    %esi
+     be9:	5f                   	pop    %edi
+     bea:	5d                   	pop    %ebp
+     beb:	c3                   	ret
+     bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bf0 <parseline>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 24             	sub    $0x24,%esp
+     bf9:	8b 75 08             	mov    0x8(%ebp),%esi
+     bfc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     bff:	57                   	push   %edi
+     c00:	56                   	push   %esi
+     c01:	e8 5a ff ff ff       	call   b60 <parsepipe>
+  while(peek(ps, es, "&")){
+     c06:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     c09:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     c0b:	eb 3b                	jmp    c48 <parseline+0x58>
+     c0d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     c10:	6a 00                	push   $0x0
+     c12:	6a 00                	push   $0x0
+     c14:	57                   	push   %edi
+     c15:	56                   	push   %esi
+     c16:	e8 35 fa ff ff       	call   650 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     c1b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     c22:	e8 99 09 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c27:	83 c4 0c             	add    $0xc,%esp
+     c2a:	6a 08                	push   $0x8
+     c2c:	6a 00                	push   $0x0
+     c2e:	50                   	push   %eax
+     c2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     c32:	e8 f9 02 00 00       	call   f30 <memset>
+  cmd->type = BACK;
+     c37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     c3a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     c3d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     c43:	89 5a 04             	mov    %ebx,0x4(%edx)
+     c46:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     c48:	83 ec 04             	sub    $0x4,%esp
+     c4b:	68 22 1a 00 00       	push   $0x1a22
+     c50:	57                   	push   %edi
+     c51:	56                   	push   %esi
+     c52:	e8 29 fc ff ff       	call   880 <peek>
+     c57:	83 c4 10             	add    $0x10,%esp
+     c5a:	85 c0                	test   %eax,%eax
+     c5c:	75 b2                	jne    c10 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     c5e:	83 ec 04             	sub    $0x4,%esp
+     c61:	68 1e 1a 00 00       	push   $0x1a1e
+     c66:	57                   	push   %edi
+     c67:	56                   	push   %esi
+     c68:	e8 13 fc ff ff       	call   880 <peek>
+     c6d:	83 c4 10             	add    $0x10,%esp
+     c70:	85 c0                	test   %eax,%eax
+     c72:	75 0c                	jne    c80 <parseline+0x90>
+}
+     c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c77:	89 d8                	mov    %ebx,%eax
+     c79:	5b                   	pop    %ebx
+     c7a:	5e                   	pop    %esi
+     c7b:	5f                   	pop    %edi
+     c7c:	5d                   	pop    %ebp
+     c7d:	c3                   	ret
+     c7e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     c80:	6a 00                	push   $0x0
+     c82:	6a 00                	push   $0x0
+     c84:	57                   	push   %edi
+     c85:	56                   	push   %esi
+     c86:	e8 c5 f9 ff ff       	call   650 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     c8b:	58                   	pop    %eax
+     c8c:	5a                   	pop    %edx
+     c8d:	57                   	push   %edi
+     c8e:	56                   	push   %esi
+     c8f:	e8 5c ff ff ff       	call   bf0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     c94:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     c9b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     c9d:	e8 1e 09 00 00       	call   15c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     ca2:	83 c4 0c             	add    $0xc,%esp
+     ca5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     ca7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     ca9:	6a 00                	push   $0x0
+     cab:	50                   	push   %eax
+     cac:	e8 7f 02 00 00       	call   f30 <memset>
+  cmd->left = left;
+     cb1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     cb9:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     cbf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     cc1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc7:	5b                   	pop    %ebx
+     cc8:	5e                   	pop    %esi
+     cc9:	5f                   	pop    %edi
+     cca:	5d                   	pop    %ebp
+     ccb:	c3                   	ret
+     ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <parseblock>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+     cd6:	83 ec 10             	sub    $0x10,%esp
+     cd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     cdc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     cdf:	68 04 1a 00 00       	push   $0x1a04
+     ce4:	56                   	push   %esi
+     ce5:	53                   	push   %ebx
+     ce6:	e8 95 fb ff ff       	call   880 <peek>
+     ceb:	83 c4 10             	add    $0x10,%esp
+     cee:	85 c0                	test   %eax,%eax
+     cf0:	74 4a                	je     d3c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     cf2:	6a 00                	push   $0x0
+     cf4:	6a 00                	push   $0x0
+     cf6:	56                   	push   %esi
+     cf7:	53                   	push   %ebx
+     cf8:	e8 53 f9 ff ff       	call   650 <gettoken>
+  cmd = parseline(ps, es);
+     cfd:	58                   	pop    %eax
+     cfe:	5a                   	pop    %edx
+     cff:	56                   	push   %esi
+     d00:	53                   	push   %ebx
+     d01:	e8 ea fe ff ff       	call   bf0 <parseline>
+  if(!peek(ps, es, ")"))
+     d06:	83 c4 0c             	add    $0xc,%esp
+     d09:	68 40 1a 00 00       	push   $0x1a40
+  cmd = parseline(ps, es);
+     d0e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     d10:	56                   	push   %esi
+     d11:	53                   	push   %ebx
+     d12:	e8 69 fb ff ff       	call   880 <peek>
+     d17:	83 c4 10             	add    $0x10,%esp
+     d1a:	85 c0                	test   %eax,%eax
+     d1c:	74 2b                	je     d49 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     d1e:	6a 00                	push   $0x0
+     d20:	6a 00                	push   $0x0
+     d22:	56                   	push   %esi
+     d23:	53                   	push   %ebx
+     d24:	e8 27 f9 ff ff       	call   650 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     d29:	83 c4 0c             	add    $0xc,%esp
+     d2c:	56                   	push   %esi
+     d2d:	53                   	push   %ebx
+     d2e:	57                   	push   %edi
+     d2f:	e8 cc fb ff ff       	call   900 <parseredirs>
+}
+     d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d37:	5b                   	pop    %ebx
+     d38:	5e                   	pop    %esi
+     d39:	5f                   	pop    %edi
+     d3a:	5d                   	pop    %ebp
+     d3b:	c3                   	ret
+    panic("parseblock");
+     d3c:	83 ec 0c             	sub    $0xc,%esp
+     d3f:	68 24 1a 00 00       	push   $0x1a24
+     d44:	e8 07 f6 ff ff       	call   350 <panic>
+    panic("syntax - missing )");
+     d49:	83 ec 0c             	sub    $0xc,%esp
+     d4c:	68 2f 1a 00 00       	push   $0x1a2f
+     d51:	e8 fa f5 ff ff       	call   350 <panic>
+     d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d60 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	53                   	push   %ebx
+     d64:	83 ec 04             	sub    $0x4,%esp
+     d67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     d6a:	85 db                	test   %ebx,%ebx
+     d6c:	0f 84 7e 00 00 00    	je     df0 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     d72:	83 3b 05             	cmpl   $0x5,(%ebx)
+     d75:	77 20                	ja     d97 <nulterminate+0x37>
+     d77:	8b 03                	mov    (%ebx),%eax
+     d79:	ff 24 85 80 1a 00 00 	jmp    *0x1a80(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     d80:	83 ec 0c             	sub    $0xc,%esp
+     d83:	ff 73 04             	push   0x4(%ebx)
+     d86:	e8 d5 ff ff ff       	call   d60 <nulterminate>
+    nulterminate(lcmd->right);
+     d8b:	58                   	pop    %eax
+     d8c:	ff 73 08             	push   0x8(%ebx)
+     d8f:	e8 cc ff ff ff       	call   d60 <nulterminate>
+    break;
+     d94:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     d97:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     d99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d9c:	c9                   	leave
+     d9d:	c3                   	ret
+     d9e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     da0:	83 ec 0c             	sub    $0xc,%esp
+     da3:	ff 73 04             	push   0x4(%ebx)
+     da6:	e8 b5 ff ff ff       	call   d60 <nulterminate>
+    break;
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	eb e7                	jmp    d97 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     db0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     db3:	8d 43 08             	lea    0x8(%ebx),%eax
+     db6:	85 c9                	test   %ecx,%ecx
+     db8:	74 dd                	je     d97 <nulterminate+0x37>
+     dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     dc0:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     dc3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     dc6:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     dc9:	8b 50 fc             	mov    -0x4(%eax),%edx
+     dcc:	85 d2                	test   %edx,%edx
+     dce:	75 f0                	jne    dc0 <nulterminate+0x60>
+     dd0:	eb c5                	jmp    d97 <nulterminate+0x37>
+     dd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	ff 73 04             	push   0x4(%ebx)
+     dde:	e8 7d ff ff ff       	call   d60 <nulterminate>
+    *rcmd->efile = 0;
+     de3:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     de6:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     de9:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     dec:	eb a9                	jmp    d97 <nulterminate+0x37>
+     dee:	66 90                	xchg   %ax,%ax
+    return 0;
+     df0:	31 c0                	xor    %eax,%eax
+     df2:	eb a5                	jmp    d99 <nulterminate+0x39>
+     df4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+
+00000e00 <parsecmd>:
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	57                   	push   %edi
+     e04:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     e05:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     e08:	53                   	push   %ebx
+     e09:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     e0c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e0f:	53                   	push   %ebx
+     e10:	e8 eb 00 00 00       	call   f00 <strlen>
+  cmd = parseline(&s, es);
+     e15:	59                   	pop    %ecx
+     e16:	5e                   	pop    %esi
+  es = s + strlen(s);
+     e17:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     e19:	53                   	push   %ebx
+     e1a:	57                   	push   %edi
+     e1b:	e8 d0 fd ff ff       	call   bf0 <parseline>
+  peek(&s, es, "");
+     e20:	83 c4 0c             	add    $0xc,%esp
+     e23:	68 3b 1b 00 00       	push   $0x1b3b
+  cmd = parseline(&s, es);
+     e28:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     e2a:	53                   	push   %ebx
+     e2b:	57                   	push   %edi
+     e2c:	e8 4f fa ff ff       	call   880 <peek>
+  if(s != es){
+     e31:	8b 45 08             	mov    0x8(%ebp),%eax
+     e34:	83 c4 10             	add    $0x10,%esp
+     e37:	39 d8                	cmp    %ebx,%eax
+     e39:	75 13                	jne    e4e <parsecmd+0x4e>
+  nulterminate(cmd);
+     e3b:	83 ec 0c             	sub    $0xc,%esp
+     e3e:	56                   	push   %esi
+     e3f:	e8 1c ff ff ff       	call   d60 <nulterminate>
+}
+     e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e47:	89 f0                	mov    %esi,%eax
+     e49:	5b                   	pop    %ebx
+     e4a:	5e                   	pop    %esi
+     e4b:	5f                   	pop    %edi
+     e4c:	5d                   	pop    %ebp
+     e4d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     e4e:	52                   	push   %edx
+     e4f:	50                   	push   %eax
+     e50:	68 42 1a 00 00       	push   $0x1a42
+     e55:	6a 02                	push   $0x2
+     e57:	e8 24 05 00 00       	call   1380 <printf>
+    panic("syntax");
+     e5c:	c7 04 24 06 1a 00 00 	movl   $0x1a06,(%esp)
+     e63:	e8 e8 f4 ff ff       	call   350 <panic>
+     e68:	66 90                	xchg   %ax,%ax
+     e6a:	66 90                	xchg   %ax,%ax
+     e6c:	66 90                	xchg   %ax,%ax
+     e6e:	66 90                	xchg   %ax,%ax
+
+00000e70 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     e70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     e71:	31 c0                	xor    %eax,%eax
+{
+     e73:	89 e5                	mov    %esp,%ebp
+     e75:	53                   	push   %ebx
+     e76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     e79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     e80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     e84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     e87:	83 c0 01             	add    $0x1,%eax
+     e8a:	84 d2                	test   %dl,%dl
+     e8c:	75 f2                	jne    e80 <strcpy+0x10>
+    ;
+  return os;
+}
+     e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e91:	89 c8                	mov    %ecx,%eax
+     e93:	c9                   	leave
+     e94:	c3                   	ret
+     e95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ea0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	53                   	push   %ebx
+     ea4:	8b 55 08             	mov    0x8(%ebp),%edx
+     ea7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     eaa:	0f b6 02             	movzbl (%edx),%eax
+     ead:	84 c0                	test   %al,%al
+     eaf:	75 17                	jne    ec8 <strcmp+0x28>
+     eb1:	eb 3a                	jmp    eed <strcmp+0x4d>
+     eb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eb7:	90                   	nop
+     eb8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     ebc:	83 c2 01             	add    $0x1,%edx
+     ebf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     ec2:	84 c0                	test   %al,%al
+     ec4:	74 1a                	je     ee0 <strcmp+0x40>
+    p++, q++;
+     ec6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     ec8:	0f b6 19             	movzbl (%ecx),%ebx
+     ecb:	38 c3                	cmp    %al,%bl
+     ecd:	74 e9                	je     eb8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     ecf:	29 d8                	sub    %ebx,%eax
+}
+     ed1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ed4:	c9                   	leave
+     ed5:	c3                   	ret
+     ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     ee0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     ee4:	31 c0                	xor    %eax,%eax
+     ee6:	29 d8                	sub    %ebx,%eax
+}
+     ee8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     eeb:	c9                   	leave
+     eec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     eed:	0f b6 19             	movzbl (%ecx),%ebx
+     ef0:	31 c0                	xor    %eax,%eax
+     ef2:	eb db                	jmp    ecf <strcmp+0x2f>
+     ef4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+
+00000f00 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     f06:	80 3a 00             	cmpb   $0x0,(%edx)
+     f09:	74 15                	je     f20 <strlen+0x20>
+     f0b:	31 c0                	xor    %eax,%eax
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+     f10:	83 c0 01             	add    $0x1,%eax
+     f13:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     f17:	89 c1                	mov    %eax,%ecx
+     f19:	75 f5                	jne    f10 <strlen+0x10>
+    ;
+  return n;
+}
+     f1b:	89 c8                	mov    %ecx,%eax
+     f1d:	5d                   	pop    %ebp
+     f1e:	c3                   	ret
+     f1f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     f20:	31 c9                	xor    %ecx,%ecx
+}
+     f22:	5d                   	pop    %ebp
+     f23:	89 c8                	mov    %ecx,%eax
+     f25:	c3                   	ret
+     f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     f37:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     f3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f3d:	89 d7                	mov    %edx,%edi
+     f3f:	fc                   	cld
+     f40:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     f42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     f45:	89 d0                	mov    %edx,%eax
+     f47:	c9                   	leave
+     f48:	c3                   	ret
+     f49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f50 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	8b 45 08             	mov    0x8(%ebp),%eax
+     f56:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     f5a:	0f b6 10             	movzbl (%eax),%edx
+     f5d:	84 d2                	test   %dl,%dl
+     f5f:	75 12                	jne    f73 <strchr+0x23>
+     f61:	eb 1d                	jmp    f80 <strchr+0x30>
+     f63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f67:	90                   	nop
+     f68:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     f6c:	83 c0 01             	add    $0x1,%eax
+     f6f:	84 d2                	test   %dl,%dl
+     f71:	74 0d                	je     f80 <strchr+0x30>
+    if(*s == c)
+     f73:	38 d1                	cmp    %dl,%cl
+     f75:	75 f1                	jne    f68 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     f77:	5d                   	pop    %ebp
+     f78:	c3                   	ret
+     f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     f80:	31 c0                	xor    %eax,%eax
+}
+     f82:	5d                   	pop    %ebp
+     f83:	c3                   	ret
+     f84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f8f:	90                   	nop
+
+00000f90 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	57                   	push   %edi
+     f94:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     f95:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     f98:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     f99:	31 db                	xor    %ebx,%ebx
+{
+     f9b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     f9e:	eb 27                	jmp    fc7 <gets+0x37>
+    cc = read(0, &c, 1);
+     fa0:	83 ec 04             	sub    $0x4,%esp
+     fa3:	6a 01                	push   $0x1
+     fa5:	56                   	push   %esi
+     fa6:	6a 00                	push   $0x0
+     fa8:	e8 e3 01 00 00       	call   1190 <read>
+    if(cc < 1)
+     fad:	83 c4 10             	add    $0x10,%esp
+     fb0:	85 c0                	test   %eax,%eax
+     fb2:	7e 1d                	jle    fd1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     fb4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     fbb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     fbf:	3c 0a                	cmp    $0xa,%al
+     fc1:	74 10                	je     fd3 <gets+0x43>
+     fc3:	3c 0d                	cmp    $0xd,%al
+     fc5:	74 0c                	je     fd3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     fc7:	89 df                	mov    %ebx,%edi
+     fc9:	83 c3 01             	add    $0x1,%ebx
+     fcc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     fcf:	7c cf                	jl     fa0 <gets+0x10>
+     fd1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     fd6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     fda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fdd:	5b                   	pop    %ebx
+     fde:	5e                   	pop    %esi
+     fdf:	5f                   	pop    %edi
+     fe0:	5d                   	pop    %ebp
+     fe1:	c3                   	ret
+     fe2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	56                   	push   %esi
+     ff4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ff5:	83 ec 08             	sub    $0x8,%esp
+     ff8:	6a 00                	push   $0x0
+     ffa:	ff 75 08             	push   0x8(%ebp)
+     ffd:	e8 b6 01 00 00       	call   11b8 <open>
+  if(fd < 0)
+    1002:	83 c4 10             	add    $0x10,%esp
+    1005:	85 c0                	test   %eax,%eax
+    1007:	78 27                	js     1030 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1009:	83 ec 08             	sub    $0x8,%esp
+    100c:	ff 75 0c             	push   0xc(%ebp)
+    100f:	89 c3                	mov    %eax,%ebx
+    1011:	50                   	push   %eax
+    1012:	e8 b9 01 00 00       	call   11d0 <fstat>
+  close(fd);
+    1017:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    101a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    101c:	e8 7f 01 00 00       	call   11a0 <close>
+  return r;
+    1021:	83 c4 10             	add    $0x10,%esp
+}
+    1024:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1027:	89 f0                	mov    %esi,%eax
+    1029:	5b                   	pop    %ebx
+    102a:	5e                   	pop    %esi
+    102b:	5d                   	pop    %ebp
+    102c:	c3                   	ret
+    102d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1030:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1035:	eb ed                	jmp    1024 <stat+0x34>
+    1037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103e:	66 90                	xchg   %ax,%ax
+
+00001040 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	53                   	push   %ebx
+    1044:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1047:	0f be 02             	movsbl (%edx),%eax
+    104a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    104d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1050:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1055:	77 1e                	ja     1075 <atoi+0x35>
+    1057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1060:	83 c2 01             	add    $0x1,%edx
+    1063:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1066:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    106a:	0f be 02             	movsbl (%edx),%eax
+    106d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1070:	80 fb 09             	cmp    $0x9,%bl
+    1073:	76 eb                	jbe    1060 <atoi+0x20>
+  return n;
+}
+    1075:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1078:	89 c8                	mov    %ecx,%eax
+    107a:	c9                   	leave
+    107b:	c3                   	ret
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001080 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	57                   	push   %edi
+    1084:	56                   	push   %esi
+    1085:	8b 45 10             	mov    0x10(%ebp),%eax
+    1088:	8b 55 08             	mov    0x8(%ebp),%edx
+    108b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    108e:	85 c0                	test   %eax,%eax
+    1090:	7e 13                	jle    10a5 <memmove+0x25>
+    1092:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1094:	89 d7                	mov    %edx,%edi
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    10a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    10a1:	39 f8                	cmp    %edi,%eax
+    10a3:	75 fb                	jne    10a0 <memmove+0x20>
+  return vdst;
+}
+    10a5:	5e                   	pop    %esi
+    10a6:	89 d0                	mov    %edx,%eax
+    10a8:	5f                   	pop    %edi
+    10a9:	5d                   	pop    %ebp
+    10aa:	c3                   	ret
+    10ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10af:	90                   	nop
+
+000010b0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	31 d2                	xor    %edx,%edx
+    10b3:	89 e5                	mov    %esp,%ebp
+    10b5:	53                   	push   %ebx
+    10b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    10b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+    10bc:	f7 f3                	div    %ebx
+    10be:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+    10c0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+    10c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+    10c8:	89 ca                	mov    %ecx,%edx
+}
+    10ca:	c9                   	leave
+    10cb:	c3                   	ret
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+    10d0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+    10d2:	c3                   	ret
+    10d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000010e0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+    10e0:	55                   	push   %ebp
+    10e1:	89 e5                	mov    %esp,%ebp
+    10e3:	57                   	push   %edi
+    10e4:	56                   	push   %esi
+    10e5:	53                   	push   %ebx
+    10e6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+    10e9:	8b 35 c4 22 00 00    	mov    0x22c4,%esi
+{
+    10ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    10f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+    10f5:	85 f6                	test   %esi,%esi
+    10f7:	74 2f                	je     1128 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+    10f9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    10fe:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+    1104:	f7 e3                	mul    %ebx
+    1106:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1109:	8d 04 17             	lea    (%edi,%edx,1),%eax
+    110c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    110f:	31 d2                	xor    %edx,%edx
+    1111:	f7 f6                	div    %esi
+    1113:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+    1115:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+    1118:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+    111b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+    111d:	89 da                	mov    %ebx,%edx
+}
+    111f:	5b                   	pop    %ebx
+    1120:	5e                   	pop    %esi
+    1121:	5f                   	pop    %edi
+    1122:	5d                   	pop    %ebp
+    1123:	c3                   	ret
+    1124:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+    1128:	e8 0b 01 00 00       	call   1238 <tscfreq>
+    112d:	a3 c4 22 00 00       	mov    %eax,0x22c4
+    1132:	89 c6                	mov    %eax,%esi
+    1134:	eb c3                	jmp    10f9 <cyc2ns+0x19>
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	53                   	push   %ebx
+    1144:	83 ec 10             	sub    $0x10,%esp
+    1147:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+    114a:	6a 00                	push   $0x0
+    114c:	e8 3f 01 00 00       	call   1290 <getpriority>
+    1151:	5a                   	pop    %edx
+    1152:	59                   	pop    %ecx
+    1153:	01 d8                	add    %ebx,%eax
+    1155:	50                   	push   %eax
+    1156:	6a 00                	push   $0x0
+    1158:	e8 2b 01 00 00       	call   1288 <setpriority>
+  return getpriority(0);
+    115d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+    1164:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+    1167:	83 c4 10             	add    $0x10,%esp
+}
+    116a:	c9                   	leave
+  return getpriority(0);
+    116b:	e9 20 01 00 00       	jmp    1290 <getpriority>
+
+00001170 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    1170:	b8 01 00 00 00       	mov    $0x1,%eax
+    1175:	cd 40                	int    $0x40
+    1177:	c3                   	ret
+
+00001178 <exit>:
+SYSCALL(exit)
+    1178:	b8 02 00 00 00       	mov    $0x2,%eax
+    117d:	cd 40                	int    $0x40
+    117f:	c3                   	ret
+
+00001180 <wait>:
+SYSCALL(wait)
+    1180:	b8 03 00 00 00       	mov    $0x3,%eax
+    1185:	cd 40                	int    $0x40
+    1187:	c3                   	ret
+
+00001188 <pipe>:
+SYSCALL(pipe)
+    1188:	b8 04 00 00 00       	mov    $0x4,%eax
+    118d:	cd 40                	int    $0x40
+    118f:	c3                   	ret
+
+00001190 <read>:
+SYSCALL(read)
+    1190:	b8 05 00 00 00       	mov    $0x5,%eax
+    1195:	cd 40                	int    $0x40
+    1197:	c3                   	ret
+
+00001198 <write>:
+SYSCALL(write)
+    1198:	b8 10 00 00 00       	mov    $0x10,%eax
+    119d:	cd 40                	int    $0x40
+    119f:	c3                   	ret
+
+000011a0 <close>:
+SYSCALL(close)
+    11a0:	b8 15 00 00 00       	mov    $0x15,%eax
+    11a5:	cd 40                	int    $0x40
+    11a7:	c3                   	ret
+
+000011a8 <kill>:
+SYSCALL(kill)
+    11a8:	b8 06 00 00 00       	mov    $0x6,%eax
+    11ad:	cd 40                	int    $0x40
+    11af:	c3                   	ret
+
+000011b0 <exec>:
+SYSCALL(exec)
+    11b0:	b8 07 00 00 00       	mov    $0x7,%eax
+    11b5:	cd 40                	int    $0x40
+    11b7:	c3                   	ret
+
+000011b8 <open>:
+SYSCALL(open)
+    11b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+    11bd:	cd 40                	int    $0x40
+    11bf:	c3                   	ret
+
+000011c0 <mknod>:
+SYSCALL(mknod)
+    11c0:	b8 11 00 00 00       	mov    $0x11,%eax
+    11c5:	cd 40                	int    $0x40
+    11c7:	c3                   	ret
+
+000011c8 <unlink>:
+SYSCALL(unlink)
+    11c8:	b8 12 00 00 00       	mov    $0x12,%eax
+    11cd:	cd 40                	int    $0x40
+    11cf:	c3                   	ret
+
+000011d0 <fstat>:
+SYSCALL(fstat)
+    11d0:	b8 08 00 00 00       	mov    $0x8,%eax
+    11d5:	cd 40                	int    $0x40
+    11d7:	c3                   	ret
+
+000011d8 <link>:
+SYSCALL(link)
+    11d8:	b8 13 00 00 00       	mov    $0x13,%eax
+    11dd:	cd 40                	int    $0x40
+    11df:	c3                   	ret
+
+000011e0 <mkdir>:
+SYSCALL(mkdir)
+    11e0:	b8 14 00 00 00       	mov    $0x14,%eax
+    11e5:	cd 40                	int    $0x40
+    11e7:	c3                   	ret
+
+000011e8 <chdir>:
+SYSCALL(chdir)
+    11e8:	b8 09 00 00 00       	mov    $0x9,%eax
+    11ed:	cd 40                	int    $0x40
+    11ef:	c3                   	ret
+
+000011f0 <dup>:
+SYSCALL(dup)
+    11f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+    11f5:	cd 40                	int    $0x40
+    11f7:	c3                   	ret
+
+000011f8 <getpid>:
+SYSCALL(getpid)
+    11f8:	b8 0b 00 00 00       	mov    $0xb,%eax
+    11fd:	cd 40                	int    $0x40
+    11ff:	c3                   	ret
+
+00001200 <sbrk>:
+SYSCALL(sbrk)
+    1200:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1205:	cd 40                	int    $0x40
+    1207:	c3                   	ret
+
+00001208 <sleep>:
+SYSCALL(sleep)
+    1208:	b8 0d 00 00 00       	mov    $0xd,%eax
+    120d:	cd 40                	int    $0x40
+    120f:	c3                   	ret
+
+00001210 <uptime>:
+SYSCALL(uptime)
+    1210:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1215:	cd 40                	int    $0x40
+    1217:	c3                   	ret
+
+00001218 <promote>:
+
+SYSCALL(promote)
+    1218:	b8 18 00 00 00       	mov    $0x18,%eax
+    121d:	cd 40                	int    $0x40
+    121f:	c3                   	ret
+
+00001220 <demote>:
+SYSCALL(demote)
+    1220:	b8 19 00 00 00       	mov    $0x19,%eax
+    1225:	cd 40                	int    $0x40
+    1227:	c3                   	ret
+
+00001228 <huge_page_count>:
+SYSCALL(huge_page_count)
+    1228:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    122d:	cd 40                	int    $0x40
+    122f:	c3                   	ret
+
+00001230 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+    1230:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1235:	cd 40                	int    $0x40
+    1237:	c3                   	ret
+
+00001238 <tscfreq>:
+SYSCALL(tscfreq)
+    1238:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    123d:	cd 40                	int    $0x40
+    123f:	c3                   	ret
+
+00001240 <tracemask>:
+SYSCALL(tracemask)
+    1240:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1245:	cd 40                	int    $0x40
+    1247:	c3                   	ret
+
+00001248 <traceread>:
+SYSCALL(traceread)
+    1248:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    124d:	cd 40                	int    $0x40
+    124f:	c3                   	ret
+
+00001250 <profile>:
+SYSCALL(profile)
+    1250:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1255:	cd 40                	int    $0x40
+    1257:	c3                   	ret
+
+00001258 <profread>:
+SYSCALL(profread)
+    1258:	b8 20 00 00 00       	mov    $0x20,%eax
+    125d:	cd 40                	int    $0x40
+    125f:	c3                   	ret
+
+00001260 <lockstat>:
+SYSCALL(lockstat)
+    1260:	b8 21 00 00 00       	mov    $0x21,%eax
+    1265:	cd 40                	int    $0x40
+    1267:	c3                   	ret
+
+00001268 <lockstatreset>:
+SYSCALL(lockstatreset)
+    1268:	b8 22 00 00 00       	mov    $0x22,%eax
+    126d:	cd 40                	int    $0x40
+    126f:	c3                   	ret
+
+00001270 <sysstat>:
+SYSCALL(sysstat)
+    1270:	b8 23 00 00 00       	mov    $0x23,%eax
+    1275:	cd 40                	int    $0x40
+    1277:	c3                   	ret
+
+00001278 <kbench>:
+SYSCALL(kbench)
+    1278:	b8 24 00 00 00       	mov    $0x24,%eax
+    127d:	cd 40                	int    $0x40
+    127f:	c3                   	ret
+
+00001280 <yield>:
+SYSCALL(yield)
+    1280:	b8 25 00 00 00       	mov    $0x25,%eax
+    1285:	cd 40                	int    $0x40
+    1287:	c3                   	ret
+
+00001288 <setpriority>:
+SYSCALL(setpriority)
+    1288:	b8 26 00 00 00       	mov    $0x26,%eax
+    128d:	cd 40                	int    $0x40
+    128f:	c3                   	ret
+
+00001290 <getpriority>:
+SYSCALL(getpriority)
+    1290:	b8 27 00 00 00       	mov    $0x27,%eax
+    1295:	cd 40                	int    $0x40
+    1297:	c3                   	ret
+
+00001298 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    1298:	b8 28 00 00 00       	mov    $0x28,%eax
+    129d:	cd 40                	int    $0x40
+    129f:	c3                   	ret
+
+000012a0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    12a0:	b8 29 00 00 00       	mov    $0x29,%eax
+    12a5:	cd 40                	int    $0x40
+    12a7:	c3                   	ret
+
+000012a8 <clone>:
+SYSCALL(clone)
+    12a8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    12ad:	cd 40                	int    $0x40
+    12af:	c3                   	ret
+
+000012b0 <join>:
+SYSCALL(join)
+    12b0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    12b5:	cd 40                	int    $0x40
+    12b7:	c3                   	ret
+
+000012b8 <futex_wait>:
+SYSCALL(futex_wait)
+    12b8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    12bd:	cd 40                	int    $0x40
+    12bf:	c3                   	ret
+
+000012c0 <futex_wake>:
+SYSCALL(futex_wake)
+    12c0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    12c5:	cd 40                	int    $0x40
+    12c7:	c3                   	ret
+
+000012c8 <spawn>:
+SYSCALL(spawn)
+    12c8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    12cd:	cd 40                	int    $0x40
+    12cf:	c3                   	ret
+
+000012d0 <diskstat>:
+SYSCALL(diskstat)
+    12d0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    12d5:	cd 40                	int    $0x40
+    12d7:	c3                   	ret
+    12d8:	66 90                	xchg   %ax,%ax
+    12da:	66 90                	xchg   %ax,%ax
+    12dc:	66 90                	xchg   %ax,%ax
+    12de:	66 90                	xchg   %ax,%ax
+
+000012e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	57                   	push   %edi
+    12e4:	56                   	push   %esi
+    12e5:	53                   	push   %ebx
+    12e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    12e8:	89 d1                	mov    %edx,%ecx
+{
+    12ea:	83 ec 3c             	sub    $0x3c,%esp
+    12ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    12f0:	85 d2                	test   %edx,%edx
+    12f2:	0f 89 80 00 00 00    	jns    1378 <printint+0x98>
+    12f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    12fc:	74 7a                	je     1378 <printint+0x98>
+    x = -xx;
+    12fe:	f7 d9                	neg    %ecx
+    neg = 1;
+    1300:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1305:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1308:	31 f6                	xor    %esi,%esi
+    130a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1310:	89 c8                	mov    %ecx,%eax
+    1312:	31 d2                	xor    %edx,%edx
+    1314:	89 f7                	mov    %esi,%edi
+    1316:	f7 f3                	div    %ebx
+    1318:	8d 76 01             	lea    0x1(%esi),%esi
+    131b:	0f b6 92 f8 1a 00 00 	movzbl 0x1af8(%edx),%edx
+    1322:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1326:	89 ca                	mov    %ecx,%edx
+    1328:	89 c1                	mov    %eax,%ecx
+    132a:	39 da                	cmp    %ebx,%edx
+    132c:	73 e2                	jae    1310 <printint+0x30>
+  if(neg)
+    132e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1331:	85 c0                	test   %eax,%eax
+    1333:	74 07                	je     133c <printint+0x5c>
+    buf[i++] = '-';
+    1335:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    133a:	89 f7                	mov    %esi,%edi
+    133c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    133f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1342:	01 df                	add    %ebx,%edi
+    1344:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1348:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    134b:	83 ec 04             	sub    $0x4,%esp
+    134e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1351:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1354:	6a 01                	push   $0x1
+    1356:	50                   	push   %eax
+    1357:	56                   	push   %esi
+    1358:	e8 3b fe ff ff       	call   1198 <write>
+  while(--i >= 0)
+    135d:	89 f8                	mov    %edi,%eax
+    135f:	83 c4 10             	add    $0x10,%esp
+    1362:	83 ef 01             	sub    $0x1,%edi
+    1365:	39 d8                	cmp    %ebx,%eax
+    1367:	75 df                	jne    1348 <printint+0x68>
+}
+    1369:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    136c:	5b                   	pop    %ebx
+    136d:	5e                   	pop    %esi
+    136e:	5f                   	pop    %edi
+    136f:	5d                   	pop    %ebp
+    1370:	c3                   	ret
+    1371:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1378:	31 c0                	xor    %eax,%eax
+    137a:	eb 89                	jmp    1305 <printint+0x25>
+    137c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001380 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	56                   	push   %esi
+    1385:	53                   	push   %ebx
+    1386:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1389:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    138c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    138f:	0f b6 1e             	movzbl (%esi),%ebx
+    1392:	83 c6 01             	add    $0x1,%esi
+    1395:	84 db                	test   %bl,%bl
+    1397:	74 67                	je     1400 <printf+0x80>
+    1399:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    139c:	31 d2                	xor    %edx,%edx
+    139e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    13a1:	eb 34                	jmp    13d7 <printf+0x57>
+    13a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13a7:	90                   	nop
+    13a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    13ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    13b0:	83 f8 25             	cmp    $0x25,%eax
+    13b3:	74 18                	je     13cd <printf+0x4d>
+  write(fd, &c, 1);
+    13b5:	83 ec 04             	sub    $0x4,%esp
+    13b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    13bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13be:	6a 01                	push   $0x1
+    13c0:	50                   	push   %eax
+    13c1:	57                   	push   %edi
+    13c2:	e8 d1 fd ff ff       	call   1198 <write>
+    13c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    13ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    13cd:	0f b6 1e             	movzbl (%esi),%ebx
+    13d0:	83 c6 01             	add    $0x1,%esi
+    13d3:	84 db                	test   %bl,%bl
+    13d5:	74 29                	je     1400 <printf+0x80>
+    c = fmt[i] & 0xff;
+    13d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    13da:	85 d2                	test   %edx,%edx
+    13dc:	74 ca                	je     13a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    13de:	83 fa 25             	cmp    $0x25,%edx
+    13e1:	75 ea                	jne    13cd <printf+0x4d>
+      if(c == 'd'){
+    13e3:	83 f8 25             	cmp    $0x25,%eax
+    13e6:	0f 84 24 01 00 00    	je     1510 <printf+0x190>
+    13ec:	83 e8 63             	sub    $0x63,%eax
+    13ef:	83 f8 15             	cmp    $0x15,%eax
+    13f2:	77 1c                	ja     1410 <printf+0x90>
+    13f4:	ff 24 85 a0 1a 00 00 	jmp    *0x1aa0(,%eax,4)
+    13fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1403:	5b                   	pop    %ebx
+    1404:	5e                   	pop    %esi
+    1405:	5f                   	pop    %edi
+    1406:	5d                   	pop    %ebp
+    1407:	c3                   	ret
+    1408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140f:	90                   	nop
+  write(fd, &c, 1);
+    1410:	83 ec 04             	sub    $0x4,%esp
+    1413:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1416:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    141a:	6a 01                	push   $0x1
+    141c:	52                   	push   %edx
+    141d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1420:	57                   	push   %edi
+    1421:	e8 72 fd ff ff       	call   1198 <write>
+    1426:	83 c4 0c             	add    $0xc,%esp
+    1429:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    142c:	6a 01                	push   $0x1
+    142e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1431:	52                   	push   %edx
+    1432:	57                   	push   %edi
+    1433:	e8 60 fd ff ff       	call   1198 <write>
+        putc(fd, c);
+    1438:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    143b:	31 d2                	xor    %edx,%edx
+    143d:	eb 8e                	jmp    13cd <printf+0x4d>
+    143f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1440:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1443:	83 ec 0c             	sub    $0xc,%esp
+    1446:	b9 10 00 00 00       	mov    $0x10,%ecx
+    144b:	8b 13                	mov    (%ebx),%edx
+    144d:	6a 00                	push   $0x0
+    144f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1451:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1454:	e8 87 fe ff ff       	call   12e0 <printint>
+        ap++;
+    1459:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    145c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    145f:	31 d2                	xor    %edx,%edx
+    1461:	e9 67 ff ff ff       	jmp    13cd <printf+0x4d>
+    1466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1470:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1473:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1475:	83 c0 04             	add    $0x4,%eax
+    1478:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    147b:	85 db                	test   %ebx,%ebx
+    147d:	0f 84 9d 00 00 00    	je     1520 <printf+0x1a0>
+        while(*s != 0){
+    1483:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1486:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1488:	84 c0                	test   %al,%al
+    148a:	0f 84 3d ff ff ff    	je     13cd <printf+0x4d>
+    1490:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1493:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1496:	89 de                	mov    %ebx,%esi
+    1498:	89 d3                	mov    %edx,%ebx
+    149a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    14a0:	83 ec 04             	sub    $0x4,%esp
+    14a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    14a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    14a9:	6a 01                	push   $0x1
+    14ab:	53                   	push   %ebx
+    14ac:	57                   	push   %edi
+    14ad:	e8 e6 fc ff ff       	call   1198 <write>
+        while(*s != 0){
+    14b2:	0f b6 06             	movzbl (%esi),%eax
+    14b5:	83 c4 10             	add    $0x10,%esp
+    14b8:	84 c0                	test   %al,%al
+    14ba:	75 e4                	jne    14a0 <printf+0x120>
+      state = 0;
+    14bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    14bf:	31 d2                	xor    %edx,%edx
+    14c1:	e9 07 ff ff ff       	jmp    13cd <printf+0x4d>
+    14c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    14d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    14d3:	83 ec 0c             	sub    $0xc,%esp
+    14d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    14db:	8b 13                	mov    (%ebx),%edx
+    14dd:	6a 01                	push   $0x1
+    14df:	e9 6b ff ff ff       	jmp    144f <printf+0xcf>
+    14e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    14e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    14eb:	83 ec 04             	sub    $0x4,%esp
+    14ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    14f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    14f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    14f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    14f9:	6a 01                	push   $0x1
+    14fb:	52                   	push   %edx
+    14fc:	57                   	push   %edi
+    14fd:	e8 96 fc ff ff       	call   1198 <write>
+        ap++;
+    1502:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1505:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1508:	31 d2                	xor    %edx,%edx
+    150a:	e9 be fe ff ff       	jmp    13cd <printf+0x4d>
+    150f:	90                   	nop
+  write(fd, &c, 1);
+    1510:	83 ec 04             	sub    $0x4,%esp
+    1513:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1516:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1519:	6a 01                	push   $0x1
+    151b:	e9 11 ff ff ff       	jmp    1431 <printf+0xb1>
+    1520:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1525:	bb 98 1a 00 00       	mov    $0x1a98,%ebx
+    152a:	e9 61 ff ff ff       	jmp    1490 <printf+0x110>
+    152f:	90                   	nop
+
+00001530 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1530:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1531:	a1 c8 22 00 00       	mov    0x22c8,%eax
+{
+    1536:	89 e5                	mov    %esp,%ebp
+    1538:	57                   	push   %edi
+    1539:	56                   	push   %esi
+    153a:	53                   	push   %ebx
+    153b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    153e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1548:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    154a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    154c:	39 ca                	cmp    %ecx,%edx
+    154e:	73 30                	jae    1580 <free+0x50>
+    1550:	39 c1                	cmp    %eax,%ecx
+    1552:	72 04                	jb     1558 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1554:	39 c2                	cmp    %eax,%edx
+    1556:	72 f0                	jb     1548 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1558:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    155b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    155e:	39 f8                	cmp    %edi,%eax
+    1560:	74 2e                	je     1590 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1562:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1565:	8b 42 04             	mov    0x4(%edx),%eax
+    1568:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    156b:	39 f1                	cmp    %esi,%ecx
+    156d:	74 38                	je     15a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    156f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1571:	5b                   	pop    %ebx
+  freep = p;
+    1572:	89 15 c8 22 00 00    	mov    %edx,0x22c8
+}
+    1578:	5e                   	pop    %esi
+    1579:	5f                   	pop    %edi
+    157a:	5d                   	pop    %ebp
+    157b:	c3                   	ret
+    157c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1580:	39 c1                	cmp    %eax,%ecx
+    1582:	72 d0                	jb     1554 <free+0x24>
+    1584:	eb c2                	jmp    1548 <free+0x18>
+    1586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    158d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1590:	03 70 04             	add    0x4(%eax),%esi
+    1593:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1596:	8b 02                	mov    (%edx),%eax
+    1598:	8b 00                	mov    (%eax),%eax
+    159a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    159d:	8b 42 04             	mov    0x4(%edx),%eax
+    15a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    15a3:	39 f1                	cmp    %esi,%ecx
+    15a5:	75 c8                	jne    156f <free+0x3f>
+    p->s.size += bp->s.size;
+    15a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    15aa:	89 15 c8 22 00 00    	mov    %edx,0x22c8
+    p->s.size += bp->s.size;
+    15b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    15b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    15b6:	89 0a                	mov    %ecx,(%edx)
+}
+    15b8:	5b                   	pop    %ebx
+    15b9:	5e                   	pop    %esi
+    15ba:	5f                   	pop    %edi
+    15bb:	5d                   	pop    %ebp
+    15bc:	c3                   	ret
+    15bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000015c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	57                   	push   %edi
+    15c4:	56                   	push   %esi
+    15c5:	53                   	push   %ebx
+    15c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    15c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    15cc:	8b 15 c8 22 00 00    	mov    0x22c8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    15d2:	8d 78 07             	lea    0x7(%eax),%edi
+    15d5:	c1 ef 03             	shr    $0x3,%edi
+    15d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    15db:	85 d2                	test   %edx,%edx
+    15dd:	0f 84 8d 00 00 00    	je     1670 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    15e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    15e8:	39 f9                	cmp    %edi,%ecx
+    15ea:	73 64                	jae    1650 <malloc+0x90>
+  if(nu < 4096)
+    15ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    15f1:	39 df                	cmp    %ebx,%edi
+    15f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    15f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    15fd:	eb 0a                	jmp    1609 <malloc+0x49>
+    15ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1600:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1602:	8b 48 04             	mov    0x4(%eax),%ecx
+    1605:	39 f9                	cmp    %edi,%ecx
+    1607:	73 47                	jae    1650 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1609:	89 c2                	mov    %eax,%edx
+    160b:	39 05 c8 22 00 00    	cmp    %eax,0x22c8
+    1611:	75 ed                	jne    1600 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1613:	83 ec 0c             	sub    $0xc,%esp
+    1616:	56                   	push   %esi
+    1617:	e8 e4 fb ff ff       	call   1200 <sbrk>
+  if(p == (char*)-1)
+    161c:	83 c4 10             	add    $0x10,%esp
+    161f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1622:	74 1c                	je     1640 <malloc+0x80>
+  hp->s.size = nu;
+    1624:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1627:	83 ec 0c             	sub    $0xc,%esp
+    162a:	83 c0 08             	add    $0x8,%eax
+    162d:	50                   	push   %eax
+    162e:	e8 fd fe ff ff       	call   1530 <free>
+  return freep;
+    1633:	8b 15 c8 22 00 00    	mov    0x22c8,%edx
+      if((p = morecore(nunits)) == 0)
+    1639:	83 c4 10             	add    $0x10,%esp
+    163c:	85 d2                	test   %edx,%edx
+    163e:	75 c0                	jne    1600 <malloc+0x40>
+        return 0;
+  }
+}
+    1640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1643:	31 c0                	xor    %eax,%eax
+}
+    1645:	5b                   	pop    %ebx
+    1646:	5e                   	pop    %esi
+    1647:	5f                   	pop    %edi
+    1648:	5d                   	pop    %ebp
+    1649:	c3                   	ret
+    164a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1650:	39 cf                	cmp    %ecx,%edi
+    1652:	74 4c                	je     16a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1654:	29 f9                	sub    %edi,%ecx
+    1656:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1659:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    165c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    165f:	89 15 c8 22 00 00    	mov    %edx,0x22c8
+}
+    1665:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1668:	83 c0 08             	add    $0x8,%eax
+}
+    166b:	5b                   	pop    %ebx
+    166c:	5e                   	pop    %esi
+    166d:	5f                   	pop    %edi
+    166e:	5d                   	pop    %ebp
+    166f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1670:	c7 05 c8 22 00 00 cc 	movl   $0x22cc,0x22c8
+    1677:	22 00 00 
+    base.s.size = 0;
+    167a:	b8 cc 22 00 00       	mov    $0x22cc,%eax
+    base.s.ptr = freep = prevp = &base;
+    167f:	c7 05 cc 22 00 00 cc 	movl   $0x22cc,0x22cc
+    1686:	22 00 00 
+    base.s.size = 0;
+    1689:	c7 05 d0 22 00 00 00 	movl   $0x0,0x22d0
+    1690:	00 00 00 
+    if(p->s.size >= nunits){
+    1693:	e9 54 ff ff ff       	jmp    15ec <malloc+0x2c>
+    1698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    16a0:	8b 08                	mov    (%eax),%ecx
+    16a2:	89 0a                	mov    %ecx,(%edx)
+    16a4:	eb b9                	jmp    165f <malloc+0x9f>
+    16a6:	66 90                	xchg   %ax,%ax
+    16a8:	66 90                	xchg   %ax,%ax
+    16aa:	66 90                	xchg   %ax,%ax
+    16ac:	66 90                	xchg   %ax,%ax
+    16ae:	66 90                	xchg   %ax,%ax
+
+000016b0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+    16b0:	55                   	push   %ebp
+    16b1:	89 e5                	mov    %esp,%ebp
+    16b3:	57                   	push   %edi
+    16b4:	56                   	push   %esi
+    16b5:	53                   	push   %ebx
+    16b6:	83 ec 20             	sub    $0x20,%esp
+    16b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+    16bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+    16bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+    16c2:	68 e8 03 00 00       	push   $0x3e8
+    16c7:	57                   	push   %edi
+    16c8:	56                   	push   %esi
+    16c9:	e8 e2 f9 ff ff       	call   10b0 <udiv64>
+    16ce:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+    16d0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+    16d3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+    16d9:	29 c1                	sub    %eax,%ecx
+    16db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+    16de:	68 e8 03 00 00       	push   $0x3e8
+    16e3:	57                   	push   %edi
+    16e4:	56                   	push   %esi
+    16e5:	e8 c6 f9 ff ff       	call   10b0 <udiv64>
+    16ea:	83 c4 0c             	add    $0xc,%esp
+    16ed:	50                   	push   %eax
+    16ee:	68 09 1b 00 00       	push   $0x1b09
+    16f3:	53                   	push   %ebx
+    16f4:	e8 87 fc ff ff       	call   1380 <printf>
+  if(frac < 100)
+    16f9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    16fc:	83 c4 10             	add    $0x10,%esp
+    16ff:	83 f9 63             	cmp    $0x63,%ecx
+    1702:	76 1c                	jbe    1720 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+    1704:	89 4d 10             	mov    %ecx,0x10(%ebp)
+    1707:	c7 45 0c 0f 1b 00 00 	movl   $0x1b0f,0xc(%ebp)
+    170e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1714:	5b                   	pop    %ebx
+    1715:	5e                   	pop    %esi
+    1716:	5f                   	pop    %edi
+    1717:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+    1718:	e9 63 fc ff ff       	jmp    1380 <printf>
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+    1720:	83 ec 08             	sub    $0x8,%esp
+    1723:	68 0d 1b 00 00       	push   $0x1b0d
+    1728:	53                   	push   %ebx
+    1729:	e8 52 fc ff ff       	call   1380 <printf>
+  if(frac < 10)
+    172e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1731:	83 c4 10             	add    $0x10,%esp
+    1734:	83 f9 09             	cmp    $0x9,%ecx
+    1737:	77 cb                	ja     1704 <printps+0x54>
+    printf(fd, "0");
+    1739:	83 ec 08             	sub    $0x8,%esp
+    173c:	68 0d 1b 00 00       	push   $0x1b0d
+    1741:	53                   	push   %ebx
+    1742:	e8 39 fc ff ff       	call   1380 <printf>
+    1747:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    174a:	83 c4 10             	add    $0x10,%esp
+    174d:	eb b5                	jmp    1704 <printps+0x54>
+    174f:	90                   	nop
+
+00001750 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	56                   	push   %esi
+    1755:	53                   	push   %ebx
+    1756:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+    175c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+    175f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+    1762:	83 e8 01             	sub    $0x1,%eax
+    1765:	3d ff 00 00 00       	cmp    $0xff,%eax
+    176a:	0f 87 37 02 00 00    	ja     19a7 <bench+0x257>
+    1770:	8b 7d 14             	mov    0x14(%ebp),%edi
+    1773:	85 ff                	test   %edi,%edi
+    1775:	0f 84 2c 02 00 00    	je     19a7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+    177b:	83 ec 0c             	sub    $0xc,%esp
+    177e:	ff 75 10             	push   0x10(%ebp)
+    1781:	ff 55 0c             	call   *0xc(%ebp)
+    1784:	5b                   	pop    %ebx
+    1785:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+    1788:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+    178a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+    178d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+    1790:	83 c4 10             	add    $0x10,%esp
+    1793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1797:	90                   	nop
+    t0 = cycles();
+    1798:	e8 33 f9 ff ff       	call   10d0 <cycles>
+    fn(arg);
+    179d:	83 ec 0c             	sub    $0xc,%esp
+    17a0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+    17a3:	89 c6                	mov    %eax,%esi
+    17a5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+    17a7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+    17aa:	e8 21 f9 ff ff       	call   10d0 <cycles>
+    17af:	29 f0                	sub    %esi,%eax
+    17b1:	19 fa                	sbb    %edi,%edx
+    17b3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+    17ba:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+    17bd:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+    17c4:	83 c3 01             	add    $0x1,%ebx
+    17c7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+    17ca:	7f cc                	jg     1798 <bench+0x48>
+  for(i = 1; i < n; i++){
+    17cc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+    17d0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+    17d3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+    17d9:	bf 01 00 00 00       	mov    $0x1,%edi
+    17de:	74 77                	je     1857 <bench+0x107>
+    17e0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    17e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17e7:	90                   	nop
+    v = a[i];
+    17e8:	8b 01                	mov    (%ecx),%eax
+    17ea:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+    17ed:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+    17f3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+    17f9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+    17ff:	89 c8                	mov    %ecx,%eax
+    1801:	eb 1b                	jmp    181e <bench+0xce>
+    1803:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1807:	90                   	nop
+      a[j] = a[j-1];
+    1808:	89 08                	mov    %ecx,(%eax)
+    180a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+    180d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+    1810:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+    1816:	39 c3                	cmp    %eax,%ebx
+    1818:	0f 84 72 01 00 00    	je     1990 <bench+0x240>
+    181e:	8b 50 fc             	mov    -0x4(%eax),%edx
+    1821:	8b 48 f8             	mov    -0x8(%eax),%ecx
+    1824:	89 f7                	mov    %esi,%edi
+    1826:	89 c3                	mov    %eax,%ebx
+    1828:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+    182e:	19 d7                	sbb    %edx,%edi
+    1830:	72 d6                	jb     1808 <bench+0xb8>
+    1832:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+    1838:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+    183e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+    1844:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+    1847:	83 c7 01             	add    $0x1,%edi
+    184a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+    184d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+    184f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+    1852:	75 94                	jne    17e8 <bench+0x98>
+    1854:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+    1857:	83 ec 08             	sub    $0x8,%esp
+    185a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+    1860:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    1865:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+    186b:	e8 70 f8 ff ff       	call   10e0 <cyc2ns>
+    1870:	83 c4 0c             	add    $0xc,%esp
+    1873:	ff 75 14             	push   0x14(%ebp)
+    1876:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    187c:	f7 e3                	mul    %ebx
+    187e:	01 ca                	add    %ecx,%edx
+    1880:	52                   	push   %edx
+    1881:	50                   	push   %eax
+    1882:	e8 29 f8 ff ff       	call   10b0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+    1887:	89 06                	mov    %eax,(%esi)
+    1889:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+    188c:	5f                   	pop    %edi
+    188d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+    188e:	8b 45 18             	mov    0x18(%ebp),%eax
+    1891:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+    1893:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+    189a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+    18a1:	e8 3a f8 ff ff       	call   10e0 <cyc2ns>
+    18a6:	83 c4 0c             	add    $0xc,%esp
+    18a9:	ff 75 14             	push   0x14(%ebp)
+    18ac:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    18b2:	f7 e3                	mul    %ebx
+    18b4:	01 ca                	add    %ecx,%edx
+    18b6:	52                   	push   %edx
+    18b7:	50                   	push   %eax
+    18b8:	e8 f3 f7 ff ff       	call   10b0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+    18bd:	89 46 08             	mov    %eax,0x8(%esi)
+    18c0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+    18c3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    18c4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+    18c7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    18c8:	8d 50 01             	lea    0x1(%eax),%edx
+    18cb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    18d0:	6b d2 63             	imul   $0x63,%edx,%edx
+    18d3:	f7 e2                	mul    %edx
+    18d5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+    18d8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+    18df:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+    18e6:	e8 f5 f7 ff ff       	call   10e0 <cyc2ns>
+    18eb:	83 c4 0c             	add    $0xc,%esp
+    18ee:	ff 75 14             	push   0x14(%ebp)
+    18f1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+    18f7:	f7 e3                	mul    %ebx
+    18f9:	01 ca                	add    %ecx,%edx
+    18fb:	52                   	push   %edx
+    18fc:	50                   	push   %eax
+    18fd:	e8 ae f7 ff ff       	call   10b0 <udiv64>
+
+  if(name){
+    1902:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1905:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+    1908:	89 46 10             	mov    %eax,0x10(%esi)
+    190b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+    190e:	85 c9                	test   %ecx,%ecx
+    1910:	74 72                	je     1984 <bench+0x234>
+    printf(1, "%s: min ", name);
+    1912:	83 ec 04             	sub    $0x4,%esp
+    1915:	ff 75 08             	push   0x8(%ebp)
+    1918:	68 12 1b 00 00       	push   $0x1b12
+    191d:	6a 01                	push   $0x1
+    191f:	e8 5c fa ff ff       	call   1380 <printf>
+    printps(1, st->min);
+    1924:	83 c4 0c             	add    $0xc,%esp
+    1927:	ff 76 04             	push   0x4(%esi)
+    192a:	ff 36                	push   (%esi)
+    192c:	6a 01                	push   $0x1
+    192e:	e8 7d fd ff ff       	call   16b0 <printps>
+    printf(1, " median ");
+    1933:	58                   	pop    %eax
+    1934:	5a                   	pop    %edx
+    1935:	68 1b 1b 00 00       	push   $0x1b1b
+    193a:	6a 01                	push   $0x1
+    193c:	e8 3f fa ff ff       	call   1380 <printf>
+    printps(1, st->median);
+    1941:	83 c4 0c             	add    $0xc,%esp
+    1944:	ff 76 0c             	push   0xc(%esi)
+    1947:	ff 76 08             	push   0x8(%esi)
+    194a:	6a 01                	push   $0x1
+    194c:	e8 5f fd ff ff       	call   16b0 <printps>
+    printf(1, " p99 ");
+    1951:	59                   	pop    %ecx
+    1952:	5b                   	pop    %ebx
+    1953:	68 24 1b 00 00       	push   $0x1b24
+    1958:	6a 01                	push   $0x1
+    195a:	e8 21 fa ff ff       	call   1380 <printf>
+    printps(1, st->p99);
+    195f:	83 c4 0c             	add    $0xc,%esp
+    1962:	ff 76 14             	push   0x14(%esi)
+    1965:	ff 76 10             	push   0x10(%esi)
+    1968:	6a 01                	push   $0x1
+    196a:	e8 41 fd ff ff       	call   16b0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+    196f:	83 c4 0c             	add    $0xc,%esp
+    1972:	ff 75 18             	push   0x18(%ebp)
+    1975:	68 2a 1b 00 00       	push   $0x1b2a
+    197a:	6a 01                	push   $0x1
+    197c:	e8 ff f9 ff ff       	call   1380 <printf>
+    1981:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+    1984:	31 c0                	xor    %eax,%eax
+}
+    1986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1989:	5b                   	pop    %ebx
+    198a:	5e                   	pop    %esi
+    198b:	5f                   	pop    %edi
+    198c:	5d                   	pop    %ebp
+    198d:	c3                   	ret
+    198e:	66 90                	xchg   %ax,%ax
+    1990:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+    1996:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    199c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+    19a2:	e9 97 fe ff ff       	jmp    183e <bench+0xee>
+    return -1;
+    19a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    19ac:	eb d8                	jmp    1986 <bench+0x236>
@@ -1,6 +1,7 @@
 // Shell.
 
 #include "types.h"
+#include "param.h"
 #include "user.h"
 #include "fcntl.h"
 
@@ -52,6 +53,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int gettoken(char**, char*, char**, char**);
 
 // Execute cmd.  Never returns.
 void
@@ -130,6 +132,90 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+// Is buf a single command, perhaps with redirections, that the
+// shell can spawn without forking itself?  Checks enough that
+// parsecmd cannot fail on it.
+int
+simplecmd(char *buf)
+{
+  char *s, *es;
+  int tok, argc, nredir;
+
+  s = buf;
+  es = s + strlen(s);
+  argc = nredir = 0;
+  while((tok = gettoken(&s, es, 0, 0)) != 0){
+    switch(tok){
+    case 'a':
+      if(++argc >= MAXARGS)
+        return 0;
+      break;
+    case '<':
+    case '>':
+    case '+':
+      if(++nredir >= MAXARGS || gettoken(&s, es, 0, 0) != 'a')
+        return 0;
+      break;
+    default:
+      return 0;
+    }
+  }
+  return argc > 0;
+}
+
+// Start a command from simplecmd with spawn(), so that the
+// shell's memory is not copied just to be replaced by exec.
+// The redirected files are opened, outermost first as runcmd
+// would, on spare descriptors, and spawn is told to give them
+// to the child in place of the shell's; the child gets nothing
+// else the shell did not have before.
+// Returns the child's pid, or -1.
+int
+spawncmd(struct cmd *cmd)
+{
+  struct redircmd *rcmd[MAXARGS];
+  struct execcmd *ecmd;
+  int fds[NOFILE], opened[MAXARGS];
+  int i, n, pid;
+
+  pid = -1;
+  for(i = 0; i < NOFILE; i++)
+    fds[i] = i;
+  for(n = 0; cmd->type == REDIR; n++){
+    rcmd[n] = (struct redircmd*)cmd;
+    if((opened[n] = open(rcmd[n]->file, rcmd[n]->mode)) < 0){
+      printf(2, "open %s failed\n", rcmd[n]->file);
+      goto out;
+    }
+    fds[opened[n]] = -1;
+    cmd = rcmd[n]->cmd;
+  }
+  for(i = 0; i < n; i++)
+    fds[rcmd[i]->fd] = opened[i];
+  ecmd = (struct execcmd*)cmd;
+  if((pid = spawn(ecmd->argv[0], ecmd->argv, fds)) < 0)
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+
+out:
+  for(i = 0; i < n; i++)
+    close(opened[i]);
+  return pid;
+}
+
+// Free a command from simplecmd.
+void
+freecmd(struct cmd *cmd)
+{
+  struct cmd *sub;
+
+  while(cmd->type == REDIR){
+    sub = ((struct redircmd*)cmd)->cmd;
+    free(cmd);
+    cmd = sub;
+  }
+  free(cmd);
+}
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -145,6 +231,7 @@ int
 main(void)
 {
   static char buf[100];
+  struct cmd *cmd;
   int fd;
 
   // Ensure that three file descriptors are open.
@@ -164,6 +251,13 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
+    if(simplecmd(buf)){
+      cmd = parsecmd(buf);
+      if(spawncmd(cmd) >= 0)
+        wait();
+      freecmd(cmd);
+      continue;
+    }
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
@@ -10,6 +10,8 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 
+#define SPINUS 20   // longest spin for a running holder, in microseconds
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
@@ -17,17 +19,62 @@ initsleeplock(struct sleeplock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
+  lk->class = findlockclass(name, 1);
+}
+
+// Is the holder of lk running on some cpu right now?  Reads
+// without locks, so the answer is only a hint.
+static int
+ownerrunning(struct sleeplock *lk)
+{
+  struct proc *p;
+  int cpu;
+
+  p = lk->owner;
+  if(p == 0 || p->state != RUNNING)
+    return 0;
+  cpu = p->cpu;
+  return cpu >= 0 && cpu < ncpu && cpus[cpu].proc == p;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  volatile uint *locked = &lk->locked;
+  uint64 t0, wait, limit;
+  int contended;
+
   acquire(&lk->lk);
-  while (lk->locked) {
-    sleep(lk, &lk->lk);
+  contended = 0;
+  wait = 0;
+  if(lk->locked){
+    contended = 1;
+    t0 = rdtsc();
+
+    // Most buffer and inode locks are held only briefly.  If
+    // the holder is running on another cpu, spin for a little
+    // while rather than paying for a sleep and two switches.
+    // The holder may be us, if this is a block we started
+    // reading ahead; then only the disk can release it.
+    if(lk->owner != myproc() && ownerrunning(lk)){
+      release(&lk->lk);
+      limit = (tsckhz / 1000) * SPINUS;
+      while(*locked && ownerrunning(lk) && rdtsc() - t0 < limit)
+        pause();
+      acquire(&lk->lk);
+    }
+
+    while (lk->locked) {
+      sleep(lk, &lk->lk);
+    }
+    wait = rdtsc() - t0;
   }
   lk->locked = 1;
   lk->pid = myproc()->pid;
+  lk->owner = myproc();
+  // Holding lk->lk, so interrupts are off.
+  lockcount(lk->class, cpuid(), contended, wait);
   release(&lk->lk);
 }
 
@@ -37,6 +84,7 @@ releasesleep(struct sleeplock *lk)
   acquire(&lk->lk);
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
   wakeup(lk);
   release(&lk->lk);
 }
@@ -3,8 +3,12 @@ struct sleeplock {
   uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
   
-  // For debugging:
+  // For debugging, and for waiters deciding whether to spin:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *owner; // Process holding lock
+
+  // For contention statistics:
+  struct lockclass *class;  // Counters shared by locks of this name.
 };
 
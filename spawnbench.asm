@@ -0,0 +1,2102 @@
+
+_spawnbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s\t%d\n", what, rate(n, ns));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  int n;
+  char *p;
+  uint i;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+  1f:	0f 8f 42 01 00 00    	jg     167 <main+0x167>
+  if(n < 1){
+    printf(2, "usage: spawnbench [n]\n");
+    exit();
+  }
+
+  printf(1, "method\t\t\tcmds/sec\n");
+  25:	50                   	push   %eax
+  26:	50                   	push   %eax
+  27:	68 c1 0e 00 00       	push   $0xec1
+  2c:	6a 01                	push   $0x1
+  2e:	e8 3d 08 00 00       	call   870 <printf>
+  report("fork+exec\t", n, runfork(n));
+  33:	89 d8                	mov    %ebx,%eax
+  35:	e8 b6 02 00 00       	call   2f0 <runfork>
+  3a:	59                   	pop    %ecx
+  3b:	5e                   	pop    %esi
+  3c:	52                   	push   %edx
+  3d:	89 da                	mov    %ebx,%edx
+  3f:	50                   	push   %eax
+  40:	b8 d4 0e 00 00       	mov    $0xed4,%eax
+  45:	e8 56 02 00 00       	call   2a0 <report>
+  report("spawn\t\t", n, runspawn(n));
+  4a:	89 d8                	mov    %ebx,%eax
+  4c:	e8 df 01 00 00       	call   230 <runspawn>
+  51:	5f                   	pop    %edi
+  52:	59                   	pop    %ecx
+  53:	52                   	push   %edx
+  54:	89 da                	mov    %ebx,%edx
+  56:	50                   	push   %eax
+  57:	b8 df 0e 00 00       	mov    $0xedf,%eax
+  5c:	e8 3f 02 00 00       	call   2a0 <report>
+
+  if((p = sbrk(BIGMB * 1024 * 1024)) == (char*)-1){
+  61:	c7 04 24 00 00 40 00 	movl   $0x400000,(%esp)
+  68:	e8 83 06 00 00       	call   6f0 <sbrk>
+  6d:	83 c4 10             	add    $0x10,%esp
+  70:	8d 90 00 00 40 00    	lea    0x400000(%eax),%edx
+  76:	83 f8 ff             	cmp    $0xffffffff,%eax
+  79:	0f 84 2e 01 00 00    	je     1ad <main+0x1ad>
+  7f:	90                   	nop
+    printf(2, "spawnbench: out of memory\n");
+    exit();
+  }
+  for(i = 0; i < BIGMB * 1024 * 1024; i += 4096)
+    p[i] = 1;
+  80:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < BIGMB * 1024 * 1024; i += 4096)
+  83:	05 00 10 00 00       	add    $0x1000,%eax
+  88:	39 c2                	cmp    %eax,%edx
+  8a:	75 f4                	jne    80 <main+0x80>
+  report("fork+exec +4MB\t", n, runfork(n));
+  8c:	89 d8                	mov    %ebx,%eax
+  8e:	e8 5d 02 00 00       	call   2f0 <runfork>
+  93:	56                   	push   %esi
+  94:	56                   	push   %esi
+  95:	52                   	push   %edx
+  96:	89 da                	mov    %ebx,%edx
+  98:	50                   	push   %eax
+  99:	b8 02 0f 00 00       	mov    $0xf02,%eax
+  9e:	e8 fd 01 00 00       	call   2a0 <report>
+  report("spawn +4MB\t", n, runspawn(n));
+  a3:	89 d8                	mov    %ebx,%eax
+  a5:	e8 86 01 00 00       	call   230 <runspawn>
+  aa:	5f                   	pop    %edi
+  ab:	59                   	pop    %ecx
+  ac:	52                   	push   %edx
+  ad:	89 da                	mov    %ebx,%edx
+  af:	50                   	push   %eax
+  b0:	b8 12 0f 00 00       	mov    $0xf12,%eax
+  b5:	e8 e6 01 00 00       	call   2a0 <report>
+  if((fd = open("spawnbench.sh", O_CREATE|O_WRONLY)) < 0){
+  ba:	5e                   	pop    %esi
+  bb:	5f                   	pop    %edi
+  bc:	68 01 02 00 00       	push   $0x201
+  c1:	68 1e 0f 00 00       	push   $0xf1e
+  for(i = 0; i < n; i++)
+  c6:	31 f6                	xor    %esi,%esi
+  if((fd = open("spawnbench.sh", O_CREATE|O_WRONLY)) < 0){
+  c8:	e8 db 05 00 00       	call   6a8 <open>
+  cd:	83 c4 10             	add    $0x10,%esp
+  d0:	89 c7                	mov    %eax,%edi
+  d2:	85 c0                	test   %eax,%eax
+  d4:	0f 88 e6 00 00 00    	js     1c0 <main+0x1c0>
+  da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(fd, "spawnbench -x\n", 14);
+  e0:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; i++)
+  e3:	83 c6 01             	add    $0x1,%esi
+    write(fd, "spawnbench -x\n", 14);
+  e6:	6a 0e                	push   $0xe
+  e8:	68 2c 0f 00 00       	push   $0xf2c
+  ed:	57                   	push   %edi
+  ee:	e8 95 05 00 00       	call   688 <write>
+  for(i = 0; i < n; i++)
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	39 f3                	cmp    %esi,%ebx
+  f8:	75 e6                	jne    e0 <main+0xe0>
+  close(fd);
+  fa:	83 ec 0c             	sub    $0xc,%esp
+  fd:	57                   	push   %edi
+  fe:	e8 8d 05 00 00       	call   690 <close>
+  t0 = cycles();
+ 103:	e8 b8 04 00 00       	call   5c0 <cycles>
+ 108:	89 c6                	mov    %eax,%esi
+ 10a:	89 d7                	mov    %edx,%edi
+  if(fork() == 0){
+ 10c:	e8 4f 05 00 00       	call   660 <fork>
+ 111:	83 c4 10             	add    $0x10,%esp
+ 114:	85 c0                	test   %eax,%eax
+ 116:	0f 84 be 00 00 00    	je     1da <main+0x1da>
+  wait();
+ 11c:	e8 4f 05 00 00       	call   670 <wait>
+  t0 = cyc2ns(cycles() - t0);
+ 121:	e8 9a 04 00 00       	call   5c0 <cycles>
+ 126:	29 f0                	sub    %esi,%eax
+ 128:	51                   	push   %ecx
+ 129:	19 fa                	sbb    %edi,%edx
+ 12b:	51                   	push   %ecx
+ 12c:	52                   	push   %edx
+ 12d:	50                   	push   %eax
+ 12e:	e8 9d 04 00 00       	call   5d0 <cyc2ns>
+  unlink("spawnbench.sh");
+ 133:	c7 04 24 1e 0f 00 00 	movl   $0xf1e,(%esp)
+  t0 = cyc2ns(cycles() - t0);
+ 13a:	89 d7                	mov    %edx,%edi
+ 13c:	89 c6                	mov    %eax,%esi
+  unlink("spawnbench.sh");
+ 13e:	e8 75 05 00 00       	call   6b8 <unlink>
+  unlink("spawnbench.out");
+ 143:	c7 04 24 3b 0f 00 00 	movl   $0xf3b,(%esp)
+ 14a:	e8 69 05 00 00       	call   6b8 <unlink>
+  return t0;
+ 14f:	83 c4 10             	add    $0x10,%esp
+
+  report("sh script\t", n, runsh(n));
+ 152:	50                   	push   %eax
+ 153:	89 da                	mov    %ebx,%edx
+ 155:	50                   	push   %eax
+ 156:	b8 4a 0f 00 00       	mov    $0xf4a,%eax
+ 15b:	57                   	push   %edi
+ 15c:	56                   	push   %esi
+ 15d:	e8 3e 01 00 00       	call   2a0 <report>
+  exit();
+ 162:	e8 01 05 00 00       	call   668 <exit>
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+ 167:	57                   	push   %edi
+ 168:	57                   	push   %edi
+ 169:	68 a7 0e 00 00       	push   $0xea7
+ 16e:	ff 76 04             	push   0x4(%esi)
+ 171:	e8 1a 02 00 00       	call   390 <strcmp>
+ 176:	83 c4 10             	add    $0x10,%esp
+ 179:	85 c0                	test   %eax,%eax
+ 17b:	75 05                	jne    182 <main+0x182>
+    exit();
+ 17d:	e8 e6 04 00 00       	call   668 <exit>
+    n = atoi(argv[1]);
+ 182:	83 ec 0c             	sub    $0xc,%esp
+ 185:	ff 76 04             	push   0x4(%esi)
+ 188:	e8 a3 03 00 00       	call   530 <atoi>
+  if(n < 1){
+ 18d:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+ 190:	89 c3                	mov    %eax,%ebx
+  if(n < 1){
+ 192:	85 c0                	test   %eax,%eax
+ 194:	0f 8f 8b fe ff ff    	jg     25 <main+0x25>
+    printf(2, "usage: spawnbench [n]\n");
+ 19a:	53                   	push   %ebx
+ 19b:	53                   	push   %ebx
+ 19c:	68 aa 0e 00 00       	push   $0xeaa
+ 1a1:	6a 02                	push   $0x2
+ 1a3:	e8 c8 06 00 00       	call   870 <printf>
+    exit();
+ 1a8:	e8 bb 04 00 00       	call   668 <exit>
+    printf(2, "spawnbench: out of memory\n");
+ 1ad:	50                   	push   %eax
+ 1ae:	50                   	push   %eax
+ 1af:	68 e7 0e 00 00       	push   $0xee7
+ 1b4:	6a 02                	push   $0x2
+ 1b6:	e8 b5 06 00 00       	call   870 <printf>
+    exit();
+ 1bb:	e8 a8 04 00 00       	call   668 <exit>
+    printf(2, "spawnbench: cannot create script\n");
+ 1c0:	51                   	push   %ecx
+    return 0;
+ 1c1:	31 f6                	xor    %esi,%esi
+ 1c3:	31 ff                	xor    %edi,%edi
+    printf(2, "spawnbench: cannot create script\n");
+ 1c5:	51                   	push   %ecx
+ 1c6:	68 60 0f 00 00       	push   $0xf60
+ 1cb:	6a 02                	push   $0x2
+ 1cd:	e8 9e 06 00 00       	call   870 <printf>
+    return 0;
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	e9 78 ff ff ff       	jmp    152 <main+0x152>
+    close(0);
+ 1da:	83 ec 0c             	sub    $0xc,%esp
+ 1dd:	6a 00                	push   $0x0
+ 1df:	e8 ac 04 00 00       	call   690 <close>
+    open("spawnbench.sh", O_RDONLY);
+ 1e4:	5b                   	pop    %ebx
+ 1e5:	5e                   	pop    %esi
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	68 1e 0f 00 00       	push   $0xf1e
+ 1ed:	e8 b6 04 00 00       	call   6a8 <open>
+    close(2);
+ 1f2:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 1f9:	e8 92 04 00 00       	call   690 <close>
+    open("spawnbench.out", O_CREATE|O_WRONLY);
+ 1fe:	5f                   	pop    %edi
+ 1ff:	58                   	pop    %eax
+ 200:	68 01 02 00 00       	push   $0x201
+ 205:	68 3b 0f 00 00       	push   $0xf3b
+ 20a:	e8 99 04 00 00       	call   6a8 <open>
+    exec(shcmd[0], shcmd);
+ 20f:	58                   	pop    %eax
+ 210:	5a                   	pop    %edx
+ 211:	68 30 14 00 00       	push   $0x1430
+ 216:	ff 35 30 14 00 00    	push   0x1430
+ 21c:	e8 7f 04 00 00       	call   6a0 <exec>
+    exit();
+ 221:	e8 42 04 00 00       	call   668 <exit>
+ 226:	66 90                	xchg   %ax,%ax
+ 228:	66 90                	xchg   %ax,%ax
+ 22a:	66 90                	xchg   %ax,%ax
+ 22c:	66 90                	xchg   %ax,%ax
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <runspawn>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	89 c6                	mov    %eax,%esi
+ 236:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 237:	31 db                	xor    %ebx,%ebx
+{
+ 239:	83 ec 10             	sub    $0x10,%esp
+  t0 = cycles();
+ 23c:	e8 7f 03 00 00       	call   5c0 <cycles>
+ 241:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 244:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 0; i < n; i++){
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    if(spawn(cmd[0], cmd) >= 0)
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	68 38 14 00 00       	push   $0x1438
+ 258:	ff 35 38 14 00 00    	push   0x1438
+ 25e:	e8 55 05 00 00       	call   7b8 <spawn>
+ 263:	83 c4 10             	add    $0x10,%esp
+ 266:	85 c0                	test   %eax,%eax
+ 268:	78 05                	js     26f <runspawn+0x3f>
+      wait();
+ 26a:	e8 01 04 00 00       	call   670 <wait>
+  for(i = 0; i < n; i++){
+ 26f:	83 c3 01             	add    $0x1,%ebx
+ 272:	39 de                	cmp    %ebx,%esi
+ 274:	75 da                	jne    250 <runspawn+0x20>
+  return cyc2ns(cycles() - t0);
+ 276:	e8 45 03 00 00       	call   5c0 <cycles>
+ 27b:	83 ec 08             	sub    $0x8,%esp
+ 27e:	2b 45 f0             	sub    -0x10(%ebp),%eax
+ 281:	1b 55 f4             	sbb    -0xc(%ebp),%edx
+ 284:	52                   	push   %edx
+ 285:	50                   	push   %eax
+ 286:	e8 45 03 00 00       	call   5d0 <cyc2ns>
+}
+ 28b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 28e:	5b                   	pop    %ebx
+ 28f:	5e                   	pop    %esi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <report>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	89 d6                	mov    %edx,%esi
+ 2a6:	53                   	push   %ebx
+ 2a7:	89 c3                	mov    %eax,%ebx
+  us = udiv64(ns, 1000);
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	68 e8 03 00 00       	push   $0x3e8
+ 2b1:	ff 75 0c             	push   0xc(%ebp)
+ 2b4:	ff 75 08             	push   0x8(%ebp)
+ 2b7:	e8 e4 02 00 00       	call   5a0 <udiv64>
+  return us ? (uint)udiv64((uint64)n * 1000000, us) : 0;
+ 2bc:	83 c4 10             	add    $0x10,%esp
+ 2bf:	85 c0                	test   %eax,%eax
+ 2c1:	75 18                	jne    2db <report+0x3b>
+  printf(1, "%s\t%d\n", what, rate(n, ns));
+ 2c3:	50                   	push   %eax
+ 2c4:	53                   	push   %ebx
+ 2c5:	68 a0 0e 00 00       	push   $0xea0
+ 2ca:	6a 01                	push   $0x1
+ 2cc:	e8 9f 05 00 00       	call   870 <printf>
+}
+ 2d1:	83 c4 10             	add    $0x10,%esp
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	5b                   	pop    %ebx
+ 2d8:	5e                   	pop    %esi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+  return us ? (uint)udiv64((uint64)n * 1000000, us) : 0;
+ 2db:	52                   	push   %edx
+ 2dc:	50                   	push   %eax
+ 2dd:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 2e2:	f7 ee                	imul   %esi
+ 2e4:	52                   	push   %edx
+ 2e5:	50                   	push   %eax
+ 2e6:	e8 b5 02 00 00       	call   5a0 <udiv64>
+ 2eb:	83 c4 10             	add    $0x10,%esp
+ 2ee:	eb d3                	jmp    2c3 <report+0x23>
+
+000002f0 <runfork>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	89 c6                	mov    %eax,%esi
+ 2f6:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 2f7:	31 db                	xor    %ebx,%ebx
+{
+ 2f9:	83 ec 10             	sub    $0x10,%esp
+  t0 = cycles();
+ 2fc:	e8 bf 02 00 00       	call   5c0 <cycles>
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 304:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  for(i = 0; i < n; i++){
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    if(fork() == 0){
+ 310:	e8 4b 03 00 00       	call   660 <fork>
+ 315:	85 c0                	test   %eax,%eax
+ 317:	74 28                	je     341 <runfork+0x51>
+    wait();
+ 319:	e8 52 03 00 00       	call   670 <wait>
+  for(i = 0; i < n; i++){
+ 31e:	83 c3 01             	add    $0x1,%ebx
+ 321:	39 de                	cmp    %ebx,%esi
+ 323:	75 eb                	jne    310 <runfork+0x20>
+  return cyc2ns(cycles() - t0);
+ 325:	e8 96 02 00 00       	call   5c0 <cycles>
+ 32a:	83 ec 08             	sub    $0x8,%esp
+ 32d:	2b 45 f0             	sub    -0x10(%ebp),%eax
+ 330:	1b 55 f4             	sbb    -0xc(%ebp),%edx
+ 333:	52                   	push   %edx
+ 334:	50                   	push   %eax
+ 335:	e8 96 02 00 00       	call   5d0 <cyc2ns>
+}
+ 33a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5d                   	pop    %ebp
+ 340:	c3                   	ret
+      exec(cmd[0], cmd);
+ 341:	50                   	push   %eax
+ 342:	50                   	push   %eax
+ 343:	68 38 14 00 00       	push   $0x1438
+ 348:	ff 35 38 14 00 00    	push   0x1438
+ 34e:	e8 4d 03 00 00       	call   6a0 <exec>
+      exit();
+ 353:	e8 10 03 00 00       	call   668 <exit>
+ 358:	66 90                	xchg   %ax,%ax
+ 35a:	66 90                	xchg   %ax,%ax
+ 35c:	66 90                	xchg   %ax,%ax
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 360:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 361:	31 c0                	xor    %eax,%eax
+{
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	53                   	push   %ebx
+ 366:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 369:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 370:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 374:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 377:	83 c0 01             	add    $0x1,%eax
+ 37a:	84 d2                	test   %dl,%dl
+ 37c:	75 f2                	jne    370 <strcpy+0x10>
+    ;
+  return os;
+}
+ 37e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 381:	89 c8                	mov    %ecx,%eax
+ 383:	c9                   	leave
+ 384:	c3                   	ret
+ 385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+ 397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 39a:	0f b6 02             	movzbl (%edx),%eax
+ 39d:	84 c0                	test   %al,%al
+ 39f:	75 17                	jne    3b8 <strcmp+0x28>
+ 3a1:	eb 3a                	jmp    3dd <strcmp+0x4d>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ac:	83 c2 01             	add    $0x1,%edx
+ 3af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3b2:	84 c0                	test   %al,%al
+ 3b4:	74 1a                	je     3d0 <strcmp+0x40>
+    p++, q++;
+ 3b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3bb:	38 c3                	cmp    %al,%bl
+ 3bd:	74 e9                	je     3a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3bf:	29 d8                	sub    %ebx,%eax
+}
+ 3c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3d4:	31 c0                	xor    %eax,%eax
+ 3d6:	29 d8                	sub    %ebx,%eax
+}
+ 3d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3db:	c9                   	leave
+ 3dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3e0:	31 c0                	xor    %eax,%eax
+ 3e2:	eb db                	jmp    3bf <strcmp+0x2f>
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3f9:	74 15                	je     410 <strlen+0x20>
+ 3fb:	31 c0                	xor    %eax,%eax
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 400:	83 c0 01             	add    $0x1,%eax
+ 403:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 407:	89 c1                	mov    %eax,%ecx
+ 409:	75 f5                	jne    400 <strlen+0x10>
+    ;
+  return n;
+}
+ 40b:	89 c8                	mov    %ecx,%eax
+ 40d:	5d                   	pop    %ebp
+ 40e:	c3                   	ret
+ 40f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 410:	31 c9                	xor    %ecx,%ecx
+}
+ 412:	5d                   	pop    %ebp
+ 413:	89 c8                	mov    %ecx,%eax
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 427:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 42a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42d:	89 d7                	mov    %edx,%edi
+ 42f:	fc                   	cld
+ 430:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 432:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 435:	89 d0                	mov    %edx,%eax
+ 437:	c9                   	leave
+ 438:	c3                   	ret
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 44a:	0f b6 10             	movzbl (%eax),%edx
+ 44d:	84 d2                	test   %dl,%dl
+ 44f:	75 12                	jne    463 <strchr+0x23>
+ 451:	eb 1d                	jmp    470 <strchr+0x30>
+ 453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 457:	90                   	nop
+ 458:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 45c:	83 c0 01             	add    $0x1,%eax
+ 45f:	84 d2                	test   %dl,%dl
+ 461:	74 0d                	je     470 <strchr+0x30>
+    if(*s == c)
+ 463:	38 d1                	cmp    %dl,%cl
+ 465:	75 f1                	jne    458 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 470:	31 c0                	xor    %eax,%eax
+}
+ 472:	5d                   	pop    %ebp
+ 473:	c3                   	ret
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 485:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 488:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 489:	31 db                	xor    %ebx,%ebx
+{
+ 48b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 48e:	eb 27                	jmp    4b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 490:	83 ec 04             	sub    $0x4,%esp
+ 493:	6a 01                	push   $0x1
+ 495:	56                   	push   %esi
+ 496:	6a 00                	push   $0x0
+ 498:	e8 e3 01 00 00       	call   680 <read>
+    if(cc < 1)
+ 49d:	83 c4 10             	add    $0x10,%esp
+ 4a0:	85 c0                	test   %eax,%eax
+ 4a2:	7e 1d                	jle    4c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4af:	3c 0a                	cmp    $0xa,%al
+ 4b1:	74 10                	je     4c3 <gets+0x43>
+ 4b3:	3c 0d                	cmp    $0xd,%al
+ 4b5:	74 0c                	je     4c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4b7:	89 df                	mov    %ebx,%edi
+ 4b9:	83 c3 01             	add    $0x1,%ebx
+ 4bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4bf:	7c cf                	jl     490 <gets+0x10>
+ 4c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cd:	5b                   	pop    %ebx
+ 4ce:	5e                   	pop    %esi
+ 4cf:	5f                   	pop    %edi
+ 4d0:	5d                   	pop    %ebp
+ 4d1:	c3                   	ret
+ 4d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	56                   	push   %esi
+ 4e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	6a 00                	push   $0x0
+ 4ea:	ff 75 08             	push   0x8(%ebp)
+ 4ed:	e8 b6 01 00 00       	call   6a8 <open>
+  if(fd < 0)
+ 4f2:	83 c4 10             	add    $0x10,%esp
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	78 27                	js     520 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4f9:	83 ec 08             	sub    $0x8,%esp
+ 4fc:	ff 75 0c             	push   0xc(%ebp)
+ 4ff:	89 c3                	mov    %eax,%ebx
+ 501:	50                   	push   %eax
+ 502:	e8 b9 01 00 00       	call   6c0 <fstat>
+  close(fd);
+ 507:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 50a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 50c:	e8 7f 01 00 00       	call   690 <close>
+  return r;
+ 511:	83 c4 10             	add    $0x10,%esp
+}
+ 514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 517:	89 f0                	mov    %esi,%eax
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5d                   	pop    %ebp
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 525:	eb ed                	jmp    514 <stat+0x34>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 537:	0f be 02             	movsbl (%edx),%eax
+ 53a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 53d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 545:	77 1e                	ja     565 <atoi+0x35>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 550:	83 c2 01             	add    $0x1,%edx
+ 553:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 556:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 55a:	0f be 02             	movsbl (%edx),%eax
+ 55d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 560:	80 fb 09             	cmp    $0x9,%bl
+ 563:	76 eb                	jbe    550 <atoi+0x20>
+  return n;
+}
+ 565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 568:	89 c8                	mov    %ecx,%eax
+ 56a:	c9                   	leave
+ 56b:	c3                   	ret
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	8b 45 10             	mov    0x10(%ebp),%eax
+ 578:	8b 55 08             	mov    0x8(%ebp),%edx
+ 57b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 57e:	85 c0                	test   %eax,%eax
+ 580:	7e 13                	jle    595 <memmove+0x25>
+ 582:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 584:	89 d7                	mov    %edx,%edi
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 590:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 591:	39 f8                	cmp    %edi,%eax
+ 593:	75 fb                	jne    590 <memmove+0x20>
+  return vdst;
+}
+ 595:	5e                   	pop    %esi
+ 596:	89 d0                	mov    %edx,%eax
+ 598:	5f                   	pop    %edi
+ 599:	5d                   	pop    %ebp
+ 59a:	c3                   	ret
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	31 d2                	xor    %edx,%edx
+ 5a3:	89 e5                	mov    %esp,%ebp
+ 5a5:	53                   	push   %ebx
+ 5a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 5a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 5ac:	f7 f3                	div    %ebx
+ 5ae:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 5b8:	89 ca                	mov    %ecx,%edx
+}
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 5c0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 5c2:	c3                   	ret
+ 5c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005d0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 5d9:	8b 35 44 14 00 00    	mov    0x1444,%esi
+{
+ 5df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 5e5:	85 f6                	test   %esi,%esi
+ 5e7:	74 2f                	je     618 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 5e9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 5ee:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 5f4:	f7 e3                	mul    %ebx
+ 5f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5f9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 5fc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5ff:	31 d2                	xor    %edx,%edx
+ 601:	f7 f6                	div    %esi
+ 603:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 605:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 608:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 60b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 60d:	89 da                	mov    %ebx,%edx
+}
+ 60f:	5b                   	pop    %ebx
+ 610:	5e                   	pop    %esi
+ 611:	5f                   	pop    %edi
+ 612:	5d                   	pop    %ebp
+ 613:	c3                   	ret
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 618:	e8 0b 01 00 00       	call   728 <tscfreq>
+ 61d:	a3 44 14 00 00       	mov    %eax,0x1444
+ 622:	89 c6                	mov    %eax,%esi
+ 624:	eb c3                	jmp    5e9 <cyc2ns+0x19>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000630 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	83 ec 10             	sub    $0x10,%esp
+ 637:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 63a:	6a 00                	push   $0x0
+ 63c:	e8 3f 01 00 00       	call   780 <getpriority>
+ 641:	5a                   	pop    %edx
+ 642:	59                   	pop    %ecx
+ 643:	01 d8                	add    %ebx,%eax
+ 645:	50                   	push   %eax
+ 646:	6a 00                	push   $0x0
+ 648:	e8 2b 01 00 00       	call   778 <setpriority>
+  return getpriority(0);
+ 64d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 654:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 657:	83 c4 10             	add    $0x10,%esp
+}
+ 65a:	c9                   	leave
+  return getpriority(0);
+ 65b:	e9 20 01 00 00       	jmp    780 <getpriority>
+
+00000660 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <exit>:
+SYSCALL(exit)
+ 668:	b8 02 00 00 00       	mov    $0x2,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <wait>:
+SYSCALL(wait)
+ 670:	b8 03 00 00 00       	mov    $0x3,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <pipe>:
+SYSCALL(pipe)
+ 678:	b8 04 00 00 00       	mov    $0x4,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <read>:
+SYSCALL(read)
+ 680:	b8 05 00 00 00       	mov    $0x5,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <write>:
+SYSCALL(write)
+ 688:	b8 10 00 00 00       	mov    $0x10,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <close>:
+SYSCALL(close)
+ 690:	b8 15 00 00 00       	mov    $0x15,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <kill>:
+SYSCALL(kill)
+ 698:	b8 06 00 00 00       	mov    $0x6,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <exec>:
+SYSCALL(exec)
+ 6a0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <open>:
+SYSCALL(open)
+ 6a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <mknod>:
+SYSCALL(mknod)
+ 6b0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <unlink>:
+SYSCALL(unlink)
+ 6b8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <fstat>:
+SYSCALL(fstat)
+ 6c0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <link>:
+SYSCALL(link)
+ 6c8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <mkdir>:
+SYSCALL(mkdir)
+ 6d0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <chdir>:
+SYSCALL(chdir)
+ 6d8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <dup>:
+SYSCALL(dup)
+ 6e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <getpid>:
+SYSCALL(getpid)
+ 6e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <sbrk>:
+SYSCALL(sbrk)
+ 6f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <sleep>:
+SYSCALL(sleep)
+ 6f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <uptime>:
+SYSCALL(uptime)
+ 700:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <promote>:
+
+SYSCALL(promote)
+ 708:	b8 18 00 00 00       	mov    $0x18,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <demote>:
+SYSCALL(demote)
+ 710:	b8 19 00 00 00       	mov    $0x19,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 718:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 720:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <tscfreq>:
+SYSCALL(tscfreq)
+ 728:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <tracemask>:
+SYSCALL(tracemask)
+ 730:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <traceread>:
+SYSCALL(traceread)
+ 738:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <profile>:
+SYSCALL(profile)
+ 740:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <profread>:
+SYSCALL(profread)
+ 748:	b8 20 00 00 00       	mov    $0x20,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <lockstat>:
+SYSCALL(lockstat)
+ 750:	b8 21 00 00 00       	mov    $0x21,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 758:	b8 22 00 00 00       	mov    $0x22,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <sysstat>:
+SYSCALL(sysstat)
+ 760:	b8 23 00 00 00       	mov    $0x23,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <kbench>:
+SYSCALL(kbench)
+ 768:	b8 24 00 00 00       	mov    $0x24,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <yield>:
+SYSCALL(yield)
+ 770:	b8 25 00 00 00       	mov    $0x25,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <setpriority>:
+SYSCALL(setpriority)
+ 778:	b8 26 00 00 00       	mov    $0x26,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <getpriority>:
+SYSCALL(getpriority)
+ 780:	b8 27 00 00 00       	mov    $0x27,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 788:	b8 28 00 00 00       	mov    $0x28,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 790:	b8 29 00 00 00       	mov    $0x29,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+
+00000798 <clone>:
+SYSCALL(clone)
+ 798:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <join>:
+SYSCALL(join)
+ 7a0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+
+000007a8 <futex_wait>:
+SYSCALL(futex_wait)
+ 7a8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7ad:	cd 40                	int    $0x40
+ 7af:	c3                   	ret
+
+000007b0 <futex_wake>:
+SYSCALL(futex_wake)
+ 7b0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7b5:	cd 40                	int    $0x40
+ 7b7:	c3                   	ret
+
+000007b8 <spawn>:
+SYSCALL(spawn)
+ 7b8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 7bd:	cd 40                	int    $0x40
+ 7bf:	c3                   	ret
+
+000007c0 <diskstat>:
+SYSCALL(diskstat)
+ 7c0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 7c5:	cd 40                	int    $0x40
+ 7c7:	c3                   	ret
+ 7c8:	66 90                	xchg   %ax,%ax
+ 7ca:	66 90                	xchg   %ax,%ax
+ 7cc:	66 90                	xchg   %ax,%ax
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7d8:	89 d1                	mov    %edx,%ecx
+{
+ 7da:	83 ec 3c             	sub    $0x3c,%esp
+ 7dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7e0:	85 d2                	test   %edx,%edx
+ 7e2:	0f 89 80 00 00 00    	jns    868 <printint+0x98>
+ 7e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ec:	74 7a                	je     868 <printint+0x98>
+    x = -xx;
+ 7ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7f8:	31 f6                	xor    %esi,%esi
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 800:	89 c8                	mov    %ecx,%eax
+ 802:	31 d2                	xor    %edx,%edx
+ 804:	89 f7                	mov    %esi,%edi
+ 806:	f7 f3                	div    %ebx
+ 808:	8d 76 01             	lea    0x1(%esi),%esi
+ 80b:	0f b6 92 e4 0f 00 00 	movzbl 0xfe4(%edx),%edx
+ 812:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 816:	89 ca                	mov    %ecx,%edx
+ 818:	89 c1                	mov    %eax,%ecx
+ 81a:	39 da                	cmp    %ebx,%edx
+ 81c:	73 e2                	jae    800 <printint+0x30>
+  if(neg)
+ 81e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 821:	85 c0                	test   %eax,%eax
+ 823:	74 07                	je     82c <printint+0x5c>
+    buf[i++] = '-';
+ 825:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 82a:	89 f7                	mov    %esi,%edi
+ 82c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 82f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 832:	01 df                	add    %ebx,%edi
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 838:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 841:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 844:	6a 01                	push   $0x1
+ 846:	50                   	push   %eax
+ 847:	56                   	push   %esi
+ 848:	e8 3b fe ff ff       	call   688 <write>
+  while(--i >= 0)
+ 84d:	89 f8                	mov    %edi,%eax
+ 84f:	83 c4 10             	add    $0x10,%esp
+ 852:	83 ef 01             	sub    $0x1,%edi
+ 855:	39 d8                	cmp    %ebx,%eax
+ 857:	75 df                	jne    838 <printint+0x68>
+}
+ 859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 85c:	5b                   	pop    %ebx
+ 85d:	5e                   	pop    %esi
+ 85e:	5f                   	pop    %edi
+ 85f:	5d                   	pop    %ebp
+ 860:	c3                   	ret
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 868:	31 c0                	xor    %eax,%eax
+ 86a:	eb 89                	jmp    7f5 <printint+0x25>
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 879:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 87c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 87f:	0f b6 1e             	movzbl (%esi),%ebx
+ 882:	83 c6 01             	add    $0x1,%esi
+ 885:	84 db                	test   %bl,%bl
+ 887:	74 67                	je     8f0 <printf+0x80>
+ 889:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 88c:	31 d2                	xor    %edx,%edx
+ 88e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 891:	eb 34                	jmp    8c7 <printf+0x57>
+ 893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 897:	90                   	nop
+ 898:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 89b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8a0:	83 f8 25             	cmp    $0x25,%eax
+ 8a3:	74 18                	je     8bd <printf+0x4d>
+  write(fd, &c, 1);
+ 8a5:	83 ec 04             	sub    $0x4,%esp
+ 8a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ae:	6a 01                	push   $0x1
+ 8b0:	50                   	push   %eax
+ 8b1:	57                   	push   %edi
+ 8b2:	e8 d1 fd ff ff       	call   688 <write>
+ 8b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c0:	83 c6 01             	add    $0x1,%esi
+ 8c3:	84 db                	test   %bl,%bl
+ 8c5:	74 29                	je     8f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8ca:	85 d2                	test   %edx,%edx
+ 8cc:	74 ca                	je     898 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ce:	83 fa 25             	cmp    $0x25,%edx
+ 8d1:	75 ea                	jne    8bd <printf+0x4d>
+      if(c == 'd'){
+ 8d3:	83 f8 25             	cmp    $0x25,%eax
+ 8d6:	0f 84 24 01 00 00    	je     a00 <printf+0x190>
+ 8dc:	83 e8 63             	sub    $0x63,%eax
+ 8df:	83 f8 15             	cmp    $0x15,%eax
+ 8e2:	77 1c                	ja     900 <printf+0x90>
+ 8e4:	ff 24 85 8c 0f 00 00 	jmp    *0xf8c(,%eax,4)
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f3:	5b                   	pop    %ebx
+ 8f4:	5e                   	pop    %esi
+ 8f5:	5f                   	pop    %edi
+ 8f6:	5d                   	pop    %ebp
+ 8f7:	c3                   	ret
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 906:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 90a:	6a 01                	push   $0x1
+ 90c:	52                   	push   %edx
+ 90d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 910:	57                   	push   %edi
+ 911:	e8 72 fd ff ff       	call   688 <write>
+ 916:	83 c4 0c             	add    $0xc,%esp
+ 919:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 91c:	6a 01                	push   $0x1
+ 91e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 921:	52                   	push   %edx
+ 922:	57                   	push   %edi
+ 923:	e8 60 fd ff ff       	call   688 <write>
+        putc(fd, c);
+ 928:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92b:	31 d2                	xor    %edx,%edx
+ 92d:	eb 8e                	jmp    8bd <printf+0x4d>
+ 92f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 930:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 93b:	8b 13                	mov    (%ebx),%edx
+ 93d:	6a 00                	push   $0x0
+ 93f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 941:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 944:	e8 87 fe ff ff       	call   7d0 <printint>
+        ap++;
+ 949:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 94c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 67 ff ff ff       	jmp    8bd <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 960:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 963:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 965:	83 c0 04             	add    $0x4,%eax
+ 968:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 96b:	85 db                	test   %ebx,%ebx
+ 96d:	0f 84 9d 00 00 00    	je     a10 <printf+0x1a0>
+        while(*s != 0){
+ 973:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 976:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 978:	84 c0                	test   %al,%al
+ 97a:	0f 84 3d ff ff ff    	je     8bd <printf+0x4d>
+ 980:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 983:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 986:	89 de                	mov    %ebx,%esi
+ 988:	89 d3                	mov    %edx,%ebx
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 996:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	53                   	push   %ebx
+ 99c:	57                   	push   %edi
+ 99d:	e8 e6 fc ff ff       	call   688 <write>
+        while(*s != 0){
+ 9a2:	0f b6 06             	movzbl (%esi),%eax
+ 9a5:	83 c4 10             	add    $0x10,%esp
+ 9a8:	84 c0                	test   %al,%al
+ 9aa:	75 e4                	jne    990 <printf+0x120>
+      state = 0;
+ 9ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9af:	31 d2                	xor    %edx,%edx
+ 9b1:	e9 07 ff ff ff       	jmp    8bd <printf+0x4d>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9cb:	8b 13                	mov    (%ebx),%edx
+ 9cd:	6a 01                	push   $0x1
+ 9cf:	e9 6b ff ff ff       	jmp    93f <printf+0xcf>
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9db:	83 ec 04             	sub    $0x4,%esp
+ 9de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	52                   	push   %edx
+ 9ec:	57                   	push   %edi
+ 9ed:	e8 96 fc ff ff       	call   688 <write>
+        ap++;
+ 9f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9f8:	31 d2                	xor    %edx,%edx
+ 9fa:	e9 be fe ff ff       	jmp    8bd <printf+0x4d>
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a09:	6a 01                	push   $0x1
+ a0b:	e9 11 ff ff ff       	jmp    921 <printf+0xb1>
+ a10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a15:	bb 82 0f 00 00       	mov    $0xf82,%ebx
+ a1a:	e9 61 ff ff ff       	jmp    980 <printf+0x110>
+ a1f:	90                   	nop
+
+00000a20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a21:	a1 48 14 00 00       	mov    0x1448,%eax
+{
+ a26:	89 e5                	mov    %esp,%ebp
+ a28:	57                   	push   %edi
+ a29:	56                   	push   %esi
+ a2a:	53                   	push   %ebx
+ a2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a3c:	39 ca                	cmp    %ecx,%edx
+ a3e:	73 30                	jae    a70 <free+0x50>
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 04                	jb     a48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a44:	39 c2                	cmp    %eax,%edx
+ a46:	72 f0                	jb     a38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a4e:	39 f8                	cmp    %edi,%eax
+ a50:	74 2e                	je     a80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a55:	8b 42 04             	mov    0x4(%edx),%eax
+ a58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a5b:	39 f1                	cmp    %esi,%ecx
+ a5d:	74 38                	je     a97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a61:	5b                   	pop    %ebx
+  freep = p;
+ a62:	89 15 48 14 00 00    	mov    %edx,0x1448
+}
+ a68:	5e                   	pop    %esi
+ a69:	5f                   	pop    %edi
+ a6a:	5d                   	pop    %ebp
+ a6b:	c3                   	ret
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a70:	39 c1                	cmp    %eax,%ecx
+ a72:	72 d0                	jb     a44 <free+0x24>
+ a74:	eb c2                	jmp    a38 <free+0x18>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a80:	03 70 04             	add    0x4(%eax),%esi
+ a83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a86:	8b 02                	mov    (%edx),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a8d:	8b 42 04             	mov    0x4(%edx),%eax
+ a90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a93:	39 f1                	cmp    %esi,%ecx
+ a95:	75 c8                	jne    a5f <free+0x3f>
+    p->s.size += bp->s.size;
+ a97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a9a:	89 15 48 14 00 00    	mov    %edx,0x1448
+    p->s.size += bp->s.size;
+ aa0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ aa3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ aa6:	89 0a                	mov    %ecx,(%edx)
+}
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	57                   	push   %edi
+ ab4:	56                   	push   %esi
+ ab5:	53                   	push   %ebx
+ ab6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ abc:	8b 15 48 14 00 00    	mov    0x1448,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac2:	8d 78 07             	lea    0x7(%eax),%edi
+ ac5:	c1 ef 03             	shr    $0x3,%edi
+ ac8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ acb:	85 d2                	test   %edx,%edx
+ acd:	0f 84 8d 00 00 00    	je     b60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad8:	39 f9                	cmp    %edi,%ecx
+ ada:	73 64                	jae    b40 <malloc+0x90>
+  if(nu < 4096)
+ adc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ae1:	39 df                	cmp    %ebx,%edi
+ ae3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ae6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aed:	eb 0a                	jmp    af9 <malloc+0x49>
+ aef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ af2:	8b 48 04             	mov    0x4(%eax),%ecx
+ af5:	39 f9                	cmp    %edi,%ecx
+ af7:	73 47                	jae    b40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ af9:	89 c2                	mov    %eax,%edx
+ afb:	39 05 48 14 00 00    	cmp    %eax,0x1448
+ b01:	75 ed                	jne    af0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	56                   	push   %esi
+ b07:	e8 e4 fb ff ff       	call   6f0 <sbrk>
+  if(p == (char*)-1)
+ b0c:	83 c4 10             	add    $0x10,%esp
+ b0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b12:	74 1c                	je     b30 <malloc+0x80>
+  hp->s.size = nu;
+ b14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	83 c0 08             	add    $0x8,%eax
+ b1d:	50                   	push   %eax
+ b1e:	e8 fd fe ff ff       	call   a20 <free>
+  return freep;
+ b23:	8b 15 48 14 00 00    	mov    0x1448,%edx
+      if((p = morecore(nunits)) == 0)
+ b29:	83 c4 10             	add    $0x10,%esp
+ b2c:	85 d2                	test   %edx,%edx
+ b2e:	75 c0                	jne    af0 <malloc+0x40>
+        return 0;
+  }
+}
+ b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b33:	31 c0                	xor    %eax,%eax
+}
+ b35:	5b                   	pop    %ebx
+ b36:	5e                   	pop    %esi
+ b37:	5f                   	pop    %edi
+ b38:	5d                   	pop    %ebp
+ b39:	c3                   	ret
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b40:	39 cf                	cmp    %ecx,%edi
+ b42:	74 4c                	je     b90 <malloc+0xe0>
+        p->s.size -= nunits;
+ b44:	29 f9                	sub    %edi,%ecx
+ b46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b4f:	89 15 48 14 00 00    	mov    %edx,0x1448
+}
+ b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b58:	83 c0 08             	add    $0x8,%eax
+}
+ b5b:	5b                   	pop    %ebx
+ b5c:	5e                   	pop    %esi
+ b5d:	5f                   	pop    %edi
+ b5e:	5d                   	pop    %ebp
+ b5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b60:	c7 05 48 14 00 00 4c 	movl   $0x144c,0x1448
+ b67:	14 00 00 
+    base.s.size = 0;
+ b6a:	b8 4c 14 00 00       	mov    $0x144c,%eax
+    base.s.ptr = freep = prevp = &base;
+ b6f:	c7 05 4c 14 00 00 4c 	movl   $0x144c,0x144c
+ b76:	14 00 00 
+    base.s.size = 0;
+ b79:	c7 05 50 14 00 00 00 	movl   $0x0,0x1450
+ b80:	00 00 00 
+    if(p->s.size >= nunits){
+ b83:	e9 54 ff ff ff       	jmp    adc <malloc+0x2c>
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b90:	8b 08                	mov    (%eax),%ecx
+ b92:	89 0a                	mov    %ecx,(%edx)
+ b94:	eb b9                	jmp    b4f <malloc+0x9f>
+ b96:	66 90                	xchg   %ax,%ax
+ b98:	66 90                	xchg   %ax,%ax
+ b9a:	66 90                	xchg   %ax,%ax
+ b9c:	66 90                	xchg   %ax,%ax
+ b9e:	66 90                	xchg   %ax,%ax
+
+00000ba0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 20             	sub    $0x20,%esp
+ ba9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ bac:	8b 7d 10             	mov    0x10(%ebp),%edi
+ baf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ bb2:	68 e8 03 00 00       	push   $0x3e8
+ bb7:	57                   	push   %edi
+ bb8:	56                   	push   %esi
+ bb9:	e8 e2 f9 ff ff       	call   5a0 <udiv64>
+ bbe:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ bc0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ bc3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ bc9:	29 c1                	sub    %eax,%ecx
+ bcb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ bce:	68 e8 03 00 00       	push   $0x3e8
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	e8 c6 f9 ff ff       	call   5a0 <udiv64>
+ bda:	83 c4 0c             	add    $0xc,%esp
+ bdd:	50                   	push   %eax
+ bde:	68 f5 0f 00 00       	push   $0xff5
+ be3:	53                   	push   %ebx
+ be4:	e8 87 fc ff ff       	call   870 <printf>
+  if(frac < 100)
+ be9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ bec:	83 c4 10             	add    $0x10,%esp
+ bef:	83 f9 63             	cmp    $0x63,%ecx
+ bf2:	76 1c                	jbe    c10 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ bf4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ bf7:	c7 45 0c fb 0f 00 00 	movl   $0xffb,0xc(%ebp)
+ bfe:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c04:	5b                   	pop    %ebx
+ c05:	5e                   	pop    %esi
+ c06:	5f                   	pop    %edi
+ c07:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ c08:	e9 63 fc ff ff       	jmp    870 <printf>
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ c10:	83 ec 08             	sub    $0x8,%esp
+ c13:	68 f9 0f 00 00       	push   $0xff9
+ c18:	53                   	push   %ebx
+ c19:	e8 52 fc ff ff       	call   870 <printf>
+  if(frac < 10)
+ c1e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c21:	83 c4 10             	add    $0x10,%esp
+ c24:	83 f9 09             	cmp    $0x9,%ecx
+ c27:	77 cb                	ja     bf4 <printps+0x54>
+    printf(fd, "0");
+ c29:	83 ec 08             	sub    $0x8,%esp
+ c2c:	68 f9 0f 00 00       	push   $0xff9
+ c31:	53                   	push   %ebx
+ c32:	e8 39 fc ff ff       	call   870 <printf>
+ c37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c3a:	83 c4 10             	add    $0x10,%esp
+ c3d:	eb b5                	jmp    bf4 <printps+0x54>
+ c3f:	90                   	nop
+
+00000c40 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ c40:	55                   	push   %ebp
+ c41:	89 e5                	mov    %esp,%ebp
+ c43:	57                   	push   %edi
+ c44:	56                   	push   %esi
+ c45:	53                   	push   %ebx
+ c46:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c4c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ c4f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ c52:	83 e8 01             	sub    $0x1,%eax
+ c55:	3d ff 00 00 00       	cmp    $0xff,%eax
+ c5a:	0f 87 37 02 00 00    	ja     e97 <bench+0x257>
+ c60:	8b 7d 14             	mov    0x14(%ebp),%edi
+ c63:	85 ff                	test   %edi,%edi
+ c65:	0f 84 2c 02 00 00    	je     e97 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ c6b:	83 ec 0c             	sub    $0xc,%esp
+ c6e:	ff 75 10             	push   0x10(%ebp)
+ c71:	ff 55 0c             	call   *0xc(%ebp)
+ c74:	5b                   	pop    %ebx
+ c75:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ c78:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ c7a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ c7d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ c80:	83 c4 10             	add    $0x10,%esp
+ c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c87:	90                   	nop
+    t0 = cycles();
+ c88:	e8 33 f9 ff ff       	call   5c0 <cycles>
+    fn(arg);
+ c8d:	83 ec 0c             	sub    $0xc,%esp
+ c90:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ c93:	89 c6                	mov    %eax,%esi
+ c95:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ c97:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ c9a:	e8 21 f9 ff ff       	call   5c0 <cycles>
+ c9f:	29 f0                	sub    %esi,%eax
+ ca1:	19 fa                	sbb    %edi,%edx
+ ca3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ caa:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ cad:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ cb4:	83 c3 01             	add    $0x1,%ebx
+ cb7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ cba:	7f cc                	jg     c88 <bench+0x48>
+  for(i = 1; i < n; i++){
+ cbc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ cc0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ cc3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ cc9:	bf 01 00 00 00       	mov    $0x1,%edi
+ cce:	74 77                	je     d47 <bench+0x107>
+ cd0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cd7:	90                   	nop
+    v = a[i];
+ cd8:	8b 01                	mov    (%ecx),%eax
+ cda:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ cdd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ ce3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ ce9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ cef:	89 c8                	mov    %ecx,%eax
+ cf1:	eb 1b                	jmp    d0e <bench+0xce>
+ cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cf7:	90                   	nop
+      a[j] = a[j-1];
+ cf8:	89 08                	mov    %ecx,(%eax)
+ cfa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ cfd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ d00:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d06:	39 c3                	cmp    %eax,%ebx
+ d08:	0f 84 72 01 00 00    	je     e80 <bench+0x240>
+ d0e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ d11:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ d14:	89 f7                	mov    %esi,%edi
+ d16:	89 c3                	mov    %eax,%ebx
+ d18:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ d1e:	19 d7                	sbb    %edx,%edi
+ d20:	72 d6                	jb     cf8 <bench+0xb8>
+ d22:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d28:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ d2e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ d34:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ d37:	83 c7 01             	add    $0x1,%edi
+ d3a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ d3d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ d3f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ d42:	75 94                	jne    cd8 <bench+0x98>
+ d44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d47:	83 ec 08             	sub    $0x8,%esp
+ d4a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ d50:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ d55:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ d5b:	e8 70 f8 ff ff       	call   5d0 <cyc2ns>
+ d60:	83 c4 0c             	add    $0xc,%esp
+ d63:	ff 75 14             	push   0x14(%ebp)
+ d66:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d6c:	f7 e3                	mul    %ebx
+ d6e:	01 ca                	add    %ecx,%edx
+ d70:	52                   	push   %edx
+ d71:	50                   	push   %eax
+ d72:	e8 29 f8 ff ff       	call   5a0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ d77:	89 06                	mov    %eax,(%esi)
+ d79:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d7c:	5f                   	pop    %edi
+ d7d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ d7e:	8b 45 18             	mov    0x18(%ebp),%eax
+ d81:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d83:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ d8a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ d91:	e8 3a f8 ff ff       	call   5d0 <cyc2ns>
+ d96:	83 c4 0c             	add    $0xc,%esp
+ d99:	ff 75 14             	push   0x14(%ebp)
+ d9c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ da2:	f7 e3                	mul    %ebx
+ da4:	01 ca                	add    %ecx,%edx
+ da6:	52                   	push   %edx
+ da7:	50                   	push   %eax
+ da8:	e8 f3 f7 ff ff       	call   5a0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ dad:	89 46 08             	mov    %eax,0x8(%esi)
+ db0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ db3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ db4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ db7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ db8:	8d 50 01             	lea    0x1(%eax),%edx
+ dbb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ dc0:	6b d2 63             	imul   $0x63,%edx,%edx
+ dc3:	f7 e2                	mul    %edx
+ dc5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ dc8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ dcf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ dd6:	e8 f5 f7 ff ff       	call   5d0 <cyc2ns>
+ ddb:	83 c4 0c             	add    $0xc,%esp
+ dde:	ff 75 14             	push   0x14(%ebp)
+ de1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ de7:	f7 e3                	mul    %ebx
+ de9:	01 ca                	add    %ecx,%edx
+ deb:	52                   	push   %edx
+ dec:	50                   	push   %eax
+ ded:	e8 ae f7 ff ff       	call   5a0 <udiv64>
+
+  if(name){
+ df2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ df5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ df8:	89 46 10             	mov    %eax,0x10(%esi)
+ dfb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ dfe:	85 c9                	test   %ecx,%ecx
+ e00:	74 72                	je     e74 <bench+0x234>
+    printf(1, "%s: min ", name);
+ e02:	83 ec 04             	sub    $0x4,%esp
+ e05:	ff 75 08             	push   0x8(%ebp)
+ e08:	68 fe 0f 00 00       	push   $0xffe
+ e0d:	6a 01                	push   $0x1
+ e0f:	e8 5c fa ff ff       	call   870 <printf>
+    printps(1, st->min);
+ e14:	83 c4 0c             	add    $0xc,%esp
+ e17:	ff 76 04             	push   0x4(%esi)
+ e1a:	ff 36                	push   (%esi)
+ e1c:	6a 01                	push   $0x1
+ e1e:	e8 7d fd ff ff       	call   ba0 <printps>
+    printf(1, " median ");
+ e23:	58                   	pop    %eax
+ e24:	5a                   	pop    %edx
+ e25:	68 07 10 00 00       	push   $0x1007
+ e2a:	6a 01                	push   $0x1
+ e2c:	e8 3f fa ff ff       	call   870 <printf>
+    printps(1, st->median);
+ e31:	83 c4 0c             	add    $0xc,%esp
+ e34:	ff 76 0c             	push   0xc(%esi)
+ e37:	ff 76 08             	push   0x8(%esi)
+ e3a:	6a 01                	push   $0x1
+ e3c:	e8 5f fd ff ff       	call   ba0 <printps>
+    printf(1, " p99 ");
+ e41:	59                   	pop    %ecx
+ e42:	5b                   	pop    %ebx
+ e43:	68 10 10 00 00       	push   $0x1010
+ e48:	6a 01                	push   $0x1
+ e4a:	e8 21 fa ff ff       	call   870 <printf>
+    printps(1, st->p99);
+ e4f:	83 c4 0c             	add    $0xc,%esp
+ e52:	ff 76 14             	push   0x14(%esi)
+ e55:	ff 76 10             	push   0x10(%esi)
+ e58:	6a 01                	push   $0x1
+ e5a:	e8 41 fd ff ff       	call   ba0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ e5f:	83 c4 0c             	add    $0xc,%esp
+ e62:	ff 75 18             	push   0x18(%ebp)
+ e65:	68 16 10 00 00       	push   $0x1016
+ e6a:	6a 01                	push   $0x1
+ e6c:	e8 ff f9 ff ff       	call   870 <printf>
+ e71:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ e74:	31 c0                	xor    %eax,%eax
+}
+ e76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e79:	5b                   	pop    %ebx
+ e7a:	5e                   	pop    %esi
+ e7b:	5f                   	pop    %edi
+ e7c:	5d                   	pop    %ebp
+ e7d:	c3                   	ret
+ e7e:	66 90                	xchg   %ax,%ax
+ e80:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ e86:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ e8c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ e92:	e9 97 fe ff ff       	jmp    d2e <bench+0xee>
+    return -1;
+ e97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e9c:	eb d8                	jmp    e76 <bench+0x236>
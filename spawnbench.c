@@ -0,0 +1,127 @@
+// Process creation cost of running a command.
+//   spawnbench [n]
+// Times n runs of a trivial command started by fork+exec and by
+// spawn, first at this program's own size and then after growing
+// it by BIGMB, as a shell with a large heap would be.  Last, has
+// sh run a script of n such commands.  Reports commands/sec.
+
+#include "types.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define BIGMB  4
+
+static char *cmd[] = { "spawnbench", "-x", 0 };
+static char *shcmd[] = { "sh", 0 };
+
+static uint
+rate(int n, uint64 ns)
+{
+  uint us;
+
+  us = udiv64(ns, 1000);
+  return us ? (uint)udiv64((uint64)n * 1000000, us) : 0;
+}
+
+static uint64
+runfork(int n)
+{
+  uint64 t0;
+  int i;
+
+  t0 = cycles();
+  for(i = 0; i < n; i++){
+    if(fork() == 0){
+      exec(cmd[0], cmd);
+      exit();
+    }
+    wait();
+  }
+  return cyc2ns(cycles() - t0);
+}
+
+static uint64
+runspawn(int n)
+{
+  uint64 t0;
+  int i;
+
+  t0 = cycles();
+  for(i = 0; i < n; i++){
+    if(spawn(cmd[0], cmd, 0) >= 0)
+      wait();
+  }
+  return cyc2ns(cycles() - t0);
+}
+
+// Run sh on a script of n commands, with its prompts and
+// output going to a scratch file.
+static uint64
+runsh(int n)
+{
+  uint64 t0;
+  int fd, i;
+
+  if((fd = open("spawnbench.sh", O_CREATE|O_WRONLY)) < 0){
+    printf(2, "spawnbench: cannot create script\n");
+    return 0;
+  }
+  for(i = 0; i < n; i++)
+    write(fd, "spawnbench -x\n", 14);
+  close(fd);
+
+  t0 = cycles();
+  if(fork() == 0){
+    close(0);
+    open("spawnbench.sh", O_RDONLY);
+    close(2);
+    open("spawnbench.out", O_CREATE|O_WRONLY);
+    exec(shcmd[0], shcmd);
+    exit();
+  }
+  wait();
+  t0 = cyc2ns(cycles() - t0);
+  unlink("spawnbench.sh");
+  unlink("spawnbench.out");
+  return t0;
+}
+
+static void
+report(char *what, int n, uint64 ns)
+{
+  printf(1, "%s\t%d\n", what, rate(n, ns));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+  char *p;
+  uint i;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit();
+  n = 200;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < 1){
+    printf(2, "usage: spawnbench [n]\n");
+    exit();
+  }
+
+  printf(1, "method\t\t\tcmds/sec\n");
+  report("fork+exec\t", n, runfork(n));
+  report("spawn\t\t", n, runspawn(n));
+
+  if((p = sbrk(BIGMB * 1024 * 1024)) == (char*)-1){
+    printf(2, "spawnbench: out of memory\n");
+    exit();
+  }
+  for(i = 0; i < BIGMB * 1024 * 1024; i += 4096)
+    p[i] = 1;
+  report("fork+exec +4MB\t", n, runfork(n));
+  report("spawn +4MB\t", n, runspawn(n));
+
+  report("sh script\t", n, runsh(n));
+  exit();
+}
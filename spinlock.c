@@ -8,13 +8,218 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+#define NLOCKCLASS 32
+
+// Contention counters for all locks sharing a name.  Each cpu
+// updates only its own row, with interrupts off, so counting
+// needs no atomic instructions.
+struct lockclass {
+  char *name;
+  int sleep;
+  struct {
+    uint64 nacquire;
+    uint64 ncontended;
+    uint64 wait;
+  } cpu[NCPU];
+};
+
+static struct lockclass classes[NLOCKCLASS];
+static int nclass;
+static uint classlock;  // guards classes[] and nclass
+
+// Queue nodes for MCS locks.  A cpu needs one for each MCS lock
+// it holds or is waiting for; interrupts are off meanwhile, so
+// only that cpu touches its row and its mask.
+#define NMCSNODE 8
+static struct mcsnode mcsnodes[NCPU][NMCSNODE];
+static uint mcsused[NCPU];
+
+// Find or create the class for locks called name.
+// Returns 0 if the table is full; such locks go uncounted.
+// Called from initlock() before mycpu() works, so it
+// guards the table with a bare xchg lock and cli.
+struct lockclass*
+findlockclass(char *name, int sleep)
+{
+  struct lockclass *c;
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&classlock, 1) != 0)
+    ;
+  for(c = classes; c < &classes[nclass]; c++)
+    if(c->sleep == sleep && strncmp(c->name, name, 16) == 0)
+      goto found;
+  if(nclass < NLOCKCLASS){
+    c = &classes[nclass++];
+    c->name = name;
+    c->sleep = sleep;
+  } else
+    c = 0;
+found:
+  xchg(&classlock, 0);
+  if(eflags & FL_IF)
+    sti();
+  return c;
+}
+
+// Count one acquisition, on cpu id, of a lock in class c
+// that waited wait cycles.  Interrupts must be off.
+void
+lockcount(struct lockclass *c, int id, int contended, uint64 wait)
+{
+  if(c == 0)
+    return;
+  c->cpu[id].nacquire++;
+  if(contended){
+    c->cpu[id].ncontended++;
+    c->cpu[id].wait += wait;
+  }
+}
+
+// Sum the counters of up to n classes into buf,
+// which may be a user address in the current page table.
+// Returns the number of classes copied.
+int
+lockstatread(struct lockstat *buf, int n)
+{
+  struct lockstat s;
+  int i, j;
+
+  for(i = 0; i < nclass && i < n; i++){
+    memset(&s, 0, sizeof(s));
+    safestrcpy(s.name, classes[i].name, sizeof(s.name));
+    s.sleep = classes[i].sleep;
+    for(j = 0; j < ncpu; j++){
+      s.nacquire += classes[i].cpu[j].nacquire;
+      s.ncontended += classes[i].cpu[j].ncontended;
+      s.wait += classes[i].cpu[j].wait;
+    }
+    buf[i] = s;
+  }
+  return i;
+}
+
+// Zero every class's counters.
+void
+lockstatreset(void)
+{
+  int i;
+
+  for(i = 0; i < nclass; i++)
+    memset(classes[i].cpu, 0, sizeof(classes[i].cpu));
+}
 
 void
 initlock(struct spinlock *lk, char *name)
+{
+  initlockkind(lk, name, LK_TAS);
+}
+
+// Like initlock, for a lock of the given kind (see spinlock.h).
+void
+initlockkind(struct spinlock *lk, char *name, int kind)
 {
   lk->name = name;
   lk->locked = 0;
+  lk->kind = kind;
+  lk->next = 0;
+  lk->owner = 0;
+  lk->tail = 0;
+  lk->node = 0;
   lk->cpu = 0;
+  lk->class = findlockclass(name, 0);
+}
+
+// The lock-kind specific halves of acquire().  Each returns 1,
+// and sets *wait to the cycles spent, if the lock was held.
+// Only the spin is timed, to keep the common case cheap.
+
+static int
+tasacquire(struct spinlock *lk, uint64 *wait)
+{
+  uint64 t0;
+
+  // The xchg is atomic.
+  if(xchg(&lk->locked, 1) == 0)
+    return 0;
+  t0 = rdtsc();
+  while(xchg(&lk->locked, 1) != 0)
+    pause();
+  *wait = rdtsc() - t0;
+  return 1;
+}
+
+// Take a ticket, then wait for it to be served.
+static int
+ticketacquire(struct spinlock *lk, uint64 *wait)
+{
+  volatile uint *owner = &lk->owner;
+  uint64 t0;
+  uint me;
+
+  me = xadd(&lk->next, 1);
+  if(*owner == me)
+    return 0;
+  t0 = rdtsc();
+  while(*owner != me)
+    pause();
+  *wait = rdtsc() - t0;
+  return 1;
+}
+
+// Append one of this cpu's nodes to the queue, then spin on
+// that node until the previous holder hands the lock over.
+static int
+mcsacquire(struct spinlock *lk, int id, uint64 *wait)
+{
+  struct mcsnode *n, *prev;
+  uint64 t0;
+  int i;
+
+  for(i = 0; i < NMCSNODE && (mcsused[id] & (1 << i)); i++)
+    ;
+  if(i == NMCSNODE)
+    panic("acquire: out of mcs nodes");
+  mcsused[id] |= 1 << i;
+  n = &mcsnodes[id][i];
+  n->next = 0;
+  n->wait = 1;
+
+  prev = (struct mcsnode*)xchg((volatile uint*)&lk->tail, (uint)n);
+  if(prev != 0){
+    t0 = rdtsc();
+    prev->next = n;
+    while(n->wait)
+      pause();
+    *wait = rdtsc() - t0;
+  }
+  lk->node = n;
+  return prev != 0;
+}
+
+// Hand an MCS lock to the next waiter, if any, and free
+// this cpu's node.
+static void
+mcsrelease(struct spinlock *lk, int id)
+{
+  struct mcsnode *n;
+
+  n = lk->node;
+  if(n->next == 0){
+    // No known successor: try to empty the queue.
+    if(cmpxchg((volatile uint*)&lk->tail, (uint)n, 0) == (uint)n)
+      goto done;
+    // A waiter has swapped itself in but not yet linked.
+    while(n->next == 0)
+      pause();
+  }
+  n->next->wait = 0;
+done:
+  mcsused[id] &= ~(1 << (n - mcsnodes[id]));
 }
 
 // Acquire the lock.
@@ -24,13 +229,27 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint64 wait;
+  int contended;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  wait = 0;
+  switch(lk->kind){
+  case LK_TICKET:
+    contended = ticketacquire(lk, &wait);
+    lk->locked = 1;
+    break;
+  case LK_MCS:
+    contended = mcsacquire(lk, mycpu() - cpus, &wait);
+    lk->locked = 1;
+    break;
+  default:
+    contended = tasacquire(lk, &wait);
+    break;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,6 +259,7 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+  lockcount(lk->class, lk->cpu - cpus, contended, wait);
 }
 
 // Release the lock.
@@ -51,6 +271,8 @@ release(struct spinlock *lk)
 
   lk->pcs[0] = 0;
   lk->cpu = 0;
+  if(lk->kind != LK_TAS)
+    lk->locked = 0;
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that all the stores in the critical
@@ -59,11 +281,101 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  switch(lk->kind){
+  case LK_TICKET:
+    // Serve the next ticket.  Only the holder writes owner.
+    asm volatile("incl %0" : "+m" (lk->owner) : );
+    break;
+  case LK_MCS:
+    mcsrelease(lk, mycpu() - cpus);
+    break;
+  default:
+    // Release the lock, equivalent to lk->locked = 0.
+    // This code can't use a C assignment, since it might
+    // not be atomic. A real OS would use C atomics here.
+    asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+    break;
+  }
+
+  popcli();
+}
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+  lk->name = name;
+  lk->cnt = 0;
+  lk->class = findlockclass(name, 0);
+}
 
+// Acquire lk for reading: wait while a writer holds it or
+// waits for it, then add one reader.
+void
+acquireread(struct rwlock *lk)
+{
+  volatile uint *cnt = &lk->cnt;
+  uint64 t0, wait;
+  uint v;
+
+  pushcli();
+  wait = 0;
+  t0 = 0;
+  for(;;){
+    v = *cnt;
+    if(!(v & (RW_WRITER|RW_WAITING)) && cmpxchg(cnt, v, v+1) == v)
+      break;
+    if(t0 == 0)
+      t0 = rdtsc();
+    pause();
+  }
+  if(t0)
+    wait = rdtsc() - t0;
+  lockcount(lk->class, mycpu() - cpus, t0 != 0, wait);
+}
+
+void
+releaseread(struct rwlock *lk)
+{
+  if((lk->cnt & ~RW_WAITING) == 0 || (lk->cnt & RW_WRITER))
+    panic("releaseread");
+  xadd(&lk->cnt, -1);
+  popcli();
+}
+
+// Acquire lk for writing: announce the wait to stop new
+// readers, then wait for the current ones to leave.
+void
+acquirewrite(struct rwlock *lk)
+{
+  volatile uint *cnt = &lk->cnt;
+  uint64 t0, wait;
+  uint v;
+
+  pushcli();
+  wait = 0;
+  t0 = 0;
+  for(;;){
+    v = *cnt;
+    if((v & ~RW_WAITING) == 0 && cmpxchg(cnt, v, RW_WRITER) == v)
+      break;
+    if(!(v & RW_WAITING))
+      cmpxchg(cnt, v, v | RW_WAITING);
+    if(t0 == 0)
+      t0 = rdtsc();
+    pause();
+  }
+  if(t0)
+    wait = rdtsc() - t0;
+  lockcount(lk->class, mycpu() - cpus, t0 != 0, wait);
+}
+
+void
+releasewrite(struct rwlock *lk)
+{
+  if(!(lk->cnt & RW_WRITER))
+    panic("releasewrite");
+  // Clears RW_WAITING too; other waiting writers set it again.
+  xchg(&lk->cnt, 0);
   popcli();
 }
 
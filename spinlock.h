@@ -1,11 +1,43 @@
 // Mutual exclusion lock.
+// A lock is one of three kinds, chosen when it is initialized:
+#define LK_TAS     0   // test-and-set: unfair, waiters all hit one line
+#define LK_TICKET  1   // FIFO; waiters spin reading one shared line
+#define LK_MCS     2   // FIFO; each waiter spins on its own queue node
+
+// A waiter's place in an MCS lock's queue; one cache line each.
+struct mcsnode {
+  struct mcsnode *volatile next;
+  volatile uint wait;
+  char pad[56];
+};
+
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held?  The lock word for LK_TAS.
+  uint kind;         // LK_TAS, LK_TICKET or LK_MCS
+
+  uint next;         // LK_TICKET: next ticket to hand out
+  uint owner;        // LK_TICKET: ticket now being served
+  struct mcsnode *tail;  // LK_MCS: last node in the queue
+  struct mcsnode *node;  // LK_MCS: the holder's node
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For contention statistics:
+  struct lockclass *class;  // Counters shared by locks of this name.
 };
 
+// Reader-writer spin lock, for read-mostly data.  Any number of
+// cpus may hold it for reading at once, or one for writing.  A
+// waiting writer holds off new readers so that it is not starved.
+#define RW_WRITER  0x80000000   // cnt: held for writing
+#define RW_WAITING 0x40000000   // cnt: a writer is waiting
+
+struct rwlock {
+  uint cnt;          // Readers holding it, plus the flags above
+  char *name;        // Name of lock.
+  struct lockclass *class;  // Counters shared by locks of this name.
+};
@@ -1,14 +1,28 @@
 #include "types.h"
 #include "x86.h"
+#include "mmu.h"
+
+static int nontemporal;  // CPU has SSE2 and the OS has enabled it
 
 void*
 memset(void *dst, int c, uint n)
 {
-  if ((int)dst%4 == 0 && n%4 == 0){
-    c &= 0xFF;
-    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
-  } else
-    stosb(dst, c, n);
+  char *d;
+  uint m;
+
+  d = dst;
+  c &= 0xFF;
+  if(n >= 16){
+    // Align the destination, then store whole words.
+    m = -(uint)d & 3;
+    stosb(d, c, m);
+    d += m;
+    n -= m;
+    stosl(d, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+    d += n & ~3;
+    n &= 3;
+  }
+  stosb(d, c, n);
   return dst;
 }
 
@@ -33,6 +47,7 @@ memmove(void *dst, const void *src, uint n)
 {
   const char *s;
   char *d;
+  uint m;
 
   s = src;
   d = dst;
@@ -41,9 +56,20 @@ memmove(void *dst, const void *src, uint n)
     d += n;
     while(n-- > 0)
       *--d = *--s;
+  } else if(n >= 16 && ((uint)s & 3) == ((uint)d & 3)){
+    // Copying forward is safe even if the buffers overlap.
+    // Align both pointers, then move whole words.
+    m = -(uint)d & 3;
+    movsb(d, s, m);
+    d += m;
+    s += m;
+    n -= m;
+    movsl(d, s, n/4);
+    d += n & ~3;
+    s += n & ~3;
+    movsb(d, s, n & 3);
   } else
-    while(n-- > 0)
-      *d++ = *s++;
+    movsb(d, s, n);
 
   return dst;
 }
@@ -103,3 +129,113 @@ strlen(const char *s)
   return n;
 }
 
+
+// Enable SSE on this cpu if it has SSE2, so that pgzero() can
+// use non-temporal stores.  Run once on every cpu at startup.
+// This enables it for user code too, so each process's SSE
+// registers are then switched along with it (fpusave).
+void
+sseinit(void)
+{
+  uint edx;
+
+  readcpuid(1, 0, 0, 0, &edx);
+  if((edx & (CPUID_FXSR|CPUID_SSE2)) != (CPUID_FXSR|CPUID_SSE2))
+    return;
+  lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+  nontemporal = 1;
+}
+
+// A process's x87 and SSE registers, in FXSAVE format.  sched
+// saves them before switching away and restores them after.
+// Without SSE, CR4.OSFXSR is clear and user code cannot use the
+// xmm registers, so there is nothing to switch.
+void
+fpuinit(char *fx)
+{
+  memset(fx, 0, FXSIZE);
+  *(ushort*)fx = 0x37f;          // x87 control word, as after fninit
+  *(uint*)(fx + 24) = 0x1f80;    // MXCSR: all exceptions masked
+}
+
+void
+fpusave(char *fx)
+{
+  if(nontemporal)
+    fxsave(fx);
+}
+
+void
+fpurestore(char *fx)
+{
+  if(nontemporal)
+    fxrstor(fx);
+}
+
+#define NTCHUNK (64*1024)  // bytes ntzero clears per cli
+
+// Zero n bytes at 64-byte-aligned dst with non-temporal stores,
+// which write around the cache.  Uses %xmm0, which may hold a
+// user process's state: it is saved and restored with interrupts
+// off, so no other code can run on this cpu in between.  A huge
+// page is cleared NTCHUNK at a time, letting interrupts in
+// between, so that timer and disk interrupts are not held off
+// for the whole 4MB.
+static void
+ntzero(void *dst, uint n)
+{
+  uchar save[16];
+  char *p, *e, *end;
+  uint eflags;
+
+  eflags = readeflags();
+  for(p = dst, end = p + n; p < end; ){
+    e = p + (end - p < NTCHUNK ? end - p : NTCHUNK);
+    cli();
+    asm volatile("movdqu %%xmm0, %0" : "=m" (save));
+    asm volatile("pxor %%xmm0, %%xmm0" : : );
+    for(; p < e; p += 64)
+      asm volatile("movntdq %%xmm0, (%0)\n\t"
+                   "movntdq %%xmm0, 16(%0)\n\t"
+                   "movntdq %%xmm0, 32(%0)\n\t"
+                   "movntdq %%xmm0, 48(%0)" : : "r" (p) : "memory");
+    // Order the weakly-ordered stores before anything that follows.
+    asm volatile("sfence" : : : "memory");
+    asm volatile("movdqu %0, %%xmm0" : : "m" (save));
+    if(eflags & FL_IF)
+      sti();
+  }
+}
+
+// Zero n bytes at page-aligned dst; n must be a multiple of PGSIZE.
+// A whole huge page is larger than the caches, so clearing one
+// with ordinary stores would only evict useful lines; use
+// non-temporal stores for it when the cpu supports them.
+void
+pgzero(void *dst, uint n)
+{
+  if(nontemporal && n >= HUGEPGSIZE)
+    ntzero(dst, n);
+  else
+    stosl(dst, 0, n/4);
+}
+
+// Like pgzero, but always bypass the cache when possible.  For
+// pages cleared ahead of time, which will not be touched until
+// some later allocation.
+void
+pgzero_nt(void *dst, uint n)
+{
+  if(nontemporal)
+    ntzero(dst, n);
+  else
+    stosl(dst, 0, n/4);
+}
+
+// Copy n bytes between page-aligned buffers that do not overlap;
+// n must be a multiple of PGSIZE.
+void
+pgcopy(void *dst, const void *src, uint n)
+{
+  movsl(dst, src, n/4);
+}
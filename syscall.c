@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "sysstat.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -21,6 +22,8 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(pagein(addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -39,6 +42,8 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && pagein((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -54,9 +59,11 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+// lies within the process address space, and load its pages;
+// if write is set, also give the process its own copy of any
+// shared text page in it, since the kernel will write there.
+static int
+argblock(int n, char **pp, int size, int write)
 {
   int i;
   struct proc *curproc = myproc();
@@ -65,10 +72,27 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  if(pagein(i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// A block the kernel may write to.
+int
+argptr(int n, char **pp, int size)
+{
+  return argblock(n, pp, size, 1);
+}
+
+// A block the kernel only reads, such as write()'s buffer,
+// which may be in a shared text page.
+int
+argrdptr(int n, char **pp, int size)
+{
+  return argblock(n, pp, size, 0);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -110,6 +134,26 @@ extern int sys_printPDE(void);
 extern int sys_get_free_pa_space(void);
 extern int sys_demote(void);
 extern int sys_huge_page_count(void);
+extern int sys_tscfreq(void);
+extern int sys_tracemask(void);
+extern int sys_traceread(void);
+extern int sys_profile(void);
+extern int sys_profread(void);
+extern int sys_lockstat(void);
+extern int sys_lockstatreset(void);
+extern int sys_sysstat(void);
+extern int sys_kbench(void);
+extern int sys_yield(void);
+extern int sys_setpriority(void);
+extern int sys_getpriority(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_spawn(void);
+extern int sys_diskstat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -137,17 +181,91 @@ static int (*syscalls[])(void) = {
 [SYS_get_free_pa_space] sys_get_free_pa_space, 
 [SYS_demote] sys_demote, 
 [SYS_huge_page_count] sys_huge_page_count, 
+[SYS_tscfreq] sys_tscfreq,
+[SYS_tracemask] sys_tracemask,
+[SYS_traceread] sys_traceread,
+[SYS_profile] sys_profile,
+[SYS_profread] sys_profread,
+[SYS_lockstat] sys_lockstat,
+[SYS_lockstatreset] sys_lockstatreset,
+[SYS_sysstat] sys_sysstat,
+[SYS_kbench] sys_kbench,
+[SYS_yield] sys_yield,
+[SYS_setpriority] sys_setpriority,
+[SYS_getpriority] sys_getpriority,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_clone] sys_clone,
+[SYS_join] sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_spawn] sys_spawn,
+[SYS_diskstat] sys_diskstat,
 };
 
+// Latency histograms, one row per cpu so that
+// counting needs only interrupts off, not a lock.
+static struct sysstat sysstats[NCPU][NELEM(syscalls)];
+
+// Count one call of system call num that took dt cycles.
+static void
+syscallcount(int num, uint64 dt)
+{
+  int b;
+
+  if(dt >> 32)
+    b = NSYSBUCKET-1;
+  else if((uint)dt == 0)
+    b = 0;
+  else
+    b = 31 - __builtin_clz((uint)dt);
+  if(b >= NSYSBUCKET)
+    b = NSYSBUCKET-1;
+  pushcli();
+  sysstats[cpuid()][num].hist[b]++;
+  popcli();
+}
+
+// Copy latency histograms for system calls 0..n-1 into buf,
+// summed over all cpus if cpu is -1.  Returns the number of
+// system calls copied, or -1 for a bad cpu.
+int
+sys_sysstat(void)
+{
+  struct sysstat *buf;
+  int cpu, n, i, c, b;
+
+  if(argint(0, &cpu) < 0 || argint(2, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*buf) ||
+     argptr(1, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  if(cpu < -1 || cpu >= ncpu)
+    return -1;
+  if(n > NELEM(syscalls))
+    n = NELEM(syscalls);
+  memset(buf, 0, n*sizeof(*buf));
+  for(c = 0; c < ncpu; c++){
+    if(cpu != -1 && c != cpu)
+      continue;
+    for(i = 0; i < n; i++)
+      for(b = 0; b < NSYSBUCKET; b++)
+        buf[i].hist[b] += sysstats[c][i].hist[b];
+  }
+  return n;
+}
+
 void
 syscall(void)
 {
   int num;
+  uint64 t0;
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    t0 = rdtsc();
     curproc->tf->eax = syscalls[num]();
+    syscallcount(num, rdtsc() - t0);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
@@ -26,3 +26,23 @@
 #define SYS_demote 25
 #define SYS_huge_page_count 26
 #define SYS_get_free_pa_space 27
+#define SYS_tscfreq 28
+#define SYS_tracemask 29
+#define SYS_traceread 30
+#define SYS_profile 31
+#define SYS_profread 32
+#define SYS_lockstat 33
+#define SYS_lockstatreset 34
+#define SYS_sysstat 35
+#define SYS_kbench 36
+#define SYS_yield 37
+#define SYS_setpriority 38
+#define SYS_getpriority 39
+#define SYS_sched_setaffinity 40
+#define SYS_sched_getaffinity 41
+#define SYS_clone 42
+#define SYS_join 43
+#define SYS_futex_wait 44
+#define SYS_futex_wake 45
+#define SYS_spawn 46
+#define SYS_diskstat 47
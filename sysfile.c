@@ -85,7 +85,7 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argrdptr(1, &p, n) < 0)
     return -1;
   return filewrite(f, p, n);
 }
@@ -393,19 +393,19 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the path and argv arguments of exec or spawn.
+static int
+argexec(char **path, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
   uint uargv, uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argstr(0, path) < 0 || argint(1, (int*)&uargv) < 0){
     return -1;
   }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -416,9 +416,44 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+
+  if(argexec(&path, argv) < 0)
+    return -1;
   return exec(path, argv);
 }
 
+// spawn(path, argv, fds): if fds is not 0, it holds NOFILE
+// descriptors, and the child's descriptor i is a copy of the
+// caller's fds[i], or closed if that is not open.  Otherwise
+// the child gets copies of all the caller's, as after fork.
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  struct file *ofile[NOFILE];
+  int *fds, i;
+
+  if(argexec(&path, argv) < 0 || argint(2, &i) < 0)
+    return -1;
+  if(i == 0)
+    return spawn(path, argv, myproc()->ofile);
+  if(argrdptr(2, (char**)&fds, NOFILE*sizeof(fds[0])) < 0)
+    return -1;
+  for(i = 0; i < NOFILE; i++){
+    ofile[i] = 0;
+    if(fds[i] >= 0 && fds[i] < NOFILE)
+      ofile[i] = myproc()->ofile[fds[i]];
+  }
+  return spawn(path, argv, ofile);
+}
+
 int
 sys_pipe(void)
 {
@@ -6,6 +6,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "trace.h"
+#include "prof.h"
+#include "lockstat.h"
+#include "diskstat.h"
+#include "kbench.h"
 
 int
 sys_fork(void)
@@ -90,6 +95,96 @@ sys_uptime(void)
   return xticks;
 }
 
+// Give up the cpu, and the rest of the time slice, to any
+// other runnable process.
+int
+sys_yield(void)
+{
+  myproc()->slice = 0;
+  yield();
+  return 0;
+}
+
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
+int
+sys_getpriority(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getpriority(pid);
+}
+
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return 0;
+  return getaffinity(pid);
+}
+
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone(fn, arg, stack);
+}
+
+int
+sys_join(void)
+{
+  int tid;
+
+  if(argint(0, &tid) < 0)
+    return -1;
+  return join(tid);
+}
+
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
 int 
 sys_getpa(void) 
 {
@@ -138,9 +233,12 @@ sys_getpagesize(void)
 void promote_page(void *va) {
     void *buffer = kalloc_huge();
     if(buffer == 0)
+    {
+      trace(TR_PROMOTE_FAIL, (uint)va);
       return;
+    }
     buffer = (void*)V2P(buffer);
-    memmove(P2V(buffer), va, HUGEPGSIZE);
+    pgcopy(P2V(buffer), va, HUGEPGSIZE);
     deallocate_pagetable(va);
 
     // inserting the address and setting pse bit on
@@ -148,7 +246,7 @@ void promote_page(void *va) {
     *pde &= 0xfff;                                      // clear old address
     *pde |= PTE_ADDR(buffer);                           // add new buffer's physical address
     *pde |= PTE_P | PTE_W | PTE_U | PTE_PS;             // set pageset bit
-
+    trace(TR_PROMOTE, (uint)va);
 }
 
 void demote_page(void *va) {
@@ -160,14 +258,13 @@ void demote_page(void *va) {
 
     // 2.2. allocate a page table and all of its pages.
     // 2.3. copy all data to newly allocated page table.
-    pte_t *pgtable = (pte_t*)kalloc();
-    memset(pgtable, 0, PGSIZE);
+    pte_t *pgtable = (pte_t*)kzalloc();
     for(int i=0; i<NPTENTRIES; i++)
     {
       void *buffer = (void*)kalloc();
       pgtable[i] |= (V2P(buffer));
       pgtable[i] |= PTE_P | PTE_U | PTE_W;
-      memmove(buffer, va+i*PGSIZE, PGSIZE);
+      pgcopy(buffer, va+i*PGSIZE, PGSIZE);
     }
     
     // 2.4. deallocate huge page.
@@ -177,6 +274,7 @@ void demote_page(void *va) {
     *pde = 0;
     *pde |= (V2P(pgtable) & ~0xfff);
     *pde |= PTE_P | PTE_U | PTE_W;
+    trace(TR_DEMOTE, (uint)va);
 }
 
 int 
@@ -184,18 +282,25 @@ sys_promote(void) {
   // 1. Get arguments
   void *va;
   int size;
-  argptr(0, (char **)&va, sizeof(va));
+  argrdptr(0, (char **)&va, sizeof(va));
   argint(1, &size);
   void *end = va+size;
 
+  // Threads on other cpus could keep using the old small pages.
+  if(myproc()->shared)
+    return -1;
+
   va = (void*)HUGEPGROUNDUP((uint)va);
-  for(void *ptr=va; ptr+HUGEPGSIZE < end; ptr += HUGEPGSIZE)  // iterating at huge page intervals
+  if(va < end && pagein((uint)va, end - va, 1) < 0)  // no shared pages to free
+    return -1;
+  for(void *ptr=va; ptr+HUGEPGSIZE <= end; ptr += HUGEPGSIZE)  // iterating at huge page intervals
   {
     promote_page(ptr);
   }
 
   // Invalidate TLB
   lcr3(V2P(myproc()->pgdir));   
+  trace(TR_TLBFLUSH, V2P(myproc()->pgdir));
   return 0;
 }
 
@@ -205,8 +310,10 @@ sys_demote(void) {
   // 1. Get arguments
   void *va;
   int size;
-  argptr(0, (char**)&va, sizeof(va));
+  argrdptr(0, (char**)&va, sizeof(va));
   argint(1, &size);
+  if(myproc()->shared)  // as in sys_promote
+    return -1;
   
   size -= (int)(HUGEPGROUNDUP((uint)va)-(uint)va);
   va = (void*)HUGEPGROUNDUP((uint)va);
@@ -224,7 +331,7 @@ int
 sys_huge_page_count(void) {
   void *va;
   int size;
-  argptr(0, (char**)&va, sizeof(int));
+  argrdptr(0, (char**)&va, sizeof(int));
   argint(1, &size);
 
   return huge_page_count(va, size);
@@ -234,4 +341,116 @@ int
 sys_get_free_pa_space(void)
 {
   return kfreespace();
-}
\ No newline at end of file
+}
+
+// set the mask of traced vm events; returns the old mask.
+int
+sys_tracemask(void)
+{
+  int mask;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+  return settracemask(mask);
+}
+
+// drain up to n vm trace events into the user buffer.
+int
+sys_traceread(void)
+{
+  struct traceev *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*buf) ||
+     argptr(0, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return traceread(buf, n);
+}
+
+// sample the running eip every period timer interrupts
+// (0 stops sampling); returns the old period.
+int
+sys_profile(void)
+{
+  int period;
+
+  if(argint(0, &period) < 0 || period < 0)
+    return -1;
+  return setprofperiod(period);
+}
+
+// drain up to n profiler samples into the user buffer.
+int
+sys_profread(void)
+{
+  struct profsample *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*buf) ||
+     argptr(0, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return profread(buf, n);
+}
+
+// copy contention statistics for up to n lock classes
+// into the user buffer; returns the number copied.
+int
+sys_lockstat(void)
+{
+  struct lockstat *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*buf) ||
+     argptr(0, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return lockstatread(buf, n);
+}
+
+// zero all lock contention statistics.
+int
+sys_lockstatreset(void)
+{
+  lockstatreset();
+  return 0;
+}
+
+// copy the queue statistics of up to n disks into
+// the user buffer; returns the number copied.
+int
+sys_diskstat(void)
+{
+  struct diskstat *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*buf) ||
+     argptr(0, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return idestatread(buf, n);
+}
+
+// run kernel microbenchmark which, storing up to n results
+// in the user buffer; returns the number of results.
+int
+sys_kbench(void)
+{
+  struct kbresult *res;
+  int which, n;
+
+  if(argint(0, &which) < 0 || argint(2, &n) < 0 || n < 0 ||
+     n > myproc()->sz / sizeof(*res) ||
+     argptr(1, (char**)&res, n*sizeof(*res)) < 0)
+    return -1;
+  return kbench(which, res, n);
+}
+
+// return the calibrated time-stamp counter
+// frequency in kHz (ticks per millisecond).
+int
+sys_tscfreq(void)
+{
+  return tsckhz;
+}
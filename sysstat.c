@@ -0,0 +1,144 @@
+// Print per-system-call latency histograms.
+//   sysstat          summary over all cpus
+//   sysstat -c cpu   summary for one cpu
+//   sysstat -v       also print each histogram
+
+#include "types.h"
+#include "user.h"
+#include "syscall.h"
+#include "sysstat.h"
+
+#define NSYS 64
+
+static char *names[NSYS] = {
+[SYS_fork]    "fork",
+[SYS_exit]    "exit",
+[SYS_wait]    "wait",
+[SYS_pipe]    "pipe",
+[SYS_read]    "read",
+[SYS_kill]    "kill",
+[SYS_exec]    "exec",
+[SYS_fstat]   "fstat",
+[SYS_chdir]   "chdir",
+[SYS_dup]     "dup",
+[SYS_getpid]  "getpid",
+[SYS_sbrk]    "sbrk",
+[SYS_sleep]   "sleep",
+[SYS_uptime]  "uptime",
+[SYS_open]    "open",
+[SYS_write]   "write",
+[SYS_mknod]   "mknod",
+[SYS_unlink]  "unlink",
+[SYS_link]    "link",
+[SYS_mkdir]   "mkdir",
+[SYS_close]   "close",
+[SYS_promote] "promote",
+[SYS_demote]  "demote",
+[SYS_huge_page_count] "huge_page_count",
+[SYS_get_free_pa_space] "get_free_pa_space",
+[SYS_tscfreq] "tscfreq",
+[SYS_tracemask] "tracemask",
+[SYS_traceread] "traceread",
+[SYS_profile] "profile",
+[SYS_profread] "profread",
+[SYS_lockstat] "lockstat",
+[SYS_lockstatreset] "lockstatreset",
+[SYS_sysstat] "sysstat",
+[SYS_kbench]  "kbench",
+[SYS_yield]   "yield",
+[SYS_setpriority] "setpriority",
+[SYS_getpriority] "getpriority",
+[SYS_sched_setaffinity] "sched_setaffinity",
+[SYS_sched_getaffinity] "sched_getaffinity",
+[SYS_clone]   "clone",
+[SYS_join]    "join",
+[SYS_futex_wait] "futex_wait",
+[SYS_futex_wake] "futex_wake",
+[SYS_spawn]   "spawn",
+[SYS_diskstat] "diskstat",
+};
+
+static struct sysstat st[NSYS];
+
+// Print the upper bound of bucket b in microseconds.
+static void
+bound(int b)
+{
+  uint64 ns;
+
+  ns = cyc2ns((uint64)1 << (b + 1));
+  if(ns < 1000)
+    printf(1, "<1");
+  else
+    printf(1, "%d", (uint)udiv64(ns, 1000));
+}
+
+// Smallest bucket holding at least frac/100 of the calls.
+static int
+percentile(struct sysstat *s, uint total, uint frac)
+{
+  uint sum;
+  int b;
+
+  sum = 0;
+  for(b = 0; b < NSYSBUCKET; b++){
+    sum += s->hist[b];
+    if((uint64)sum * 100 >= (uint64)total * frac)
+      return b;
+  }
+  return NSYSBUCKET - 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int cpu, verbose, i, n, b, max;
+  uint total;
+
+  cpu = -1;
+  verbose = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-v") == 0)
+      verbose = 1;
+    else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+      cpu = atoi(argv[++i]);
+    else {
+      printf(2, "usage: sysstat [-v] [-c cpu]\n");
+      exit();
+    }
+  }
+
+  if((n = sysstat(cpu, st, NSYS)) < 0){
+    printf(2, "sysstat: bad cpu %d\n", cpu);
+    exit();
+  }
+
+  printf(1, "syscall\t\tcalls\tp50(us)\tp99(us)\tmax(us)\n");
+  for(i = 0; i < n; i++){
+    total = 0;
+    max = 0;
+    for(b = 0; b < NSYSBUCKET; b++){
+      total += st[i].hist[b];
+      if(st[i].hist[b])
+        max = b;
+    }
+    if(total == 0)
+      continue;
+    printf(1, "%s\t", names[i] ? names[i] : "?");
+    if(names[i] == 0 || strlen(names[i]) < 8)
+      printf(1, "\t");
+    printf(1, "%d\t", total);
+    bound(percentile(&st[i], total, 50));
+    printf(1, "\t");
+    bound(percentile(&st[i], total, 99));
+    printf(1, "\t");
+    bound(max);
+    printf(1, "\n");
+    if(verbose){
+      for(b = 0; b < NSYSBUCKET; b++)
+        if(st[i].hist[b])
+          printf(1, "\t< 2^%d cycles\t%d\n", b + 1, st[i].hist[b]);
+    }
+  }
+  exit();
+}
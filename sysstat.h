@@ -0,0 +1,8 @@
+// Per-system-call latency histograms, shared by the kernel and sysstat(1).
+
+#define NSYSBUCKET 32   // hist[b] counts calls taking [2^b, 2^(b+1)) cycles;
+                        // the last bucket also holds anything slower
+
+struct sysstat {
+  uint hist[NSYSBUCKET];
+};
@@ -0,0 +1,2006 @@
+
+_test_basic:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+        if(arr[i] != i%256)
+            return 1;
+    return 0;
+}
+
+int main(int argc, char **argv) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+
+    if(argc < 2)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+int main(int argc, char **argv) {
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+    if(argc < 2)
+  1a:	0f 8e cd 00 00 00    	jle    ed <main+0xed>
+        exit();
+    }
+    
+
+    // 1. Declare an array of given size 
+    int size_in_bytes = atoi(argv[1])*(1 << 20);
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 73 04             	push   0x4(%ebx)
+  26:	e8 05 04 00 00       	call   430 <atoi>
+  2b:	c1 e0 14             	shl    $0x14,%eax
+  2e:	89 c6                	mov    %eax,%esi
+    int *arr = malloc(size_in_bytes);
+  30:	89 04 24             	mov    %eax,(%esp)
+  33:	e8 78 09 00 00       	call   9b0 <malloc>
+    
+    // 2. Initialzie the array 
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  38:	89 f2                	mov    %esi,%edx
+  3a:	83 c4 10             	add    $0x10,%esp
+  3d:	c1 ea 02             	shr    $0x2,%edx
+    int *arr = malloc(size_in_bytes);
+  40:	89 c7                	mov    %eax,%edi
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  42:	74 78                	je     bc <main+0xbc>
+  44:	31 c0                	xor    %eax,%eax
+  46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4d:	8d 76 00             	lea    0x0(%esi),%esi
+        arr[i] = i%256;
+  50:	0f b6 c8             	movzbl %al,%ecx
+  53:	89 0c 87             	mov    %ecx,(%edi,%eax,4)
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  56:	83 c0 01             	add    $0x1,%eax
+  59:	39 d0                	cmp    %edx,%eax
+  5b:	75 f3                	jne    50 <main+0x50>
+  5d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    printf(1, "Array of size %s MBs initialized.\n", argv[1]);
+  60:	50                   	push   %eax
+  61:	ff 73 04             	push   0x4(%ebx)
+  64:	68 04 0e 00 00       	push   $0xe04
+  69:	6a 01                	push   $0x1
+  6b:	e8 00 07 00 00       	call   770 <printf>
+
+    // 3. invoke promote system call 
+    if(promote(arr, size_in_bytes))
+  70:	58                   	pop    %eax
+  71:	5a                   	pop    %edx
+  72:	56                   	push   %esi
+  73:	57                   	push   %edi
+  74:	e8 8f 05 00 00       	call   608 <promote>
+  79:	83 c4 10             	add    $0x10,%esp
+  7c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  7f:	85 c0                	test   %eax,%eax
+  81:	89 c3                	mov    %eax,%ebx
+  83:	75 5b                	jne    e0 <main+0xe0>
+  85:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+        error("Error: promote syscall failed.");
+    printf(1, "promote() system call success.\n");
+  88:	50                   	push   %eax
+  89:	50                   	push   %eax
+  8a:	68 48 0e 00 00       	push   $0xe48
+  8f:	6a 01                	push   $0x1
+  91:	e8 da 06 00 00       	call   770 <printf>
+  96:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  99:	83 c4 10             	add    $0x10,%esp
+  9c:	eb 09                	jmp    a7 <main+0xa7>
+  9e:	66 90                	xchg   %ax,%ax
+    for(int i=0; i<size; i++)
+  a0:	83 c3 01             	add    $0x1,%ebx
+  a3:	39 d3                	cmp    %edx,%ebx
+  a5:	74 5a                	je     101 <main+0x101>
+        if(arr[i] != i%256)
+  a7:	0f b6 c3             	movzbl %bl,%eax
+  aa:	39 04 9f             	cmp    %eax,(%edi,%ebx,4)
+  ad:	74 f1                	je     a0 <main+0xa0>
+
+    // 4. check integrity
+    if(test_integrity(arr, size_in_bytes/sizeof(int)))
+        error("Error: integrity failure.\n");
+  af:	83 ec 0c             	sub    $0xc,%esp
+  b2:	68 c2 0d 00 00       	push   $0xdc2
+  b7:	e8 44 01 00 00       	call   200 <error>
+    printf(1, "Array of size %s MBs initialized.\n", argv[1]);
+  bc:	50                   	push   %eax
+  bd:	ff 73 04             	push   0x4(%ebx)
+  c0:	68 04 0e 00 00       	push   $0xe04
+  c5:	6a 01                	push   $0x1
+  c7:	e8 a4 06 00 00       	call   770 <printf>
+    if(promote(arr, size_in_bytes))
+  cc:	58                   	pop    %eax
+  cd:	5a                   	pop    %edx
+  ce:	56                   	push   %esi
+  cf:	57                   	push   %edi
+  d0:	e8 33 05 00 00       	call   608 <promote>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	85 c0                	test   %eax,%eax
+  da:	0f 84 9a 00 00 00    	je     17a <main+0x17a>
+        error("Error: promote syscall failed.");
+  e0:	83 ec 0c             	sub    $0xc,%esp
+  e3:	68 28 0e 00 00       	push   $0xe28
+  e8:	e8 13 01 00 00       	call   200 <error>
+        printf(1, "Usage: %s <MegaBytes_to_allocate>\n", argv[0]);
+  ed:	51                   	push   %ecx
+  ee:	ff 33                	push   (%ebx)
+  f0:	68 e0 0d 00 00       	push   $0xde0
+  f5:	6a 01                	push   $0x1
+  f7:	e8 74 06 00 00       	call   770 <printf>
+        exit();
+  fc:	e8 67 04 00 00       	call   568 <exit>
+ 101:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    printf(1, "Integrity test successful after promote.\n");
+ 104:	50                   	push   %eax
+ 105:	50                   	push   %eax
+ 106:	68 d4 0e 00 00       	push   $0xed4
+ 10b:	6a 01                	push   $0x1
+ 10d:	e8 5e 06 00 00       	call   770 <printf>
+    
+    printf(1, "%d Huge pages after promote()\n", huge_page_count(arr, size_in_bytes));
+ 112:	5a                   	pop    %edx
+ 113:	59                   	pop    %ecx
+ 114:	56                   	push   %esi
+ 115:	57                   	push   %edi
+ 116:	e8 fd 04 00 00       	call   618 <huge_page_count>
+ 11b:	83 c4 0c             	add    $0xc,%esp
+ 11e:	50                   	push   %eax
+ 11f:	68 00 0f 00 00       	push   $0xf00
+ 124:	6a 01                	push   $0x1
+ 126:	e8 45 06 00 00       	call   770 <printf>
+
+    // 5. invoke demote system call 
+    if(demote(arr, size_in_bytes))
+ 12b:	5b                   	pop    %ebx
+ 12c:	58                   	pop    %eax
+ 12d:	56                   	push   %esi
+ 12e:	57                   	push   %edi
+ 12f:	e8 dc 04 00 00       	call   610 <demote>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	89 c3                	mov    %eax,%ebx
+ 13e:	75 2d                	jne    16d <main+0x16d>
+ 140:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+        error("Error: demote syscall failed.");
+    printf(1, "demote() system call success.\n");
+ 143:	51                   	push   %ecx
+ 144:	51                   	push   %ecx
+ 145:	68 68 0e 00 00       	push   $0xe68
+ 14a:	6a 01                	push   $0x1
+ 14c:	e8 1f 06 00 00       	call   770 <printf>
+ 151:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	eb 07                	jmp    160 <main+0x160>
+    for(int i=0; i<size; i++)
+ 159:	83 c3 01             	add    $0x1,%ebx
+ 15c:	39 d3                	cmp    %edx,%ebx
+ 15e:	74 70                	je     1d0 <main+0x1d0>
+        if(arr[i] != i%256)
+ 160:	0f b6 c3             	movzbl %bl,%eax
+ 163:	39 04 9f             	cmp    %eax,(%edi,%ebx,4)
+ 166:	74 f1                	je     159 <main+0x159>
+ 168:	e9 42 ff ff ff       	jmp    af <main+0xaf>
+        error("Error: demote syscall failed.");
+ 16d:	83 ec 0c             	sub    $0xc,%esp
+ 170:	68 a4 0d 00 00       	push   $0xda4
+ 175:	e8 86 00 00 00       	call   200 <error>
+    printf(1, "promote() system call success.\n");
+ 17a:	51                   	push   %ecx
+ 17b:	51                   	push   %ecx
+ 17c:	68 48 0e 00 00       	push   $0xe48
+ 181:	6a 01                	push   $0x1
+ 183:	e8 e8 05 00 00       	call   770 <printf>
+    printf(1, "Integrity test successful after promote.\n");
+ 188:	5b                   	pop    %ebx
+ 189:	58                   	pop    %eax
+ 18a:	68 d4 0e 00 00       	push   $0xed4
+ 18f:	6a 01                	push   $0x1
+ 191:	e8 da 05 00 00       	call   770 <printf>
+    printf(1, "%d Huge pages after promote()\n", huge_page_count(arr, size_in_bytes));
+ 196:	58                   	pop    %eax
+ 197:	5a                   	pop    %edx
+ 198:	56                   	push   %esi
+ 199:	57                   	push   %edi
+ 19a:	e8 79 04 00 00       	call   618 <huge_page_count>
+ 19f:	83 c4 0c             	add    $0xc,%esp
+ 1a2:	50                   	push   %eax
+ 1a3:	68 00 0f 00 00       	push   $0xf00
+ 1a8:	6a 01                	push   $0x1
+ 1aa:	e8 c1 05 00 00       	call   770 <printf>
+    if(demote(arr, size_in_bytes))
+ 1af:	59                   	pop    %ecx
+ 1b0:	5b                   	pop    %ebx
+ 1b1:	56                   	push   %esi
+ 1b2:	57                   	push   %edi
+ 1b3:	e8 58 04 00 00       	call   610 <demote>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	85 c0                	test   %eax,%eax
+ 1bd:	75 ae                	jne    16d <main+0x16d>
+    printf(1, "demote() system call success.\n");
+ 1bf:	50                   	push   %eax
+ 1c0:	50                   	push   %eax
+ 1c1:	68 68 0e 00 00       	push   $0xe68
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	e8 a3 05 00 00       	call   770 <printf>
+ 1cd:	83 c4 10             	add    $0x10,%esp
+
+    // 6. check integrity
+    if(test_integrity(arr, size_in_bytes/sizeof(int)))
+        error("Error: integrity failure.\n");
+    printf(1, "Integrity test successful after demote.\n");
+ 1d0:	50                   	push   %eax
+ 1d1:	50                   	push   %eax
+ 1d2:	68 88 0e 00 00       	push   $0xe88
+ 1d7:	6a 01                	push   $0x1
+ 1d9:	e8 92 05 00 00       	call   770 <printf>
+
+    printf(1, "%d Huge pages after demote().\n", huge_page_count(arr, size_in_bytes));
+ 1de:	58                   	pop    %eax
+ 1df:	5a                   	pop    %edx
+ 1e0:	56                   	push   %esi
+ 1e1:	57                   	push   %edi
+ 1e2:	e8 31 04 00 00       	call   618 <huge_page_count>
+ 1e7:	83 c4 0c             	add    $0xc,%esp
+ 1ea:	50                   	push   %eax
+ 1eb:	68 b4 0e 00 00       	push   $0xeb4
+ 1f0:	6a 01                	push   $0x1
+ 1f2:	e8 79 05 00 00       	call   770 <printf>
+
+    exit();
+ 1f7:	e8 6c 03 00 00       	call   568 <exit>
+ 1fc:	66 90                	xchg   %ax,%ax
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <error>:
+void error(const char *message) {
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%s\n", message);
+ 206:	ff 75 08             	push   0x8(%ebp)
+ 209:	68 a0 0d 00 00       	push   $0xda0
+ 20e:	6a 01                	push   $0x1
+ 210:	e8 5b 05 00 00       	call   770 <printf>
+    exit();
+ 215:	e8 4e 03 00 00       	call   568 <exit>
+ 21a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000220 <test_integrity>:
+int test_integrity(const int *arr, int size) {
+ 220:	55                   	push   %ebp
+    for(int i=0; i<size; i++)
+ 221:	31 c0                	xor    %eax,%eax
+int test_integrity(const int *arr, int size) {
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 229:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    for(int i=0; i<size; i++)
+ 22c:	85 c9                	test   %ecx,%ecx
+ 22e:	7f 0f                	jg     23f <test_integrity+0x1f>
+ 230:	eb 1a                	jmp    24c <test_integrity+0x2c>
+ 232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 238:	83 c0 01             	add    $0x1,%eax
+ 23b:	39 c1                	cmp    %eax,%ecx
+ 23d:	74 19                	je     258 <test_integrity+0x38>
+        if(arr[i] != i%256)
+ 23f:	0f b6 d0             	movzbl %al,%edx
+ 242:	39 14 83             	cmp    %edx,(%ebx,%eax,4)
+ 245:	74 f1                	je     238 <test_integrity+0x18>
+            return 1;
+ 247:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 24c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24f:	c9                   	leave
+ 250:	c3                   	ret
+ 251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+ 25b:	31 c0                	xor    %eax,%eax
+}
+ 25d:	c9                   	leave
+ 25e:	c3                   	ret
+ 25f:	90                   	nop
+
+00000260 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 260:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 261:	31 c0                	xor    %eax,%eax
+{
+ 263:	89 e5                	mov    %esp,%ebp
+ 265:	53                   	push   %ebx
+ 266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 270:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 274:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 277:	83 c0 01             	add    $0x1,%eax
+ 27a:	84 d2                	test   %dl,%dl
+ 27c:	75 f2                	jne    270 <strcpy+0x10>
+    ;
+  return os;
+}
+ 27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 281:	89 c8                	mov    %ecx,%eax
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+ 285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+ 297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 29a:	0f b6 02             	movzbl (%edx),%eax
+ 29d:	84 c0                	test   %al,%al
+ 29f:	75 17                	jne    2b8 <strcmp+0x28>
+ 2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2b2:	84 c0                	test   %al,%al
+ 2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+ 2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2bb:	38 c3                	cmp    %al,%bl
+ 2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2bf:	29 d8                	sub    %ebx,%eax
+}
+ 2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2d4:	31 c0                	xor    %eax,%eax
+ 2d6:	29 d8                	sub    %ebx,%eax
+}
+ 2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2e0:	31 c0                	xor    %eax,%eax
+ 2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2f9:	74 15                	je     310 <strlen+0x20>
+ 2fb:	31 c0                	xor    %eax,%eax
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	83 c0 01             	add    $0x1,%eax
+ 303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 307:	89 c1                	mov    %eax,%ecx
+ 309:	75 f5                	jne    300 <strlen+0x10>
+    ;
+  return n;
+}
+ 30b:	89 c8                	mov    %ecx,%eax
+ 30d:	5d                   	pop    %ebp
+ 30e:	c3                   	ret
+ 30f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 310:	31 c9                	xor    %ecx,%ecx
+}
+ 312:	5d                   	pop    %ebp
+ 313:	89 c8                	mov    %ecx,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	89 d7                	mov    %edx,%edi
+ 32f:	fc                   	cld
+ 330:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 332:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 335:	89 d0                	mov    %edx,%eax
+ 337:	c9                   	leave
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 34a:	0f b6 10             	movzbl (%eax),%edx
+ 34d:	84 d2                	test   %dl,%dl
+ 34f:	75 12                	jne    363 <strchr+0x23>
+ 351:	eb 1d                	jmp    370 <strchr+0x30>
+ 353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 357:	90                   	nop
+ 358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 35c:	83 c0 01             	add    $0x1,%eax
+ 35f:	84 d2                	test   %dl,%dl
+ 361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+ 363:	38 d1                	cmp    %dl,%cl
+ 365:	75 f1                	jne    358 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 367:	5d                   	pop    %ebp
+ 368:	c3                   	ret
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 370:	31 c0                	xor    %eax,%eax
+}
+ 372:	5d                   	pop    %ebp
+ 373:	c3                   	ret
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 385:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 388:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 389:	31 db                	xor    %ebx,%ebx
+{
+ 38b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 38e:	eb 27                	jmp    3b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 01                	push   $0x1
+ 395:	56                   	push   %esi
+ 396:	6a 00                	push   $0x0
+ 398:	e8 e3 01 00 00       	call   580 <read>
+    if(cc < 1)
+ 39d:	83 c4 10             	add    $0x10,%esp
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	7e 1d                	jle    3c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3af:	3c 0a                	cmp    $0xa,%al
+ 3b1:	74 10                	je     3c3 <gets+0x43>
+ 3b3:	3c 0d                	cmp    $0xd,%al
+ 3b5:	74 0c                	je     3c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3b7:	89 df                	mov    %ebx,%edi
+ 3b9:	83 c3 01             	add    $0x1,%ebx
+ 3bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3bf:	7c cf                	jl     390 <gets+0x10>
+ 3c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3cd:	5b                   	pop    %ebx
+ 3ce:	5e                   	pop    %esi
+ 3cf:	5f                   	pop    %edi
+ 3d0:	5d                   	pop    %ebp
+ 3d1:	c3                   	ret
+ 3d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	6a 00                	push   $0x0
+ 3ea:	ff 75 08             	push   0x8(%ebp)
+ 3ed:	e8 b6 01 00 00       	call   5a8 <open>
+  if(fd < 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	78 27                	js     420 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	ff 75 0c             	push   0xc(%ebp)
+ 3ff:	89 c3                	mov    %eax,%ebx
+ 401:	50                   	push   %eax
+ 402:	e8 b9 01 00 00       	call   5c0 <fstat>
+  close(fd);
+ 407:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	e8 7f 01 00 00       	call   590 <close>
+  return r;
+ 411:	83 c4 10             	add    $0x10,%esp
+}
+ 414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb ed                	jmp    414 <stat+0x34>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 437:	0f be 02             	movsbl (%edx),%eax
+ 43a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 43d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 445:	77 1e                	ja     465 <atoi+0x35>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 450:	83 c2 01             	add    $0x1,%edx
+ 453:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 456:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 45a:	0f be 02             	movsbl (%edx),%eax
+ 45d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 460:	80 fb 09             	cmp    $0x9,%bl
+ 463:	76 eb                	jbe    450 <atoi+0x20>
+  return n;
+}
+ 465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 468:	89 c8                	mov    %ecx,%eax
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	8b 45 10             	mov    0x10(%ebp),%eax
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 47e:	85 c0                	test   %eax,%eax
+ 480:	7e 13                	jle    495 <memmove+0x25>
+ 482:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 484:	89 d7                	mov    %edx,%edi
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 490:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 491:	39 f8                	cmp    %edi,%eax
+ 493:	75 fb                	jne    490 <memmove+0x20>
+  return vdst;
+}
+ 495:	5e                   	pop    %esi
+ 496:	89 d0                	mov    %edx,%eax
+ 498:	5f                   	pop    %edi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+ 49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 49f:	90                   	nop
+
+000004a0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	31 d2                	xor    %edx,%edx
+ 4a3:	89 e5                	mov    %esp,%ebp
+ 4a5:	53                   	push   %ebx
+ 4a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 4a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 4ac:	f7 f3                	div    %ebx
+ 4ae:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 4b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 4b8:	89 ca                	mov    %ecx,%edx
+}
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 4c0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 4c2:	c3                   	ret
+ 4c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 4d9:	8b 35 8c 13 00 00    	mov    0x138c,%esi
+{
+ 4df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 4e5:	85 f6                	test   %esi,%esi
+ 4e7:	74 2f                	je     518 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 4e9:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 4ee:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 4f4:	f7 e3                	mul    %ebx
+ 4f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4f9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 4fc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 4ff:	31 d2                	xor    %edx,%edx
+ 501:	f7 f6                	div    %esi
+ 503:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 505:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 508:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 50b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 50d:	89 da                	mov    %ebx,%edx
+}
+ 50f:	5b                   	pop    %ebx
+ 510:	5e                   	pop    %esi
+ 511:	5f                   	pop    %edi
+ 512:	5d                   	pop    %ebp
+ 513:	c3                   	ret
+ 514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 518:	e8 0b 01 00 00       	call   628 <tscfreq>
+ 51d:	a3 8c 13 00 00       	mov    %eax,0x138c
+ 522:	89 c6                	mov    %eax,%esi
+ 524:	eb c3                	jmp    4e9 <cyc2ns+0x19>
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	83 ec 10             	sub    $0x10,%esp
+ 537:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 53a:	6a 00                	push   $0x0
+ 53c:	e8 3f 01 00 00       	call   680 <getpriority>
+ 541:	5a                   	pop    %edx
+ 542:	59                   	pop    %ecx
+ 543:	01 d8                	add    %ebx,%eax
+ 545:	50                   	push   %eax
+ 546:	6a 00                	push   $0x0
+ 548:	e8 2b 01 00 00       	call   678 <setpriority>
+  return getpriority(0);
+ 54d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 554:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 557:	83 c4 10             	add    $0x10,%esp
+}
+ 55a:	c9                   	leave
+  return getpriority(0);
+ 55b:	e9 20 01 00 00       	jmp    680 <getpriority>
+
+00000560 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 560:	b8 01 00 00 00       	mov    $0x1,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <exit>:
+SYSCALL(exit)
+ 568:	b8 02 00 00 00       	mov    $0x2,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <wait>:
+SYSCALL(wait)
+ 570:	b8 03 00 00 00       	mov    $0x3,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <pipe>:
+SYSCALL(pipe)
+ 578:	b8 04 00 00 00       	mov    $0x4,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <read>:
+SYSCALL(read)
+ 580:	b8 05 00 00 00       	mov    $0x5,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <write>:
+SYSCALL(write)
+ 588:	b8 10 00 00 00       	mov    $0x10,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <close>:
+SYSCALL(close)
+ 590:	b8 15 00 00 00       	mov    $0x15,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <kill>:
+SYSCALL(kill)
+ 598:	b8 06 00 00 00       	mov    $0x6,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <exec>:
+SYSCALL(exec)
+ 5a0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <open>:
+SYSCALL(open)
+ 5a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <mknod>:
+SYSCALL(mknod)
+ 5b0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <unlink>:
+SYSCALL(unlink)
+ 5b8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <fstat>:
+SYSCALL(fstat)
+ 5c0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <link>:
+SYSCALL(link)
+ 5c8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <mkdir>:
+SYSCALL(mkdir)
+ 5d0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <chdir>:
+SYSCALL(chdir)
+ 5d8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <dup>:
+SYSCALL(dup)
+ 5e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <getpid>:
+SYSCALL(getpid)
+ 5e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <sbrk>:
+SYSCALL(sbrk)
+ 5f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <sleep>:
+SYSCALL(sleep)
+ 5f8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <uptime>:
+SYSCALL(uptime)
+ 600:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <promote>:
+
+SYSCALL(promote)
+ 608:	b8 18 00 00 00       	mov    $0x18,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <demote>:
+SYSCALL(demote)
+ 610:	b8 19 00 00 00       	mov    $0x19,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 618:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 620:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <tscfreq>:
+SYSCALL(tscfreq)
+ 628:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <tracemask>:
+SYSCALL(tracemask)
+ 630:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <traceread>:
+SYSCALL(traceread)
+ 638:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <profile>:
+SYSCALL(profile)
+ 640:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <profread>:
+SYSCALL(profread)
+ 648:	b8 20 00 00 00       	mov    $0x20,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <lockstat>:
+SYSCALL(lockstat)
+ 650:	b8 21 00 00 00       	mov    $0x21,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 658:	b8 22 00 00 00       	mov    $0x22,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <sysstat>:
+SYSCALL(sysstat)
+ 660:	b8 23 00 00 00       	mov    $0x23,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <kbench>:
+SYSCALL(kbench)
+ 668:	b8 24 00 00 00       	mov    $0x24,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <yield>:
+SYSCALL(yield)
+ 670:	b8 25 00 00 00       	mov    $0x25,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <setpriority>:
+SYSCALL(setpriority)
+ 678:	b8 26 00 00 00       	mov    $0x26,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <getpriority>:
+SYSCALL(getpriority)
+ 680:	b8 27 00 00 00       	mov    $0x27,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 688:	b8 28 00 00 00       	mov    $0x28,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 690:	b8 29 00 00 00       	mov    $0x29,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <clone>:
+SYSCALL(clone)
+ 698:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <join>:
+SYSCALL(join)
+ 6a0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <futex_wait>:
+SYSCALL(futex_wait)
+ 6a8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <futex_wake>:
+SYSCALL(futex_wake)
+ 6b0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <spawn>:
+SYSCALL(spawn)
+ 6b8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <diskstat>:
+SYSCALL(diskstat)
+ 6c0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+ 6c8:	66 90                	xchg   %ax,%ax
+ 6ca:	66 90                	xchg   %ax,%ax
+ 6cc:	66 90                	xchg   %ax,%ax
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 80 0f 00 00 	movzbl 0xf80(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 3b fe ff ff       	call   588 <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 d1 fd ff ff       	call   588 <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 28 0f 00 00 	jmp    *0xf28(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 72 fd ff ff       	call   588 <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 60 fd ff ff       	call   588 <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 e6 fc ff ff       	call   588 <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 96 fc ff ff       	call   588 <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb 1f 0f 00 00       	mov    $0xf1f,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 920:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	a1 90 13 00 00       	mov    0x1390,%eax
+{
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	57                   	push   %edi
+ 929:	56                   	push   %esi
+ 92a:	53                   	push   %ebx
+ 92b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 92e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 938:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 93c:	39 ca                	cmp    %ecx,%edx
+ 93e:	73 30                	jae    970 <free+0x50>
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 04                	jb     948 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 944:	39 c2                	cmp    %eax,%edx
+ 946:	72 f0                	jb     938 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 948:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 94b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 94e:	39 f8                	cmp    %edi,%eax
+ 950:	74 2e                	je     980 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 952:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 955:	8b 42 04             	mov    0x4(%edx),%eax
+ 958:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 95b:	39 f1                	cmp    %esi,%ecx
+ 95d:	74 38                	je     997 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 95f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 961:	5b                   	pop    %ebx
+  freep = p;
+ 962:	89 15 90 13 00 00    	mov    %edx,0x1390
+}
+ 968:	5e                   	pop    %esi
+ 969:	5f                   	pop    %edi
+ 96a:	5d                   	pop    %ebp
+ 96b:	c3                   	ret
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 d0                	jb     944 <free+0x24>
+ 974:	eb c2                	jmp    938 <free+0x18>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 980:	03 70 04             	add    0x4(%eax),%esi
+ 983:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 986:	8b 02                	mov    (%edx),%eax
+ 988:	8b 00                	mov    (%eax),%eax
+ 98a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 98d:	8b 42 04             	mov    0x4(%edx),%eax
+ 990:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 993:	39 f1                	cmp    %esi,%ecx
+ 995:	75 c8                	jne    95f <free+0x3f>
+    p->s.size += bp->s.size;
+ 997:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 99a:	89 15 90 13 00 00    	mov    %edx,0x1390
+    p->s.size += bp->s.size;
+ 9a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9a8:	5b                   	pop    %ebx
+ 9a9:	5e                   	pop    %esi
+ 9aa:	5f                   	pop    %edi
+ 9ab:	5d                   	pop    %ebp
+ 9ac:	c3                   	ret
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9bc:	8b 15 90 13 00 00    	mov    0x1390,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9c5:	c1 ef 03             	shr    $0x3,%edi
+ 9c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9cb:	85 d2                	test   %edx,%edx
+ 9cd:	0f 84 8d 00 00 00    	je     a60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d8:	39 f9                	cmp    %edi,%ecx
+ 9da:	73 64                	jae    a40 <malloc+0x90>
+  if(nu < 4096)
+ 9dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9e1:	39 df                	cmp    %ebx,%edi
+ 9e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ed:	eb 0a                	jmp    9f9 <malloc+0x49>
+ 9ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f5:	39 f9                	cmp    %edi,%ecx
+ 9f7:	73 47                	jae    a40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9f9:	89 c2                	mov    %eax,%edx
+ 9fb:	39 05 90 13 00 00    	cmp    %eax,0x1390
+ a01:	75 ed                	jne    9f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	56                   	push   %esi
+ a07:	e8 e4 fb ff ff       	call   5f0 <sbrk>
+  if(p == (char*)-1)
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a12:	74 1c                	je     a30 <malloc+0x80>
+  hp->s.size = nu;
+ a14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a17:	83 ec 0c             	sub    $0xc,%esp
+ a1a:	83 c0 08             	add    $0x8,%eax
+ a1d:	50                   	push   %eax
+ a1e:	e8 fd fe ff ff       	call   920 <free>
+  return freep;
+ a23:	8b 15 90 13 00 00    	mov    0x1390,%edx
+      if((p = morecore(nunits)) == 0)
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	85 d2                	test   %edx,%edx
+ a2e:	75 c0                	jne    9f0 <malloc+0x40>
+        return 0;
+  }
+}
+ a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a33:	31 c0                	xor    %eax,%eax
+}
+ a35:	5b                   	pop    %ebx
+ a36:	5e                   	pop    %esi
+ a37:	5f                   	pop    %edi
+ a38:	5d                   	pop    %ebp
+ a39:	c3                   	ret
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a40:	39 cf                	cmp    %ecx,%edi
+ a42:	74 4c                	je     a90 <malloc+0xe0>
+        p->s.size -= nunits;
+ a44:	29 f9                	sub    %edi,%ecx
+ a46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a4f:	89 15 90 13 00 00    	mov    %edx,0x1390
+}
+ a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a58:	83 c0 08             	add    $0x8,%eax
+}
+ a5b:	5b                   	pop    %ebx
+ a5c:	5e                   	pop    %esi
+ a5d:	5f                   	pop    %edi
+ a5e:	5d                   	pop    %ebp
+ a5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a60:	c7 05 90 13 00 00 94 	movl   $0x1394,0x1390
+ a67:	13 00 00 
+    base.s.size = 0;
+ a6a:	b8 94 13 00 00       	mov    $0x1394,%eax
+    base.s.ptr = freep = prevp = &base;
+ a6f:	c7 05 94 13 00 00 94 	movl   $0x1394,0x1394
+ a76:	13 00 00 
+    base.s.size = 0;
+ a79:	c7 05 98 13 00 00 00 	movl   $0x0,0x1398
+ a80:	00 00 00 
+    if(p->s.size >= nunits){
+ a83:	e9 54 ff ff ff       	jmp    9dc <malloc+0x2c>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a90:	8b 08                	mov    (%eax),%ecx
+ a92:	89 0a                	mov    %ecx,(%edx)
+ a94:	eb b9                	jmp    a4f <malloc+0x9f>
+ a96:	66 90                	xchg   %ax,%ax
+ a98:	66 90                	xchg   %ax,%ax
+ a9a:	66 90                	xchg   %ax,%ax
+ a9c:	66 90                	xchg   %ax,%ax
+ a9e:	66 90                	xchg   %ax,%ax
+
+00000aa0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 20             	sub    $0x20,%esp
+ aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ aac:	8b 7d 10             	mov    0x10(%ebp),%edi
+ aaf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ ab2:	68 e8 03 00 00       	push   $0x3e8
+ ab7:	57                   	push   %edi
+ ab8:	56                   	push   %esi
+ ab9:	e8 e2 f9 ff ff       	call   4a0 <udiv64>
+ abe:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ ac0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ ac3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ ac9:	29 c1                	sub    %eax,%ecx
+ acb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ ace:	68 e8 03 00 00       	push   $0x3e8
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	e8 c6 f9 ff ff       	call   4a0 <udiv64>
+ ada:	83 c4 0c             	add    $0xc,%esp
+ add:	50                   	push   %eax
+ ade:	68 91 0f 00 00       	push   $0xf91
+ ae3:	53                   	push   %ebx
+ ae4:	e8 87 fc ff ff       	call   770 <printf>
+  if(frac < 100)
+ ae9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ aec:	83 c4 10             	add    $0x10,%esp
+ aef:	83 f9 63             	cmp    $0x63,%ecx
+ af2:	76 1c                	jbe    b10 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ af4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ af7:	c7 45 0c 97 0f 00 00 	movl   $0xf97,0xc(%ebp)
+ afe:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ b01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b04:	5b                   	pop    %ebx
+ b05:	5e                   	pop    %esi
+ b06:	5f                   	pop    %edi
+ b07:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ b08:	e9 63 fc ff ff       	jmp    770 <printf>
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ b10:	83 ec 08             	sub    $0x8,%esp
+ b13:	68 95 0f 00 00       	push   $0xf95
+ b18:	53                   	push   %ebx
+ b19:	e8 52 fc ff ff       	call   770 <printf>
+  if(frac < 10)
+ b1e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b21:	83 c4 10             	add    $0x10,%esp
+ b24:	83 f9 09             	cmp    $0x9,%ecx
+ b27:	77 cb                	ja     af4 <printps+0x54>
+    printf(fd, "0");
+ b29:	83 ec 08             	sub    $0x8,%esp
+ b2c:	68 95 0f 00 00       	push   $0xf95
+ b31:	53                   	push   %ebx
+ b32:	e8 39 fc ff ff       	call   770 <printf>
+ b37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b3a:	83 c4 10             	add    $0x10,%esp
+ b3d:	eb b5                	jmp    af4 <printps+0x54>
+ b3f:	90                   	nop
+
+00000b40 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ b4c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ b4f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ b52:	83 e8 01             	sub    $0x1,%eax
+ b55:	3d ff 00 00 00       	cmp    $0xff,%eax
+ b5a:	0f 87 37 02 00 00    	ja     d97 <bench+0x257>
+ b60:	8b 7d 14             	mov    0x14(%ebp),%edi
+ b63:	85 ff                	test   %edi,%edi
+ b65:	0f 84 2c 02 00 00    	je     d97 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ b6b:	83 ec 0c             	sub    $0xc,%esp
+ b6e:	ff 75 10             	push   0x10(%ebp)
+ b71:	ff 55 0c             	call   *0xc(%ebp)
+ b74:	5b                   	pop    %ebx
+ b75:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ b78:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ b7a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ b7d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ b80:	83 c4 10             	add    $0x10,%esp
+ b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b87:	90                   	nop
+    t0 = cycles();
+ b88:	e8 33 f9 ff ff       	call   4c0 <cycles>
+    fn(arg);
+ b8d:	83 ec 0c             	sub    $0xc,%esp
+ b90:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ b93:	89 c6                	mov    %eax,%esi
+ b95:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ b97:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ b9a:	e8 21 f9 ff ff       	call   4c0 <cycles>
+ b9f:	29 f0                	sub    %esi,%eax
+ ba1:	19 fa                	sbb    %edi,%edx
+ ba3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ baa:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ bad:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ bb4:	83 c3 01             	add    $0x1,%ebx
+ bb7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ bba:	7f cc                	jg     b88 <bench+0x48>
+  for(i = 1; i < n; i++){
+ bbc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ bc0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ bc3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ bc9:	bf 01 00 00 00       	mov    $0x1,%edi
+ bce:	74 77                	je     c47 <bench+0x107>
+ bd0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bd7:	90                   	nop
+    v = a[i];
+ bd8:	8b 01                	mov    (%ecx),%eax
+ bda:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ bdd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ be3:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ be9:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ bef:	89 c8                	mov    %ecx,%eax
+ bf1:	eb 1b                	jmp    c0e <bench+0xce>
+ bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bf7:	90                   	nop
+      a[j] = a[j-1];
+ bf8:	89 08                	mov    %ecx,(%eax)
+ bfa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ bfd:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ c00:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c06:	39 c3                	cmp    %eax,%ebx
+ c08:	0f 84 72 01 00 00    	je     d80 <bench+0x240>
+ c0e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ c11:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ c14:	89 f7                	mov    %esi,%edi
+ c16:	89 c3                	mov    %eax,%ebx
+ c18:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ c1e:	19 d7                	sbb    %edx,%edi
+ c20:	72 d6                	jb     bf8 <bench+0xb8>
+ c22:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c28:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ c2e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ c34:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ c37:	83 c7 01             	add    $0x1,%edi
+ c3a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ c3d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ c3f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ c42:	75 94                	jne    bd8 <bench+0x98>
+ c44:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c47:	83 ec 08             	sub    $0x8,%esp
+ c4a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ c50:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ c55:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ c5b:	e8 70 f8 ff ff       	call   4d0 <cyc2ns>
+ c60:	83 c4 0c             	add    $0xc,%esp
+ c63:	ff 75 14             	push   0x14(%ebp)
+ c66:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c6c:	f7 e3                	mul    %ebx
+ c6e:	01 ca                	add    %ecx,%edx
+ c70:	52                   	push   %edx
+ c71:	50                   	push   %eax
+ c72:	e8 29 f8 ff ff       	call   4a0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ c77:	89 06                	mov    %eax,(%esi)
+ c79:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c7c:	5f                   	pop    %edi
+ c7d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ c7e:	8b 45 18             	mov    0x18(%ebp),%eax
+ c81:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c83:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ c8a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ c91:	e8 3a f8 ff ff       	call   4d0 <cyc2ns>
+ c96:	83 c4 0c             	add    $0xc,%esp
+ c99:	ff 75 14             	push   0x14(%ebp)
+ c9c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ca2:	f7 e3                	mul    %ebx
+ ca4:	01 ca                	add    %ecx,%edx
+ ca6:	52                   	push   %edx
+ ca7:	50                   	push   %eax
+ ca8:	e8 f3 f7 ff ff       	call   4a0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ cad:	89 46 08             	mov    %eax,0x8(%esi)
+ cb0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cb3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ cb4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cb7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ cb8:	8d 50 01             	lea    0x1(%eax),%edx
+ cbb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ cc0:	6b d2 63             	imul   $0x63,%edx,%edx
+ cc3:	f7 e2                	mul    %edx
+ cc5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cc8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ ccf:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ cd6:	e8 f5 f7 ff ff       	call   4d0 <cyc2ns>
+ cdb:	83 c4 0c             	add    $0xc,%esp
+ cde:	ff 75 14             	push   0x14(%ebp)
+ ce1:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ce7:	f7 e3                	mul    %ebx
+ ce9:	01 ca                	add    %ecx,%edx
+ ceb:	52                   	push   %edx
+ cec:	50                   	push   %eax
+ ced:	e8 ae f7 ff ff       	call   4a0 <udiv64>
+
+  if(name){
+ cf2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ cf5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ cf8:	89 46 10             	mov    %eax,0x10(%esi)
+ cfb:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ cfe:	85 c9                	test   %ecx,%ecx
+ d00:	74 72                	je     d74 <bench+0x234>
+    printf(1, "%s: min ", name);
+ d02:	83 ec 04             	sub    $0x4,%esp
+ d05:	ff 75 08             	push   0x8(%ebp)
+ d08:	68 9a 0f 00 00       	push   $0xf9a
+ d0d:	6a 01                	push   $0x1
+ d0f:	e8 5c fa ff ff       	call   770 <printf>
+    printps(1, st->min);
+ d14:	83 c4 0c             	add    $0xc,%esp
+ d17:	ff 76 04             	push   0x4(%esi)
+ d1a:	ff 36                	push   (%esi)
+ d1c:	6a 01                	push   $0x1
+ d1e:	e8 7d fd ff ff       	call   aa0 <printps>
+    printf(1, " median ");
+ d23:	58                   	pop    %eax
+ d24:	5a                   	pop    %edx
+ d25:	68 a3 0f 00 00       	push   $0xfa3
+ d2a:	6a 01                	push   $0x1
+ d2c:	e8 3f fa ff ff       	call   770 <printf>
+    printps(1, st->median);
+ d31:	83 c4 0c             	add    $0xc,%esp
+ d34:	ff 76 0c             	push   0xc(%esi)
+ d37:	ff 76 08             	push   0x8(%esi)
+ d3a:	6a 01                	push   $0x1
+ d3c:	e8 5f fd ff ff       	call   aa0 <printps>
+    printf(1, " p99 ");
+ d41:	59                   	pop    %ecx
+ d42:	5b                   	pop    %ebx
+ d43:	68 ac 0f 00 00       	push   $0xfac
+ d48:	6a 01                	push   $0x1
+ d4a:	e8 21 fa ff ff       	call   770 <printf>
+    printps(1, st->p99);
+ d4f:	83 c4 0c             	add    $0xc,%esp
+ d52:	ff 76 14             	push   0x14(%esi)
+ d55:	ff 76 10             	push   0x10(%esi)
+ d58:	6a 01                	push   $0x1
+ d5a:	e8 41 fd ff ff       	call   aa0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ d5f:	83 c4 0c             	add    $0xc,%esp
+ d62:	ff 75 18             	push   0x18(%ebp)
+ d65:	68 b2 0f 00 00       	push   $0xfb2
+ d6a:	6a 01                	push   $0x1
+ d6c:	e8 ff f9 ff ff       	call   770 <printf>
+ d71:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ d74:	31 c0                	xor    %eax,%eax
+}
+ d76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d79:	5b                   	pop    %ebx
+ d7a:	5e                   	pop    %esi
+ d7b:	5f                   	pop    %edi
+ d7c:	5d                   	pop    %ebp
+ d7d:	c3                   	ret
+ d7e:	66 90                	xchg   %ax,%ax
+ d80:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d86:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ d8c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d92:	e9 97 fe ff ff       	jmp    c2e <bench+0xee>
+    return -1;
+ d97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d9c:	eb d8                	jmp    d76 <bench+0x236>
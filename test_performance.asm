@@ -0,0 +1,1958 @@
+
+_test_performance:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    for(int i=0; i<s->size; i++)
+        if(s->arr[i] != i%256)
+            s->bad = 1;
+}
+
+int main(int argc, char **argv) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 58             	sub    $0x58,%esp
+
+    if(argc < 2)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+int main(int argc, char **argv) {
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+    if(argc < 2)
+  1a:	0f 8e 10 01 00 00    	jle    130 <main+0x130>
+        printf(1, "Usage: %s <MegaBytes_to_allocate>\n", argv[0]);
+        exit();
+    }
+
+    // pin to one cpu so both scans see the same caches and TLB
+    sched_setaffinity(0, 1);
+  20:	57                   	push   %edi
+  21:	57                   	push   %edi
+  22:	6a 01                	push   $0x1
+  24:	6a 00                	push   $0x0
+  26:	e8 ed 05 00 00       	call   618 <sched_setaffinity>
+
+    // 1. Declare an array of given size 
+    int size_in_bytes = atoi(argv[1])*(1 << 20);
+  2b:	58                   	pop    %eax
+  2c:	ff 73 04             	push   0x4(%ebx)
+  2f:	e8 8c 03 00 00       	call   3c0 <atoi>
+  34:	c1 e0 14             	shl    $0x14,%eax
+  37:	89 c7                	mov    %eax,%edi
+    int *arr = malloc(size_in_bytes);
+  39:	89 04 24             	mov    %eax,(%esp)
+  3c:	e8 ff 08 00 00       	call   940 <malloc>
+    struct scan s = { arr, size_in_bytes/sizeof(int), 0 };
+  41:	89 f9                	mov    %edi,%ecx
+    struct benchstat before, after;
+    
+    // 2. Initialzie the array 
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  43:	83 c4 10             	add    $0x10,%esp
+    int *arr = malloc(size_in_bytes);
+  46:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  49:	89 c6                	mov    %eax,%esi
+    struct scan s = { arr, size_in_bytes/sizeof(int), 0 };
+  4b:	c1 e9 02             	shr    $0x2,%ecx
+  4e:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  51:	31 c0                	xor    %eax,%eax
+  53:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  56:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  59:	85 c9                	test   %ecx,%ecx
+  5b:	74 13                	je     70 <main+0x70>
+  5d:	31 c0                	xor    %eax,%eax
+  5f:	90                   	nop
+        arr[i] = i%256;
+  60:	0f b6 d0             	movzbl %al,%edx
+  63:	89 14 86             	mov    %edx,(%esi,%eax,4)
+    for(int i=0; i < size_in_bytes/sizeof(int); i++)
+  66:	83 c0 01             	add    $0x1,%eax
+  69:	39 c1                	cmp    %eax,%ecx
+  6b:	75 f3                	jne    60 <main+0x60>
+  6d:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+    printf(1, "Array of size %s MBs initialized.\n", argv[1]);
+  70:	51                   	push   %ecx
+  71:	ff 73 04             	push   0x4(%ebx)
+  74:	68 a4 0d 00 00       	push   $0xda4
+  79:	6a 01                	push   $0x1
+  7b:	e8 80 06 00 00       	call   700 <printf>
+
+    bench("4KB pages", access_array, &s, s.size, RUNS, &before);
+  80:	5b                   	pop    %ebx
+  81:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  84:	8d 5d ac             	lea    -0x54(%ebp),%ebx
+  87:	5e                   	pop    %esi
+  88:	50                   	push   %eax
+  89:	6a 15                	push   $0x15
+  8b:	ff 75 b0             	push   -0x50(%ebp)
+  8e:	53                   	push   %ebx
+  8f:	68 90 01 00 00       	push   $0x190
+  94:	68 34 0d 00 00       	push   $0xd34
+  99:	e8 32 0a 00 00       	call   ad0 <bench>
+
+    // 3. invoke promote system call 
+    if(promote(arr, size_in_bytes))
+  9e:	83 c4 18             	add    $0x18,%esp
+  a1:	57                   	push   %edi
+  a2:	ff 75 a4             	push   -0x5c(%ebp)
+  a5:	e8 ee 04 00 00       	call   598 <promote>
+  aa:	83 c4 10             	add    $0x10,%esp
+  ad:	85 c0                	test   %eax,%eax
+  af:	74 0d                	je     be <main+0xbe>
+        error("Error: promote syscall failed.");
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	68 c8 0d 00 00       	push   $0xdc8
+  b9:	e8 12 01 00 00       	call   1d0 <error>
+    printf(1, "promote() system call success, %d huge pages.\n",
+  be:	50                   	push   %eax
+  bf:	50                   	push   %eax
+  c0:	57                   	push   %edi
+  c1:	ff 75 a4             	push   -0x5c(%ebp)
+  c4:	e8 df 04 00 00       	call   5a8 <huge_page_count>
+  c9:	83 c4 0c             	add    $0xc,%esp
+  cc:	50                   	push   %eax
+  cd:	68 e8 0d 00 00       	push   $0xde8
+  d2:	6a 01                	push   $0x1
+  d4:	e8 27 06 00 00       	call   700 <printf>
+           huge_page_count(arr, size_in_bytes));
+
+    bench("4MB pages", access_array, &s, s.size, RUNS, &after);
+  d9:	58                   	pop    %eax
+  da:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  dd:	5a                   	pop    %edx
+  de:	50                   	push   %eax
+  df:	6a 15                	push   $0x15
+  e1:	ff 75 b0             	push   -0x50(%ebp)
+  e4:	53                   	push   %ebx
+  e5:	68 90 01 00 00       	push   $0x190
+  ea:	68 3e 0d 00 00       	push   $0xd3e
+  ef:	e8 dc 09 00 00       	call   ad0 <bench>
+    if(s.bad)
+  f4:	83 c4 20             	add    $0x20,%esp
+  f7:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+  fb:	75 47                	jne    144 <main+0x144>
+        error("Error: integrity failure.");
+
+    // 4. Difference in median access time
+    if(after.median < before.median)
+  fd:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+ 100:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 103:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 106:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 109:	89 de                	mov    %ebx,%esi
+ 10b:	39 c1                	cmp    %eax,%ecx
+ 10d:	19 d6                	sbb    %edx,%esi
+ 10f:	72 45                	jb     156 <main+0x156>
+        int performance = udiv64((before.median-after.median)*100, (uint)before.median);
+        printf(1, "Performance improvement by %d percent.\n", performance);
+    }
+
+    // 5. invoke demote system call 
+    if(demote(arr, size_in_bytes))
+ 111:	50                   	push   %eax
+ 112:	50                   	push   %eax
+ 113:	57                   	push   %edi
+ 114:	ff 75 a4             	push   -0x5c(%ebp)
+ 117:	e8 84 04 00 00       	call   5a0 <demote>
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	85 c0                	test   %eax,%eax
+ 121:	74 2e                	je     151 <main+0x151>
+        error("Error: demote syscall failed.");
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	68 62 0d 00 00       	push   $0xd62
+ 12b:	e8 a0 00 00 00       	call   1d0 <error>
+        printf(1, "Usage: %s <MegaBytes_to_allocate>\n", argv[0]);
+ 130:	50                   	push   %eax
+ 131:	ff 33                	push   (%ebx)
+ 133:	68 80 0d 00 00       	push   $0xd80
+ 138:	6a 01                	push   $0x1
+ 13a:	e8 c1 05 00 00       	call   700 <printf>
+        exit();
+ 13f:	e8 b4 03 00 00       	call   4f8 <exit>
+        error("Error: integrity failure.");
+ 144:	83 ec 0c             	sub    $0xc,%esp
+ 147:	68 48 0d 00 00       	push   $0xd48
+ 14c:	e8 7f 00 00 00       	call   1d0 <error>
+    exit();
+ 151:	e8 a2 03 00 00       	call   4f8 <exit>
+        int performance = udiv64((before.median-after.median)*100, (uint)before.median);
+ 156:	56                   	push   %esi
+ 157:	50                   	push   %eax
+ 158:	29 c8                	sub    %ecx,%eax
+ 15a:	19 da                	sbb    %ebx,%edx
+ 15c:	bb 64 00 00 00       	mov    $0x64,%ebx
+ 161:	6b ca 64             	imul   $0x64,%edx,%ecx
+ 164:	f7 e3                	mul    %ebx
+ 166:	01 ca                	add    %ecx,%edx
+ 168:	52                   	push   %edx
+ 169:	50                   	push   %eax
+ 16a:	e8 c1 02 00 00       	call   430 <udiv64>
+        printf(1, "Performance improvement by %d percent.\n", performance);
+ 16f:	83 c4 0c             	add    $0xc,%esp
+ 172:	50                   	push   %eax
+ 173:	68 18 0e 00 00       	push   $0xe18
+ 178:	6a 01                	push   $0x1
+ 17a:	e8 81 05 00 00       	call   700 <printf>
+ 17f:	83 c4 10             	add    $0x10,%esp
+ 182:	eb 8d                	jmp    111 <main+0x111>
+ 184:	66 90                	xchg   %ax,%ax
+ 186:	66 90                	xchg   %ax,%ax
+ 188:	66 90                	xchg   %ax,%ax
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <access_array>:
+void access_array(void *arg) {
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 75 08             	mov    0x8(%ebp),%esi
+    for(int i=0; i<s->size; i++)
+ 198:	8b 4e 04             	mov    0x4(%esi),%ecx
+ 19b:	85 c9                	test   %ecx,%ecx
+ 19d:	7e 1f                	jle    1be <access_array+0x2e>
+        if(s->arr[i] != i%256)
+ 19f:	8b 1e                	mov    (%esi),%ebx
+    for(int i=0; i<s->size; i++)
+ 1a1:	31 c0                	xor    %eax,%eax
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+        if(s->arr[i] != i%256)
+ 1a8:	0f b6 d0             	movzbl %al,%edx
+ 1ab:	39 14 83             	cmp    %edx,(%ebx,%eax,4)
+ 1ae:	74 07                	je     1b7 <access_array+0x27>
+            s->bad = 1;
+ 1b0:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+    for(int i=0; i<s->size; i++)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	39 c8                	cmp    %ecx,%eax
+ 1bc:	75 ea                	jne    1a8 <access_array+0x18>
+}
+ 1be:	5b                   	pop    %ebx
+ 1bf:	5e                   	pop    %esi
+ 1c0:	5d                   	pop    %ebp
+ 1c1:	c3                   	ret
+ 1c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <error>:
+void error(const char *message) {
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%s\n", message);
+ 1d6:	ff 75 08             	push   0x8(%ebp)
+ 1d9:	68 30 0d 00 00       	push   $0xd30
+ 1de:	6a 01                	push   $0x1
+ 1e0:	e8 1b 05 00 00       	call   700 <printf>
+    exit();
+ 1e5:	e8 0e 03 00 00       	call   4f8 <exit>
+ 1ea:	66 90                	xchg   %ax,%ax
+ 1ec:	66 90                	xchg   %ax,%ax
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 e3 01 00 00       	call   510 <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 b6 01 00 00       	call   538 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 b9 01 00 00       	call   550 <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 7f 01 00 00       	call   520 <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 430:	55                   	push   %ebp
+ 431:	31 d2                	xor    %edx,%edx
+ 433:	89 e5                	mov    %esp,%ebp
+ 435:	53                   	push   %ebx
+ 436:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 439:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 43c:	f7 f3                	div    %ebx
+ 43e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 448:	89 ca                	mov    %ecx,%edx
+}
+ 44a:	c9                   	leave
+ 44b:	c3                   	ret
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 450:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 452:	c3                   	ret
+ 453:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000460 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 469:	8b 35 a8 12 00 00    	mov    0x12a8,%esi
+{
+ 46f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 472:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 475:	85 f6                	test   %esi,%esi
+ 477:	74 2f                	je     4a8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 479:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 47e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 484:	f7 e3                	mul    %ebx
+ 486:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 489:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 48c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 48f:	31 d2                	xor    %edx,%edx
+ 491:	f7 f6                	div    %esi
+ 493:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 495:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 498:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 49b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 49d:	89 da                	mov    %ebx,%edx
+}
+ 49f:	5b                   	pop    %ebx
+ 4a0:	5e                   	pop    %esi
+ 4a1:	5f                   	pop    %edi
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	c3                   	ret
+ 4a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 4a8:	e8 0b 01 00 00       	call   5b8 <tscfreq>
+ 4ad:	a3 a8 12 00 00       	mov    %eax,0x12a8
+ 4b2:	89 c6                	mov    %eax,%esi
+ 4b4:	eb c3                	jmp    479 <cyc2ns+0x19>
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	83 ec 10             	sub    $0x10,%esp
+ 4c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 4ca:	6a 00                	push   $0x0
+ 4cc:	e8 3f 01 00 00       	call   610 <getpriority>
+ 4d1:	5a                   	pop    %edx
+ 4d2:	59                   	pop    %ecx
+ 4d3:	01 d8                	add    %ebx,%eax
+ 4d5:	50                   	push   %eax
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 2b 01 00 00       	call   608 <setpriority>
+  return getpriority(0);
+ 4dd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 4e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 4e7:	83 c4 10             	add    $0x10,%esp
+}
+ 4ea:	c9                   	leave
+  return getpriority(0);
+ 4eb:	e9 20 01 00 00       	jmp    610 <getpriority>
+
+000004f0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4f0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <exit>:
+SYSCALL(exit)
+ 4f8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <wait>:
+SYSCALL(wait)
+ 500:	b8 03 00 00 00       	mov    $0x3,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <pipe>:
+SYSCALL(pipe)
+ 508:	b8 04 00 00 00       	mov    $0x4,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <read>:
+SYSCALL(read)
+ 510:	b8 05 00 00 00       	mov    $0x5,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <write>:
+SYSCALL(write)
+ 518:	b8 10 00 00 00       	mov    $0x10,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <close>:
+SYSCALL(close)
+ 520:	b8 15 00 00 00       	mov    $0x15,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <kill>:
+SYSCALL(kill)
+ 528:	b8 06 00 00 00       	mov    $0x6,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <exec>:
+SYSCALL(exec)
+ 530:	b8 07 00 00 00       	mov    $0x7,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <open>:
+SYSCALL(open)
+ 538:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <mknod>:
+SYSCALL(mknod)
+ 540:	b8 11 00 00 00       	mov    $0x11,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <unlink>:
+SYSCALL(unlink)
+ 548:	b8 12 00 00 00       	mov    $0x12,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <fstat>:
+SYSCALL(fstat)
+ 550:	b8 08 00 00 00       	mov    $0x8,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <link>:
+SYSCALL(link)
+ 558:	b8 13 00 00 00       	mov    $0x13,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <mkdir>:
+SYSCALL(mkdir)
+ 560:	b8 14 00 00 00       	mov    $0x14,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <chdir>:
+SYSCALL(chdir)
+ 568:	b8 09 00 00 00       	mov    $0x9,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <dup>:
+SYSCALL(dup)
+ 570:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <getpid>:
+SYSCALL(getpid)
+ 578:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <sbrk>:
+SYSCALL(sbrk)
+ 580:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <sleep>:
+SYSCALL(sleep)
+ 588:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <uptime>:
+SYSCALL(uptime)
+ 590:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <promote>:
+
+SYSCALL(promote)
+ 598:	b8 18 00 00 00       	mov    $0x18,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <demote>:
+SYSCALL(demote)
+ 5a0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 5a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 5b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <tscfreq>:
+SYSCALL(tscfreq)
+ 5b8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <tracemask>:
+SYSCALL(tracemask)
+ 5c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <traceread>:
+SYSCALL(traceread)
+ 5c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <profile>:
+SYSCALL(profile)
+ 5d0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <profread>:
+SYSCALL(profread)
+ 5d8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <lockstat>:
+SYSCALL(lockstat)
+ 5e0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 5e8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <sysstat>:
+SYSCALL(sysstat)
+ 5f0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <kbench>:
+SYSCALL(kbench)
+ 5f8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <yield>:
+SYSCALL(yield)
+ 600:	b8 25 00 00 00       	mov    $0x25,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <setpriority>:
+SYSCALL(setpriority)
+ 608:	b8 26 00 00 00       	mov    $0x26,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <getpriority>:
+SYSCALL(getpriority)
+ 610:	b8 27 00 00 00       	mov    $0x27,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 618:	b8 28 00 00 00       	mov    $0x28,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 620:	b8 29 00 00 00       	mov    $0x29,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <clone>:
+SYSCALL(clone)
+ 628:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <join>:
+SYSCALL(join)
+ 630:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <futex_wait>:
+SYSCALL(futex_wait)
+ 638:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <futex_wake>:
+SYSCALL(futex_wake)
+ 640:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <spawn>:
+SYSCALL(spawn)
+ 648:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <diskstat>:
+SYSCALL(diskstat)
+ 650:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+ 658:	66 90                	xchg   %ax,%ax
+ 65a:	66 90                	xchg   %ax,%ax
+ 65c:	66 90                	xchg   %ax,%ax
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 668:	89 d1                	mov    %edx,%ecx
+{
+ 66a:	83 ec 3c             	sub    $0x3c,%esp
+ 66d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 670:	85 d2                	test   %edx,%edx
+ 672:	0f 89 80 00 00 00    	jns    6f8 <printint+0x98>
+ 678:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 67c:	74 7a                	je     6f8 <printint+0x98>
+    x = -xx;
+ 67e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 680:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 685:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 688:	31 f6                	xor    %esi,%esi
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 690:	89 c8                	mov    %ecx,%eax
+ 692:	31 d2                	xor    %edx,%edx
+ 694:	89 f7                	mov    %esi,%edi
+ 696:	f7 f3                	div    %ebx
+ 698:	8d 76 01             	lea    0x1(%esi),%esi
+ 69b:	0f b6 92 a0 0e 00 00 	movzbl 0xea0(%edx),%edx
+ 6a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6a6:	89 ca                	mov    %ecx,%edx
+ 6a8:	89 c1                	mov    %eax,%ecx
+ 6aa:	39 da                	cmp    %ebx,%edx
+ 6ac:	73 e2                	jae    690 <printint+0x30>
+  if(neg)
+ 6ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6b1:	85 c0                	test   %eax,%eax
+ 6b3:	74 07                	je     6bc <printint+0x5c>
+    buf[i++] = '-';
+ 6b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ba:	89 f7                	mov    %esi,%edi
+ 6bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6c2:	01 df                	add    %ebx,%edi
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6d4:	6a 01                	push   $0x1
+ 6d6:	50                   	push   %eax
+ 6d7:	56                   	push   %esi
+ 6d8:	e8 3b fe ff ff       	call   518 <write>
+  while(--i >= 0)
+ 6dd:	89 f8                	mov    %edi,%eax
+ 6df:	83 c4 10             	add    $0x10,%esp
+ 6e2:	83 ef 01             	sub    $0x1,%edi
+ 6e5:	39 d8                	cmp    %ebx,%eax
+ 6e7:	75 df                	jne    6c8 <printint+0x68>
+}
+ 6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ec:	5b                   	pop    %ebx
+ 6ed:	5e                   	pop    %esi
+ 6ee:	5f                   	pop    %edi
+ 6ef:	5d                   	pop    %ebp
+ 6f0:	c3                   	ret
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6f8:	31 c0                	xor    %eax,%eax
+ 6fa:	eb 89                	jmp    685 <printint+0x25>
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 709:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 70c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 70f:	0f b6 1e             	movzbl (%esi),%ebx
+ 712:	83 c6 01             	add    $0x1,%esi
+ 715:	84 db                	test   %bl,%bl
+ 717:	74 67                	je     780 <printf+0x80>
+ 719:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 71c:	31 d2                	xor    %edx,%edx
+ 71e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 721:	eb 34                	jmp    757 <printf+0x57>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+ 728:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 72b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 730:	83 f8 25             	cmp    $0x25,%eax
+ 733:	74 18                	je     74d <printf+0x4d>
+  write(fd, &c, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 73b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73e:	6a 01                	push   $0x1
+ 740:	50                   	push   %eax
+ 741:	57                   	push   %edi
+ 742:	e8 d1 fd ff ff       	call   518 <write>
+ 747:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 74a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 74d:	0f b6 1e             	movzbl (%esi),%ebx
+ 750:	83 c6 01             	add    $0x1,%esi
+ 753:	84 db                	test   %bl,%bl
+ 755:	74 29                	je     780 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 757:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 75a:	85 d2                	test   %edx,%edx
+ 75c:	74 ca                	je     728 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 75e:	83 fa 25             	cmp    $0x25,%edx
+ 761:	75 ea                	jne    74d <printf+0x4d>
+      if(c == 'd'){
+ 763:	83 f8 25             	cmp    $0x25,%eax
+ 766:	0f 84 24 01 00 00    	je     890 <printf+0x190>
+ 76c:	83 e8 63             	sub    $0x63,%eax
+ 76f:	83 f8 15             	cmp    $0x15,%eax
+ 772:	77 1c                	ja     790 <printf+0x90>
+ 774:	ff 24 85 48 0e 00 00 	jmp    *0xe48(,%eax,4)
+ 77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 783:	5b                   	pop    %ebx
+ 784:	5e                   	pop    %esi
+ 785:	5f                   	pop    %edi
+ 786:	5d                   	pop    %ebp
+ 787:	c3                   	ret
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 796:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 79a:	6a 01                	push   $0x1
+ 79c:	52                   	push   %edx
+ 79d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7a0:	57                   	push   %edi
+ 7a1:	e8 72 fd ff ff       	call   518 <write>
+ 7a6:	83 c4 0c             	add    $0xc,%esp
+ 7a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ac:	6a 01                	push   $0x1
+ 7ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7b1:	52                   	push   %edx
+ 7b2:	57                   	push   %edi
+ 7b3:	e8 60 fd ff ff       	call   518 <write>
+        putc(fd, c);
+ 7b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bb:	31 d2                	xor    %edx,%edx
+ 7bd:	eb 8e                	jmp    74d <printf+0x4d>
+ 7bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 00                	push   $0x0
+ 7cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7d4:	e8 87 fe ff ff       	call   660 <printint>
+        ap++;
+ 7d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 67 ff ff ff       	jmp    74d <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7f5:	83 c0 04             	add    $0x4,%eax
+ 7f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7fb:	85 db                	test   %ebx,%ebx
+ 7fd:	0f 84 9d 00 00 00    	je     8a0 <printf+0x1a0>
+        while(*s != 0){
+ 803:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 806:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 808:	84 c0                	test   %al,%al
+ 80a:	0f 84 3d ff ff ff    	je     74d <printf+0x4d>
+ 810:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 813:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 816:	89 de                	mov    %ebx,%esi
+ 818:	89 d3                	mov    %edx,%ebx
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 826:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	53                   	push   %ebx
+ 82c:	57                   	push   %edi
+ 82d:	e8 e6 fc ff ff       	call   518 <write>
+        while(*s != 0){
+ 832:	0f b6 06             	movzbl (%esi),%eax
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	84 c0                	test   %al,%al
+ 83a:	75 e4                	jne    820 <printf+0x120>
+      state = 0;
+ 83c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 07 ff ff ff       	jmp    74d <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 01                	push   $0x1
+ 85f:	e9 6b ff ff ff       	jmp    7cf <printf+0xcf>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 868:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 871:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 873:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 876:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	52                   	push   %edx
+ 87c:	57                   	push   %edi
+ 87d:	e8 96 fc ff ff       	call   518 <write>
+        ap++;
+ 882:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 885:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 888:	31 d2                	xor    %edx,%edx
+ 88a:	e9 be fe ff ff       	jmp    74d <printf+0x4d>
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 896:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 899:	6a 01                	push   $0x1
+ 89b:	e9 11 ff ff ff       	jmp    7b1 <printf+0xb1>
+ 8a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8a5:	bb 40 0e 00 00       	mov    $0xe40,%ebx
+ 8aa:	e9 61 ff ff ff       	jmp    810 <printf+0x110>
+ 8af:	90                   	nop
+
+000008b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	a1 ac 12 00 00       	mov    0x12ac,%eax
+{
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	57                   	push   %edi
+ 8b9:	56                   	push   %esi
+ 8ba:	53                   	push   %ebx
+ 8bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8cc:	39 ca                	cmp    %ecx,%edx
+ 8ce:	73 30                	jae    900 <free+0x50>
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 04                	jb     8d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d4:	39 c2                	cmp    %eax,%edx
+ 8d6:	72 f0                	jb     8c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8de:	39 f8                	cmp    %edi,%eax
+ 8e0:	74 2e                	je     910 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8eb:	39 f1                	cmp    %esi,%ecx
+ 8ed:	74 38                	je     927 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8f1:	5b                   	pop    %ebx
+  freep = p;
+ 8f2:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ 8f8:	5e                   	pop    %esi
+ 8f9:	5f                   	pop    %edi
+ 8fa:	5d                   	pop    %ebp
+ 8fb:	c3                   	ret
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 900:	39 c1                	cmp    %eax,%ecx
+ 902:	72 d0                	jb     8d4 <free+0x24>
+ 904:	eb c2                	jmp    8c8 <free+0x18>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 910:	03 70 04             	add    0x4(%eax),%esi
+ 913:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 916:	8b 02                	mov    (%edx),%eax
+ 918:	8b 00                	mov    (%eax),%eax
+ 91a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 91d:	8b 42 04             	mov    0x4(%edx),%eax
+ 920:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 923:	39 f1                	cmp    %esi,%ecx
+ 925:	75 c8                	jne    8ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 927:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 92a:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+    p->s.size += bp->s.size;
+ 930:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 933:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 936:	89 0a                	mov    %ecx,(%edx)
+}
+ 938:	5b                   	pop    %ebx
+ 939:	5e                   	pop    %esi
+ 93a:	5f                   	pop    %edi
+ 93b:	5d                   	pop    %ebp
+ 93c:	c3                   	ret
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 94c:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 952:	8d 78 07             	lea    0x7(%eax),%edi
+ 955:	c1 ef 03             	shr    $0x3,%edi
+ 958:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 95b:	85 d2                	test   %edx,%edx
+ 95d:	0f 84 8d 00 00 00    	je     9f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 963:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 965:	8b 48 04             	mov    0x4(%eax),%ecx
+ 968:	39 f9                	cmp    %edi,%ecx
+ 96a:	73 64                	jae    9d0 <malloc+0x90>
+  if(nu < 4096)
+ 96c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 971:	39 df                	cmp    %ebx,%edi
+ 973:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 976:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 97d:	eb 0a                	jmp    989 <malloc+0x49>
+ 97f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 980:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 982:	8b 48 04             	mov    0x4(%eax),%ecx
+ 985:	39 f9                	cmp    %edi,%ecx
+ 987:	73 47                	jae    9d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 989:	89 c2                	mov    %eax,%edx
+ 98b:	39 05 ac 12 00 00    	cmp    %eax,0x12ac
+ 991:	75 ed                	jne    980 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	56                   	push   %esi
+ 997:	e8 e4 fb ff ff       	call   580 <sbrk>
+  if(p == (char*)-1)
+ 99c:	83 c4 10             	add    $0x10,%esp
+ 99f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9a2:	74 1c                	je     9c0 <malloc+0x80>
+  hp->s.size = nu;
+ 9a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9a7:	83 ec 0c             	sub    $0xc,%esp
+ 9aa:	83 c0 08             	add    $0x8,%eax
+ 9ad:	50                   	push   %eax
+ 9ae:	e8 fd fe ff ff       	call   8b0 <free>
+  return freep;
+ 9b3:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+      if((p = morecore(nunits)) == 0)
+ 9b9:	83 c4 10             	add    $0x10,%esp
+ 9bc:	85 d2                	test   %edx,%edx
+ 9be:	75 c0                	jne    980 <malloc+0x40>
+        return 0;
+  }
+}
+ 9c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9c3:	31 c0                	xor    %eax,%eax
+}
+ 9c5:	5b                   	pop    %ebx
+ 9c6:	5e                   	pop    %esi
+ 9c7:	5f                   	pop    %edi
+ 9c8:	5d                   	pop    %ebp
+ 9c9:	c3                   	ret
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9d0:	39 cf                	cmp    %ecx,%edi
+ 9d2:	74 4c                	je     a20 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9d4:	29 f9                	sub    %edi,%ecx
+ 9d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9df:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ 9e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9e8:	83 c0 08             	add    $0x8,%eax
+}
+ 9eb:	5b                   	pop    %ebx
+ 9ec:	5e                   	pop    %esi
+ 9ed:	5f                   	pop    %edi
+ 9ee:	5d                   	pop    %ebp
+ 9ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9f0:	c7 05 ac 12 00 00 b0 	movl   $0x12b0,0x12ac
+ 9f7:	12 00 00 
+    base.s.size = 0;
+ 9fa:	b8 b0 12 00 00       	mov    $0x12b0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9ff:	c7 05 b0 12 00 00 b0 	movl   $0x12b0,0x12b0
+ a06:	12 00 00 
+    base.s.size = 0;
+ a09:	c7 05 b4 12 00 00 00 	movl   $0x0,0x12b4
+ a10:	00 00 00 
+    if(p->s.size >= nunits){
+ a13:	e9 54 ff ff ff       	jmp    96c <malloc+0x2c>
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a20:	8b 08                	mov    (%eax),%ecx
+ a22:	89 0a                	mov    %ecx,(%edx)
+ a24:	eb b9                	jmp    9df <malloc+0x9f>
+ a26:	66 90                	xchg   %ax,%ax
+ a28:	66 90                	xchg   %ax,%ax
+ a2a:	66 90                	xchg   %ax,%ax
+ a2c:	66 90                	xchg   %ax,%ax
+ a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 20             	sub    $0x20,%esp
+ a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+ a3c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ a3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a42:	68 e8 03 00 00       	push   $0x3e8
+ a47:	57                   	push   %edi
+ a48:	56                   	push   %esi
+ a49:	e8 e2 f9 ff ff       	call   430 <udiv64>
+ a4e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a50:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a53:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ a59:	29 c1                	sub    %eax,%ecx
+ a5b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a5e:	68 e8 03 00 00       	push   $0x3e8
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	e8 c6 f9 ff ff       	call   430 <udiv64>
+ a6a:	83 c4 0c             	add    $0xc,%esp
+ a6d:	50                   	push   %eax
+ a6e:	68 b1 0e 00 00       	push   $0xeb1
+ a73:	53                   	push   %ebx
+ a74:	e8 87 fc ff ff       	call   700 <printf>
+  if(frac < 100)
+ a79:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a7c:	83 c4 10             	add    $0x10,%esp
+ a7f:	83 f9 63             	cmp    $0x63,%ecx
+ a82:	76 1c                	jbe    aa0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ a84:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ a87:	c7 45 0c b7 0e 00 00 	movl   $0xeb7,0xc(%ebp)
+ a8e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ a91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a94:	5b                   	pop    %ebx
+ a95:	5e                   	pop    %esi
+ a96:	5f                   	pop    %edi
+ a97:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ a98:	e9 63 fc ff ff       	jmp    700 <printf>
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	68 b5 0e 00 00       	push   $0xeb5
+ aa8:	53                   	push   %ebx
+ aa9:	e8 52 fc ff ff       	call   700 <printf>
+  if(frac < 10)
+ aae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ ab1:	83 c4 10             	add    $0x10,%esp
+ ab4:	83 f9 09             	cmp    $0x9,%ecx
+ ab7:	77 cb                	ja     a84 <printps+0x54>
+    printf(fd, "0");
+ ab9:	83 ec 08             	sub    $0x8,%esp
+ abc:	68 b5 0e 00 00       	push   $0xeb5
+ ac1:	53                   	push   %ebx
+ ac2:	e8 39 fc ff ff       	call   700 <printf>
+ ac7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ aca:	83 c4 10             	add    $0x10,%esp
+ acd:	eb b5                	jmp    a84 <printps+0x54>
+ acf:	90                   	nop
+
+00000ad0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ adc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ adf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ ae2:	83 e8 01             	sub    $0x1,%eax
+ ae5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ aea:	0f 87 37 02 00 00    	ja     d27 <bench+0x257>
+ af0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ af3:	85 ff                	test   %edi,%edi
+ af5:	0f 84 2c 02 00 00    	je     d27 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ afb:	83 ec 0c             	sub    $0xc,%esp
+ afe:	ff 75 10             	push   0x10(%ebp)
+ b01:	ff 55 0c             	call   *0xc(%ebp)
+ b04:	5b                   	pop    %ebx
+ b05:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ b08:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ b0a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ b0d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ b10:	83 c4 10             	add    $0x10,%esp
+ b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b17:	90                   	nop
+    t0 = cycles();
+ b18:	e8 33 f9 ff ff       	call   450 <cycles>
+    fn(arg);
+ b1d:	83 ec 0c             	sub    $0xc,%esp
+ b20:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ b23:	89 c6                	mov    %eax,%esi
+ b25:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ b27:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ b2a:	e8 21 f9 ff ff       	call   450 <cycles>
+ b2f:	29 f0                	sub    %esi,%eax
+ b31:	19 fa                	sbb    %edi,%edx
+ b33:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b3a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ b3d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b44:	83 c3 01             	add    $0x1,%ebx
+ b47:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ b4a:	7f cc                	jg     b18 <bench+0x48>
+  for(i = 1; i < n; i++){
+ b4c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ b50:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ b53:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ b59:	bf 01 00 00 00       	mov    $0x1,%edi
+ b5e:	74 77                	je     bd7 <bench+0x107>
+ b60:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b67:	90                   	nop
+    v = a[i];
+ b68:	8b 01                	mov    (%ecx),%eax
+ b6a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ b6d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ b73:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ b79:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ b7f:	89 c8                	mov    %ecx,%eax
+ b81:	eb 1b                	jmp    b9e <bench+0xce>
+ b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b87:	90                   	nop
+      a[j] = a[j-1];
+ b88:	89 08                	mov    %ecx,(%eax)
+ b8a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ b8d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ b90:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ b96:	39 c3                	cmp    %eax,%ebx
+ b98:	0f 84 72 01 00 00    	je     d10 <bench+0x240>
+ b9e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ ba1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ ba4:	89 f7                	mov    %esi,%edi
+ ba6:	89 c3                	mov    %eax,%ebx
+ ba8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ bae:	19 d7                	sbb    %edx,%edi
+ bb0:	72 d6                	jb     b88 <bench+0xb8>
+ bb2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ bb8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ bbe:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ bc4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ bc7:	83 c7 01             	add    $0x1,%edi
+ bca:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ bcd:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ bcf:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ bd2:	75 94                	jne    b68 <bench+0x98>
+ bd4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bd7:	83 ec 08             	sub    $0x8,%esp
+ bda:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ be0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ be5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ beb:	e8 70 f8 ff ff       	call   460 <cyc2ns>
+ bf0:	83 c4 0c             	add    $0xc,%esp
+ bf3:	ff 75 14             	push   0x14(%ebp)
+ bf6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ bfc:	f7 e3                	mul    %ebx
+ bfe:	01 ca                	add    %ecx,%edx
+ c00:	52                   	push   %edx
+ c01:	50                   	push   %eax
+ c02:	e8 29 f8 ff ff       	call   430 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ c07:	89 06                	mov    %eax,(%esi)
+ c09:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c0c:	5f                   	pop    %edi
+ c0d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ c0e:	8b 45 18             	mov    0x18(%ebp),%eax
+ c11:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c13:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ c1a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ c21:	e8 3a f8 ff ff       	call   460 <cyc2ns>
+ c26:	83 c4 0c             	add    $0xc,%esp
+ c29:	ff 75 14             	push   0x14(%ebp)
+ c2c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c32:	f7 e3                	mul    %ebx
+ c34:	01 ca                	add    %ecx,%edx
+ c36:	52                   	push   %edx
+ c37:	50                   	push   %eax
+ c38:	e8 f3 f7 ff ff       	call   430 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ c3d:	89 46 08             	mov    %eax,0x8(%esi)
+ c40:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c43:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c44:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c47:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c48:	8d 50 01             	lea    0x1(%eax),%edx
+ c4b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ c50:	6b d2 63             	imul   $0x63,%edx,%edx
+ c53:	f7 e2                	mul    %edx
+ c55:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c58:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ c5f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ c66:	e8 f5 f7 ff ff       	call   460 <cyc2ns>
+ c6b:	83 c4 0c             	add    $0xc,%esp
+ c6e:	ff 75 14             	push   0x14(%ebp)
+ c71:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c77:	f7 e3                	mul    %ebx
+ c79:	01 ca                	add    %ecx,%edx
+ c7b:	52                   	push   %edx
+ c7c:	50                   	push   %eax
+ c7d:	e8 ae f7 ff ff       	call   430 <udiv64>
+
+  if(name){
+ c82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ c85:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c88:	89 46 10             	mov    %eax,0x10(%esi)
+ c8b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ c8e:	85 c9                	test   %ecx,%ecx
+ c90:	74 72                	je     d04 <bench+0x234>
+    printf(1, "%s: min ", name);
+ c92:	83 ec 04             	sub    $0x4,%esp
+ c95:	ff 75 08             	push   0x8(%ebp)
+ c98:	68 ba 0e 00 00       	push   $0xeba
+ c9d:	6a 01                	push   $0x1
+ c9f:	e8 5c fa ff ff       	call   700 <printf>
+    printps(1, st->min);
+ ca4:	83 c4 0c             	add    $0xc,%esp
+ ca7:	ff 76 04             	push   0x4(%esi)
+ caa:	ff 36                	push   (%esi)
+ cac:	6a 01                	push   $0x1
+ cae:	e8 7d fd ff ff       	call   a30 <printps>
+    printf(1, " median ");
+ cb3:	58                   	pop    %eax
+ cb4:	5a                   	pop    %edx
+ cb5:	68 c3 0e 00 00       	push   $0xec3
+ cba:	6a 01                	push   $0x1
+ cbc:	e8 3f fa ff ff       	call   700 <printf>
+    printps(1, st->median);
+ cc1:	83 c4 0c             	add    $0xc,%esp
+ cc4:	ff 76 0c             	push   0xc(%esi)
+ cc7:	ff 76 08             	push   0x8(%esi)
+ cca:	6a 01                	push   $0x1
+ ccc:	e8 5f fd ff ff       	call   a30 <printps>
+    printf(1, " p99 ");
+ cd1:	59                   	pop    %ecx
+ cd2:	5b                   	pop    %ebx
+ cd3:	68 cc 0e 00 00       	push   $0xecc
+ cd8:	6a 01                	push   $0x1
+ cda:	e8 21 fa ff ff       	call   700 <printf>
+    printps(1, st->p99);
+ cdf:	83 c4 0c             	add    $0xc,%esp
+ ce2:	ff 76 14             	push   0x14(%esi)
+ ce5:	ff 76 10             	push   0x10(%esi)
+ ce8:	6a 01                	push   $0x1
+ cea:	e8 41 fd ff ff       	call   a30 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ cef:	83 c4 0c             	add    $0xc,%esp
+ cf2:	ff 75 18             	push   0x18(%ebp)
+ cf5:	68 d2 0e 00 00       	push   $0xed2
+ cfa:	6a 01                	push   $0x1
+ cfc:	e8 ff f9 ff ff       	call   700 <printf>
+ d01:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ d04:	31 c0                	xor    %eax,%eax
+}
+ d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d09:	5b                   	pop    %ebx
+ d0a:	5e                   	pop    %esi
+ d0b:	5f                   	pop    %edi
+ d0c:	5d                   	pop    %ebp
+ d0d:	c3                   	ret
+ d0e:	66 90                	xchg   %ax,%ax
+ d10:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ d16:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ d1c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d22:	e9 97 fe ff ff       	jmp    bbe <bench+0xee>
+    return -1;
+ d27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d2c:	eb d8                	jmp    d06 <bench+0x236>
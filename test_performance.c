@@ -2,21 +2,26 @@
 #include "types.h"
 #include "user.h"
 
+#define RUNS 21
+
 // definitions 
+struct scan {
+    int *arr;
+    int size;
+    int bad;
+};
+
 void error(const char *message) {
     printf(1, "%s\n", message);
     exit();
 }
 
-// returns time takent to access entire array in miliseconds
-int access_time(int *arr, int size) {
-    int start, end;
-    start = uptime();
-    for(int i=0; i<size; i++)
-        if(arr[i] != i%256)
-            return -1;
-    end = uptime();
-    return (end-start)*10;
+// reads the entire array once, checking its contents
+void access_array(void *arg) {
+    struct scan *s = arg;
+    for(int i=0; i<s->size; i++)
+        if(s->arr[i] != i%256)
+            s->bad = 1;
 }
 
 int main(int argc, char **argv) {
@@ -27,35 +32,36 @@ int main(int argc, char **argv) {
         exit();
     }
 
+    // pin to one cpu so both scans see the same caches and TLB
+    sched_setaffinity(0, 1);
+
     // 1. Declare an array of given size 
     int size_in_bytes = atoi(argv[1])*(1 << 20);
     int *arr = malloc(size_in_bytes);
+    struct scan s = { arr, size_in_bytes/sizeof(int), 0 };
+    struct benchstat before, after;
     
     // 2. Initialzie the array 
     for(int i=0; i < size_in_bytes/sizeof(int); i++)
         arr[i] = i%256;
     printf(1, "Array of size %s MBs initialized.\n", argv[1]);
 
-    int time_before = access_time(arr, size_in_bytes/sizeof(int));
-    printf(1, "Access time  = %d ms.\n", time_before);
+    bench("4KB pages", access_array, &s, s.size, RUNS, &before);
 
     // 3. invoke promote system call 
     if(promote(arr, size_in_bytes))
         error("Error: promote syscall failed.");
-    printf(1, "promote() system call success.\n");
+    printf(1, "promote() system call success, %d huge pages.\n",
+           huge_page_count(arr, size_in_bytes));
 
-    // loading TLB
-    for(int i=0; i<size_in_bytes/sizeof(int); i++)
-        if(arr[i] != i%256)
-            return 1;
+    bench("4MB pages", access_array, &s, s.size, RUNS, &after);
+    if(s.bad)
+        error("Error: integrity failure.");
 
-    int time_after = access_time(arr, size_in_bytes/sizeof(int));
-    printf(1, "Access time  = %d ms.\n", time_after);
-
-    // 4. Difference in access time
-    if(time_after < time_before)
+    // 4. Difference in median access time
+    if(after.median < before.median)
     {
-        int performance = (float)(time_before-time_after)/time_before*100;
+        int performance = udiv64((before.median-after.median)*100, (uint)before.median);
         printf(1, "Performance improvement by %d percent.\n", performance);
     }
 
@@ -64,5 +70,3 @@ int main(int argc, char **argv) {
         error("Error: demote syscall failed.");
     exit();
 }
-
-
@@ -0,0 +1,177 @@
+// Executable pages shared between processes.
+//
+// When pagefault() reads in a page of an executable's segment,
+// it keeps the page here, keyed by inode and file offset, and
+// maps it without PTE_W and with PTE_SHARED into every process
+// that touches the same page of the same program.  The segments
+// are writable, so the first write to a shared page gives the
+// writer a private copy (cowpage in vm.c).  Each mapping holds
+// a reference, and the page is freed when the last goes away.
+//
+// A page stays findable only while its inode's content and
+// identity are unchanged: writei, itrunc and the recycling of
+// an icache slot all call textforget first.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NTEXT      1024   // most pages in the cache
+#define NTEXTHASH   256
+#define FILEHASH(ip, off)  ((((uint)(ip) >> 6) + (off) / PGSIZE) % NTEXTHASH)
+#define MEMHASH(mem)       (((uint)(mem) / PGSIZE) % NTEXTHASH)
+
+struct textpage {
+  struct inode *ip;          // Executable, or 0 once forgotten
+  uint off;                  // File offset of the page's data
+  char *mem;                 // The page, or 0 if this slot is free
+  int ref;                   // Page table entries mapping it
+  struct textpage *fnext;    // Next in byfile chain, or free list
+  struct textpage *mnext;    // Next in bymem chain
+};
+
+static struct {
+  struct spinlock lock;
+  struct textpage page[NTEXT];
+  struct textpage *free;                // unused slots
+  struct textpage *byfile[NTEXTHASH];   // findable pages by (ip, off)
+  struct textpage *bymem[NTEXTHASH];    // all pages by address
+} text;
+
+void
+textinit(void)
+{
+  struct textpage *t;
+
+  initlock(&text.lock, "text");
+  for(t = text.page; t < &text.page[NTEXT]; t++){
+    t->fnext = text.free;
+    text.free = t;
+  }
+}
+
+// Take t out of the byfile chain.
+static void
+unlinkfile(struct textpage *t)
+{
+  struct textpage **pp;
+
+  for(pp = &text.byfile[FILEHASH(t->ip, t->off)]; *pp != t; pp = &(*pp)->fnext)
+    ;
+  *pp = t->fnext;
+  t->ip->ntext--;
+  t->ip = 0;
+}
+
+static struct textpage*
+findmem(char *mem)
+{
+  struct textpage *t;
+
+  for(t = text.bymem[MEMHASH(mem)]; t; t = t->mnext)
+    if(t->mem == mem)
+      return t;
+  panic("textpage");
+}
+
+// Return the cached page of ip's data at file offset off, with
+// a new reference, or 0.  Caller holds ip's lock.
+char*
+textget(struct inode *ip, uint off)
+{
+  struct textpage *t;
+  char *mem;
+
+  mem = 0;
+  acquire(&text.lock);
+  for(t = text.byfile[FILEHASH(ip, off)]; t; t = t->fnext){
+    if(t->ip == ip && t->off == off){
+      t->ref++;
+      mem = t->mem;
+      break;
+    }
+  }
+  release(&text.lock);
+  return mem;
+}
+
+// Add page mem, just read from ip at file offset off, with one
+// reference.  Returns 0 if the cache is full, in which case mem
+// stays the caller's.  Caller holds ip's lock.
+int
+textadd(struct inode *ip, uint off, char *mem)
+{
+  struct textpage *t, **b;
+
+  acquire(&text.lock);
+  if((t = text.free) == 0){
+    release(&text.lock);
+    return 0;
+  }
+  text.free = t->fnext;
+  t->ip = ip;
+  t->off = off;
+  t->mem = mem;
+  t->ref = 1;
+  b = &text.byfile[FILEHASH(ip, off)];
+  t->fnext = *b;
+  *b = t;
+  b = &text.bymem[MEMHASH(mem)];
+  t->mnext = *b;
+  *b = t;
+  ip->ntext++;
+  release(&text.lock);
+  return 1;
+}
+
+// Another page table entry now maps shared page mem (fork).
+void
+textdup(char *mem)
+{
+  acquire(&text.lock);
+  findmem(mem)->ref++;
+  release(&text.lock);
+}
+
+// A page table entry mapping shared page mem has gone away.
+void
+textput(char *mem)
+{
+  struct textpage *t, **pp;
+
+  acquire(&text.lock);
+  t = findmem(mem);
+  if(--t->ref == 0){
+    if(t->ip)
+      unlinkfile(t);
+    for(pp = &text.bymem[MEMHASH(mem)]; *pp != t; pp = &(*pp)->mnext)
+      ;
+    *pp = t->mnext;
+    t->mem = 0;
+    t->fnext = text.free;
+    text.free = t;
+    kfree(mem);
+  }
+  release(&text.lock);
+}
+
+// ip's content is about to change, or its icache slot to hold
+// another inode: stop handing out its cached pages.  Pages still
+// mapped stay until their last reference goes.
+void
+textforget(struct inode *ip)
+{
+  struct textpage *t;
+
+  acquire(&text.lock);
+  for(t = text.page; t < &text.page[NTEXT] && ip->ntext > 0; t++)
+    if(t->mem && t->ip == ip)
+      unlinkfile(t);
+  release(&text.lock);
+}
@@ -0,0 +1,142 @@
+// Threads for user programs: a small subset of pthreads built
+// on clone(), join() and futexes.  Threads share memory but
+// malloc() is not thread-safe; allocate before starting them
+// or under a mutex.  Only the creating thread may join.
+
+#include "types.h"
+#include "user.h"
+#include "x86.h"
+
+#define TSTACK   8192   // bytes of user stack per thread
+#define NTHREAD    64
+
+// What a new thread runs, kept at the bottom of its stack.
+struct tstart {
+  void (*fn)(void*);
+  void *arg;
+};
+
+static struct {
+  int tid;
+  char *stack;   // 0 if the slot is free
+} threads[NTHREAD];
+static struct mutex tlock;   // guards threads[] and our malloc calls
+
+static void
+tstart(void *a)
+{
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+  exit();
+}
+
+// Start a thread running fn(arg).  Returns its id, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  struct tstart *t;
+  char *stack;
+  int i, tid;
+
+  mutex_lock(&tlock);
+  for(i = 0; i < NTHREAD; i++)
+    if(threads[i].stack == 0)
+      break;
+  if(i == NTHREAD || (stack = malloc(TSTACK)) == 0){
+    mutex_unlock(&tlock);
+    return -1;
+  }
+  t = (struct tstart*)stack;
+  t->fn = fn;
+  t->arg = arg;
+  if((tid = clone(tstart, t, stack + TSTACK)) < 0){
+    free(stack);
+    mutex_unlock(&tlock);
+    return -1;
+  }
+  threads[i].tid = tid;
+  threads[i].stack = stack;
+  mutex_unlock(&tlock);
+  return tid;
+}
+
+// Wait for thread tid to finish and free its stack.
+int
+thread_join(int tid)
+{
+  int i;
+
+  if(join(tid) < 0)
+    return -1;
+  mutex_lock(&tlock);
+  for(i = 0; i < NTHREAD; i++){
+    if(threads[i].stack && threads[i].tid == tid){
+      free(threads[i].stack);
+      threads[i].stack = 0;
+      break;
+    }
+  }
+  mutex_unlock(&tlock);
+  return 0;
+}
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = 0;
+}
+
+// Take m without a system call when it is free; otherwise mark
+// it contended and sleep in the kernel until it is released.
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    return;
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+// Release m, entering the kernel only if someone may be waiting.
+void
+mutex_unlock(struct mutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake(&m->state, 1);
+}
+
+void
+barrier_init(struct barrier *b, uint n)
+{
+  mutex_init(&b->lk);
+  b->n = n;
+  b->count = 0;
+  b->round = 0;
+}
+
+// Wait until n threads have called barrier_wait on b.
+void
+barrier_wait(struct barrier *b)
+{
+  uint round;
+
+  mutex_lock(&b->lk);
+  round = b->round;
+  if(++b->count == b->n){
+    b->count = 0;
+    b->round++;
+    mutex_unlock(&b->lk);
+    futex_wake(&b->round, b->n);
+    return;
+  }
+  mutex_unlock(&b->lk);
+  while(b->round == round)
+    futex_wait(&b->round, round);
+}
@@ -0,0 +1,2656 @@
+
+_threadbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return cyc2ns(cycles() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+  uint i, want;
+  uint64 ns;
+  char *p;
+
+  max = 4;
+  if(argc > 1)
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 41 04             	mov    0x4(%ecx),%eax
+  max = 4;
+      1a:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  if(argc > 1)
+      21:	0f 8f b3 01 00 00    	jg     1da <main+0x1da>
+    exit();
+  }
+
+  // Back the array with huge pages before any thread exists;
+  // promote() is refused once the address space is shared.
+  p = sbrk(ARRAYMB * 1024 * 1024 + HUGEPG);
+      27:	83 ec 0c             	sub    $0xc,%esp
+      2a:	68 00 00 c0 00       	push   $0xc00000
+      2f:	e8 6c 07 00 00       	call   7a0 <sbrk>
+  if(p == (char*)-1){
+      34:	83 c4 10             	add    $0x10,%esp
+      37:	83 f8 ff             	cmp    $0xffffffff,%eax
+      3a:	0f 84 cb 01 00 00    	je     20b <main+0x20b>
+    printf(2, "threadbench: out of memory\n");
+    exit();
+  }
+  array = (uint*)(((uint)p + HUGEPG - 1) & ~(HUGEPG - 1));
+      40:	8d 90 ff ff 3f 00    	lea    0x3fffff(%eax),%edx
+  nword = ARRAYMB * 1024 * 1024 / 4;
+  for(i = 0; i < nword; i++)
+      46:	31 c0                	xor    %eax,%eax
+  nword = ARRAYMB * 1024 * 1024 / 4;
+      48:	c7 05 60 1a 00 00 00 	movl   $0x200000,0x1a60
+      4f:	00 20 00 
+  array = (uint*)(((uint)p + HUGEPG - 1) & ~(HUGEPG - 1));
+      52:	81 e2 00 00 c0 ff    	and    $0xffc00000,%edx
+      58:	89 15 64 1a 00 00    	mov    %edx,0x1a64
+      5e:	89 d1                	mov    %edx,%ecx
+    array[i] = i;
+      60:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < nword; i++)
+      62:	83 c0 01             	add    $0x1,%eax
+      65:	83 c2 04             	add    $0x4,%edx
+      68:	3d 00 00 20 00       	cmp    $0x200000,%eax
+      6d:	75 f1                	jne    60 <main+0x60>
+  promote(array, ARRAYMB * 1024 * 1024);
+      6f:	50                   	push   %eax
+      70:	50                   	push   %eax
+      71:	68 00 00 80 00       	push   $0x800000
+      76:	51                   	push   %ecx
+      77:	e8 3c 07 00 00       	call   7b8 <promote>
+  mutex_init(&lk);
+      7c:	c7 04 24 48 1a 00 00 	movl   $0x1a48,(%esp)
+      83:	e8 28 11 00 00       	call   11b0 <mutex_init>
+
+  printf(1, "threads\tsum ms\tMB/s\tns/lock\n");
+      88:	5a                   	pop    %edx
+      89:	59                   	pop    %ecx
+      8a:	68 1b 14 00 00       	push   $0x141b
+      8f:	6a 01                	push   $0x1
+      91:	e8 8a 08 00 00       	call   920 <printf>
+  for(nthr = 1; nthr <= max; nthr *= 2){
+      96:	83 c4 10             	add    $0x10,%esp
+      99:	c7 05 5c 1a 00 00 01 	movl   $0x1,0x1a5c
+      a0:	00 00 00 
+      a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      a7:	90                   	nop
+    total = 0;
+      a8:	c7 05 44 1a 00 00 00 	movl   $0x0,0x1a44
+      af:	00 00 00 
+    ns = run(sum);
+      b2:	b8 70 02 00 00       	mov    $0x270,%eax
+      b7:	e8 44 02 00 00       	call   300 <run>
+    want = 0;
+    for(i = 0; i < nword / nthr * nthr; i++)
+      bc:	8b 1d 60 1a 00 00    	mov    0x1a60,%ebx
+      c2:	8b 0d 5c 1a 00 00    	mov    0x1a5c,%ecx
+    ns = run(sum);
+      c8:	89 c6                	mov    %eax,%esi
+      ca:	89 d7                	mov    %edx,%edi
+    for(i = 0; i < nword / nthr * nthr; i++)
+      cc:	31 d2                	xor    %edx,%edx
+      ce:	89 d8                	mov    %ebx,%eax
+      d0:	f7 f1                	div    %ecx
+    want = 0;
+      d2:	31 c0                	xor    %eax,%eax
+    for(i = 0; i < nword / nthr * nthr; i++)
+      d4:	29 d3                	sub    %edx,%ebx
+      d6:	74 11                	je     e9 <main+0xe9>
+      d8:	31 d2                	xor    %edx,%edx
+      da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      want += i;
+      e0:	01 d0                	add    %edx,%eax
+    for(i = 0; i < nword / nthr * nthr; i++)
+      e2:	83 c2 01             	add    $0x1,%edx
+      e5:	39 da                	cmp    %ebx,%edx
+      e7:	75 f7                	jne    e0 <main+0xe0>
+    if(total != want * NPASS)
+      e9:	c1 e0 02             	shl    $0x2,%eax
+      ec:	3b 05 44 1a 00 00    	cmp    0x1a44,%eax
+      f2:	74 13                	je     107 <main+0x107>
+      printf(2, "threadbench: bad sum with %d threads\n", nthr);
+      f4:	83 ec 04             	sub    $0x4,%esp
+      f7:	51                   	push   %ecx
+      f8:	68 ac 13 00 00       	push   $0x13ac
+      fd:	6a 02                	push   $0x2
+      ff:	e8 1c 08 00 00       	call   920 <printf>
+     104:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d\t%d\t%d\t", nthr, (uint)udiv64(ns, 1000000),
+     107:	89 f8                	mov    %edi,%eax
+     109:	31 db                	xor    %ebx,%ebx
+     10b:	09 f0                	or     %esi,%eax
+     10d:	0f 85 ad 00 00 00    	jne    1c0 <main+0x1c0>
+     113:	83 ec 04             	sub    $0x4,%esp
+     116:	68 40 42 0f 00       	push   $0xf4240
+     11b:	57                   	push   %edi
+     11c:	56                   	push   %esi
+     11d:	e8 2e 05 00 00       	call   650 <udiv64>
+     122:	89 1c 24             	mov    %ebx,(%esp)
+     125:	50                   	push   %eax
+     126:	ff 35 5c 1a 00 00    	push   0x1a5c
+     12c:	68 38 14 00 00       	push   $0x1438
+     131:	6a 01                	push   $0x1
+     133:	e8 e8 07 00 00       	call   920 <printf>
+           ns ? (uint)udiv64((uint64)ARRAYMB * NPASS * 1000000000, ns) : 0);
+
+    counter = 0;
+    ns = run(count);
+     138:	83 c4 20             	add    $0x20,%esp
+     13b:	b8 20 02 00 00       	mov    $0x220,%eax
+    counter = 0;
+     140:	c7 05 40 1a 00 00 00 	movl   $0x0,0x1a40
+     147:	00 00 00 
+    ns = run(count);
+     14a:	e8 b1 01 00 00       	call   300 <run>
+     14f:	89 d7                	mov    %edx,%edi
+    if(counter != nthr * NLOCK)
+     151:	8b 15 5c 1a 00 00    	mov    0x1a5c,%edx
+    ns = run(count);
+     157:	89 c6                	mov    %eax,%esi
+    if(counter != nthr * NLOCK)
+     159:	a1 40 1a 00 00       	mov    0x1a40,%eax
+     15e:	69 ca 10 27 00 00    	imul   $0x2710,%edx,%ecx
+     164:	39 c1                	cmp    %eax,%ecx
+     166:	74 1d                	je     185 <main+0x185>
+      printf(2, "threadbench: lost updates with %d threads\n", nthr);
+     168:	83 ec 04             	sub    $0x4,%esp
+     16b:	52                   	push   %edx
+     16c:	68 d4 13 00 00       	push   $0x13d4
+     171:	6a 02                	push   $0x2
+     173:	e8 a8 07 00 00       	call   920 <printf>
+    printf(1, "%d\n", (uint)udiv64(ns, nthr * NLOCK));
+     178:	83 c4 10             	add    $0x10,%esp
+     17b:	69 05 5c 1a 00 00 10 	imul   $0x2710,0x1a5c,%eax
+     182:	27 00 00 
+     185:	83 ec 04             	sub    $0x4,%esp
+     188:	50                   	push   %eax
+     189:	57                   	push   %edi
+     18a:	56                   	push   %esi
+     18b:	e8 c0 04 00 00       	call   650 <udiv64>
+     190:	83 c4 0c             	add    $0xc,%esp
+     193:	50                   	push   %eax
+     194:	68 42 14 00 00       	push   $0x1442
+     199:	6a 01                	push   $0x1
+     19b:	e8 80 07 00 00       	call   920 <printf>
+  for(nthr = 1; nthr <= max; nthr *= 2){
+     1a0:	a1 5c 1a 00 00       	mov    0x1a5c,%eax
+     1a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     1a8:	83 c4 10             	add    $0x10,%esp
+     1ab:	01 c0                	add    %eax,%eax
+     1ad:	a3 5c 1a 00 00       	mov    %eax,0x1a5c
+     1b2:	39 f8                	cmp    %edi,%eax
+     1b4:	0f 8e ee fe ff ff    	jle    a8 <main+0xa8>
+  }
+  exit();
+     1ba:	e8 59 05 00 00       	call   718 <exit>
+     1bf:	90                   	nop
+           ns ? (uint)udiv64((uint64)ARRAYMB * NPASS * 1000000000, ns) : 0);
+     1c0:	83 ec 04             	sub    $0x4,%esp
+     1c3:	56                   	push   %esi
+     1c4:	6a 07                	push   $0x7
+     1c6:	68 00 40 59 73       	push   $0x73594000
+     1cb:	e8 80 04 00 00       	call   650 <udiv64>
+     1d0:	83 c4 10             	add    $0x10,%esp
+     1d3:	89 c3                	mov    %eax,%ebx
+     1d5:	e9 39 ff ff ff       	jmp    113 <main+0x113>
+    max = atoi(argv[1]);
+     1da:	83 ec 0c             	sub    $0xc,%esp
+     1dd:	ff 70 04             	push   0x4(%eax)
+     1e0:	e8 fb 03 00 00       	call   5e0 <atoi>
+  if(max < 1 || max > MAXTHR){
+     1e5:	83 c4 10             	add    $0x10,%esp
+    max = atoi(argv[1]);
+     1e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(max < 1 || max > MAXTHR){
+     1eb:	83 e8 01             	sub    $0x1,%eax
+     1ee:	83 f8 0f             	cmp    $0xf,%eax
+     1f1:	0f 86 30 fe ff ff    	jbe    27 <main+0x27>
+    printf(2, "usage: threadbench [maxthreads <= %d]\n", MAXTHR);
+     1f7:	56                   	push   %esi
+     1f8:	6a 10                	push   $0x10
+     1fa:	68 84 13 00 00       	push   $0x1384
+     1ff:	6a 02                	push   $0x2
+     201:	e8 1a 07 00 00       	call   920 <printf>
+    exit();
+     206:	e8 0d 05 00 00       	call   718 <exit>
+    printf(2, "threadbench: out of memory\n");
+     20b:	53                   	push   %ebx
+     20c:	53                   	push   %ebx
+     20d:	68 ff 13 00 00       	push   $0x13ff
+     212:	6a 02                	push   $0x2
+     214:	e8 07 07 00 00       	call   920 <printf>
+    exit();
+     219:	e8 fa 04 00 00       	call   718 <exit>
+     21e:	66 90                	xchg   %ax,%ax
+
+00000220 <count>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+  barrier_wait(&start);
+     224:	bb 10 27 00 00       	mov    $0x2710,%ebx
+{
+     229:	83 ec 10             	sub    $0x10,%esp
+  barrier_wait(&start);
+     22c:	68 4c 1a 00 00       	push   $0x1a4c
+     231:	e8 3a 10 00 00       	call   1270 <barrier_wait>
+     236:	83 c4 10             	add    $0x10,%esp
+     239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    mutex_lock(&lk);
+     240:	83 ec 0c             	sub    $0xc,%esp
+     243:	68 48 1a 00 00       	push   $0x1a48
+     248:	e8 73 0f 00 00       	call   11c0 <mutex_lock>
+    mutex_unlock(&lk);
+     24d:	c7 04 24 48 1a 00 00 	movl   $0x1a48,(%esp)
+    counter++;
+     254:	83 05 40 1a 00 00 01 	addl   $0x1,0x1a40
+    mutex_unlock(&lk);
+     25b:	e8 b0 0f 00 00       	call   1210 <mutex_unlock>
+  for(i = 0; i < NLOCK; i++){
+     260:	83 c4 10             	add    $0x10,%esp
+     263:	83 eb 01             	sub    $0x1,%ebx
+     266:	75 d8                	jne    240 <count+0x20>
+  exit();
+     268:	e8 ab 04 00 00       	call   718 <exit>
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000270 <sum>:
+{
+     270:	55                   	push   %ebp
+  lo = nword / nthr * (uint)arg;
+     271:	31 d2                	xor    %edx,%edx
+{
+     273:	89 e5                	mov    %esp,%ebp
+     275:	57                   	push   %edi
+     276:	56                   	push   %esi
+     277:	53                   	push   %ebx
+  s = 0;
+     278:	31 db                	xor    %ebx,%ebx
+{
+     27a:	83 ec 28             	sub    $0x28,%esp
+  lo = nword / nthr * (uint)arg;
+     27d:	a1 60 1a 00 00       	mov    0x1a60,%eax
+     282:	8b 7d 08             	mov    0x8(%ebp),%edi
+  barrier_wait(&start);
+     285:	68 4c 1a 00 00       	push   $0x1a4c
+  lo = nword / nthr * (uint)arg;
+     28a:	f7 35 5c 1a 00 00    	divl   0x1a5c
+     290:	0f af f8             	imul   %eax,%edi
+  hi = lo + nword / nthr;
+     293:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  barrier_wait(&start);
+     296:	e8 d5 0f 00 00       	call   1270 <barrier_wait>
+      s += array[i];
+     29b:	a1 64 1a 00 00       	mov    0x1a64,%eax
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	8d 0c b8             	lea    (%eax,%edi,4),%ecx
+     2a6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     2a9:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+     2ac:	b8 04 00 00 00       	mov    $0x4,%eax
+    for(i = lo; i < hi; i++)
+     2b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     2b4:	39 f7                	cmp    %esi,%edi
+     2b6:	73 11                	jae    2c9 <sum+0x59>
+     2b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bf:	90                   	nop
+      s += array[i];
+     2c0:	03 1a                	add    (%edx),%ebx
+    for(i = lo; i < hi; i++)
+     2c2:	83 c2 04             	add    $0x4,%edx
+     2c5:	39 ca                	cmp    %ecx,%edx
+     2c7:	75 f7                	jne    2c0 <sum+0x50>
+  for(k = 0; k < NPASS; k++)
+     2c9:	83 e8 01             	sub    $0x1,%eax
+     2cc:	75 e3                	jne    2b1 <sum+0x41>
+  mutex_lock(&lk);
+     2ce:	83 ec 0c             	sub    $0xc,%esp
+     2d1:	68 48 1a 00 00       	push   $0x1a48
+     2d6:	e8 e5 0e 00 00       	call   11c0 <mutex_lock>
+  mutex_unlock(&lk);
+     2db:	c7 04 24 48 1a 00 00 	movl   $0x1a48,(%esp)
+  total += s;
+     2e2:	01 1d 44 1a 00 00    	add    %ebx,0x1a44
+  mutex_unlock(&lk);
+     2e8:	e8 23 0f 00 00       	call   1210 <mutex_unlock>
+  exit();
+     2ed:	e8 26 04 00 00       	call   718 <exit>
+     2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <run>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	56                   	push   %esi
+     304:	89 c6                	mov    %eax,%esi
+     306:	53                   	push   %ebx
+     307:	83 ec 58             	sub    $0x58,%esp
+  barrier_init(&start, nthr + 1);
+     30a:	a1 5c 1a 00 00       	mov    0x1a5c,%eax
+     30f:	83 c0 01             	add    $0x1,%eax
+     312:	50                   	push   %eax
+     313:	68 4c 1a 00 00       	push   $0x1a4c
+     318:	e8 23 0f 00 00       	call   1240 <barrier_init>
+  for(n = 0; n < nthr; n++)
+     31d:	8b 15 5c 1a 00 00    	mov    0x1a5c,%edx
+     323:	83 c4 10             	add    $0x10,%esp
+     326:	85 d2                	test   %edx,%edx
+     328:	0f 8e af 00 00 00    	jle    3dd <run+0xdd>
+     32e:	31 db                	xor    %ebx,%ebx
+     330:	eb 11                	jmp    343 <run+0x43>
+     332:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     338:	83 c3 01             	add    $0x1,%ebx
+     33b:	39 1d 5c 1a 00 00    	cmp    %ebx,0x1a5c
+     341:	7e 7d                	jle    3c0 <run+0xc0>
+    if((tid[n] = thread_create(fn, (void*)n)) < 0)
+     343:	83 ec 08             	sub    $0x8,%esp
+     346:	53                   	push   %ebx
+     347:	56                   	push   %esi
+     348:	e8 23 0c 00 00       	call   f70 <thread_create>
+     34d:	83 c4 10             	add    $0x10,%esp
+     350:	89 44 9d b8          	mov    %eax,-0x48(%ebp,%ebx,4)
+     354:	85 c0                	test   %eax,%eax
+     356:	79 e0                	jns    338 <run+0x38>
+  if(n < nthr){
+     358:	39 1d 5c 1a 00 00    	cmp    %ebx,0x1a5c
+     35e:	0f 8f 96 00 00 00    	jg     3fa <run+0xfa>
+  barrier_wait(&start);
+     364:	83 ec 0c             	sub    $0xc,%esp
+     367:	68 4c 1a 00 00       	push   $0x1a4c
+     36c:	e8 ff 0e 00 00       	call   1270 <barrier_wait>
+  t0 = cycles();
+     371:	e8 fa 02 00 00       	call   670 <cycles>
+  for(i = 0; i < n; i++)
+     376:	83 c4 10             	add    $0x10,%esp
+  t0 = cycles();
+     379:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     37c:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  for(i = 0; i < n; i++)
+     37f:	85 db                	test   %ebx,%ebx
+     381:	74 21                	je     3a4 <run+0xa4>
+     383:	8d 75 b8             	lea    -0x48(%ebp),%esi
+     386:	8d 1c 9e             	lea    (%esi,%ebx,4),%ebx
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    thread_join(tid[i]);
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	ff 36                	push   (%esi)
+  for(i = 0; i < n; i++)
+     395:	83 c6 04             	add    $0x4,%esi
+    thread_join(tid[i]);
+     398:	e8 23 0d 00 00       	call   10c0 <thread_join>
+  for(i = 0; i < n; i++)
+     39d:	83 c4 10             	add    $0x10,%esp
+     3a0:	39 de                	cmp    %ebx,%esi
+     3a2:	75 ec                	jne    390 <run+0x90>
+  return cyc2ns(cycles() - t0);
+     3a4:	e8 c7 02 00 00       	call   670 <cycles>
+     3a9:	83 ec 08             	sub    $0x8,%esp
+     3ac:	2b 45 b0             	sub    -0x50(%ebp),%eax
+     3af:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+     3b2:	52                   	push   %edx
+     3b3:	50                   	push   %eax
+     3b4:	e8 c7 02 00 00       	call   680 <cyc2ns>
+}
+     3b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     3bc:	5b                   	pop    %ebx
+     3bd:	5e                   	pop    %esi
+     3be:	5d                   	pop    %ebp
+     3bf:	c3                   	ret
+  barrier_wait(&start);
+     3c0:	83 ec 0c             	sub    $0xc,%esp
+     3c3:	68 4c 1a 00 00       	push   $0x1a4c
+     3c8:	e8 a3 0e 00 00       	call   1270 <barrier_wait>
+  t0 = cycles();
+     3cd:	e8 9e 02 00 00       	call   670 <cycles>
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     3d8:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  for(i = 0; i < n; i++)
+     3db:	eb a6                	jmp    383 <run+0x83>
+  barrier_wait(&start);
+     3dd:	83 ec 0c             	sub    $0xc,%esp
+     3e0:	68 4c 1a 00 00       	push   $0x1a4c
+     3e5:	e8 86 0e 00 00       	call   1270 <barrier_wait>
+  t0 = cycles();
+     3ea:	e8 81 02 00 00       	call   670 <cycles>
+     3ef:	83 c4 10             	add    $0x10,%esp
+     3f2:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     3f5:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  for(i = 0; i < n; i++)
+     3f8:	eb aa                	jmp    3a4 <run+0xa4>
+    printf(2, "threadbench: thread_create failed\n");
+     3fa:	50                   	push   %eax
+     3fb:	50                   	push   %eax
+     3fc:	68 60 13 00 00       	push   $0x1360
+     401:	6a 02                	push   $0x2
+     403:	e8 18 05 00 00       	call   920 <printf>
+    exit();
+     408:	e8 0b 03 00 00       	call   718 <exit>
+     40d:	66 90                	xchg   %ax,%ax
+     40f:	90                   	nop
+
+00000410 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     410:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     411:	31 c0                	xor    %eax,%eax
+{
+     413:	89 e5                	mov    %esp,%ebp
+     415:	53                   	push   %ebx
+     416:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     419:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     420:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     424:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     427:	83 c0 01             	add    $0x1,%eax
+     42a:	84 d2                	test   %dl,%dl
+     42c:	75 f2                	jne    420 <strcpy+0x10>
+    ;
+  return os;
+}
+     42e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     431:	89 c8                	mov    %ecx,%eax
+     433:	c9                   	leave
+     434:	c3                   	ret
+     435:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	53                   	push   %ebx
+     444:	8b 55 08             	mov    0x8(%ebp),%edx
+     447:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     44a:	0f b6 02             	movzbl (%edx),%eax
+     44d:	84 c0                	test   %al,%al
+     44f:	75 17                	jne    468 <strcmp+0x28>
+     451:	eb 3a                	jmp    48d <strcmp+0x4d>
+     453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     457:	90                   	nop
+     458:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     45c:	83 c2 01             	add    $0x1,%edx
+     45f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     462:	84 c0                	test   %al,%al
+     464:	74 1a                	je     480 <strcmp+0x40>
+    p++, q++;
+     466:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     468:	0f b6 19             	movzbl (%ecx),%ebx
+     46b:	38 c3                	cmp    %al,%bl
+     46d:	74 e9                	je     458 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     46f:	29 d8                	sub    %ebx,%eax
+}
+     471:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     474:	c9                   	leave
+     475:	c3                   	ret
+     476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     480:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     484:	31 c0                	xor    %eax,%eax
+     486:	29 d8                	sub    %ebx,%eax
+}
+     488:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     48b:	c9                   	leave
+     48c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     48d:	0f b6 19             	movzbl (%ecx),%ebx
+     490:	31 c0                	xor    %eax,%eax
+     492:	eb db                	jmp    46f <strcmp+0x2f>
+     494:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     49f:	90                   	nop
+
+000004a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4a6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4a9:	74 15                	je     4c0 <strlen+0x20>
+     4ab:	31 c0                	xor    %eax,%eax
+     4ad:	8d 76 00             	lea    0x0(%esi),%esi
+     4b0:	83 c0 01             	add    $0x1,%eax
+     4b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4b7:	89 c1                	mov    %eax,%ecx
+     4b9:	75 f5                	jne    4b0 <strlen+0x10>
+    ;
+  return n;
+}
+     4bb:	89 c8                	mov    %ecx,%eax
+     4bd:	5d                   	pop    %ebp
+     4be:	c3                   	ret
+     4bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4c0:	31 c9                	xor    %ecx,%ecx
+}
+     4c2:	5d                   	pop    %ebp
+     4c3:	89 c8                	mov    %ecx,%eax
+     4c5:	c3                   	ret
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	57                   	push   %edi
+     4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     4d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     4da:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4dd:	89 d7                	mov    %edx,%edi
+     4df:	fc                   	cld
+     4e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     4e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     4e5:	89 d0                	mov    %edx,%eax
+     4e7:	c9                   	leave
+     4e8:	c3                   	ret
+     4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4fa:	0f b6 10             	movzbl (%eax),%edx
+     4fd:	84 d2                	test   %dl,%dl
+     4ff:	75 12                	jne    513 <strchr+0x23>
+     501:	eb 1d                	jmp    520 <strchr+0x30>
+     503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     507:	90                   	nop
+     508:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     50c:	83 c0 01             	add    $0x1,%eax
+     50f:	84 d2                	test   %dl,%dl
+     511:	74 0d                	je     520 <strchr+0x30>
+    if(*s == c)
+     513:	38 d1                	cmp    %dl,%cl
+     515:	75 f1                	jne    508 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     517:	5d                   	pop    %ebp
+     518:	c3                   	ret
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     520:	31 c0                	xor    %eax,%eax
+}
+     522:	5d                   	pop    %ebp
+     523:	c3                   	ret
+     524:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+
+00000530 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	57                   	push   %edi
+     534:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     535:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     538:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     539:	31 db                	xor    %ebx,%ebx
+{
+     53b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     53e:	eb 27                	jmp    567 <gets+0x37>
+    cc = read(0, &c, 1);
+     540:	83 ec 04             	sub    $0x4,%esp
+     543:	6a 01                	push   $0x1
+     545:	56                   	push   %esi
+     546:	6a 00                	push   $0x0
+     548:	e8 e3 01 00 00       	call   730 <read>
+    if(cc < 1)
+     54d:	83 c4 10             	add    $0x10,%esp
+     550:	85 c0                	test   %eax,%eax
+     552:	7e 1d                	jle    571 <gets+0x41>
+      break;
+    buf[i++] = c;
+     554:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     558:	8b 55 08             	mov    0x8(%ebp),%edx
+     55b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     55f:	3c 0a                	cmp    $0xa,%al
+     561:	74 10                	je     573 <gets+0x43>
+     563:	3c 0d                	cmp    $0xd,%al
+     565:	74 0c                	je     573 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     567:	89 df                	mov    %ebx,%edi
+     569:	83 c3 01             	add    $0x1,%ebx
+     56c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     56f:	7c cf                	jl     540 <gets+0x10>
+     571:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     573:	8b 45 08             	mov    0x8(%ebp),%eax
+     576:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     57a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     57d:	5b                   	pop    %ebx
+     57e:	5e                   	pop    %esi
+     57f:	5f                   	pop    %edi
+     580:	5d                   	pop    %ebp
+     581:	c3                   	ret
+     582:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	56                   	push   %esi
+     594:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     595:	83 ec 08             	sub    $0x8,%esp
+     598:	6a 00                	push   $0x0
+     59a:	ff 75 08             	push   0x8(%ebp)
+     59d:	e8 b6 01 00 00       	call   758 <open>
+  if(fd < 0)
+     5a2:	83 c4 10             	add    $0x10,%esp
+     5a5:	85 c0                	test   %eax,%eax
+     5a7:	78 27                	js     5d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     5a9:	83 ec 08             	sub    $0x8,%esp
+     5ac:	ff 75 0c             	push   0xc(%ebp)
+     5af:	89 c3                	mov    %eax,%ebx
+     5b1:	50                   	push   %eax
+     5b2:	e8 b9 01 00 00       	call   770 <fstat>
+  close(fd);
+     5b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     5ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+     5bc:	e8 7f 01 00 00       	call   740 <close>
+  return r;
+     5c1:	83 c4 10             	add    $0x10,%esp
+}
+     5c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5c7:	89 f0                	mov    %esi,%eax
+     5c9:	5b                   	pop    %ebx
+     5ca:	5e                   	pop    %esi
+     5cb:	5d                   	pop    %ebp
+     5cc:	c3                   	ret
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     5d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5d5:	eb ed                	jmp    5c4 <stat+0x34>
+     5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	53                   	push   %ebx
+     5e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     5e7:	0f be 02             	movsbl (%edx),%eax
+     5ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     5ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     5f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     5f5:	77 1e                	ja     615 <atoi+0x35>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     600:	83 c2 01             	add    $0x1,%edx
+     603:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     606:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     60a:	0f be 02             	movsbl (%edx),%eax
+     60d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     610:	80 fb 09             	cmp    $0x9,%bl
+     613:	76 eb                	jbe    600 <atoi+0x20>
+  return n;
+}
+     615:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     618:	89 c8                	mov    %ecx,%eax
+     61a:	c9                   	leave
+     61b:	c3                   	ret
+     61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+     625:	8b 45 10             	mov    0x10(%ebp),%eax
+     628:	8b 55 08             	mov    0x8(%ebp),%edx
+     62b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     62e:	85 c0                	test   %eax,%eax
+     630:	7e 13                	jle    645 <memmove+0x25>
+     632:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     634:	89 d7                	mov    %edx,%edi
+     636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     640:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     641:	39 f8                	cmp    %edi,%eax
+     643:	75 fb                	jne    640 <memmove+0x20>
+  return vdst;
+}
+     645:	5e                   	pop    %esi
+     646:	89 d0                	mov    %edx,%eax
+     648:	5f                   	pop    %edi
+     649:	5d                   	pop    %ebp
+     64a:	c3                   	ret
+     64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+
+00000650 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+     650:	55                   	push   %ebp
+     651:	31 d2                	xor    %edx,%edx
+     653:	89 e5                	mov    %esp,%ebp
+     655:	53                   	push   %ebx
+     656:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     659:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+     65c:	f7 f3                	div    %ebx
+     65e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     660:	8b 45 08             	mov    0x8(%ebp),%eax
+     663:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+     665:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+     668:	89 ca                	mov    %ecx,%edx
+}
+     66a:	c9                   	leave
+     66b:	c3                   	ret
+     66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+     670:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+     672:	c3                   	ret
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+     689:	8b 35 68 1a 00 00    	mov    0x1a68,%esi
+{
+     68f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     692:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+     695:	85 f6                	test   %esi,%esi
+     697:	74 2f                	je     6c8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+     699:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+     69e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+     6a4:	f7 e3                	mul    %ebx
+     6a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     6a9:	8d 04 17             	lea    (%edi,%edx,1),%eax
+     6ac:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     6af:	31 d2                	xor    %edx,%edx
+     6b1:	f7 f6                	div    %esi
+     6b3:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     6b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+     6b8:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+     6bb:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+     6bd:	89 da                	mov    %ebx,%edx
+}
+     6bf:	5b                   	pop    %ebx
+     6c0:	5e                   	pop    %esi
+     6c1:	5f                   	pop    %edi
+     6c2:	5d                   	pop    %ebp
+     6c3:	c3                   	ret
+     6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+     6c8:	e8 0b 01 00 00       	call   7d8 <tscfreq>
+     6cd:	a3 68 1a 00 00       	mov    %eax,0x1a68
+     6d2:	89 c6                	mov    %eax,%esi
+     6d4:	eb c3                	jmp    699 <cyc2ns+0x19>
+     6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	53                   	push   %ebx
+     6e4:	83 ec 10             	sub    $0x10,%esp
+     6e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+     6ea:	6a 00                	push   $0x0
+     6ec:	e8 3f 01 00 00       	call   830 <getpriority>
+     6f1:	5a                   	pop    %edx
+     6f2:	59                   	pop    %ecx
+     6f3:	01 d8                	add    %ebx,%eax
+     6f5:	50                   	push   %eax
+     6f6:	6a 00                	push   $0x0
+     6f8:	e8 2b 01 00 00       	call   828 <setpriority>
+  return getpriority(0);
+     6fd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+     704:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+     707:	83 c4 10             	add    $0x10,%esp
+}
+     70a:	c9                   	leave
+  return getpriority(0);
+     70b:	e9 20 01 00 00       	jmp    830 <getpriority>
+
+00000710 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     710:	b8 01 00 00 00       	mov    $0x1,%eax
+     715:	cd 40                	int    $0x40
+     717:	c3                   	ret
+
+00000718 <exit>:
+SYSCALL(exit)
+     718:	b8 02 00 00 00       	mov    $0x2,%eax
+     71d:	cd 40                	int    $0x40
+     71f:	c3                   	ret
+
+00000720 <wait>:
+SYSCALL(wait)
+     720:	b8 03 00 00 00       	mov    $0x3,%eax
+     725:	cd 40                	int    $0x40
+     727:	c3                   	ret
+
+00000728 <pipe>:
+SYSCALL(pipe)
+     728:	b8 04 00 00 00       	mov    $0x4,%eax
+     72d:	cd 40                	int    $0x40
+     72f:	c3                   	ret
+
+00000730 <read>:
+SYSCALL(read)
+     730:	b8 05 00 00 00       	mov    $0x5,%eax
+     735:	cd 40                	int    $0x40
+     737:	c3                   	ret
+
+00000738 <write>:
+SYSCALL(write)
+     738:	b8 10 00 00 00       	mov    $0x10,%eax
+     73d:	cd 40                	int    $0x40
+     73f:	c3                   	ret
+
+00000740 <close>:
+SYSCALL(close)
+     740:	b8 15 00 00 00       	mov    $0x15,%eax
+     745:	cd 40                	int    $0x40
+     747:	c3                   	ret
+
+00000748 <kill>:
+SYSCALL(kill)
+     748:	b8 06 00 00 00       	mov    $0x6,%eax
+     74d:	cd 40                	int    $0x40
+     74f:	c3                   	ret
+
+00000750 <exec>:
+SYSCALL(exec)
+     750:	b8 07 00 00 00       	mov    $0x7,%eax
+     755:	cd 40                	int    $0x40
+     757:	c3                   	ret
+
+00000758 <open>:
+SYSCALL(open)
+     758:	b8 0f 00 00 00       	mov    $0xf,%eax
+     75d:	cd 40                	int    $0x40
+     75f:	c3                   	ret
+
+00000760 <mknod>:
+SYSCALL(mknod)
+     760:	b8 11 00 00 00       	mov    $0x11,%eax
+     765:	cd 40                	int    $0x40
+     767:	c3                   	ret
+
+00000768 <unlink>:
+SYSCALL(unlink)
+     768:	b8 12 00 00 00       	mov    $0x12,%eax
+     76d:	cd 40                	int    $0x40
+     76f:	c3                   	ret
+
+00000770 <fstat>:
+SYSCALL(fstat)
+     770:	b8 08 00 00 00       	mov    $0x8,%eax
+     775:	cd 40                	int    $0x40
+     777:	c3                   	ret
+
+00000778 <link>:
+SYSCALL(link)
+     778:	b8 13 00 00 00       	mov    $0x13,%eax
+     77d:	cd 40                	int    $0x40
+     77f:	c3                   	ret
+
+00000780 <mkdir>:
+SYSCALL(mkdir)
+     780:	b8 14 00 00 00       	mov    $0x14,%eax
+     785:	cd 40                	int    $0x40
+     787:	c3                   	ret
+
+00000788 <chdir>:
+SYSCALL(chdir)
+     788:	b8 09 00 00 00       	mov    $0x9,%eax
+     78d:	cd 40                	int    $0x40
+     78f:	c3                   	ret
+
+00000790 <dup>:
+SYSCALL(dup)
+     790:	b8 0a 00 00 00       	mov    $0xa,%eax
+     795:	cd 40                	int    $0x40
+     797:	c3                   	ret
+
+00000798 <getpid>:
+SYSCALL(getpid)
+     798:	b8 0b 00 00 00       	mov    $0xb,%eax
+     79d:	cd 40                	int    $0x40
+     79f:	c3                   	ret
+
+000007a0 <sbrk>:
+SYSCALL(sbrk)
+     7a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7a5:	cd 40                	int    $0x40
+     7a7:	c3                   	ret
+
+000007a8 <sleep>:
+SYSCALL(sleep)
+     7a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7ad:	cd 40                	int    $0x40
+     7af:	c3                   	ret
+
+000007b0 <uptime>:
+SYSCALL(uptime)
+     7b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7b5:	cd 40                	int    $0x40
+     7b7:	c3                   	ret
+
+000007b8 <promote>:
+
+SYSCALL(promote)
+     7b8:	b8 18 00 00 00       	mov    $0x18,%eax
+     7bd:	cd 40                	int    $0x40
+     7bf:	c3                   	ret
+
+000007c0 <demote>:
+SYSCALL(demote)
+     7c0:	b8 19 00 00 00       	mov    $0x19,%eax
+     7c5:	cd 40                	int    $0x40
+     7c7:	c3                   	ret
+
+000007c8 <huge_page_count>:
+SYSCALL(huge_page_count)
+     7c8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7cd:	cd 40                	int    $0x40
+     7cf:	c3                   	ret
+
+000007d0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+     7d0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7d5:	cd 40                	int    $0x40
+     7d7:	c3                   	ret
+
+000007d8 <tscfreq>:
+SYSCALL(tscfreq)
+     7d8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7dd:	cd 40                	int    $0x40
+     7df:	c3                   	ret
+
+000007e0 <tracemask>:
+SYSCALL(tracemask)
+     7e0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7e5:	cd 40                	int    $0x40
+     7e7:	c3                   	ret
+
+000007e8 <traceread>:
+SYSCALL(traceread)
+     7e8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7ed:	cd 40                	int    $0x40
+     7ef:	c3                   	ret
+
+000007f0 <profile>:
+SYSCALL(profile)
+     7f0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7f5:	cd 40                	int    $0x40
+     7f7:	c3                   	ret
+
+000007f8 <profread>:
+SYSCALL(profread)
+     7f8:	b8 20 00 00 00       	mov    $0x20,%eax
+     7fd:	cd 40                	int    $0x40
+     7ff:	c3                   	ret
+
+00000800 <lockstat>:
+SYSCALL(lockstat)
+     800:	b8 21 00 00 00       	mov    $0x21,%eax
+     805:	cd 40                	int    $0x40
+     807:	c3                   	ret
+
+00000808 <lockstatreset>:
+SYSCALL(lockstatreset)
+     808:	b8 22 00 00 00       	mov    $0x22,%eax
+     80d:	cd 40                	int    $0x40
+     80f:	c3                   	ret
+
+00000810 <sysstat>:
+SYSCALL(sysstat)
+     810:	b8 23 00 00 00       	mov    $0x23,%eax
+     815:	cd 40                	int    $0x40
+     817:	c3                   	ret
+
+00000818 <kbench>:
+SYSCALL(kbench)
+     818:	b8 24 00 00 00       	mov    $0x24,%eax
+     81d:	cd 40                	int    $0x40
+     81f:	c3                   	ret
+
+00000820 <yield>:
+SYSCALL(yield)
+     820:	b8 25 00 00 00       	mov    $0x25,%eax
+     825:	cd 40                	int    $0x40
+     827:	c3                   	ret
+
+00000828 <setpriority>:
+SYSCALL(setpriority)
+     828:	b8 26 00 00 00       	mov    $0x26,%eax
+     82d:	cd 40                	int    $0x40
+     82f:	c3                   	ret
+
+00000830 <getpriority>:
+SYSCALL(getpriority)
+     830:	b8 27 00 00 00       	mov    $0x27,%eax
+     835:	cd 40                	int    $0x40
+     837:	c3                   	ret
+
+00000838 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     838:	b8 28 00 00 00       	mov    $0x28,%eax
+     83d:	cd 40                	int    $0x40
+     83f:	c3                   	ret
+
+00000840 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     840:	b8 29 00 00 00       	mov    $0x29,%eax
+     845:	cd 40                	int    $0x40
+     847:	c3                   	ret
+
+00000848 <clone>:
+SYSCALL(clone)
+     848:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     84d:	cd 40                	int    $0x40
+     84f:	c3                   	ret
+
+00000850 <join>:
+SYSCALL(join)
+     850:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     855:	cd 40                	int    $0x40
+     857:	c3                   	ret
+
+00000858 <futex_wait>:
+SYSCALL(futex_wait)
+     858:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     85d:	cd 40                	int    $0x40
+     85f:	c3                   	ret
+
+00000860 <futex_wake>:
+SYSCALL(futex_wake)
+     860:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     865:	cd 40                	int    $0x40
+     867:	c3                   	ret
+
+00000868 <spawn>:
+SYSCALL(spawn)
+     868:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     86d:	cd 40                	int    $0x40
+     86f:	c3                   	ret
+
+00000870 <diskstat>:
+SYSCALL(diskstat)
+     870:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     875:	cd 40                	int    $0x40
+     877:	c3                   	ret
+     878:	66 90                	xchg   %ax,%ax
+     87a:	66 90                	xchg   %ax,%ax
+     87c:	66 90                	xchg   %ax,%ax
+     87e:	66 90                	xchg   %ax,%ax
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	57                   	push   %edi
+     884:	56                   	push   %esi
+     885:	53                   	push   %ebx
+     886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     888:	89 d1                	mov    %edx,%ecx
+{
+     88a:	83 ec 3c             	sub    $0x3c,%esp
+     88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     890:	85 d2                	test   %edx,%edx
+     892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+     898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+     89e:	f7 d9                	neg    %ecx
+    neg = 1;
+     8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     8a8:	31 f6                	xor    %esi,%esi
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     8b0:	89 c8                	mov    %ecx,%eax
+     8b2:	31 d2                	xor    %edx,%edx
+     8b4:	89 f7                	mov    %esi,%edi
+     8b6:	f7 f3                	div    %ebx
+     8b8:	8d 76 01             	lea    0x1(%esi),%esi
+     8bb:	0f b6 92 a8 14 00 00 	movzbl 0x14a8(%edx),%edx
+     8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     8c6:	89 ca                	mov    %ecx,%edx
+     8c8:	89 c1                	mov    %eax,%ecx
+     8ca:	39 da                	cmp    %ebx,%edx
+     8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+     8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     8d1:	85 c0                	test   %eax,%eax
+     8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+     8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     8da:	89 f7                	mov    %esi,%edi
+     8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     8e2:	01 df                	add    %ebx,%edi
+     8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     8eb:	83 ec 04             	sub    $0x4,%esp
+     8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+     8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     8f4:	6a 01                	push   $0x1
+     8f6:	50                   	push   %eax
+     8f7:	56                   	push   %esi
+     8f8:	e8 3b fe ff ff       	call   738 <write>
+  while(--i >= 0)
+     8fd:	89 f8                	mov    %edi,%eax
+     8ff:	83 c4 10             	add    $0x10,%esp
+     902:	83 ef 01             	sub    $0x1,%edi
+     905:	39 d8                	cmp    %ebx,%eax
+     907:	75 df                	jne    8e8 <printint+0x68>
+}
+     909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     90c:	5b                   	pop    %ebx
+     90d:	5e                   	pop    %esi
+     90e:	5f                   	pop    %edi
+     90f:	5d                   	pop    %ebp
+     910:	c3                   	ret
+     911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     918:	31 c0                	xor    %eax,%eax
+     91a:	eb 89                	jmp    8a5 <printint+0x25>
+     91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	57                   	push   %edi
+     924:	56                   	push   %esi
+     925:	53                   	push   %ebx
+     926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     92f:	0f b6 1e             	movzbl (%esi),%ebx
+     932:	83 c6 01             	add    $0x1,%esi
+     935:	84 db                	test   %bl,%bl
+     937:	74 67                	je     9a0 <printf+0x80>
+     939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     93c:	31 d2                	xor    %edx,%edx
+     93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     941:	eb 34                	jmp    977 <printf+0x57>
+     943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     947:	90                   	nop
+     948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     950:	83 f8 25             	cmp    $0x25,%eax
+     953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+     955:	83 ec 04             	sub    $0x4,%esp
+     958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     95e:	6a 01                	push   $0x1
+     960:	50                   	push   %eax
+     961:	57                   	push   %edi
+     962:	e8 d1 fd ff ff       	call   738 <write>
+     967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     96d:	0f b6 1e             	movzbl (%esi),%ebx
+     970:	83 c6 01             	add    $0x1,%esi
+     973:	84 db                	test   %bl,%bl
+     975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     97a:	85 d2                	test   %edx,%edx
+     97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+     97e:	83 fa 25             	cmp    $0x25,%edx
+     981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+     983:	83 f8 25             	cmp    $0x25,%eax
+     986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+     98c:	83 e8 63             	sub    $0x63,%eax
+     98f:	83 f8 15             	cmp    $0x15,%eax
+     992:	77 1c                	ja     9b0 <printf+0x90>
+     994:	ff 24 85 50 14 00 00 	jmp    *0x1450(,%eax,4)
+     99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9a3:	5b                   	pop    %ebx
+     9a4:	5e                   	pop    %esi
+     9a5:	5f                   	pop    %edi
+     9a6:	5d                   	pop    %ebp
+     9a7:	c3                   	ret
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+  write(fd, &c, 1);
+     9b0:	83 ec 04             	sub    $0x4,%esp
+     9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     9ba:	6a 01                	push   $0x1
+     9bc:	52                   	push   %edx
+     9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     9c0:	57                   	push   %edi
+     9c1:	e8 72 fd ff ff       	call   738 <write>
+     9c6:	83 c4 0c             	add    $0xc,%esp
+     9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     9cc:	6a 01                	push   $0x1
+     9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     9d1:	52                   	push   %edx
+     9d2:	57                   	push   %edi
+     9d3:	e8 60 fd ff ff       	call   738 <write>
+        putc(fd, c);
+     9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9db:	31 d2                	xor    %edx,%edx
+     9dd:	eb 8e                	jmp    96d <printf+0x4d>
+     9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     9e3:	83 ec 0c             	sub    $0xc,%esp
+     9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     9eb:	8b 13                	mov    (%ebx),%edx
+     9ed:	6a 00                	push   $0x0
+     9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+     9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+     9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9ff:	31 d2                	xor    %edx,%edx
+     a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+     a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     a15:	83 c0 04             	add    $0x4,%eax
+     a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     a1b:	85 db                	test   %ebx,%ebx
+     a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+     a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     a28:	84 c0                	test   %al,%al
+     a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+     a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     a36:	89 de                	mov    %ebx,%esi
+     a38:	89 d3                	mov    %edx,%ebx
+     a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     a40:	83 ec 04             	sub    $0x4,%esp
+     a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     a49:	6a 01                	push   $0x1
+     a4b:	53                   	push   %ebx
+     a4c:	57                   	push   %edi
+     a4d:	e8 e6 fc ff ff       	call   738 <write>
+        while(*s != 0){
+     a52:	0f b6 06             	movzbl (%esi),%eax
+     a55:	83 c4 10             	add    $0x10,%esp
+     a58:	84 c0                	test   %al,%al
+     a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+     a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     a5f:	31 d2                	xor    %edx,%edx
+     a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+     a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a73:	83 ec 0c             	sub    $0xc,%esp
+     a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a7b:	8b 13                	mov    (%ebx),%edx
+     a7d:	6a 01                	push   $0x1
+     a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+     a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     a8b:	83 ec 04             	sub    $0x4,%esp
+     a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     a99:	6a 01                	push   $0x1
+     a9b:	52                   	push   %edx
+     a9c:	57                   	push   %edi
+     a9d:	e8 96 fc ff ff       	call   738 <write>
+        ap++;
+     aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aa8:	31 d2                	xor    %edx,%edx
+     aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+     aaf:	90                   	nop
+  write(fd, &c, 1);
+     ab0:	83 ec 04             	sub    $0x4,%esp
+     ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ab9:	6a 01                	push   $0x1
+     abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+     ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     ac5:	bb 46 14 00 00       	mov    $0x1446,%ebx
+     aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+     acf:	90                   	nop
+
+00000ad0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ad0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ad1:	a1 6c 1a 00 00       	mov    0x1a6c,%eax
+{
+     ad6:	89 e5                	mov    %esp,%ebp
+     ad8:	57                   	push   %edi
+     ad9:	56                   	push   %esi
+     ada:	53                   	push   %ebx
+     adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     ade:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ae8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     aea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     aec:	39 ca                	cmp    %ecx,%edx
+     aee:	73 30                	jae    b20 <free+0x50>
+     af0:	39 c1                	cmp    %eax,%ecx
+     af2:	72 04                	jb     af8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     af4:	39 c2                	cmp    %eax,%edx
+     af6:	72 f0                	jb     ae8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     af8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     afb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     afe:	39 f8                	cmp    %edi,%eax
+     b00:	74 2e                	je     b30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     b02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     b05:	8b 42 04             	mov    0x4(%edx),%eax
+     b08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     b0b:	39 f1                	cmp    %esi,%ecx
+     b0d:	74 38                	je     b47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     b0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     b11:	5b                   	pop    %ebx
+  freep = p;
+     b12:	89 15 6c 1a 00 00    	mov    %edx,0x1a6c
+}
+     b18:	5e                   	pop    %esi
+     b19:	5f                   	pop    %edi
+     b1a:	5d                   	pop    %ebp
+     b1b:	c3                   	ret
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     b20:	39 c1                	cmp    %eax,%ecx
+     b22:	72 d0                	jb     af4 <free+0x24>
+     b24:	eb c2                	jmp    ae8 <free+0x18>
+     b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     b30:	03 70 04             	add    0x4(%eax),%esi
+     b33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     b36:	8b 02                	mov    (%edx),%eax
+     b38:	8b 00                	mov    (%eax),%eax
+     b3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     b3d:	8b 42 04             	mov    0x4(%edx),%eax
+     b40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     b43:	39 f1                	cmp    %esi,%ecx
+     b45:	75 c8                	jne    b0f <free+0x3f>
+    p->s.size += bp->s.size;
+     b47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     b4a:	89 15 6c 1a 00 00    	mov    %edx,0x1a6c
+    p->s.size += bp->s.size;
+     b50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     b53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     b56:	89 0a                	mov    %ecx,(%edx)
+}
+     b58:	5b                   	pop    %ebx
+     b59:	5e                   	pop    %esi
+     b5a:	5f                   	pop    %edi
+     b5b:	5d                   	pop    %ebp
+     b5c:	c3                   	ret
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     b6c:	8b 15 6c 1a 00 00    	mov    0x1a6c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     b72:	8d 78 07             	lea    0x7(%eax),%edi
+     b75:	c1 ef 03             	shr    $0x3,%edi
+     b78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     b7b:	85 d2                	test   %edx,%edx
+     b7d:	0f 84 8d 00 00 00    	je     c10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     b83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     b85:	8b 48 04             	mov    0x4(%eax),%ecx
+     b88:	39 f9                	cmp    %edi,%ecx
+     b8a:	73 64                	jae    bf0 <malloc+0x90>
+  if(nu < 4096)
+     b8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     b91:	39 df                	cmp    %ebx,%edi
+     b93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     b96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     b9d:	eb 0a                	jmp    ba9 <malloc+0x49>
+     b9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ba0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     ba2:	8b 48 04             	mov    0x4(%eax),%ecx
+     ba5:	39 f9                	cmp    %edi,%ecx
+     ba7:	73 47                	jae    bf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     ba9:	89 c2                	mov    %eax,%edx
+     bab:	39 05 6c 1a 00 00    	cmp    %eax,0x1a6c
+     bb1:	75 ed                	jne    ba0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     bb3:	83 ec 0c             	sub    $0xc,%esp
+     bb6:	56                   	push   %esi
+     bb7:	e8 e4 fb ff ff       	call   7a0 <sbrk>
+  if(p == (char*)-1)
+     bbc:	83 c4 10             	add    $0x10,%esp
+     bbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     bc2:	74 1c                	je     be0 <malloc+0x80>
+  hp->s.size = nu;
+     bc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     bc7:	83 ec 0c             	sub    $0xc,%esp
+     bca:	83 c0 08             	add    $0x8,%eax
+     bcd:	50                   	push   %eax
+     bce:	e8 fd fe ff ff       	call   ad0 <free>
+  return freep;
+     bd3:	8b 15 6c 1a 00 00    	mov    0x1a6c,%edx
+      if((p = morecore(nunits)) == 0)
+     bd9:	83 c4 10             	add    $0x10,%esp
+     bdc:	85 d2                	test   %edx,%edx
+     bde:	75 c0                	jne    ba0 <malloc+0x40>
+        return 0;
+  }
+}
+     be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     be3:	31 c0                	xor    %eax,%eax
+}
+     be5:	5b                   	pop    %ebx
+     be6:	5e                   	pop    %esi
+     be7:	5f                   	pop    %edi
+     be8:	5d                   	pop    %ebp
+     be9:	c3                   	ret
+     bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     bf0:	39 cf                	cmp    %ecx,%edi
+     bf2:	74 4c                	je     c40 <malloc+0xe0>
+        p->s.size -= nunits;
+     bf4:	29 f9                	sub    %edi,%ecx
+     bf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     bf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     bfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     bff:	89 15 6c 1a 00 00    	mov    %edx,0x1a6c
+}
+     c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     c08:	83 c0 08             	add    $0x8,%eax
+}
+     c0b:	5b                   	pop    %ebx
+     c0c:	5e                   	pop    %esi
+     c0d:	5f                   	pop    %edi
+     c0e:	5d                   	pop    %ebp
+     c0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     c10:	c7 05 6c 1a 00 00 70 	movl   $0x1a70,0x1a6c
+     c17:	1a 00 00 
+    base.s.size = 0;
+     c1a:	b8 70 1a 00 00       	mov    $0x1a70,%eax
+    base.s.ptr = freep = prevp = &base;
+     c1f:	c7 05 70 1a 00 00 70 	movl   $0x1a70,0x1a70
+     c26:	1a 00 00 
+    base.s.size = 0;
+     c29:	c7 05 74 1a 00 00 00 	movl   $0x0,0x1a74
+     c30:	00 00 00 
+    if(p->s.size >= nunits){
+     c33:	e9 54 ff ff ff       	jmp    b8c <malloc+0x2c>
+     c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     c40:	8b 08                	mov    (%eax),%ecx
+     c42:	89 0a                	mov    %ecx,(%edx)
+     c44:	eb b9                	jmp    bff <malloc+0x9f>
+     c46:	66 90                	xchg   %ax,%ax
+     c48:	66 90                	xchg   %ax,%ax
+     c4a:	66 90                	xchg   %ax,%ax
+     c4c:	66 90                	xchg   %ax,%ax
+     c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	83 ec 20             	sub    $0x20,%esp
+     c59:	8b 75 0c             	mov    0xc(%ebp),%esi
+     c5c:	8b 7d 10             	mov    0x10(%ebp),%edi
+     c5f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+     c62:	68 e8 03 00 00       	push   $0x3e8
+     c67:	57                   	push   %edi
+     c68:	56                   	push   %esi
+     c69:	e8 e2 f9 ff ff       	call   650 <udiv64>
+     c6e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+     c70:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+     c73:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+     c79:	29 c1                	sub    %eax,%ecx
+     c7b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+     c7e:	68 e8 03 00 00       	push   $0x3e8
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	e8 c6 f9 ff ff       	call   650 <udiv64>
+     c8a:	83 c4 0c             	add    $0xc,%esp
+     c8d:	50                   	push   %eax
+     c8e:	68 b9 14 00 00       	push   $0x14b9
+     c93:	53                   	push   %ebx
+     c94:	e8 87 fc ff ff       	call   920 <printf>
+  if(frac < 100)
+     c99:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	83 f9 63             	cmp    $0x63,%ecx
+     ca2:	76 1c                	jbe    cc0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+     ca4:	89 4d 10             	mov    %ecx,0x10(%ebp)
+     ca7:	c7 45 0c bf 14 00 00 	movl   $0x14bf,0xc(%ebp)
+     cae:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     cb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cb4:	5b                   	pop    %ebx
+     cb5:	5e                   	pop    %esi
+     cb6:	5f                   	pop    %edi
+     cb7:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+     cb8:	e9 63 fc ff ff       	jmp    920 <printf>
+     cbd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+     cc0:	83 ec 08             	sub    $0x8,%esp
+     cc3:	68 bd 14 00 00       	push   $0x14bd
+     cc8:	53                   	push   %ebx
+     cc9:	e8 52 fc ff ff       	call   920 <printf>
+  if(frac < 10)
+     cce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     cd1:	83 c4 10             	add    $0x10,%esp
+     cd4:	83 f9 09             	cmp    $0x9,%ecx
+     cd7:	77 cb                	ja     ca4 <printps+0x54>
+    printf(fd, "0");
+     cd9:	83 ec 08             	sub    $0x8,%esp
+     cdc:	68 bd 14 00 00       	push   $0x14bd
+     ce1:	53                   	push   %ebx
+     ce2:	e8 39 fc ff ff       	call   920 <printf>
+     ce7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     cea:	83 c4 10             	add    $0x10,%esp
+     ced:	eb b5                	jmp    ca4 <printps+0x54>
+     cef:	90                   	nop
+
+00000cf0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+     cfc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+     cff:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+     d02:	83 e8 01             	sub    $0x1,%eax
+     d05:	3d ff 00 00 00       	cmp    $0xff,%eax
+     d0a:	0f 87 37 02 00 00    	ja     f47 <bench+0x257>
+     d10:	8b 7d 14             	mov    0x14(%ebp),%edi
+     d13:	85 ff                	test   %edi,%edi
+     d15:	0f 84 2c 02 00 00    	je     f47 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+     d1b:	83 ec 0c             	sub    $0xc,%esp
+     d1e:	ff 75 10             	push   0x10(%ebp)
+     d21:	ff 55 0c             	call   *0xc(%ebp)
+     d24:	5b                   	pop    %ebx
+     d25:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+     d28:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+     d2a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+     d2d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+     d30:	83 c4 10             	add    $0x10,%esp
+     d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d37:	90                   	nop
+    t0 = cycles();
+     d38:	e8 33 f9 ff ff       	call   670 <cycles>
+    fn(arg);
+     d3d:	83 ec 0c             	sub    $0xc,%esp
+     d40:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+     d43:	89 c6                	mov    %eax,%esi
+     d45:	89 d7                	mov    %edx,%edi
+    fn(arg);
+     d47:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+     d4a:	e8 21 f9 ff ff       	call   670 <cycles>
+     d4f:	29 f0                	sub    %esi,%eax
+     d51:	19 fa                	sbb    %edi,%edx
+     d53:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+     d5a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+     d5d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+     d64:	83 c3 01             	add    $0x1,%ebx
+     d67:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+     d6a:	7f cc                	jg     d38 <bench+0x48>
+  for(i = 1; i < n; i++){
+     d6c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+     d70:	8b 75 1c             	mov    0x1c(%ebp),%esi
+     d73:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+     d79:	bf 01 00 00 00       	mov    $0x1,%edi
+     d7e:	74 77                	je     df7 <bench+0x107>
+     d80:	89 75 1c             	mov    %esi,0x1c(%ebp)
+     d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d87:	90                   	nop
+    v = a[i];
+     d88:	8b 01                	mov    (%ecx),%eax
+     d8a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+     d8d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+     d93:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+     d99:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+     d9f:	89 c8                	mov    %ecx,%eax
+     da1:	eb 1b                	jmp    dbe <bench+0xce>
+     da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     da7:	90                   	nop
+      a[j] = a[j-1];
+     da8:	89 08                	mov    %ecx,(%eax)
+     daa:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+     dad:	8d 43 f8             	lea    -0x8(%ebx),%eax
+     db0:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+     db6:	39 c3                	cmp    %eax,%ebx
+     db8:	0f 84 72 01 00 00    	je     f30 <bench+0x240>
+     dbe:	8b 50 fc             	mov    -0x4(%eax),%edx
+     dc1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+     dc4:	89 f7                	mov    %esi,%edi
+     dc6:	89 c3                	mov    %eax,%ebx
+     dc8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+     dce:	19 d7                	sbb    %edx,%edi
+     dd0:	72 d6                	jb     da8 <bench+0xb8>
+     dd2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+     dd8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+     dde:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+     de4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+     de7:	83 c7 01             	add    $0x1,%edi
+     dea:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+     ded:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+     def:	39 7d 18             	cmp    %edi,0x18(%ebp)
+     df2:	75 94                	jne    d88 <bench+0x98>
+     df4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+     df7:	83 ec 08             	sub    $0x8,%esp
+     dfa:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+     e00:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     e05:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+     e0b:	e8 70 f8 ff ff       	call   680 <cyc2ns>
+     e10:	83 c4 0c             	add    $0xc,%esp
+     e13:	ff 75 14             	push   0x14(%ebp)
+     e16:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+     e1c:	f7 e3                	mul    %ebx
+     e1e:	01 ca                	add    %ecx,%edx
+     e20:	52                   	push   %edx
+     e21:	50                   	push   %eax
+     e22:	e8 29 f8 ff ff       	call   650 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+     e27:	89 06                	mov    %eax,(%esi)
+     e29:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+     e2c:	5f                   	pop    %edi
+     e2d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+     e2e:	8b 45 18             	mov    0x18(%ebp),%eax
+     e31:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+     e33:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+     e3a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+     e41:	e8 3a f8 ff ff       	call   680 <cyc2ns>
+     e46:	83 c4 0c             	add    $0xc,%esp
+     e49:	ff 75 14             	push   0x14(%ebp)
+     e4c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+     e52:	f7 e3                	mul    %ebx
+     e54:	01 ca                	add    %ecx,%edx
+     e56:	52                   	push   %edx
+     e57:	50                   	push   %eax
+     e58:	e8 f3 f7 ff ff       	call   650 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+     e5d:	89 46 08             	mov    %eax,0x8(%esi)
+     e60:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+     e63:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+     e64:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+     e67:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+     e68:	8d 50 01             	lea    0x1(%eax),%edx
+     e6b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+     e70:	6b d2 63             	imul   $0x63,%edx,%edx
+     e73:	f7 e2                	mul    %edx
+     e75:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+     e78:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+     e7f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+     e86:	e8 f5 f7 ff ff       	call   680 <cyc2ns>
+     e8b:	83 c4 0c             	add    $0xc,%esp
+     e8e:	ff 75 14             	push   0x14(%ebp)
+     e91:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+     e97:	f7 e3                	mul    %ebx
+     e99:	01 ca                	add    %ecx,%edx
+     e9b:	52                   	push   %edx
+     e9c:	50                   	push   %eax
+     e9d:	e8 ae f7 ff ff       	call   650 <udiv64>
+
+  if(name){
+     ea2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ea5:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+     ea8:	89 46 10             	mov    %eax,0x10(%esi)
+     eab:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+     eae:	85 c9                	test   %ecx,%ecx
+     eb0:	74 72                	je     f24 <bench+0x234>
+    printf(1, "%s: min ", name);
+     eb2:	83 ec 04             	sub    $0x4,%esp
+     eb5:	ff 75 08             	push   0x8(%ebp)
+     eb8:	68 c2 14 00 00       	push   $0x14c2
+     ebd:	6a 01                	push   $0x1
+     ebf:	e8 5c fa ff ff       	call   920 <printf>
+    printps(1, st->min);
+     ec4:	83 c4 0c             	add    $0xc,%esp
+     ec7:	ff 76 04             	push   0x4(%esi)
+     eca:	ff 36                	push   (%esi)
+     ecc:	6a 01                	push   $0x1
+     ece:	e8 7d fd ff ff       	call   c50 <printps>
+    printf(1, " median ");
+     ed3:	58                   	pop    %eax
+     ed4:	5a                   	pop    %edx
+     ed5:	68 cb 14 00 00       	push   $0x14cb
+     eda:	6a 01                	push   $0x1
+     edc:	e8 3f fa ff ff       	call   920 <printf>
+    printps(1, st->median);
+     ee1:	83 c4 0c             	add    $0xc,%esp
+     ee4:	ff 76 0c             	push   0xc(%esi)
+     ee7:	ff 76 08             	push   0x8(%esi)
+     eea:	6a 01                	push   $0x1
+     eec:	e8 5f fd ff ff       	call   c50 <printps>
+    printf(1, " p99 ");
+     ef1:	59                   	pop    %ecx
+     ef2:	5b                   	pop    %ebx
+     ef3:	68 d4 14 00 00       	push   $0x14d4
+     ef8:	6a 01                	push   $0x1
+     efa:	e8 21 fa ff ff       	call   920 <printf>
+    printps(1, st->p99);
+     eff:	83 c4 0c             	add    $0xc,%esp
+     f02:	ff 76 14             	push   0x14(%esi)
+     f05:	ff 76 10             	push   0x10(%esi)
+     f08:	6a 01                	push   $0x1
+     f0a:	e8 41 fd ff ff       	call   c50 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+     f0f:	83 c4 0c             	add    $0xc,%esp
+     f12:	ff 75 18             	push   0x18(%ebp)
+     f15:	68 da 14 00 00       	push   $0x14da
+     f1a:	6a 01                	push   $0x1
+     f1c:	e8 ff f9 ff ff       	call   920 <printf>
+     f21:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+     f24:	31 c0                	xor    %eax,%eax
+}
+     f26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f29:	5b                   	pop    %ebx
+     f2a:	5e                   	pop    %esi
+     f2b:	5f                   	pop    %edi
+     f2c:	5d                   	pop    %ebp
+     f2d:	c3                   	ret
+     f2e:	66 90                	xchg   %ax,%ax
+     f30:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+     f36:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+     f3c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+     f42:	e9 97 fe ff ff       	jmp    dde <bench+0xee>
+    return -1;
+     f47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f4c:	eb d8                	jmp    f26 <bench+0x236>
+     f4e:	66 90                	xchg   %ax,%ax
+
+00000f50 <tstart>:
+} threads[NTHREAD];
+static struct mutex tlock;   // guards threads[] and our malloc calls
+
+static void
+tstart(void *a)
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	83 ec 14             	sub    $0x14,%esp
+     f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+     f59:	ff 70 04             	push   0x4(%eax)
+     f5c:	ff 10                	call   *(%eax)
+  exit();
+     f5e:	e8 b5 f7 ff ff       	call   718 <exit>
+     f63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f70 <thread_create>:
+}
+
+// Start a thread running fn(arg).  Returns its id, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     f70:	55                   	push   %ebp
+  asm volatile("lock; cmpxchgl %2, %1" :
+     f71:	31 c0                	xor    %eax,%eax
+     f73:	ba 01 00 00 00       	mov    $0x1,%edx
+     f78:	89 e5                	mov    %esp,%ebp
+     f7a:	57                   	push   %edi
+     f7b:	56                   	push   %esi
+     f7c:	53                   	push   %ebx
+     f7d:	83 ec 0c             	sub    $0xc,%esp
+     f80:	f0 0f b1 15 80 1a 00 	lock cmpxchg %edx,0x1a80
+     f87:	00 
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     f88:	85 c0                	test   %eax,%eax
+     f8a:	74 43                	je     fcf <thread_create+0x5f>
+    return;
+  if(c != 2)
+     f8c:	83 f8 02             	cmp    $0x2,%eax
+     f8f:	74 10                	je     fa1 <thread_create+0x31>
+  asm volatile("lock; xchgl %0, %1" :
+     f91:	b8 02 00 00 00       	mov    $0x2,%eax
+     f96:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     f9d:	85 c0                	test   %eax,%eax
+     f9f:	74 2e                	je     fcf <thread_create+0x5f>
+     fa1:	bb 02 00 00 00       	mov    $0x2,%ebx
+     fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+     fb0:	83 ec 08             	sub    $0x8,%esp
+     fb3:	6a 02                	push   $0x2
+     fb5:	68 80 1a 00 00       	push   $0x1a80
+     fba:	e8 99 f8 ff ff       	call   858 <futex_wait>
+     fbf:	89 d8                	mov    %ebx,%eax
+     fc1:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  while(c != 0){
+     fc8:	83 c4 10             	add    $0x10,%esp
+     fcb:	85 c0                	test   %eax,%eax
+     fcd:	75 e1                	jne    fb0 <thread_create+0x40>
+  for(i = 0; i < NTHREAD; i++)
+     fcf:	31 db                	xor    %ebx,%ebx
+     fd1:	eb 11                	jmp    fe4 <thread_create+0x74>
+     fd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fd7:	90                   	nop
+     fd8:	83 c3 01             	add    $0x1,%ebx
+     fdb:	83 fb 40             	cmp    $0x40,%ebx
+     fde:	0f 84 94 00 00 00    	je     1078 <thread_create+0x108>
+    if(threads[i].stack == 0)
+     fe4:	8b 04 dd a4 1a 00 00 	mov    0x1aa4(,%ebx,8),%eax
+     feb:	85 c0                	test   %eax,%eax
+     fed:	75 e9                	jne    fd8 <thread_create+0x68>
+  if(i == NTHREAD || (stack = malloc(TSTACK)) == 0){
+     fef:	83 ec 0c             	sub    $0xc,%esp
+     ff2:	68 00 20 00 00       	push   $0x2000
+     ff7:	e8 64 fb ff ff       	call   b60 <malloc>
+     ffc:	83 c4 10             	add    $0x10,%esp
+     fff:	89 c6                	mov    %eax,%esi
+    1001:	85 c0                	test   %eax,%eax
+    1003:	74 73                	je     1078 <thread_create+0x108>
+  t->fn = fn;
+    1005:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((tid = clone(tstart, t, stack + TSTACK)) < 0){
+    1008:	83 ec 04             	sub    $0x4,%esp
+  t->fn = fn;
+    100b:	89 06                	mov    %eax,(%esi)
+  t->arg = arg;
+    100d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1010:	89 46 04             	mov    %eax,0x4(%esi)
+  if((tid = clone(tstart, t, stack + TSTACK)) < 0){
+    1013:	8d 86 00 20 00 00    	lea    0x2000(%esi),%eax
+    1019:	50                   	push   %eax
+    101a:	56                   	push   %esi
+    101b:	68 50 0f 00 00       	push   $0xf50
+    1020:	e8 23 f8 ff ff       	call   848 <clone>
+    1025:	83 c4 10             	add    $0x10,%esp
+    1028:	89 c7                	mov    %eax,%edi
+    102a:	85 c0                	test   %eax,%eax
+    102c:	78 5f                	js     108d <thread_create+0x11d>
+  threads[i].tid = tid;
+    102e:	89 04 dd a0 1a 00 00 	mov    %eax,0x1aa0(,%ebx,8)
+    1035:	31 c0                	xor    %eax,%eax
+  threads[i].stack = stack;
+    1037:	89 34 dd a4 1a 00 00 	mov    %esi,0x1aa4(,%ebx,8)
+    103e:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+
+// Release m, entering the kernel only if someone may be waiting.
+void
+mutex_unlock(struct mutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    1045:	83 f8 02             	cmp    $0x2,%eax
+    1048:	74 0e                	je     1058 <thread_create+0xe8>
+}
+    104a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    104d:	89 f8                	mov    %edi,%eax
+    104f:	5b                   	pop    %ebx
+    1050:	5e                   	pop    %esi
+    1051:	5f                   	pop    %edi
+    1052:	5d                   	pop    %ebp
+    1053:	c3                   	ret
+    1054:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->state, 1);
+    1058:	83 ec 08             	sub    $0x8,%esp
+    105b:	6a 01                	push   $0x1
+    105d:	68 80 1a 00 00       	push   $0x1a80
+    1062:	e8 f9 f7 ff ff       	call   860 <futex_wake>
+    1067:	83 c4 10             	add    $0x10,%esp
+}
+    106a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    106d:	89 f8                	mov    %edi,%eax
+    106f:	5b                   	pop    %ebx
+    1070:	5e                   	pop    %esi
+    1071:	5f                   	pop    %edi
+    1072:	5d                   	pop    %ebp
+    1073:	c3                   	ret
+    1074:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1078:	31 c0                	xor    %eax,%eax
+    107a:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  if(xchg(&m->state, 0) == 2)
+    1081:	83 f8 02             	cmp    $0x2,%eax
+    1084:	74 21                	je     10a7 <thread_create+0x137>
+    return -1;
+    1086:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    108b:	eb bd                	jmp    104a <thread_create+0xda>
+    free(stack);
+    108d:	83 ec 0c             	sub    $0xc,%esp
+    1090:	56                   	push   %esi
+    1091:	e8 3a fa ff ff       	call   ad0 <free>
+    1096:	31 c0                	xor    %eax,%eax
+    1098:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  if(xchg(&m->state, 0) == 2)
+    109f:	83 c4 10             	add    $0x10,%esp
+    10a2:	83 f8 02             	cmp    $0x2,%eax
+    10a5:	75 df                	jne    1086 <thread_create+0x116>
+    futex_wake(&m->state, 1);
+    10a7:	83 ec 08             	sub    $0x8,%esp
+    10aa:	6a 01                	push   $0x1
+    10ac:	68 80 1a 00 00       	push   $0x1a80
+    10b1:	e8 aa f7 ff ff       	call   860 <futex_wake>
+    10b6:	83 c4 10             	add    $0x10,%esp
+    10b9:	eb cb                	jmp    1086 <thread_create+0x116>
+    10bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+
+000010c0 <thread_join>:
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	56                   	push   %esi
+    10c4:	53                   	push   %ebx
+    10c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(join(tid) < 0)
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	56                   	push   %esi
+    10cc:	e8 7f f7 ff ff       	call   850 <join>
+    10d1:	83 c4 10             	add    $0x10,%esp
+    10d4:	85 c0                	test   %eax,%eax
+    10d6:	0f 88 c0 00 00 00    	js     119c <thread_join+0xdc>
+  asm volatile("lock; cmpxchgl %2, %1" :
+    10dc:	31 c0                	xor    %eax,%eax
+    10de:	ba 01 00 00 00       	mov    $0x1,%edx
+    10e3:	f0 0f b1 15 80 1a 00 	lock cmpxchg %edx,0x1a80
+    10ea:	00 
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    10eb:	85 c0                	test   %eax,%eax
+    10ed:	74 40                	je     112f <thread_join+0x6f>
+  if(c != 2)
+    10ef:	83 f8 02             	cmp    $0x2,%eax
+    10f2:	74 10                	je     1104 <thread_join+0x44>
+  asm volatile("lock; xchgl %0, %1" :
+    10f4:	b8 02 00 00 00       	mov    $0x2,%eax
+    10f9:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  while(c != 0){
+    1100:	85 c0                	test   %eax,%eax
+    1102:	74 2b                	je     112f <thread_join+0x6f>
+    1104:	bb 02 00 00 00       	mov    $0x2,%ebx
+    1109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wait(&m->state, 2);
+    1110:	83 ec 08             	sub    $0x8,%esp
+    1113:	6a 02                	push   $0x2
+    1115:	68 80 1a 00 00       	push   $0x1a80
+    111a:	e8 39 f7 ff ff       	call   858 <futex_wait>
+    111f:	89 d8                	mov    %ebx,%eax
+    1121:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  while(c != 0){
+    1128:	83 c4 10             	add    $0x10,%esp
+    112b:	85 c0                	test   %eax,%eax
+    112d:	75 e1                	jne    1110 <thread_join+0x50>
+  for(i = 0; i < NTHREAD; i++){
+    112f:	31 db                	xor    %ebx,%ebx
+    1131:	eb 0d                	jmp    1140 <thread_join+0x80>
+    1133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1137:	90                   	nop
+    1138:	83 c3 01             	add    $0x1,%ebx
+    113b:	83 fb 40             	cmp    $0x40,%ebx
+    113e:	74 2b                	je     116b <thread_join+0xab>
+    if(threads[i].stack && threads[i].tid == tid){
+    1140:	8b 04 dd a4 1a 00 00 	mov    0x1aa4(,%ebx,8),%eax
+    1147:	85 c0                	test   %eax,%eax
+    1149:	74 ed                	je     1138 <thread_join+0x78>
+    114b:	39 34 dd a0 1a 00 00 	cmp    %esi,0x1aa0(,%ebx,8)
+    1152:	75 e4                	jne    1138 <thread_join+0x78>
+      free(threads[i].stack);
+    1154:	83 ec 0c             	sub    $0xc,%esp
+    1157:	50                   	push   %eax
+    1158:	e8 73 f9 ff ff       	call   ad0 <free>
+      break;
+    115d:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+    1160:	c7 04 dd a4 1a 00 00 	movl   $0x0,0x1aa4(,%ebx,8)
+    1167:	00 00 00 00 
+    116b:	31 c0                	xor    %eax,%eax
+    116d:	f0 87 05 80 1a 00 00 	lock xchg %eax,0x1a80
+  if(xchg(&m->state, 0) == 2)
+    1174:	83 f8 02             	cmp    $0x2,%eax
+    1177:	74 0f                	je     1188 <thread_join+0xc8>
+  return 0;
+    1179:	31 c0                	xor    %eax,%eax
+}
+    117b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    117e:	5b                   	pop    %ebx
+    117f:	5e                   	pop    %esi
+    1180:	5d                   	pop    %ebp
+    1181:	c3                   	ret
+    1182:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+    1188:	83 ec 08             	sub    $0x8,%esp
+    118b:	6a 01                	push   $0x1
+    118d:	68 80 1a 00 00       	push   $0x1a80
+    1192:	e8 c9 f6 ff ff       	call   860 <futex_wake>
+    1197:	83 c4 10             	add    $0x10,%esp
+    119a:	eb dd                	jmp    1179 <thread_join+0xb9>
+    return -1;
+    119c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11a1:	eb d8                	jmp    117b <thread_join+0xbb>
+    11a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000011b0 <mutex_init>:
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    11b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11bc:	5d                   	pop    %ebp
+    11bd:	c3                   	ret
+    11be:	66 90                	xchg   %ax,%ax
+
+000011c0 <mutex_lock>:
+{
+    11c0:	55                   	push   %ebp
+  asm volatile("lock; cmpxchgl %2, %1" :
+    11c1:	31 c0                	xor    %eax,%eax
+    11c3:	ba 01 00 00 00       	mov    $0x1,%edx
+    11c8:	89 e5                	mov    %esp,%ebp
+    11ca:	56                   	push   %esi
+    11cb:	53                   	push   %ebx
+    11cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    11d3:	85 c0                	test   %eax,%eax
+    11d5:	74 30                	je     1207 <mutex_lock+0x47>
+  if(c != 2)
+    11d7:	83 f8 02             	cmp    $0x2,%eax
+    11da:	74 0c                	je     11e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+    11dc:	b8 02 00 00 00       	mov    $0x2,%eax
+    11e1:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    11e4:	85 c0                	test   %eax,%eax
+    11e6:	74 1f                	je     1207 <mutex_lock+0x47>
+    11e8:	be 02 00 00 00       	mov    $0x2,%esi
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+    11f0:	83 ec 08             	sub    $0x8,%esp
+    11f3:	6a 02                	push   $0x2
+    11f5:	53                   	push   %ebx
+    11f6:	e8 5d f6 ff ff       	call   858 <futex_wait>
+    11fb:	89 f0                	mov    %esi,%eax
+    11fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    1200:	83 c4 10             	add    $0x10,%esp
+    1203:	85 c0                	test   %eax,%eax
+    1205:	75 e9                	jne    11f0 <mutex_lock+0x30>
+}
+    1207:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    120a:	5b                   	pop    %ebx
+    120b:	5e                   	pop    %esi
+    120c:	5d                   	pop    %ebp
+    120d:	c3                   	ret
+    120e:	66 90                	xchg   %ax,%ax
+
+00001210 <mutex_unlock>:
+{
+    1210:	55                   	push   %ebp
+    1211:	31 c0                	xor    %eax,%eax
+    1213:	89 e5                	mov    %esp,%ebp
+    1215:	83 ec 08             	sub    $0x8,%esp
+    1218:	8b 55 08             	mov    0x8(%ebp),%edx
+    121b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+    121e:	83 f8 02             	cmp    $0x2,%eax
+    1221:	74 05                	je     1228 <mutex_unlock+0x18>
+}
+    1223:	c9                   	leave
+    1224:	c3                   	ret
+    1225:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+    1228:	83 ec 08             	sub    $0x8,%esp
+    122b:	6a 01                	push   $0x1
+    122d:	52                   	push   %edx
+    122e:	e8 2d f6 ff ff       	call   860 <futex_wake>
+    1233:	83 c4 10             	add    $0x10,%esp
+}
+    1236:	c9                   	leave
+    1237:	c3                   	ret
+    1238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <barrier_init>:
+
+void
+barrier_init(struct barrier *b, uint n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	8b 45 08             	mov    0x8(%ebp),%eax
+  mutex_init(&b->lk);
+  b->n = n;
+    1246:	8b 55 0c             	mov    0xc(%ebp),%edx
+  m->state = 0;
+    1249:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  b->n = n;
+    124f:	89 50 04             	mov    %edx,0x4(%eax)
+  b->count = 0;
+    1252:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+  b->round = 0;
+    1259:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+    1260:	5d                   	pop    %ebp
+    1261:	c3                   	ret
+    1262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001270 <barrier_wait>:
+
+// Wait until n threads have called barrier_wait on b.
+void
+barrier_wait(struct barrier *b)
+{
+    1270:	55                   	push   %ebp
+  asm volatile("lock; cmpxchgl %2, %1" :
+    1271:	31 c0                	xor    %eax,%eax
+    1273:	ba 01 00 00 00       	mov    $0x1,%edx
+    1278:	89 e5                	mov    %esp,%ebp
+    127a:	57                   	push   %edi
+    127b:	56                   	push   %esi
+    127c:	53                   	push   %ebx
+    127d:	83 ec 0c             	sub    $0xc,%esp
+    1280:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1283:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    1287:	85 c0                	test   %eax,%eax
+    1289:	74 34                	je     12bf <barrier_wait+0x4f>
+  if(c != 2)
+    128b:	83 f8 02             	cmp    $0x2,%eax
+    128e:	74 0c                	je     129c <barrier_wait+0x2c>
+  asm volatile("lock; xchgl %0, %1" :
+    1290:	b8 02 00 00 00       	mov    $0x2,%eax
+    1295:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    1298:	85 c0                	test   %eax,%eax
+    129a:	74 23                	je     12bf <barrier_wait+0x4f>
+    129c:	be 02 00 00 00       	mov    $0x2,%esi
+    12a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wait(&m->state, 2);
+    12a8:	83 ec 08             	sub    $0x8,%esp
+    12ab:	6a 02                	push   $0x2
+    12ad:	53                   	push   %ebx
+    12ae:	e8 a5 f5 ff ff       	call   858 <futex_wait>
+    12b3:	89 f0                	mov    %esi,%eax
+    12b5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+    12b8:	83 c4 10             	add    $0x10,%esp
+    12bb:	85 c0                	test   %eax,%eax
+    12bd:	75 e9                	jne    12a8 <barrier_wait+0x38>
+  uint round;
+
+  mutex_lock(&b->lk);
+  round = b->round;
+  if(++b->count == b->n){
+    12bf:	8b 43 08             	mov    0x8(%ebx),%eax
+  round = b->round;
+    12c2:	8b 73 0c             	mov    0xc(%ebx),%esi
+  if(++b->count == b->n){
+    12c5:	83 c0 01             	add    $0x1,%eax
+    12c8:	89 43 08             	mov    %eax,0x8(%ebx)
+    12cb:	3b 43 04             	cmp    0x4(%ebx),%eax
+    12ce:	74 38                	je     1308 <barrier_wait+0x98>
+    12d0:	31 c0                	xor    %eax,%eax
+    12d2:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+    12d5:	83 f8 02             	cmp    $0x2,%eax
+    12d8:	74 66                	je     1340 <barrier_wait+0xd0>
+    mutex_unlock(&b->lk);
+    futex_wake(&b->round, b->n);
+    return;
+  }
+  mutex_unlock(&b->lk);
+  while(b->round == round)
+    12da:	8b 43 0c             	mov    0xc(%ebx),%eax
+    futex_wake(&b->round, b->n);
+    12dd:	8d 7b 0c             	lea    0xc(%ebx),%edi
+  while(b->round == round)
+    12e0:	39 f0                	cmp    %esi,%eax
+    12e2:	75 18                	jne    12fc <barrier_wait+0x8c>
+    12e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    futex_wait(&b->round, round);
+    12e8:	83 ec 08             	sub    $0x8,%esp
+    12eb:	56                   	push   %esi
+    12ec:	57                   	push   %edi
+    12ed:	e8 66 f5 ff ff       	call   858 <futex_wait>
+  while(b->round == round)
+    12f2:	8b 43 0c             	mov    0xc(%ebx),%eax
+    12f5:	83 c4 10             	add    $0x10,%esp
+    12f8:	39 f0                	cmp    %esi,%eax
+    12fa:	74 ec                	je     12e8 <barrier_wait+0x78>
+}
+    12fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ff:	5b                   	pop    %ebx
+    1300:	5e                   	pop    %esi
+    1301:	5f                   	pop    %edi
+    1302:	5d                   	pop    %ebp
+    1303:	c3                   	ret
+    1304:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    b->round++;
+    1308:	8b 43 0c             	mov    0xc(%ebx),%eax
+    b->count = 0;
+    130b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    b->round++;
+    1312:	83 c0 01             	add    $0x1,%eax
+    1315:	89 43 0c             	mov    %eax,0xc(%ebx)
+    1318:	31 c0                	xor    %eax,%eax
+    131a:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+    131d:	83 f8 02             	cmp    $0x2,%eax
+    1320:	74 2e                	je     1350 <barrier_wait+0xe0>
+    futex_wake(&b->round, b->n);
+    1322:	83 ec 08             	sub    $0x8,%esp
+    1325:	83 c3 0c             	add    $0xc,%ebx
+    1328:	ff 73 f8             	push   -0x8(%ebx)
+    132b:	53                   	push   %ebx
+    132c:	e8 2f f5 ff ff       	call   860 <futex_wake>
+    return;
+    1331:	83 c4 10             	add    $0x10,%esp
+}
+    1334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1337:	5b                   	pop    %ebx
+    1338:	5e                   	pop    %esi
+    1339:	5f                   	pop    %edi
+    133a:	5d                   	pop    %ebp
+    133b:	c3                   	ret
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->state, 1);
+    1340:	83 ec 08             	sub    $0x8,%esp
+    1343:	6a 01                	push   $0x1
+    1345:	53                   	push   %ebx
+    1346:	e8 15 f5 ff ff       	call   860 <futex_wake>
+    134b:	83 c4 10             	add    $0x10,%esp
+    134e:	eb 8a                	jmp    12da <barrier_wait+0x6a>
+    1350:	83 ec 08             	sub    $0x8,%esp
+    1353:	6a 01                	push   $0x1
+    1355:	53                   	push   %ebx
+    1356:	e8 05 f5 ff ff       	call   860 <futex_wake>
+    135b:	83 c4 10             	add    $0x10,%esp
+    135e:	eb c2                	jmp    1322 <barrier_wait+0xb2>
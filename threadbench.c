@@ -0,0 +1,126 @@
+// Threads sharing one address space.
+//   threadbench [maxthreads]
+// Sums a huge-page-backed array split across 1, 2, 4, ...
+// threads, and times a mutex that every thread contends for.
+
+#include "types.h"
+#include "user.h"
+
+#define ARRAYMB   8
+#define NPASS     4      // times each thread sums its part
+#define NLOCK  10000     // mutex acquires per thread
+#define MAXTHR   16
+#define HUGEPG  (4*1024*1024)
+
+static uint *array;
+static uint nword;
+static int nthr;
+static struct barrier start;
+static struct mutex lk;
+static uint total, counter;
+
+static void
+sum(void *arg)
+{
+  uint i, lo, hi, s;
+  int k;
+
+  lo = nword / nthr * (uint)arg;
+  hi = lo + nword / nthr;
+  barrier_wait(&start);
+  s = 0;
+  for(k = 0; k < NPASS; k++)
+    for(i = lo; i < hi; i++)
+      s += array[i];
+  mutex_lock(&lk);
+  total += s;
+  mutex_unlock(&lk);
+  exit();
+}
+
+static void
+count(void *arg)
+{
+  int i;
+
+  barrier_wait(&start);
+  for(i = 0; i < NLOCK; i++){
+    mutex_lock(&lk);
+    counter++;
+    mutex_unlock(&lk);
+  }
+  exit();
+}
+
+// Run fn in nthr threads; return elapsed ns.
+static uint64
+run(void (*fn)(void*))
+{
+  int tid[MAXTHR], i, n;
+  uint64 t0;
+
+  barrier_init(&start, nthr + 1);
+  for(n = 0; n < nthr; n++)
+    if((tid[n] = thread_create(fn, (void*)n)) < 0)
+      break;
+  if(n < nthr){
+    printf(2, "threadbench: thread_create failed\n");
+    exit();
+  }
+  barrier_wait(&start);
+  t0 = cycles();
+  for(i = 0; i < n; i++)
+    thread_join(tid[i]);
+  return cyc2ns(cycles() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int max;
+  uint i, want;
+  uint64 ns;
+  char *p;
+
+  max = 4;
+  if(argc > 1)
+    max = atoi(argv[1]);
+  if(max < 1 || max > MAXTHR){
+    printf(2, "usage: threadbench [maxthreads <= %d]\n", MAXTHR);
+    exit();
+  }
+
+  // Back the array with huge pages before any thread exists;
+  // promote() is refused once the address space is shared.
+  p = sbrk(ARRAYMB * 1024 * 1024 + HUGEPG);
+  if(p == (char*)-1){
+    printf(2, "threadbench: out of memory\n");
+    exit();
+  }
+  array = (uint*)(((uint)p + HUGEPG - 1) & ~(HUGEPG - 1));
+  nword = ARRAYMB * 1024 * 1024 / 4;
+  for(i = 0; i < nword; i++)
+    array[i] = i;
+  promote(array, ARRAYMB * 1024 * 1024);
+  mutex_init(&lk);
+
+  printf(1, "threads\tsum ms\tMB/s\tns/lock\n");
+  for(nthr = 1; nthr <= max; nthr *= 2){
+    total = 0;
+    ns = run(sum);
+    want = 0;
+    for(i = 0; i < nword / nthr * nthr; i++)
+      want += i;
+    if(total != want * NPASS)
+      printf(2, "threadbench: bad sum with %d threads\n", nthr);
+    printf(1, "%d\t%d\t%d\t", nthr, (uint)udiv64(ns, 1000000),
+           ns ? (uint)udiv64((uint64)ARRAYMB * NPASS * 1000000000, ns) : 0);
+
+    counter = 0;
+    ns = run(count);
+    if(counter != nthr * NLOCK)
+      printf(2, "threadbench: lost updates with %d threads\n", nthr);
+    printf(1, "%d\n", (uint)udiv64(ns, nthr * NLOCK));
+  }
+  exit();
+}
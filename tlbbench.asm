@@ -0,0 +1,2167 @@
+
+_tlbbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  bench(0, chase, &c, c.n, RUNS, st);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec c0 00 00 00    	sub    $0xc0,%esp
+  uint size, span, *perm;
+  char *mem, *base;
+  int p, npromoted;
+
+  // Stay on one cpu so every run sees the same caches and TLB.
+  sched_setaffinity(0, 1);
+  17:	6a 01                	push   $0x1
+  19:	6a 00                	push   $0x0
+  1b:	e8 f8 07 00 00       	call   818 <sched_setaffinity>
+
+  perm = malloc(MAXSET / PG * sizeof(uint));
+  20:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+  27:	e8 14 0b 00 00       	call   b40 <malloc>
+  if(perm == 0){
+  2c:	83 c4 10             	add    $0x10,%esp
+  perm = malloc(MAXSET / PG * sizeof(uint));
+  2f:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  if(perm == 0){
+  35:	85 c0                	test   %eax,%eax
+  37:	0f 84 bf 01 00 00    	je     1fc <main+0x1fc>
+    printf(2, "tlbbench: out of memory\n");
+    exit();
+  }
+
+  printf(1, "set\tpattern\t\t4KB ns/load\t4MB ns/load\n");
+  3d:	83 ec 08             	sub    $0x8,%esp
+  for(size = MINSET; size <= MAXSET; size *= 2){
+  40:	bf 00 00 10 00       	mov    $0x100000,%edi
+  printf(1, "set\tpattern\t\t4KB ns/load\t4MB ns/load\n");
+  45:	68 84 0f 00 00       	push   $0xf84
+  4a:	6a 01                	push   $0x1
+  4c:	e8 af 08 00 00       	call   900 <printf>
+  51:	83 c4 10             	add    $0x10,%esp
+  54:	c7 85 3c ff ff ff 08 	movl   $0x8,-0xc4(%ebp)
+  5b:	00 00 00 
+  5e:	66 90                	xchg   %ax,%ax
+    // Round the mapping up to whole, aligned 4MB regions so
+    // that even small working sets can be promoted.
+    span = (size + HUGEPG - 1) & ~(HUGEPG - 1);
+  60:	8d 87 ff ff 3f 00    	lea    0x3fffff(%edi),%eax
+    if((mem = sbrk(span + HUGEPG)) == (char*)-1){
+  66:	83 ec 0c             	sub    $0xc,%esp
+    span = (size + HUGEPG - 1) & ~(HUGEPG - 1);
+  69:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  6f:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+  74:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+    if((mem = sbrk(span + HUGEPG)) == (char*)-1){
+  7a:	05 00 00 40 00       	add    $0x400000,%eax
+  7f:	50                   	push   %eax
+  80:	e8 fb 06 00 00       	call   780 <sbrk>
+  85:	83 c4 10             	add    $0x10,%esp
+  88:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8b:	0f 84 7e 01 00 00    	je     20f <main+0x20f>
+      printf(2, "tlbbench: cannot allocate %d MB\n", size >> 20);
+      break;
+    }
+    base = (char*)(((uint)mem + HUGEPG - 1) & ~(HUGEPG - 1));
+  91:	8d 98 ff ff 3f 00    	lea    0x3fffff(%eax),%ebx
+
+    for(p = 0; p < NPATTERN; p++)
+  97:	31 f6                	xor    %esi,%esi
+    base = (char*)(((uint)mem + HUGEPG - 1) & ~(HUGEPG - 1));
+  99:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+      run(base, size, p, perm, &small[p]);
+  9f:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  a2:	83 ec 08             	sub    $0x8,%esp
+  a5:	89 f1                	mov    %esi,%ecx
+  a7:	89 fa                	mov    %edi,%edx
+  a9:	8d 84 c5 58 ff ff ff 	lea    -0xa8(%ebp,%eax,8),%eax
+    for(p = 0; p < NPATTERN; p++)
+  b0:	83 c6 01             	add    $0x1,%esi
+      run(base, size, p, perm, &small[p]);
+  b3:	50                   	push   %eax
+  b4:	89 d8                	mov    %ebx,%eax
+  b6:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  bc:	e8 9f 01 00 00       	call   260 <run>
+    for(p = 0; p < NPATTERN; p++)
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	83 fe 03             	cmp    $0x3,%esi
+  c7:	75 d6                	jne    9f <main+0x9f>
+
+    promote(base, span);
+  c9:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+  cf:	83 ec 08             	sub    $0x8,%esp
+  d2:	56                   	push   %esi
+  d3:	53                   	push   %ebx
+  d4:	e8 bf 06 00 00       	call   798 <promote>
+    npromoted = huge_page_count(base, span);
+  d9:	58                   	pop    %eax
+  da:	5a                   	pop    %edx
+  db:	56                   	push   %esi
+  dc:	53                   	push   %ebx
+    for(p = 0; p < NPATTERN; p++)
+  dd:	31 f6                	xor    %esi,%esi
+    npromoted = huge_page_count(base, span);
+  df:	e8 c4 06 00 00       	call   7a8 <huge_page_count>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	89 85 48 ff ff ff    	mov    %eax,-0xb8(%ebp)
+      run(base, size, p, perm, &huge[p]);
+  ed:	8d 04 76             	lea    (%esi,%esi,2),%eax
+  f0:	83 ec 08             	sub    $0x8,%esp
+  f3:	89 f1                	mov    %esi,%ecx
+  f5:	89 fa                	mov    %edi,%edx
+  f7:	8d 44 c5 a0          	lea    -0x60(%ebp,%eax,8),%eax
+    for(p = 0; p < NPATTERN; p++)
+  fb:	83 c6 01             	add    $0x1,%esi
+      run(base, size, p, perm, &huge[p]);
+  fe:	50                   	push   %eax
+  ff:	89 d8                	mov    %ebx,%eax
+ 101:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+ 107:	e8 54 01 00 00       	call   260 <run>
+    for(p = 0; p < NPATTERN; p++)
+ 10c:	83 c4 10             	add    $0x10,%esp
+ 10f:	83 fe 03             	cmp    $0x3,%esi
+ 112:	75 d9                	jne    ed <main+0xed>
+
+    for(p = 0; p < NPATTERN; p++){
+      printf(1, "%dMB\t%s\t", size >> 20, patname[p]);
+ 114:	89 f9                	mov    %edi,%ecx
+ 116:	b8 f4 0f 00 00       	mov    $0xff4,%eax
+ 11b:	be 08 00 00 00       	mov    $0x8,%esi
+ 120:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+ 126:	c1 e9 14             	shr    $0x14,%ecx
+ 129:	89 bd 40 ff ff ff    	mov    %edi,-0xc0(%ebp)
+ 12f:	89 c7                	mov    %eax,%edi
+ 131:	89 cb                	mov    %ecx,%ebx
+ 133:	ff 37                	push   (%edi)
+    for(p = 0; p < NPATTERN; p++){
+ 135:	83 c7 04             	add    $0x4,%edi
+      printf(1, "%dMB\t%s\t", size >> 20, patname[p]);
+ 138:	53                   	push   %ebx
+ 139:	68 49 0f 00 00       	push   $0xf49
+ 13e:	6a 01                	push   $0x1
+ 140:	e8 bb 07 00 00       	call   900 <printf>
+      printps(1, small[p].median);
+ 145:	83 c4 0c             	add    $0xc,%esp
+ 148:	ff b4 35 5c ff ff ff 	push   -0xa4(%ebp,%esi,1)
+ 14f:	ff b4 35 58 ff ff ff 	push   -0xa8(%ebp,%esi,1)
+ 156:	6a 01                	push   $0x1
+ 158:	e8 d3 0a 00 00       	call   c30 <printps>
+      printf(1, "\t\t");
+ 15d:	58                   	pop    %eax
+ 15e:	5a                   	pop    %edx
+ 15f:	68 52 0f 00 00       	push   $0xf52
+ 164:	6a 01                	push   $0x1
+ 166:	e8 95 07 00 00       	call   900 <printf>
+      printps(1, huge[p].median);
+ 16b:	83 c4 0c             	add    $0xc,%esp
+ 16e:	ff 74 35 a4          	push   -0x5c(%ebp,%esi,1)
+ 172:	ff 74 35 a0          	push   -0x60(%ebp,%esi,1)
+    for(p = 0; p < NPATTERN; p++){
+ 176:	83 c6 18             	add    $0x18,%esi
+      printps(1, huge[p].median);
+ 179:	6a 01                	push   $0x1
+ 17b:	e8 b0 0a 00 00       	call   c30 <printps>
+      printf(1, "\n");
+ 180:	59                   	pop    %ecx
+ 181:	58                   	pop    %eax
+ 182:	68 a2 10 00 00       	push   $0x10a2
+ 187:	6a 01                	push   $0x1
+ 189:	e8 72 07 00 00       	call   900 <printf>
+    for(p = 0; p < NPATTERN; p++){
+ 18e:	83 c4 10             	add    $0x10,%esp
+ 191:	83 fe 50             	cmp    $0x50,%esi
+ 194:	75 9d                	jne    133 <main+0x133>
+    }
+    if(npromoted != span / HUGEPG)
+ 196:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+ 19c:	8b 95 48 ff ff ff    	mov    -0xb8(%ebp),%edx
+ 1a2:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+ 1a8:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+ 1ae:	c1 e8 16             	shr    $0x16,%eax
+ 1b1:	39 d0                	cmp    %edx,%eax
+ 1b3:	74 11                	je     1c6 <main+0x1c6>
+      printf(1, "  (only %d of %d regions promoted)\n",
+ 1b5:	50                   	push   %eax
+ 1b6:	52                   	push   %edx
+ 1b7:	68 d0 0f 00 00       	push   $0xfd0
+ 1bc:	6a 01                	push   $0x1
+ 1be:	e8 3d 07 00 00       	call   900 <printf>
+ 1c3:	83 c4 10             	add    $0x10,%esp
+             npromoted, span / HUGEPG);
+
+    demote(base, span);
+ 1c6:	8b b5 50 ff ff ff    	mov    -0xb0(%ebp),%esi
+ 1cc:	83 ec 08             	sub    $0x8,%esp
+  for(size = MINSET; size <= MAXSET; size *= 2){
+ 1cf:	01 ff                	add    %edi,%edi
+    demote(base, span);
+ 1d1:	56                   	push   %esi
+ 1d2:	53                   	push   %ebx
+ 1d3:	e8 c8 05 00 00       	call   7a0 <demote>
+    sbrk(-(span + HUGEPG));
+ 1d8:	b8 00 00 c0 ff       	mov    $0xffc00000,%eax
+ 1dd:	29 f0                	sub    %esi,%eax
+ 1df:	89 04 24             	mov    %eax,(%esp)
+ 1e2:	e8 99 05 00 00       	call   780 <sbrk>
+  for(size = MINSET; size <= MAXSET; size *= 2){
+ 1e7:	83 c4 10             	add    $0x10,%esp
+ 1ea:	83 ad 3c ff ff ff 01 	subl   $0x1,-0xc4(%ebp)
+ 1f1:	0f 85 69 fe ff ff    	jne    60 <main+0x60>
+  }
+  exit();
+ 1f7:	e8 fc 04 00 00       	call   6f8 <exit>
+    printf(2, "tlbbench: out of memory\n");
+ 1fc:	53                   	push   %ebx
+ 1fd:	53                   	push   %ebx
+ 1fe:	68 30 0f 00 00       	push   $0xf30
+ 203:	6a 02                	push   $0x2
+ 205:	e8 f6 06 00 00       	call   900 <printf>
+    exit();
+ 20a:	e8 e9 04 00 00       	call   6f8 <exit>
+      printf(2, "tlbbench: cannot allocate %d MB\n", size >> 20);
+ 20f:	89 f8                	mov    %edi,%eax
+ 211:	51                   	push   %ecx
+ 212:	c1 e8 14             	shr    $0x14,%eax
+ 215:	50                   	push   %eax
+ 216:	68 ac 0f 00 00       	push   $0xfac
+ 21b:	6a 02                	push   $0x2
+ 21d:	e8 de 06 00 00       	call   900 <printf>
+      break;
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	eb d0                	jmp    1f7 <main+0x1f7>
+ 227:	66 90                	xchg   %ax,%ax
+ 229:	66 90                	xchg   %ax,%ax
+ 22b:	66 90                	xchg   %ax,%ax
+ 22d:	66 90                	xchg   %ax,%ax
+ 22f:	90                   	nop
+
+00000230 <chase>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i = 0; i < c->n; i++)
+ 237:	8b 4b 04             	mov    0x4(%ebx),%ecx
+  p = c->start;
+ 23a:	8b 13                	mov    (%ebx),%edx
+  for(i = 0; i < c->n; i++)
+ 23c:	85 c9                	test   %ecx,%ecx
+ 23e:	74 11                	je     251 <chase+0x21>
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 248:	83 c0 01             	add    $0x1,%eax
+    p = *p;
+ 24b:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < c->n; i++)
+ 24d:	39 c8                	cmp    %ecx,%eax
+ 24f:	75 f7                	jne    248 <chase+0x18>
+  c->sink = p;
+ 251:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 254:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <run>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	89 c7                	mov    %eax,%edi
+ 266:	56                   	push   %esi
+ 267:	53                   	push   %ebx
+ 268:	83 ec 2c             	sub    $0x2c,%esp
+ 26b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  for(i = 0; i < npg; i++)
+ 26e:	89 d1                	mov    %edx,%ecx
+{
+ 270:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  for(i = 0; i < npg; i++)
+ 273:	c1 e9 0c             	shr    $0xc,%ecx
+{
+ 276:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  for(i = 0; i < npg; i++)
+ 279:	0f 84 51 01 00 00    	je     3d0 <run+0x170>
+ 27f:	31 c0                	xor    %eax,%eax
+ 281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    perm[i] = i;
+ 288:	89 04 83             	mov    %eax,(%ebx,%eax,4)
+  for(i = 0; i < npg; i++)
+ 28b:	83 c0 01             	add    $0x1,%eax
+ 28e:	39 c1                	cmp    %eax,%ecx
+ 290:	75 f6                	jne    288 <run+0x28>
+  if(pattern == RANDOM){
+ 292:	83 7d d4 02          	cmpl   $0x2,-0x2c(%ebp)
+ 296:	0f 84 c4 00 00 00    	je     360 <run+0x100>
+      perm[i] = (perm[i] * (uint)(HUGEPG + 64)) & (size - 1);
+ 29c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 29f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 2a2:	89 7d cc             	mov    %edi,-0x34(%ebp)
+    for(i = npg - 1; i > 0; i--){
+ 2a5:	31 d2                	xor    %edx,%edx
+      perm[i] = (perm[i] * (uint)(HUGEPG + 64)) & (size - 1);
+ 2a7:	83 e8 01             	sub    $0x1,%eax
+ 2aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 2ad:	eb 0e                	jmp    2bd <run+0x5d>
+ 2af:	90                   	nop
+      perm[i] = perm[i] * PG;
+ 2b0:	c1 e0 0c             	shl    $0xc,%eax
+ 2b3:	89 04 93             	mov    %eax,(%ebx,%edx,4)
+  for(i = 0; i < npg; i++){
+ 2b6:	83 c2 01             	add    $0x1,%edx
+ 2b9:	39 ca                	cmp    %ecx,%edx
+ 2bb:	73 27                	jae    2e4 <run+0x84>
+      perm[i] = perm[i] * PG;
+ 2bd:	8b 04 93             	mov    (%ebx,%edx,4),%eax
+    if(pattern == STRIDE4K)
+ 2c0:	85 f6                	test   %esi,%esi
+ 2c2:	74 ec                	je     2b0 <run+0x50>
+    else if(pattern == STRIDE4M)
+ 2c4:	83 fe 01             	cmp    $0x1,%esi
+ 2c7:	0f 84 83 00 00 00    	je     350 <run+0xf0>
+      perm[i] = perm[i] * PG + (perm[i] % (PG / 64)) * 64;
+ 2cd:	89 c7                	mov    %eax,%edi
+ 2cf:	c1 e0 06             	shl    $0x6,%eax
+ 2d2:	83 e7 3f             	and    $0x3f,%edi
+ 2d5:	01 f8                	add    %edi,%eax
+ 2d7:	c1 e0 06             	shl    $0x6,%eax
+      perm[i] = perm[i] * PG;
+ 2da:	89 04 93             	mov    %eax,(%ebx,%edx,4)
+  for(i = 0; i < npg; i++){
+ 2dd:	83 c2 01             	add    $0x1,%edx
+ 2e0:	39 ca                	cmp    %ecx,%edx
+ 2e2:	72 d9                	jb     2bd <run+0x5d>
+  for(i = 0; i < npg; i++)
+ 2e4:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 2e7:	85 c9                	test   %ecx,%ecx
+ 2e9:	74 1e                	je     309 <run+0xa9>
+ 2eb:	31 f6                	xor    %esi,%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *(void**)(base + perm[i]) = base + perm[(i + 1) % npg];
+ 2f0:	83 c6 01             	add    $0x1,%esi
+ 2f3:	31 d2                	xor    %edx,%edx
+ 2f5:	89 f0                	mov    %esi,%eax
+ 2f7:	f7 f1                	div    %ecx
+ 2f9:	8b 04 93             	mov    (%ebx,%edx,4),%eax
+ 2fc:	8b 54 b3 fc          	mov    -0x4(%ebx,%esi,4),%edx
+ 300:	01 f8                	add    %edi,%eax
+ 302:	89 04 17             	mov    %eax,(%edi,%edx,1)
+  for(i = 0; i < npg; i++)
+ 305:	39 f1                	cmp    %esi,%ecx
+ 307:	75 e7                	jne    2f0 <run+0x90>
+  c.start = (void**)(base + perm[0]);
+ 309:	8b 03                	mov    (%ebx),%eax
+ 30b:	01 f8                	add    %edi,%eax
+ 30d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while(c.n < MINOPS)
+ 310:	89 c8                	mov    %ecx,%eax
+ 312:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    c.n += size / PG;
+ 318:	01 c8                	add    %ecx,%eax
+  while(c.n < MINOPS)
+ 31a:	3d ff ff 03 00       	cmp    $0x3ffff,%eax
+ 31f:	76 f7                	jbe    318 <run+0xb8>
+  bench(0, chase, &c, c.n, RUNS, st);
+ 321:	83 ec 08             	sub    $0x8,%esp
+ 324:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 327:	ff 75 0c             	push   0xc(%ebp)
+ 32a:	6a 05                	push   $0x5
+ 32c:	50                   	push   %eax
+ 32d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 330:	50                   	push   %eax
+ 331:	68 30 02 00 00       	push   $0x230
+ 336:	6a 00                	push   $0x0
+ 338:	e8 93 09 00 00       	call   cd0 <bench>
+}
+ 33d:	83 c4 20             	add    $0x20,%esp
+ 340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 343:	5b                   	pop    %ebx
+ 344:	5e                   	pop    %esi
+ 345:	5f                   	pop    %edi
+ 346:	5d                   	pop    %ebp
+ 347:	c3                   	ret
+ 348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+      perm[i] = (perm[i] * (uint)(HUGEPG + 64)) & (size - 1);
+ 350:	69 c0 40 00 40 00    	imul   $0x400040,%eax,%eax
+ 356:	8b 7d d0             	mov    -0x30(%ebp),%edi
+ 359:	21 f8                	and    %edi,%eax
+ 35b:	e9 53 ff ff ff       	jmp    2b3 <run+0x53>
+    for(i = npg - 1; i > 0; i--){
+ 360:	8d 71 ff             	lea    -0x1(%ecx),%esi
+ 363:	a1 78 14 00 00       	mov    0x1478,%eax
+ 368:	89 7d c8             	mov    %edi,-0x38(%ebp)
+ 36b:	83 c6 01             	add    $0x1,%esi
+ 36e:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+ 371:	89 c1                	mov    %eax,%ecx
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+  seed ^= seed << 13;
+ 378:	89 ca                	mov    %ecx,%edx
+      off = perm[i];
+ 37a:	8b 7c b3 fc          	mov    -0x4(%ebx,%esi,4),%edi
+  seed ^= seed << 13;
+ 37e:	c1 e2 0d             	shl    $0xd,%edx
+ 381:	31 ca                	xor    %ecx,%edx
+  seed ^= seed >> 17;
+ 383:	89 d0                	mov    %edx,%eax
+ 385:	c1 e8 11             	shr    $0x11,%eax
+ 388:	31 d0                	xor    %edx,%eax
+      next = rand() % (i + 1);
+ 38a:	31 d2                	xor    %edx,%edx
+  seed ^= seed << 5;
+ 38c:	89 c1                	mov    %eax,%ecx
+ 38e:	c1 e1 05             	shl    $0x5,%ecx
+ 391:	31 c1                	xor    %eax,%ecx
+      next = rand() % (i + 1);
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	f7 f6                	div    %esi
+      perm[i] = perm[next];
+ 397:	8d 14 93             	lea    (%ebx,%edx,4),%edx
+ 39a:	8b 02                	mov    (%edx),%eax
+ 39c:	89 44 b3 fc          	mov    %eax,-0x4(%ebx,%esi,4)
+    for(i = npg - 1; i > 0; i--){
+ 3a0:	83 ee 01             	sub    $0x1,%esi
+      perm[next] = off;
+ 3a3:	89 3a                	mov    %edi,(%edx)
+    for(i = npg - 1; i > 0; i--){
+ 3a5:	83 fe 01             	cmp    $0x1,%esi
+ 3a8:	75 ce                	jne    378 <run+0x118>
+ 3aa:	89 43 04             	mov    %eax,0x4(%ebx)
+ 3ad:	89 ce                	mov    %ecx,%esi
+ 3af:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+ 3b2:	89 7d cc             	mov    %edi,-0x34(%ebp)
+ 3b5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 3b8:	89 35 78 14 00 00    	mov    %esi,0x1478
+ 3be:	8b 7d c8             	mov    -0x38(%ebp),%edi
+ 3c1:	89 02                	mov    %eax,(%edx)
+  for(i = 0; i < npg; i++){
+ 3c3:	85 c9                	test   %ecx,%ecx
+ 3c5:	0f 85 d1 fe ff ff    	jne    29c <run+0x3c>
+ 3cb:	e9 39 ff ff ff       	jmp    309 <run+0xa9>
+  if(pattern == RANDOM){
+ 3d0:	83 7d d4 02          	cmpl   $0x2,-0x2c(%ebp)
+ 3d4:	0f 85 2f ff ff ff    	jne    309 <run+0xa9>
+    for(i = npg - 1; i > 0; i--){
+ 3da:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3df:	eb 82                	jmp    363 <run+0x103>
+ 3e1:	66 90                	xchg   %ax,%ax
+ 3e3:	66 90                	xchg   %ax,%ax
+ 3e5:	66 90                	xchg   %ax,%ax
+ 3e7:	66 90                	xchg   %ax,%ax
+ 3e9:	66 90                	xchg   %ax,%ax
+ 3eb:	66 90                	xchg   %ax,%ax
+ 3ed:	66 90                	xchg   %ax,%ax
+ 3ef:	90                   	nop
+
+000003f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 400:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 404:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 407:	83 c0 01             	add    $0x1,%eax
+ 40a:	84 d2                	test   %dl,%dl
+ 40c:	75 f2                	jne    400 <strcpy+0x10>
+    ;
+  return os;
+}
+ 40e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+ 427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 42a:	0f b6 02             	movzbl (%edx),%eax
+ 42d:	84 c0                	test   %al,%al
+ 42f:	75 17                	jne    448 <strcmp+0x28>
+ 431:	eb 3a                	jmp    46d <strcmp+0x4d>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 43c:	83 c2 01             	add    $0x1,%edx
+ 43f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 442:	84 c0                	test   %al,%al
+ 444:	74 1a                	je     460 <strcmp+0x40>
+    p++, q++;
+ 446:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 448:	0f b6 19             	movzbl (%ecx),%ebx
+ 44b:	38 c3                	cmp    %al,%bl
+ 44d:	74 e9                	je     438 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 44f:	29 d8                	sub    %ebx,%eax
+}
+ 451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 454:	c9                   	leave
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 460:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 464:	31 c0                	xor    %eax,%eax
+ 466:	29 d8                	sub    %ebx,%eax
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+ 46c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 46d:	0f b6 19             	movzbl (%ecx),%ebx
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	eb db                	jmp    44f <strcmp+0x2f>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 486:	80 3a 00             	cmpb   $0x0,(%edx)
+ 489:	74 15                	je     4a0 <strlen+0x20>
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+ 490:	83 c0 01             	add    $0x1,%eax
+ 493:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 497:	89 c1                	mov    %eax,%ecx
+ 499:	75 f5                	jne    490 <strlen+0x10>
+    ;
+  return n;
+}
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	5d                   	pop    %ebp
+ 49e:	c3                   	ret
+ 49f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4a0:	31 c9                	xor    %ecx,%ecx
+}
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	89 c8                	mov    %ecx,%eax
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 d7                	mov    %edx,%edi
+ 4bf:	fc                   	cld
+ 4c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	c9                   	leave
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4da:	0f b6 10             	movzbl (%eax),%edx
+ 4dd:	84 d2                	test   %dl,%dl
+ 4df:	75 12                	jne    4f3 <strchr+0x23>
+ 4e1:	eb 1d                	jmp    500 <strchr+0x30>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	84 d2                	test   %dl,%dl
+ 4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+ 4f3:	38 d1                	cmp    %dl,%cl
+ 4f5:	75 f1                	jne    4e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 500:	31 c0                	xor    %eax,%eax
+}
+ 502:	5d                   	pop    %ebp
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 515:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 518:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 519:	31 db                	xor    %ebx,%ebx
+{
+ 51b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 51e:	eb 27                	jmp    547 <gets+0x37>
+    cc = read(0, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	6a 01                	push   $0x1
+ 525:	56                   	push   %esi
+ 526:	6a 00                	push   $0x0
+ 528:	e8 e3 01 00 00       	call   710 <read>
+    if(cc < 1)
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	85 c0                	test   %eax,%eax
+ 532:	7e 1d                	jle    551 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 534:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 53f:	3c 0a                	cmp    $0xa,%al
+ 541:	74 10                	je     553 <gets+0x43>
+ 543:	3c 0d                	cmp    $0xd,%al
+ 545:	74 0c                	je     553 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 547:	89 df                	mov    %ebx,%edi
+ 549:	83 c3 01             	add    $0x1,%ebx
+ 54c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 54f:	7c cf                	jl     520 <gets+0x10>
+ 551:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 55a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55d:	5b                   	pop    %ebx
+ 55e:	5e                   	pop    %esi
+ 55f:	5f                   	pop    %edi
+ 560:	5d                   	pop    %ebp
+ 561:	c3                   	ret
+ 562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	56                   	push   %esi
+ 574:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	6a 00                	push   $0x0
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 b6 01 00 00       	call   738 <open>
+  if(fd < 0)
+ 582:	83 c4 10             	add    $0x10,%esp
+ 585:	85 c0                	test   %eax,%eax
+ 587:	78 27                	js     5b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 589:	83 ec 08             	sub    $0x8,%esp
+ 58c:	ff 75 0c             	push   0xc(%ebp)
+ 58f:	89 c3                	mov    %eax,%ebx
+ 591:	50                   	push   %eax
+ 592:	e8 b9 01 00 00       	call   750 <fstat>
+  close(fd);
+ 597:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 59a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 59c:	e8 7f 01 00 00       	call   720 <close>
+  return r;
+ 5a1:	83 c4 10             	add    $0x10,%esp
+}
+ 5a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5a7:	89 f0                	mov    %esi,%eax
+ 5a9:	5b                   	pop    %ebx
+ 5aa:	5e                   	pop    %esi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5b5:	eb ed                	jmp    5a4 <stat+0x34>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5c7:	0f be 02             	movsbl (%edx),%eax
+ 5ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5d5:	77 1e                	ja     5f5 <atoi+0x35>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ea:	0f be 02             	movsbl (%edx),%eax
+ 5ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5f0:	80 fb 09             	cmp    $0x9,%bl
+ 5f3:	76 eb                	jbe    5e0 <atoi+0x20>
+  return n;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5f8:	89 c8                	mov    %ecx,%eax
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	8b 45 10             	mov    0x10(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 60e:	85 c0                	test   %eax,%eax
+ 610:	7e 13                	jle    625 <memmove+0x25>
+ 612:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 614:	89 d7                	mov    %edx,%edi
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 620:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 621:	39 f8                	cmp    %edi,%eax
+ 623:	75 fb                	jne    620 <memmove+0x20>
+  return vdst;
+}
+ 625:	5e                   	pop    %esi
+ 626:	89 d0                	mov    %edx,%eax
+ 628:	5f                   	pop    %edi
+ 629:	5d                   	pop    %ebp
+ 62a:	c3                   	ret
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+
+00000630 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 630:	55                   	push   %ebp
+ 631:	31 d2                	xor    %edx,%edx
+ 633:	89 e5                	mov    %esp,%ebp
+ 635:	53                   	push   %ebx
+ 636:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 639:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 63c:	f7 f3                	div    %ebx
+ 63e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 640:	8b 45 08             	mov    0x8(%ebp),%eax
+ 643:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 648:	89 ca                	mov    %ecx,%edx
+}
+ 64a:	c9                   	leave
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 650:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 652:	c3                   	ret
+ 653:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000660 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 669:	8b 35 7c 14 00 00    	mov    0x147c,%esi
+{
+ 66f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 672:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 675:	85 f6                	test   %esi,%esi
+ 677:	74 2f                	je     6a8 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 679:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 67e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 684:	f7 e3                	mul    %ebx
+ 686:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 689:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 68c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	f7 f6                	div    %esi
+ 693:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 695:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 698:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 69b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 69d:	89 da                	mov    %ebx,%edx
+}
+ 69f:	5b                   	pop    %ebx
+ 6a0:	5e                   	pop    %esi
+ 6a1:	5f                   	pop    %edi
+ 6a2:	5d                   	pop    %ebp
+ 6a3:	c3                   	ret
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 6a8:	e8 0b 01 00 00       	call   7b8 <tscfreq>
+ 6ad:	a3 7c 14 00 00       	mov    %eax,0x147c
+ 6b2:	89 c6                	mov    %eax,%esi
+ 6b4:	eb c3                	jmp    679 <cyc2ns+0x19>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	53                   	push   %ebx
+ 6c4:	83 ec 10             	sub    $0x10,%esp
+ 6c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 6ca:	6a 00                	push   $0x0
+ 6cc:	e8 3f 01 00 00       	call   810 <getpriority>
+ 6d1:	5a                   	pop    %edx
+ 6d2:	59                   	pop    %ecx
+ 6d3:	01 d8                	add    %ebx,%eax
+ 6d5:	50                   	push   %eax
+ 6d6:	6a 00                	push   $0x0
+ 6d8:	e8 2b 01 00 00       	call   808 <setpriority>
+  return getpriority(0);
+ 6dd:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 6e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 6e7:	83 c4 10             	add    $0x10,%esp
+}
+ 6ea:	c9                   	leave
+  return getpriority(0);
+ 6eb:	e9 20 01 00 00       	jmp    810 <getpriority>
+
+000006f0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <exit>:
+SYSCALL(exit)
+ 6f8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <wait>:
+SYSCALL(wait)
+ 700:	b8 03 00 00 00       	mov    $0x3,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <pipe>:
+SYSCALL(pipe)
+ 708:	b8 04 00 00 00       	mov    $0x4,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <read>:
+SYSCALL(read)
+ 710:	b8 05 00 00 00       	mov    $0x5,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <write>:
+SYSCALL(write)
+ 718:	b8 10 00 00 00       	mov    $0x10,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <close>:
+SYSCALL(close)
+ 720:	b8 15 00 00 00       	mov    $0x15,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <kill>:
+SYSCALL(kill)
+ 728:	b8 06 00 00 00       	mov    $0x6,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <exec>:
+SYSCALL(exec)
+ 730:	b8 07 00 00 00       	mov    $0x7,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <open>:
+SYSCALL(open)
+ 738:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <mknod>:
+SYSCALL(mknod)
+ 740:	b8 11 00 00 00       	mov    $0x11,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <unlink>:
+SYSCALL(unlink)
+ 748:	b8 12 00 00 00       	mov    $0x12,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <fstat>:
+SYSCALL(fstat)
+ 750:	b8 08 00 00 00       	mov    $0x8,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <link>:
+SYSCALL(link)
+ 758:	b8 13 00 00 00       	mov    $0x13,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <mkdir>:
+SYSCALL(mkdir)
+ 760:	b8 14 00 00 00       	mov    $0x14,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <chdir>:
+SYSCALL(chdir)
+ 768:	b8 09 00 00 00       	mov    $0x9,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <dup>:
+SYSCALL(dup)
+ 770:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <getpid>:
+SYSCALL(getpid)
+ 778:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <sbrk>:
+SYSCALL(sbrk)
+ 780:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <sleep>:
+SYSCALL(sleep)
+ 788:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <uptime>:
+SYSCALL(uptime)
+ 790:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 795:	cd 40                	int    $0x40
+ 797:	c3                   	ret
+
+00000798 <promote>:
+
+SYSCALL(promote)
+ 798:	b8 18 00 00 00       	mov    $0x18,%eax
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <demote>:
+SYSCALL(demote)
+ 7a0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+
+000007a8 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 7a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ad:	cd 40                	int    $0x40
+ 7af:	c3                   	ret
+
+000007b0 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 7b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7b5:	cd 40                	int    $0x40
+ 7b7:	c3                   	ret
+
+000007b8 <tscfreq>:
+SYSCALL(tscfreq)
+ 7b8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7bd:	cd 40                	int    $0x40
+ 7bf:	c3                   	ret
+
+000007c0 <tracemask>:
+SYSCALL(tracemask)
+ 7c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7c5:	cd 40                	int    $0x40
+ 7c7:	c3                   	ret
+
+000007c8 <traceread>:
+SYSCALL(traceread)
+ 7c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7cd:	cd 40                	int    $0x40
+ 7cf:	c3                   	ret
+
+000007d0 <profile>:
+SYSCALL(profile)
+ 7d0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7d5:	cd 40                	int    $0x40
+ 7d7:	c3                   	ret
+
+000007d8 <profread>:
+SYSCALL(profread)
+ 7d8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7dd:	cd 40                	int    $0x40
+ 7df:	c3                   	ret
+
+000007e0 <lockstat>:
+SYSCALL(lockstat)
+ 7e0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7e5:	cd 40                	int    $0x40
+ 7e7:	c3                   	ret
+
+000007e8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 7e8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7ed:	cd 40                	int    $0x40
+ 7ef:	c3                   	ret
+
+000007f0 <sysstat>:
+SYSCALL(sysstat)
+ 7f0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7f5:	cd 40                	int    $0x40
+ 7f7:	c3                   	ret
+
+000007f8 <kbench>:
+SYSCALL(kbench)
+ 7f8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7fd:	cd 40                	int    $0x40
+ 7ff:	c3                   	ret
+
+00000800 <yield>:
+SYSCALL(yield)
+ 800:	b8 25 00 00 00       	mov    $0x25,%eax
+ 805:	cd 40                	int    $0x40
+ 807:	c3                   	ret
+
+00000808 <setpriority>:
+SYSCALL(setpriority)
+ 808:	b8 26 00 00 00       	mov    $0x26,%eax
+ 80d:	cd 40                	int    $0x40
+ 80f:	c3                   	ret
+
+00000810 <getpriority>:
+SYSCALL(getpriority)
+ 810:	b8 27 00 00 00       	mov    $0x27,%eax
+ 815:	cd 40                	int    $0x40
+ 817:	c3                   	ret
+
+00000818 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 818:	b8 28 00 00 00       	mov    $0x28,%eax
+ 81d:	cd 40                	int    $0x40
+ 81f:	c3                   	ret
+
+00000820 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 820:	b8 29 00 00 00       	mov    $0x29,%eax
+ 825:	cd 40                	int    $0x40
+ 827:	c3                   	ret
+
+00000828 <clone>:
+SYSCALL(clone)
+ 828:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 82d:	cd 40                	int    $0x40
+ 82f:	c3                   	ret
+
+00000830 <join>:
+SYSCALL(join)
+ 830:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 835:	cd 40                	int    $0x40
+ 837:	c3                   	ret
+
+00000838 <futex_wait>:
+SYSCALL(futex_wait)
+ 838:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 83d:	cd 40                	int    $0x40
+ 83f:	c3                   	ret
+
+00000840 <futex_wake>:
+SYSCALL(futex_wake)
+ 840:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 845:	cd 40                	int    $0x40
+ 847:	c3                   	ret
+
+00000848 <spawn>:
+SYSCALL(spawn)
+ 848:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 84d:	cd 40                	int    $0x40
+ 84f:	c3                   	ret
+
+00000850 <diskstat>:
+SYSCALL(diskstat)
+ 850:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 855:	cd 40                	int    $0x40
+ 857:	c3                   	ret
+ 858:	66 90                	xchg   %ax,%ax
+ 85a:	66 90                	xchg   %ax,%ax
+ 85c:	66 90                	xchg   %ax,%ax
+ 85e:	66 90                	xchg   %ax,%ax
+
+00000860 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 868:	89 d1                	mov    %edx,%ecx
+{
+ 86a:	83 ec 3c             	sub    $0x3c,%esp
+ 86d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 870:	85 d2                	test   %edx,%edx
+ 872:	0f 89 80 00 00 00    	jns    8f8 <printint+0x98>
+ 878:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 87c:	74 7a                	je     8f8 <printint+0x98>
+    x = -xx;
+ 87e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 880:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 885:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 888:	31 f6                	xor    %esi,%esi
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 890:	89 c8                	mov    %ecx,%eax
+ 892:	31 d2                	xor    %edx,%edx
+ 894:	89 f7                	mov    %esi,%edi
+ 896:	f7 f3                	div    %ebx
+ 898:	8d 76 01             	lea    0x1(%esi),%esi
+ 89b:	0f b6 92 60 10 00 00 	movzbl 0x1060(%edx),%edx
+ 8a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8a6:	89 ca                	mov    %ecx,%edx
+ 8a8:	89 c1                	mov    %eax,%ecx
+ 8aa:	39 da                	cmp    %ebx,%edx
+ 8ac:	73 e2                	jae    890 <printint+0x30>
+  if(neg)
+ 8ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8b1:	85 c0                	test   %eax,%eax
+ 8b3:	74 07                	je     8bc <printint+0x5c>
+    buf[i++] = '-';
+ 8b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8ba:	89 f7                	mov    %esi,%edi
+ 8bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8c2:	01 df                	add    %ebx,%edi
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8cb:	83 ec 04             	sub    $0x4,%esp
+ 8ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8d4:	6a 01                	push   $0x1
+ 8d6:	50                   	push   %eax
+ 8d7:	56                   	push   %esi
+ 8d8:	e8 3b fe ff ff       	call   718 <write>
+  while(--i >= 0)
+ 8dd:	89 f8                	mov    %edi,%eax
+ 8df:	83 c4 10             	add    $0x10,%esp
+ 8e2:	83 ef 01             	sub    $0x1,%edi
+ 8e5:	39 d8                	cmp    %ebx,%eax
+ 8e7:	75 df                	jne    8c8 <printint+0x68>
+}
+ 8e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ec:	5b                   	pop    %ebx
+ 8ed:	5e                   	pop    %esi
+ 8ee:	5f                   	pop    %edi
+ 8ef:	5d                   	pop    %ebp
+ 8f0:	c3                   	ret
+ 8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8f8:	31 c0                	xor    %eax,%eax
+ 8fa:	eb 89                	jmp    885 <printint+0x25>
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 909:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 90c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 90f:	0f b6 1e             	movzbl (%esi),%ebx
+ 912:	83 c6 01             	add    $0x1,%esi
+ 915:	84 db                	test   %bl,%bl
+ 917:	74 67                	je     980 <printf+0x80>
+ 919:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 91c:	31 d2                	xor    %edx,%edx
+ 91e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 921:	eb 34                	jmp    957 <printf+0x57>
+ 923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 927:	90                   	nop
+ 928:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 92b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 930:	83 f8 25             	cmp    $0x25,%eax
+ 933:	74 18                	je     94d <printf+0x4d>
+  write(fd, &c, 1);
+ 935:	83 ec 04             	sub    $0x4,%esp
+ 938:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 93b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 93e:	6a 01                	push   $0x1
+ 940:	50                   	push   %eax
+ 941:	57                   	push   %edi
+ 942:	e8 d1 fd ff ff       	call   718 <write>
+ 947:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 94a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 94d:	0f b6 1e             	movzbl (%esi),%ebx
+ 950:	83 c6 01             	add    $0x1,%esi
+ 953:	84 db                	test   %bl,%bl
+ 955:	74 29                	je     980 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 957:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 95a:	85 d2                	test   %edx,%edx
+ 95c:	74 ca                	je     928 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 95e:	83 fa 25             	cmp    $0x25,%edx
+ 961:	75 ea                	jne    94d <printf+0x4d>
+      if(c == 'd'){
+ 963:	83 f8 25             	cmp    $0x25,%eax
+ 966:	0f 84 24 01 00 00    	je     a90 <printf+0x190>
+ 96c:	83 e8 63             	sub    $0x63,%eax
+ 96f:	83 f8 15             	cmp    $0x15,%eax
+ 972:	77 1c                	ja     990 <printf+0x90>
+ 974:	ff 24 85 08 10 00 00 	jmp    *0x1008(,%eax,4)
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 983:	5b                   	pop    %ebx
+ 984:	5e                   	pop    %esi
+ 985:	5f                   	pop    %edi
+ 986:	5d                   	pop    %ebp
+ 987:	c3                   	ret
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 996:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 99a:	6a 01                	push   $0x1
+ 99c:	52                   	push   %edx
+ 99d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9a0:	57                   	push   %edi
+ 9a1:	e8 72 fd ff ff       	call   718 <write>
+ 9a6:	83 c4 0c             	add    $0xc,%esp
+ 9a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ac:	6a 01                	push   $0x1
+ 9ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9b1:	52                   	push   %edx
+ 9b2:	57                   	push   %edi
+ 9b3:	e8 60 fd ff ff       	call   718 <write>
+        putc(fd, c);
+ 9b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9bb:	31 d2                	xor    %edx,%edx
+ 9bd:	eb 8e                	jmp    94d <printf+0x4d>
+ 9bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9cb:	8b 13                	mov    (%ebx),%edx
+ 9cd:	6a 00                	push   $0x0
+ 9cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9d4:	e8 87 fe ff ff       	call   860 <printint>
+        ap++;
+ 9d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9df:	31 d2                	xor    %edx,%edx
+ 9e1:	e9 67 ff ff ff       	jmp    94d <printf+0x4d>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9f5:	83 c0 04             	add    $0x4,%eax
+ 9f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9fb:	85 db                	test   %ebx,%ebx
+ 9fd:	0f 84 9d 00 00 00    	je     aa0 <printf+0x1a0>
+        while(*s != 0){
+ a03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a08:	84 c0                	test   %al,%al
+ a0a:	0f 84 3d ff ff ff    	je     94d <printf+0x4d>
+ a10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a16:	89 de                	mov    %ebx,%esi
+ a18:	89 d3                	mov    %edx,%ebx
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	53                   	push   %ebx
+ a2c:	57                   	push   %edi
+ a2d:	e8 e6 fc ff ff       	call   718 <write>
+        while(*s != 0){
+ a32:	0f b6 06             	movzbl (%esi),%eax
+ a35:	83 c4 10             	add    $0x10,%esp
+ a38:	84 c0                	test   %al,%al
+ a3a:	75 e4                	jne    a20 <printf+0x120>
+      state = 0;
+ a3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a3f:	31 d2                	xor    %edx,%edx
+ a41:	e9 07 ff ff ff       	jmp    94d <printf+0x4d>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a5b:	8b 13                	mov    (%ebx),%edx
+ a5d:	6a 01                	push   $0x1
+ a5f:	e9 6b ff ff ff       	jmp    9cf <printf+0xcf>
+ a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a6b:	83 ec 04             	sub    $0x4,%esp
+ a6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a79:	6a 01                	push   $0x1
+ a7b:	52                   	push   %edx
+ a7c:	57                   	push   %edi
+ a7d:	e8 96 fc ff ff       	call   718 <write>
+        ap++;
+ a82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a88:	31 d2                	xor    %edx,%edx
+ a8a:	e9 be fe ff ff       	jmp    94d <printf+0x4d>
+ a8f:	90                   	nop
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a99:	6a 01                	push   $0x1
+ a9b:	e9 11 ff ff ff       	jmp    9b1 <printf+0xb1>
+ aa0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ aa5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ aaa:	e9 61 ff ff ff       	jmp    a10 <printf+0x110>
+ aaf:	90                   	nop
+
+00000ab0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ab0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ab1:	a1 80 14 00 00       	mov    0x1480,%eax
+{
+ ab6:	89 e5                	mov    %esp,%ebp
+ ab8:	57                   	push   %edi
+ ab9:	56                   	push   %esi
+ aba:	53                   	push   %ebx
+ abb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ abe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ acc:	39 ca                	cmp    %ecx,%edx
+ ace:	73 30                	jae    b00 <free+0x50>
+ ad0:	39 c1                	cmp    %eax,%ecx
+ ad2:	72 04                	jb     ad8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad4:	39 c2                	cmp    %eax,%edx
+ ad6:	72 f0                	jb     ac8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ad8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ adb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ ade:	39 f8                	cmp    %edi,%eax
+ ae0:	74 2e                	je     b10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ae5:	8b 42 04             	mov    0x4(%edx),%eax
+ ae8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aeb:	39 f1                	cmp    %esi,%ecx
+ aed:	74 38                	je     b27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ af1:	5b                   	pop    %ebx
+  freep = p;
+ af2:	89 15 80 14 00 00    	mov    %edx,0x1480
+}
+ af8:	5e                   	pop    %esi
+ af9:	5f                   	pop    %edi
+ afa:	5d                   	pop    %ebp
+ afb:	c3                   	ret
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b00:	39 c1                	cmp    %eax,%ecx
+ b02:	72 d0                	jb     ad4 <free+0x24>
+ b04:	eb c2                	jmp    ac8 <free+0x18>
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b10:	03 70 04             	add    0x4(%eax),%esi
+ b13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b16:	8b 02                	mov    (%edx),%eax
+ b18:	8b 00                	mov    (%eax),%eax
+ b1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b1d:	8b 42 04             	mov    0x4(%edx),%eax
+ b20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b23:	39 f1                	cmp    %esi,%ecx
+ b25:	75 c8                	jne    aef <free+0x3f>
+    p->s.size += bp->s.size;
+ b27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b2a:	89 15 80 14 00 00    	mov    %edx,0x1480
+    p->s.size += bp->s.size;
+ b30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b36:	89 0a                	mov    %ecx,(%edx)
+}
+ b38:	5b                   	pop    %ebx
+ b39:	5e                   	pop    %esi
+ b3a:	5f                   	pop    %edi
+ b3b:	5d                   	pop    %ebp
+ b3c:	c3                   	ret
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b4c:	8b 15 80 14 00 00    	mov    0x1480,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b52:	8d 78 07             	lea    0x7(%eax),%edi
+ b55:	c1 ef 03             	shr    $0x3,%edi
+ b58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b5b:	85 d2                	test   %edx,%edx
+ b5d:	0f 84 8d 00 00 00    	je     bf0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b65:	8b 48 04             	mov    0x4(%eax),%ecx
+ b68:	39 f9                	cmp    %edi,%ecx
+ b6a:	73 64                	jae    bd0 <malloc+0x90>
+  if(nu < 4096)
+ b6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b71:	39 df                	cmp    %ebx,%edi
+ b73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b7d:	eb 0a                	jmp    b89 <malloc+0x49>
+ b7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b82:	8b 48 04             	mov    0x4(%eax),%ecx
+ b85:	39 f9                	cmp    %edi,%ecx
+ b87:	73 47                	jae    bd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b89:	89 c2                	mov    %eax,%edx
+ b8b:	39 05 80 14 00 00    	cmp    %eax,0x1480
+ b91:	75 ed                	jne    b80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	56                   	push   %esi
+ b97:	e8 e4 fb ff ff       	call   780 <sbrk>
+  if(p == (char*)-1)
+ b9c:	83 c4 10             	add    $0x10,%esp
+ b9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ba2:	74 1c                	je     bc0 <malloc+0x80>
+  hp->s.size = nu;
+ ba4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ba7:	83 ec 0c             	sub    $0xc,%esp
+ baa:	83 c0 08             	add    $0x8,%eax
+ bad:	50                   	push   %eax
+ bae:	e8 fd fe ff ff       	call   ab0 <free>
+  return freep;
+ bb3:	8b 15 80 14 00 00    	mov    0x1480,%edx
+      if((p = morecore(nunits)) == 0)
+ bb9:	83 c4 10             	add    $0x10,%esp
+ bbc:	85 d2                	test   %edx,%edx
+ bbe:	75 c0                	jne    b80 <malloc+0x40>
+        return 0;
+  }
+}
+ bc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bc3:	31 c0                	xor    %eax,%eax
+}
+ bc5:	5b                   	pop    %ebx
+ bc6:	5e                   	pop    %esi
+ bc7:	5f                   	pop    %edi
+ bc8:	5d                   	pop    %ebp
+ bc9:	c3                   	ret
+ bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bd0:	39 cf                	cmp    %ecx,%edi
+ bd2:	74 4c                	je     c20 <malloc+0xe0>
+        p->s.size -= nunits;
+ bd4:	29 f9                	sub    %edi,%ecx
+ bd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bdc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bdf:	89 15 80 14 00 00    	mov    %edx,0x1480
+}
+ be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ be8:	83 c0 08             	add    $0x8,%eax
+}
+ beb:	5b                   	pop    %ebx
+ bec:	5e                   	pop    %esi
+ bed:	5f                   	pop    %edi
+ bee:	5d                   	pop    %ebp
+ bef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bf0:	c7 05 80 14 00 00 84 	movl   $0x1484,0x1480
+ bf7:	14 00 00 
+    base.s.size = 0;
+ bfa:	b8 84 14 00 00       	mov    $0x1484,%eax
+    base.s.ptr = freep = prevp = &base;
+ bff:	c7 05 84 14 00 00 84 	movl   $0x1484,0x1484
+ c06:	14 00 00 
+    base.s.size = 0;
+ c09:	c7 05 88 14 00 00 00 	movl   $0x0,0x1488
+ c10:	00 00 00 
+    if(p->s.size >= nunits){
+ c13:	e9 54 ff ff ff       	jmp    b6c <malloc+0x2c>
+ c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c20:	8b 08                	mov    (%eax),%ecx
+ c22:	89 0a                	mov    %ecx,(%edx)
+ c24:	eb b9                	jmp    bdf <malloc+0x9f>
+ c26:	66 90                	xchg   %ax,%ax
+ c28:	66 90                	xchg   %ax,%ax
+ c2a:	66 90                	xchg   %ax,%ax
+ c2c:	66 90                	xchg   %ax,%ax
+ c2e:	66 90                	xchg   %ax,%ax
+
+00000c30 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	57                   	push   %edi
+ c34:	56                   	push   %esi
+ c35:	53                   	push   %ebx
+ c36:	83 ec 20             	sub    $0x20,%esp
+ c39:	8b 75 0c             	mov    0xc(%ebp),%esi
+ c3c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ c3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ c42:	68 e8 03 00 00       	push   $0x3e8
+ c47:	57                   	push   %edi
+ c48:	56                   	push   %esi
+ c49:	e8 e2 f9 ff ff       	call   630 <udiv64>
+ c4e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ c50:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ c53:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ c59:	29 c1                	sub    %eax,%ecx
+ c5b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ c5e:	68 e8 03 00 00       	push   $0x3e8
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	e8 c6 f9 ff ff       	call   630 <udiv64>
+ c6a:	83 c4 0c             	add    $0xc,%esp
+ c6d:	50                   	push   %eax
+ c6e:	68 71 10 00 00       	push   $0x1071
+ c73:	53                   	push   %ebx
+ c74:	e8 87 fc ff ff       	call   900 <printf>
+  if(frac < 100)
+ c79:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ c7c:	83 c4 10             	add    $0x10,%esp
+ c7f:	83 f9 63             	cmp    $0x63,%ecx
+ c82:	76 1c                	jbe    ca0 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ c84:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ c87:	c7 45 0c 77 10 00 00 	movl   $0x1077,0xc(%ebp)
+ c8e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ c91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c94:	5b                   	pop    %ebx
+ c95:	5e                   	pop    %esi
+ c96:	5f                   	pop    %edi
+ c97:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ c98:	e9 63 fc ff ff       	jmp    900 <printf>
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ ca0:	83 ec 08             	sub    $0x8,%esp
+ ca3:	68 75 10 00 00       	push   $0x1075
+ ca8:	53                   	push   %ebx
+ ca9:	e8 52 fc ff ff       	call   900 <printf>
+  if(frac < 10)
+ cae:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ cb1:	83 c4 10             	add    $0x10,%esp
+ cb4:	83 f9 09             	cmp    $0x9,%ecx
+ cb7:	77 cb                	ja     c84 <printps+0x54>
+    printf(fd, "0");
+ cb9:	83 ec 08             	sub    $0x8,%esp
+ cbc:	68 75 10 00 00       	push   $0x1075
+ cc1:	53                   	push   %ebx
+ cc2:	e8 39 fc ff ff       	call   900 <printf>
+ cc7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ cca:	83 c4 10             	add    $0x10,%esp
+ ccd:	eb b5                	jmp    c84 <printps+0x54>
+ ccf:	90                   	nop
+
+00000cd0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	57                   	push   %edi
+ cd4:	56                   	push   %esi
+ cd5:	53                   	push   %ebx
+ cd6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ cdc:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ cdf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ ce2:	83 e8 01             	sub    $0x1,%eax
+ ce5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ cea:	0f 87 37 02 00 00    	ja     f27 <bench+0x257>
+ cf0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ cf3:	85 ff                	test   %edi,%edi
+ cf5:	0f 84 2c 02 00 00    	je     f27 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ cfb:	83 ec 0c             	sub    $0xc,%esp
+ cfe:	ff 75 10             	push   0x10(%ebp)
+ d01:	ff 55 0c             	call   *0xc(%ebp)
+ d04:	5b                   	pop    %ebx
+ d05:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ d08:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ d0a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ d0d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ d10:	83 c4 10             	add    $0x10,%esp
+ d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d17:	90                   	nop
+    t0 = cycles();
+ d18:	e8 33 f9 ff ff       	call   650 <cycles>
+    fn(arg);
+ d1d:	83 ec 0c             	sub    $0xc,%esp
+ d20:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ d23:	89 c6                	mov    %eax,%esi
+ d25:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ d27:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ d2a:	e8 21 f9 ff ff       	call   650 <cycles>
+ d2f:	29 f0                	sub    %esi,%eax
+ d31:	19 fa                	sbb    %edi,%edx
+ d33:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ d3a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ d3d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ d44:	83 c3 01             	add    $0x1,%ebx
+ d47:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ d4a:	7f cc                	jg     d18 <bench+0x48>
+  for(i = 1; i < n; i++){
+ d4c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ d50:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ d53:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ d59:	bf 01 00 00 00       	mov    $0x1,%edi
+ d5e:	74 77                	je     dd7 <bench+0x107>
+ d60:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d67:	90                   	nop
+    v = a[i];
+ d68:	8b 01                	mov    (%ecx),%eax
+ d6a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ d6d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ d73:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ d79:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ d7f:	89 c8                	mov    %ecx,%eax
+ d81:	eb 1b                	jmp    d9e <bench+0xce>
+ d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d87:	90                   	nop
+      a[j] = a[j-1];
+ d88:	89 08                	mov    %ecx,(%eax)
+ d8a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ d8d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ d90:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ d96:	39 c3                	cmp    %eax,%ebx
+ d98:	0f 84 72 01 00 00    	je     f10 <bench+0x240>
+ d9e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ da1:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ da4:	89 f7                	mov    %esi,%edi
+ da6:	89 c3                	mov    %eax,%ebx
+ da8:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ dae:	19 d7                	sbb    %edx,%edi
+ db0:	72 d6                	jb     d88 <bench+0xb8>
+ db2:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ db8:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ dbe:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ dc4:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ dc7:	83 c7 01             	add    $0x1,%edi
+ dca:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ dcd:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ dcf:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ dd2:	75 94                	jne    d68 <bench+0x98>
+ dd4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ dd7:	83 ec 08             	sub    $0x8,%esp
+ dda:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ de0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ de5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ deb:	e8 70 f8 ff ff       	call   660 <cyc2ns>
+ df0:	83 c4 0c             	add    $0xc,%esp
+ df3:	ff 75 14             	push   0x14(%ebp)
+ df6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ dfc:	f7 e3                	mul    %ebx
+ dfe:	01 ca                	add    %ecx,%edx
+ e00:	52                   	push   %edx
+ e01:	50                   	push   %eax
+ e02:	e8 29 f8 ff ff       	call   630 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ e07:	89 06                	mov    %eax,(%esi)
+ e09:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e0c:	5f                   	pop    %edi
+ e0d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ e0e:	8b 45 18             	mov    0x18(%ebp),%eax
+ e11:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e13:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ e1a:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ e21:	e8 3a f8 ff ff       	call   660 <cyc2ns>
+ e26:	83 c4 0c             	add    $0xc,%esp
+ e29:	ff 75 14             	push   0x14(%ebp)
+ e2c:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ e32:	f7 e3                	mul    %ebx
+ e34:	01 ca                	add    %ecx,%edx
+ e36:	52                   	push   %edx
+ e37:	50                   	push   %eax
+ e38:	e8 f3 f7 ff ff       	call   630 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ e3d:	89 46 08             	mov    %eax,0x8(%esi)
+ e40:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e43:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ e44:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e47:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ e48:	8d 50 01             	lea    0x1(%eax),%edx
+ e4b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ e50:	6b d2 63             	imul   $0x63,%edx,%edx
+ e53:	f7 e2                	mul    %edx
+ e55:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ e58:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ e5f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ e66:	e8 f5 f7 ff ff       	call   660 <cyc2ns>
+ e6b:	83 c4 0c             	add    $0xc,%esp
+ e6e:	ff 75 14             	push   0x14(%ebp)
+ e71:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ e77:	f7 e3                	mul    %ebx
+ e79:	01 ca                	add    %ecx,%edx
+ e7b:	52                   	push   %edx
+ e7c:	50                   	push   %eax
+ e7d:	e8 ae f7 ff ff       	call   630 <udiv64>
+
+  if(name){
+ e82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ e85:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ e88:	89 46 10             	mov    %eax,0x10(%esi)
+ e8b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ e8e:	85 c9                	test   %ecx,%ecx
+ e90:	74 72                	je     f04 <bench+0x234>
+    printf(1, "%s: min ", name);
+ e92:	83 ec 04             	sub    $0x4,%esp
+ e95:	ff 75 08             	push   0x8(%ebp)
+ e98:	68 7a 10 00 00       	push   $0x107a
+ e9d:	6a 01                	push   $0x1
+ e9f:	e8 5c fa ff ff       	call   900 <printf>
+    printps(1, st->min);
+ ea4:	83 c4 0c             	add    $0xc,%esp
+ ea7:	ff 76 04             	push   0x4(%esi)
+ eaa:	ff 36                	push   (%esi)
+ eac:	6a 01                	push   $0x1
+ eae:	e8 7d fd ff ff       	call   c30 <printps>
+    printf(1, " median ");
+ eb3:	58                   	pop    %eax
+ eb4:	5a                   	pop    %edx
+ eb5:	68 83 10 00 00       	push   $0x1083
+ eba:	6a 01                	push   $0x1
+ ebc:	e8 3f fa ff ff       	call   900 <printf>
+    printps(1, st->median);
+ ec1:	83 c4 0c             	add    $0xc,%esp
+ ec4:	ff 76 0c             	push   0xc(%esi)
+ ec7:	ff 76 08             	push   0x8(%esi)
+ eca:	6a 01                	push   $0x1
+ ecc:	e8 5f fd ff ff       	call   c30 <printps>
+    printf(1, " p99 ");
+ ed1:	59                   	pop    %ecx
+ ed2:	5b                   	pop    %ebx
+ ed3:	68 8c 10 00 00       	push   $0x108c
+ ed8:	6a 01                	push   $0x1
+ eda:	e8 21 fa ff ff       	call   900 <printf>
+    printps(1, st->p99);
+ edf:	83 c4 0c             	add    $0xc,%esp
+ ee2:	ff 76 14             	push   0x14(%esi)
+ ee5:	ff 76 10             	push   0x10(%esi)
+ ee8:	6a 01                	push   $0x1
+ eea:	e8 41 fd ff ff       	call   c30 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ eef:	83 c4 0c             	add    $0xc,%esp
+ ef2:	ff 75 18             	push   0x18(%ebp)
+ ef5:	68 92 10 00 00       	push   $0x1092
+ efa:	6a 01                	push   $0x1
+ efc:	e8 ff f9 ff ff       	call   900 <printf>
+ f01:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ f04:	31 c0                	xor    %eax,%eax
+}
+ f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f09:	5b                   	pop    %ebx
+ f0a:	5e                   	pop    %esi
+ f0b:	5f                   	pop    %edi
+ f0c:	5d                   	pop    %ebp
+ f0d:	c3                   	ret
+ f0e:	66 90                	xchg   %ax,%ax
+ f10:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ f16:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ f1c:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ f22:	e9 97 fe ff ff       	jmp    dbe <bench+0xee>
+    return -1;
+ f27:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f2c:	eb d8                	jmp    f06 <bench+0x236>
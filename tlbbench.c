@@ -0,0 +1,159 @@
+// TLB reach benchmark.
+// For working sets from 1MB to 128MB, time a pointer chase
+// that follows one of three access patterns, first on 4KB
+// pages and again after promote() has mapped the working set
+// with 4MB pages.  Every load depends on the previous one, so
+// the hardware prefetcher cannot hide TLB misses.
+
+#include "types.h"
+#include "user.h"
+
+#define PG        4096
+#define HUGEPG    (4 << 20)
+#define MINSET    (1 << 20)
+#define MAXSET    (128 << 20)
+#define MINOPS    (1 << 18)   // loads per timed run
+#define RUNS      5
+
+enum { STRIDE4K, STRIDE4M, RANDOM, NPATTERN };
+
+static char *patname[] = {
+[STRIDE4K]  "stride 4KB    ",
+[STRIDE4M]  "stride 4MB+4KB",
+[RANDOM]    "random        ",
+};
+
+struct chase {
+  void **start;
+  uint n;
+  void *sink;
+};
+
+static uint seed = 2463534242;
+
+static uint
+rand(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+// Link npg slots in base into a cycle following the pattern.
+// There is one slot per 4KB of working set, so all three
+// patterns perform the same number of distinct loads.
+static void
+build(char *base, uint size, int pattern, uint *perm)
+{
+  uint npg, i, off, next;
+
+  npg = size / PG;
+  for(i = 0; i < npg; i++)
+    perm[i] = i;
+  if(pattern == RANDOM){
+    for(i = npg - 1; i > 0; i--){
+      next = rand() % (i + 1);
+      off = perm[i];
+      perm[i] = perm[next];
+      perm[next] = off;
+    }
+  }
+
+  // Convert slot numbers to byte offsets.  The 4MB stride puts
+  // slot k on page k*1025 mod npg, which visits every page once
+  // since npg is a power of two, each step crossing into another
+  // 4MB region once the set is larger than one.  Strided and
+  // random slots land on varying cache lines within their page
+  // to avoid set conflicts.
+  for(i = 0; i < npg; i++){
+    if(pattern == STRIDE4K)
+      perm[i] = perm[i] * PG;
+    else if(pattern == STRIDE4M)
+      perm[i] = ((perm[i] * (HUGEPG / PG + 1)) & (npg - 1)) * PG +
+                (perm[i] % (PG / 64)) * 64;
+    else
+      perm[i] = perm[i] * PG + (perm[i] % (PG / 64)) * 64;
+  }
+  for(i = 0; i < npg; i++)
+    *(void**)(base + perm[i]) = base + perm[(i + 1) % npg];
+}
+
+static void
+chase(void *arg)
+{
+  struct chase *c = arg;
+  void **p;
+  uint i;
+
+  p = c->start;
+  for(i = 0; i < c->n; i++)
+    p = *p;
+  c->sink = p;
+}
+
+static void
+run(char *base, uint size, int pattern, uint *perm, struct benchstat *st)
+{
+  struct chase c;
+
+  build(base, size, pattern, perm);
+  c.start = (void**)(base + perm[0]);
+  c.n = size / PG;
+  while(c.n < MINOPS)
+    c.n += size / PG;
+  bench(0, chase, &c, c.n, RUNS, st);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct benchstat small[NPATTERN], huge[NPATTERN];
+  uint size, span, *perm;
+  char *mem, *base;
+  int p, npromoted;
+
+  // Stay on one cpu so every run sees the same caches and TLB.
+  sched_setaffinity(0, 1);
+
+  perm = malloc(MAXSET / PG * sizeof(uint));
+  if(perm == 0){
+    printf(2, "tlbbench: out of memory\n");
+    exit();
+  }
+
+  printf(1, "set\tpattern\t\t4KB ns/load\t4MB ns/load\n");
+  for(size = MINSET; size <= MAXSET; size *= 2){
+    // Round the mapping up to whole, aligned 4MB regions so
+    // that even small working sets can be promoted.
+    span = (size + HUGEPG - 1) & ~(HUGEPG - 1);
+    if((mem = sbrk(span + HUGEPG)) == (char*)-1){
+      printf(2, "tlbbench: cannot allocate %d MB\n", size >> 20);
+      break;
+    }
+    base = (char*)(((uint)mem + HUGEPG - 1) & ~(HUGEPG - 1));
+
+    for(p = 0; p < NPATTERN; p++)
+      run(base, size, p, perm, &small[p]);
+
+    promote(base, span);
+    npromoted = huge_page_count(base, span);
+    for(p = 0; p < NPATTERN; p++)
+      run(base, size, p, perm, &huge[p]);
+
+    for(p = 0; p < NPATTERN; p++){
+      printf(1, "%dMB\t%s\t", size >> 20, patname[p]);
+      printps(1, small[p].median);
+      printf(1, "\t\t");
+      printps(1, huge[p].median);
+      printf(1, "\n");
+    }
+    if(npromoted != span / HUGEPG)
+      printf(1, "  (only %d of %d regions promoted)\n",
+             npromoted, span / HUGEPG);
+
+    demote(base, span);
+    sbrk(-(span + HUGEPG));
+  }
+  exit();
+}
@@ -0,0 +1,112 @@
+// VM event tracing.
+// Each CPU appends events to its own ring with interrupts off,
+// so producers never share a cache line or take a lock.  Readers
+// drain the rings through traceread(), serialized by tracelock;
+// a full ring drops new events and counts them instead.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "trace.h"
+
+#define NTRACE 256   // events per cpu ring, a power of two
+
+struct tracering {
+  volatile uint head;       // next slot to write; only its cpu advances it
+  volatile uint tail;       // next slot to read; only readers advance it
+  volatile uint dropped;    // events lost since the last drain
+  struct traceev ev[NTRACE];
+};
+
+static struct tracering rings[NCPU];
+static struct spinlock tracelock;
+static uint tracemask;      // TRMASK() bits of events to record
+
+void
+traceinit(void)
+{
+  initlock(&tracelock, "trace");
+  tracemask = TRMASK_DEFAULT;
+}
+
+// Record an event of the given type on this cpu's ring.
+void
+trace(uint type, uint arg)
+{
+  struct tracering *r;
+  struct traceev *e;
+  struct cpu *c;
+
+  if((tracemask & TRMASK(type)) == 0)
+    return;
+
+  pushcli();
+  c = mycpu();
+  r = &rings[c - cpus];
+  if(r->head - r->tail >= NTRACE){
+    __sync_fetch_and_add(&r->dropped, 1);
+    popcli();
+    return;
+  }
+  e = &r->ev[r->head % NTRACE];
+  e->tsc = rdtsc();
+  e->type = type;
+  e->cpu = c - cpus;
+  e->pid = c->proc ? c->proc->pid : 0;
+  e->arg = arg;
+
+  // Publish the event only after it is fully written.
+  __sync_synchronize();
+  r->head++;
+  popcli();
+}
+
+// Set the mask of traced events, returning the old one.
+uint
+settracemask(uint mask)
+{
+  uint old;
+
+  old = tracemask;
+  tracemask = mask;
+  return old;
+}
+
+// Move up to n events from the cpu rings into buf,
+// which may be a user address in the current page table.
+// Returns the number of events copied.
+int
+traceread(struct traceev *buf, int n)
+{
+  struct tracering *r;
+  struct traceev lost;
+  int i, cnt;
+
+  cnt = 0;
+  acquire(&tracelock);
+  for(i = 0; i < ncpu && cnt < n; i++){
+    r = &rings[i];
+    if(r->dropped){
+      memset(&lost, 0, sizeof(lost));
+      lost.tsc = rdtsc();
+      lost.type = TR_LOST;
+      lost.cpu = i;
+      lost.arg = xchg(&r->dropped, 0);
+      buf[cnt++] = lost;
+    }
+    while(cnt < n && r->tail != r->head){
+      __sync_synchronize();
+      buf[cnt++] = r->ev[r->tail % NTRACE];
+      // Free the slot only after it has been copied out.
+      __sync_synchronize();
+      r->tail++;
+    }
+  }
+  release(&tracelock);
+  return cnt;
+}
@@ -0,0 +1,31 @@
+// VM event trace records, shared by the kernel and user tools.
+
+#define TR_KALLOC          1   // arg: physical address
+#define TR_KALLOC_FAIL     2
+#define TR_KALLOC_HUGE     3   // arg: physical address
+#define TR_KALLOC_HUGE_FAIL 4
+#define TR_PROMOTE         5   // arg: region virtual address
+#define TR_PROMOTE_FAIL    6   // arg: region virtual address
+#define TR_DEMOTE          7   // arg: region virtual address
+#define TR_PGFAULT         8   // arg: faulting address
+#define TR_TLBFLUSH        9   // arg: physical address of new page directory
+#define TR_LOST           10   // arg: events dropped because the ring was full
+#define NTRTYPE           11
+
+#define TRMASK(t)  (1 << (t))
+
+// Events recorded unless tracemask() says otherwise.  Page
+// allocations and context-switch TLB flushes are frequent
+// enough to flood the rings, so they are off by default.
+#define TRMASK_DEFAULT \
+  (TRMASK(TR_KALLOC_FAIL) | TRMASK(TR_KALLOC_HUGE) | \
+   TRMASK(TR_KALLOC_HUGE_FAIL) | TRMASK(TR_PROMOTE) | \
+   TRMASK(TR_PROMOTE_FAIL) | TRMASK(TR_DEMOTE) | TRMASK(TR_PGFAULT))
+
+struct traceev {
+  uint64 tsc;   // time-stamp counter when recorded
+  uint type;    // TR_*
+  uint cpu;     // recording cpu
+  int pid;      // current process, or 0
+  uint arg;
+};
@@ -7,6 +7,7 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "trace.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -54,6 +55,9 @@ trap(struct trapframe *tf)
       wakeup(&ticks);
       release(&tickslock);
     }
+    if(myproc())
+      myproc()->cputicks++;
+    profsample(tf);
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -63,6 +67,10 @@ trap(struct trapframe *tf)
   case T_IRQ0 + IRQ_IDE+1:
     // Bochs generates spurious IDE1 interrupts.
     break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Nothing to do: the interrupt got the cpu out of hlt.
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_KBD:
     kbdintr();
     lapiceoi();
@@ -78,6 +86,15 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    trace(TR_PGFAULT, rcr2());
+    // A page of the executable not read in yet, or a write
+    // to a shared one?
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       pagefault(rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -100,10 +117,10 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU when its time slice runs out.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && --myproc()->slice <= 0)
     yield();
 
   // Check if the process has been killed since we yielded
@@ -0,0 +1,45 @@
+// Time-stamp counter calibration.
+// The TSC ticks at a fixed but unknown rate, so measure it once
+// at boot against channel 2 of the 8253/8254 programmable
+// interval timer, whose input clock is a known 1.193182 MHz.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PIT_HZ      1193182
+#define PIT_CH2     0x42        // Channel 2 data port
+#define PIT_MODE    0x43        // Mode/command register
+#define PIT_GATE    0x61        // Channel 2 gate and speaker control
+  #define GATE2      0x01       // Gate input of channel 2
+  #define SPKR       0x02       // Speaker data enable
+  #define OUT2       0x20       // Channel 2 output (read only)
+
+#define CALIBRATE_MS 50
+
+uint tsckhz;   // TSC ticks per millisecond
+
+void
+tscinit(void)
+{
+  uint latch;
+  uint64 t0, t1;
+
+  // Gate channel 2 on with the speaker off, then load it in
+  // mode 0 (interrupt on terminal count): OUT2 rises when the
+  // count reaches zero, CALIBRATE_MS milliseconds from now.
+  latch = PIT_HZ / (1000 / CALIBRATE_MS);
+  outb(PIT_GATE, (inb(PIT_GATE) & ~SPKR) | GATE2);
+  outb(PIT_MODE, 0xB0);  // channel 2, lobyte/hibyte, mode 0, binary
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);
+
+  t0 = rdtsc();
+  while((inb(PIT_GATE) & OUT2) == 0)
+    ;
+  t1 = rdtsc();
+
+  tsckhz = (uint)(t1 - t0) / CALIBRATE_MS;
+  if(tsckhz == 0)
+    tsckhz = 1;
+}
@@ -104,3 +104,45 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+  return ((uint64)qhi << 32) | qlo;
+}
+
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+  static uint khz;
+
+  if(khz == 0)
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+}
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+  setpriority(0, getpriority(0) + incr);
+  return getpriority(0);
+}
@@ -1,5 +1,11 @@
 struct stat;
 struct rtcdate;
+struct traceev;
+struct profsample;
+struct lockstat;
+struct diskstat;
+struct sysstat;
+struct kbresult;
 
 // system calls
 int fork(void);
@@ -28,6 +34,26 @@ int promote(void *va, int size);
 int demote(void *va, int size);
 int huge_page_count(void *va, int size);
 int get_free_pa_space();
+uint tscfreq(void);
+int tracemask(int);
+int traceread(struct traceev*, int);
+int profile(int);
+int profread(struct profsample*, int);
+int lockstat(struct lockstat*, int);
+int lockstatreset(void);
+int sysstat(int, struct sysstat*, int);
+int kbench(int, struct kbresult*, int);
+int yield(void);
+int setpriority(int, int);
+int getpriority(int);
+int sched_setaffinity(int, uint);
+uint sched_getaffinity(int);
+int clone(void(*)(void*), void*, void*);
+int join(int);
+int futex_wait(volatile uint*, uint);
+int futex_wake(volatile uint*, int);
+int spawn(char*, char**, int*);
+int diskstat(struct diskstat*, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -42,3 +68,34 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+uint64 udiv64(uint64, uint);
+uint64 cycles(void);
+uint64 cyc2ns(uint64);
+int nice(int);
+
+// bench.c
+struct benchstat {
+  uint64 min;       // picoseconds per op
+  uint64 median;
+  uint64 p99;
+};
+int bench(char*, void (*)(void*), void*, uint, int, struct benchstat*);
+void printps(int, uint64);
+
+// thread.c
+struct mutex {
+  volatile uint state;  // 0 free, 1 held, 2 held with waiters
+};
+struct barrier {
+  struct mutex lk;
+  uint n;               // threads to wait for
+  uint count;           // threads arrived in this round
+  volatile uint round;  // bumped to release each round
+};
+int thread_create(void (*)(void*), void*);
+int thread_join(int);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void barrier_init(struct barrier*, uint);
+void barrier_wait(struct barrier*);
@@ -1606,6 +1606,173 @@ bsstest(void)
   printf(stdout, "bss test ok\n");
 }
 
+// Initialized data, which processes running this binary share
+// until one writes to it (see text.c).  Tests build the letters
+// at run time so that they appear only here in the binary.
+#define COWLEN 16
+char cowdata[COWLEN+1] = "abcdefghijklmnop";
+
+// does p hold COWLEN letters from c on?
+int
+cowis(char *p, char c)
+{
+  int i;
+
+  for(i = 0; i < COWLEN; i++)
+    if(p[i] != c + i)
+      return 0;
+  return 1;
+}
+
+// the other half of cowtexttest, run by exec: change cowdata
+// with read() or with stores, or report that it is unchanged.
+void
+cowchild(char *how)
+{
+  int i, fd;
+
+  if(strcmp(how, "cowcheck") == 0){
+    if(cowis(cowdata, 'a'))
+      close(open("cowtext.ok", O_CREATE));
+    exit();
+  }
+  if(strcmp(how, "cowread") == 0){
+    fd = open("cowtext.in", 0);
+    if(fd < 0 || read(fd, cowdata, COWLEN) != COWLEN){
+      printf(stdout, "cow text: read failed\n");
+      exit();
+    }
+    close(fd);
+  } else {
+    for(i = 0; i < COWLEN; i++)
+      cowdata[i] = 'A' + i;
+  }
+  if(!cowis(cowdata, 'A'))
+    printf(stdout, "cow text: %s did not change data\n", how);
+  exit();
+}
+
+// writing to data shared with another process running the
+// same binary must give the writer a copy, and change neither
+// the other process nor the file.
+void
+cowtexttest(void)
+{
+  static char *how[] = { "cowread", "cowstore", "cowcheck" };
+  char *argv[3], up[COWLEN];
+  struct stat st;
+  int i, fd, n;
+  char *p;
+
+  printf(stdout, "cow text test\n");
+  if(!cowis(cowdata, 'a')){
+    printf(stdout, "cow text: bad initial data\n");
+    exit();
+  }
+  for(i = 0; i < COWLEN; i++)
+    up[i] = 'A' + i;
+  fd = open("cowtext.in", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, up, COWLEN) != COWLEN){
+    printf(stdout, "cow text: create failed\n");
+    exit();
+  }
+  close(fd);
+
+  argv[0] = "usertests";
+  argv[2] = 0;
+  for(i = 0; i < 3; i++){
+    argv[1] = how[i];
+    if(fork() == 0){
+      exec("/usertests", argv);
+      printf(stdout, "cow text: exec failed\n");
+      exit();
+    }
+    wait();
+    if(!cowis(cowdata, 'a')){
+      printf(stdout, "cow text: %s changed our data\n", how[i]);
+      exit();
+    }
+  }
+  if((fd = open("cowtext.ok", 0)) < 0){
+    printf(stdout, "cow text: a new process saw changed data\n");
+    exit();
+  }
+  close(fd);
+  unlink("cowtext.ok");
+  unlink("cowtext.in");
+
+  // The binary itself must still hold the original.
+  fd = open("/usertests", 0);
+  if(fd < 0 || fstat(fd, &st) < 0 || (p = malloc(st.size)) == 0){
+    printf(stdout, "cow text: cannot read usertests\n");
+    exit();
+  }
+  n = read(fd, p, st.size);
+  close(fd);
+  for(i = 0; i + COWLEN <= n && !cowis(p + i, 'a'); i++)
+    ;
+  free(p);
+  if(i + COWLEN > n){
+    printf(stdout, "cow text: usertests changed on disk\n");
+    exit();
+  }
+  printf(stdout, "cow text test ok\n");
+}
+
+// does a forked child start with its parent's sse registers,
+// rather than those of whatever last ran on its cpu?  and does
+// the parent keep its own across the switches?
+void
+ssetest(void)
+{
+  uint a[4], b[4], edx;
+  int i, fds[2];
+  char ok;
+
+  printf(stdout, "sse test\n");
+  asm volatile("cpuid" : "=a" (i), "=d" (edx) : "a" (1) : "ebx", "ecx");
+  if((edx & (1 << 26)) == 0){  // no SSE2: the kernel leaves it off
+    printf(stdout, "sse test skipped\n");
+    return;
+  }
+  if(pipe(fds) != 0){
+    printf(stdout, "sse test: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++)
+    a[i] = 0x5eed0000 + i;
+  asm volatile("movdqu %0, %%xmm1" : : "m" (a));
+  if(fork() == 0){
+    asm volatile("movdqu %%xmm1, %0" : "=m" (b));
+    ok = 1;
+    for(i = 0; i < 4; i++)
+      if(b[i] != a[i])
+        ok = 0;
+    write(fds[1], &ok, 1);
+    exit();
+  }
+
+  // Leave something else in the cpu's registers for the child.
+  for(i = 0; i < 4; i++)
+    b[i] = 0xbad00000 + i;
+  asm volatile("movdqu %0, %%xmm1" : : "m" (b));
+  if(read(fds[0], &ok, 1) != 1 || !ok){
+    printf(stdout, "sse test: child did not get parent's xmm1\n");
+    exit();
+  }
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  asm volatile("movdqu %%xmm1, %0" : "=m" (a));
+  for(i = 0; i < 4; i++){
+    if(a[i] != 0xbad00000 + i){
+      printf(stdout, "sse test: xmm1 changed across switches\n");
+      exit();
+    }
+  }
+  printf(stdout, "sse test ok\n");
+}
+
 // does exec return an error if the arguments
 // are larger than a page? or does it write
 // below the stack and wreck the instructions/data?
@@ -1748,6 +1915,11 @@ rand()
 int
 main(int argc, char *argv[])
 {
+  if(argc > 1){
+    cowchild(argv[1]);
+    exit();
+  }
+
   printf(1, "usertests starting\n");
 
   if(open("usertests.ran", 0) >= 0){
@@ -1767,6 +1939,8 @@ main(int argc, char *argv[])
   bigwrite();
   bigargtest();
   bsstest();
+  cowtexttest();
+  ssetest();
   sbrktest();
   validatetest();
 
@@ -6,6 +6,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "trace.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -44,10 +45,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    // kzalloc makes sure all those PTE_P bits are zero.
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
       return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -123,9 +123,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -177,6 +176,7 @@ switchuvm(struct proc *p)
   ltr(SEG_TSS << 3);
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
+  trace(TR_TLBFLUSH, V2P(p->pgdir));
 }
 
 // Load the initcode into address 0 of pgdir.
@@ -188,8 +188,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -233,13 +232,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kzalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -266,21 +264,24 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
-    if(*pte & PTE_PS)
+    if(!pte)  // no page table here, e.g. pages never faulted in
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte & PTE_PS)
     {
       // kfree_huge((char*)P2V(PTE_ADDR(*pte)));
       *pte = 0;
       a += HUGEPGSIZE - PGSIZE;
       continue;
     }
-    if(!pte)
-      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
       char *v = P2V(pa);
-      kfree(v);
+      if(*pte & PTE_SHARED)
+        textput(v);
+      else
+        kfree(v);
       *pte = 0;
     }
   }
@@ -334,15 +335,24 @@ copyuvm(pde_t *pgdir, uint sz)
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
+    // Pages of the executable not yet faulted in are left out;
+    // the child faults them in itself.
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+      continue;
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
+    if(*pte & PTE_SHARED){
+      // The child maps the same read-only page.
+      if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+        goto bad;
+      textdup(P2V(pa));
+      continue;
+    }
     if((mem = kalloc()) == 0)
       goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
+    pgcopy(mem, (char*)P2V(pa), PGSIZE);
     if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
       kfree(mem);
       goto bad;
@@ -355,6 +365,57 @@ bad:
   return 0;
 }
 
+// Map page mem at user address va, which must not be mapped
+// yet, with permissions perm.  Returns 0, or -1 if out of memory.
+int
+mapuserpage(pde_t *pgdir, uint va, char *mem, int perm)
+{
+  return mappages(pgdir, (char*)va, PGSIZE, V2P(mem), perm);
+}
+
+// If the page at user address va is a shared executable page,
+// replace it with a private, writable copy.  Returns 1 if it
+// copied, when the caller must flush the TLB; 0 if the page was
+// private already; or -1 if it is not mapped or out of memory.
+int
+cowpage(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem, *old;
+
+  if((pte = walkpgdir(pgdir, (char*)va, 0)) == 0 || (*pte & PTE_P) == 0)
+    return -1;
+  if((*pte & PTE_SHARED) == 0)
+    return 0;
+  if((mem = kalloc()) == 0)
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  pgcopy(mem, old, PGSIZE);
+  *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+  textput(old);
+  return 1;
+}
+
+// Give every shared page below sz a private copy, before the
+// page table is shared by threads: one thread's copy-on-write
+// could not flush the others' TLBs.  Returns 0, or -1.
+int
+unshareuvm(pde_t *pgdir, uint sz)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = 0; a < sz; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if((*pte & PTE_SHARED) && cowpage(pgdir, a) < 0)
+      return -1;
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -363,10 +424,12 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if(*pte & PTE_PS)  // the small page within a huge one
+    return (char*)P2V(PTE_ADDR(*pte)) + (PGROUNDDOWN((uint)uva) & (HUGEPGSIZE-1));
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
@@ -0,0 +1,1996 @@
+
+_vmtrace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  uint64 t0;
+  char *name;
+
+  if(argc > 1){
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1){
+  1a:	7e 6b                	jle    87 <main+0x87>
+    if(strcmp(argv[1], "all") == 0)
+  1c:	50                   	push   %eax
+  1d:	50                   	push   %eax
+  1e:	68 04 0e 00 00       	push   $0xe04
+  23:	ff 73 04             	push   0x4(%ebx)
+  26:	e8 c5 02 00 00       	call   2f0 <strcmp>
+  2b:	83 c4 10             	add    $0x10,%esp
+  2e:	85 c0                	test   %eax,%eax
+  30:	75 12                	jne    44 <main+0x44>
+      tracemask(~0);
+  32:	83 ec 0c             	sub    $0xc,%esp
+  35:	6a ff                	push   $0xffffffff
+  37:	e8 54 06 00 00       	call   690 <tracemask>
+  3c:	83 c4 10             	add    $0x10,%esp
+      tracemask(TRMASK_DEFAULT);
+    else if(strcmp(argv[1], "off") == 0)
+      tracemask(0);
+    else
+      printf(2, "usage: vmtrace [all|default|off]\n");
+    exit();
+  3f:	e8 84 05 00 00       	call   5c8 <exit>
+    else if(strcmp(argv[1], "default") == 0)
+  44:	50                   	push   %eax
+  45:	50                   	push   %eax
+  46:	68 08 0e 00 00       	push   $0xe08
+  4b:	ff 73 04             	push   0x4(%ebx)
+  4e:	e8 9d 02 00 00       	call   2f0 <strcmp>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	0f 84 02 02 00 00    	je     260 <main+0x260>
+    else if(strcmp(argv[1], "off") == 0)
+  5e:	50                   	push   %eax
+  5f:	50                   	push   %eax
+  60:	68 10 0e 00 00       	push   $0xe10
+  65:	ff 73 04             	push   0x4(%ebx)
+  68:	e8 83 02 00 00       	call   2f0 <strcmp>
+  6d:	83 c4 10             	add    $0x10,%esp
+  70:	85 c0                	test   %eax,%eax
+  72:	0f 85 10 02 00 00    	jne    288 <main+0x288>
+      tracemask(0);
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	6a 00                	push   $0x0
+  7d:	e8 0e 06 00 00       	call   690 <tracemask>
+  82:	83 c4 10             	add    $0x10,%esp
+  85:	eb b8                	jmp    3f <main+0x3f>
+  }
+
+  if((n = traceread(ev, NEV)) < 0){
+  87:	50                   	push   %eax
+  88:	50                   	push   %eax
+  89:	68 00 08 00 00       	push   $0x800
+  8e:	68 60 13 00 00       	push   $0x1360
+  93:	e8 00 06 00 00       	call   698 <traceread>
+  98:	83 c4 10             	add    $0x10,%esp
+  9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  9e:	85 c0                	test   %eax,%eax
+  a0:	0f 88 cf 01 00 00    	js     275 <main+0x275>
+  for(i = 1; i < n; i++){
+  a6:	83 e8 01             	sub    $0x1,%eax
+  a9:	0f 8e ef 01 00 00    	jle    29e <main+0x29e>
+  af:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  b6:	be 78 13 00 00       	mov    $0x1378,%esi
+  bb:	bf 60 13 00 00       	mov    $0x1360,%edi
+    v = a[i];
+  c0:	8b 46 08             	mov    0x8(%esi),%eax
+  c3:	8b 1e                	mov    (%esi),%ebx
+  c5:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  c8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  cb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  ce:	8b 46 0c             	mov    0xc(%esi),%eax
+  d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  d4:	8b 46 10             	mov    0x10(%esi),%eax
+  d7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  da:	8b 46 14             	mov    0x14(%esi),%eax
+  dd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  e0:	89 f0                	mov    %esi,%eax
+  e2:	eb 32                	jmp    116 <main+0x116>
+  e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      a[j] = a[j-1];
+  e8:	8b 70 e8             	mov    -0x18(%eax),%esi
+  eb:	89 30                	mov    %esi,(%eax)
+  ed:	8b 70 ec             	mov    -0x14(%eax),%esi
+  f0:	89 70 04             	mov    %esi,0x4(%eax)
+  f3:	8b 70 f0             	mov    -0x10(%eax),%esi
+  f6:	89 70 08             	mov    %esi,0x8(%eax)
+  f9:	8b 70 f4             	mov    -0xc(%eax),%esi
+  fc:	89 70 0c             	mov    %esi,0xc(%eax)
+  ff:	8b 70 f8             	mov    -0x8(%eax),%esi
+ 102:	89 70 10             	mov    %esi,0x10(%eax)
+ 105:	8b 70 fc             	mov    -0x4(%eax),%esi
+ 108:	89 70 14             	mov    %esi,0x14(%eax)
+    for(j = i; j > 0 && a[j-1].tsc > v.tsc; j--)
+ 10b:	8d 42 e8             	lea    -0x18(%edx),%eax
+ 10e:	39 c7                	cmp    %eax,%edi
+ 110:	0f 84 2a 01 00 00    	je     240 <main+0x240>
+ 116:	3b 58 e8             	cmp    -0x18(%eax),%ebx
+ 119:	89 ce                	mov    %ecx,%esi
+ 11b:	1b 70 ec             	sbb    -0x14(%eax),%esi
+ 11e:	89 c2                	mov    %eax,%edx
+ 120:	72 c6                	jb     e8 <main+0xe8>
+ 122:	8b 75 c8             	mov    -0x38(%ebp),%esi
+    a[j] = v;
+ 125:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  for(i = 1; i < n; i++){
+ 128:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 12c:	83 c6 18             	add    $0x18,%esi
+    a[j] = v;
+ 12f:	89 1a                	mov    %ebx,(%edx)
+ 131:	89 42 08             	mov    %eax,0x8(%edx)
+ 134:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 137:	89 4a 04             	mov    %ecx,0x4(%edx)
+ 13a:	89 42 0c             	mov    %eax,0xc(%edx)
+ 13d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 140:	89 42 10             	mov    %eax,0x10(%edx)
+ 143:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 146:	89 42 14             	mov    %eax,0x14(%edx)
+  for(i = 1; i < n; i++){
+ 149:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 14c:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+ 14f:	0f 85 6b ff ff ff    	jne    c0 <main+0xc0>
+    printf(2, "vmtrace: traceread failed\n");
+    exit();
+  }
+  sort(ev, n);
+
+  printf(1, "time(us)\tcpu\tpid\tevent\t\targ\n");
+ 155:	53                   	push   %ebx
+ 156:	53                   	push   %ebx
+ 157:	68 14 0e 00 00       	push   $0xe14
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 6d 06 00 00       	call   7d0 <printf>
+ 163:	83 c4 10             	add    $0x10,%esp
+  t0 = n > 0 ? ev[0].tsc : 0;
+ 166:	a1 60 13 00 00       	mov    0x1360,%eax
+ 16b:	8b 15 64 13 00 00    	mov    0x1364,%edx
+ 171:	bb 60 13 00 00       	mov    $0x1360,%ebx
+  for(i = 0; i < n; i++){
+ 176:	31 ff                	xor    %edi,%edi
+  t0 = n > 0 ? ev[0].tsc : 0;
+ 178:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 17b:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  for(i = 0; i < n; i++){
+ 17e:	eb 22                	jmp    1a2 <main+0x1a2>
+    if(strlen(name) < 8)
+      printf(1, "\t");
+    if(ev[i].type == TR_LOST)
+      printf(1, "%d\n", ev[i].arg);
+    else
+      printf(1, "0x%x\n", ev[i].arg);
+ 180:	83 ec 04             	sub    $0x4,%esp
+ 183:	50                   	push   %eax
+ 184:	68 5d 0e 00 00       	push   $0xe5d
+ 189:	6a 01                	push   $0x1
+ 18b:	e8 40 06 00 00       	call   7d0 <printf>
+ 190:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 193:	83 c7 01             	add    $0x1,%edi
+ 196:	83 c3 18             	add    $0x18,%ebx
+ 199:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+ 19c:	0f 8e 9d fe ff ff    	jle    3f <main+0x3f>
+    name = ev[i].type < NTRTYPE ? names[ev[i].type] : 0;
+ 1a2:	8b 43 08             	mov    0x8(%ebx),%eax
+      name = "???";
+ 1a5:	be 00 0e 00 00       	mov    $0xe00,%esi
+    name = ev[i].type < NTRTYPE ? names[ev[i].type] : 0;
+ 1aa:	83 f8 0a             	cmp    $0xa,%eax
+ 1ad:	77 11                	ja     1c0 <main+0x1c0>
+ 1af:	8b 34 85 00 0f 00 00 	mov    0xf00(,%eax,4),%esi
+      name = "???";
+ 1b6:	b8 00 0e 00 00       	mov    $0xe00,%eax
+ 1bb:	85 f6                	test   %esi,%esi
+ 1bd:	0f 44 f0             	cmove  %eax,%esi
+    printf(1, "%d\t%d\t%d\t%s\t", (uint)udiv64(cyc2ns(ev[i].tsc - t0), 1000),
+ 1c0:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 1c3:	8b 4b 10             	mov    0x10(%ebx),%ecx
+ 1c6:	83 ec 08             	sub    $0x8,%esp
+ 1c9:	8b 53 04             	mov    0x4(%ebx),%edx
+ 1cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 1cf:	8b 03                	mov    (%ebx),%eax
+ 1d1:	2b 45 d0             	sub    -0x30(%ebp),%eax
+ 1d4:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+ 1d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+ 1da:	52                   	push   %edx
+ 1db:	50                   	push   %eax
+ 1dc:	e8 4f 03 00 00       	call   530 <cyc2ns>
+ 1e1:	83 c4 0c             	add    $0xc,%esp
+ 1e4:	68 e8 03 00 00       	push   $0x3e8
+ 1e9:	52                   	push   %edx
+ 1ea:	50                   	push   %eax
+ 1eb:	e8 10 03 00 00       	call   500 <udiv64>
+ 1f0:	5a                   	pop    %edx
+ 1f1:	59                   	pop    %ecx
+ 1f2:	56                   	push   %esi
+ 1f3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+ 1f6:	51                   	push   %ecx
+ 1f7:	ff 75 e4             	push   -0x1c(%ebp)
+ 1fa:	50                   	push   %eax
+ 1fb:	68 4c 0e 00 00       	push   $0xe4c
+ 200:	6a 01                	push   $0x1
+ 202:	e8 c9 05 00 00       	call   7d0 <printf>
+    if(strlen(name) < 8)
+ 207:	83 c4 14             	add    $0x14,%esp
+ 20a:	56                   	push   %esi
+ 20b:	e8 40 01 00 00       	call   350 <strlen>
+ 210:	83 c4 10             	add    $0x10,%esp
+ 213:	83 f8 07             	cmp    $0x7,%eax
+ 216:	76 35                	jbe    24d <main+0x24d>
+    if(ev[i].type == TR_LOST)
+ 218:	83 7b 08 0a          	cmpl   $0xa,0x8(%ebx)
+      printf(1, "%d\n", ev[i].arg);
+ 21c:	8b 43 14             	mov    0x14(%ebx),%eax
+    if(ev[i].type == TR_LOST)
+ 21f:	0f 85 5b ff ff ff    	jne    180 <main+0x180>
+      printf(1, "%d\n", ev[i].arg);
+ 225:	52                   	push   %edx
+ 226:	50                   	push   %eax
+ 227:	68 59 0e 00 00       	push   $0xe59
+ 22c:	6a 01                	push   $0x1
+ 22e:	e8 9d 05 00 00       	call   7d0 <printf>
+ 233:	83 c4 10             	add    $0x10,%esp
+ 236:	e9 58 ff ff ff       	jmp    193 <main+0x193>
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+ 240:	8b 75 c8             	mov    -0x38(%ebp),%esi
+ 243:	ba 60 13 00 00       	mov    $0x1360,%edx
+ 248:	e9 d8 fe ff ff       	jmp    125 <main+0x125>
+      printf(1, "\t");
+ 24d:	51                   	push   %ecx
+ 24e:	51                   	push   %ecx
+ 24f:	68 57 0e 00 00       	push   $0xe57
+ 254:	6a 01                	push   $0x1
+ 256:	e8 75 05 00 00       	call   7d0 <printf>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	eb b8                	jmp    218 <main+0x218>
+      tracemask(TRMASK_DEFAULT);
+ 260:	83 ec 0c             	sub    $0xc,%esp
+ 263:	68 fc 01 00 00       	push   $0x1fc
+ 268:	e8 23 04 00 00       	call   690 <tracemask>
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	e9 ca fd ff ff       	jmp    3f <main+0x3f>
+    printf(2, "vmtrace: traceread failed\n");
+ 275:	56                   	push   %esi
+ 276:	56                   	push   %esi
+ 277:	68 31 0e 00 00       	push   $0xe31
+ 27c:	6a 02                	push   $0x2
+ 27e:	e8 4d 05 00 00       	call   7d0 <printf>
+    exit();
+ 283:	e8 40 03 00 00       	call   5c8 <exit>
+      printf(2, "usage: vmtrace [all|default|off]\n");
+ 288:	50                   	push   %eax
+ 289:	50                   	push   %eax
+ 28a:	68 d0 0e 00 00       	push   $0xed0
+ 28f:	6a 02                	push   $0x2
+ 291:	e8 3a 05 00 00       	call   7d0 <printf>
+ 296:	83 c4 10             	add    $0x10,%esp
+ 299:	e9 a1 fd ff ff       	jmp    3f <main+0x3f>
+  printf(1, "time(us)\tcpu\tpid\tevent\t\targ\n");
+ 29e:	57                   	push   %edi
+ 29f:	57                   	push   %edi
+ 2a0:	68 14 0e 00 00       	push   $0xe14
+ 2a5:	6a 01                	push   $0x1
+ 2a7:	e8 24 05 00 00       	call   7d0 <printf>
+  t0 = n > 0 ? ev[0].tsc : 0;
+ 2ac:	83 c4 10             	add    $0x10,%esp
+ 2af:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+ 2b3:	0f 84 86 fd ff ff    	je     3f <main+0x3f>
+ 2b9:	e9 a8 fe ff ff       	jmp    166 <main+0x166>
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 e3 01 00 00       	call   5e0 <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 b6 01 00 00       	call   608 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 b9 01 00 00       	call   620 <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 7f 01 00 00       	call   5f0 <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 500:	55                   	push   %ebp
+ 501:	31 d2                	xor    %edx,%edx
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	53                   	push   %ebx
+ 506:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 509:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 50c:	f7 f3                	div    %ebx
+ 50e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+ 513:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 518:	89 ca                	mov    %ecx,%edx
+}
+ 51a:	c9                   	leave
+ 51b:	c3                   	ret
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 520:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 522:	c3                   	ret
+ 523:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000530 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 539:	8b 35 60 d3 00 00    	mov    0xd360,%esi
+{
+ 53f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 542:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 545:	85 f6                	test   %esi,%esi
+ 547:	74 2f                	je     578 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 549:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 54e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 554:	f7 e3                	mul    %ebx
+ 556:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 559:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 55c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 55f:	31 d2                	xor    %edx,%edx
+ 561:	f7 f6                	div    %esi
+ 563:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 565:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 568:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 56b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 56d:	89 da                	mov    %ebx,%edx
+}
+ 56f:	5b                   	pop    %ebx
+ 570:	5e                   	pop    %esi
+ 571:	5f                   	pop    %edi
+ 572:	5d                   	pop    %ebp
+ 573:	c3                   	ret
+ 574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 578:	e8 0b 01 00 00       	call   688 <tscfreq>
+ 57d:	a3 60 d3 00 00       	mov    %eax,0xd360
+ 582:	89 c6                	mov    %eax,%esi
+ 584:	eb c3                	jmp    549 <cyc2ns+0x19>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	83 ec 10             	sub    $0x10,%esp
+ 597:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 59a:	6a 00                	push   $0x0
+ 59c:	e8 3f 01 00 00       	call   6e0 <getpriority>
+ 5a1:	5a                   	pop    %edx
+ 5a2:	59                   	pop    %ecx
+ 5a3:	01 d8                	add    %ebx,%eax
+ 5a5:	50                   	push   %eax
+ 5a6:	6a 00                	push   $0x0
+ 5a8:	e8 2b 01 00 00       	call   6d8 <setpriority>
+  return getpriority(0);
+ 5ad:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 5b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 5b7:	83 c4 10             	add    $0x10,%esp
+}
+ 5ba:	c9                   	leave
+  return getpriority(0);
+ 5bb:	e9 20 01 00 00       	jmp    6e0 <getpriority>
+
+000005c0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <exit>:
+SYSCALL(exit)
+ 5c8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <wait>:
+SYSCALL(wait)
+ 5d0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <pipe>:
+SYSCALL(pipe)
+ 5d8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <read>:
+SYSCALL(read)
+ 5e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <write>:
+SYSCALL(write)
+ 5e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <close>:
+SYSCALL(close)
+ 5f0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <kill>:
+SYSCALL(kill)
+ 5f8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <exec>:
+SYSCALL(exec)
+ 600:	b8 07 00 00 00       	mov    $0x7,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <open>:
+SYSCALL(open)
+ 608:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <mknod>:
+SYSCALL(mknod)
+ 610:	b8 11 00 00 00       	mov    $0x11,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <unlink>:
+SYSCALL(unlink)
+ 618:	b8 12 00 00 00       	mov    $0x12,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <fstat>:
+SYSCALL(fstat)
+ 620:	b8 08 00 00 00       	mov    $0x8,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <link>:
+SYSCALL(link)
+ 628:	b8 13 00 00 00       	mov    $0x13,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <mkdir>:
+SYSCALL(mkdir)
+ 630:	b8 14 00 00 00       	mov    $0x14,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <chdir>:
+SYSCALL(chdir)
+ 638:	b8 09 00 00 00       	mov    $0x9,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <dup>:
+SYSCALL(dup)
+ 640:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 645:	cd 40                	int    $0x40
+ 647:	c3                   	ret
+
+00000648 <getpid>:
+SYSCALL(getpid)
+ 648:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 64d:	cd 40                	int    $0x40
+ 64f:	c3                   	ret
+
+00000650 <sbrk>:
+SYSCALL(sbrk)
+ 650:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 655:	cd 40                	int    $0x40
+ 657:	c3                   	ret
+
+00000658 <sleep>:
+SYSCALL(sleep)
+ 658:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 65d:	cd 40                	int    $0x40
+ 65f:	c3                   	ret
+
+00000660 <uptime>:
+SYSCALL(uptime)
+ 660:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <promote>:
+
+SYSCALL(promote)
+ 668:	b8 18 00 00 00       	mov    $0x18,%eax
+ 66d:	cd 40                	int    $0x40
+ 66f:	c3                   	ret
+
+00000670 <demote>:
+SYSCALL(demote)
+ 670:	b8 19 00 00 00       	mov    $0x19,%eax
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 678:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 680:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <tscfreq>:
+SYSCALL(tscfreq)
+ 688:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <tracemask>:
+SYSCALL(tracemask)
+ 690:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <traceread>:
+SYSCALL(traceread)
+ 698:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <profile>:
+SYSCALL(profile)
+ 6a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <profread>:
+SYSCALL(profread)
+ 6a8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <lockstat>:
+SYSCALL(lockstat)
+ 6b0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 6b8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <sysstat>:
+SYSCALL(sysstat)
+ 6c0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <kbench>:
+SYSCALL(kbench)
+ 6c8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <yield>:
+SYSCALL(yield)
+ 6d0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <setpriority>:
+SYSCALL(setpriority)
+ 6d8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <getpriority>:
+SYSCALL(getpriority)
+ 6e0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6e8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6f0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <clone>:
+SYSCALL(clone)
+ 6f8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <join>:
+SYSCALL(join)
+ 700:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <futex_wait>:
+SYSCALL(futex_wait)
+ 708:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <futex_wake>:
+SYSCALL(futex_wake)
+ 710:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <spawn>:
+SYSCALL(spawn)
+ 718:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <diskstat>:
+SYSCALL(diskstat)
+ 720:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+ 728:	66 90                	xchg   %ax,%ax
+ 72a:	66 90                	xchg   %ax,%ax
+ 72c:	66 90                	xchg   %ax,%ax
+ 72e:	66 90                	xchg   %ax,%ax
+
+00000730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 738:	89 d1                	mov    %edx,%ecx
+{
+ 73a:	83 ec 3c             	sub    $0x3c,%esp
+ 73d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 740:	85 d2                	test   %edx,%edx
+ 742:	0f 89 80 00 00 00    	jns    7c8 <printint+0x98>
+ 748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 74c:	74 7a                	je     7c8 <printint+0x98>
+    x = -xx;
+ 74e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 758:	31 f6                	xor    %esi,%esi
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 760:	89 c8                	mov    %ecx,%eax
+ 762:	31 d2                	xor    %edx,%edx
+ 764:	89 f7                	mov    %esi,%edi
+ 766:	f7 f3                	div    %ebx
+ 768:	8d 76 01             	lea    0x1(%esi),%esi
+ 76b:	0f b6 92 8c 0f 00 00 	movzbl 0xf8c(%edx),%edx
+ 772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 776:	89 ca                	mov    %ecx,%edx
+ 778:	89 c1                	mov    %eax,%ecx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+ 77e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 781:	85 c0                	test   %eax,%eax
+ 783:	74 07                	je     78c <printint+0x5c>
+    buf[i++] = '-';
+ 785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 78a:	89 f7                	mov    %esi,%edi
+ 78c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 78f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 792:	01 df                	add    %ebx,%edi
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7a4:	6a 01                	push   $0x1
+ 7a6:	50                   	push   %eax
+ 7a7:	56                   	push   %esi
+ 7a8:	e8 3b fe ff ff       	call   5e8 <write>
+  while(--i >= 0)
+ 7ad:	89 f8                	mov    %edi,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+ 7b2:	83 ef 01             	sub    $0x1,%edi
+ 7b5:	39 d8                	cmp    %ebx,%eax
+ 7b7:	75 df                	jne    798 <printint+0x68>
+}
+ 7b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bc:	5b                   	pop    %ebx
+ 7bd:	5e                   	pop    %esi
+ 7be:	5f                   	pop    %edi
+ 7bf:	5d                   	pop    %ebp
+ 7c0:	c3                   	ret
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7c8:	31 c0                	xor    %eax,%eax
+ 7ca:	eb 89                	jmp    755 <printint+0x25>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7df:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e2:	83 c6 01             	add    $0x1,%esi
+ 7e5:	84 db                	test   %bl,%bl
+ 7e7:	74 67                	je     850 <printf+0x80>
+ 7e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ec:	31 d2                	xor    %edx,%edx
+ 7ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7f1:	eb 34                	jmp    827 <printf+0x57>
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+ 7f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 800:	83 f8 25             	cmp    $0x25,%eax
+ 803:	74 18                	je     81d <printf+0x4d>
+  write(fd, &c, 1);
+ 805:	83 ec 04             	sub    $0x4,%esp
+ 808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 80b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80e:	6a 01                	push   $0x1
+ 810:	50                   	push   %eax
+ 811:	57                   	push   %edi
+ 812:	e8 d1 fd ff ff       	call   5e8 <write>
+ 817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 81a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 81d:	0f b6 1e             	movzbl (%esi),%ebx
+ 820:	83 c6 01             	add    $0x1,%esi
+ 823:	84 db                	test   %bl,%bl
+ 825:	74 29                	je     850 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 82a:	85 d2                	test   %edx,%edx
+ 82c:	74 ca                	je     7f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 82e:	83 fa 25             	cmp    $0x25,%edx
+ 831:	75 ea                	jne    81d <printf+0x4d>
+      if(c == 'd'){
+ 833:	83 f8 25             	cmp    $0x25,%eax
+ 836:	0f 84 24 01 00 00    	je     960 <printf+0x190>
+ 83c:	83 e8 63             	sub    $0x63,%eax
+ 83f:	83 f8 15             	cmp    $0x15,%eax
+ 842:	77 1c                	ja     860 <printf+0x90>
+ 844:	ff 24 85 34 0f 00 00 	jmp    *0xf34(,%eax,4)
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 853:	5b                   	pop    %ebx
+ 854:	5e                   	pop    %esi
+ 855:	5f                   	pop    %edi
+ 856:	5d                   	pop    %ebp
+ 857:	c3                   	ret
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 86a:	6a 01                	push   $0x1
+ 86c:	52                   	push   %edx
+ 86d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 870:	57                   	push   %edi
+ 871:	e8 72 fd ff ff       	call   5e8 <write>
+ 876:	83 c4 0c             	add    $0xc,%esp
+ 879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87c:	6a 01                	push   $0x1
+ 87e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 881:	52                   	push   %edx
+ 882:	57                   	push   %edi
+ 883:	e8 60 fd ff ff       	call   5e8 <write>
+        putc(fd, c);
+ 888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88b:	31 d2                	xor    %edx,%edx
+ 88d:	eb 8e                	jmp    81d <printf+0x4d>
+ 88f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 00                	push   $0x0
+ 89f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8a4:	e8 87 fe ff ff       	call   730 <printint>
+        ap++;
+ 8a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 67 ff ff ff       	jmp    81d <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8c5:	83 c0 04             	add    $0x4,%eax
+ 8c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8cb:	85 db                	test   %ebx,%ebx
+ 8cd:	0f 84 9d 00 00 00    	je     970 <printf+0x1a0>
+        while(*s != 0){
+ 8d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	0f 84 3d ff ff ff    	je     81d <printf+0x4d>
+ 8e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8e6:	89 de                	mov    %ebx,%esi
+ 8e8:	89 d3                	mov    %edx,%ebx
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	53                   	push   %ebx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 e6 fc ff ff       	call   5e8 <write>
+        while(*s != 0){
+ 902:	0f b6 06             	movzbl (%esi),%eax
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 e4                	jne    8f0 <printf+0x120>
+      state = 0;
+ 90c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 07 ff ff ff       	jmp    81d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 92b:	8b 13                	mov    (%ebx),%edx
+ 92d:	6a 01                	push   $0x1
+ 92f:	e9 6b ff ff ff       	jmp    89f <printf+0xcf>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	52                   	push   %edx
+ 94c:	57                   	push   %edi
+ 94d:	e8 96 fc ff ff       	call   5e8 <write>
+        ap++;
+ 952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	e9 be fe ff ff       	jmp    81d <printf+0x4d>
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 969:	6a 01                	push   $0x1
+ 96b:	e9 11 ff ff ff       	jmp    881 <printf+0xb1>
+ 970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 975:	bb 2c 0f 00 00       	mov    $0xf2c,%ebx
+ 97a:	e9 61 ff ff ff       	jmp    8e0 <printf+0x110>
+ 97f:	90                   	nop
+
+00000980 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 980:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	a1 64 d3 00 00       	mov    0xd364,%eax
+{
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	57                   	push   %edi
+ 989:	56                   	push   %esi
+ 98a:	53                   	push   %ebx
+ 98b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 98e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 998:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 99a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 99c:	39 ca                	cmp    %ecx,%edx
+ 99e:	73 30                	jae    9d0 <free+0x50>
+ 9a0:	39 c1                	cmp    %eax,%ecx
+ 9a2:	72 04                	jb     9a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a4:	39 c2                	cmp    %eax,%edx
+ 9a6:	72 f0                	jb     998 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ae:	39 f8                	cmp    %edi,%eax
+ 9b0:	74 2e                	je     9e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9bb:	39 f1                	cmp    %esi,%ecx
+ 9bd:	74 38                	je     9f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9c1:	5b                   	pop    %ebx
+  freep = p;
+ 9c2:	89 15 64 d3 00 00    	mov    %edx,0xd364
+}
+ 9c8:	5e                   	pop    %esi
+ 9c9:	5f                   	pop    %edi
+ 9ca:	5d                   	pop    %ebp
+ 9cb:	c3                   	ret
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d0:	39 c1                	cmp    %eax,%ecx
+ 9d2:	72 d0                	jb     9a4 <free+0x24>
+ 9d4:	eb c2                	jmp    998 <free+0x18>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9e0:	03 70 04             	add    0x4(%eax),%esi
+ 9e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e6:	8b 02                	mov    (%edx),%eax
+ 9e8:	8b 00                	mov    (%eax),%eax
+ 9ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9f3:	39 f1                	cmp    %esi,%ecx
+ 9f5:	75 c8                	jne    9bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 9f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9fa:	89 15 64 d3 00 00    	mov    %edx,0xd364
+    p->s.size += bp->s.size;
+ a00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a06:	89 0a                	mov    %ecx,(%edx)
+}
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a1c:	8b 15 64 d3 00 00    	mov    0xd364,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a22:	8d 78 07             	lea    0x7(%eax),%edi
+ a25:	c1 ef 03             	shr    $0x3,%edi
+ a28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a2b:	85 d2                	test   %edx,%edx
+ a2d:	0f 84 8d 00 00 00    	je     ac0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a35:	8b 48 04             	mov    0x4(%eax),%ecx
+ a38:	39 f9                	cmp    %edi,%ecx
+ a3a:	73 64                	jae    aa0 <malloc+0x90>
+  if(nu < 4096)
+ a3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a41:	39 df                	cmp    %ebx,%edi
+ a43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a4d:	eb 0a                	jmp    a59 <malloc+0x49>
+ a4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a52:	8b 48 04             	mov    0x4(%eax),%ecx
+ a55:	39 f9                	cmp    %edi,%ecx
+ a57:	73 47                	jae    aa0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a59:	89 c2                	mov    %eax,%edx
+ a5b:	39 05 64 d3 00 00    	cmp    %eax,0xd364
+ a61:	75 ed                	jne    a50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	56                   	push   %esi
+ a67:	e8 e4 fb ff ff       	call   650 <sbrk>
+  if(p == (char*)-1)
+ a6c:	83 c4 10             	add    $0x10,%esp
+ a6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a72:	74 1c                	je     a90 <malloc+0x80>
+  hp->s.size = nu;
+ a74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a77:	83 ec 0c             	sub    $0xc,%esp
+ a7a:	83 c0 08             	add    $0x8,%eax
+ a7d:	50                   	push   %eax
+ a7e:	e8 fd fe ff ff       	call   980 <free>
+  return freep;
+ a83:	8b 15 64 d3 00 00    	mov    0xd364,%edx
+      if((p = morecore(nunits)) == 0)
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	85 d2                	test   %edx,%edx
+ a8e:	75 c0                	jne    a50 <malloc+0x40>
+        return 0;
+  }
+}
+ a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a93:	31 c0                	xor    %eax,%eax
+}
+ a95:	5b                   	pop    %ebx
+ a96:	5e                   	pop    %esi
+ a97:	5f                   	pop    %edi
+ a98:	5d                   	pop    %ebp
+ a99:	c3                   	ret
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ aa0:	39 cf                	cmp    %ecx,%edi
+ aa2:	74 4c                	je     af0 <malloc+0xe0>
+        p->s.size -= nunits;
+ aa4:	29 f9                	sub    %edi,%ecx
+ aa6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ aa9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aaf:	89 15 64 d3 00 00    	mov    %edx,0xd364
+}
+ ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ab8:	83 c0 08             	add    $0x8,%eax
+}
+ abb:	5b                   	pop    %ebx
+ abc:	5e                   	pop    %esi
+ abd:	5f                   	pop    %edi
+ abe:	5d                   	pop    %ebp
+ abf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ac0:	c7 05 64 d3 00 00 68 	movl   $0xd368,0xd364
+ ac7:	d3 00 00 
+    base.s.size = 0;
+ aca:	b8 68 d3 00 00       	mov    $0xd368,%eax
+    base.s.ptr = freep = prevp = &base;
+ acf:	c7 05 68 d3 00 00 68 	movl   $0xd368,0xd368
+ ad6:	d3 00 00 
+    base.s.size = 0;
+ ad9:	c7 05 6c d3 00 00 00 	movl   $0x0,0xd36c
+ ae0:	00 00 00 
+    if(p->s.size >= nunits){
+ ae3:	e9 54 ff ff ff       	jmp    a3c <malloc+0x2c>
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ af0:	8b 08                	mov    (%eax),%ecx
+ af2:	89 0a                	mov    %ecx,(%edx)
+ af4:	eb b9                	jmp    aaf <malloc+0x9f>
+ af6:	66 90                	xchg   %ax,%ax
+ af8:	66 90                	xchg   %ax,%ax
+ afa:	66 90                	xchg   %ax,%ax
+ afc:	66 90                	xchg   %ax,%ax
+ afe:	66 90                	xchg   %ax,%ax
+
+00000b00 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 20             	sub    $0x20,%esp
+ b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+ b0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ b0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ b12:	68 e8 03 00 00       	push   $0x3e8
+ b17:	57                   	push   %edi
+ b18:	56                   	push   %esi
+ b19:	e8 e2 f9 ff ff       	call   500 <udiv64>
+ b1e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ b20:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ b23:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ b29:	29 c1                	sub    %eax,%ecx
+ b2b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ b2e:	68 e8 03 00 00       	push   $0x3e8
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	e8 c6 f9 ff ff       	call   500 <udiv64>
+ b3a:	83 c4 0c             	add    $0xc,%esp
+ b3d:	50                   	push   %eax
+ b3e:	68 9d 0f 00 00       	push   $0xf9d
+ b43:	53                   	push   %ebx
+ b44:	e8 87 fc ff ff       	call   7d0 <printf>
+  if(frac < 100)
+ b49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b4c:	83 c4 10             	add    $0x10,%esp
+ b4f:	83 f9 63             	cmp    $0x63,%ecx
+ b52:	76 1c                	jbe    b70 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ b54:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ b57:	c7 45 0c a3 0f 00 00 	movl   $0xfa3,0xc(%ebp)
+ b5e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b64:	5b                   	pop    %ebx
+ b65:	5e                   	pop    %esi
+ b66:	5f                   	pop    %edi
+ b67:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ b68:	e9 63 fc ff ff       	jmp    7d0 <printf>
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ b70:	83 ec 08             	sub    $0x8,%esp
+ b73:	68 a1 0f 00 00       	push   $0xfa1
+ b78:	53                   	push   %ebx
+ b79:	e8 52 fc ff ff       	call   7d0 <printf>
+  if(frac < 10)
+ b7e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b81:	83 c4 10             	add    $0x10,%esp
+ b84:	83 f9 09             	cmp    $0x9,%ecx
+ b87:	77 cb                	ja     b54 <printps+0x54>
+    printf(fd, "0");
+ b89:	83 ec 08             	sub    $0x8,%esp
+ b8c:	68 a1 0f 00 00       	push   $0xfa1
+ b91:	53                   	push   %ebx
+ b92:	e8 39 fc ff ff       	call   7d0 <printf>
+ b97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ b9a:	83 c4 10             	add    $0x10,%esp
+ b9d:	eb b5                	jmp    b54 <printps+0x54>
+ b9f:	90                   	nop
+
+00000ba0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ bac:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ baf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ bb2:	83 e8 01             	sub    $0x1,%eax
+ bb5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ bba:	0f 87 37 02 00 00    	ja     df7 <bench+0x257>
+ bc0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ bc3:	85 ff                	test   %edi,%edi
+ bc5:	0f 84 2c 02 00 00    	je     df7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ bcb:	83 ec 0c             	sub    $0xc,%esp
+ bce:	ff 75 10             	push   0x10(%ebp)
+ bd1:	ff 55 0c             	call   *0xc(%ebp)
+ bd4:	5b                   	pop    %ebx
+ bd5:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ bd8:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ bda:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ bdd:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ be0:	83 c4 10             	add    $0x10,%esp
+ be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ be7:	90                   	nop
+    t0 = cycles();
+ be8:	e8 33 f9 ff ff       	call   520 <cycles>
+    fn(arg);
+ bed:	83 ec 0c             	sub    $0xc,%esp
+ bf0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ bf3:	89 c6                	mov    %eax,%esi
+ bf5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ bf7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ bfa:	e8 21 f9 ff ff       	call   520 <cycles>
+ bff:	29 f0                	sub    %esi,%eax
+ c01:	19 fa                	sbb    %edi,%edx
+ c03:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c0a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ c0d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ c14:	83 c3 01             	add    $0x1,%ebx
+ c17:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ c1a:	7f cc                	jg     be8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ c1c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ c20:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ c23:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ c29:	bf 01 00 00 00       	mov    $0x1,%edi
+ c2e:	74 77                	je     ca7 <bench+0x107>
+ c30:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c37:	90                   	nop
+    v = a[i];
+ c38:	8b 01                	mov    (%ecx),%eax
+ c3a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ c3d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ c43:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ c49:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ c4f:	89 c8                	mov    %ecx,%eax
+ c51:	eb 1b                	jmp    c6e <bench+0xce>
+ c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c57:	90                   	nop
+      a[j] = a[j-1];
+ c58:	89 08                	mov    %ecx,(%eax)
+ c5a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ c5d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ c60:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ c66:	39 c3                	cmp    %eax,%ebx
+ c68:	0f 84 72 01 00 00    	je     de0 <bench+0x240>
+ c6e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ c71:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ c74:	89 f7                	mov    %esi,%edi
+ c76:	89 c3                	mov    %eax,%ebx
+ c78:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ c7e:	19 d7                	sbb    %edx,%edi
+ c80:	72 d6                	jb     c58 <bench+0xb8>
+ c82:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ c88:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ c8e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ c94:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ c97:	83 c7 01             	add    $0x1,%edi
+ c9a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ c9d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ c9f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ ca2:	75 94                	jne    c38 <bench+0x98>
+ ca4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ca7:	83 ec 08             	sub    $0x8,%esp
+ caa:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ cb0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ cb5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ cbb:	e8 70 f8 ff ff       	call   530 <cyc2ns>
+ cc0:	83 c4 0c             	add    $0xc,%esp
+ cc3:	ff 75 14             	push   0x14(%ebp)
+ cc6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ ccc:	f7 e3                	mul    %ebx
+ cce:	01 ca                	add    %ecx,%edx
+ cd0:	52                   	push   %edx
+ cd1:	50                   	push   %eax
+ cd2:	e8 29 f8 ff ff       	call   500 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ cd7:	89 06                	mov    %eax,(%esi)
+ cd9:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ cdc:	5f                   	pop    %edi
+ cdd:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ cde:	8b 45 18             	mov    0x18(%ebp),%eax
+ ce1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ce3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ cea:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ cf1:	e8 3a f8 ff ff       	call   530 <cyc2ns>
+ cf6:	83 c4 0c             	add    $0xc,%esp
+ cf9:	ff 75 14             	push   0x14(%ebp)
+ cfc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d02:	f7 e3                	mul    %ebx
+ d04:	01 ca                	add    %ecx,%edx
+ d06:	52                   	push   %edx
+ d07:	50                   	push   %eax
+ d08:	e8 f3 f7 ff ff       	call   500 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ d0d:	89 46 08             	mov    %eax,0x8(%esi)
+ d10:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d13:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d14:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d17:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d18:	8d 50 01             	lea    0x1(%eax),%edx
+ d1b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ d20:	6b d2 63             	imul   $0x63,%edx,%edx
+ d23:	f7 e2                	mul    %edx
+ d25:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ d28:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ d2f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ d36:	e8 f5 f7 ff ff       	call   530 <cyc2ns>
+ d3b:	83 c4 0c             	add    $0xc,%esp
+ d3e:	ff 75 14             	push   0x14(%ebp)
+ d41:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ d47:	f7 e3                	mul    %ebx
+ d49:	01 ca                	add    %ecx,%edx
+ d4b:	52                   	push   %edx
+ d4c:	50                   	push   %eax
+ d4d:	e8 ae f7 ff ff       	call   500 <udiv64>
+
+  if(name){
+ d52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ d55:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ d58:	89 46 10             	mov    %eax,0x10(%esi)
+ d5b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ d5e:	85 c9                	test   %ecx,%ecx
+ d60:	74 72                	je     dd4 <bench+0x234>
+    printf(1, "%s: min ", name);
+ d62:	83 ec 04             	sub    $0x4,%esp
+ d65:	ff 75 08             	push   0x8(%ebp)
+ d68:	68 a6 0f 00 00       	push   $0xfa6
+ d6d:	6a 01                	push   $0x1
+ d6f:	e8 5c fa ff ff       	call   7d0 <printf>
+    printps(1, st->min);
+ d74:	83 c4 0c             	add    $0xc,%esp
+ d77:	ff 76 04             	push   0x4(%esi)
+ d7a:	ff 36                	push   (%esi)
+ d7c:	6a 01                	push   $0x1
+ d7e:	e8 7d fd ff ff       	call   b00 <printps>
+    printf(1, " median ");
+ d83:	58                   	pop    %eax
+ d84:	5a                   	pop    %edx
+ d85:	68 af 0f 00 00       	push   $0xfaf
+ d8a:	6a 01                	push   $0x1
+ d8c:	e8 3f fa ff ff       	call   7d0 <printf>
+    printps(1, st->median);
+ d91:	83 c4 0c             	add    $0xc,%esp
+ d94:	ff 76 0c             	push   0xc(%esi)
+ d97:	ff 76 08             	push   0x8(%esi)
+ d9a:	6a 01                	push   $0x1
+ d9c:	e8 5f fd ff ff       	call   b00 <printps>
+    printf(1, " p99 ");
+ da1:	59                   	pop    %ecx
+ da2:	5b                   	pop    %ebx
+ da3:	68 b8 0f 00 00       	push   $0xfb8
+ da8:	6a 01                	push   $0x1
+ daa:	e8 21 fa ff ff       	call   7d0 <printf>
+    printps(1, st->p99);
+ daf:	83 c4 0c             	add    $0xc,%esp
+ db2:	ff 76 14             	push   0x14(%esi)
+ db5:	ff 76 10             	push   0x10(%esi)
+ db8:	6a 01                	push   $0x1
+ dba:	e8 41 fd ff ff       	call   b00 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ dbf:	83 c4 0c             	add    $0xc,%esp
+ dc2:	ff 75 18             	push   0x18(%ebp)
+ dc5:	68 be 0f 00 00       	push   $0xfbe
+ dca:	6a 01                	push   $0x1
+ dcc:	e8 ff f9 ff ff       	call   7d0 <printf>
+ dd1:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ dd4:	31 c0                	xor    %eax,%eax
+}
+ dd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dd9:	5b                   	pop    %ebx
+ dda:	5e                   	pop    %esi
+ ddb:	5f                   	pop    %edi
+ ddc:	5d                   	pop    %ebp
+ ddd:	c3                   	ret
+ dde:	66 90                	xchg   %ax,%ax
+ de0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ de6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ dec:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ df2:	e9 97 fe ff ff       	jmp    c8e <bench+0xee>
+    return -1;
+ df7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ dfc:	eb d8                	jmp    dd6 <bench+0x236>
@@ -0,0 +1,84 @@
+// Drain and print the kernel's vm event trace.
+//   vmtrace            print buffered events
+//   vmtrace all        trace every event type from now on
+//   vmtrace default    trace the default event types
+//   vmtrace off        stop tracing
+
+#include "types.h"
+#include "user.h"
+#include "trace.h"
+
+#define NEV 2048
+
+static char *names[NTRTYPE] = {
+[TR_KALLOC]           "kalloc",
+[TR_KALLOC_FAIL]      "kalloc FAIL",
+[TR_KALLOC_HUGE]      "kalloc_huge",
+[TR_KALLOC_HUGE_FAIL] "kalloc_huge FAIL",
+[TR_PROMOTE]          "promote",
+[TR_PROMOTE_FAIL]     "promote FAIL",
+[TR_DEMOTE]           "demote",
+[TR_PGFAULT]          "page fault",
+[TR_TLBFLUSH]         "tlb flush",
+[TR_LOST]             "lost events",
+};
+
+static struct traceev ev[NEV];
+
+// Merge the per-cpu streams into time order.
+static void
+sort(struct traceev *a, int n)
+{
+  struct traceev v;
+  int i, j;
+
+  for(i = 1; i < n; i++){
+    v = a[i];
+    for(j = i; j > 0 && a[j-1].tsc > v.tsc; j--)
+      a[j] = a[j-1];
+    a[j] = v;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  uint64 t0;
+  char *name;
+
+  if(argc > 1){
+    if(strcmp(argv[1], "all") == 0)
+      tracemask(~0);
+    else if(strcmp(argv[1], "default") == 0)
+      tracemask(TRMASK_DEFAULT);
+    else if(strcmp(argv[1], "off") == 0)
+      tracemask(0);
+    else
+      printf(2, "usage: vmtrace [all|default|off]\n");
+    exit();
+  }
+
+  if((n = traceread(ev, NEV)) < 0){
+    printf(2, "vmtrace: traceread failed\n");
+    exit();
+  }
+  sort(ev, n);
+
+  printf(1, "time(us)\tcpu\tpid\tevent\t\targ\n");
+  t0 = n > 0 ? ev[0].tsc : 0;
+  for(i = 0; i < n; i++){
+    name = ev[i].type < NTRTYPE ? names[ev[i].type] : 0;
+    if(name == 0)
+      name = "???";
+    printf(1, "%d\t%d\t%d\t%s\t", (uint)udiv64(cyc2ns(ev[i].tsc - t0), 1000),
+           ev[i].cpu, ev[i].pid, name);
+    if(strlen(name) < 8)
+      printf(1, "\t");
+    if(ev[i].type == TR_LOST)
+      printf(1, "%d\n", ev[i].arg);
+    else
+      printf(1, "0x%x\n", ev[i].arg);
+  }
+  exit();
+}
@@ -0,0 +1,1910 @@
+
+_wakebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 80 00 00 00       	mov    $0x80,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 28             	sub    $0x28,%esp
+  int fd[2], max, n, want, pid;
+  char c;
+
+  max = 128;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 10                	jle    31 <main+0x31>
+    max = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 64 03 00 00       	call   390 <atoi>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	89 c6                	mov    %eax,%esi
+  if(pipe(fd) < 0){
+  31:	83 ec 0c             	sub    $0xc,%esp
+  34:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  37:	50                   	push   %eax
+  38:	e8 9b 04 00 00       	call   4d8 <pipe>
+  3d:	83 c4 10             	add    $0x10,%esp
+  40:	85 c0                	test   %eax,%eax
+  42:	0f 88 39 01 00 00    	js     181 <main+0x181>
+    printf(2, "wakebench: pipe failed\n");
+    exit();
+  }
+
+  // Each child sleeps in read() until the pipe is closed.
+  printf(1, "sleepers\tns/wakeup\tns/tick wakeup\n");
+  48:	50                   	push   %eax
+  n = 0;
+  49:	31 ff                	xor    %edi,%edi
+  printf(1, "sleepers\tns/wakeup\tns/tick wakeup\n");
+  4b:	50                   	push   %eax
+  4c:	68 38 0d 00 00       	push   $0xd38
+  51:	6a 01                	push   $0x1
+  53:	e8 78 06 00 00       	call   6d0 <printf>
+  for(want = 0; want <= max; want = want ? want * 2 : 16){
+  58:	83 c4 10             	add    $0x10,%esp
+  5b:	31 c0                	xor    %eax,%eax
+  5d:	85 f6                	test   %esi,%esi
+  5f:	0f 88 2f 01 00 00    	js     194 <main+0x194>
+  65:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  68:	89 c3                	mov    %eax,%ebx
+        close(fd[1]);
+        read(fd[0], &c, 1);
+        exit();
+      }
+    }
+    sleep(10);   // let them all reach read()
+  6a:	83 ec 0c             	sub    $0xc,%esp
+  6d:	6a 0a                	push   $0xa
+  6f:	e8 e4 04 00 00       	call   558 <sleep>
+  if(kbench(KB_WAKEUP, res, 2) != 2){
+  74:	83 c4 0c             	add    $0xc,%esp
+  77:	6a 02                	push   $0x2
+  79:	68 a0 11 00 00       	push   $0x11a0
+  7e:	6a 02                	push   $0x2
+  80:	e8 43 05 00 00       	call   5c8 <kbench>
+  85:	83 c4 10             	add    $0x10,%esp
+  88:	83 f8 02             	cmp    $0x2,%eax
+  8b:	74 6e                	je     fb <main+0xfb>
+    printf(2, "wakebench: kbench failed\n");
+  8d:	50                   	push   %eax
+  8e:	50                   	push   %eax
+  8f:	68 18 0d 00 00       	push   $0xd18
+  94:	6a 02                	push   $0x2
+  96:	e8 35 06 00 00       	call   6d0 <printf>
+    return;
+  9b:	83 c4 10             	add    $0x10,%esp
+    report(n);
+    if(n < want)
+  9e:	39 fb                	cmp    %edi,%ebx
+  a0:	0f 8f ee 00 00 00    	jg     194 <main+0x194>
+  for(want = 0; want <= max; want = want ? want * 2 : 16){
+  a6:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+  a9:	85 db                	test   %ebx,%ebx
+  ab:	bb 10 00 00 00       	mov    $0x10,%ebx
+  b0:	0f 45 d8             	cmovne %eax,%ebx
+  b3:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+  b6:	0f 8c d8 00 00 00    	jl     194 <main+0x194>
+    for(; n < want; n++){
+  bc:	39 fb                	cmp    %edi,%ebx
+  be:	7f 0f                	jg     cf <main+0xcf>
+  c0:	eb a8                	jmp    6a <main+0x6a>
+  c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  c8:	83 c7 01             	add    $0x1,%edi
+  cb:	39 df                	cmp    %ebx,%edi
+  cd:	74 9b                	je     6a <main+0x6a>
+      if((pid = fork()) < 0)
+  cf:	e8 ec 03 00 00       	call   4c0 <fork>
+  d4:	85 c0                	test   %eax,%eax
+  d6:	78 92                	js     6a <main+0x6a>
+      if(pid == 0){
+  d8:	75 ee                	jne    c8 <main+0xc8>
+        close(fd[1]);
+  da:	83 ec 0c             	sub    $0xc,%esp
+  dd:	ff 75 e4             	push   -0x1c(%ebp)
+  e0:	e8 0b 04 00 00       	call   4f0 <close>
+        read(fd[0], &c, 1);
+  e5:	83 c4 0c             	add    $0xc,%esp
+  e8:	8d 45 df             	lea    -0x21(%ebp),%eax
+  eb:	6a 01                	push   $0x1
+  ed:	50                   	push   %eax
+  ee:	ff 75 e0             	push   -0x20(%ebp)
+  f1:	e8 ea 03 00 00       	call   4e0 <read>
+        exit();
+  f6:	e8 cd 03 00 00       	call   4c8 <exit>
+  printf(1, "%d", nsleep);
+  fb:	56                   	push   %esi
+  fc:	be a0 11 00 00       	mov    $0x11a0,%esi
+ 101:	57                   	push   %edi
+ 102:	68 32 0d 00 00       	push   $0xd32
+ 107:	6a 01                	push   $0x1
+ 109:	e8 c2 05 00 00       	call   6d0 <printf>
+    printps(1, udiv64(cyc2ns(res[i].cycles) * 1000, res[i].ops));
+ 10e:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 111:	83 c4 10             	add    $0x10,%esp
+    printf(1, "\t\t");
+ 114:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 2; i++){
+ 117:	83 c6 24             	add    $0x24,%esi
+    printf(1, "\t\t");
+ 11a:	68 35 0d 00 00       	push   $0xd35
+ 11f:	6a 01                	push   $0x1
+ 121:	e8 aa 05 00 00       	call   6d0 <printf>
+    printps(1, udiv64(cyc2ns(res[i].cycles) * 1000, res[i].ops));
+ 126:	5a                   	pop    %edx
+ 127:	8b 5e f4             	mov    -0xc(%esi),%ebx
+ 12a:	59                   	pop    %ecx
+ 12b:	ff 76 fc             	push   -0x4(%esi)
+ 12e:	ff 76 f8             	push   -0x8(%esi)
+ 131:	e8 fa 02 00 00       	call   430 <cyc2ns>
+ 136:	83 c4 0c             	add    $0xc,%esp
+ 139:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ 13f:	ba e8 03 00 00       	mov    $0x3e8,%edx
+ 144:	53                   	push   %ebx
+ 145:	f7 e2                	mul    %edx
+ 147:	01 ca                	add    %ecx,%edx
+ 149:	52                   	push   %edx
+ 14a:	50                   	push   %eax
+ 14b:	e8 b0 02 00 00       	call   400 <udiv64>
+ 150:	83 c4 0c             	add    $0xc,%esp
+ 153:	52                   	push   %edx
+ 154:	50                   	push   %eax
+ 155:	6a 01                	push   $0x1
+ 157:	e8 a4 08 00 00       	call   a00 <printps>
+  for(i = 0; i < 2; i++){
+ 15c:	b8 e8 11 00 00       	mov    $0x11e8,%eax
+ 161:	83 c4 10             	add    $0x10,%esp
+ 164:	39 f0                	cmp    %esi,%eax
+ 166:	75 ac                	jne    114 <main+0x114>
+  printf(1, "\n");
+ 168:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 16b:	50                   	push   %eax
+ 16c:	50                   	push   %eax
+ 16d:	68 fb 0d 00 00       	push   $0xdfb
+ 172:	6a 01                	push   $0x1
+ 174:	e8 57 05 00 00       	call   6d0 <printf>
+ 179:	83 c4 10             	add    $0x10,%esp
+ 17c:	e9 1d ff ff ff       	jmp    9e <main+0x9e>
+    printf(2, "wakebench: pipe failed\n");
+ 181:	50                   	push   %eax
+ 182:	50                   	push   %eax
+ 183:	68 00 0d 00 00       	push   $0xd00
+ 188:	6a 02                	push   $0x2
+ 18a:	e8 41 05 00 00       	call   6d0 <printf>
+    exit();
+ 18f:	e8 34 03 00 00       	call   4c8 <exit>
+      break;
+  }
+
+  close(fd[1]);
+ 194:	83 ec 0c             	sub    $0xc,%esp
+ 197:	ff 75 e4             	push   -0x1c(%ebp)
+ 19a:	e8 51 03 00 00       	call   4f0 <close>
+  while(wait() >= 0)
+ 19f:	83 c4 10             	add    $0x10,%esp
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 1a8:	e8 23 03 00 00       	call   4d0 <wait>
+ 1ad:	85 c0                	test   %eax,%eax
+ 1af:	79 f7                	jns    1a8 <main+0x1a8>
+    ;
+  exit();
+ 1b1:	e8 12 03 00 00       	call   4c8 <exit>
+ 1b6:	66 90                	xchg   %ax,%ax
+ 1b8:	66 90                	xchg   %ax,%ax
+ 1ba:	66 90                	xchg   %ax,%ax
+ 1bc:	66 90                	xchg   %ax,%ax
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 e3 01 00 00       	call   4e0 <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 b6 01 00 00       	call   508 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 b9 01 00 00       	call   520 <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 7f 01 00 00       	call   4f0 <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 400:	55                   	push   %ebp
+ 401:	31 d2                	xor    %edx,%edx
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	53                   	push   %ebx
+ 406:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 409:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 40c:	f7 f3                	div    %ebx
+ 40e:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 410:	8b 45 08             	mov    0x8(%ebp),%eax
+ 413:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 418:	89 ca                	mov    %ecx,%edx
+}
+ 41a:	c9                   	leave
+ 41b:	c3                   	ret
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 420:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 422:	c3                   	ret
+ 423:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 439:	8b 35 e8 11 00 00    	mov    0x11e8,%esi
+{
+ 43f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 442:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 445:	85 f6                	test   %esi,%esi
+ 447:	74 2f                	je     478 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 449:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 44e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 454:	f7 e3                	mul    %ebx
+ 456:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 459:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 45c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 45f:	31 d2                	xor    %edx,%edx
+ 461:	f7 f6                	div    %esi
+ 463:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 468:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 46b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 46d:	89 da                	mov    %ebx,%edx
+}
+ 46f:	5b                   	pop    %ebx
+ 470:	5e                   	pop    %esi
+ 471:	5f                   	pop    %edi
+ 472:	5d                   	pop    %ebp
+ 473:	c3                   	ret
+ 474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 478:	e8 0b 01 00 00       	call   588 <tscfreq>
+ 47d:	a3 e8 11 00 00       	mov    %eax,0x11e8
+ 482:	89 c6                	mov    %eax,%esi
+ 484:	eb c3                	jmp    449 <cyc2ns+0x19>
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000490 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	83 ec 10             	sub    $0x10,%esp
+ 497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 49a:	6a 00                	push   $0x0
+ 49c:	e8 3f 01 00 00       	call   5e0 <getpriority>
+ 4a1:	5a                   	pop    %edx
+ 4a2:	59                   	pop    %ecx
+ 4a3:	01 d8                	add    %ebx,%eax
+ 4a5:	50                   	push   %eax
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 2b 01 00 00       	call   5d8 <setpriority>
+  return getpriority(0);
+ 4ad:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 4b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 4b7:	83 c4 10             	add    $0x10,%esp
+}
+ 4ba:	c9                   	leave
+  return getpriority(0);
+ 4bb:	e9 20 01 00 00       	jmp    5e0 <getpriority>
+
+000004c0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <exit>:
+SYSCALL(exit)
+ 4c8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <wait>:
+SYSCALL(wait)
+ 4d0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <pipe>:
+SYSCALL(pipe)
+ 4d8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <read>:
+SYSCALL(read)
+ 4e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <write>:
+SYSCALL(write)
+ 4e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <close>:
+SYSCALL(close)
+ 4f0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <kill>:
+SYSCALL(kill)
+ 4f8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <exec>:
+SYSCALL(exec)
+ 500:	b8 07 00 00 00       	mov    $0x7,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <open>:
+SYSCALL(open)
+ 508:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <mknod>:
+SYSCALL(mknod)
+ 510:	b8 11 00 00 00       	mov    $0x11,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <unlink>:
+SYSCALL(unlink)
+ 518:	b8 12 00 00 00       	mov    $0x12,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <fstat>:
+SYSCALL(fstat)
+ 520:	b8 08 00 00 00       	mov    $0x8,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <link>:
+SYSCALL(link)
+ 528:	b8 13 00 00 00       	mov    $0x13,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <mkdir>:
+SYSCALL(mkdir)
+ 530:	b8 14 00 00 00       	mov    $0x14,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <chdir>:
+SYSCALL(chdir)
+ 538:	b8 09 00 00 00       	mov    $0x9,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <dup>:
+SYSCALL(dup)
+ 540:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <getpid>:
+SYSCALL(getpid)
+ 548:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <sbrk>:
+SYSCALL(sbrk)
+ 550:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <sleep>:
+SYSCALL(sleep)
+ 558:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <uptime>:
+SYSCALL(uptime)
+ 560:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <promote>:
+
+SYSCALL(promote)
+ 568:	b8 18 00 00 00       	mov    $0x18,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <demote>:
+SYSCALL(demote)
+ 570:	b8 19 00 00 00       	mov    $0x19,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 578:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 580:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <tscfreq>:
+SYSCALL(tscfreq)
+ 588:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <tracemask>:
+SYSCALL(tracemask)
+ 590:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <traceread>:
+SYSCALL(traceread)
+ 598:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <profile>:
+SYSCALL(profile)
+ 5a0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <profread>:
+SYSCALL(profread)
+ 5a8:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <lockstat>:
+SYSCALL(lockstat)
+ 5b0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 5b8:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <sysstat>:
+SYSCALL(sysstat)
+ 5c0:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <kbench>:
+SYSCALL(kbench)
+ 5c8:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <yield>:
+SYSCALL(yield)
+ 5d0:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <setpriority>:
+SYSCALL(setpriority)
+ 5d8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <getpriority>:
+SYSCALL(getpriority)
+ 5e0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5e8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5f0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <clone>:
+SYSCALL(clone)
+ 5f8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <join>:
+SYSCALL(join)
+ 600:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <futex_wait>:
+SYSCALL(futex_wait)
+ 608:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <futex_wake>:
+SYSCALL(futex_wake)
+ 610:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <spawn>:
+SYSCALL(spawn)
+ 618:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <diskstat>:
+SYSCALL(diskstat)
+ 620:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+ 628:	66 90                	xchg   %ax,%ax
+ 62a:	66 90                	xchg   %ax,%ax
+ 62c:	66 90                	xchg   %ax,%ax
+ 62e:	66 90                	xchg   %ax,%ax
+
+00000630 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 638:	89 d1                	mov    %edx,%ecx
+{
+ 63a:	83 ec 3c             	sub    $0x3c,%esp
+ 63d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 640:	85 d2                	test   %edx,%edx
+ 642:	0f 89 80 00 00 00    	jns    6c8 <printint+0x98>
+ 648:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 64c:	74 7a                	je     6c8 <printint+0x98>
+    x = -xx;
+ 64e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 650:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 655:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 658:	31 f6                	xor    %esi,%esi
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 660:	89 c8                	mov    %ecx,%eax
+ 662:	31 d2                	xor    %edx,%edx
+ 664:	89 f7                	mov    %esi,%edi
+ 666:	f7 f3                	div    %ebx
+ 668:	8d 76 01             	lea    0x1(%esi),%esi
+ 66b:	0f b6 92 bc 0d 00 00 	movzbl 0xdbc(%edx),%edx
+ 672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 676:	89 ca                	mov    %ecx,%edx
+ 678:	89 c1                	mov    %eax,%ecx
+ 67a:	39 da                	cmp    %ebx,%edx
+ 67c:	73 e2                	jae    660 <printint+0x30>
+  if(neg)
+ 67e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 681:	85 c0                	test   %eax,%eax
+ 683:	74 07                	je     68c <printint+0x5c>
+    buf[i++] = '-';
+ 685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 68a:	89 f7                	mov    %esi,%edi
+ 68c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 68f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 692:	01 df                	add    %ebx,%edi
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 698:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6a4:	6a 01                	push   $0x1
+ 6a6:	50                   	push   %eax
+ 6a7:	56                   	push   %esi
+ 6a8:	e8 3b fe ff ff       	call   4e8 <write>
+  while(--i >= 0)
+ 6ad:	89 f8                	mov    %edi,%eax
+ 6af:	83 c4 10             	add    $0x10,%esp
+ 6b2:	83 ef 01             	sub    $0x1,%edi
+ 6b5:	39 d8                	cmp    %ebx,%eax
+ 6b7:	75 df                	jne    698 <printint+0x68>
+}
+ 6b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6bc:	5b                   	pop    %ebx
+ 6bd:	5e                   	pop    %esi
+ 6be:	5f                   	pop    %edi
+ 6bf:	5d                   	pop    %ebp
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6c8:	31 c0                	xor    %eax,%eax
+ 6ca:	eb 89                	jmp    655 <printint+0x25>
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6df:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e2:	83 c6 01             	add    $0x1,%esi
+ 6e5:	84 db                	test   %bl,%bl
+ 6e7:	74 67                	je     750 <printf+0x80>
+ 6e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ec:	31 d2                	xor    %edx,%edx
+ 6ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6f1:	eb 34                	jmp    727 <printf+0x57>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+ 6f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 700:	83 f8 25             	cmp    $0x25,%eax
+ 703:	74 18                	je     71d <printf+0x4d>
+  write(fd, &c, 1);
+ 705:	83 ec 04             	sub    $0x4,%esp
+ 708:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 70b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70e:	6a 01                	push   $0x1
+ 710:	50                   	push   %eax
+ 711:	57                   	push   %edi
+ 712:	e8 d1 fd ff ff       	call   4e8 <write>
+ 717:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 71a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 71d:	0f b6 1e             	movzbl (%esi),%ebx
+ 720:	83 c6 01             	add    $0x1,%esi
+ 723:	84 db                	test   %bl,%bl
+ 725:	74 29                	je     750 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 727:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 72a:	85 d2                	test   %edx,%edx
+ 72c:	74 ca                	je     6f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 72e:	83 fa 25             	cmp    $0x25,%edx
+ 731:	75 ea                	jne    71d <printf+0x4d>
+      if(c == 'd'){
+ 733:	83 f8 25             	cmp    $0x25,%eax
+ 736:	0f 84 24 01 00 00    	je     860 <printf+0x190>
+ 73c:	83 e8 63             	sub    $0x63,%eax
+ 73f:	83 f8 15             	cmp    $0x15,%eax
+ 742:	77 1c                	ja     760 <printf+0x90>
+ 744:	ff 24 85 64 0d 00 00 	jmp    *0xd64(,%eax,4)
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 753:	5b                   	pop    %ebx
+ 754:	5e                   	pop    %esi
+ 755:	5f                   	pop    %edi
+ 756:	5d                   	pop    %ebp
+ 757:	c3                   	ret
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 766:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 76a:	6a 01                	push   $0x1
+ 76c:	52                   	push   %edx
+ 76d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 770:	57                   	push   %edi
+ 771:	e8 72 fd ff ff       	call   4e8 <write>
+ 776:	83 c4 0c             	add    $0xc,%esp
+ 779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77c:	6a 01                	push   $0x1
+ 77e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 781:	52                   	push   %edx
+ 782:	57                   	push   %edi
+ 783:	e8 60 fd ff ff       	call   4e8 <write>
+        putc(fd, c);
+ 788:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78b:	31 d2                	xor    %edx,%edx
+ 78d:	eb 8e                	jmp    71d <printf+0x4d>
+ 78f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 00                	push   $0x0
+ 79f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7a4:	e8 87 fe ff ff       	call   630 <printint>
+        ap++;
+ 7a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 67 ff ff ff       	jmp    71d <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7c5:	83 c0 04             	add    $0x4,%eax
+ 7c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7cb:	85 db                	test   %ebx,%ebx
+ 7cd:	0f 84 9d 00 00 00    	je     870 <printf+0x1a0>
+        while(*s != 0){
+ 7d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	0f 84 3d ff ff ff    	je     71d <printf+0x4d>
+ 7e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7e6:	89 de                	mov    %ebx,%esi
+ 7e8:	89 d3                	mov    %edx,%ebx
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	53                   	push   %ebx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 e6 fc ff ff       	call   4e8 <write>
+        while(*s != 0){
+ 802:	0f b6 06             	movzbl (%esi),%eax
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	84 c0                	test   %al,%al
+ 80a:	75 e4                	jne    7f0 <printf+0x120>
+      state = 0;
+ 80c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 07 ff ff ff       	jmp    71d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 01                	push   $0x1
+ 82f:	e9 6b ff ff ff       	jmp    79f <printf+0xcf>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 838:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 841:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 843:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 846:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	52                   	push   %edx
+ 84c:	57                   	push   %edi
+ 84d:	e8 96 fc ff ff       	call   4e8 <write>
+        ap++;
+ 852:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 855:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 858:	31 d2                	xor    %edx,%edx
+ 85a:	e9 be fe ff ff       	jmp    71d <printf+0x4d>
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 866:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 869:	6a 01                	push   $0x1
+ 86b:	e9 11 ff ff ff       	jmp    781 <printf+0xb1>
+ 870:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 875:	bb 5b 0d 00 00       	mov    $0xd5b,%ebx
+ 87a:	e9 61 ff ff ff       	jmp    7e0 <printf+0x110>
+ 87f:	90                   	nop
+
+00000880 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 880:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	a1 ec 11 00 00       	mov    0x11ec,%eax
+{
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	57                   	push   %edi
+ 889:	56                   	push   %esi
+ 88a:	53                   	push   %ebx
+ 88b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 88e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 898:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89c:	39 ca                	cmp    %ecx,%edx
+ 89e:	73 30                	jae    8d0 <free+0x50>
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 04                	jb     8a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a4:	39 c2                	cmp    %eax,%edx
+ 8a6:	72 f0                	jb     898 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ae:	39 f8                	cmp    %edi,%eax
+ 8b0:	74 2e                	je     8e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8bb:	39 f1                	cmp    %esi,%ecx
+ 8bd:	74 38                	je     8f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8c1:	5b                   	pop    %ebx
+  freep = p;
+ 8c2:	89 15 ec 11 00 00    	mov    %edx,0x11ec
+}
+ 8c8:	5e                   	pop    %esi
+ 8c9:	5f                   	pop    %edi
+ 8ca:	5d                   	pop    %ebp
+ 8cb:	c3                   	ret
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 d0                	jb     8a4 <free+0x24>
+ 8d4:	eb c2                	jmp    898 <free+0x18>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8e0:	03 70 04             	add    0x4(%eax),%esi
+ 8e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e6:	8b 02                	mov    (%edx),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8f3:	39 f1                	cmp    %esi,%ecx
+ 8f5:	75 c8                	jne    8bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 8f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8fa:	89 15 ec 11 00 00    	mov    %edx,0x11ec
+    p->s.size += bp->s.size;
+ 900:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 903:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 906:	89 0a                	mov    %ecx,(%edx)
+}
+ 908:	5b                   	pop    %ebx
+ 909:	5e                   	pop    %esi
+ 90a:	5f                   	pop    %edi
+ 90b:	5d                   	pop    %ebp
+ 90c:	c3                   	ret
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 919:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 91c:	8b 15 ec 11 00 00    	mov    0x11ec,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 922:	8d 78 07             	lea    0x7(%eax),%edi
+ 925:	c1 ef 03             	shr    $0x3,%edi
+ 928:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 92b:	85 d2                	test   %edx,%edx
+ 92d:	0f 84 8d 00 00 00    	je     9c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 933:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 935:	8b 48 04             	mov    0x4(%eax),%ecx
+ 938:	39 f9                	cmp    %edi,%ecx
+ 93a:	73 64                	jae    9a0 <malloc+0x90>
+  if(nu < 4096)
+ 93c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 941:	39 df                	cmp    %ebx,%edi
+ 943:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 946:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 94d:	eb 0a                	jmp    959 <malloc+0x49>
+ 94f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 950:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 952:	8b 48 04             	mov    0x4(%eax),%ecx
+ 955:	39 f9                	cmp    %edi,%ecx
+ 957:	73 47                	jae    9a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 959:	89 c2                	mov    %eax,%edx
+ 95b:	39 05 ec 11 00 00    	cmp    %eax,0x11ec
+ 961:	75 ed                	jne    950 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	56                   	push   %esi
+ 967:	e8 e4 fb ff ff       	call   550 <sbrk>
+  if(p == (char*)-1)
+ 96c:	83 c4 10             	add    $0x10,%esp
+ 96f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 972:	74 1c                	je     990 <malloc+0x80>
+  hp->s.size = nu;
+ 974:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 977:	83 ec 0c             	sub    $0xc,%esp
+ 97a:	83 c0 08             	add    $0x8,%eax
+ 97d:	50                   	push   %eax
+ 97e:	e8 fd fe ff ff       	call   880 <free>
+  return freep;
+ 983:	8b 15 ec 11 00 00    	mov    0x11ec,%edx
+      if((p = morecore(nunits)) == 0)
+ 989:	83 c4 10             	add    $0x10,%esp
+ 98c:	85 d2                	test   %edx,%edx
+ 98e:	75 c0                	jne    950 <malloc+0x40>
+        return 0;
+  }
+}
+ 990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 993:	31 c0                	xor    %eax,%eax
+}
+ 995:	5b                   	pop    %ebx
+ 996:	5e                   	pop    %esi
+ 997:	5f                   	pop    %edi
+ 998:	5d                   	pop    %ebp
+ 999:	c3                   	ret
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9a0:	39 cf                	cmp    %ecx,%edi
+ 9a2:	74 4c                	je     9f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9a4:	29 f9                	sub    %edi,%ecx
+ 9a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9af:	89 15 ec 11 00 00    	mov    %edx,0x11ec
+}
+ 9b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9b8:	83 c0 08             	add    $0x8,%eax
+}
+ 9bb:	5b                   	pop    %ebx
+ 9bc:	5e                   	pop    %esi
+ 9bd:	5f                   	pop    %edi
+ 9be:	5d                   	pop    %ebp
+ 9bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9c0:	c7 05 ec 11 00 00 f0 	movl   $0x11f0,0x11ec
+ 9c7:	11 00 00 
+    base.s.size = 0;
+ 9ca:	b8 f0 11 00 00       	mov    $0x11f0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9cf:	c7 05 f0 11 00 00 f0 	movl   $0x11f0,0x11f0
+ 9d6:	11 00 00 
+    base.s.size = 0;
+ 9d9:	c7 05 f4 11 00 00 00 	movl   $0x0,0x11f4
+ 9e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9e3:	e9 54 ff ff ff       	jmp    93c <malloc+0x2c>
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9f0:	8b 08                	mov    (%eax),%ecx
+ 9f2:	89 0a                	mov    %ecx,(%edx)
+ 9f4:	eb b9                	jmp    9af <malloc+0x9f>
+ 9f6:	66 90                	xchg   %ax,%ax
+ 9f8:	66 90                	xchg   %ax,%ax
+ 9fa:	66 90                	xchg   %ax,%ax
+ 9fc:	66 90                	xchg   %ax,%ax
+ 9fe:	66 90                	xchg   %ax,%ax
+
+00000a00 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 20             	sub    $0x20,%esp
+ a09:	8b 75 0c             	mov    0xc(%ebp),%esi
+ a0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+ a0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a12:	68 e8 03 00 00       	push   $0x3e8
+ a17:	57                   	push   %edi
+ a18:	56                   	push   %esi
+ a19:	e8 e2 f9 ff ff       	call   400 <udiv64>
+ a1e:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a20:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ a23:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ a29:	29 c1                	sub    %eax,%ecx
+ a2b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ a2e:	68 e8 03 00 00       	push   $0x3e8
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	e8 c6 f9 ff ff       	call   400 <udiv64>
+ a3a:	83 c4 0c             	add    $0xc,%esp
+ a3d:	50                   	push   %eax
+ a3e:	68 cd 0d 00 00       	push   $0xdcd
+ a43:	53                   	push   %ebx
+ a44:	e8 87 fc ff ff       	call   6d0 <printf>
+  if(frac < 100)
+ a49:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f9 63             	cmp    $0x63,%ecx
+ a52:	76 1c                	jbe    a70 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ a54:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ a57:	c7 45 0c 32 0d 00 00 	movl   $0xd32,0xc(%ebp)
+ a5e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ a61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a64:	5b                   	pop    %ebx
+ a65:	5e                   	pop    %esi
+ a66:	5f                   	pop    %edi
+ a67:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ a68:	e9 63 fc ff ff       	jmp    6d0 <printf>
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ a70:	83 ec 08             	sub    $0x8,%esp
+ a73:	68 d1 0d 00 00       	push   $0xdd1
+ a78:	53                   	push   %ebx
+ a79:	e8 52 fc ff ff       	call   6d0 <printf>
+  if(frac < 10)
+ a7e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a81:	83 c4 10             	add    $0x10,%esp
+ a84:	83 f9 09             	cmp    $0x9,%ecx
+ a87:	77 cb                	ja     a54 <printps+0x54>
+    printf(fd, "0");
+ a89:	83 ec 08             	sub    $0x8,%esp
+ a8c:	68 d1 0d 00 00       	push   $0xdd1
+ a91:	53                   	push   %ebx
+ a92:	e8 39 fc ff ff       	call   6d0 <printf>
+ a97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a9a:	83 c4 10             	add    $0x10,%esp
+ a9d:	eb b5                	jmp    a54 <printps+0x54>
+ a9f:	90                   	nop
+
+00000aa0 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ aac:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ aaf:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ ab2:	83 e8 01             	sub    $0x1,%eax
+ ab5:	3d ff 00 00 00       	cmp    $0xff,%eax
+ aba:	0f 87 37 02 00 00    	ja     cf7 <bench+0x257>
+ ac0:	8b 7d 14             	mov    0x14(%ebp),%edi
+ ac3:	85 ff                	test   %edi,%edi
+ ac5:	0f 84 2c 02 00 00    	je     cf7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ acb:	83 ec 0c             	sub    $0xc,%esp
+ ace:	ff 75 10             	push   0x10(%ebp)
+ ad1:	ff 55 0c             	call   *0xc(%ebp)
+ ad4:	5b                   	pop    %ebx
+ ad5:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ ad8:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ ada:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ add:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ ae0:	83 c4 10             	add    $0x10,%esp
+ ae3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ae7:	90                   	nop
+    t0 = cycles();
+ ae8:	e8 33 f9 ff ff       	call   420 <cycles>
+    fn(arg);
+ aed:	83 ec 0c             	sub    $0xc,%esp
+ af0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ af3:	89 c6                	mov    %eax,%esi
+ af5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ af7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ afa:	e8 21 f9 ff ff       	call   420 <cycles>
+ aff:	29 f0                	sub    %esi,%eax
+ b01:	19 fa                	sbb    %edi,%edx
+ b03:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b0a:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ b0d:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ b14:	83 c3 01             	add    $0x1,%ebx
+ b17:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ b1a:	7f cc                	jg     ae8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ b1c:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ b20:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ b23:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ b29:	bf 01 00 00 00       	mov    $0x1,%edi
+ b2e:	74 77                	je     ba7 <bench+0x107>
+ b30:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b37:	90                   	nop
+    v = a[i];
+ b38:	8b 01                	mov    (%ecx),%eax
+ b3a:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ b3d:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ b43:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ b49:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ b4f:	89 c8                	mov    %ecx,%eax
+ b51:	eb 1b                	jmp    b6e <bench+0xce>
+ b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b57:	90                   	nop
+      a[j] = a[j-1];
+ b58:	89 08                	mov    %ecx,(%eax)
+ b5a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ b5d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ b60:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ b66:	39 c3                	cmp    %eax,%ebx
+ b68:	0f 84 72 01 00 00    	je     ce0 <bench+0x240>
+ b6e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ b71:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ b74:	89 f7                	mov    %esi,%edi
+ b76:	89 c3                	mov    %eax,%ebx
+ b78:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ b7e:	19 d7                	sbb    %edx,%edi
+ b80:	72 d6                	jb     b58 <bench+0xb8>
+ b82:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b88:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ b8e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ b94:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ b97:	83 c7 01             	add    $0x1,%edi
+ b9a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ b9d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ b9f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ ba2:	75 94                	jne    b38 <bench+0x98>
+ ba4:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ba7:	83 ec 08             	sub    $0x8,%esp
+ baa:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ bb0:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ bb5:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ bbb:	e8 70 f8 ff ff       	call   430 <cyc2ns>
+ bc0:	83 c4 0c             	add    $0xc,%esp
+ bc3:	ff 75 14             	push   0x14(%ebp)
+ bc6:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ bcc:	f7 e3                	mul    %ebx
+ bce:	01 ca                	add    %ecx,%edx
+ bd0:	52                   	push   %edx
+ bd1:	50                   	push   %eax
+ bd2:	e8 29 f8 ff ff       	call   400 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ bd7:	89 06                	mov    %eax,(%esi)
+ bd9:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bdc:	5f                   	pop    %edi
+ bdd:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ bde:	8b 45 18             	mov    0x18(%ebp),%eax
+ be1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ be3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ bea:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ bf1:	e8 3a f8 ff ff       	call   430 <cyc2ns>
+ bf6:	83 c4 0c             	add    $0xc,%esp
+ bf9:	ff 75 14             	push   0x14(%ebp)
+ bfc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c02:	f7 e3                	mul    %ebx
+ c04:	01 ca                	add    %ecx,%edx
+ c06:	52                   	push   %edx
+ c07:	50                   	push   %eax
+ c08:	e8 f3 f7 ff ff       	call   400 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ c0d:	89 46 08             	mov    %eax,0x8(%esi)
+ c10:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c13:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c14:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c17:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c18:	8d 50 01             	lea    0x1(%eax),%edx
+ c1b:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ c20:	6b d2 63             	imul   $0x63,%edx,%edx
+ c23:	f7 e2                	mul    %edx
+ c25:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ c28:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ c2f:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ c36:	e8 f5 f7 ff ff       	call   430 <cyc2ns>
+ c3b:	83 c4 0c             	add    $0xc,%esp
+ c3e:	ff 75 14             	push   0x14(%ebp)
+ c41:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c47:	f7 e3                	mul    %ebx
+ c49:	01 ca                	add    %ecx,%edx
+ c4b:	52                   	push   %edx
+ c4c:	50                   	push   %eax
+ c4d:	e8 ae f7 ff ff       	call   400 <udiv64>
+
+  if(name){
+ c52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ c55:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c58:	89 46 10             	mov    %eax,0x10(%esi)
+ c5b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ c5e:	85 c9                	test   %ecx,%ecx
+ c60:	74 72                	je     cd4 <bench+0x234>
+    printf(1, "%s: min ", name);
+ c62:	83 ec 04             	sub    $0x4,%esp
+ c65:	ff 75 08             	push   0x8(%ebp)
+ c68:	68 d3 0d 00 00       	push   $0xdd3
+ c6d:	6a 01                	push   $0x1
+ c6f:	e8 5c fa ff ff       	call   6d0 <printf>
+    printps(1, st->min);
+ c74:	83 c4 0c             	add    $0xc,%esp
+ c77:	ff 76 04             	push   0x4(%esi)
+ c7a:	ff 36                	push   (%esi)
+ c7c:	6a 01                	push   $0x1
+ c7e:	e8 7d fd ff ff       	call   a00 <printps>
+    printf(1, " median ");
+ c83:	58                   	pop    %eax
+ c84:	5a                   	pop    %edx
+ c85:	68 dc 0d 00 00       	push   $0xddc
+ c8a:	6a 01                	push   $0x1
+ c8c:	e8 3f fa ff ff       	call   6d0 <printf>
+    printps(1, st->median);
+ c91:	83 c4 0c             	add    $0xc,%esp
+ c94:	ff 76 0c             	push   0xc(%esi)
+ c97:	ff 76 08             	push   0x8(%esi)
+ c9a:	6a 01                	push   $0x1
+ c9c:	e8 5f fd ff ff       	call   a00 <printps>
+    printf(1, " p99 ");
+ ca1:	59                   	pop    %ecx
+ ca2:	5b                   	pop    %ebx
+ ca3:	68 e5 0d 00 00       	push   $0xde5
+ ca8:	6a 01                	push   $0x1
+ caa:	e8 21 fa ff ff       	call   6d0 <printf>
+    printps(1, st->p99);
+ caf:	83 c4 0c             	add    $0xc,%esp
+ cb2:	ff 76 14             	push   0x14(%esi)
+ cb5:	ff 76 10             	push   0x10(%esi)
+ cb8:	6a 01                	push   $0x1
+ cba:	e8 41 fd ff ff       	call   a00 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ cbf:	83 c4 0c             	add    $0xc,%esp
+ cc2:	ff 75 18             	push   0x18(%ebp)
+ cc5:	68 eb 0d 00 00       	push   $0xdeb
+ cca:	6a 01                	push   $0x1
+ ccc:	e8 ff f9 ff ff       	call   6d0 <printf>
+ cd1:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ cd4:	31 c0                	xor    %eax,%eax
+}
+ cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cd9:	5b                   	pop    %ebx
+ cda:	5e                   	pop    %esi
+ cdb:	5f                   	pop    %edi
+ cdc:	5d                   	pop    %ebp
+ cdd:	c3                   	ret
+ cde:	66 90                	xchg   %ax,%ax
+ ce0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ce6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ cec:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ cf2:	e9 97 fe ff ff       	jmp    b8e <bench+0xee>
+    return -1;
+ cf7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ cfc:	eb d8                	jmp    cd6 <bench+0x236>
@@ -0,0 +1,65 @@
+// Measure the wakeup() cost paid on every timer interrupt
+// as the number of sleeping processes grows.
+//   wakebench [maxprocs]
+
+#include "types.h"
+#include "user.h"
+#include "kbench.h"
+
+static struct kbresult res[2];
+
+static void
+report(int nsleep)
+{
+  int i;
+
+  if(kbench(KB_WAKEUP, res, 2) != 2){
+    printf(2, "wakebench: kbench failed\n");
+    return;
+  }
+  printf(1, "%d", nsleep);
+  for(i = 0; i < 2; i++){
+    printf(1, "\t\t");
+    printps(1, udiv64(cyc2ns(res[i].cycles) * 1000, res[i].ops));
+  }
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd[2], max, n, want, pid;
+  char c;
+
+  max = 128;
+  if(argc > 1)
+    max = atoi(argv[1]);
+  if(pipe(fd) < 0){
+    printf(2, "wakebench: pipe failed\n");
+    exit();
+  }
+
+  // Each child sleeps in read() until the pipe is closed.
+  printf(1, "sleepers\tns/wakeup\tns/tick wakeup\n");
+  n = 0;
+  for(want = 0; want <= max; want = want ? want * 2 : 16){
+    for(; n < want; n++){
+      if((pid = fork()) < 0)
+        break;
+      if(pid == 0){
+        close(fd[1]);
+        read(fd[0], &c, 1);
+        exit();
+      }
+    }
+    sleep(10);   // let them all reach read()
+    report(n);
+    if(n < want)
+      break;
+  }
+
+  close(fd[1]);
+  while(wait() >= 0)
+    ;
+  exit();
+}
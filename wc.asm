@@ -0,0 +1,1896 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 67 04 00 00       	call   4b0 <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 6b 04 00 00       	call   4c8 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 e3 0c 00 00       	push   $0xce3
+  6e:	6a 01                	push   $0x1
+  70:	e8 1b 06 00 00       	call   690 <printf>
+      exit();
+  75:	e8 0e 04 00 00       	call   488 <exit>
+  }
+  exit();
+  7a:	e8 09 04 00 00       	call   488 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 9b 0d 00 00       	push   $0xd9b
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 f6 03 00 00       	call   488 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 60 11 00 00       	push   $0x1160
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 cb 03 00 00       	call   4a0 <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 60 11 00 00 	movsbl 0x1160(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 c0 0c 00 00       	push   $0xcc0
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 d6 0c 00 00       	push   $0xcd6
+ 155:	6a 01                	push   $0x1
+ 157:	e8 34 05 00 00       	call   690 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 c6 0c 00 00       	push   $0xcc6
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 1b 05 00 00       	call   690 <printf>
+    exit();
+ 175:	e8 0e 03 00 00       	call   488 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 e3 01 00 00       	call   4a0 <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 b6 01 00 00       	call   4c8 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 b9 01 00 00       	call   4e0 <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 7f 01 00 00       	call   4b0 <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <udiv64>:
+// Divide a 64-bit value by a 32-bit one.  The compiler would
+// call into libgcc for a plain 64-bit division, which user
+// programs do not link against.
+uint64
+udiv64(uint64 n, uint d)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	31 d2                	xor    %edx,%edx
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	53                   	push   %ebx
+ 3c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 3c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  uint hi, lo, qhi, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  qhi = hi / d;
+ 3cc:	f7 f3                	div    %ebx
+ 3ce:	89 c1                	mov    %eax,%ecx
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 3d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d3:	f7 f3                	div    %ebx
+  return ((uint64)qhi << 32) | qlo;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return ((uint64)qhi << 32) | qlo;
+ 3d8:	89 ca                	mov    %ecx,%edx
+}
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <cycles>:
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+  asm volatile("rdtsc" : "=A" (val));
+ 3e0:	0f 31                	rdtsc
+// Current value of the time-stamp counter.
+uint64
+cycles(void)
+{
+  return rdtsc();
+}
+ 3e2:	c3                   	ret
+ 3e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <cyc2ns>:
+
+// Convert a time-stamp counter delta to nanoseconds.
+uint64
+cyc2ns(uint64 c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	83 ec 1c             	sub    $0x1c,%esp
+  static uint khz;
+
+  if(khz == 0)
+ 3f9:	8b 35 60 13 00 00    	mov    0x1360,%esi
+{
+ 3ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 402:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(khz == 0)
+ 405:	85 f6                	test   %esi,%esi
+ 407:	74 2f                	je     438 <cyc2ns+0x48>
+    khz = tscfreq();
+  return udiv64(c * 1000000, khz);
+ 409:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 40e:	69 ff 40 42 0f 00    	imul   $0xf4240,%edi,%edi
+ 414:	f7 e3                	mul    %ebx
+ 416:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 419:	8d 04 17             	lea    (%edi,%edx,1),%eax
+ 41c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 41f:	31 d2                	xor    %edx,%edx
+ 421:	f7 f6                	div    %esi
+ 423:	89 c3                	mov    %eax,%ebx
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 428:	83 c4 1c             	add    $0x1c,%esp
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+ 42b:	f7 f6                	div    %esi
+  return ((uint64)qhi << 32) | qlo;
+ 42d:	89 da                	mov    %ebx,%edx
+}
+ 42f:	5b                   	pop    %ebx
+ 430:	5e                   	pop    %esi
+ 431:	5f                   	pop    %edi
+ 432:	5d                   	pop    %ebp
+ 433:	c3                   	ret
+ 434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    khz = tscfreq();
+ 438:	e8 0b 01 00 00       	call   548 <tscfreq>
+ 43d:	a3 60 13 00 00       	mov    %eax,0x1360
+ 442:	89 c6                	mov    %eax,%esi
+ 444:	eb c3                	jmp    409 <cyc2ns+0x19>
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <nice>:
+
+// Add incr to the caller's nice value and return the new value.
+int
+nice(int incr)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	83 ec 10             	sub    $0x10,%esp
+ 457:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  setpriority(0, getpriority(0) + incr);
+ 45a:	6a 00                	push   $0x0
+ 45c:	e8 3f 01 00 00       	call   5a0 <getpriority>
+ 461:	5a                   	pop    %edx
+ 462:	59                   	pop    %ecx
+ 463:	01 d8                	add    %ebx,%eax
+ 465:	50                   	push   %eax
+ 466:	6a 00                	push   $0x0
+ 468:	e8 2b 01 00 00       	call   598 <setpriority>
+  return getpriority(0);
+ 46d:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+}
+ 474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return getpriority(0);
+ 477:	83 c4 10             	add    $0x10,%esp
+}
+ 47a:	c9                   	leave
+  return getpriority(0);
+ 47b:	e9 20 01 00 00       	jmp    5a0 <getpriority>
+
+00000480 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 480:	b8 01 00 00 00       	mov    $0x1,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <exit>:
+SYSCALL(exit)
+ 488:	b8 02 00 00 00       	mov    $0x2,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <wait>:
+SYSCALL(wait)
+ 490:	b8 03 00 00 00       	mov    $0x3,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <pipe>:
+SYSCALL(pipe)
+ 498:	b8 04 00 00 00       	mov    $0x4,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <read>:
+SYSCALL(read)
+ 4a0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <write>:
+SYSCALL(write)
+ 4a8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <close>:
+SYSCALL(close)
+ 4b0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <kill>:
+SYSCALL(kill)
+ 4b8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <exec>:
+SYSCALL(exec)
+ 4c0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <open>:
+SYSCALL(open)
+ 4c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <mknod>:
+SYSCALL(mknod)
+ 4d0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <unlink>:
+SYSCALL(unlink)
+ 4d8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <fstat>:
+SYSCALL(fstat)
+ 4e0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <link>:
+SYSCALL(link)
+ 4e8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <mkdir>:
+SYSCALL(mkdir)
+ 4f0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <chdir>:
+SYSCALL(chdir)
+ 4f8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <dup>:
+SYSCALL(dup)
+ 500:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <getpid>:
+SYSCALL(getpid)
+ 508:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <sbrk>:
+SYSCALL(sbrk)
+ 510:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <sleep>:
+SYSCALL(sleep)
+ 518:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <uptime>:
+SYSCALL(uptime)
+ 520:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <promote>:
+
+SYSCALL(promote)
+ 528:	b8 18 00 00 00       	mov    $0x18,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <demote>:
+SYSCALL(demote)
+ 530:	b8 19 00 00 00       	mov    $0x19,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <huge_page_count>:
+SYSCALL(huge_page_count)
+ 538:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <get_free_pa_space>:
+SYSCALL(get_free_pa_space)
+ 540:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <tscfreq>:
+SYSCALL(tscfreq)
+ 548:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <tracemask>:
+SYSCALL(tracemask)
+ 550:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <traceread>:
+SYSCALL(traceread)
+ 558:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <profile>:
+SYSCALL(profile)
+ 560:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <profread>:
+SYSCALL(profread)
+ 568:	b8 20 00 00 00       	mov    $0x20,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <lockstat>:
+SYSCALL(lockstat)
+ 570:	b8 21 00 00 00       	mov    $0x21,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <lockstatreset>:
+SYSCALL(lockstatreset)
+ 578:	b8 22 00 00 00       	mov    $0x22,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <sysstat>:
+SYSCALL(sysstat)
+ 580:	b8 23 00 00 00       	mov    $0x23,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <kbench>:
+SYSCALL(kbench)
+ 588:	b8 24 00 00 00       	mov    $0x24,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <yield>:
+SYSCALL(yield)
+ 590:	b8 25 00 00 00       	mov    $0x25,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <setpriority>:
+SYSCALL(setpriority)
+ 598:	b8 26 00 00 00       	mov    $0x26,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <getpriority>:
+SYSCALL(getpriority)
+ 5a0:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5a8:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5b0:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <clone>:
+SYSCALL(clone)
+ 5b8:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <join>:
+SYSCALL(join)
+ 5c0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <futex_wait>:
+SYSCALL(futex_wait)
+ 5c8:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <futex_wake>:
+SYSCALL(futex_wake)
+ 5d0:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <spawn>:
+SYSCALL(spawn)
+ 5d8:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <diskstat>:
+SYSCALL(diskstat)
+ 5e0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+ 5e8:	66 90                	xchg   %ax,%ax
+ 5ea:	66 90                	xchg   %ax,%ax
+ 5ec:	66 90                	xchg   %ax,%ax
+ 5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5f8:	89 d1                	mov    %edx,%ecx
+{
+ 5fa:	83 ec 3c             	sub    $0x3c,%esp
+ 5fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 600:	85 d2                	test   %edx,%edx
+ 602:	0f 89 80 00 00 00    	jns    688 <printint+0x98>
+ 608:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 60c:	74 7a                	je     688 <printint+0x98>
+    x = -xx;
+ 60e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 610:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 615:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 618:	31 f6                	xor    %esi,%esi
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 620:	89 c8                	mov    %ecx,%eax
+ 622:	31 d2                	xor    %edx,%edx
+ 624:	89 f7                	mov    %esi,%edi
+ 626:	f7 f3                	div    %ebx
+ 628:	8d 76 01             	lea    0x1(%esi),%esi
+ 62b:	0f b6 92 58 0d 00 00 	movzbl 0xd58(%edx),%edx
+ 632:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 636:	89 ca                	mov    %ecx,%edx
+ 638:	89 c1                	mov    %eax,%ecx
+ 63a:	39 da                	cmp    %ebx,%edx
+ 63c:	73 e2                	jae    620 <printint+0x30>
+  if(neg)
+ 63e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 641:	85 c0                	test   %eax,%eax
+ 643:	74 07                	je     64c <printint+0x5c>
+    buf[i++] = '-';
+ 645:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 64a:	89 f7                	mov    %esi,%edi
+ 64c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 64f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 652:	01 df                	add    %ebx,%edi
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 658:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 661:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 664:	6a 01                	push   $0x1
+ 666:	50                   	push   %eax
+ 667:	56                   	push   %esi
+ 668:	e8 3b fe ff ff       	call   4a8 <write>
+  while(--i >= 0)
+ 66d:	89 f8                	mov    %edi,%eax
+ 66f:	83 c4 10             	add    $0x10,%esp
+ 672:	83 ef 01             	sub    $0x1,%edi
+ 675:	39 d8                	cmp    %ebx,%eax
+ 677:	75 df                	jne    658 <printint+0x68>
+}
+ 679:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67c:	5b                   	pop    %ebx
+ 67d:	5e                   	pop    %esi
+ 67e:	5f                   	pop    %edi
+ 67f:	5d                   	pop    %ebp
+ 680:	c3                   	ret
+ 681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 688:	31 c0                	xor    %eax,%eax
+ 68a:	eb 89                	jmp    615 <printint+0x25>
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 699:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 69c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 69f:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a2:	83 c6 01             	add    $0x1,%esi
+ 6a5:	84 db                	test   %bl,%bl
+ 6a7:	74 67                	je     710 <printf+0x80>
+ 6a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ac:	31 d2                	xor    %edx,%edx
+ 6ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6b1:	eb 34                	jmp    6e7 <printf+0x57>
+ 6b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6b7:	90                   	nop
+ 6b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6c0:	83 f8 25             	cmp    $0x25,%eax
+ 6c3:	74 18                	je     6dd <printf+0x4d>
+  write(fd, &c, 1);
+ 6c5:	83 ec 04             	sub    $0x4,%esp
+ 6c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ce:	6a 01                	push   $0x1
+ 6d0:	50                   	push   %eax
+ 6d1:	57                   	push   %edi
+ 6d2:	e8 d1 fd ff ff       	call   4a8 <write>
+ 6d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e0:	83 c6 01             	add    $0x1,%esi
+ 6e3:	84 db                	test   %bl,%bl
+ 6e5:	74 29                	je     710 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ea:	85 d2                	test   %edx,%edx
+ 6ec:	74 ca                	je     6b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ee:	83 fa 25             	cmp    $0x25,%edx
+ 6f1:	75 ea                	jne    6dd <printf+0x4d>
+      if(c == 'd'){
+ 6f3:	83 f8 25             	cmp    $0x25,%eax
+ 6f6:	0f 84 24 01 00 00    	je     820 <printf+0x190>
+ 6fc:	83 e8 63             	sub    $0x63,%eax
+ 6ff:	83 f8 15             	cmp    $0x15,%eax
+ 702:	77 1c                	ja     720 <printf+0x90>
+ 704:	ff 24 85 00 0d 00 00 	jmp    *0xd00(,%eax,4)
+ 70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 713:	5b                   	pop    %ebx
+ 714:	5e                   	pop    %esi
+ 715:	5f                   	pop    %edi
+ 716:	5d                   	pop    %ebp
+ 717:	c3                   	ret
+ 718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 726:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 72a:	6a 01                	push   $0x1
+ 72c:	52                   	push   %edx
+ 72d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 730:	57                   	push   %edi
+ 731:	e8 72 fd ff ff       	call   4a8 <write>
+ 736:	83 c4 0c             	add    $0xc,%esp
+ 739:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73c:	6a 01                	push   $0x1
+ 73e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 741:	52                   	push   %edx
+ 742:	57                   	push   %edi
+ 743:	e8 60 fd ff ff       	call   4a8 <write>
+        putc(fd, c);
+ 748:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74b:	31 d2                	xor    %edx,%edx
+ 74d:	eb 8e                	jmp    6dd <printf+0x4d>
+ 74f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 00                	push   $0x0
+ 75f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 761:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 764:	e8 87 fe ff ff       	call   5f0 <printint>
+        ap++;
+ 769:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 76c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 67 ff ff ff       	jmp    6dd <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 780:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 783:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 785:	83 c0 04             	add    $0x4,%eax
+ 788:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 78b:	85 db                	test   %ebx,%ebx
+ 78d:	0f 84 9d 00 00 00    	je     830 <printf+0x1a0>
+        while(*s != 0){
+ 793:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 796:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 798:	84 c0                	test   %al,%al
+ 79a:	0f 84 3d ff ff ff    	je     6dd <printf+0x4d>
+ 7a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7a6:	89 de                	mov    %ebx,%esi
+ 7a8:	89 d3                	mov    %edx,%ebx
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	53                   	push   %ebx
+ 7bc:	57                   	push   %edi
+ 7bd:	e8 e6 fc ff ff       	call   4a8 <write>
+        while(*s != 0){
+ 7c2:	0f b6 06             	movzbl (%esi),%eax
+ 7c5:	83 c4 10             	add    $0x10,%esp
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	75 e4                	jne    7b0 <printf+0x120>
+      state = 0;
+ 7cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7cf:	31 d2                	xor    %edx,%edx
+ 7d1:	e9 07 ff ff ff       	jmp    6dd <printf+0x4d>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7eb:	8b 13                	mov    (%ebx),%edx
+ 7ed:	6a 01                	push   $0x1
+ 7ef:	e9 6b ff ff ff       	jmp    75f <printf+0xcf>
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 801:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 803:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 806:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	52                   	push   %edx
+ 80c:	57                   	push   %edi
+ 80d:	e8 96 fc ff ff       	call   4a8 <write>
+        ap++;
+ 812:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 815:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 818:	31 d2                	xor    %edx,%edx
+ 81a:	e9 be fe ff ff       	jmp    6dd <printf+0x4d>
+ 81f:	90                   	nop
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 826:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 829:	6a 01                	push   $0x1
+ 82b:	e9 11 ff ff ff       	jmp    741 <printf+0xb1>
+ 830:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 835:	bb f7 0c 00 00       	mov    $0xcf7,%ebx
+ 83a:	e9 61 ff ff ff       	jmp    7a0 <printf+0x110>
+ 83f:	90                   	nop
+
+00000840 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 840:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	a1 64 13 00 00       	mov    0x1364,%eax
+{
+ 846:	89 e5                	mov    %esp,%ebp
+ 848:	57                   	push   %edi
+ 849:	56                   	push   %esi
+ 84a:	53                   	push   %ebx
+ 84b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 84e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 858:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 85a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 85c:	39 ca                	cmp    %ecx,%edx
+ 85e:	73 30                	jae    890 <free+0x50>
+ 860:	39 c1                	cmp    %eax,%ecx
+ 862:	72 04                	jb     868 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 864:	39 c2                	cmp    %eax,%edx
+ 866:	72 f0                	jb     858 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 868:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 86b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 86e:	39 f8                	cmp    %edi,%eax
+ 870:	74 2e                	je     8a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 872:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 875:	8b 42 04             	mov    0x4(%edx),%eax
+ 878:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 87b:	39 f1                	cmp    %esi,%ecx
+ 87d:	74 38                	je     8b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 87f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 881:	5b                   	pop    %ebx
+  freep = p;
+ 882:	89 15 64 13 00 00    	mov    %edx,0x1364
+}
+ 888:	5e                   	pop    %esi
+ 889:	5f                   	pop    %edi
+ 88a:	5d                   	pop    %ebp
+ 88b:	c3                   	ret
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 d0                	jb     864 <free+0x24>
+ 894:	eb c2                	jmp    858 <free+0x18>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8a0:	03 70 04             	add    0x4(%eax),%esi
+ 8a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a6:	8b 02                	mov    (%edx),%eax
+ 8a8:	8b 00                	mov    (%eax),%eax
+ 8aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8b3:	39 f1                	cmp    %esi,%ecx
+ 8b5:	75 c8                	jne    87f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ba:	89 15 64 13 00 00    	mov    %edx,0x1364
+    p->s.size += bp->s.size;
+ 8c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8c8:	5b                   	pop    %ebx
+ 8c9:	5e                   	pop    %esi
+ 8ca:	5f                   	pop    %edi
+ 8cb:	5d                   	pop    %ebp
+ 8cc:	c3                   	ret
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8dc:	8b 15 64 13 00 00    	mov    0x1364,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8e5:	c1 ef 03             	shr    $0x3,%edi
+ 8e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8eb:	85 d2                	test   %edx,%edx
+ 8ed:	0f 84 8d 00 00 00    	je     980 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f8:	39 f9                	cmp    %edi,%ecx
+ 8fa:	73 64                	jae    960 <malloc+0x90>
+  if(nu < 4096)
+ 8fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 901:	39 df                	cmp    %ebx,%edi
+ 903:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 906:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 90d:	eb 0a                	jmp    919 <malloc+0x49>
+ 90f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 910:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 912:	8b 48 04             	mov    0x4(%eax),%ecx
+ 915:	39 f9                	cmp    %edi,%ecx
+ 917:	73 47                	jae    960 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 919:	89 c2                	mov    %eax,%edx
+ 91b:	39 05 64 13 00 00    	cmp    %eax,0x1364
+ 921:	75 ed                	jne    910 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	56                   	push   %esi
+ 927:	e8 e4 fb ff ff       	call   510 <sbrk>
+  if(p == (char*)-1)
+ 92c:	83 c4 10             	add    $0x10,%esp
+ 92f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 932:	74 1c                	je     950 <malloc+0x80>
+  hp->s.size = nu;
+ 934:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 937:	83 ec 0c             	sub    $0xc,%esp
+ 93a:	83 c0 08             	add    $0x8,%eax
+ 93d:	50                   	push   %eax
+ 93e:	e8 fd fe ff ff       	call   840 <free>
+  return freep;
+ 943:	8b 15 64 13 00 00    	mov    0x1364,%edx
+      if((p = morecore(nunits)) == 0)
+ 949:	83 c4 10             	add    $0x10,%esp
+ 94c:	85 d2                	test   %edx,%edx
+ 94e:	75 c0                	jne    910 <malloc+0x40>
+        return 0;
+  }
+}
+ 950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 953:	31 c0                	xor    %eax,%eax
+}
+ 955:	5b                   	pop    %ebx
+ 956:	5e                   	pop    %esi
+ 957:	5f                   	pop    %edi
+ 958:	5d                   	pop    %ebp
+ 959:	c3                   	ret
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 960:	39 cf                	cmp    %ecx,%edi
+ 962:	74 4c                	je     9b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 964:	29 f9                	sub    %edi,%ecx
+ 966:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 969:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 96c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 96f:	89 15 64 13 00 00    	mov    %edx,0x1364
+}
+ 975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 978:	83 c0 08             	add    $0x8,%eax
+}
+ 97b:	5b                   	pop    %ebx
+ 97c:	5e                   	pop    %esi
+ 97d:	5f                   	pop    %edi
+ 97e:	5d                   	pop    %ebp
+ 97f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 980:	c7 05 64 13 00 00 68 	movl   $0x1368,0x1364
+ 987:	13 00 00 
+    base.s.size = 0;
+ 98a:	b8 68 13 00 00       	mov    $0x1368,%eax
+    base.s.ptr = freep = prevp = &base;
+ 98f:	c7 05 68 13 00 00 68 	movl   $0x1368,0x1368
+ 996:	13 00 00 
+    base.s.size = 0;
+ 999:	c7 05 6c 13 00 00 00 	movl   $0x0,0x136c
+ 9a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9a3:	e9 54 ff ff ff       	jmp    8fc <malloc+0x2c>
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9b0:	8b 08                	mov    (%eax),%ecx
+ 9b2:	89 0a                	mov    %ecx,(%edx)
+ 9b4:	eb b9                	jmp    96f <malloc+0x9f>
+ 9b6:	66 90                	xchg   %ax,%ax
+ 9b8:	66 90                	xchg   %ax,%ax
+ 9ba:	66 90                	xchg   %ax,%ax
+ 9bc:	66 90                	xchg   %ax,%ax
+ 9be:	66 90                	xchg   %ax,%ax
+
+000009c0 <printps>:
+}
+
+// Print a picosecond count as nanoseconds with three decimals.
+void
+printps(int fd, uint64 ps)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 20             	sub    $0x20,%esp
+ 9c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 9cc:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 9cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint frac;
+
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 9d2:	68 e8 03 00 00       	push   $0x3e8
+ 9d7:	57                   	push   %edi
+ 9d8:	56                   	push   %esi
+ 9d9:	e8 e2 f9 ff ff       	call   3c0 <udiv64>
+ 9de:	89 f1                	mov    %esi,%ecx
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9e0:	83 c4 0c             	add    $0xc,%esp
+  frac = ps - udiv64(ps, 1000) * 1000;
+ 9e3:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 9e9:	29 c1                	sub    %eax,%ecx
+ 9eb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(fd, "%d.", (uint)udiv64(ps, 1000));
+ 9ee:	68 e8 03 00 00       	push   $0x3e8
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	e8 c6 f9 ff ff       	call   3c0 <udiv64>
+ 9fa:	83 c4 0c             	add    $0xc,%esp
+ 9fd:	50                   	push   %eax
+ 9fe:	68 69 0d 00 00       	push   $0xd69
+ a03:	53                   	push   %ebx
+ a04:	e8 87 fc ff ff       	call   690 <printf>
+  if(frac < 100)
+ a09:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f9 63             	cmp    $0x63,%ecx
+ a12:	76 1c                	jbe    a30 <printps+0x70>
+    printf(fd, "0");
+  if(frac < 10)
+    printf(fd, "0");
+  printf(fd, "%d", frac);
+ a14:	89 4d 10             	mov    %ecx,0x10(%ebp)
+ a17:	c7 45 0c 6f 0d 00 00 	movl   $0xd6f,0xc(%ebp)
+ a1e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ a21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a24:	5b                   	pop    %ebx
+ a25:	5e                   	pop    %esi
+ a26:	5f                   	pop    %edi
+ a27:	5d                   	pop    %ebp
+  printf(fd, "%d", frac);
+ a28:	e9 63 fc ff ff       	jmp    690 <printf>
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(fd, "0");
+ a30:	83 ec 08             	sub    $0x8,%esp
+ a33:	68 6d 0d 00 00       	push   $0xd6d
+ a38:	53                   	push   %ebx
+ a39:	e8 52 fc ff ff       	call   690 <printf>
+  if(frac < 10)
+ a3e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a41:	83 c4 10             	add    $0x10,%esp
+ a44:	83 f9 09             	cmp    $0x9,%ecx
+ a47:	77 cb                	ja     a14 <printps+0x54>
+    printf(fd, "0");
+ a49:	83 ec 08             	sub    $0x8,%esp
+ a4c:	68 6d 0d 00 00       	push   $0xd6d
+ a51:	53                   	push   %ebx
+ a52:	e8 39 fc ff ff       	call   690 <printf>
+ a57:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ a5a:	83 c4 10             	add    $0x10,%esp
+ a5d:	eb b5                	jmp    a14 <printps+0x54>
+ a5f:	90                   	nop
+
+00000a60 <bench>:
+// Fills in *st and, if name is non-zero, prints a summary line.
+// Returns -1 if runs or ops is out of range.
+int
+bench(char *name, void (*fn)(void*), void *arg, uint ops, int runs,
+      struct benchstat *st)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	81 ec 1c 08 00 00    	sub    $0x81c,%esp
+  uint64 t[MAXRUNS], t0;
+  int i;
+
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a6c:	8b 45 18             	mov    0x18(%ebp),%eax
+{
+ a6f:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  if(runs < 1 || runs > MAXRUNS || ops == 0)
+ a72:	83 e8 01             	sub    $0x1,%eax
+ a75:	3d ff 00 00 00       	cmp    $0xff,%eax
+ a7a:	0f 87 37 02 00 00    	ja     cb7 <bench+0x257>
+ a80:	8b 7d 14             	mov    0x14(%ebp),%edi
+ a83:	85 ff                	test   %edi,%edi
+ a85:	0f 84 2c 02 00 00    	je     cb7 <bench+0x257>
+    return -1;
+
+  for(i = 0; i < WARMUP; i++)
+    fn(arg);
+ a8b:	83 ec 0c             	sub    $0xc,%esp
+ a8e:	ff 75 10             	push   0x10(%ebp)
+ a91:	ff 55 0c             	call   *0xc(%ebp)
+ a94:	5b                   	pop    %ebx
+ a95:	ff 75 10             	push   0x10(%ebp)
+  for(i = 0; i < runs; i++){
+ a98:	31 db                	xor    %ebx,%ebx
+    fn(arg);
+ a9a:	ff 55 0c             	call   *0xc(%ebp)
+  for(i = 0; i < runs; i++){
+ a9d:	89 75 1c             	mov    %esi,0x1c(%ebp)
+    fn(arg);
+ aa0:	83 c4 10             	add    $0x10,%esp
+ aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa7:	90                   	nop
+    t0 = cycles();
+ aa8:	e8 33 f9 ff ff       	call   3e0 <cycles>
+    fn(arg);
+ aad:	83 ec 0c             	sub    $0xc,%esp
+ ab0:	ff 75 10             	push   0x10(%ebp)
+    t0 = cycles();
+ ab3:	89 c6                	mov    %eax,%esi
+ ab5:	89 d7                	mov    %edx,%edi
+    fn(arg);
+ ab7:	ff 55 0c             	call   *0xc(%ebp)
+    t[i] = cycles() - t0;
+ aba:	e8 21 f9 ff ff       	call   3e0 <cycles>
+ abf:	29 f0                	sub    %esi,%eax
+ ac1:	19 fa                	sbb    %edi,%edx
+ ac3:	89 84 dd e8 f7 ff ff 	mov    %eax,-0x818(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ aca:	83 c4 10             	add    $0x10,%esp
+    t[i] = cycles() - t0;
+ acd:	89 94 dd ec f7 ff ff 	mov    %edx,-0x814(%ebp,%ebx,8)
+  for(i = 0; i < runs; i++){
+ ad4:	83 c3 01             	add    $0x1,%ebx
+ ad7:	39 5d 18             	cmp    %ebx,0x18(%ebp)
+ ada:	7f cc                	jg     aa8 <bench+0x48>
+  for(i = 1; i < n; i++){
+ adc:	83 7d 18 01          	cmpl   $0x1,0x18(%ebp)
+ ae0:	8b 75 1c             	mov    0x1c(%ebp),%esi
+ ae3:	8d 8d f0 f7 ff ff    	lea    -0x810(%ebp),%ecx
+ ae9:	bf 01 00 00 00       	mov    $0x1,%edi
+ aee:	74 77                	je     b67 <bench+0x107>
+ af0:	89 75 1c             	mov    %esi,0x1c(%ebp)
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+    v = a[i];
+ af8:	8b 01                	mov    (%ecx),%eax
+ afa:	8b 71 04             	mov    0x4(%ecx),%esi
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ afd:	89 8d e0 f7 ff ff    	mov    %ecx,-0x820(%ebp)
+ b03:	89 bd dc f7 ff ff    	mov    %edi,-0x824(%ebp)
+    v = a[i];
+ b09:	89 85 e4 f7 ff ff    	mov    %eax,-0x81c(%ebp)
+ b0f:	89 c8                	mov    %ecx,%eax
+ b11:	eb 1b                	jmp    b2e <bench+0xce>
+ b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b17:	90                   	nop
+      a[j] = a[j-1];
+ b18:	89 08                	mov    %ecx,(%eax)
+ b1a:	89 50 04             	mov    %edx,0x4(%eax)
+    for(j = i; j > 0 && a[j-1] > v; j--)
+ b1d:	8d 43 f8             	lea    -0x8(%ebx),%eax
+ b20:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ b26:	39 c3                	cmp    %eax,%ebx
+ b28:	0f 84 72 01 00 00    	je     ca0 <bench+0x240>
+ b2e:	8b 50 fc             	mov    -0x4(%eax),%edx
+ b31:	8b 48 f8             	mov    -0x8(%eax),%ecx
+ b34:	89 f7                	mov    %esi,%edi
+ b36:	89 c3                	mov    %eax,%ebx
+ b38:	39 8d e4 f7 ff ff    	cmp    %ecx,-0x81c(%ebp)
+ b3e:	19 d7                	sbb    %edx,%edi
+ b40:	72 d6                	jb     b18 <bench+0xb8>
+ b42:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ b48:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+    a[j] = v;
+ b4e:	8b 85 e4 f7 ff ff    	mov    -0x81c(%ebp),%eax
+ b54:	89 73 04             	mov    %esi,0x4(%ebx)
+  for(i = 1; i < n; i++){
+ b57:	83 c7 01             	add    $0x1,%edi
+ b5a:	83 c1 08             	add    $0x8,%ecx
+    a[j] = v;
+ b5d:	89 03                	mov    %eax,(%ebx)
+  for(i = 1; i < n; i++){
+ b5f:	39 7d 18             	cmp    %edi,0x18(%ebp)
+ b62:	75 94                	jne    af8 <bench+0x98>
+ b64:	8b 75 1c             	mov    0x1c(%ebp),%esi
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b67:	83 ec 08             	sub    $0x8,%esp
+ b6a:	ff b5 ec f7 ff ff    	push   -0x814(%ebp)
+ b70:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ b75:	ff b5 e8 f7 ff ff    	push   -0x818(%ebp)
+ b7b:	e8 70 f8 ff ff       	call   3f0 <cyc2ns>
+ b80:	83 c4 0c             	add    $0xc,%esp
+ b83:	ff 75 14             	push   0x14(%ebp)
+ b86:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ b8c:	f7 e3                	mul    %ebx
+ b8e:	01 ca                	add    %ecx,%edx
+ b90:	52                   	push   %edx
+ b91:	50                   	push   %eax
+ b92:	e8 29 f8 ff ff       	call   3c0 <udiv64>
+  }
+
+  sort(t, runs);
+  st->min = psperop(t[0], ops);
+ b97:	89 06                	mov    %eax,(%esi)
+ b99:	89 56 04             	mov    %edx,0x4(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ b9c:	5f                   	pop    %edi
+ b9d:	58                   	pop    %eax
+  st->median = psperop(t[runs/2], ops);
+ b9e:	8b 45 18             	mov    0x18(%ebp),%eax
+ ba1:	d1 f8                	sar    %eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ ba3:	ff b4 c5 ec f7 ff ff 	push   -0x814(%ebp,%eax,8)
+ baa:	ff b4 c5 e8 f7 ff ff 	push   -0x818(%ebp,%eax,8)
+ bb1:	e8 3a f8 ff ff       	call   3f0 <cyc2ns>
+ bb6:	83 c4 0c             	add    $0xc,%esp
+ bb9:	ff 75 14             	push   0x14(%ebp)
+ bbc:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ bc2:	f7 e3                	mul    %ebx
+ bc4:	01 ca                	add    %ecx,%edx
+ bc6:	52                   	push   %edx
+ bc7:	50                   	push   %eax
+ bc8:	e8 f3 f7 ff ff       	call   3c0 <udiv64>
+  st->median = psperop(t[runs/2], ops);
+ bcd:	89 46 08             	mov    %eax,0x8(%esi)
+ bd0:	89 56 0c             	mov    %edx,0xc(%esi)
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bd3:	58                   	pop    %eax
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bd4:	8b 45 18             	mov    0x18(%ebp),%eax
+  return udiv64(cyc2ns(c) * 1000, ops);
+ bd7:	5a                   	pop    %edx
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ bd8:	8d 50 01             	lea    0x1(%eax),%edx
+ bdb:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+ be0:	6b d2 63             	imul   $0x63,%edx,%edx
+ be3:	f7 e2                	mul    %edx
+ be5:	c1 ea 05             	shr    $0x5,%edx
+  return udiv64(cyc2ns(c) * 1000, ops);
+ be8:	ff b4 d5 e4 f7 ff ff 	push   -0x81c(%ebp,%edx,8)
+ bef:	ff b4 d5 e0 f7 ff ff 	push   -0x820(%ebp,%edx,8)
+ bf6:	e8 f5 f7 ff ff       	call   3f0 <cyc2ns>
+ bfb:	83 c4 0c             	add    $0xc,%esp
+ bfe:	ff 75 14             	push   0x14(%ebp)
+ c01:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ c07:	f7 e3                	mul    %ebx
+ c09:	01 ca                	add    %ecx,%edx
+ c0b:	52                   	push   %edx
+ c0c:	50                   	push   %eax
+ c0d:	e8 ae f7 ff ff       	call   3c0 <udiv64>
+
+  if(name){
+ c12:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ c15:	83 c4 10             	add    $0x10,%esp
+  st->p99 = psperop(t[(runs*99 + 99)/100 - 1], ops);
+ c18:	89 46 10             	mov    %eax,0x10(%esi)
+ c1b:	89 56 14             	mov    %edx,0x14(%esi)
+  if(name){
+ c1e:	85 c9                	test   %ecx,%ecx
+ c20:	74 72                	je     c94 <bench+0x234>
+    printf(1, "%s: min ", name);
+ c22:	83 ec 04             	sub    $0x4,%esp
+ c25:	ff 75 08             	push   0x8(%ebp)
+ c28:	68 72 0d 00 00       	push   $0xd72
+ c2d:	6a 01                	push   $0x1
+ c2f:	e8 5c fa ff ff       	call   690 <printf>
+    printps(1, st->min);
+ c34:	83 c4 0c             	add    $0xc,%esp
+ c37:	ff 76 04             	push   0x4(%esi)
+ c3a:	ff 36                	push   (%esi)
+ c3c:	6a 01                	push   $0x1
+ c3e:	e8 7d fd ff ff       	call   9c0 <printps>
+    printf(1, " median ");
+ c43:	58                   	pop    %eax
+ c44:	5a                   	pop    %edx
+ c45:	68 7b 0d 00 00       	push   $0xd7b
+ c4a:	6a 01                	push   $0x1
+ c4c:	e8 3f fa ff ff       	call   690 <printf>
+    printps(1, st->median);
+ c51:	83 c4 0c             	add    $0xc,%esp
+ c54:	ff 76 0c             	push   0xc(%esi)
+ c57:	ff 76 08             	push   0x8(%esi)
+ c5a:	6a 01                	push   $0x1
+ c5c:	e8 5f fd ff ff       	call   9c0 <printps>
+    printf(1, " p99 ");
+ c61:	59                   	pop    %ecx
+ c62:	5b                   	pop    %ebx
+ c63:	68 84 0d 00 00       	push   $0xd84
+ c68:	6a 01                	push   $0x1
+ c6a:	e8 21 fa ff ff       	call   690 <printf>
+    printps(1, st->p99);
+ c6f:	83 c4 0c             	add    $0xc,%esp
+ c72:	ff 76 14             	push   0x14(%esi)
+ c75:	ff 76 10             	push   0x10(%esi)
+ c78:	6a 01                	push   $0x1
+ c7a:	e8 41 fd ff ff       	call   9c0 <printps>
+    printf(1, " ns/op (%d runs)\n", runs);
+ c7f:	83 c4 0c             	add    $0xc,%esp
+ c82:	ff 75 18             	push   0x18(%ebp)
+ c85:	68 8a 0d 00 00       	push   $0xd8a
+ c8a:	6a 01                	push   $0x1
+ c8c:	e8 ff f9 ff ff       	call   690 <printf>
+ c91:	83 c4 10             	add    $0x10,%esp
+  }
+  return 0;
+ c94:	31 c0                	xor    %eax,%eax
+}
+ c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c99:	5b                   	pop    %ebx
+ c9a:	5e                   	pop    %esi
+ c9b:	5f                   	pop    %edi
+ c9c:	5d                   	pop    %ebp
+ c9d:	c3                   	ret
+ c9e:	66 90                	xchg   %ax,%ax
+ ca0:	8b 8d e0 f7 ff ff    	mov    -0x820(%ebp),%ecx
+ ca6:	8b bd dc f7 ff ff    	mov    -0x824(%ebp),%edi
+ cac:	8d 9d e8 f7 ff ff    	lea    -0x818(%ebp),%ebx
+ cb2:	e9 97 fe ff ff       	jmp    b4e <bench+0xee>
+    return -1;
+ cb7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ cbc:	eb d8                	jmp    c96 <bench+0x236>